@@ -0,0 +1,93 @@
+#include "AnalysisCache.hpp"
+#include "MappedFile.hpp"
+#include "EvalParams.hpp"
+#include "Nnue.hpp"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+using namespace std;
+
+namespace {
+    const uint32_t MAGIC = 0x43414743;   // "CGAC" in little-endian byte order.
+    const uint32_t VERSION = 2;
+    const size_t HEADER_SIZE = 64;
+
+    // The creating process fills in the header and publishes it by writing the magic last.
+    struct Header {
+        atomic<uint32_t> magic;
+        uint32_t version;
+        uint64_t entryCount;
+        uint64_t evalFingerprint;
+    };
+
+    uint64_t evaluationFingerprint() {
+        return Nnue::fingerprint() ^ (EvalParams::fingerprint() * 0x9E3779B97F4A7C15ull);
+    }
+
+    MappedFile file;
+    unique_ptr<TranspositionTable> table;
+}
+
+bool AnalysisCache::open(const string& path, size_t megabytes) {
+    close();
+    size_t entries = 1;
+    while (HEADER_SIZE + TranspositionTable::bytesFor(entries * 2) <= max<size_t>(megabytes, 1) << 20)
+        entries *= 2;
+
+    // Another process may be creating the file right now; give it a moment to publish the header.
+    for (int attempt = 0; attempt < 50; ++attempt) {
+        bool created = false;
+        if (!file.open(path, HEADER_SIZE + TranspositionTable::bytesFor(entries), created)) {
+            this_thread::sleep_for(chrono::milliseconds(20));
+            continue;
+        }
+        Header* header = static_cast<Header*>(file.data());
+        if (created) {
+            header->version = VERSION;
+            header->entryCount = entries;
+            header->evalFingerprint = evaluationFingerprint();
+            header->magic.store(MAGIC, memory_order_release);
+        }
+        if (file.size() >= HEADER_SIZE && header->magic.load(memory_order_acquire) == MAGIC) {
+            if (header->version != VERSION ||
+                file.size() != HEADER_SIZE + TranspositionTable::bytesFor(header->entryCount)) {
+                cerr << "Unsupported analysis cache file: " << path << endl;
+                file.close();
+                return false;
+            }
+            if (header->evalFingerprint != evaluationFingerprint()) {
+                cerr << "Analysis cache " << path << " was filled by a different evaluation"
+                     << " (network or --eval weights); use another file or delete it" << endl;
+                file.close();
+                return false;
+            }
+            table = make_unique<TranspositionTable>(static_cast<char*>(file.data()) + HEADER_SIZE,
+                                                    file.size() - HEADER_SIZE);
+            return true;
+        }
+        file.close();
+        this_thread::sleep_for(chrono::milliseconds(20));
+    }
+    cerr << "Not an analysis cache file: " << path << endl;
+    return false;
+}
+
+bool AnalysisCache::isOpen() {
+    return table != nullptr;
+}
+
+void AnalysisCache::close() {
+    table.reset();
+    file.close();
+}
+
+bool AnalysisCache::probe(uint64_t key, TranspositionTable::Entry& entry) {
+    return table && table->probe(key, entry);
+}
+
+void AnalysisCache::store(uint64_t key, int score, int depth, Bound bound, const tuple<int, int, int, int>& move) {
+    if (table && depth >= MIN_DEPTH)
+        table->store(key, score, depth, bound, move);
+}
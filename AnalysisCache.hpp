@@ -0,0 +1,35 @@
+#pragma once
+#include "TranspositionTable.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+using namespace std;
+
+// Optional on-disk cache of deep search results that survives between games and processes.
+//
+// The file is memory-mapped and shared: any number of engine processes may open the same file
+// at once. Entries use the transposition table's lockless format (key stored XORed with the
+// data word), so a write racing with another process's write or read is detected and ignored.
+// Only results of at least MIN_DEPTH plies are stored, and the search consults the cache at
+// the root and the first PROBE_PLIES plies, where the deep results live.
+//
+// File layout (native byte order): a 64-byte header ("CGAC", uint32 version 2, uint64 entry
+// count, uint64 evaluation fingerprint) followed by the entries. The fingerprint combines
+// Nnue::fingerprint and EvalParams::fingerprint, so it is 0 for the built-in evaluation; scores
+// from another evaluation would be wrong here, and a file whose fingerprint differs is refused.
+// Load any network or parameter file before opening the cache.
+namespace AnalysisCache {
+    const int MIN_DEPTH = 4;
+    const int PROBE_PLIES = 2;
+
+    // Opens the cache file, creating it with roughly 'megabytes' MB if it does not exist.
+    // An existing file keeps its own size. Returns false (and stays closed) on failure, including
+    // when the file was filled by a different evaluation.
+    bool open(const string& path, size_t megabytes);
+    bool isOpen();
+    void close();
+
+    bool probe(uint64_t key, TranspositionTable::Entry& entry);
+    void store(uint64_t key, int score, int depth, Bound bound, const tuple<int, int, int, int>& move);
+}
@@ -0,0 +1,150 @@
+#include "Analyzer.hpp"
+#include "Bot.hpp"
+#include "Notation.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <string>
+using namespace std;
+
+namespace {
+    const int PV_PLIES = 8;   // Moves shown per line.
+
+    // The line starting with 'first': the move itself, then the moves stored in the table,
+    // while they are legal and the line does not repeat a position.
+    string principalVariation(Board board, const tuple<int, int, int, int>& first, const TranspositionTable& table) {
+        string line;
+        set<uint64_t> seen;
+        tuple<int, int, int, int> move = first;
+        for (int ply = 0; ply < PV_PLIES; ++ply) {
+            const auto& legal = board.legalMoves();
+            if (find(legal.begin(), legal.end(), move) == legal.end() || !seen.insert(board.getHash()).second)
+                break;
+            line += (ply ? " " : "") + toSAN(board, move);
+            Bot::applyMove(board, move);
+            TranspositionTable::Entry entry;
+            if (!table.probe(board.getHash(), entry) || get<0>(entry.move) < 0)
+                break;
+            move = entry.move;
+        }
+        return line;
+    }
+}
+
+Analyzer::Analyzer(size_t hashMb, int lines)
+    : table(hashMb), lineCount(max(1, min(lines, AnalysisSnapshot::MAX_LINES))) {
+    worker = thread(&Analyzer::run, this);
+}
+
+Analyzer::~Analyzer() {
+    {
+        lock_guard<mutex> guard(lock);
+        quit = true;
+        stopSearch.store(true, memory_order_relaxed);
+    }
+    wake.notify_one();
+    worker.join();
+}
+
+// The stop flag is set and cleared under the lock, so a search started for a new position
+// cannot be cancelled by the request that asked for it.
+void Analyzer::analyze(const Board& board) {
+    {
+        lock_guard<mutex> guard(lock);
+        pending = make_unique<Board>(board);
+        stopSearch.store(true, memory_order_relaxed);
+    }
+    wake.notify_one();
+}
+
+void Analyzer::stop() {
+    lock_guard<mutex> guard(lock);
+    pending.reset();
+    stopSearch.store(true, memory_order_relaxed);
+}
+
+void Analyzer::run() {
+    CHESS_TRACE_THREAD("analysis");
+    unique_lock<mutex> guard(lock);
+    for (;;) {
+        wake.wait(guard, [this] { return quit || pending; });
+        if (quit)
+            return;
+        unique_ptr<Board> board = move(pending);
+        stopSearch.store(false, memory_order_relaxed);
+        searching = true;
+        guard.unlock();
+        search(*board);
+        guard.lock();
+        searching = false;
+        updated.notify_all();
+    }
+}
+
+void Analyzer::search(Board& board) {
+    bool white = board.isWhiteTurn();
+    SearchLimits limits;
+    limits.infinite = true;
+    limits.multiPv = lineCount;
+    limits.tt = &table;
+    limits.stop = &stopSearch;
+    limits.useAnalysisCache = false;
+    limits.onIteration = [&](const SearchIteration& iteration, const SearchStats& stats) {
+        AnalysisSnapshot snapshot;
+        snapshot.positionKey = board.getHash();
+        snapshot.depth = iteration.depth;
+        snapshot.nodes = stats.nodes;
+        snapshot.nps = stats.nps();
+        auto lines = iteration.lines;
+        if (lines.empty())
+            lines.emplace_back(iteration.bestMove, iteration.score);
+        snapshot.lineCount = static_cast<int>(min(lines.size(), static_cast<size_t>(AnalysisSnapshot::MAX_LINES)));
+        for (int i = 0; i < snapshot.lineCount; ++i) {
+            snapshot.scores[i] = white ? lines[i].second : -lines[i].second;
+            string text = principalVariation(board, lines[i].first, table);
+            strncpy(snapshot.lines[i], text.c_str(), AnalysisSnapshot::LINE_TEXT - 1);
+        }
+        publish(snapshot);
+    };
+    Bot::search(board, limits);
+}
+
+void Analyzer::publish(const AnalysisSnapshot& snapshot) {
+    uint32_t version = published.load(memory_order_relaxed) + 1;
+    Buffer& buffer = buffers[version & 1];
+    uint32_t sequence = buffer.sequence.load(memory_order_relaxed);
+    buffer.sequence.store(sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memcpy(&buffer.snapshot, &snapshot, sizeof snapshot);
+    buffer.sequence.store(sequence + 2, memory_order_release);
+    // Published under the lock so a reader in waitForUpdate cannot miss the notification.
+    lock_guard<mutex> guard(lock);
+    published.store(version, memory_order_release);
+    updated.notify_all();
+}
+
+bool Analyzer::waitForUpdate(uint32_t seen, chrono::milliseconds timeout) {
+    unique_lock<mutex> guard(lock);
+    auto finished = [&] { return !searching && !pending; };
+    if (published.load(memory_order_relaxed) == seen && finished())
+        return false;
+    updated.wait_for(guard, timeout, [&] { return published.load(memory_order_relaxed) != seen || finished(); });
+    return true;
+}
+
+bool Analyzer::read(AnalysisSnapshot& out) const {
+    for (;;) {
+        uint32_t version = published.load(memory_order_acquire);
+        if (version == 0)
+            return false;
+        const Buffer& buffer = buffers[version & 1];
+        uint32_t before = buffer.sequence.load(memory_order_acquire);
+        if (before & 1)
+            continue;
+        memcpy(&out, &buffer.snapshot, sizeof out);
+        atomic_thread_fence(memory_order_acquire);
+        if (buffer.sequence.load(memory_order_relaxed) == before)
+            return true;
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include "Board.hpp"
+#include "TranspositionTable.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+using namespace std;
+
+// The latest results of an Analyzer. Plain data, so it can be copied out of the shared
+// buffers without locks.
+struct AnalysisSnapshot {
+    static constexpr int MAX_LINES = 3;
+    static constexpr int LINE_TEXT = 96;
+
+    uint64_t positionKey = 0;   // Board::getHash() of the analysed position.
+    int depth = 0;
+    long long nodes = 0;
+    double nps = 0;
+    int lineCount = 0;
+    int scores[MAX_LINES] = {};              // From White's point of view; mates as in Bot.hpp.
+    char lines[MAX_LINES][LINE_TEXT] = {};   // Each line's moves in SAN, space separated.
+};
+
+// Searches one position at a time on a background thread, without a depth or time limit,
+// and publishes a snapshot after every completed iteration. The transposition table is kept
+// from one position to the next, so following a game re-searches mostly known positions.
+//
+// Snapshots go through two buffers, each guarded by a sequence counter: the search writes the
+// buffer not currently published and then publishes it, and a reader copies the published
+// one and retries only if the search republished twice during the copy. Neither side waits
+// for the other; a reader with nothing else to do can sleep in waitForUpdate instead of polling.
+class Analyzer {
+public:
+    explicit Analyzer(size_t hashMb = 64, int lines = 3);
+    ~Analyzer();
+
+    Analyzer(const Analyzer&) = delete;
+    Analyzer& operator=(const Analyzer&) = delete;
+
+    // Stops the current search, if any, and starts analysing 'board'.
+    void analyze(const Board& board);
+
+    // Stops the current search; the last snapshot stays readable.
+    void stop();
+
+    // Copies the latest snapshot into 'out'. Returns false before the first one.
+    bool read(AnalysisSnapshot& out) const;
+
+    // Changes whenever a new snapshot is published.
+    uint32_t version() const { return published.load(memory_order_acquire); }
+
+    // Waits up to 'timeout' for a snapshot newer than version 'seen', returning early if the
+    // search ends. Returns false without waiting once the search is over and 'seen' is the
+    // last snapshot: nothing will change until the next analyze.
+    bool waitForUpdate(uint32_t seen, chrono::milliseconds timeout);
+
+private:
+    struct Buffer {
+        atomic<uint32_t> sequence{ 0 };   // Odd while the search is writing 'snapshot'.
+        AnalysisSnapshot snapshot;
+    };
+
+    void run();
+    void search(Board& board);
+    void publish(const AnalysisSnapshot& snapshot);
+
+    TranspositionTable table;
+    int lineCount;
+    Buffer buffers[2];
+    atomic<uint32_t> published{ 0 };   // Number of snapshots published; the last is in buffers[published & 1].
+    atomic<bool> stopSearch{ false };
+
+    mutex lock;                 // Guards 'pending', 'searching' and 'quit'; never held while searching.
+    condition_variable wake;
+    condition_variable updated; // A snapshot was published or the search ended.
+    unique_ptr<Board> pending;  // Position to analyse next.
+    bool searching = false;
+    bool quit = false;
+    thread worker;
+};
@@ -0,0 +1,17 @@
+#pragma once
+#include <iosfwd>
+using namespace std;
+
+// Totals of a bench run.
+struct BenchResult {
+    long long nodes = 0;
+    double elapsedMs = 0;
+
+    double nps() const { return elapsedMs > 0 ? nodes * 1000.0 / elapsedMs : 0.0; }
+};
+
+// Searches a fixed list of built-in positions to 'depth' on the calling thread, printing the
+// nodes per position and the totals. The search is deterministic (no root shuffle, and the hash
+// table is cleared between positions), so the total node count is a signature of the search
+// and evaluation: it only changes when their behaviour does. NPS tracks raw speed.
+BenchResult runBench(int depth, ostream& out);
@@ -1,7 +1,11 @@
 #include "Board.hpp"
 #include "Piece.hpp"
+#include "Nnue.hpp"
 #include <iostream>
+#include <algorithm>
 #include <cmath>
+#include <cctype>
+#include <sstream>
 #include <vector>
 using namespace std;
 
@@ -23,8 +27,15 @@ Board::Board(const Board& other) {
     blackRookMoved[0] = other.blackRookMoved[0];
     blackRookMoved[1] = other.blackRookMoved[1];
     enPassantTarget = other.enPassantTarget;
+    halfmoveClock = other.halfmoveClock;
+    fullmoveNumber = other.fullmoveNumber;
+    hashKey = other.hashKey;
+    pawnHashKey = other.pawnHashKey;
+    accumulator = other.accumulator;
+    keyHistory = other.keyHistory;
+    moveCacheValid = false;
     moveLog = other.moveLog;
-    while (!moveHistory.empty()) moveHistory.pop();
+    clearHistory();
 
     for (int r = 0; r < 8; ++r) {
         for (int c = 0; c < 8; ++c) {
@@ -60,13 +71,21 @@ Board& Board::operator=(const Board& other) {
         blackRookMoved[0] = other.blackRookMoved[0];
         blackRookMoved[1] = other.blackRookMoved[1];
         enPassantTarget = other.enPassantTarget;
+        halfmoveClock = other.halfmoveClock;
+        fullmoveNumber = other.fullmoveNumber;
+        hashKey = other.hashKey;
+        pawnHashKey = other.pawnHashKey;
+        accumulator = other.accumulator;
+        keyHistory = other.keyHistory;
+        moveCacheValid = false;
         moveLog = other.moveLog;
-        while (!moveHistory.empty()) moveHistory.pop();
+        clearHistory();
     }
     return *this;
 }
 
 Board::~Board() {
+    clearHistory();
     for (int r = 0; r < 8; ++r)
         for (int c = 0; c < 8; ++c)
             delete board[r][c];
@@ -101,16 +120,25 @@ void Board::setupBoard() {
     whiteRookMoved[0] = whiteRookMoved[1] = false;
     blackRookMoved[0] = blackRookMoved[1] = false;
     enPassantTarget = { -1, -1 };
+    halfmoveClock = 0;
+    fullmoveNumber = 1;
     moveLog.clear();
-    while (!moveHistory.empty()) moveHistory.pop();
+    clearHistory();
+    refreshIncrementalState();
+    keyHistory.assign(1, hashKey);
 }
 
 Piece* Board::getPiece(int row, int col) const {
     return board[row][col];
 }
 
+// Callers may already have deleted the old piece, so the hashes are rebuilt rather than updated.
+// An arbitrary edit cannot be undone, and the piece it replaced may be one a recorded move
+// refers to, so the move history is dropped.
 void Board::setPiece(int row, int col, Piece* piece) {
     board[row][col] = piece;
+    clearHistory();
+    refreshIncrementalState();
 }
 
 //-------------------------------
@@ -128,8 +156,26 @@ void Board::movePiece(int fromRow, int fromCol, int toRow, int toCol) {
     move.toCol = toCol;
     move.movedPiece = piece;
     move.capturedPiece = board[toRow][toCol];
+    move.captureRow = toRow;
+    move.captureCol = toCol;
+    move.promoted = false;
     move.wasWhiteTurn = whiteTurn;
     move.prevEnPassant = enPassantTarget;
+    move.prevHalfmoveClock = halfmoveClock;
+    move.prevFullmoveNumber = fullmoveNumber;
+    move.prevKingMoved[0] = whiteKingMoved;
+    move.prevKingMoved[1] = blackKingMoved;
+    move.prevWhiteRookMoved[0] = whiteRookMoved[0];
+    move.prevWhiteRookMoved[1] = whiteRookMoved[1];
+    move.prevBlackRookMoved[0] = blackRookMoved[0];
+    move.prevBlackRookMoved[1] = blackRookMoved[1];
+    move.prevHash = hashKey;
+    move.prevPawnHash = pawnHashKey;
+
+    // Take the old castling rights and en passant file out of the hash; the new ones go back in below.
+    hashKey ^= Zobrist::castling(castlingRights());
+    if (enPassantTarget.first != -1)
+        hashKey ^= Zobrist::enPassant(enPassantTarget.second);
 
     // En passant: execute only if destination square is empty.
     if ((piece->getSymbol() == 'P' || piece->getSymbol() == 'p') &&
@@ -137,7 +183,9 @@ void Board::movePiece(int fromRow, int fromCol, int toRow, int toCol) {
         enPassantTarget == make_pair(toRow, toCol)) {
         int capRow = whiteTurn ? toRow + 1 : toRow - 1;
         move.capturedPiece = board[capRow][toCol];
-        delete board[capRow][toCol];
+        move.captureRow = capRow;
+        if (board[capRow][toCol])
+            pieceRemoved(board[capRow][toCol]->getSymbol(), capRow, toCol);
         board[capRow][toCol] = nullptr;
     }
 
@@ -145,9 +193,17 @@ void Board::movePiece(int fromRow, int fromCol, int toRow, int toCol) {
     if ((piece->getSymbol() == 'K' || piece->getSymbol() == 'k') && abs(toCol - fromCol) == 2) {
         int row = fromRow;
         if (toCol == 6) {
+            if (board[row][7]) {
+                pieceRemoved(board[row][7]->getSymbol(), row, 7);
+                pieceAdded(board[row][7]->getSymbol(), row, 5);
+            }
             board[row][5] = board[row][7];
             board[row][7] = nullptr;
         } else if (toCol == 2) {
+            if (board[row][0]) {
+                pieceRemoved(board[row][0]->getSymbol(), row, 0);
+                pieceAdded(board[row][0]->getSymbol(), row, 3);
+            }
             board[row][3] = board[row][0];
             board[row][0] = nullptr;
         }
@@ -173,8 +229,20 @@ void Board::movePiece(int fromRow, int fromCol, int toRow, int toCol) {
     else
         enPassantTarget = { -1, -1 };
 
-    // Delete any piece at the destination (normal capture) and complete the move.
-    delete board[toRow][toCol];
+    // Update the fifty-move and fullmove counters.
+    bool isPawnMove = piece->getSymbol() == 'P' || piece->getSymbol() == 'p';
+    halfmoveClock = (isPawnMove || move.capturedPiece) ? 0 : halfmoveClock + 1;
+    if (!whiteTurn) ++fullmoveNumber;
+
+    hashKey ^= Zobrist::castling(castlingRights());
+    if (enPassantTarget.first != -1)
+        hashKey ^= Zobrist::enPassant(enPassantTarget.second);
+
+    // Take any piece at the destination (normal capture) into the history and complete the move.
+    if (board[toRow][toCol])
+        pieceRemoved(board[toRow][toCol]->getSymbol(), toRow, toCol);
+    pieceRemoved(piece->getSymbol(), fromRow, fromCol);
+    pieceAdded(piece->getSymbol(), toRow, toCol);
     board[toRow][toCol] = piece;
     board[fromRow][fromCol] = nullptr;
 
@@ -186,18 +254,94 @@ void Board::movePiece(int fromRow, int fromCol, int toRow, int toCol) {
     moveLog.push_back(string() + file1 + rank1 + "->" + file2 + rank2);
 
     toggleTurn();
+    keyHistory.push_back(hashKey);
+    moveCacheValid = false;
+}
+
+void Board::makeMove(const tuple<int, int, int, int>& move) {
+    int toRow = get<2>(move), toCol = get<3>(move);
+    size_t before = moveHistory.size();
+    movePiece(get<0>(move), get<1>(move), toRow, toCol);
+    Piece* moved = board[toRow][toCol];
+    if (moveHistory.size() != before && moved &&
+        ((moved->getSymbol() == 'P' && toRow == 0) || (moved->getSymbol() == 'p' && toRow == 7)))
+        promote(toRow, toCol, moved->isWhite() ? 'Q' : 'q');
+}
+
+void Board::promote(int row, int col, char symbol) {
+    Piece* pawn = board[row][col];
+    if (!pawn) return;
+    pieceRemoved(pawn->getSymbol(), row, col);
+    board[row][col] = createPiece(symbol);
+    pieceAdded(symbol, row, col);
+
+    // The pawn stays in the history for undoMove; anything else being replaced is freed.
+    if (!moveHistory.empty() && moveHistory.top().movedPiece == pawn && !moveHistory.top().promoted &&
+        moveHistory.top().toRow == row && moveHistory.top().toCol == col)
+        moveHistory.top().promoted = true;
+    else
+        delete pawn;
+    if (!keyHistory.empty())
+        keyHistory.back() = hashKey;
+    moveCacheValid = false;
 }
 
+// Moves the pieces back with the incremental updates (keeping the NNUE accumulator in step)
+// and restores the hashes and flags saved with the move.
 void Board::undoMove() {
     if (moveHistory.empty()) return;
     Move m = moveHistory.top(); moveHistory.pop();
 
-    delete board[m.toRow][m.toCol];
+    Piece* arrived = board[m.toRow][m.toCol];
+    pieceRemoved(arrived->getSymbol(), m.toRow, m.toCol);
+    if (m.promoted)
+        delete arrived;
+    board[m.toRow][m.toCol] = nullptr;
     board[m.fromRow][m.fromCol] = m.movedPiece;
-    board[m.toRow][m.toCol] = m.capturedPiece;
+    pieceAdded(m.movedPiece->getSymbol(), m.fromRow, m.fromCol);
+    if (m.capturedPiece) {
+        board[m.captureRow][m.captureCol] = m.capturedPiece;
+        pieceAdded(m.capturedPiece->getSymbol(), m.captureRow, m.captureCol);
+    }
+
+    // Castling: put the rook back in its corner.
+    char symbol = m.movedPiece->getSymbol();
+    if ((symbol == 'K' || symbol == 'k') && abs(m.toCol - m.fromCol) == 2) {
+        int row = m.fromRow;
+        int rookFrom = m.toCol == 6 ? 7 : 0, rookTo = m.toCol == 6 ? 5 : 3;
+        if (board[row][rookTo]) {
+            pieceRemoved(board[row][rookTo]->getSymbol(), row, rookTo);
+            pieceAdded(board[row][rookTo]->getSymbol(), row, rookFrom);
+        }
+        board[row][rookFrom] = board[row][rookTo];
+        board[row][rookTo] = nullptr;
+    }
+
     whiteTurn = m.wasWhiteTurn;
     enPassantTarget = m.prevEnPassant;
+    halfmoveClock = m.prevHalfmoveClock;
+    fullmoveNumber = m.prevFullmoveNumber;
+    whiteKingMoved = m.prevKingMoved[0];
+    blackKingMoved = m.prevKingMoved[1];
+    whiteRookMoved[0] = m.prevWhiteRookMoved[0];
+    whiteRookMoved[1] = m.prevWhiteRookMoved[1];
+    blackRookMoved[0] = m.prevBlackRookMoved[0];
+    blackRookMoved[1] = m.prevBlackRookMoved[1];
+    hashKey = m.prevHash;
+    pawnHashKey = m.prevPawnHash;
     if (!moveLog.empty()) moveLog.pop_back();
+    if (keyHistory.size() > 1) keyHistory.pop_back();
+    moveCacheValid = false;
+}
+
+void Board::clearHistory() {
+    while (!moveHistory.empty()) {
+        Move& m = moveHistory.top();
+        delete m.capturedPiece;
+        if (m.promoted)
+            delete m.movedPiece;
+        moveHistory.pop();
+    }
 }
 
 //-------------------------------
@@ -217,7 +361,168 @@ pair<int, int> Board::getEnPassantTarget() const {
 }
 
 void Board::setEnPassantTarget(pair<int, int> target) {
+    if (enPassantTarget.first != -1)
+        hashKey ^= Zobrist::enPassant(enPassantTarget.second);
     enPassantTarget = target;
+    if (enPassantTarget.first != -1)
+        hashKey ^= Zobrist::enPassant(enPassantTarget.second);
+}
+
+//-------------------------------
+// Position Hashing
+//-------------------------------
+
+int Board::castlingRights() const {
+    int rights = 0;
+    if (!whiteKingMoved && !whiteRookMoved[1]) rights |= 1;
+    if (!whiteKingMoved && !whiteRookMoved[0]) rights |= 2;
+    if (!blackKingMoved && !blackRookMoved[1]) rights |= 4;
+    if (!blackKingMoved && !blackRookMoved[0]) rights |= 8;
+    return rights;
+}
+
+void Board::pieceAdded(char symbol, int row, int col) {
+    uint64_t key = Zobrist::piece(symbol, row, col);
+    hashKey ^= key;
+    if (symbol == 'P' || symbol == 'p')
+        pawnHashKey ^= key;
+    if (accumulator.generation != 0)
+        Nnue::addPiece(accumulator, symbol, row, col);
+}
+
+void Board::pieceRemoved(char symbol, int row, int col) {
+    uint64_t key = Zobrist::piece(symbol, row, col);
+    hashKey ^= key;
+    if (symbol == 'P' || symbol == 'p')
+        pawnHashKey ^= key;
+    if (accumulator.generation != 0)
+        Nnue::removePiece(accumulator, symbol, row, col);
+}
+
+// Recomputes the hashes from scratch and marks the NNUE accumulator for a rebuild.
+void Board::refreshIncrementalState() {
+    hashKey = pawnHashKey = 0;
+    accumulator.generation = 0;
+    for (int r = 0; r < 8; ++r)
+        for (int c = 0; c < 8; ++c)
+            if (board[r][c])
+                pieceAdded(board[r][c]->getSymbol(), r, c);
+    hashKey ^= Zobrist::castling(castlingRights());
+    if (enPassantTarget.first != -1)
+        hashKey ^= Zobrist::enPassant(enPassantTarget.second);
+    if (!whiteTurn)
+        hashKey ^= Zobrist::blackToMove();
+    if (!keyHistory.empty())
+        keyHistory.back() = hashKey;
+    moveCacheValid = false;
+}
+
+const Nnue::Accumulator& Board::getAccumulator() {
+    if (accumulator.generation != Nnue::generation())
+        Nnue::refresh(accumulator, *this);
+    return accumulator;
+}
+
+//-------------------------------
+// FEN Import and Export
+//-------------------------------
+
+bool Board::loadFEN(const string& fen) {
+    istringstream in(fen);
+    string placement, side, castling = "-", ep = "-";
+    int halfmove = 0, fullmove = 1;
+    if (!(in >> placement >> side))
+        return false;
+    in >> castling >> ep;
+    if (!(in >> halfmove)) halfmove = 0;
+    if (!(in >> fullmove)) fullmove = 1;
+    if (side != "w" && side != "b")
+        return false;
+
+    // Parse the placement into a scratch grid first so a bad string leaves the board untouched.
+    char grid[8][8] = {};
+    int row = 0, col = 0;
+    for (char ch : placement) {
+        if (ch == '/') {
+            if (col != 8) return false;
+            ++row;
+            col = 0;
+        } else if (isdigit(static_cast<unsigned char>(ch))) {
+            col += ch - '0';
+        } else if (string("PNBRQKpnbrqk").find(ch) != string::npos) {
+            if (row > 7 || col > 7) return false;
+            grid[row][col++] = ch;
+        } else {
+            return false;
+        }
+        if (col > 8) return false;
+    }
+    if (row != 7 || col != 8)
+        return false;
+
+    for (int r = 0; r < 8; ++r) {
+        for (int c = 0; c < 8; ++c) {
+            delete board[r][c];
+            board[r][c] = grid[r][c] ? createPiece(grid[r][c]) : nullptr;
+        }
+    }
+
+    // The board tracks "has moved" flags rather than castling rights, so map one onto the other.
+    whiteKingMoved = castling.find_first_of("KQ") == string::npos;
+    blackKingMoved = castling.find_first_of("kq") == string::npos;
+    whiteRookMoved[0] = castling.find('Q') == string::npos;
+    whiteRookMoved[1] = castling.find('K') == string::npos;
+    blackRookMoved[0] = castling.find('q') == string::npos;
+    blackRookMoved[1] = castling.find('k') == string::npos;
+
+    if (ep.size() == 2 && ep[0] >= 'a' && ep[0] <= 'h' && ep[1] >= '1' && ep[1] <= '8')
+        enPassantTarget = { '8' - ep[1], ep[0] - 'a' };
+    else
+        enPassantTarget = { -1, -1 };
+
+    whiteTurn = side == "w";
+    halfmoveClock = halfmove;
+    fullmoveNumber = fullmove;
+    moveLog.clear();
+    clearHistory();
+    refreshIncrementalState();
+    keyHistory.assign(1, hashKey);
+    return true;
+}
+
+string Board::toFEN() const {
+    string fen;
+    for (int r = 0; r < 8; ++r) {
+        int empty = 0;
+        for (int c = 0; c < 8; ++c) {
+            if (!board[r][c]) {
+                ++empty;
+                continue;
+            }
+            if (empty) fen += char('0' + empty);
+            empty = 0;
+            fen += board[r][c]->getSymbol();
+        }
+        if (empty) fen += char('0' + empty);
+        if (r < 7) fen += '/';
+    }
+
+    fen += whiteTurn ? " w " : " b ";
+    string castling;
+    if (!whiteKingMoved && !whiteRookMoved[1]) castling += 'K';
+    if (!whiteKingMoved && !whiteRookMoved[0]) castling += 'Q';
+    if (!blackKingMoved && !blackRookMoved[1]) castling += 'k';
+    if (!blackKingMoved && !blackRookMoved[0]) castling += 'q';
+    fen += castling.empty() ? "-" : castling;
+
+    fen += ' ';
+    if (enPassantTarget.first == -1)
+        fen += '-';
+    else
+        fen += string() + char('a' + enPassantTarget.second) + char('8' - enPassantTarget.first);
+
+    fen += ' ' + to_string(halfmoveClock) + ' ' + to_string(fullmoveNumber);
+    return fen;
 }
 
 //-------------------------------
@@ -257,59 +562,176 @@ bool Board::isInCheck(bool white) const {
 }
 
 bool Board::isCheckmate(bool white) {
-    if (!isInCheck(white))
-        return false;
-    for (int r = 0; r < 8; ++r) {
-        for (int c = 0; c < 8; ++c) {
-            Piece* p = getPiece(r, c);
-            if (p && p->isWhite() == white) {
-                vector<pair<int, int>> moves = p->getLegalMoves(r, c, *this);
-                for (auto& m : moves) {
-                    Board temp = *this;
-                    temp.movePiece(r, c, m.first, m.second);
-                    if (!temp.isInCheck(white))
-                        return false;
-                }
+    if (white == whiteTurn)
+        return status() == GameStatus::Checkmate;
+    return isInCheck(white) && !hasAnyLegalMove(white);
+}
+
+bool Board::isStalemate(bool white) {
+    if (white == whiteTurn)
+        return status() == GameStatus::Stalemate;
+    return !isInCheck(white) && !hasAnyLegalMove(white);
+}
+
+bool Board::hasLegalMoves(bool white) {
+    if (white == whiteTurn)
+        return !legalMoves().empty();
+    return hasAnyLegalMove(white);
+}
+
+//-------------------------------
+// Legal Move and Status Cache
+//-------------------------------
+
+// Collects legal moves for 'white' into 'moves', or with a null 'moves' just reports whether one exists.
+// Each candidate is tried on the board itself with movePiece and undoMove, which leave the
+// position (and a valid move cache) exactly as they found it.
+bool Board::findLegalMoves(bool white, vector<tuple<int, int, int, int>>* moves) {
+    bool flipped = whiteTurn != white;
+    if (flipped)
+        toggleTurn();
+    bool cacheValid = moveCacheValid;
+    bool found = false;
+    for (int r = 0; r < 8 && !(found && !moves); ++r) {
+        for (int c = 0; c < 8 && !(found && !moves); ++c) {
+            Piece* p = board[r][c];
+            if (!p || p->isWhite() != white)
+                continue;
+            for (auto& m : p->getLegalMoves(r, c, *this)) {
+                movePiece(r, c, m.first, m.second);
+                bool legal = !isInCheck(white);
+                undoMove();
+                if (!legal)
+                    continue;
+                found = true;
+                if (!moves)
+                    break;
+                moves->emplace_back(r, c, m.first, m.second);
             }
         }
     }
-    return true;
+    if (flipped)
+        toggleTurn();
+    moveCacheValid = cacheValid;
+    return found;
 }
 
-bool Board::isStalemate(bool white) {
-    if (isInCheck(white))
-        return false;
+vector<tuple<int, int, int, int>> Board::generateLegalMoves(bool white) {
+    vector<tuple<int, int, int, int>> moves;
+    findLegalMoves(white, &moves);
+    return moves;
+}
+
+bool Board::hasAnyLegalMove(bool white) {
+    return findLegalMoves(white, nullptr);
+}
+
+void Board::generatePseudoLegalMoves(vector<tuple<int, int, int, int>>& captures,
+                                     vector<tuple<int, int, int, int>>& quiets) const {
     for (int r = 0; r < 8; ++r) {
         for (int c = 0; c < 8; ++c) {
-            Piece* p = getPiece(r, c);
-            if (p && p->isWhite() == white) {
-                vector<pair<int, int>> moves = p->getLegalMoves(r, c, *this);
-                for (auto& m : moves) {
-                    Board temp = *this;
-                    temp.movePiece(r, c, m.first, m.second);
-                    if (!temp.isInCheck(white))
-                        return false;
-                }
+            Piece* p = board[r][c];
+            if (!p || p->isWhite() != whiteTurn)
+                continue;
+            for (auto& m : p->getLegalMoves(r, c, *this)) {
+                tuple<int, int, int, int> move(r, c, m.first, m.second);
+                if (isTactical(move))
+                    captures.push_back(move);
+                else
+                    quiets.push_back(move);
             }
         }
     }
-    return true;
 }
 
-bool Board::hasLegalMoves(bool white) {
+void Board::generateCaptures(vector<tuple<int, int, int, int>>& captures) const {
     for (int r = 0; r < 8; ++r) {
         for (int c = 0; c < 8; ++c) {
-            Piece* p = getPiece(r, c);
-            if (p && p->isWhite() == white) {
-                vector<pair<int, int>> moves = p->getLegalMoves(r, c, *this);
-                for (auto& m : moves) {
-                    Board temp = *this;
-                    temp.movePiece(r, c, m.first, m.second);
-                    if (!temp.isInCheck(white))
-                        return true;
-                }
+            Piece* p = board[r][c];
+            if (!p || p->isWhite() != whiteTurn)
+                continue;
+            for (auto& m : p->getLegalMoves(r, c, *this)) {
+                tuple<int, int, int, int> move(r, c, m.first, m.second);
+                if (isTactical(move))
+                    captures.push_back(move);
             }
         }
     }
+}
+
+bool Board::isPseudoLegal(const tuple<int, int, int, int>& move) const {
+    int fromRow = get<0>(move), fromCol = get<1>(move);
+    if (fromRow < 0 || fromRow > 7 || fromCol < 0 || fromCol > 7)
+        return false;
+    Piece* p = board[fromRow][fromCol];
+    if (!p || p->isWhite() != whiteTurn)
+        return false;
+    for (auto& m : p->getLegalMoves(fromRow, fromCol, *this))
+        if (m.first == get<2>(move) && m.second == get<3>(move))
+            return true;
     return false;
 }
+
+bool Board::isTactical(const tuple<int, int, int, int>& move) const {
+    int toRow = get<2>(move), toCol = get<3>(move);
+    if (board[toRow][toCol])
+        return true;
+    char symbol = board[get<0>(move)][get<1>(move)]->getSymbol();
+    if (symbol != 'P' && symbol != 'p')
+        return false;
+    return toRow == 0 || toRow == 7 || make_pair(toRow, toCol) == enPassantTarget;
+}
+
+// Bare kings, or a single minor piece against a bare king.
+bool Board::hasInsufficientMaterial() const {
+    int minors = 0;
+    for (int r = 0; r < 8; ++r) {
+        for (int c = 0; c < 8; ++c) {
+            if (!board[r][c]) continue;
+            char type = toupper(board[r][c]->getSymbol());
+            if (type == 'K') continue;
+            if (type != 'N' && type != 'B') return false;
+            ++minors;
+        }
+    }
+    return minors <= 1;
+}
+
+void Board::refreshMoveCache() {
+    if (moveCacheValid && moveCacheKey == hashKey)
+        return;
+
+    cachedMoves = generateLegalMoves(whiteTurn);
+    bool check = isInCheck(whiteTurn);
+
+    // A position repeats only within the current fifty-move window, and only with the same side to move.
+    int repetitions = 1;
+    int window = min<int>(halfmoveClock, static_cast<int>(keyHistory.size()) - 1);
+    for (int back = 2; back <= window; back += 2)
+        if (keyHistory[keyHistory.size() - 1 - back] == hashKey)
+            ++repetitions;
+
+    if (cachedMoves.empty())
+        cachedStatus = check ? GameStatus::Checkmate : GameStatus::Stalemate;
+    else if (halfmoveClock >= 100)
+        cachedStatus = GameStatus::DrawByFiftyMoves;
+    else if (repetitions >= 3)
+        cachedStatus = GameStatus::DrawByRepetition;
+    else if (hasInsufficientMaterial())
+        cachedStatus = GameStatus::DrawByInsufficientMaterial;
+    else
+        cachedStatus = check ? GameStatus::Check : GameStatus::Ongoing;
+
+    moveCacheKey = hashKey;
+    moveCacheValid = true;
+}
+
+const vector<tuple<int, int, int, int>>& Board::legalMoves() {
+    refreshMoveCache();
+    return cachedMoves;
+}
+
+GameStatus Board::status() {
+    refreshMoveCache();
+    return cachedStatus;
+}
@@ -1,10 +1,25 @@
 #pragma once
 #include "Piece.hpp"
+#include "Zobrist.hpp"
+#include "Nnue.hpp"
+#include <cstdint>
 #include <stack>
+#include <tuple>
 #include <vector>
 #include <string>
 using namespace std;
 
+// Where the game stands for the side to move.
+enum class GameStatus {
+    Ongoing,
+    Check,
+    Checkmate,
+    Stalemate,
+    DrawByFiftyMoves,
+    DrawByRepetition,
+    DrawByInsufficientMaterial
+};
+
 class Board {
 public:
     Board();
@@ -16,22 +31,77 @@ public:
     Piece* getPiece(int row, int col) const;
     void setPiece(int row, int col, Piece* piece);
     void movePiece(int fromRow, int fromCol, int toRow, int toCol);
+
+    // Plays 'move' the way the bot does, promoting a pawn to a queen. Unlike a copy of the
+    // board per move, this and undoMove let a search walk one board up and down the tree.
+    void makeMove(const tuple<int, int, int, int>& move);
+
+    // Replaces the pawn that has just reached the last rank at (row, col) with a new piece
+    // ('Q', 'n', ...). The pawn is kept with the move, so undoMove restores it.
+    void promote(int row, int col, char symbol);
+
+    // Takes back the last movePiece or makeMove (with its promotion), restoring the position exactly.
     void undoMove();
 
     bool isWhiteTurn() const { return whiteTurn; }
-    void toggleTurn() { whiteTurn = !whiteTurn; }
+    void toggleTurn() { whiteTurn = !whiteTurn; hashKey ^= Zobrist::blackToMove(); }
 
     bool isInCheck(bool white) const;
     bool hasLegalMoves(bool white);
     bool isCheckmate(bool white);
     bool isStalemate(bool white);
 
+    // Legal moves for the side to move as (fromRow, fromCol, toRow, toCol), and the game status.
+    // Both are computed once per position and cached until the position changes, so the UI and
+    // the bot can ask as often as they like.
+    const vector<tuple<int, int, int, int>>& legalMoves();
+    GameStatus status();
+    bool isGameOver() { return status() != GameStatus::Ongoing && status() != GameStatus::Check; }
+
+    // All legal moves for either side, bypassing the cache.
+    vector<tuple<int, int, int, int>> generateLegalMoves(bool white);
+
+    // Moves for the side to move before testing whether they leave its own king in check, split
+    // into captures (including en passant and promotions) and quiet moves. The search tests
+    // legality one move at a time, only for the moves it actually tries.
+    void generatePseudoLegalMoves(vector<tuple<int, int, int, int>>& captures,
+                                  vector<tuple<int, int, int, int>>& quiets) const;
+
+    // The captures and promotions of generatePseudoLegalMoves alone, in the same order, for
+    // searches that never look at quiet moves.
+    void generateCaptures(vector<tuple<int, int, int, int>>& captures) const;
+
+    // Whether 'move' is one generatePseudoLegalMoves would produce here. Used to vet moves
+    // remembered from other positions (hash and killer moves) before playing them.
+    bool isPseudoLegal(const tuple<int, int, int, int>& move) const;
+
+    // Whether 'move' captures something or promotes a pawn.
+    bool isTactical(const tuple<int, int, int, int>& move) const;
+
     bool hasKingMoved(bool white) const;
     bool hasRookMoved(bool white, bool kingSide) const;
 
     void setEnPassantTarget(pair<int, int> target);
     pair<int, int> getEnPassantTarget() const;
 
+    // Zobrist hash of the whole position, and of the pawns alone (keys the pawn hash table).
+    // Both are kept up to date incrementally by movePiece.
+    uint64_t getHash() const { return hashKey; }
+    uint64_t getPawnHash() const { return pawnHashKey; }
+
+    // NNUE first-layer sums for this position. Updated incrementally by movePiece once built;
+    // rebuilt here if it has never been computed or a different network has been loaded since.
+    const Nnue::Accumulator& getAccumulator();
+
+    int getHalfmoveClock() const { return halfmoveClock; }
+    int getFullmoveNumber() const { return fullmoveNumber; }
+
+    // Replaces the position with the one described by a FEN (or EPD) string.
+    // The halfmove and fullmove counters are optional. Returns false if the string is malformed,
+    // in which case the board is left unchanged.
+    bool loadFEN(const string& fen);
+    string toFEN() const;
+
     vector<string> moveLog;
 
 private:
@@ -44,15 +114,50 @@ private:
     bool blackRookMoved[2] = { false, false };
 
     pair<int, int> enPassantTarget = { -1, -1 };
+    int halfmoveClock = 0;
+    int fullmoveNumber = 1;
+
+    uint64_t hashKey = 0;
+    uint64_t pawnHashKey = 0;
+    Nnue::Accumulator accumulator;
+    int castlingRights() const;
+    void pieceAdded(char symbol, int row, int col);
+    void pieceRemoved(char symbol, int row, int col);
+    void refreshIncrementalState();
+
+    // Hashes of every position since the game (or FEN) started, for repetition detection.
+    vector<uint64_t> keyHistory;
+    bool hasInsufficientMaterial() const;
+    bool findLegalMoves(bool white, vector<tuple<int, int, int, int>>* moves);
+    bool hasAnyLegalMove(bool white);
+
+    // Legal move and status cache for the position with hash 'moveCacheKey'.
+    bool moveCacheValid = false;
+    uint64_t moveCacheKey = 0;
+    vector<tuple<int, int, int, int>> cachedMoves;
+    GameStatus cachedStatus = GameStatus::Ongoing;
+    void refreshMoveCache();
 
     struct Move {
         int fromRow, fromCol;
         int toRow, toCol;
         Piece* movedPiece;
         Piece* capturedPiece;
+        int captureRow, captureCol;   // Where the captured piece stood; differs for en passant.
+        bool promoted;                // promote replaced the moved pawn.
         bool wasWhiteTurn;
         pair<int, int> prevEnPassant;
+        int prevHalfmoveClock;
+        int prevFullmoveNumber;
+        bool prevKingMoved[2];        // White, Black.
+        bool prevWhiteRookMoved[2];
+        bool prevBlackRookMoved[2];
+        uint64_t prevHash;
+        uint64_t prevPawnHash;
     };
 
+    // Captured pieces, and pawns replaced by a promotion, are owned here until their move is
+    // undone or the history is cleared.
     stack<Move> moveHistory;
+    void clearHistory();
 };
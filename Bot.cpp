@@ -1,142 +1,661 @@
 #include "Bot.hpp"
 #include "Board.hpp"
 #include "Piece.hpp"
+#include "Nnue.hpp"
+#include "EvalParams.hpp"
+#include "AnalysisCache.hpp"
+#include "MovePicker.hpp"
+#include "OpeningIndex.hpp"
+#include "Trace.hpp"
 #include <limits>
 #include <tuple>
 #include <vector>
 #include <algorithm>
 #include <random>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 
 using namespace std;
 
+namespace {
+    const int INF = 1000000;
+    const int MAX_DEPTH = 64;
+
+    // Pawn hash table: pawn structure changes rarely during a search, so its score is cached
+    // by the pawn-only Zobrist key. Each thread has its own table, so concurrent searches
+    // never contend. An all-zero entry is correct for the pawnless key 0.
+    struct PawnEntry {
+        uint64_t key = 0;
+        int score = 0;
+    };
+    const size_t PAWN_TABLE_SIZE = 1 << 14;
+    thread_local vector<PawnEntry> pawnTable;
+    thread_local long long pawnProbes = 0, pawnHits = 0;
+
+    bool hasPawn(uint64_t pawns, int row, int col) {
+        return row >= 0 && row < 8 && col >= 0 && col < 8 && (pawns >> (row * 8 + col) & 1);
+    }
+
+    // Counts doubled, isolated, backward and passed pawns into 'counts', White's minus Black's.
+    // 'pawns[0]' holds White's pawns and 'pawns[1]' Black's, as bitboards indexed by row * 8 + col.
+    void countPawnStructure(const uint64_t pawns[2], int counts[EVAL_TERMS]) {
+        for (int side = 0; side < 2; ++side) {
+            uint64_t own = pawns[side], enemy = pawns[1 - side];
+            int dir = side == 0 ? -1 : 1;   // White pawns move towards row 0.
+            int sign = side == 0 ? 1 : -1;
+
+            int fileCount[8] = {};
+            for (int sq = 0; sq < 64; ++sq)
+                if (own >> sq & 1) ++fileCount[sq % 8];
+            for (int f = 0; f < 8; ++f)
+                if (fileCount[f] > 1) counts[DOUBLED_PAWN] += sign * (fileCount[f] - 1);
+
+            for (int sq = 0; sq < 64; ++sq) {
+                if (!(own >> sq & 1))
+                    continue;
+                int row = sq / 8, col = sq % 8;
+                bool isolated = (col == 0 || !fileCount[col - 1]) && (col == 7 || !fileCount[col + 1]);
+                if (isolated)
+                    counts[ISOLATED_PAWN] += sign;
+
+                // Passed: no enemy pawn ahead on this or an adjacent file.
+                bool passed = true;
+                for (int r = row + dir; r >= 0 && r < 8 && passed; r += dir)
+                    for (int c = col - 1; c <= col + 1; ++c)
+                        if (hasPawn(enemy, r, c)) passed = false;
+                if (passed) {
+                    int advanced = side == 0 ? 7 - row : row;
+                    counts[PASSED_PAWN + advanced] += sign;
+                    continue;
+                }
+
+                // Backward: no friendly pawn level with or behind it on an adjacent file,
+                // and its stop square is covered by an enemy pawn.
+                if (isolated)
+                    continue;
+                bool supported = false;
+                for (int r = row; r >= 0 && r < 8 && !supported; r -= dir)
+                    supported = hasPawn(own, r, col - 1) || hasPawn(own, r, col + 1);
+                int stop = row + dir;
+                if (!supported && (hasPawn(enemy, stop + dir, col - 1) || hasPawn(enemy, stop + dir, col + 1)))
+                    counts[BACKWARD_PAWN] += sign;
+            }
+        }
+    }
+
+    int scorePawnStructure(const uint64_t pawns[2]) {
+        int counts[EVAL_TERMS] = {};
+        countPawnStructure(pawns, counts);
+        int score = 0;
+        for (int term = DOUBLED_PAWN; term < SHIELD_PAWN_NEAR; ++term)
+            score += EvalParams::weights[term] * counts[term];
+        return score;
+    }
+
+    int probePawnStructure(uint64_t key, const uint64_t pawns[2]) {
+        if (pawnTable.empty())
+            pawnTable.resize(PAWN_TABLE_SIZE);
+        PawnEntry& entry = pawnTable[key & (PAWN_TABLE_SIZE - 1)];
+        ++pawnProbes;
+        if (entry.key == key) {
+            ++pawnHits;
+            return entry.score;
+        }
+        entry.key = key;
+        entry.score = scorePawnStructure(pawns);
+        return entry.score;
+    }
+
+    // Counts the pawns in front of a king still on its first two ranks into 'counts', with
+    // 'sign' +1 for White and -1 for Black. Depends on the king square, so it is computed
+    // outside the pawn hash table.
+    void countPawnShield(uint64_t ownPawns, int kingRow, int kingCol, bool white, int counts[EVAL_TERMS]) {
+        int dir = white ? -1 : 1;
+        int sign = white ? 1 : -1;
+        int homeDistance = white ? 7 - kingRow : kingRow;
+        if (kingRow < 0 || homeDistance > 1)
+            return;
+        for (int c = kingCol - 1; c <= kingCol + 1; ++c) {
+            if (hasPawn(ownPawns, kingRow + dir, c))
+                counts[SHIELD_PAWN_NEAR] += sign;
+            else if (hasPawn(ownPawns, kingRow + 2 * dir, c))
+                counts[SHIELD_PAWN_FAR] += sign;
+        }
+    }
+
+    // What the evaluation needs from one pass over the board.
+    struct BoardScan {
+        uint64_t pawns[2] = { 0, 0 };
+        int kingRow[2] = { -1, -1 }, kingCol[2] = { -1, -1 };
+        int material[5] = {};   // White's minus Black's count of pawns, knights, bishops, rooks, queens.
+    };
+
+    BoardScan scanBoard(const Board& board) {
+        BoardScan scan;
+        for (int row = 0; row < 8; ++row) {
+            for (int col = 0; col < 8; ++col) {
+                Piece* piece = board.getPiece(row, col);
+                if (!piece)
+                    continue;
+                int side = piece->isWhite() ? 0 : 1;
+                int sign = side == 0 ? 1 : -1;
+                switch (toupper(piece->getSymbol())) {
+                    case 'P':
+                        scan.material[0] += sign;
+                        scan.pawns[side] |= 1ULL << (row * 8 + col);
+                        break;
+                    case 'N': scan.material[1] += sign; break;
+                    case 'B': scan.material[2] += sign; break;
+                    case 'R': scan.material[3] += sign; break;
+                    case 'Q': scan.material[4] += sign; break;
+                    case 'K':
+                        scan.kingRow[side] = row;
+                        scan.kingCol[side] = col;
+                        break;
+                    default: break;
+                }
+            }
+        }
+        return scan;
+    }
+
+    // Transposition-table scores are stored from White's point of view; searches score from
+    // the bot's side, which for Black negates the score and swaps the bound.
+    Bound flipBound(Bound bound) {
+        return bound == Bound::Lower ? Bound::Upper : bound == Bound::Upper ? Bound::Lower : bound;
+    }
+
+    // Mate scores count plies from the root, but a table entry may be reached at any ply, so
+    // they are stored as distances from the node itself.
+    int scoreToTable(int score, int ply) {
+        return score >= MATE_BOUND ? score + ply : score <= -MATE_BOUND ? score - ply : score;
+    }
+
+    int scoreFromTable(int score, int ply) {
+        return score >= MATE_BOUND ? score - ply : score <= -MATE_BOUND ? score + ply : score;
+    }
+
+    // Moves 'move' to the front of 'moves' if present, keeping the rest in order.
+    void moveToFront(vector<tuple<int, int, int, int>>& moves, const tuple<int, int, int, int>& move) {
+        auto it = find(moves.begin(), moves.end(), move);
+        if (it != moves.end())
+            rotate(moves.begin(), it, it + 1);
+    }
+}
+
+// Per-search state threaded through the recursion so concurrent searches never share anything.
+struct Bot::SearchContext {
+    SearchLimits limits;
+    chrono::steady_clock::time_point start;
+    SearchStats stats;
+    bool stopped = false;
+    uint64_t noiseSeed = 0;   // Picks this search's evaluation offsets when limits.evalNoise is set.
+
+    // Two quiet moves per ply that recently caused a cutoff, tried right after the captures.
+    tuple<int, int, int, int> killers[MAX_DEPTH + 1][2];
+
+    SearchContext() {
+        for (auto& slot : killers)
+            slot[0] = slot[1] = make_tuple(-1, -1, -1, -1);
+    }
+
+    void addKiller(int ply, const tuple<int, int, int, int>& move) {
+        if (ply > MAX_DEPTH || killers[ply][0] == move)
+            return;
+        killers[ply][1] = killers[ply][0];
+        killers[ply][0] = move;
+    }
+
+    double elapsedMs() const {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    }
+
+    // A fixed offset per position within +-limits.evalNoise, so a position keeps its score
+    // however often the search meets it.
+    int noise(uint64_t key) const {
+        uint64_t h = (key ^ noiseSeed) * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 31;
+        return static_cast<int>(h % (2 * limits.evalNoise + 1)) - limits.evalNoise;
+    }
+
+    // Checks the node and time budgets and the stop flag. The node count is compared at every
+    // node, which is one comparison; the clock and the flag are only read every 256 nodes.
+    bool shouldStop() {
+        if (limits.nodes > 0 && stats.nodes >= limits.nodes)
+            stopped = true;
+        else if ((stats.nodes & 255) == 0) {
+            if (limits.stop && limits.stop->load(memory_order_relaxed))
+                stopped = true;
+            else if (limits.movetimeMs > 0 && elapsedMs() >= limits.movetimeMs)
+                stopped = true;
+        }
+        return stopped;
+    }
+};
+
 //---------------------------------------------------------------------
 // Evaluation Function
 //---------------------------------------------------------------------
-// A simple material-based evaluation in centipawns. Positive values favor White; negative values favor Black.
+// Material plus pawn structure and king pawn shields, in centipawns, or the NNUE network
+// when one has been loaded. Positive values favor White; negative values favor Black.
+// Each term is an EvalParams weight times a feature count, the same counts
+// evaluationFeatures reports to the tuner.
 int Bot::evaluate(Board& board) {
-    int score = 0;
-    for (int row = 0; row < 8; ++row) {
-        for (int col = 0; col < 8; ++col) {
-            Piece* piece = board.getPiece(row, col);
-            if (!piece)
-                continue;
-            int pieceValue = 0;
-            switch (toupper(piece->getSymbol())) {
-                case 'P': pieceValue = 100; break;
-                case 'N': 
-                case 'B': pieceValue = 300; break;
-                case 'R': pieceValue = 500; break;
-                case 'Q': pieceValue = 900; break;
-                case 'K': pieceValue = 20000; break;
-                default: break;
-            }
-            score += piece->isWhite() ? pieceValue : -pieceValue;
-        }
+    if (Nnue::isLoaded()) {
+        int eval = Nnue::evaluate(board.getAccumulator(), board.isWhiteTurn());
+        return board.isWhiteTurn() ? eval : -eval;
     }
+
+    const int* weights = EvalParams::weights;
+    BoardScan scan = scanBoard(board);
+    int score = 0;
+    for (int i = 0; i < 5; ++i)
+        score += weights[PAWN_VALUE + i] * scan.material[i];
+    score += probePawnStructure(board.getPawnHash(), scan.pawns);
+
+    int shield[EVAL_TERMS] = {};
+    countPawnShield(scan.pawns[0], scan.kingRow[0], scan.kingCol[0], true, shield);
+    countPawnShield(scan.pawns[1], scan.kingRow[1], scan.kingCol[1], false, shield);
+    score += weights[SHIELD_PAWN_NEAR] * shield[SHIELD_PAWN_NEAR] + weights[SHIELD_PAWN_FAR] * shield[SHIELD_PAWN_FAR];
     return score;
 }
 
+void Bot::evaluationFeatures(const Board& board, int features[EVAL_TERMS]) {
+    fill(features, features + EVAL_TERMS, 0);
+    BoardScan scan = scanBoard(board);
+    for (int i = 0; i < 5; ++i)
+        features[PAWN_VALUE + i] = scan.material[i];
+    countPawnStructure(scan.pawns, features);
+    countPawnShield(scan.pawns[0], scan.kingRow[0], scan.kingCol[0], true, features);
+    countPawnShield(scan.pawns[1], scan.kingRow[1], scan.kingCol[1], false, features);
+}
+
 //---------------------------------------------------------------------
 // Generate All Legal Moves
 //---------------------------------------------------------------------
 // Returns all legal moves for the given side (true for white, false for black).
 // Each move is represented as a tuple (fromRow, fromCol, toRow, toCol).
+// Moves for the side to move come from the board's per-position cache.
 vector<tuple<int, int, int, int>> Bot::getAllLegalMoves(Board& board, bool white) {
-    vector<tuple<int, int, int, int>> moves;
-    for (int r = 0; r < 8; ++r) {
-        for (int c = 0; c < 8; ++c) {
-            Piece* p = board.getPiece(r, c);
-            if (p && p->isWhite() == white) {
-                auto candidateMoves = p->getLegalMoves(r, c, board);
-                for (auto& m : candidateMoves) {
-                    Board temp = board;
-                    temp.movePiece(r, c, m.first, m.second);
-                    if (!temp.isInCheck(white))
-                        moves.emplace_back(r, c, m.first, m.second);
-                }
-            }
-        }
-    }
-    return moves;
+    if (white == board.isWhiteTurn())
+        return board.legalMoves();
+    return board.generateLegalMoves(white);
+}
+
+//---------------------------------------------------------------------
+// Apply a Move
+//---------------------------------------------------------------------
+// Board::movePiece leaves promotion to the caller (the UI asks the player); Board::makeMove
+// promotes to a queen, as the bot always does.
+void Bot::applyMove(Board& board, const tuple<int, int, int, int>& move) {
+    board.makeMove(move);
 }
 
 //---------------------------------------------------------------------
 // Alpha-Beta Pruning with Minimax
 //---------------------------------------------------------------------
 // Recursive minimax search enhanced with alpha-beta pruning.
-// 'depth' is the remaining depth to search.
+// 'depth' is the remaining depth to search and 'ply' the distance from the root.
 // 'alpha' and 'beta' are the current bounds for pruning.
 // 'maximizingPlayer' indicates whether this node is maximizing or minimizing.
-// 'isWhiteBot' indicates the bot's side.
-int Bot::alphabeta(Board& board, int depth, int alpha, int beta, bool maximizingPlayer, bool isWhiteBot) {
-    if (depth == 0 || board.isCheckmate(true) || board.isCheckmate(false) ||
-        board.isStalemate(true) || board.isStalemate(false))
-    {
-        return evaluate(board);
+// 'isWhiteBot' indicates the bot's side; scores are from the bot's point of view.
+// Once the node or time budget runs out the search unwinds returning 0, and the
+// caller discards the unfinished iteration.
+// With a transposition table, a stored result deep enough to decide this node is returned
+// directly, and otherwise its best move is searched first.
+// A node without legal moves is mate (scored by distance from the root, so nearer mates are
+// preferred) or stalemate; this falls out of the node's own move generation. Leaves go to the
+// quiescence search, which does not look for mates, so a mate is seen one ply after the mating move.
+// Captures that lose material by static exchange are searched last and one ply shallower; one
+// that still raises the bound is searched again at full depth.
+int Bot::alphabeta(Board& board, int depth, int ply, int alpha, int beta, bool maximizingPlayer, bool isWhiteBot,
+                   SearchContext& ctx) {
+    if (depth == 0)
+        return quiescence(board, ply, alpha, beta, maximizingPlayer, isWhiteBot, ctx);
+
+    ++ctx.stats.nodes;
+    if (ctx.stopped || ctx.shouldStop())
+        return 0;
+
+    // Near the root the on-disk cache may hold a deeper result than this search will reach.
+    TranspositionTable* tt = ctx.limits.tt;
+    bool useCache = ctx.limits.useAnalysisCache && ply <= AnalysisCache::PROBE_PLIES && AnalysisCache::isOpen();
+    tuple<int, int, int, int> hashMove = { -1, -1, -1, -1 };
+    TranspositionTable::Entry entry;
+    bool found = false;
+    if (useCache && AnalysisCache::probe(board.getHash(), entry) && entry.depth >= depth)
+        found = true;
+    else if (tt) {
+        ++ctx.stats.ttProbes;
+        found = tt->probe(board.getHash(), entry);
+        if (found)
+            ++ctx.stats.ttHits;
+    }
+    if (found) {
+        hashMove = entry.move;
+        int score = scoreFromTable(isWhiteBot ? entry.score : -entry.score, ply);
+        Bound bound = isWhiteBot ? entry.bound : flipBound(entry.bound);
+        if (entry.depth >= depth && (bound == Bound::Exact || (bound == Bound::Lower && score >= beta) ||
+                                     (bound == Bound::Upper && score <= alpha)))
+            return score;
     }
     
-    bool currentColor = maximizingPlayer ? isWhiteBot : !isWhiteBot;
-    auto moves = getAllLegalMoves(board, currentColor);
-
-    // If no legal moves exist, return evaluation.
-    if (moves.empty())
-        return evaluate(board);
-
-    if (maximizingPlayer) {
-        int value = numeric_limits<int>::min();
-        for (auto& move : moves) {
-            Board temp = board;
-            temp.movePiece(get<0>(move), get<1>(move), get<2>(move), get<3>(move));
-            int score = alphabeta(temp, depth - 1, alpha, beta, false, isWhiteBot);
-            value = max(value, score);
+    // Moves come from a staged picker, so a node that cuts off early skips generating and
+    // legality-testing most of its moves. No legal move at all means mate or stalemate.
+    // The picker plays each move on this board; it is taken back as soon as it is searched.
+    MovePicker picker(board, hashMove, ctx.killers[min(ply, MAX_DEPTH)]);
+    tuple<int, int, int, int> move, bestMove = { -1, -1, -1, -1 };
+    int alphaOrig = alpha, betaOrig = beta;
+    int value = maximizingPlayer ? numeric_limits<int>::min() : numeric_limits<int>::max();
+    int searched = 0;
+    while (picker.next(move)) {
+        bool reduced = picker.isBadCapture() && depth >= 3 && searched > 0;
+        int score = alphabeta(board, depth - (reduced ? 2 : 1), ply + 1, alpha, beta, !maximizingPlayer,
+                              isWhiteBot, ctx);
+        if (reduced && !ctx.stopped && (maximizingPlayer ? score > alpha : score < beta))
+            score = alphabeta(board, depth - 1, ply + 1, alpha, beta, !maximizingPlayer, isWhiteBot, ctx);
+        board.undoMove();
+        if (ctx.stopped)
+            return 0;
+        ++searched;
+        if (maximizingPlayer ? score > value : score < value) {
+            value = score;
+            bestMove = move;
+        }
+        if (maximizingPlayer)
             alpha = max(alpha, value);
-            if (alpha >= beta)
-                break; // Beta cutoff.
+        else
+            beta = min(beta, value);
+        if (alpha >= beta) {
+            ++ctx.stats.betaCutoffs;
+            if (searched == 1) ++ctx.stats.firstMoveCutoffs;
+            if (!board.isTactical(move))
+                ctx.addKiller(ply, move);
+            break; // Beta cutoff (alpha cutoff at minimizing nodes).
         }
+    }
+
+    if (searched == 0) {
+        bool currentColor = maximizingPlayer ? isWhiteBot : !isWhiteBot;
+        int matedScore = maximizingPlayer ? -(MATE_SCORE - ply) : MATE_SCORE - ply;
+        return board.isInCheck(currentColor) ? matedScore : 0;
+    }
+
+    if (tt || useCache) {
+        Bound bound = value <= alphaOrig ? Bound::Upper : value >= betaOrig ? Bound::Lower : Bound::Exact;
+        int stored = scoreToTable(value, ply);
+        if (!isWhiteBot) {
+            stored = -stored;
+            bound = flipBound(bound);
+        }
+        if (tt)
+            tt->store(board.getHash(), stored, depth, bound, bestMove);
+        if (useCache)
+            AnalysisCache::store(board.getHash(), stored, depth, bound, bestMove);
+    }
+    return value;
+}
+
+//---------------------------------------------------------------------
+// Quiescence Search
+//---------------------------------------------------------------------
+// The side to move may "stand pat" on the static evaluation instead of capturing, so the
+// score is bounded by it from one side; then each capture or promotion that does not lose
+// material by static exchange is tried. Losing captures are pruned outright: they almost
+// never rescue a position, and searching them is most of the cost of a quiescence search.
+int Bot::quiescence(Board& board, int ply, int alpha, int beta, bool maximizingPlayer, bool isWhiteBot,
+                    SearchContext& ctx) {
+    ++ctx.stats.nodes;
+    ++ctx.stats.qnodes;
+    if (ctx.stopped || ctx.shouldStop())
+        return 0;
+
+    int eval = evaluate(board);
+    int value = isWhiteBot ? eval : -eval;
+    if (ctx.limits.evalNoise > 0)
+        value += ctx.noise(board.getHash());
+    if (maximizingPlayer ? value >= beta : value <= alpha)
         return value;
-    } else {
-        int value = numeric_limits<int>::max();
-        for (auto& move : moves) {
-            Board temp = board;
-            temp.movePiece(get<0>(move), get<1>(move), get<2>(move), get<3>(move));
-            int score = alphabeta(temp, depth - 1, alpha, beta, true, isWhiteBot);
-            value = min(value, score);
+    if (maximizingPlayer)
+        alpha = max(alpha, value);
+    else
+        beta = min(beta, value);
+
+    MovePicker picker(board);
+    tuple<int, int, int, int> move;
+    int searched = 0;
+    while (picker.next(move)) {
+        int score = quiescence(board, ply + 1, alpha, beta, !maximizingPlayer, isWhiteBot, ctx);
+        board.undoMove();
+        if (ctx.stopped)
+            return 0;
+        ++searched;
+        if (maximizingPlayer ? score > value : score < value)
+            value = score;
+        if (maximizingPlayer)
+            alpha = max(alpha, value);
+        else
             beta = min(beta, value);
-            if (beta <= alpha)
-                break; // Alpha cutoff.
+        if (alpha >= beta) {
+            ++ctx.stats.betaCutoffs;
+            if (searched == 1) ++ctx.stats.firstMoveCutoffs;
+            break;
         }
-        return value;
     }
+    return value;
 }
 
 //---------------------------------------------------------------------
-// Make Move Using Minimax with Alpha-Beta Pruning
+// Iterative Deepening Search
 //---------------------------------------------------------------------
-// Iterates through all legal moves and uses the alphabeta function to determine
-// the best move. The depth parameter is set from the main program and increases
-// with difficulty.
-void Bot::makeMove(Board& board, int depth, bool isWhiteBot) {
-    auto moves = getAllLegalMoves(board, isWhiteBot);
-    if (moves.empty())
-        return;
+// Searches depth 1, 2, ... until a limit is hit. Each completed iteration is recorded in
+// the result; an iteration interrupted by the node or time budget is thrown away and the
+// best move of the last completed one is kept. The previous best move is searched first
+// so the root alpha bound tightens as early as possible. The search also ends once it has
+// proved a mate for either side.
+SearchResult Bot::search(Board& board, const SearchLimits& limits) {
+    SearchContext ctx;
+    ctx.limits = limits;
+    ctx.start = chrono::steady_clock::now();
+    if (limits.evalNoise > 0) {
+        // Noisy scores must not outlive the search.
+        random_device rd;
+        ctx.noiseSeed = (static_cast<uint64_t>(rd()) << 32) | rd();
+        ctx.limits.useAnalysisCache = false;
+    }
+    long long pawnProbesBefore = pawnProbes, pawnHitsBefore = pawnHits;
+
+    SearchResult result;
+    bool white = board.isWhiteTurn();
+    auto moves = getAllLegalMoves(board, white);
+    if (moves.empty()) {
+        result.stats.elapsedMs = ctx.elapsedMs();
+        return result;
+    }
 
     // Shuffle moves to add variety when moves evaluate equally.
-    random_device rd;
-    mt19937 g(rd());
-    shuffle(moves.begin(), moves.end(), g);
-
-    int bestScore = numeric_limits<int>::min();
-    tuple<int, int, int, int> bestMove = moves[0];
-
-    for (auto& move : moves) {
-        Board temp = board;
-        temp.movePiece(get<0>(move), get<1>(move), get<2>(move), get<3>(move));
-        int score = alphabeta(temp, depth - 1, numeric_limits<int>::min(), numeric_limits<int>::max(), false, isWhiteBot);
-        if (score > bestScore) {
-            bestScore = score;
-            bestMove = move;
+    if (limits.randomize) {
+        random_device rd;
+        mt19937 g(rd());
+        shuffle(moves.begin(), moves.end(), g);
+    }
+
+    // A move remembered from an earlier search of this position is tried first.
+    TranspositionTable::Entry rootEntry;
+    if (limits.tt && limits.tt->probe(board.getHash(), rootEntry) && get<0>(rootEntry.move) >= 0)
+        moveToFront(moves, rootEntry.move);
+
+    result.hasMove = true;
+    result.bestMove = moves[0];
+
+    int maxDepth = limits.depth > 0 ? limits.depth : MAX_DEPTH;
+    if (!limits.infinite && limits.depth <= 0 && limits.nodes <= 0 && limits.movetimeMs <= 0)
+        maxDepth = 1;
+    size_t multiPv = min(moves.size(), static_cast<size_t>(max(1, limits.multiPv)));
+
+    // An exact result from the on-disk cache counts as an iteration already completed, so a
+    // recurring position answers at once and spare time goes into searching deeper.
+    bool useCache = ctx.limits.useAnalysisCache && AnalysisCache::isOpen();
+    int firstDepth = 1;
+    TranspositionTable::Entry cached;
+    if (useCache && AnalysisCache::probe(board.getHash(), cached) && cached.bound == Bound::Exact &&
+        find(moves.begin(), moves.end(), cached.move) != moves.end()) {
+        moveToFront(moves, cached.move);
+        result.bestMove = cached.move;
+        result.score = white ? cached.score : -cached.score;
+        result.depth = cached.depth;
+        firstDepth = cached.depth + 1;
+        if (abs(result.score) >= MATE_BOUND && MATE_SCORE - abs(result.score) <= cached.depth)
+            firstDepth = maxDepth + 1;
+
+        SearchIteration iteration = {};
+        iteration.depth = result.depth;
+        iteration.score = result.score;
+        iteration.bestMove = cached.move;
+        iteration.elapsedMs = ctx.elapsedMs();
+        ctx.stats.iterations.push_back(iteration);
+        if (limits.onIteration) {
+            ctx.stats.elapsedMs = iteration.elapsedMs;
+            limits.onIteration(iteration, ctx.stats);
         }
     }
-    board.movePiece(get<0>(bestMove), get<1>(bestMove), get<2>(bestMove), get<3>(bestMove));
+
+    for (int depth = firstDepth; depth <= maxDepth; ++depth) {
+        CHESS_TRACE_ARG("search", "iteration", "depth", depth);
+        long long nodesBefore = ctx.stats.nodes;
+        double msBefore = ctx.elapsedMs();
+        int alpha = -INF;
+        int bestScore = -INF;
+        size_t bestIndex = 0;
+        vector<int> scores(moves.size(), -INF);
+
+        for (size_t i = 0; i < moves.size(); ++i) {
+            // The move's squares as digits: 6444 is (6,4) to (4,4), e2e4 for White.
+            CHESS_TRACE_ARG("search", "root move", "move", get<0>(moves[i]) * 1000 + get<1>(moves[i]) * 100 +
+                                                           get<2>(moves[i]) * 10 + get<3>(moves[i]));
+            applyMove(board, moves[i]);
+            int score = alphabeta(board, depth - 1, 1, alpha, INF, false, white, ctx);
+            board.undoMove();
+            if (ctx.stopped)
+                break;
+            scores[i] = score;
+            if (score > bestScore) {
+                bestScore = score;
+                bestIndex = i;
+            }
+            if (multiPv == 1) {
+                alpha = max(alpha, bestScore);
+            } else if (i + 1 >= multiPv) {
+                // Only moves that beat the multiPv-th best so far need exact scores.
+                vector<int> best(scores.begin(), scores.begin() + i + 1);
+                nth_element(best.begin(), best.begin() + (multiPv - 1), best.end(), greater<int>());
+                alpha = best[multiPv - 1];
+            }
+        }
+        if (ctx.stopped)
+            break;
+
+        vector<pair<tuple<int, int, int, int>, int>> lines;
+        if (multiPv > 1) {
+            // Best first, so the next iteration also searches the other lines early.
+            vector<size_t> order(moves.size());
+            for (size_t i = 0; i < order.size(); ++i)
+                order[i] = i;
+            stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return scores[a] > scores[b]; });
+            vector<tuple<int, int, int, int>> sorted;
+            for (size_t i : order)
+                sorted.push_back(moves[i]);
+            moves = sorted;
+            for (size_t i = 0; i < multiPv; ++i)
+                lines.emplace_back(moves[i], scores[order[i]]);
+            bestIndex = 0;
+        }
+        rotate(moves.begin(), moves.begin() + bestIndex, moves.begin() + bestIndex + 1);
+        result.bestMove = moves[0];
+        result.score = bestScore;
+        result.depth = depth;
+        if (limits.tt)
+            limits.tt->store(board.getHash(), white ? bestScore : -bestScore, depth, Bound::Exact, moves[0]);
+        if (useCache)
+            AnalysisCache::store(board.getHash(), white ? bestScore : -bestScore, depth, Bound::Exact, moves[0]);
+
+        SearchIteration iteration;
+        iteration.depth = depth;
+        iteration.score = bestScore;
+        iteration.bestMove = moves[0];
+        iteration.nodes = ctx.stats.nodes;
+        iteration.iterationNodes = ctx.stats.nodes - nodesBefore;
+        iteration.elapsedMs = ctx.elapsedMs();
+        iteration.iterationMs = iteration.elapsedMs - msBefore;
+        const auto& previous = ctx.stats.iterations;
+        iteration.branchingFactor = previous.empty() || previous.back().iterationNodes == 0 ? 0.0
+            : double(iteration.iterationNodes) / previous.back().iterationNodes;
+        iteration.lines = move(lines);
+        ctx.stats.iterations.push_back(iteration);
+        if (limits.onIteration) {
+            ctx.stats.elapsedMs = iteration.elapsedMs;
+            ctx.stats.pawnHashProbes = pawnProbes - pawnProbesBefore;
+            ctx.stats.pawnHashHits = pawnHits - pawnHitsBefore;
+            limits.onIteration(iteration, ctx.stats);
+        }
+
+        // A mate within the searched depth is exact; deeper iterations cannot change it.
+        if (abs(bestScore) >= MATE_BOUND && MATE_SCORE - abs(bestScore) <= depth)
+            break;
+    }
+
+    ctx.stats.elapsedMs = ctx.elapsedMs();
+    ctx.stats.pawnHashProbes = pawnProbes - pawnProbesBefore;
+    ctx.stats.pawnHashHits = pawnHits - pawnHitsBefore;
+    result.stats = ctx.stats;
+    return result;
 }
 
+//---------------------------------------------------------------------
+// Make Move Using Minimax with Alpha-Beta Pruning
+//---------------------------------------------------------------------
+// Searches within the level's node and time budgets and plays the best move found. The
+// level is chosen in the main program.
+// While the position is in an open opening index, a move from the index is played instead
+// without searching: a random one of those played at least a tenth as often as the most
+// popular, weighted by how often each was played.
+SearchStats Bot::makeMove(Board& board, const SkillLevel& level, bool isWhiteBot,
+                          tuple<int, int, int, int>* played) {
+    if (board.isWhiteTurn() != isWhiteBot)
+        return SearchStats();
+
+    vector<OpeningIndex::MoveStats> bookMoves = OpeningIndex::lookup(board);
+    if (!bookMoves.empty()) {
+        uint32_t cutoff = bookMoves.front().games() / 10;
+        vector<uint32_t> weights;
+        for (auto& stats : bookMoves)
+            weights.push_back(stats.games() >= cutoff ? stats.games() : 0);
+        random_device rd;
+        mt19937 g(rd());
+        discrete_distribution<size_t> pick(weights.begin(), weights.end());
+        const tuple<int, int, int, int>& move = bookMoves[pick(g)].move;
+        applyMove(board, move);
+        if (played)
+            *played = move;
+        return SearchStats();
+    }
+
+    // One table serves every move of the game, so each search starts from what the last one
+    // learned about the positions that follow; only one move is ever searched at a time.
+    static TranspositionTable table(16);
+    table.newSearch();
+    SearchLimits limits;
+    limits.nodes = level.nodes;
+    limits.movetimeMs = level.movetimeMs;
+    limits.evalNoise = level.evalNoise;
+    limits.randomize = true;
+    limits.tt = &table;
+    SearchResult result = search(board, limits);
+    if (result.hasMove) {
+        applyMove(board, result.bestMove);
+        if (played)
+            *played = result.bestMove;
+    }
+    return result.stats;
+}
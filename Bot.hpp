@@ -1,28 +1,149 @@
 #pragma once
 #include "Board.hpp"
+#include "EvalParams.hpp"
+#include "TranspositionTable.hpp"
+#include <atomic>
+#include <functional>
 #include <tuple>
 #include <vector>
 using namespace std;
 
+struct SearchIteration;
+struct SearchStats;
+
+// Scores beyond MATE_BOUND in either direction are forced mates: MATE_SCORE - |score| is the
+// number of plies until the mate, so shorter mates score higher.
+const int MATE_SCORE = 900000;
+const int MATE_BOUND = MATE_SCORE - 1000;
+
+// Full moves until mate for a mate score: positive when the side the score belongs to mates,
+// negative when it gets mated, 0 for ordinary scores.
+inline int mateInMoves(int score) {
+    if (score >= MATE_BOUND)
+        return (MATE_SCORE - score + 1) / 2;
+    if (score <= -MATE_BOUND)
+        return -(MATE_SCORE + score + 1) / 2;
+    return 0;
+}
+
+// Limits for a single search. Any combination may be set; a zero field means "no limit".
+// With no limits at all the search stops after depth 1.
+struct SearchLimits {
+    int depth = 0;            // Maximum iterative-deepening depth.
+    long long nodes = 0;      // Stop once this many nodes have been searched.
+    int movetimeMs = 0;       // Stop once this much wall-clock time has elapsed.
+    bool randomize = false;   // Shuffle root moves so equal moves are picked at random.
+    TranspositionTable* tt = nullptr;     // Table to probe and fill; may be shared between threads.
+    const atomic<bool>* stop = nullptr;   // Set from another thread to end the search early.
+    bool useAnalysisCache = true;         // Consult and fill the on-disk AnalysisCache when one is open.
+    int evalNoise = 0;        // Offsets every static evaluation by up to this many centipawns either way.
+    bool infinite = false;    // Keep deepening until stopped or a mate is proven, even with no other limit.
+    int multiPv = 1;          // Root moves given exact scores each iteration (SearchIteration::lines).
+
+    // Called after every completed iteration, e.g. to print progress.
+    function<void(const SearchIteration&, const SearchStats&)> onIteration;
+};
+
+// One completed iteration of iterative deepening.
+struct SearchIteration {
+    int depth;
+    int score;
+    tuple<int, int, int, int> bestMove;
+    long long nodes;            // Total nodes searched when the iteration finished.
+    long long iterationNodes;   // Nodes searched by this iteration alone.
+    double elapsedMs;           // Time since the search started when the iteration finished.
+    double iterationMs;         // Time spent on this iteration alone.
+    double branchingFactor;     // iterationNodes relative to the previous iteration; 0 for the first.
+    // With SearchLimits::multiPv above 1: the best root moves and their scores, best first.
+    vector<pair<tuple<int, int, int, int>, int>> lines;
+};
+
+// Counters filled in by every search.
+struct SearchStats {
+    long long nodes = 0;              // All nodes, including quiescence nodes.
+    long long qnodes = 0;             // Quiescence nodes.
+    long long betaCutoffs = 0;        // Nodes that failed high (or low at minimizing nodes) and stopped early.
+    long long firstMoveCutoffs = 0;   // Cutoffs produced by the first move searched.
+    long long ttProbes = 0;           // Transposition-table lookups (zero without a table).
+    long long ttHits = 0;             // Lookups that found the position.
+    long long pawnHashProbes = 0;     // Pawn-structure lookups made by the evaluation.
+    long long pawnHashHits = 0;
+    double elapsedMs = 0;
+    vector<SearchIteration> iterations;
+
+    double nps() const { return elapsedMs > 0 ? nodes * 1000.0 / elapsedMs : 0.0; }
+    double firstMoveCutoffRate() const { return betaCutoffs ? double(firstMoveCutoffs) / betaCutoffs : 0.0; }
+    double ttHitRate() const { return ttProbes ? double(ttHits) / ttProbes : 0.0; }
+    double pawnHashHitRate() const { return pawnHashProbes ? double(pawnHashHits) / pawnHashProbes : 0.0; }
+};
+
+// Outcome of Bot::search. 'score' is in centipawns from the point of view of the side to move.
+struct SearchResult {
+    bool hasMove = false;
+    tuple<int, int, int, int> bestMove = { -1, -1, -1, -1 };
+    int score = 0;
+    int depth = 0;
+    SearchStats stats;
+};
+
+// A playing strength for the game window. The node budget fixes how much work a move may take
+// on any machine, the time cap bounds the latency on slow ones, and the noise makes weaker
+// levels misjudge positions by a controlled amount rather than by searching shallower.
+struct SkillLevel {
+    const char* name;
+    long long nodes;    // Node budget per move.
+    int movetimeMs;     // Thinking time cap per move.
+    int evalNoise;      // See SearchLimits::evalNoise; 0 plays the best move found.
+};
+
+const SkillLevel SKILL_LEVELS[] = {
+    { "Easy", 4000, 100, 80 },
+    { "Medium", 40000, 500, 20 },
+    { "Hard", 400000, 2000, 0 },
+};
+
 class Bot {
 public:
-    // Makes the best move on the board using a minimax search with alpha-beta pruning.
-    // 'depth' controls the search depth and should increase with difficulty.
+    // Makes the best move on the board using a minimax search with alpha-beta pruning,
+    // within the node and time budget of 'level'.
     // 'isWhiteBot' indicates whether the bot is playing as white.
-    static void makeMove(Board& board, int depth, bool isWhiteBot);
+    // Returns the statistics of the search that chose the move; 'played', when given, receives
+    // the move made and is left alone if there was none. Searches share one transposition
+    // table, so calls must not overlap.
+    static SearchStats makeMove(Board& board, const SkillLevel& level, bool isWhiteBot,
+                                tuple<int, int, int, int>* played = nullptr);
 
-private:
-    // Evaluates the board: returns a score in centipawns, where positive favors White and negative favors Black.
-    static int evaluate(Board& board);
+    // Searches the position for the side to move without playing the move.
+    // Uses iterative deepening so node and time limits always leave a usable best move.
+    static SearchResult search(Board& board, const SearchLimits& limits);
+
+    // Plays a move from getAllLegalMoves, promoting to a queen when a pawn reaches the last rank.
+    static void applyMove(Board& board, const tuple<int, int, int, int>& move);
 
     // Returns all legal moves for the given side (true for white, false for black).
     // Each move is represented as a tuple: (fromRow, fromCol, toRow, toCol).
     static vector<tuple<int, int, int, int>> getAllLegalMoves(Board& board, bool white);
 
+    // Counts of every evaluation term for the position, White's minus Black's. Without a
+    // network the evaluation is the dot product of these counts with EvalParams::weights.
+    static void evaluationFeatures(const Board& board, int features[EVAL_TERMS]);
+
+private:
+    struct SearchContext;
+
+    // Evaluates the board: returns a score in centipawns, where positive favors White and negative favors Black.
+    static int evaluate(Board& board);
+
     // A recursive minimax search using alpha-beta pruning.
-    // 'depth' is the remaining search depth.
+    // 'depth' is the remaining search depth and 'ply' the distance from the root.
     // 'alpha' and 'beta' are the bounds for pruning.
     // 'maximizingPlayer' indicates if the current node is maximizing.
     // 'isWhiteBot' indicates the bot's color.
-    static int alphabeta(Board& board, int depth, int alpha, int beta, bool maximizingPlayer, bool isWhiteBot);
+    static int alphabeta(Board& board, int depth, int ply, int alpha, int beta, bool maximizingPlayer,
+                         bool isWhiteBot, SearchContext& ctx);
+
+    // Searches captures and promotions only until the position is quiet, so leaves are not
+    // evaluated in the middle of an exchange. Arguments as for alphabeta.
+    static int quiescence(Board& board, int ply, int alpha, int beta, bool maximizingPlayer, bool isWhiteBot,
+                          SearchContext& ctx);
 };
@@ -0,0 +1,433 @@
+#include "Commands.hpp"
+#include "Bench.hpp"
+#include "Bot.hpp"
+#include "Nnue.hpp"
+#include "AnalysisCache.hpp"
+#include "Epd.hpp"
+#include "EvalParams.hpp"
+#include "MateSolver.hpp"
+#include "Notation.hpp"
+#include "OpeningIndex.hpp"
+#include "SelfPlay.hpp"
+#include "Server.hpp"
+#include "Trace.hpp"
+#include "Tuner.hpp"
+#include "Uci.hpp"
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+namespace {
+    void printUsage() {
+        cerr << "Usage:\n"
+             << "  ChessGame [--theme DIR]        start the graphical game (DIR: font.ttf, pieces.png)\n"
+             << "  ChessGame --nnue FILE ...      evaluate with a neural network (game or any mode)\n"
+             << "  ChessGame --cache FILE [--cache-size MB] ...\n"
+             << "                                 keep deep search results in a shared on-disk cache\n"
+             << "  ChessGame epd <file> [--depth N] [--nodes N] [--movetime MS] [--csv FILE]\n"
+             << "                                 run an EPD test suite (bm/am operations)\n"
+             << "  ChessGame uci                  speak the UCI protocol on stdin/stdout\n"
+             << "  ChessGame bench [--depth N]    search built-in positions; prints nodes and NPS\n"
+             << "  ChessGame selfplay [--games N] [--concurrency N] [--tc SECONDS+INC] [--openings FILE]\n"
+             << "                     [--pgn FILE] [--sprt ELO0,ELO1] [--alpha A] [--beta B] [--max-plies N]\n"
+             << "                     [--a-depth N] [--a-nodes N] [--a-movetime MS] [--b-... likewise]\n"
+             << "                                 play two bot configurations against each other\n"
+             << "  ChessGame server [--port N] [--host ADDR] [--unix PATH] [--threads N] [--hash MB]\n"
+             << "                   [--movetime MS] [--max-sessions N] [--max-plies N]\n"
+             << "                                 host many games over a local socket\n"
+             << "  ChessGame --eval FILE ...      use evaluation weights written by the tuner\n"
+             << "  ChessGame --book FILE ...      let the bot play opening moves from an index\n"
+             << "  ChessGame --trace FILE ...     record a Chrome trace timeline (builds with -DCHESS_TRACING)\n"
+             << "  ChessGame book build OUT PGN... [--plies N] [--threads N] [--memory MB] [--temp DIR]\n"
+             << "                                 index the openings of PGN databases\n"
+             << "  ChessGame book probe INDEX [FEN]\n"
+             << "                                 list the indexed moves of a position\n"
+             << "  ChessGame mate FEN [--moves N] [--nodes N] [--movetime MS] [--hash MB]\n"
+             << "                                 prove a forced mate for the side to move\n"
+             << "  ChessGame tune DATA [--epochs N] [--lr X] [--threads N] [--limit N] [--out FILE]\n"
+             << "                                 fit the evaluation weights to labelled positions\n";
+    }
+
+    // Parses the "--flag value" options shared by the search commands into 'limits'.
+    // Unknown flags are returned in 'extra' for the command to interpret.
+    bool parseSearchOptions(const vector<string>& args, size_t first, SearchLimits& limits,
+                            vector<pair<string, string>>& extra) {
+        for (size_t i = first; i < args.size(); i += 2) {
+            if (i + 1 >= args.size() || args[i].rfind("--", 0) != 0) {
+                cerr << "Bad option: " << args[i] << endl;
+                return false;
+            }
+            const string& flag = args[i];
+            const string& value = args[i + 1];
+            try {
+                if (flag == "--depth") limits.depth = stoi(value);
+                else if (flag == "--nodes") limits.nodes = stoll(value);
+                else if (flag == "--movetime") limits.movetimeMs = stoi(value);
+                else extra.emplace_back(flag, value);
+            } catch (const exception&) {
+                cerr << "Bad value for " << flag << ": " << value << endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int runEpd(const vector<string>& args) {
+        if (args.size() < 2) {
+            printUsage();
+            return 1;
+        }
+        SearchLimits limits;
+        vector<pair<string, string>> extra;
+        if (!parseSearchOptions(args, 2, limits, extra))
+            return 1;
+        string csvPath;
+        for (auto& option : extra) {
+            if (option.first == "--csv") {
+                csvPath = option.second;
+            } else {
+                cerr << "Unknown option: " << option.first << endl;
+                return 1;
+            }
+        }
+        if (limits.depth <= 0 && limits.nodes <= 0 && limits.movetimeMs <= 0)
+            limits.movetimeMs = 1000;
+        limits.useAnalysisCache = false;   // Solve times must come from the search itself.
+
+        vector<EpdPosition> positions;
+        if (!loadEpdFile(args[1], positions)) {
+            cerr << "Could not open EPD file: " << args[1] << endl;
+            return 1;
+        }
+        runEpdSuite(positions, limits, csvPath, cout);
+        return 0;
+    }
+
+    int runBenchCommand(const vector<string>& args) {
+        int depth = 3;
+        if (args.size() == 3 && args[1] == "--depth") {
+            try {
+                depth = stoi(args[2]);
+            } catch (const exception&) {
+                depth = 0;
+            }
+        } else if (args.size() != 1) {
+            printUsage();
+            return 1;
+        }
+        if (depth <= 0) {
+            cerr << "Bad value for --depth: " << args[2] << endl;
+            return 1;
+        }
+        runBench(depth, cout);
+        return 0;
+    }
+
+    int runSelfPlay(const vector<string>& args) {
+        TournamentOptions options;
+        options.engines[0].name = "A";
+        options.engines[1].name = "B";
+        for (size_t i = 1; i < args.size(); i += 2) {
+            if (i + 1 >= args.size()) {
+                cerr << "Missing value for " << args[i] << endl;
+                return 1;
+            }
+            const string& flag = args[i];
+            const string& value = args[i + 1];
+            try {
+                if (flag.rfind("--a-", 0) == 0 || flag.rfind("--b-", 0) == 0) {
+                    EngineConfig& engine = options.engines[flag[2] == 'a' ? 0 : 1];
+                    string option = flag.substr(4);
+                    if (option == "depth") engine.limits.depth = stoi(value);
+                    else if (option == "nodes") engine.limits.nodes = stoll(value);
+                    else if (option == "movetime") engine.limits.movetimeMs = stoi(value);
+                    else if (option == "name") engine.name = value;
+                    else throw invalid_argument(flag);
+                } else if (flag == "--games") {
+                    options.games = stoi(value);
+                } else if (flag == "--concurrency") {
+                    options.concurrency = static_cast<unsigned>(stoi(value));
+                } else if (flag == "--tc") {
+                    size_t plus = value.find('+');
+                    options.timeControl.baseMs = static_cast<int>(stod(value.substr(0, plus)) * 1000);
+                    if (plus != string::npos)
+                        options.timeControl.incrementMs = static_cast<int>(stod(value.substr(plus + 1)) * 1000);
+                } else if (flag == "--openings") {
+                    options.openingsPath = value;
+                } else if (flag == "--pgn") {
+                    options.pgnPath = value;
+                } else if (flag == "--max-plies") {
+                    options.maxPlies = stoi(value);
+                } else if (flag == "--sprt") {
+                    size_t comma = value.find(',');
+                    options.sprt = true;
+                    options.elo0 = stod(value.substr(0, comma));
+                    options.elo1 = stod(value.substr(comma + 1));
+                } else if (flag == "--alpha") {
+                    options.alpha = stod(value);
+                } else if (flag == "--beta") {
+                    options.beta = stod(value);
+                } else {
+                    throw invalid_argument(flag);
+                }
+            } catch (const exception&) {
+                cerr << "Bad option: " << flag << " " << value << endl;
+                return 1;
+            }
+        }
+        for (auto& engine : options.engines)
+            if (engine.limits.depth <= 0 && engine.limits.nodes <= 0 && engine.limits.movetimeMs <= 0 &&
+                options.timeControl.baseMs <= 0)
+                engine.limits.depth = 3;
+
+        runTournament(options, cout);
+        return 0;
+    }
+
+    int runServerCommand(const vector<string>& args) {
+        ServerOptions options;
+        for (size_t i = 1; i < args.size(); i += 2) {
+            if (i + 1 >= args.size()) {
+                cerr << "Missing value for " << args[i] << endl;
+                return 1;
+            }
+            const string& flag = args[i];
+            const string& value = args[i + 1];
+            try {
+                if (flag == "--port") options.port = stoi(value);
+                else if (flag == "--host") options.host = value;
+                else if (flag == "--unix") options.socketPath = value;
+                else if (flag == "--threads") options.threads = static_cast<unsigned>(stoi(value));
+                else if (flag == "--hash") options.hashMb = static_cast<size_t>(stoul(value));
+                else if (flag == "--movetime") options.movetimeMs = stoi(value);
+                else if (flag == "--max-sessions") options.maxSessions = static_cast<size_t>(stoul(value));
+                else if (flag == "--max-plies") options.maxPlies = stoi(value);
+                else throw invalid_argument(flag);
+            } catch (const exception&) {
+                cerr << "Bad option: " << flag << " " << value << endl;
+                return 1;
+            }
+        }
+        options.maxMovetimeMs = max(options.maxMovetimeMs, options.movetimeMs);
+        return runServer(options, cout) ? 0 : 1;
+    }
+
+    int runBookBuild(const vector<string>& args) {
+        OpeningIndex::BuildOptions options;
+        vector<string> pgnPaths;
+        for (size_t i = 3; i < args.size(); ++i) {
+            if (args[i].rfind("--", 0) != 0) {
+                pgnPaths.push_back(args[i]);
+                continue;
+            }
+            if (i + 1 >= args.size()) {
+                cerr << "Missing value for " << args[i] << endl;
+                return 1;
+            }
+            const string& flag = args[i];
+            const string& value = args[++i];
+            try {
+                if (flag == "--plies") options.maxPlies = stoi(value);
+                else if (flag == "--threads") options.threads = static_cast<unsigned>(stoi(value));
+                else if (flag == "--memory") options.memoryMb = static_cast<size_t>(stoul(value));
+                else if (flag == "--temp") options.tempDir = value;
+                else throw invalid_argument(flag);
+            } catch (const exception&) {
+                cerr << "Bad option: " << flag << " " << value << endl;
+                return 1;
+            }
+        }
+        if (pgnPaths.empty()) {
+            printUsage();
+            return 1;
+        }
+        return OpeningIndex::build(pgnPaths, args[2], options, cout) ? 0 : 1;
+    }
+
+    int runBookProbe(const vector<string>& args) {
+        if (args.size() > 4) {
+            printUsage();
+            return 1;
+        }
+        if (!OpeningIndex::open(args[2]))
+            return 1;
+        Board board;
+        if (args.size() == 4 && !board.loadFEN(args[3])) {
+            cerr << "Bad FEN: " << args[3] << endl;
+            return 1;
+        }
+        auto moves = OpeningIndex::lookup(board);
+        if (moves.empty())
+            cout << "Position not in the index" << endl;
+        for (auto& stats : moves) {
+            cout << left << setw(8) << toSAN(board, stats.move) << right << setw(10) << stats.games() << " games  "
+                 << fixed << setprecision(1) << 100.0 * stats.score(board.isWhiteTurn()) << "%  (+"
+                 << stats.whiteWins << " =" << stats.draws << " -" << stats.blackWins << ")" << endl;
+        }
+        return 0;
+    }
+
+    int runTune(const vector<string>& args) {
+        if (args.size() < 2 || args[1].rfind("--", 0) == 0) {
+            printUsage();
+            return 1;
+        }
+        TunerOptions options;
+        options.dataPath = args[1];
+        for (size_t i = 2; i < args.size(); i += 2) {
+            if (i + 1 >= args.size()) {
+                cerr << "Missing value for " << args[i] << endl;
+                return 1;
+            }
+            const string& flag = args[i];
+            const string& value = args[i + 1];
+            try {
+                if (flag == "--epochs") options.epochs = stoi(value);
+                else if (flag == "--lr") options.learningRate = stod(value);
+                else if (flag == "--threads") options.threads = static_cast<unsigned>(stoi(value));
+                else if (flag == "--limit") options.maxPositions = static_cast<size_t>(stoull(value));
+                else if (flag == "--out") options.outPath = value;
+                else throw invalid_argument(flag);
+            } catch (const exception&) {
+                cerr << "Bad option: " << flag << " " << value << endl;
+                return 1;
+            }
+        }
+        return runTuner(options, cout) ? 0 : 1;
+    }
+
+    int runMate(const vector<string>& args) {
+        if (args.size() < 2 || args[1].rfind("--", 0) == 0) {
+            printUsage();
+            return 1;
+        }
+        Board board;
+        if (!board.loadFEN(args[1])) {
+            cerr << "Bad FEN: " << args[1] << endl;
+            return 1;
+        }
+        MateLimits limits;
+        size_t hashMb = 64;
+        for (size_t i = 2; i < args.size(); i += 2) {
+            if (i + 1 >= args.size()) {
+                cerr << "Missing value for " << args[i] << endl;
+                return 1;
+            }
+            const string& flag = args[i];
+            const string& value = args[i + 1];
+            try {
+                if (flag == "--moves") limits.maxMoves = stoi(value);
+                else if (flag == "--nodes") limits.nodes = stoll(value);
+                else if (flag == "--movetime") limits.movetimeMs = stoi(value);
+                else if (flag == "--hash") hashMb = static_cast<size_t>(stoul(value));
+                else throw invalid_argument(flag);
+            } catch (const exception&) {
+                cerr << "Bad option: " << flag << " " << value << endl;
+                return 1;
+            }
+        }
+        if (limits.maxMoves < 0 || limits.maxMoves > MateSolver::MAX_MATE_MOVES) {
+            cerr << "--moves must be between 1 and " << MateSolver::MAX_MATE_MOVES << ", or 0 for the longest ("
+                 << MateSolver::MAX_MATE_MOVES << ")" << endl;
+            return 1;
+        }
+
+        MateSolver solver(hashMb);
+        MateResult result = solver.solve(board, limits);
+        int maxMoves = limits.maxMoves > 0 ? limits.maxMoves : MateSolver::MAX_MATE_MOVES;
+        if (result.status == MateStatus::Mate) {
+            Board replay = board;
+            string line;
+            for (auto& move : result.line) {
+                line += (line.empty() ? "" : " ") + toSAN(replay, move);
+                Bot::applyMove(replay, move);
+            }
+            cout << "Mate in " << result.mateIn << ": " << line << endl;
+        } else if (result.status == MateStatus::NoMate) {
+            cout << "No mate within " << maxMoves << " moves" << endl;
+        } else {
+            cout << "Unknown: limit reached before a proof" << endl;
+        }
+        double seconds = result.elapsedMs / 1000.0;
+        cout << "Nodes: " << result.nodes << "  Time: " << fixed << setprecision(3) << seconds << " s  NPS: "
+             << static_cast<long long>(seconds > 0 ? result.nodes / seconds : 0) << endl;
+        return 0;
+    }
+
+    int runBook(const vector<string>& args) {
+        if (args.size() >= 3 && args[1] == "build")
+            return runBookBuild(args);
+        if (args.size() >= 3 && args[1] == "probe")
+            return runBookProbe(args);
+        printUsage();
+        return 1;
+    }
+}
+
+bool applyGlobalOptions(vector<string>& args) {
+    string cachePath;
+    size_t cacheMb = 64;
+    while (!args.empty() && (args[0] == "--nnue" || args[0] == "--cache" || args[0] == "--cache-size" ||
+                             args[0] == "--book" || args[0] == "--eval" || args[0] == "--trace")) {
+        if (args.size() < 2) {
+            cerr << "Missing value for " << args[0] << endl;
+            return false;
+        }
+        if (args[0] == "--nnue") {
+            if (!Nnue::load(args[1]))
+                return false;
+        } else if (args[0] == "--cache") {
+            cachePath = args[1];
+        } else if (args[0] == "--eval") {
+            if (!EvalParams::load(args[1]))
+                return false;
+        } else if (args[0] == "--trace") {
+            if (!Trace::start(args[1]))
+                return false;
+        } else if (args[0] == "--book") {
+            if (!OpeningIndex::open(args[1]))
+                return false;
+        } else {
+            try {
+                cacheMb = static_cast<size_t>(stoul(args[1]));
+            } catch (const exception&) {
+                cerr << "Bad value for --cache-size: " << args[1] << endl;
+                return false;
+            }
+        }
+        args.erase(args.begin(), args.begin() + 2);
+    }
+    if (!cachePath.empty() && !AnalysisCache::open(cachePath, cacheMb))
+        return false;
+    return true;
+}
+
+int runCommand(const vector<string>& args) {
+    if (args.empty()) {
+        printUsage();
+        return 1;
+    }
+    if (args[0] == "epd")
+        return runEpd(args);
+    if (args[0] == "selfplay")
+        return runSelfPlay(args);
+    if (args[0] == "bench")
+        return runBenchCommand(args);
+    if (args[0] == "server")
+        return runServerCommand(args);
+    if (args[0] == "book")
+        return runBook(args);
+    if (args[0] == "tune")
+        return runTune(args);
+    if (args[0] == "mate")
+        return runMate(args);
+    if (args[0] == "uci") {
+        runUci(cin, cout);
+        return 0;
+    }
+
+    printUsage();
+    return 1;
+}
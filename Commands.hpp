@@ -0,0 +1,13 @@
+#pragma once
+#include <string>
+#include <vector>
+using namespace std;
+
+// Consumes options that apply to the game window and every headless mode alike
+// ("--nnue FILE", "--cache FILE", "--cache-size MB", "--book FILE", "--eval FILE",
+// "--trace FILE") from the front of 'args'. Returns false on a bad option.
+bool applyGlobalOptions(vector<string>& args);
+
+// Headless command-line modes, e.g. "ChessGame epd suite.epd --movetime 1000".
+// 'args' excludes the program name. Returns the process exit code.
+int runCommand(const vector<string>& args);
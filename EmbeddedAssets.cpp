@@ -0,0 +1,4831 @@
+// Generated by embed_assets.py from assets/; do not edit. Rerun the script after changing the assets.
+#include "EmbeddedAssets.hpp"
+
+const unsigned char EmbeddedAssets::font[] = {
+0,1,0,0,0,22,1,0,0,4,0,96,68,83,73,71,33,122,22,15,0,2,38,176,0,0,29,180,71,68,69,70,0,38,4,11,0,2,68,100,0,0,
+0,30,71,80,79,83,240,203,165,87,0,2,68,132,0,0,50,234,71,83,85,66,85,63,3,201,0,2,119,112,0,0,22,240,76,84,83,
+72,156,9,129,169,0,0,18,96,0,0,4,10,79,83,47,50,231,14,158,191,0,0,1,232,0,0,0,96,99,109,97,112,79,14,6,106,0,
+0,119,52,0,0,6,68,99,118,116,32,99,78,106,113,0,0,135,12,0,0,1,192,102,112,103,109,98,209,101,194,0,0,125,120,
+0,0,6,164,103,97,115,112,0,24,0,33,0,2,38,160,0,0,0,16,103,108,121,102,2,192,39,125,0,0,144,220,0,1,119,100,
+104,100,109,120,25,1,184,67,0,0,22,108,0,0,96,200,104,101,97,100,230,132,39,64,0,0,1,108,0,0,0,54,104,104,101,
+97,20,196,13,200,0,0,1,164,0,0,0,36,104,109,116,120,69,8,94,252,0,0,2,72,0,0,16,24,107,101,114,110,102,250,
+111,211,0,2,8,64,0,0,11,178,108,111,99,97,124,64,33,69,0,0,136,204,0,0,8,14,109,97,120,112,7,9,8,42,0,0,1,200,
+0,0,0,32,109,101,116,97,26,165,146,81,0,2,142,96,0,0,0,72,110,97,109,101,241,47,199,35,0,2,19,244,0,0,18,137,
+112,111,115,116,255,3,0,123,0,2,38,128,0,0,0,32,112,114,101,112,237,118,136,148,0,0,132,28,0,0,2,240,0,1,0,0,
+0,5,58,225,222,156,210,66,95,15,60,245,0,27,8,0,0,0,0,0,165,81,192,244,0,0,0,0,214,12,224,52,254,115,253,140,
+13,128,8,171,0,0,0,11,0,1,0,0,0,0,0,0,0,1,0,0,8,206,253,134,0,0,13,199,254,115,254,116,13,128,0,1,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,4,6,0,1,0,0,4,6,0,242,0,60,0,98,0,5,0,2,0,16,0,47,0,93,0,0,2,81,6,164,0,3,0,1,0,3,4,107,3,132,
+0,5,0,8,5,154,5,51,0,0,0,130,5,154,5,51,0,0,1,183,0,102,2,18,8,5,2,11,10,4,2,1,2,2,2,4,160,0,2,175,64,0,120,
+251,0,0,0,0,0,0,0,0,84,77,67,32,0,64,0,32,251,2,5,186,254,78,1,35,8,206,2,122,96,0,0,159,223,215,0,0,4,38,5,
+186,0,0,0,32,0,2,6,0,0,0,0,0,0,0,2,171,0,0,2,171,0,0,2,170,0,124,4,0,0,48,5,72,0,60,5,86,0,54,8,0,0,99,7,29,0,
+153,2,57,0,85,3,29,0,112,3,29,0,80,4,115,0,177,5,72,0,127,2,170,0,124,2,170,0,45,2,170,0,124,2,57,0,1,5,86,0,
+84,5,86,0,167,5,86,0,54,5,86,0,72,5,86,0,42,5,86,0,67,5,86,0,86,5,86,0,91,5,86,0,84,5,86,0,71,2,170,0,124,2,
+170,0,124,5,72,0,107,5,72,0,126,5,72,0,108,4,227,0,73,5,236,255,250,6,57,0,2,6,57,0,151,6,57,0,97,6,57,0,156,
+5,199,0,149,5,86,0,152,6,170,0,94,6,170,0,152,3,29,0,168,5,86,0,35,6,170,0,152,5,86,0,150,7,141,0,145,6,170,0,
+153,6,170,0,93,5,199,0,148,6,170,0,93,6,57,0,156,5,199,0,71,5,199,0,47,6,170,0,151,6,57,0,5,8,0,255,255,6,57,
+0,3,6,57,0,2,5,199,0,34,3,29,0,135,2,57,255,250,3,29,0,47,5,72,0,125,4,0,255,244,2,170,0,1,5,86,0,73,5,86,0,
+125,5,86,0,74,5,86,0,72,5,86,0,72,3,29,0,16,5,86,0,73,5,86,0,123,2,170,0,138,2,170,255,156,5,86,0,123,2,170,0,
+137,8,0,0,126,5,86,0,123,5,86,0,73,5,86,0,125,5,86,0,72,3,141,0,127,4,227,0,51,3,141,0,56,5,86,0,119,4,227,0,
+2,7,141,0,3,5,86,0,11,4,227,0,5,4,115,0,37,3,29,0,26,2,57,0,160,3,29,0,23,5,72,0,99,6,57,0,2,6,57,0,2,6,57,0,
+97,5,199,0,149,6,170,0,153,6,170,0,93,6,170,0,151,5,86,0,73,5,86,0,73,5,86,0,73,5,86,0,73,5,86,0,73,5,86,0,73,
+5,86,0,74,5,86,0,72,5,86,0,72,5,86,0,72,5,86,0,72,2,170,0,138,2,170,0,1,2,170,255,228,2,170,255,254,5,86,0,
+123,5,86,0,73,5,86,0,73,5,86,0,73,5,86,0,73,5,86,0,73,5,86,0,119,5,86,0,119,5,86,0,119,5,86,0,119,5,86,0,141,
+3,51,0,119,5,86,0,74,5,86,0,113,5,86,0,65,4,0,0,180,6,205,0,135,5,86,0,119,6,102,0,58,6,102,0,58,7,154,0,36,2,
+170,0,163,2,170,255,254,5,72,0,98,8,0,255,180,6,170,0,35,4,171,0,19,5,72,0,127,5,72,0,98,5,72,0,105,5,86,255,
+254,5,86,0,120,4,0,0,85,5,180,0,43,6,149,0,46,5,128,0,51,2,43,255,253,3,51,0,33,3,51,0,23,6,213,0,144,8,0,0,
+69,5,86,0,73,4,227,0,73,2,170,0,124,5,72,0,126,4,100,0,84,5,86,0,37,5,72,0,99,4,229,0,26,5,86,0,95,5,86,0,121,
+8,0,0,124,2,171,0,0,6,57,0,2,6,57,0,2,6,170,0,93,8,0,0,71,8,0,0,59,4,0,255,244,8,0,255,244,4,0,0,55,4,0,0,55,
+2,57,0,70,2,57,0,70,5,72,0,127,3,244,0,47,4,227,0,5,6,57,0,2,1,86,254,115,5,86,0,18,2,170,0,23,2,170,0,28,5,
+86,0,20,5,86,0,20,5,86,0,141,2,170,0,124,2,57,0,70,4,0,0,55,8,0,0,0,6,57,0,2,5,199,0,149,6,57,0,2,5,199,0,149,
+5,199,0,149,3,29,0,168,3,29,0,30,3,29,0,56,3,29,0,59,6,170,0,93,6,170,0,93,6,85,0,0,6,170,0,93,6,170,0,151,6,
+170,0,151,6,170,0,151,2,170,0,138,2,170,255,228,2,170,255,236,2,170,0,18,2,170,0,0,2,171,0,184,2,170,0,100,2,
+170,0,18,2,170,0,46,2,170,0,152,2,170,255,228,5,86,255,255,2,170,0,0,5,199,0,71,4,227,0,51,5,199,0,34,4,115,0,
+37,2,57,0,160,6,57,0,2,5,86,0,75,6,57,0,2,4,227,0,5,5,199,0,148,5,86,0,125,5,72,0,127,5,72,0,125,3,51,0,141,3,
+51,0,22,3,51,0,31,8,0,0,157,8,0,0,157,8,0,0,70,6,171,0,155,6,170,0,94,5,86,0,73,3,29,0,168,5,199,0,71,4,227,0,
+51,6,57,0,97,5,86,0,74,6,57,0,97,5,86,0,74,5,86,0,72,4,0,255,244,2,171,0,124,3,43,0,41,6,57,0,2,5,86,0,73,6,
+57,0,2,5,86,0,73,6,57,0,156,6,192,0,72,6,57,0,2,5,199,0,149,5,86,0,72,5,199,0,149,5,86,0,72,8,57,0,172,5,88,0,
+137,5,86,0,150,2,170,0,137,5,86,0,150,4,0,0,137,5,86,0,150,4,70,0,137,6,170,0,153,5,86,0,123,6,170,0,153,5,86,
+0,123,6,221,0,53,6,170,0,93,5,86,0,73,6,57,0,156,3,141,0,127,6,57,0,156,3,141,0,127,5,199,0,71,4,227,0,51,5,
+199,0,47,3,141,0,56,5,199,0,47,5,0,0,56,6,170,0,151,5,86,0,119,6,170,0,151,5,86,0,119,5,199,0,34,4,115,0,37,5,
+199,0,34,4,115,0,37,2,171,0,0,2,171,0,0,2,171,0,0,2,171,0,0,2,171,0,0,2,171,0,0,2,171,0,0,2,171,0,0,2,171,0,0,
+4,0,255,244,2,111,0,125,4,49,0,119,4,213,0,125,3,125,0,70,13,199,0,148,8,0,0,98,4,177,1,7,8,0,0,79,4,0,0,153,
+8,0,0,79,4,0,0,153,8,0,0,79,4,0,0,152,4,0,0,152,7,213,1,106,5,192,0,192,4,205,0,127,4,213,0,146,2,214,0,131,2,
+214,0,131,4,213,0,178,2,214,0,112,2,170,0,206,6,57,0,2,5,86,0,73,6,57,0,97,5,86,0,74,6,57,0,97,5,86,0,74,5,
+199,0,149,5,86,0,72,5,199,0,149,5,86,0,72,5,199,0,149,5,86,0,72,6,170,0,94,5,86,0,73,6,170,0,94,5,86,0,73,6,
+170,0,94,5,86,0,73,6,170,0,152,5,86,0,123,6,170,0,18,5,86,0,20,3,29,0,44,2,170,255,248,3,29,0,78,2,170,0,18,3,
+29,0,60,2,170,0,0,3,29,0,172,2,170,0,137,5,86,0,35,2,170,255,156,6,170,0,152,5,86,0,123,5,86,0,123,5,86,0,150,
+2,170,0,18,6,170,0,153,5,86,0,123,6,131,0,152,5,115,0,152,6,170,0,93,5,86,0,73,6,170,0,93,5,86,0,73,6,57,0,
+156,3,141,0,127,5,199,0,71,4,227,0,51,5,199,0,53,3,141,0,53,6,170,0,151,5,86,0,119,6,170,0,151,5,86,0,119,6,
+170,0,151,5,86,0,119,6,170,0,152,5,86,0,119,8,0,255,255,7,141,0,3,6,57,0,2,4,227,0,5,3,31,0,119,6,57,0,2,5,86,
+0,73,8,0,255,180,8,0,0,69,6,170,0,35,5,86,0,73,1,133,0,6,2,170,255,254,6,57,0,2,4,0,0,184,6,197,0,6,7,168,0,6,
+4,2,0,6,7,23,0,6,7,193,0,6,7,37,0,6,3,29,255,254,6,57,0,2,6,57,0,151,5,86,0,150,6,57,255,254,5,199,0,149,5,
+199,0,34,6,170,0,152,6,170,0,94,3,29,0,168,6,170,0,152,6,57,0,2,7,141,0,145,6,170,0,153,5,199,0,121,6,170,0,
+93,6,170,0,152,5,199,0,148,5,199,0,152,5,199,0,47,6,57,0,2,7,100,0,74,6,57,0,3,7,145,0,82,6,170,0,94,3,29,0,
+56,6,57,0,2,5,109,0,78,4,98,0,74,5,86,0,123,2,170,0,138,5,86,0,119,5,109,0,78,5,39,0,119,4,227,255,254,5,86,0,
+74,4,98,0,74,3,174,0,78,5,86,0,123,5,86,0,84,2,170,0,138,5,86,0,123,4,227,255,252,5,86,0,119,4,227,0,2,3,174,
+0,78,5,86,0,73,5,168,0,20,5,86,0,125,4,57,0,78,5,252,0,74,4,16,0,20,5,86,0,119,7,27,0,72,5,47,0,14,7,84,0,119,
+7,145,0,72,2,170,255,254,5,86,0,119,5,86,0,73,5,86,0,119,7,145,0,72,5,199,0,149,8,8,0,53,5,86,0,150,6,94,0,94,
+5,199,0,71,3,29,0,168,3,29,0,56,5,86,0,35,9,174,0,2,9,174,0,152,7,207,0,53,5,215,0,150,5,96,0,12,6,170,0,152,
+6,57,0,2,6,57,0,152,6,57,0,151,5,86,0,150,6,180,0,23,5,199,0,149,8,176,255,252,5,129,0,59,6,170,0,151,6,170,0,
+151,5,215,0,150,6,111,0,2,7,141,0,145,6,170,0,152,6,170,0,93,6,170,0,152,5,199,0,148,6,57,0,97,5,199,0,47,5,
+96,0,12,7,100,0,74,6,57,0,3,6,225,0,152,6,111,0,135,8,225,0,152,9,27,0,152,8,4,0,51,8,168,0,152,6,49,0,152,6,
+94,0,63,9,68,0,152,6,61,0,4,5,86,0,73,5,86,0,74,4,236,0,123,4,16,0,137,5,76,0,14,5,86,0,72,7,100,0,8,5,109,0,
+76,5,166,0,137,5,166,0,137,5,35,0,123,5,186,0,27,6,197,0,137,5,180,0,137,5,86,0,73,5,86,0,119,5,86,0,125,5,86,
+0,74,4,16,0,20,4,227,0,5,8,27,0,76,5,86,0,11,5,133,0,117,5,76,0,115,7,152,0,117,7,178,0,117,6,43,0,8,7,70,0,
+137,4,248,0,137,5,86,0,63,7,205,0,137,4,254,0,2,5,86,0,72,5,104,0,20,3,141,0,127,5,86,0,74,4,227,0,51,2,170,0,
+138,2,170,255,254,2,170,255,156,8,23,0,27,8,47,0,137,5,104,0,20,5,35,0,123,4,227,0,5,5,86,0,119,4,113,0,150,3,
+190,0,137,8,0,255,255,7,141,0,3,8,0,255,255,7,141,0,3,8,0,255,255,7,141,0,3,6,57,0,2,4,227,0,5,6,0,255,244,2,
+57,0,70,4,0,255,244,5,86,0,104,10,195,0,152,4,205,0,90,8,0,0,157,8,0,0,79,8,0,0,95,8,0,0,132,4,205,0,153,5,72,
+0,126,4,205,2,30,4,205,1,1,5,174,255,235,4,246,1,196,5,174,2,128,5,174,255,235,5,174,2,128,5,174,255,235,5,
+174,2,128,5,174,255,235,5,174,255,235,5,174,255,235,5,174,255,235,5,174,255,235,5,174,1,194,5,174,2,128,5,174,
+1,194,5,174,1,194,5,174,255,235,5,174,255,235,5,174,255,235,5,174,2,128,5,174,1,194,5,174,1,194,5,174,255,235,
+5,174,255,235,5,174,255,235,5,174,2,128,5,174,1,194,5,174,1,194,5,174,255,235,5,174,255,235,5,174,255,235,5,
+174,255,235,5,174,255,235,5,174,255,235,5,174,255,235,5,174,255,235,5,174,255,235,5,174,255,235,5,174,255,235,
+5,174,255,235,5,174,255,235,5,174,255,235,5,174,255,235,5,174,255,235,5,174,2,215,5,174,0,104,5,171,0,0,5,215,
+0,0,4,205,0,142,8,0,0,0,7,235,1,48,7,235,1,32,7,235,1,48,7,235,1,32,4,205,0,174,4,205,0,124,4,205,0,38,8,41,1,
+151,8,102,1,182,7,92,0,19,4,102,0,87,5,92,0,106,4,61,0,57,5,72,0,59,4,184,0,59,4,21,0,63,6,41,0,25,8,0,1,48,2,
+170,0,18,3,51,0,35,3,51,0,80,3,51,0,29,5,72,0,98,5,199,0,71,4,227,0,51,5,199,0,47,3,141,0,56,2,170,0,138,5,34,
+0,80,4,17,0,70,5,86,0,49,5,64,0,62,5,106,0,49,5,72,0,62,5,112,0,92,5,23,0,64,5,70,0,77,5,116,0,92,5,86,0,84,4,
+89,0,79,5,96,0,54,5,100,0,76,5,136,0,60,5,91,0,65,5,80,0,85,5,17,0,59,5,86,0,84,5,80,0,69,6,63,0,83,6,170,0,
+93,6,161,0,152,9,165,0,152,6,161,0,142,3,156,0,70,6,130,0,152,6,170,0,93,5,86,0,72,2,170,0,138,5,86,0,123,3,
+12,0,120,5,93,0,72,2,232,0,16,5,86,0,120,5,86,0,89,5,86,0,88,3,156,0,70,3,12,0,120,2,170,0,138,5,36,0,0,5,130,
+0,148,5,47,0,90,5,119,0,148,4,227,0,148,4,166,0,148,5,193,0,90,5,220,0,148,2,202,0,148,4,174,0,26,5,212,0,148,
+4,178,0,148,6,179,0,148,5,220,0,148,5,152,0,90,5,5,0,148,5,152,0,90,5,111,0,148,4,248,0,66,4,182,0,25,5,208,0,
+142,5,36,0,0,6,222,255,255,5,58,0,2,5,62,255,252,4,202,0,34,6,219,255,191,7,89,0,90,4,178,0,36,5,152,0,51,5,5,
+0,148,5,119,0,36,5,134,0,140,5,36,0,0,5,36,0,0,5,36,0,0,5,36,0,0,5,36,0,0,5,36,0,0,5,47,0,90,4,227,0,148,4,
+227,0,148,4,227,0,148,4,227,0,148,2,202,255,254,2,202,0,148,2,202,255,243,2,202,0,14,5,220,0,148,5,152,0,90,5,
+152,0,90,5,152,0,90,5,152,0,90,5,152,0,90,5,208,0,142,5,208,0,142,5,208,0,142,5,208,0,142,5,62,255,252,5,36,0,
+0,5,36,0,0,5,36,0,0,5,47,0,90,5,47,0,90,5,193,0,90,5,119,0,148,5,119,0,36,4,227,0,148,4,227,0,148,4,227,0,148,
+4,227,0,148,4,227,0,148,5,193,0,90,5,193,0,90,5,47,0,90,5,220,0,148,5,220,0,36,2,202,255,252,2,202,0,34,2,202,
+0,15,2,202,0,148,2,202,0,148,7,20,0,148,4,174,0,26,5,212,0,148,4,178,0,148,4,178,0,148,4,178,0,148,4,178,0,
+148,5,220,0,148,5,220,0,148,5,220,0,148,5,197,0,148,5,152,0,90,5,152,0,90,5,152,0,90,5,111,0,148,5,111,0,148,
+5,111,0,148,4,248,0,66,4,248,0,66,4,248,0,66,4,248,0,66,4,182,0,25,4,182,0,25,4,182,0,25,4,182,0,25,5,208,0,
+142,5,208,0,142,5,208,0,142,5,208,0,142,5,208,0,142,5,208,0,142,6,222,255,255,6,222,255,255,6,222,255,255,6,
+222,255,255,5,62,255,252,5,62,255,252,5,62,255,252,4,202,0,34,4,202,0,34,4,202,0,34,5,36,0,0,6,219,255,191,5,
+152,0,51,5,36,0,0,5,130,0,148,4,153,0,148,5,36,0,0,4,227,0,148,4,202,0,34,5,220,0,148,5,236,0,90,2,202,0,148,
+5,212,0,148,5,36,0,0,6,179,0,148,5,220,0,148,4,160,0,84,5,152,0,90,5,220,0,148,5,5,0,148,5,36,0,94,4,182,0,25,
+5,62,255,252,6,122,0,82,5,58,0,2,6,237,0,132,5,152,0,70,5,36,0,0,4,227,0,148,5,220,0,148,2,202,0,148,5,152,0,
+90,5,62,255,252,5,152,0,70,2,202,0,14,5,62,255,252,4,227,0,148,6,117,0,25,4,153,0,148,5,47,0,90,4,248,0,66,2,
+202,0,148,2,202,0,14,4,174,0,26,7,239,0,2,7,252,0,148,6,135,0,25,5,61,0,148,5,11,0,10,5,220,0,148,5,36,0,0,5,
+69,0,148,5,130,0,148,4,153,0,148,5,200,0,25,4,227,0,148,7,136,0,8,4,181,0,64,5,220,0,148,5,220,0,148,5,61,0,
+148,5,136,0,2,6,179,0,148,5,220,0,148,5,152,0,90,5,220,0,148,5,5,0,148,5,47,0,90,4,182,0,25,5,11,0,10,6,122,0,
+82,5,58,0,2,6,8,0,148,5,145,0,115,7,194,0,148,7,238,0,148,6,39,0,25,7,141,0,148,5,49,0,148,5,47,0,74,7,160,0,
+148,5,111,0,0,4,75,0,148,3,51,0,42,3,51,0,141,3,51,0,22,3,51,0,31,3,51,0,44,3,51,0,35,3,51,0,42,3,51,0,80,3,
+51,0,29,3,51,0,43,3,51,0,42,3,51,0,43,3,51,0,42,6,63,0,83,6,63,0,83,6,63,0,83,6,63,0,83,6,63,0,83,6,63,0,83,6,
+63,0,83,6,63,0,83,6,63,0,83,6,63,0,83,6,63,0,83,6,170,0,93,6,170,0,93,6,170,0,93,6,170,0,93,6,170,0,93,6,170,
+0,93,6,170,0,93,6,170,0,93,6,170,0,93,6,170,0,93,6,170,0,93,6,161,0,152,6,161,0,152,6,161,0,152,6,161,0,152,6,
+161,0,142,6,161,0,142,6,161,0,142,6,161,0,142,6,161,0,142,6,161,0,142,6,161,0,142,6,161,0,142,6,161,0,142,3,
+156,0,70,3,156,0,70,3,156,0,70,3,156,0,70,3,156,0,70,3,156,0,70,3,156,0,70,3,156,0,70,3,156,0,70,4,225,0,6,3,
+156,0,70,3,156,0,70,3,156,0,70,3,12,0,120,3,12,0,108,3,195,0,120,3,192,0,120,3,28,0,0,3,156,0,70,3,156,0,70,3,
+156,0,70,3,156,0,70,3,156,0,70,3,156,0,70,3,156,0,70,3,156,0,70,6,130,0,152,5,86,0,72,5,86,0,72,5,86,0,72,5,
+86,0,72,5,86,0,72,5,86,0,72,5,86,0,72,5,86,0,72,5,86,0,72,2,170,255,228,5,86,0,123,3,12,0,120,3,12,0,108,3,
+195,0,120,3,192,0,120,3,28,0,0,2,232,0,16,2,232,0,16,4,30,0,16,2,232,0,16,5,86,0,120,5,86,0,120,5,86,0,120,5,
+86,0,120,5,135,0,72,4,248,0,66,5,47,0,90,5,193,0,90,5,199,0,47,5,86,0,122,5,86,0,14,5,200,0,10,7,30,0,50,5,
+134,0,52,6,100,0,80,0,0,4,6,1,1,1,1,11,1,1,1,1,1,1,1,1,1,1,11,1,11,1,1,1,1,1,1,1,1,1,1,1,11,11,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,11,11,1,11,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,11,11,11,11,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,11,1,1,1,1,1,1,1,1,1,1,1,11,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,14,33,1,11,1,1,1,1,1,1,1,1,26,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,18,13,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,11,1,11,1,11,1,11,1,11,1,1,1,1,11,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,255,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,11,1,1,1,19,1,1,1,1,1,11,1,1,1,1,1,
+1,18,1,1,26,13,1,13,20,13,22,11,1,1,1,22,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,10,1,1,1,1,1,1,1,1,1,1,1,1,1,11,1,1,1,1,1,1,1,1,1,22,1,22,22,1,13,13,1,1,13,1,1,1,1,1,11,
+11,11,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+11,1,1,1,1,1,1,1,1,1,34,1,24,1,24,48,1,1,46,1,1,17,22,1,18,1,42,1,22,1,1,1,1,45,1,1,1,1,42,1,11,22,1,28,31,28,
+38,1,44,1,48,36,24,41,44,6,1,6,1,34,46,1,22,1,14,1,1,1,44,24,6,1,31,22,22,22,22,22,22,22,28,28,28,28,28,1,1,1,
+1,44,6,6,6,6,6,1,1,1,1,1,22,22,22,28,28,1,31,31,28,28,28,28,28,1,1,28,44,44,1,1,1,1,1,1,48,36,24,24,24,24,44,
+44,44,1,6,6,6,1,1,1,34,34,34,34,46,46,46,46,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,22,1,6,22,1,21,22,28,1,44,1,1,36,
+22,41,44,1,6,44,1,22,46,1,1,14,42,6,22,28,44,1,6,1,6,1,1,28,14,21,28,34,1,1,48,1,1,1,1,24,44,22,1,1,21,1,28,1,
+1,44,44,1,48,41,44,6,44,1,28,46,24,1,14,1,1,1,1,1,10,48,28,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,17,17,17,17,17,17,
+17,17,17,17,17,22,22,22,22,22,22,22,22,22,22,22,1,1,1,1,1,1,1,1,1,1,1,1,1,42,42,42,42,42,42,42,42,42,1,42,42,
+42,1,1,1,1,28,42,42,42,42,42,42,42,42,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,28,1,1,35,1,1,1,1,1,1,34,28,1,46,1,1,1,
+1,22,1,0,0,0,0,0,24,0,0,4,8,11,19,8,0,4,4,4,6,7,7,11,10,3,4,4,6,7,4,4,4,3,7,7,7,7,7,7,7,7,7,7,4,4,7,7,7,7,8,9,
+9,9,9,8,7,9,9,4,7,9,7,10,9,9,8,9,9,8,8,9,9,11,9,9,8,4,3,4,7,6,4,7,7,7,7,7,4,7,7,4,4,7,4,11,7,7,7,7,5,7,5,7,7,
+10,7,7,6,4,3,4,7,9,9,9,8,9,9,9,7,7,7,7,7,7,7,7,7,7,7,4,4,4,4,7,7,7,7,7,7,7,7,7,7,7,4,7,7,7,6,9,7,9,9,10,4,4,7,
+11,9,6,7,7,7,7,7,6,8,9,8,3,4,4,9,11,7,7,4,7,6,7,7,7,7,7,11,4,9,9,9,11,11,6,11,6,6,3,3,7,5,7,9,2,7,4,4,7,7,7,4,
+3,6,11,9,8,9,8,8,4,4,4,4,9,9,9,9,9,9,9,4,4,4,4,4,4,4,4,4,4,4,7,4,8,7,8,6,3,9,7,9,7,8,7,7,7,4,4,4,11,11,11,9,9,
+7,4,8,7,9,7,9,7,7,6,4,4,9,7,9,7,9,9,9,8,7,8,7,11,8,7,4,7,6,7,6,9,7,9,7,9,9,7,9,5,9,5,8,7,8,5,8,7,9,7,9,7,8,6,
+8,6,4,4,4,4,4,4,4,4,4,6,3,6,7,6,19,11,6,11,6,11,6,11,6,6,11,8,7,7,4,4,7,4,4,9,7,9,7,9,7,8,7,8,7,8,7,9,7,9,7,9,
+7,9,7,9,7,4,4,4,4,4,4,4,4,7,4,9,7,7,7,4,9,7,9,8,9,7,9,7,9,5,8,7,8,5,9,7,9,7,9,7,9,7,11,10,9,7,4,9,7,11,11,9,7,
+2,4,9,6,9,11,6,10,11,10,4,9,9,7,9,8,8,9,9,4,9,9,10,9,8,9,9,8,8,8,9,10,9,10,9,4,9,7,6,7,4,7,7,7,7,7,6,5,7,7,4,
+7,7,7,7,5,7,8,7,6,7,6,7,10,7,10,10,4,7,7,7,10,8,11,7,9,8,4,4,7,13,13,11,8,7,9,9,9,9,7,9,8,12,8,9,9,8,9,10,9,9,
+9,8,9,8,7,10,9,9,9,12,13,11,12,9,9,13,9,7,7,7,6,7,7,10,7,8,8,7,8,9,8,7,7,7,7,6,7,11,7,8,7,10,11,8,10,7,7,11,7,
+7,7,5,7,7,4,4,4,11,11,7,7,7,7,6,5,11,10,11,10,11,10,9,7,8,3,6,7,15,7,11,11,11,11,7,7,7,7,8,7,8,8,8,8,8,8,8,8,
+8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,7,11,11,11,11,11,7,7,7,11,12,10,6,
+7,6,7,6,6,8,11,4,4,4,4,7,8,7,8,5,4,7,6,7,7,7,7,7,7,7,8,7,6,7,7,8,7,7,7,7,7,9,9,9,13,9,5,9,9,7,4,7,4,7,4,7,7,7,
+5,4,4,7,8,7,8,7,6,8,8,4,6,8,6,9,8,8,7,8,7,7,6,8,7,9,7,7,7,9,10,6,8,7,8,8,7,7,7,7,7,7,7,7,7,7,7,4,4,4,4,8,8,8,
+8,8,8,8,8,8,8,7,7,7,7,7,7,8,8,8,7,7,7,7,7,8,8,7,8,8,4,4,4,4,4,10,6,8,6,6,6,6,8,8,8,8,8,8,8,7,7,7,7,7,7,7,6,6,
+6,6,8,8,8,8,8,8,9,9,9,9,7,7,7,7,7,7,7,9,8,7,8,6,7,7,7,8,8,4,8,7,9,8,6,8,8,7,7,6,7,9,7,10,8,7,7,8,4,8,7,8,4,7,
+7,9,6,7,7,4,4,6,11,11,9,7,7,8,7,7,8,6,8,7,10,6,8,8,7,8,9,8,8,8,7,7,6,7,9,7,8,8,11,11,8,10,7,7,10,7,6,4,4,4,4,
+4,4,4,4,4,4,4,4,4,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,7,5,
+5,5,4,4,5,5,4,5,5,5,5,5,5,5,5,9,7,7,7,7,7,7,7,7,7,4,7,4,4,5,5,4,4,4,6,4,7,7,7,7,8,7,7,8,8,7,7,8,10,8,9,12,21,
+9,0,4,4,4,6,8,8,12,11,3,5,5,7,8,4,4,4,3,8,8,8,8,8,8,8,8,8,8,4,4,8,8,8,7,9,9,9,9,9,9,8,10,10,5,8,10,8,11,10,10,
+9,10,9,9,9,10,9,12,9,9,9,5,3,5,8,6,4,8,8,8,8,8,5,8,8,4,4,8,4,12,8,8,8,8,5,7,5,8,7,11,8,7,7,5,3,5,8,9,9,9,9,10,
+10,10,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,8,8,8,8,8,8,8,8,8,8,8,5,8,8,8,6,10,8,10,10,11,4,4,8,12,10,7,8,8,8,8,8,6,9,
+10,8,3,5,5,10,12,8,7,4,8,7,8,8,7,8,8,12,4,9,9,10,12,12,6,12,6,6,3,3,8,6,7,9,2,8,4,4,8,8,8,4,3,6,12,9,9,9,9,9,
+5,5,5,5,10,10,10,10,10,10,10,4,4,4,4,4,4,4,4,4,4,4,8,4,9,7,9,7,3,9,8,9,7,9,8,8,8,5,5,5,12,12,12,10,10,8,5,9,7,
+9,8,9,8,8,6,4,5,9,8,9,8,9,10,9,9,8,9,8,13,8,8,4,8,6,8,6,10,8,10,8,11,10,8,9,5,9,5,9,7,9,5,9,8,10,8,10,8,9,7,9,
+7,4,4,4,4,4,4,4,4,4,6,4,6,8,6,21,12,7,12,6,12,6,12,6,6,12,9,7,7,4,4,7,4,4,9,8,9,8,9,8,9,8,9,8,9,8,10,8,10,8,
+10,8,10,8,10,8,5,4,5,4,5,4,5,4,8,4,10,8,8,8,4,10,8,10,8,10,8,10,8,9,5,9,7,9,5,10,8,10,8,10,8,10,8,12,11,9,7,5,
+9,8,12,12,10,8,2,4,9,6,10,11,6,11,12,11,4,9,9,8,9,9,9,10,10,5,10,9,11,10,9,10,10,9,9,9,9,11,9,11,10,5,9,8,7,8,
+4,8,8,8,7,8,7,6,8,8,4,8,7,8,7,6,8,9,8,6,8,7,8,12,8,12,12,4,8,8,8,12,9,12,8,10,9,5,5,8,15,15,12,9,8,10,9,9,9,8,
+10,9,13,8,10,10,9,10,11,10,10,10,9,9,9,8,11,9,10,10,13,14,12,13,9,10,14,9,8,8,7,6,8,8,11,8,8,8,8,9,10,9,8,8,8,
+8,6,7,12,8,8,8,12,12,9,12,8,8,12,8,8,8,5,8,7,4,4,4,12,12,8,8,7,8,7,6,12,11,12,11,12,11,9,7,9,3,6,8,16,7,12,12,
+12,12,7,8,7,7,9,7,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+7,12,12,12,12,12,7,7,7,12,13,11,7,8,6,8,7,6,9,12,4,5,5,5,8,9,7,9,5,4,8,6,8,8,8,8,8,8,8,8,8,7,8,8,8,8,8,8,8,8,
+9,10,10,14,10,5,10,10,8,4,8,5,8,4,8,8,8,5,5,4,8,8,8,8,7,7,9,9,4,7,9,7,10,9,8,8,8,8,7,7,9,8,10,8,8,7,10,11,7,8,
+8,8,8,8,8,8,8,8,8,8,7,7,7,7,4,4,4,4,9,8,8,8,8,8,9,9,9,9,8,8,8,8,8,8,9,8,8,7,7,7,7,7,9,9,8,9,9,4,4,4,4,4,11,7,
+9,7,7,7,7,9,9,9,9,8,8,8,8,8,8,7,7,7,7,7,7,7,7,9,9,9,9,9,9,10,10,10,10,8,8,8,7,7,7,8,10,8,8,8,7,8,7,7,9,9,4,9,
+8,10,9,7,8,9,8,8,7,8,10,8,10,8,8,7,9,4,8,8,8,4,8,7,10,7,8,7,4,4,7,12,12,10,8,8,9,8,8,8,7,9,7,11,7,9,9,8,8,10,
+9,8,9,8,8,7,8,10,8,9,8,12,12,9,11,8,8,11,8,6,5,5,5,5,5,5,5,5,5,5,5,5,5,9,9,9,9,9,9,9,9,9,9,9,10,10,10,10,10,
+10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,5,5,5,5,5,5,5,5,5,7,5,5,5,5,5,6,6,5,5,5,5,5,5,5,5,5,
+10,8,8,8,8,8,8,8,8,8,4,8,5,5,6,6,5,4,4,6,4,8,8,8,8,8,7,8,9,9,8,8,9,11,8,10,13,22,10,0,4,4,4,7,9,9,13,12,4,5,5,
+7,9,4,4,4,4,9,9,9,9,9,9,9,9,9,9,4,4,9,9,9,8,10,10,10,10,10,9,9,11,11,5,9,11,9,12,11,11,9,11,10,9,9,11,10,13,
+10,10,9,5,4,5,9,7,4,9,9,9,9,9,5,9,9,4,4,9,4,13,9,9,9,9,6,8,6,9,8,12,9,8,7,5,4,5,9,10,10,10,9,11,11,11,9,9,9,9,
+9,9,9,9,9,9,9,4,4,4,4,9,9,9,9,9,9,9,9,9,9,9,5,9,9,9,7,11,9,10,10,12,4,4,9,13,11,8,9,9,9,9,9,7,9,11,9,4,5,5,11,
+13,9,8,4,9,7,9,9,8,9,9,13,4,10,10,11,13,13,7,13,7,7,4,4,9,6,8,10,2,9,4,4,9,9,9,4,4,7,13,10,9,10,9,9,5,5,5,5,
+11,11,10,11,11,11,11,4,4,4,4,4,4,4,4,4,4,4,9,4,9,8,9,7,4,10,9,10,8,9,9,9,9,5,5,5,13,13,13,11,11,9,5,9,8,10,9,
+10,9,9,7,4,5,10,9,10,9,10,11,10,9,9,9,9,14,8,9,4,9,7,9,7,11,9,11,9,12,11,9,10,6,10,6,9,8,9,6,9,8,11,9,11,9,9,
+7,9,7,4,4,4,4,4,4,4,4,4,7,4,7,8,6,22,13,8,13,7,13,7,13,7,7,13,9,8,8,5,5,8,5,4,10,9,10,9,10,9,9,9,9,9,9,9,11,9,
+11,9,11,9,11,9,11,9,5,4,5,4,5,4,5,4,9,4,11,9,9,9,4,11,9,11,9,11,9,11,9,10,6,9,8,9,6,11,9,11,9,11,9,11,9,13,12,
+10,8,5,10,9,13,13,11,9,2,4,10,7,11,12,7,12,13,12,4,10,10,9,10,9,9,11,11,5,11,10,12,11,9,11,11,9,9,9,10,12,10,
+12,11,5,10,9,7,9,4,9,9,8,9,9,7,6,9,9,4,9,8,9,8,6,9,9,9,7,10,7,9,12,9,12,12,4,9,9,9,12,9,13,9,10,9,5,5,9,16,16,
+13,9,9,11,10,10,10,9,11,9,14,9,11,11,9,10,12,11,11,11,9,10,9,9,12,10,11,10,14,15,13,14,10,10,15,10,9,9,8,7,9,
+9,12,9,9,9,8,9,11,9,9,9,9,9,7,8,13,9,9,9,12,13,10,12,8,9,13,8,9,9,6,9,8,4,4,4,13,13,9,8,8,9,7,6,13,12,13,12,
+13,12,10,8,10,4,7,9,17,8,13,13,13,13,8,9,8,8,9,8,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,8,13,13,13,13,13,8,8,8,13,14,12,7,9,7,9,8,7,10,13,4,5,5,5,9,9,8,9,6,4,8,7,9,9,
+9,9,9,8,9,9,9,7,9,9,9,9,9,8,9,9,10,11,11,16,11,6,11,11,9,4,9,5,9,5,9,9,9,6,5,4,8,9,8,9,8,8,9,10,5,8,9,8,11,10,
+9,8,9,9,8,8,9,8,11,9,9,8,11,12,8,9,8,9,9,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,10,9,9,9,9,9,9,9,9,9,9,8,8,8,8,8,9,9,9,
+8,8,8,8,8,9,9,8,10,10,5,5,5,5,5,12,8,9,8,8,8,8,10,10,10,9,9,9,9,9,9,9,8,8,8,8,8,8,8,8,9,9,9,9,9,9,11,11,11,11,
+9,9,9,8,8,8,8,11,9,8,9,7,8,8,8,10,10,5,9,8,11,10,8,9,10,8,8,8,9,11,9,11,9,8,8,10,5,9,9,9,5,9,8,11,7,8,8,5,5,8,
+13,13,11,9,8,10,8,9,9,7,9,8,12,8,10,10,9,9,11,10,9,10,8,8,8,8,11,9,10,9,13,13,10,12,8,8,12,9,7,5,5,5,5,5,5,5,
+5,5,5,5,5,5,10,10,10,10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+11,11,11,6,6,6,6,6,6,6,6,6,8,6,6,6,5,5,6,6,5,6,6,6,6,6,6,6,6,11,9,9,9,9,9,9,9,9,9,4,9,5,5,6,6,5,5,5,7,5,9,9,9,
+9,9,8,8,9,9,9,9,9,12,9,10,15,26,11,0,5,5,5,8,10,10,15,13,4,6,6,8,10,5,5,5,4,10,10,10,10,10,10,10,10,10,10,5,5,
+10,10,10,9,11,12,12,12,12,11,10,13,13,6,10,13,10,14,13,13,11,13,12,11,11,13,12,15,12,12,11,6,4,6,10,8,5,10,10,
+10,10,10,6,10,10,5,5,10,5,15,10,10,10,10,7,9,7,10,9,14,10,9,8,6,4,6,10,12,12,12,11,13,13,13,10,10,10,10,10,10,
+10,10,10,10,10,5,5,5,5,10,10,10,10,10,10,10,10,10,10,10,6,10,10,10,8,13,10,12,12,14,5,5,10,15,13,9,10,10,10,
+10,10,8,11,12,10,4,6,6,13,15,10,9,5,10,8,10,10,9,10,10,15,5,12,12,13,15,15,8,15,8,8,4,4,10,7,9,12,3,10,5,5,10,
+10,10,5,4,8,15,12,11,12,11,11,6,6,6,6,13,13,12,13,13,13,13,5,5,5,5,5,5,5,5,5,5,5,10,5,11,9,11,8,4,12,10,12,9,
+11,10,10,10,6,6,6,15,15,15,13,13,10,6,11,9,12,10,12,10,10,8,5,6,12,10,12,10,12,13,12,11,10,11,10,15,10,10,5,
+10,8,10,8,13,10,13,10,13,13,10,12,7,12,7,11,9,11,7,11,9,13,10,13,10,11,8,11,8,5,5,5,5,5,5,5,5,5,8,5,8,9,7,26,
+15,9,15,8,15,8,15,8,8,15,11,9,9,5,5,9,5,5,12,10,12,10,12,10,11,10,11,10,11,10,13,10,13,10,13,10,13,10,13,10,6,
+5,6,5,6,5,6,5,10,5,13,10,10,10,5,13,10,12,10,13,10,13,10,12,7,11,9,11,7,13,10,13,10,13,10,13,10,15,14,12,9,6,
+12,10,15,15,13,10,3,5,12,8,13,14,8,13,15,13,5,12,12,10,12,11,11,13,13,6,13,12,14,13,11,13,13,11,11,11,12,14,
+12,14,13,6,12,10,8,10,5,10,10,10,9,10,8,7,10,10,5,10,9,10,9,7,10,11,10,8,11,8,10,13,10,14,13,5,10,10,10,13,11,
+15,10,12,11,6,6,10,18,18,15,11,10,13,12,12,12,10,13,11,16,10,13,13,11,12,14,13,13,13,11,12,11,10,14,12,13,12,
+17,17,15,16,12,12,17,12,10,10,9,8,10,10,14,10,11,11,10,11,13,11,10,10,10,10,8,9,15,10,10,10,15,15,12,14,9,10,
+15,9,10,10,7,10,9,5,5,5,15,15,10,10,9,10,8,7,15,14,15,14,15,14,12,9,11,4,8,10,20,9,15,15,15,15,9,10,9,9,11,9,
+11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+11,11,11,11,11,11,11,11,11,11,9,15,15,15,15,15,9,9,9,15,16,14,8,10,8,10,9,8,12,15,5,6,6,6,10,11,9,11,7,5,10,8,
+10,10,10,10,10,10,10,10,10,8,10,10,10,10,10,10,10,10,12,13,12,18,12,7,12,13,10,5,10,6,10,5,10,10,10,7,6,5,10,
+10,10,10,9,9,11,11,5,9,11,9,13,11,10,9,10,10,9,9,11,10,13,10,10,9,13,14,9,10,9,10,10,10,10,10,10,10,10,10,9,9,
+9,9,5,5,5,5,11,10,10,10,10,10,11,11,11,11,10,10,10,10,10,10,11,10,10,9,9,9,9,9,11,11,10,11,11,5,5,5,5,5,13,9,
+11,9,9,9,9,11,11,11,11,10,10,10,10,10,10,9,9,9,9,9,9,9,9,11,11,11,11,11,11,13,13,13,13,10,10,10,9,9,9,10,13,
+10,10,10,9,10,9,9,11,11,5,11,10,13,11,9,10,11,9,10,9,10,12,10,13,10,10,9,11,5,10,10,10,5,10,9,12,9,10,9,5,5,9,
+15,15,12,10,9,11,10,10,10,9,11,9,14,9,11,11,10,10,13,11,10,11,9,10,9,9,12,10,11,10,15,15,12,14,10,10,14,10,8,
+6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,12,12,12,12,12,13,13,13,13,13,13,13,13,13,13,13,12,12,12,12,12,12,
+12,12,12,12,12,12,12,7,7,7,7,7,7,7,7,7,9,7,7,7,6,6,7,7,6,7,7,7,7,7,7,7,7,12,10,10,10,10,10,10,10,10,10,5,10,6,
+6,7,7,6,5,5,8,5,10,10,10,10,10,9,10,11,11,10,10,11,13,10,12,16,28,12,0,5,5,5,8,11,11,16,14,4,6,6,9,11,5,5,5,4,
+11,11,11,11,11,11,11,11,11,11,5,5,11,11,11,10,12,12,12,12,12,12,11,13,13,6,11,13,11,15,13,13,12,13,12,12,12,
+13,12,16,12,12,12,6,4,6,11,8,5,11,11,11,11,11,6,11,11,5,5,11,5,16,11,11,11,11,7,10,7,11,10,15,11,10,9,6,4,6,
+11,12,12,12,12,13,13,13,11,11,11,11,11,11,11,11,11,11,11,5,5,5,5,11,11,11,11,11,11,11,11,11,11,11,6,11,11,11,
+8,14,11,13,13,15,5,5,11,16,13,9,11,11,11,11,11,8,11,13,11,4,6,6,14,16,11,10,5,11,9,11,11,10,11,11,16,5,12,12,
+13,16,16,8,16,8,8,4,4,11,8,10,12,3,11,5,5,11,11,11,5,4,8,16,12,12,12,12,12,6,6,6,6,13,13,13,13,13,13,13,5,5,5,
+5,5,5,5,5,5,5,5,11,5,12,10,12,9,4,12,11,12,10,12,11,11,11,6,6,6,16,16,16,13,13,11,6,12,10,12,11,12,11,11,8,5,
+6,12,11,12,11,12,14,12,12,11,12,11,16,11,11,5,11,8,11,9,13,11,13,11,14,13,11,12,7,12,7,12,10,12,7,12,10,13,11,
+13,11,12,9,12,9,5,5,5,5,5,5,5,5,5,8,5,8,10,7,28,16,9,16,8,16,8,16,8,8,16,12,10,10,6,6,10,6,5,12,11,12,11,12,
+11,12,11,12,11,12,11,13,11,13,11,13,11,13,11,13,11,6,5,6,5,6,5,6,5,11,5,13,11,11,11,5,13,11,13,11,13,11,13,11,
+12,7,12,10,12,7,13,11,13,11,13,11,13,11,16,15,12,10,6,12,11,16,16,13,11,3,5,12,8,14,15,8,14,16,14,5,12,12,11,
+12,12,12,13,13,6,13,12,15,13,12,13,13,12,12,12,12,15,12,15,13,6,12,11,9,11,5,11,11,10,10,11,9,7,11,11,5,11,10,
+11,10,7,11,11,11,8,12,8,11,14,11,15,15,5,11,11,11,15,12,16,11,13,12,6,6,11,19,19,16,12,11,13,12,12,12,11,13,
+12,17,11,13,13,12,13,15,13,13,13,12,12,12,11,15,12,14,13,18,18,16,17,12,13,19,12,11,11,10,8,11,11,15,11,11,11,
+10,11,14,11,11,11,11,11,8,10,16,11,11,11,15,15,12,15,10,11,16,10,11,11,7,11,10,5,5,5,16,16,11,10,10,11,9,7,16,
+15,16,15,16,15,12,10,12,4,8,11,22,10,16,16,16,16,10,11,10,10,11,10,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,12,10,16,16,16,
+16,16,10,10,10,16,17,15,9,11,8,11,9,8,12,16,5,6,6,6,11,12,10,12,7,5,10,8,11,11,11,11,11,10,11,11,11,9,11,11,
+11,11,11,10,11,11,13,13,13,19,13,7,13,13,11,5,11,6,11,6,11,11,11,7,6,5,10,11,10,11,10,9,12,12,6,9,12,9,13,12,
+11,10,11,11,10,9,12,10,14,10,10,10,14,15,9,11,10,11,11,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,12,11,11,11,
+11,11,12,12,12,12,10,10,10,10,10,10,12,11,11,10,10,10,10,10,12,12,10,12,12,6,6,6,6,6,14,9,12,9,9,9,9,12,12,12,
+12,11,11,11,11,11,11,10,10,10,10,9,9,9,9,12,12,12,12,12,12,14,14,14,14,10,10,10,10,10,10,10,14,11,10,11,9,10,
+10,10,12,12,6,12,10,13,12,9,11,12,10,10,9,10,13,10,14,11,10,10,12,6,11,10,11,6,10,10,13,9,10,10,6,6,9,16,16,
+13,10,10,12,10,11,11,9,12,10,15,9,12,12,10,11,13,12,11,12,10,10,9,10,13,10,12,11,16,16,12,15,10,10,15,11,9,6,
+6,6,6,6,6,6,6,6,6,6,6,6,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,7,7,7,7,7,7,7,7,7,10,7,7,7,6,6,8,8,6,7,7,7,7,7,7,7,7,13,11,11,11,11,11,11,11,11,11,5,11,
+6,6,8,8,6,6,6,8,6,11,11,11,11,11,10,10,12,12,11,11,12,14,11,13,17,29,13,0,6,6,6,9,11,11,17,15,5,7,7,9,11,6,6,
+6,5,11,11,11,11,11,11,11,11,11,11,6,6,11,11,11,10,13,13,13,13,13,12,11,14,14,7,11,14,11,16,14,14,12,14,13,12,
+12,14,13,17,13,13,12,7,5,7,11,9,6,11,11,11,11,11,7,11,11,6,6,11,6,17,11,11,11,11,8,10,8,11,10,16,11,10,9,7,5,
+7,11,13,13,13,12,14,14,14,11,11,11,11,11,11,11,11,11,11,11,6,6,6,6,11,11,11,11,11,11,11,11,11,11,11,7,11,11,
+11,9,14,11,14,14,16,6,6,11,17,14,10,11,11,11,11,11,9,12,14,12,5,7,7,15,17,11,10,6,11,9,11,11,10,11,11,17,6,13,
+13,14,17,17,9,17,9,9,5,5,11,8,10,13,3,11,6,6,11,11,11,6,5,9,17,13,12,13,12,12,7,7,7,7,14,14,13,14,14,14,14,6,
+6,6,6,6,6,6,6,6,6,6,11,6,12,10,12,9,5,13,11,13,10,12,11,11,11,7,7,7,17,17,17,14,14,11,7,12,10,13,11,13,11,11,
+9,6,7,13,11,13,11,13,14,13,12,11,12,11,17,12,11,6,11,9,11,9,14,11,14,11,15,14,11,13,8,13,8,12,10,12,8,12,11,
+14,11,14,11,12,9,12,9,6,6,6,6,6,6,6,6,6,9,5,9,11,7,29,17,10,17,9,17,9,17,9,9,17,12,10,10,6,6,10,6,6,13,11,13,
+11,13,11,12,11,12,11,12,11,14,11,14,11,14,11,14,11,14,11,7,6,7,6,7,6,7,6,11,6,14,11,11,11,6,14,11,14,12,14,11,
+14,11,13,8,12,10,12,8,14,11,14,11,14,11,14,11,17,16,13,10,7,13,11,17,17,14,11,3,6,13,9,14,16,9,15,16,15,6,13,
+13,11,13,12,12,14,14,7,14,13,16,14,12,14,14,12,12,12,13,16,13,16,14,7,13,12,9,11,6,11,12,11,10,11,9,8,11,11,6,
+11,10,11,10,8,11,11,11,9,12,9,11,15,11,16,16,6,11,11,11,16,12,17,11,14,12,7,7,11,21,21,17,12,11,14,13,13,13,
+11,14,12,18,12,14,14,12,14,16,14,14,14,12,13,12,11,16,13,15,14,19,19,17,18,13,14,20,13,11,11,10,9,11,11,16,12,
+12,12,11,12,14,12,11,11,11,11,9,10,17,11,12,11,16,16,13,15,11,11,17,11,11,11,8,11,10,6,6,6,17,17,11,11,10,11,
+9,8,17,16,17,16,17,16,13,10,13,5,9,11,23,10,17,17,17,17,10,11,10,10,12,11,12,12,12,12,12,12,12,12,12,12,12,12,
+12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,10,17,
+17,17,17,17,10,10,10,17,18,16,9,11,9,11,10,9,13,17,6,7,7,7,11,12,10,12,8,6,11,9,11,11,12,11,12,11,11,12,11,9,
+11,11,12,11,11,11,11,11,13,14,14,21,14,8,14,14,11,6,11,6,11,6,11,11,11,8,6,6,11,12,11,12,10,10,12,12,6,10,12,
+10,14,12,12,11,12,12,11,10,12,11,15,11,11,10,15,16,10,12,11,12,12,11,11,11,11,11,11,11,10,10,10,10,6,6,6,6,12,
+12,12,12,12,12,12,12,12,12,11,11,11,11,11,11,12,12,12,10,10,10,10,10,12,12,11,12,12,6,6,6,6,6,15,10,12,10,10,
+10,10,12,12,12,12,12,12,12,12,12,12,11,11,11,11,10,10,10,10,12,12,12,12,12,12,15,15,15,15,11,11,11,10,10,10,
+11,15,12,11,12,10,11,10,10,12,13,6,12,11,14,12,10,12,12,11,11,10,11,14,11,15,12,11,10,12,6,12,11,12,6,11,10,
+14,10,11,11,6,6,10,17,17,14,11,11,12,11,11,12,10,12,10,16,10,12,12,11,12,14,12,12,12,11,11,10,11,14,11,13,12,
+16,17,13,16,11,11,16,12,9,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,13,13,13,13,13,13,14,14,14,14,14,14,14,14,
+14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,14,8,8,8,8,8,8,8,8,8,10,8,8,8,6,6,8,8,7,8,8,8,8,8,8,8,8,14,11,11,
+11,11,11,11,11,11,11,6,11,6,6,8,8,7,6,6,9,6,11,11,11,11,12,11,11,12,12,11,11,12,15,12,14,19,33,14,0,6,6,6,10,
+13,13,19,17,5,7,7,11,13,6,6,6,5,13,13,13,13,13,13,13,13,13,13,6,6,13,13,13,12,14,15,15,15,15,14,13,16,16,7,13,
+16,13,18,16,16,14,16,15,14,14,16,15,19,15,15,14,7,5,7,13,10,6,13,13,13,13,13,7,13,13,6,6,13,6,19,13,13,13,13,
+8,12,8,13,12,18,13,12,11,7,5,7,13,15,15,15,14,16,16,16,13,13,13,13,13,13,13,13,13,13,13,6,6,6,6,13,13,13,13,
+13,13,13,13,13,13,13,8,13,13,13,10,16,13,15,15,18,6,6,13,19,16,11,13,13,13,13,13,10,14,16,13,5,8,8,16,19,13,
+12,6,13,10,13,13,12,13,13,19,6,15,15,16,19,19,10,19,10,10,5,5,13,9,12,15,3,13,6,6,13,13,13,6,5,10,19,15,14,15,
+14,14,7,7,7,7,16,16,15,16,16,16,16,6,6,6,6,6,6,6,6,6,6,6,13,6,14,12,14,11,5,15,13,15,12,14,13,13,13,8,8,8,19,
+19,19,16,16,13,7,14,12,15,13,15,13,13,10,6,8,15,13,15,13,15,16,15,14,13,14,13,20,12,13,6,13,10,13,10,16,13,16,
+13,16,16,13,15,8,15,8,14,12,14,8,14,12,16,13,16,13,14,11,14,11,6,6,6,6,6,6,6,6,6,10,6,10,11,8,33,19,11,19,10,
+19,10,19,10,10,19,14,11,11,7,7,11,7,6,15,13,15,13,15,13,14,13,14,13,14,13,16,13,16,13,16,13,16,13,16,13,7,6,7,
+6,7,6,7,6,13,6,16,13,13,13,6,16,13,15,13,16,13,16,13,15,8,14,12,14,8,16,13,16,13,16,13,16,13,19,18,15,12,7,15,
+13,19,19,16,13,4,6,15,10,16,18,10,17,18,17,6,15,15,13,15,14,14,16,16,7,16,15,18,16,14,16,16,14,14,14,15,18,15,
+18,16,7,15,13,10,13,6,13,13,12,12,13,10,9,13,13,6,13,12,13,12,9,13,13,13,10,14,10,13,17,13,17,18,6,13,13,13,
+18,14,19,13,15,14,7,7,13,23,23,19,14,13,16,15,15,15,13,16,14,21,13,16,16,14,15,18,16,16,16,14,15,14,13,18,15,
+16,15,21,22,19,21,15,15,22,15,13,13,12,10,13,13,18,13,13,13,12,14,16,14,13,13,13,13,10,12,19,13,13,13,18,18,
+15,17,12,13,19,12,13,13,8,13,12,6,6,6,19,19,13,12,12,13,11,9,19,18,19,18,19,18,15,12,14,5,10,13,26,11,19,19,
+19,19,11,13,11,11,13,12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,14,11,19,19,19,19,19,11,11,11,19,20,17,10,13,10,13,11,10,
+15,19,6,8,8,8,13,14,12,14,8,6,12,10,13,12,13,13,13,12,13,13,13,10,13,13,13,13,13,12,13,13,15,16,16,23,16,9,15,
+16,13,6,13,7,13,7,13,13,13,9,7,6,12,13,12,13,12,11,14,14,7,11,14,11,16,14,13,12,13,13,12,11,14,12,16,12,12,11,
+16,17,11,13,12,13,13,12,12,12,12,12,12,12,12,12,12,12,7,7,7,7,14,13,13,13,13,13,14,14,14,14,12,12,12,12,12,12,
+14,13,13,12,12,12,12,12,14,14,12,14,14,7,7,7,7,7,17,11,14,11,11,11,11,14,14,14,14,13,13,13,13,13,13,12,12,12,
+12,11,11,11,11,14,14,14,14,14,14,16,16,16,16,12,12,12,11,11,11,12,16,13,12,13,11,12,12,11,14,14,7,14,12,16,14,
+11,13,14,12,12,11,12,15,12,16,13,12,12,14,7,13,12,13,7,12,12,15,11,12,12,7,7,11,19,19,16,12,12,14,12,13,13,11,
+14,12,18,11,14,14,12,13,16,14,13,14,12,12,11,12,15,12,14,13,18,19,15,18,12,12,18,13,10,8,8,8,8,8,8,8,8,8,8,8,
+8,8,15,15,15,15,15,15,15,15,15,15,15,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+9,9,9,9,9,9,9,9,9,12,9,9,9,7,7,9,9,7,9,9,9,9,9,9,9,9,15,13,13,13,13,13,13,13,13,13,6,13,7,7,9,9,7,7,7,10,7,13,
+13,13,13,13,12,12,14,14,13,13,14,17,13,15,21,36,16,0,7,7,7,11,14,14,21,19,6,8,8,12,14,7,7,7,6,14,14,14,14,14,
+14,14,14,14,14,7,7,14,14,14,13,16,16,16,16,16,15,14,18,18,8,14,18,14,20,18,18,15,18,16,15,15,18,16,21,16,16,
+15,8,6,8,14,11,7,14,14,14,14,14,8,14,14,7,7,14,7,21,14,14,14,14,9,13,9,14,13,20,14,13,12,8,6,8,14,16,16,16,15,
+18,18,18,14,14,14,14,14,14,14,14,14,14,14,7,7,7,7,14,14,14,14,14,14,14,14,14,14,14,8,14,14,14,11,18,14,17,17,
+20,7,7,14,21,18,12,14,14,14,14,14,11,15,17,14,6,8,8,18,21,14,13,7,14,12,14,14,13,14,14,21,7,16,16,18,21,21,11,
+21,11,11,6,6,14,10,13,16,4,14,7,7,14,14,14,7,6,11,21,16,15,16,15,15,8,8,8,8,18,18,17,18,18,18,18,7,7,7,7,7,7,
+7,7,7,7,7,14,7,15,13,15,12,6,16,14,16,13,15,14,14,14,8,8,8,21,21,21,18,18,14,8,15,13,16,14,16,14,14,11,7,8,16,
+14,16,14,16,18,16,15,14,15,14,22,14,14,7,14,11,14,11,18,14,18,14,19,18,14,16,9,16,9,15,13,15,9,15,13,18,14,18,
+14,15,12,15,12,7,7,7,7,7,7,7,7,7,11,6,11,13,9,36,21,12,21,11,21,11,21,11,11,21,15,13,13,7,7,13,7,7,16,14,16,
+14,16,14,15,14,15,14,15,14,18,14,18,14,18,14,18,14,18,14,8,7,8,7,8,7,8,7,14,7,18,14,14,14,7,18,14,17,14,18,14,
+18,14,16,9,15,13,15,9,18,14,18,14,18,14,18,14,21,20,16,13,8,16,14,21,21,18,14,4,7,16,11,18,20,11,19,20,19,7,
+16,16,14,16,15,15,18,18,8,18,16,20,18,15,18,18,15,15,15,16,19,16,20,18,8,16,14,12,14,7,14,14,14,13,14,12,10,
+14,14,7,14,13,14,13,10,14,15,14,11,15,11,14,19,14,19,21,7,14,14,14,21,15,21,14,17,15,8,8,14,25,25,21,15,14,18,
+16,16,16,14,18,15,23,14,18,18,15,17,20,18,18,18,15,16,15,14,19,16,18,17,23,24,21,23,16,17,24,16,14,14,13,11,
+14,14,19,14,15,15,13,15,18,15,14,14,14,14,11,13,21,14,15,14,21,21,16,19,13,14,20,13,14,14,9,14,13,7,7,7,21,21,
+14,13,13,14,12,10,21,20,21,20,21,20,16,13,16,6,11,14,28,13,21,21,21,21,13,14,13,13,15,13,15,15,15,15,15,15,15,
+15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+15,15,15,13,21,21,21,21,21,13,13,13,21,22,19,12,14,11,14,12,11,16,21,7,8,8,8,14,15,13,15,9,7,13,11,14,14,14,
+14,14,13,14,14,14,11,14,14,15,14,14,13,14,14,16,18,17,25,17,9,17,18,14,7,14,8,14,8,14,14,14,9,8,7,14,14,14,14,
+13,12,15,15,7,12,15,12,18,15,15,13,15,14,13,12,15,14,18,14,14,13,18,19,12,15,13,14,15,14,14,14,14,14,14,14,13,
+13,13,13,7,7,7,7,15,15,15,15,15,15,15,15,15,15,14,14,14,14,14,14,15,14,14,13,13,13,13,13,15,15,14,15,15,7,7,7,
+7,7,19,12,15,12,12,12,12,15,15,15,15,15,15,15,14,14,14,13,13,13,13,12,12,12,12,15,15,15,15,15,15,18,18,18,18,
+14,14,14,13,13,13,14,18,15,14,14,12,14,13,13,15,16,7,15,14,18,15,12,15,15,13,14,12,14,17,14,18,15,14,13,15,7,
+15,14,15,7,14,13,17,12,14,13,7,7,12,21,21,17,14,13,15,14,14,14,12,15,13,20,12,15,15,14,15,18,15,15,15,13,14,
+12,13,17,14,16,15,20,21,16,20,14,14,20,14,11,8,8,8,8,8,8,8,8,8,8,8,8,8,16,16,16,16,16,16,16,16,16,16,16,18,18,
+18,18,18,18,18,18,18,18,18,17,17,17,17,17,17,17,17,17,17,17,17,17,9,9,9,9,9,9,9,9,9,13,9,9,9,8,8,10,10,8,9,9,
+9,9,9,9,9,9,17,14,14,14,14,14,14,14,14,14,7,14,8,8,10,10,8,8,8,11,8,14,14,14,14,15,13,14,15,15,14,14,15,19,15,
+17,24,41,18,0,8,8,8,12,16,16,24,21,7,9,9,13,16,8,8,8,7,16,16,16,16,16,16,16,16,16,16,8,8,16,16,16,15,18,19,19,
+19,19,17,16,20,20,9,16,20,16,23,20,20,17,20,19,17,17,20,19,24,19,19,17,9,7,9,16,12,8,16,16,16,16,16,9,16,16,8,
+8,16,8,24,16,16,16,16,11,15,11,16,15,23,16,15,13,9,7,9,16,19,19,19,17,20,20,20,16,16,16,16,16,16,16,16,16,16,
+16,8,8,8,8,16,16,16,16,16,16,16,16,16,16,16,10,16,16,16,12,20,16,19,19,23,8,8,16,24,20,14,16,16,16,16,16,12,
+17,20,17,7,10,10,21,24,16,15,8,16,13,16,16,15,16,16,24,8,19,19,20,24,24,12,24,12,12,7,7,16,12,15,19,4,16,8,8,
+16,16,16,8,7,12,24,19,17,19,17,17,9,9,9,9,20,20,19,20,20,20,20,8,8,8,8,8,8,8,8,8,8,8,16,8,17,15,17,13,7,19,16,
+19,15,17,16,16,16,10,10,10,24,24,24,20,20,16,9,17,15,19,16,19,16,16,12,8,10,19,16,19,16,19,20,19,17,16,17,16,
+25,16,16,8,16,12,16,13,20,16,20,16,21,20,16,19,11,19,11,17,15,17,11,17,15,20,16,20,16,17,13,17,13,8,8,8,8,8,8,
+8,8,8,12,7,13,15,10,41,24,14,24,12,24,12,24,12,12,24,17,14,15,9,9,15,9,8,19,16,19,16,19,16,17,16,17,16,17,16,
+20,16,20,16,20,16,20,16,20,16,9,8,9,8,9,8,9,8,16,8,20,16,16,16,8,20,16,20,16,20,16,20,16,19,11,17,15,17,11,20,
+16,20,16,20,16,20,16,24,23,19,15,9,19,16,24,24,20,16,5,8,19,12,20,23,12,21,23,21,8,19,19,16,19,17,17,20,20,9,
+20,19,23,20,17,20,20,17,17,17,19,22,19,23,20,9,19,16,13,16,8,16,16,15,15,16,13,11,16,16,8,16,15,16,15,11,16,
+17,16,13,17,12,16,21,16,22,23,8,16,16,16,23,17,24,16,19,17,9,9,16,29,29,23,18,16,20,19,19,19,16,20,17,26,17,
+20,20,18,19,23,20,20,20,17,19,17,16,22,19,21,19,27,27,24,26,19,19,28,19,16,16,15,12,16,16,22,16,17,17,15,17,
+20,17,16,16,16,16,12,15,24,16,17,16,23,23,19,22,15,16,23,15,16,16,11,16,15,8,8,8,24,25,16,15,15,16,13,11,24,
+23,24,23,24,23,19,15,18,7,12,16,32,14,24,24,24,24,14,16,14,14,17,15,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,18,14,24,24,24,
+24,24,14,14,14,24,25,22,13,16,13,16,14,12,18,24,8,10,10,10,16,17,15,17,11,8,15,12,16,16,16,16,16,15,16,16,16,
+13,16,16,17,16,16,15,16,16,19,20,20,29,20,11,20,20,16,8,16,9,16,9,16,16,16,11,9,8,15,17,16,16,15,14,17,18,8,
+14,17,14,20,18,17,15,17,16,15,14,17,15,21,16,16,14,21,22,14,17,15,16,17,15,15,15,15,15,15,16,15,15,15,15,8,8,
+8,8,18,17,17,17,17,17,17,17,17,17,16,15,15,15,16,16,17,16,16,15,15,15,15,15,17,17,16,18,18,8,8,8,8,8,21,14,17,
+14,14,14,14,18,18,18,17,17,17,17,16,16,16,15,15,15,15,14,14,14,14,17,17,17,17,17,17,21,21,21,21,16,16,16,14,
+14,14,15,21,17,15,17,14,15,15,14,18,18,8,17,15,20,18,14,17,18,15,15,14,16,19,16,21,17,15,15,18,8,17,16,17,8,
+16,15,19,14,16,15,8,8,14,24,24,20,16,15,18,15,16,17,14,17,15,23,14,18,18,16,17,20,18,17,18,15,16,14,15,19,16,
+18,17,23,24,18,23,16,16,23,16,13,10,10,10,10,10,10,10,10,10,10,10,10,10,19,19,19,19,19,19,19,19,19,19,19,20,
+20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,20,11,11,11,11,11,11,11,11,11,15,11,11,11,9,
+9,11,11,9,11,11,11,11,11,11,11,11,20,16,16,16,16,16,16,16,16,16,8,16,9,9,11,11,9,9,9,12,9,16,16,16,16,17,15,
+16,17,17,16,16,17,21,17,19,27,47,20,0,9,9,9,14,18,18,27,24,8,11,11,15,18,9,9,9,8,18,18,18,18,18,18,18,18,18,
+18,9,9,18,18,18,17,20,21,21,21,21,20,18,22,22,11,18,22,18,25,22,22,20,22,21,20,20,22,21,27,21,21,20,11,8,11,
+18,14,9,18,18,18,18,18,11,18,18,9,9,18,9,27,18,18,18,18,12,17,12,18,17,25,18,17,15,11,8,11,18,21,21,21,20,22,
+22,22,18,18,18,18,18,18,18,18,18,18,18,9,9,9,9,18,18,18,18,18,18,18,18,18,18,18,11,18,18,18,14,23,18,22,22,26,
+9,9,18,27,22,16,18,18,18,18,18,14,19,22,19,7,11,11,23,27,18,17,9,18,15,18,18,17,18,18,27,9,21,21,22,27,27,14,
+27,14,14,8,8,18,13,17,21,5,18,9,9,18,18,18,9,8,14,27,21,20,21,20,20,11,11,11,11,22,22,21,22,22,22,22,9,9,9,9,
+9,9,9,9,9,9,9,18,9,20,17,20,15,8,21,18,21,17,20,18,18,18,11,11,11,27,27,27,23,22,18,11,20,17,21,18,21,18,18,
+14,9,11,21,18,21,18,21,23,21,20,18,20,18,28,18,18,9,18,14,18,14,22,18,22,18,23,22,18,21,12,21,12,20,17,20,12,
+20,17,22,18,22,18,20,15,20,15,9,9,9,9,9,9,9,9,9,14,8,14,16,12,47,27,16,27,14,27,14,27,14,14,26,19,16,16,10,10,
+16,10,9,21,18,21,18,21,18,20,18,20,18,20,18,22,18,22,18,22,18,22,18,22,18,11,9,11,9,11,9,11,9,18,9,22,18,18,
+18,9,22,18,22,18,22,18,22,18,21,12,20,17,20,12,22,18,22,18,22,18,22,18,27,25,21,17,11,21,18,27,27,22,18,5,9,
+21,14,23,26,14,24,26,24,9,21,21,18,21,20,20,22,22,11,22,21,25,22,20,22,22,20,20,20,21,25,21,26,22,11,21,18,15,
+18,9,18,18,17,17,18,15,12,18,18,9,18,17,18,17,12,18,19,18,14,20,14,18,24,18,25,26,9,18,18,18,26,20,27,18,21,
+20,11,11,18,33,33,26,20,18,22,21,21,21,18,23,20,29,19,22,22,20,22,25,22,22,22,20,21,20,18,25,21,23,22,30,31,
+27,29,21,21,31,21,18,18,17,14,18,18,25,18,19,19,17,19,23,19,18,18,18,18,14,17,27,18,19,18,26,26,21,25,17,18,
+26,17,18,18,12,18,17,9,9,9,27,28,18,17,17,18,15,13,27,25,27,25,27,25,21,17,20,8,14,18,36,16,27,27,27,27,16,18,
+16,16,19,17,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,19,
+19,19,19,19,19,19,19,19,19,19,19,19,19,20,16,27,27,27,27,27,16,16,16,28,28,25,15,18,14,18,16,14,21,27,9,11,11,
+11,18,20,17,20,12,9,17,14,18,18,18,18,18,17,18,18,18,15,18,18,19,18,18,17,18,18,21,22,22,33,22,12,22,22,18,9,
+18,10,18,10,18,18,18,12,10,9,17,19,18,18,17,16,19,20,9,16,20,16,23,20,19,17,19,18,17,16,20,17,23,18,18,16,23,
+25,16,19,17,18,19,17,17,17,17,17,17,18,17,17,17,17,9,9,9,9,20,19,19,19,19,19,20,20,20,20,18,17,17,17,18,18,19,
+18,18,17,17,17,17,17,19,19,18,20,20,9,9,9,9,9,24,16,20,16,16,16,16,20,20,20,19,19,19,19,18,18,18,17,17,17,17,
+16,16,16,16,20,20,20,20,20,20,23,23,23,23,18,18,18,16,16,16,17,23,19,17,19,16,17,17,16,20,20,9,20,17,23,20,16,
+19,20,17,17,16,18,22,18,23,19,17,17,20,9,19,18,19,9,18,17,22,16,18,17,9,9,16,27,27,22,18,17,20,17,18,19,16,20,
+17,25,16,20,20,18,19,23,20,19,20,17,18,16,17,22,18,20,19,26,27,21,25,18,18,26,18,14,11,11,11,11,11,11,11,11,
+11,11,11,11,11,21,21,21,21,21,21,21,21,21,21,21,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+22,22,22,22,12,12,12,12,12,12,12,12,12,16,12,12,12,10,10,13,13,11,12,12,12,12,12,12,12,12,22,18,18,18,18,18,
+18,18,18,18,9,18,10,10,13,13,11,10,10,14,10,18,18,18,18,19,17,18,19,20,18,18,20,24,19,22,29,50,22,0,10,10,10,
+15,19,19,29,26,8,11,11,16,19,10,10,10,8,19,19,19,19,19,19,19,19,19,19,10,10,19,19,19,18,21,23,23,23,23,21,19,
+24,24,11,19,24,19,27,24,24,21,24,23,21,21,24,23,29,23,23,21,11,8,11,19,15,10,19,19,19,19,19,11,19,19,10,10,19,
+10,29,19,19,19,19,13,18,13,19,18,27,19,18,16,11,8,11,19,23,23,23,21,24,24,24,19,19,19,19,19,19,19,19,19,19,19,
+10,10,10,10,19,19,19,19,19,19,19,19,19,19,19,12,19,19,19,15,25,19,23,23,28,10,10,19,29,24,17,19,19,19,19,19,
+15,21,24,20,8,12,12,25,29,19,18,10,19,16,19,19,18,19,19,29,10,23,23,24,29,29,15,29,15,15,8,8,19,14,18,23,5,19,
+10,10,19,19,19,10,8,15,29,23,21,23,21,21,11,11,11,11,24,24,23,24,24,24,24,10,10,10,10,10,10,10,10,10,10,10,19,
+10,21,18,21,16,8,23,19,23,18,21,19,19,19,12,12,12,29,29,29,24,24,19,11,21,18,23,19,23,19,19,15,10,11,23,19,23,
+19,23,24,23,21,19,21,19,30,20,19,10,19,15,19,15,24,19,24,19,25,24,19,23,13,23,13,21,18,21,13,21,18,24,19,24,
+19,21,16,21,16,10,10,10,10,10,10,10,10,10,15,9,15,18,13,50,29,17,29,15,29,15,29,15,15,28,21,17,18,10,10,18,10,
+10,23,19,23,19,23,19,21,19,21,19,21,19,24,19,24,19,24,19,24,19,24,19,11,10,11,10,11,10,11,10,19,10,24,19,19,
+19,10,24,19,24,20,24,19,24,19,23,13,21,18,21,13,24,19,24,19,24,19,24,19,29,27,23,18,11,23,19,29,29,24,19,6,10,
+23,15,25,28,15,26,28,26,10,23,23,19,23,21,21,24,24,11,24,23,27,24,21,24,24,21,21,21,23,27,23,27,24,11,23,20,
+16,19,10,19,20,19,18,19,16,13,19,19,10,19,18,19,18,13,19,21,19,15,22,15,19,26,19,27,27,10,19,19,19,27,21,29,
+19,23,21,11,11,19,35,35,28,21,19,24,23,23,23,19,24,21,32,20,24,24,21,23,27,24,24,24,21,23,21,19,27,23,25,23,
+32,33,29,31,22,23,34,23,19,19,18,15,19,19,27,20,20,20,19,21,25,21,19,19,19,19,15,18,29,19,20,19,28,28,22,26,
+18,19,28,18,19,20,13,19,18,10,10,10,29,30,20,19,18,19,16,14,29,27,29,27,29,27,23,18,22,8,15,19,39,17,29,29,29,
+29,17,19,17,17,21,18,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,17,29,29,29,29,29,17,17,17,30,30,27,16,19,15,19,17,15,22,
+29,10,12,12,12,19,21,18,21,13,10,19,15,19,19,20,19,20,18,19,20,19,16,19,20,20,19,19,18,19,19,23,24,24,35,24,
+13,24,24,19,10,19,11,19,11,19,19,19,13,11,10,19,20,19,20,18,17,21,21,10,17,21,17,24,21,20,18,20,20,18,17,21,
+19,25,19,19,17,25,27,17,20,18,20,20,19,19,19,19,19,19,19,18,18,18,18,10,10,10,10,21,20,20,20,20,20,21,21,21,
+21,19,19,19,19,19,19,21,20,20,18,18,18,18,18,21,21,19,21,21,10,10,10,10,10,26,17,21,17,17,17,17,21,21,21,21,
+20,20,20,20,20,20,18,18,18,18,17,17,17,17,21,21,21,21,21,21,25,25,25,25,19,19,19,17,17,17,19,25,20,19,20,17,
+19,18,17,21,21,10,21,19,24,21,17,20,21,18,19,17,19,23,19,25,20,19,18,21,10,20,19,20,10,19,18,23,17,19,18,10,
+10,17,29,29,24,19,18,21,19,19,20,17,21,18,27,17,21,21,19,20,24,21,20,21,18,19,17,18,23,19,22,20,28,29,22,27,
+19,19,28,20,16,12,12,12,12,12,12,12,12,12,12,12,12,12,23,23,23,23,23,23,23,23,23,23,23,24,24,24,24,24,24,24,
+24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,13,13,13,13,13,13,13,13,13,18,13,13,13,11,11,14,14,11,13,
+13,13,13,13,13,13,13,24,19,19,19,19,19,19,19,19,19,10,19,11,11,14,14,11,11,11,15,11,19,19,19,19,20,18,19,21,
+21,19,19,21,26,20,23,32,55,24,0,11,11,11,16,21,21,32,28,9,12,12,18,21,11,11,11,9,21,21,21,21,21,21,21,21,21,
+21,11,11,21,21,21,20,24,25,25,25,25,23,21,27,27,12,21,27,21,30,27,27,23,27,25,23,23,27,25,32,25,25,23,12,9,12,
+21,16,11,21,21,21,21,21,12,21,21,11,11,21,11,32,21,21,21,21,14,20,14,21,20,30,21,20,18,12,9,12,21,25,25,25,23,
+27,27,27,21,21,21,21,21,21,21,21,21,21,21,11,11,11,11,21,21,21,21,21,21,21,21,21,21,21,13,21,21,21,16,27,21,
+26,26,30,11,11,21,32,27,19,21,21,21,21,21,16,23,26,22,9,13,13,27,32,21,20,11,21,18,21,21,20,21,21,32,11,25,25,
+27,32,32,16,32,16,16,9,9,21,16,20,25,5,21,11,11,21,21,21,11,9,16,32,25,23,25,23,23,12,12,12,12,27,27,25,27,27,
+27,27,11,11,11,11,11,11,11,11,11,11,11,21,11,23,20,23,18,9,25,21,25,20,23,21,21,21,13,13,13,32,32,32,27,27,21,
+12,23,20,25,21,25,21,21,16,11,13,25,21,25,21,25,27,25,23,21,23,21,33,22,21,11,21,16,21,17,27,21,27,21,27,27,
+21,25,14,25,14,23,20,23,14,23,20,27,21,27,21,23,18,23,18,11,11,11,11,11,11,11,11,11,16,10,17,19,14,55,32,19,
+32,16,32,16,32,16,16,31,23,19,19,11,11,19,11,11,25,21,25,21,25,21,23,21,23,21,23,21,27,21,27,21,27,21,27,21,
+27,21,12,11,12,11,12,11,12,11,21,11,27,21,21,21,11,27,21,26,22,27,21,27,21,25,14,23,20,23,14,27,21,27,21,27,
+21,27,21,32,30,25,20,12,25,21,32,32,27,21,6,11,25,16,27,31,16,28,31,29,11,25,25,21,25,23,23,27,27,12,27,25,30,
+27,23,27,27,23,23,23,25,30,25,30,27,12,25,22,18,21,11,21,22,21,20,21,18,15,21,21,11,21,20,21,20,15,21,23,21,
+17,24,16,21,28,21,29,30,11,21,21,21,30,23,32,21,25,23,12,12,21,39,39,31,23,22,27,25,25,25,21,27,23,35,22,27,
+27,23,26,30,27,27,27,23,25,23,22,30,25,28,26,36,36,32,35,25,25,37,25,21,21,20,16,21,21,30,22,23,23,21,23,27,
+23,21,21,21,21,16,20,32,21,22,21,30,31,25,29,20,21,31,20,21,22,14,21,20,11,11,11,32,33,22,21,20,21,18,15,32,
+30,32,30,32,30,25,20,24,9,16,21,43,19,32,32,32,32,19,21,19,19,23,20,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,19,32,32,32,
+32,32,19,19,19,33,34,29,18,21,17,21,19,16,25,32,11,13,13,13,21,23,20,23,14,11,21,16,21,21,22,21,22,20,21,22,
+21,17,22,22,22,21,21,20,21,21,25,27,27,39,27,14,26,27,21,11,21,12,21,12,21,21,21,14,12,11,21,22,21,22,20,19,
+23,23,11,19,23,19,27,23,22,20,22,22,20,19,23,21,27,21,21,19,27,29,19,22,20,22,22,21,21,21,21,21,21,21,20,20,
+20,20,11,11,11,11,23,22,22,22,22,22,23,23,23,23,21,21,21,21,21,21,23,22,22,20,20,20,20,20,23,23,21,23,23,11,
+11,11,11,11,28,19,23,19,19,19,19,23,23,23,23,22,22,22,22,22,22,20,20,20,20,19,19,19,19,23,23,23,23,23,23,27,
+27,27,27,21,21,21,19,19,19,21,27,22,21,22,18,21,20,19,23,24,11,23,21,27,23,19,22,23,20,21,19,21,26,21,28,22,
+21,20,23,11,22,21,22,11,21,20,26,18,21,20,11,11,19,32,32,26,21,20,23,21,21,22,18,23,20,30,19,23,23,21,22,27,
+23,22,23,20,21,19,20,26,21,24,22,31,32,25,30,21,21,31,22,17,13,13,13,13,13,13,13,13,13,13,13,13,13,25,25,25,
+25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,14,14,14,14,
+14,14,14,14,14,20,14,14,14,12,12,15,15,12,14,14,14,14,14,14,14,14,26,21,21,21,21,21,21,21,21,21,11,21,12,12,
+15,15,12,12,12,16,12,21,21,21,21,22,20,21,23,23,21,21,23,28,22,26,33,57,25,0,11,11,11,17,22,22,33,29,9,13,13,
+18,22,11,11,11,9,22,22,22,22,22,22,22,22,22,22,11,11,22,22,22,20,24,26,26,26,26,24,22,27,27,13,22,27,22,31,27,
+27,24,27,26,24,24,27,26,33,26,26,24,13,9,13,22,17,11,22,22,22,22,22,13,22,22,11,11,22,11,33,22,22,22,22,15,20,
+15,22,20,31,22,20,18,13,9,13,22,26,26,26,24,27,27,27,22,22,22,22,22,22,22,22,22,22,22,11,11,11,11,22,22,22,22,
+22,22,22,22,22,22,22,13,22,22,22,17,28,22,26,26,31,11,11,22,33,27,19,22,22,22,22,22,17,24,27,23,9,13,13,28,33,
+22,20,11,22,18,22,22,20,22,22,33,11,26,26,27,33,33,17,33,17,17,9,9,22,16,20,26,6,22,11,11,22,22,22,11,9,17,33,
+26,24,26,24,24,13,13,13,13,27,27,26,27,27,27,27,11,11,11,11,11,11,11,11,11,11,11,22,11,24,20,24,18,9,26,22,26,
+20,24,22,22,22,13,13,13,33,33,33,28,27,22,13,24,20,26,22,26,22,22,17,11,13,26,22,26,22,26,28,26,24,22,24,22,
+34,22,22,11,22,17,22,18,27,22,27,22,28,27,22,26,15,26,15,24,20,24,15,24,21,27,22,27,22,24,18,24,18,11,11,11,
+11,11,11,11,11,11,17,10,17,20,14,57,33,19,33,17,33,17,33,17,17,32,24,20,20,12,12,20,12,11,26,22,26,22,26,22,
+24,22,24,22,24,22,27,22,27,22,27,22,27,22,27,22,13,11,13,11,13,11,13,11,22,11,27,22,22,22,11,27,22,27,22,27,
+22,27,22,26,15,24,20,24,15,27,22,27,22,27,22,27,22,33,31,26,20,13,26,22,33,33,27,22,6,11,26,17,28,32,17,29,32,
+29,11,26,26,22,26,24,24,27,27,13,27,26,31,27,24,27,27,24,24,24,26,30,26,31,27,13,26,22,18,22,11,22,22,21,20,
+22,18,15,22,22,11,22,20,22,20,15,22,23,22,17,25,17,22,29,21,30,31,11,22,22,22,31,24,33,22,26,24,13,13,22,40,
+40,32,24,22,27,26,26,26,22,28,24,36,23,27,27,24,27,31,27,27,27,24,26,24,22,30,26,28,27,37,38,33,36,26,26,38,
+26,22,22,20,17,22,22,30,22,23,23,21,24,28,24,22,22,22,22,17,20,33,22,23,22,31,32,25,30,21,22,32,21,22,22,15,
+22,20,11,11,11,33,34,22,21,20,22,18,15,33,31,33,31,33,31,26,20,25,9,17,22,44,20,33,33,33,33,20,22,20,20,23,20,
+23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,23,
+23,23,23,23,23,23,23,23,23,24,20,33,33,33,33,33,20,20,20,34,35,30,18,22,17,22,19,17,25,33,11,13,13,13,22,24,
+20,24,15,11,21,17,22,22,22,22,22,21,22,23,22,18,22,22,23,22,22,21,22,22,26,27,27,40,27,15,27,27,22,11,22,13,
+22,12,22,22,22,15,13,11,21,23,21,23,20,19,24,24,12,19,24,19,28,24,23,21,23,22,21,19,24,21,28,22,22,20,28,30,
+19,23,21,23,23,21,21,21,21,21,21,21,20,20,20,20,12,12,12,12,24,23,23,23,23,23,24,24,24,24,22,21,21,21,21,21,
+24,23,23,20,20,20,20,20,24,24,21,24,24,12,12,12,12,12,29,19,24,19,19,19,19,24,24,24,24,23,23,23,22,22,22,21,
+21,21,21,19,19,19,19,24,24,24,24,24,24,28,28,28,28,22,22,22,20,20,20,21,28,23,21,23,19,21,20,20,24,24,12,24,
+21,28,24,19,23,24,21,21,19,22,27,22,29,23,21,20,24,12,23,22,23,12,22,20,27,19,21,21,12,12,19,33,33,27,22,21,
+24,21,22,23,19,24,20,31,19,24,24,22,23,28,24,23,24,21,21,19,21,27,22,25,23,32,33,25,31,21,21,31,22,18,13,13,
+13,13,13,13,13,13,13,13,13,13,13,26,26,26,26,26,26,26,26,26,26,26,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+27,27,27,27,27,27,27,27,27,27,15,15,15,15,15,15,15,15,15,20,15,15,15,13,13,16,15,13,15,15,15,15,15,15,15,15,
+27,22,22,22,22,22,22,22,22,22,11,22,13,13,16,15,13,12,12,17,12,22,22,22,22,23,21,21,24,24,22,22,24,29,23,26,
+37,64,28,0,12,12,12,19,24,25,37,33,10,14,14,21,24,12,12,12,10,25,25,25,25,25,25,25,25,25,25,12,12,24,24,24,23,
+27,29,29,29,29,27,25,31,31,14,25,31,25,35,31,31,27,31,29,27,27,31,29,37,29,29,27,14,10,14,24,19,12,25,25,25,
+25,25,14,25,25,12,12,25,12,37,25,25,25,25,16,23,16,25,23,35,25,23,21,14,10,14,24,29,29,29,27,31,31,31,25,25,
+25,25,25,25,25,25,25,25,25,12,12,12,12,25,25,25,25,25,25,25,25,25,25,25,15,25,25,25,19,31,25,30,30,35,12,12,
+24,37,31,22,24,24,24,25,25,19,26,30,25,10,15,15,32,37,25,23,12,24,20,25,24,23,25,25,37,12,29,29,31,37,37,19,
+37,19,19,10,10,24,18,23,29,6,25,12,12,25,25,25,12,10,19,37,29,27,29,27,27,14,14,14,14,31,31,29,31,31,31,31,12,
+12,12,12,12,12,12,12,12,12,12,25,12,27,23,27,21,10,29,25,29,23,27,25,24,24,15,15,15,37,37,37,31,31,25,14,27,
+23,29,25,29,25,25,19,12,15,29,25,29,25,29,31,29,27,25,27,25,38,25,25,12,25,19,25,20,31,25,31,25,32,31,25,29,
+16,29,16,27,23,27,16,27,23,31,25,31,25,27,21,27,21,12,12,12,12,12,12,12,12,12,19,11,19,22,16,64,37,22,37,19,
+37,19,37,19,19,36,27,22,22,13,13,22,13,12,29,25,29,25,29,25,27,25,27,25,27,25,31,25,31,25,31,25,31,25,31,25,
+14,12,14,12,14,12,14,12,25,12,31,25,25,25,12,31,25,30,25,31,25,31,25,29,16,27,23,27,16,31,25,31,25,31,25,31,
+25,37,35,29,23,14,29,25,37,37,31,25,7,12,29,19,31,35,19,33,36,33,12,29,29,25,29,27,27,31,31,14,31,29,35,31,27,
+31,31,27,27,27,29,34,29,35,31,14,29,25,20,25,12,25,25,24,23,25,20,17,25,25,12,25,23,25,23,17,25,26,25,20,28,
+19,25,33,24,34,35,12,25,25,25,35,27,37,25,29,27,14,14,25,45,45,36,27,25,31,29,29,29,25,31,27,40,25,31,31,27,
+30,35,31,31,31,27,29,27,25,34,29,32,30,41,42,37,40,29,29,43,29,25,25,23,19,25,25,34,25,26,26,24,26,31,26,25,
+25,25,25,19,23,37,25,26,25,35,36,29,34,23,25,36,23,25,25,16,25,23,12,12,12,37,38,25,24,23,25,21,17,37,35,37,
+35,37,35,29,23,28,10,19,25,50,22,37,37,37,37,22,24,22,22,26,23,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,27,22,37,37,37,37,
+37,22,22,22,38,39,34,20,25,20,24,22,19,28,37,12,15,15,15,24,27,23,27,16,12,24,19,25,24,25,24,25,24,24,25,25,
+20,25,25,26,25,25,23,25,25,29,31,31,45,31,17,30,31,25,12,25,14,25,13,25,25,25,17,14,12,24,25,24,25,23,22,27,
+27,13,22,27,22,31,27,26,23,26,25,23,22,27,24,32,24,24,22,32,34,22,26,23,25,26,24,24,24,24,24,24,24,23,23,23,
+23,13,13,13,13,27,26,26,26,26,26,27,27,27,27,24,24,24,24,24,24,27,25,25,23,23,23,23,23,27,27,24,27,27,13,13,
+13,13,13,33,22,27,22,22,22,22,27,27,27,27,26,26,26,25,25,25,23,23,23,23,22,22,22,22,27,27,27,27,27,27,32,32,
+32,32,24,24,24,22,22,22,24,32,26,24,25,21,24,23,22,27,27,13,27,24,31,27,21,26,27,23,24,22,24,30,24,32,26,24,
+23,27,13,26,24,26,13,24,23,30,21,24,23,13,13,22,37,37,30,24,23,27,24,24,25,21,27,23,35,22,27,27,24,26,31,27,
+26,27,23,24,22,23,30,24,28,26,36,37,28,35,24,24,35,25,20,15,15,15,15,15,15,15,15,15,15,15,15,15,29,29,29,29,
+29,29,29,29,29,29,29,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,31,17,17,17,17,17,
+17,17,17,17,23,17,17,17,14,14,17,17,14,17,17,17,17,17,17,17,17,30,25,25,25,25,25,25,25,25,25,12,25,14,14,17,
+17,14,13,13,19,13,25,25,25,25,26,23,24,27,27,25,25,27,33,26,30,42,72,32,0,14,14,14,21,28,28,42,37,12,16,16,23,
+28,14,14,14,12,28,28,28,28,28,28,28,28,28,28,14,14,28,28,28,26,31,33,33,33,33,30,28,35,35,16,28,35,28,40,35,
+35,30,35,33,30,30,35,33,42,33,33,30,16,12,16,28,21,14,28,28,28,28,28,16,28,28,14,14,28,14,42,28,28,28,28,19,
+26,19,28,26,40,28,26,23,16,12,16,28,33,33,33,30,35,35,35,28,28,28,28,28,28,28,28,28,28,28,14,14,14,14,28,28,
+28,28,28,28,28,28,28,28,28,17,28,28,28,21,36,28,34,34,40,14,14,28,42,35,25,28,28,28,28,28,21,30,35,29,11,17,
+17,36,42,28,26,14,28,23,28,28,26,28,28,42,14,33,33,35,42,42,21,42,21,21,12,12,28,21,26,33,7,28,14,14,28,28,28,
+14,12,21,42,33,30,33,30,30,16,16,16,16,35,35,33,35,35,35,35,14,14,14,14,14,14,14,14,14,14,14,28,14,30,26,30,
+23,12,33,28,33,26,30,28,28,28,17,17,17,42,42,42,35,35,28,16,30,26,33,28,33,28,28,21,14,17,33,28,33,28,33,35,
+33,30,28,30,28,43,28,28,14,28,21,28,22,35,28,35,28,36,35,28,33,19,33,19,30,26,30,19,30,26,35,28,35,28,30,23,
+30,23,14,14,14,14,14,14,14,14,14,21,13,22,25,18,72,42,25,42,21,42,21,42,21,21,41,30,25,25,15,15,25,15,14,33,
+28,33,28,33,28,30,28,30,28,30,28,35,28,35,28,35,28,35,28,35,28,16,14,16,14,16,14,16,14,28,14,35,28,28,28,14,
+35,28,34,29,35,28,35,28,33,19,30,26,30,19,35,28,35,28,35,28,35,28,42,40,33,26,16,33,28,42,42,35,28,8,14,33,21,
+36,40,21,37,41,38,14,33,33,28,33,30,30,35,35,16,35,33,40,35,30,35,35,30,30,30,33,39,33,40,35,16,33,28,23,28,
+14,28,28,27,26,28,23,19,28,28,14,28,26,28,26,19,28,30,28,22,31,21,28,37,27,38,40,14,28,28,28,40,30,42,28,33,
+30,16,16,28,51,51,41,31,28,35,33,33,33,28,35,30,46,29,35,35,31,34,40,35,35,35,30,33,30,28,39,33,36,34,47,48,
+42,45,33,33,49,33,28,28,26,21,28,28,39,28,30,30,27,30,36,30,28,28,28,28,21,26,43,28,29,28,40,40,32,38,26,28,
+41,26,28,28,19,28,26,14,14,14,42,43,28,27,26,28,23,20,42,40,42,40,42,40,33,26,32,12,21,28,57,25,42,42,42,42,
+25,28,25,25,30,26,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,31,25,42,42,42,42,42,25,25,25,43,44,39,23,28,22,28,25,21,32,42,
+14,17,17,17,28,30,26,30,19,14,27,21,28,28,28,28,29,27,28,29,28,23,28,28,29,28,28,27,28,28,33,35,35,51,35,19,
+34,35,28,14,28,16,28,15,28,28,28,19,16,14,27,29,27,29,26,24,30,31,15,25,31,25,35,31,29,26,29,29,26,25,31,27,
+36,27,28,25,36,39,25,29,26,29,29,27,27,27,27,27,27,27,26,26,26,26,15,15,15,15,31,29,29,29,29,29,31,31,31,31,
+28,27,27,27,27,27,30,29,29,26,26,26,26,26,30,30,27,31,31,15,15,15,15,15,37,25,31,25,25,25,25,31,31,31,30,29,
+29,29,29,29,29,26,26,26,26,25,25,25,25,31,31,31,31,31,31,36,36,36,36,28,28,28,25,25,25,27,36,29,27,29,24,27,
+26,25,31,31,15,31,27,35,31,24,29,31,26,27,25,28,34,27,36,29,27,26,31,15,29,28,29,15,28,26,34,24,27,26,15,15,
+25,42,42,34,28,26,31,27,28,29,24,30,26,40,25,31,31,28,29,35,31,29,31,26,27,25,26,34,27,32,29,41,42,32,40,27,
+27,40,29,23,17,17,17,17,17,17,17,17,17,17,17,17,17,33,33,33,33,33,33,33,33,33,33,33,35,35,35,35,35,35,35,35,
+35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,19,19,19,19,19,19,19,19,19,26,19,19,19,16,16,20,20,16,19,19,
+19,19,19,19,19,19,34,28,28,28,28,28,28,28,28,28,14,28,16,16,20,20,16,15,15,22,15,28,28,28,28,29,26,27,30,30,
+28,28,30,37,29,34,46,79,35,0,15,15,15,23,30,31,46,41,13,18,18,26,30,15,15,15,13,31,31,31,31,31,31,31,31,31,31,
+15,15,30,30,30,28,34,36,36,36,36,33,31,38,38,18,31,38,31,43,38,38,33,38,36,33,33,38,36,46,36,36,33,18,13,18,
+30,23,15,31,31,31,31,31,18,31,31,15,15,31,15,46,31,31,31,31,20,28,20,31,28,43,31,28,26,18,13,18,30,36,36,36,
+33,38,38,38,31,31,31,31,31,31,31,31,31,31,31,15,15,15,15,31,31,31,31,31,31,31,31,31,31,31,18,31,31,31,23,39,
+31,37,37,44,15,15,30,46,38,27,30,30,30,31,31,23,33,38,32,12,18,18,39,46,31,28,15,30,25,31,30,28,31,31,46,15,
+36,36,38,46,46,23,46,23,23,13,13,30,23,28,36,8,31,15,15,31,31,31,15,13,23,46,36,33,36,33,33,18,18,18,18,38,38,
+36,38,38,38,38,15,15,15,15,15,15,15,15,15,15,15,31,15,33,28,33,26,13,36,31,36,28,33,31,30,30,18,18,18,46,46,
+46,38,38,31,18,33,28,36,31,36,31,31,23,15,18,36,31,36,31,36,39,36,33,31,33,31,47,31,31,15,31,23,31,25,38,31,
+38,31,39,38,31,36,20,36,20,33,28,33,20,33,29,38,31,38,31,33,26,33,26,15,15,15,15,15,15,15,15,15,23,14,24,28,
+20,79,46,27,46,23,46,23,46,23,23,45,33,28,28,16,16,28,16,15,36,31,36,31,36,31,33,31,33,31,33,31,38,31,38,31,
+38,31,38,31,38,31,18,15,18,15,18,15,18,15,31,15,38,31,31,31,15,38,31,37,31,38,31,38,31,36,20,33,28,33,20,38,
+31,38,31,38,31,38,31,46,43,36,28,18,36,31,46,46,38,31,9,15,36,23,39,44,23,41,45,41,15,36,36,31,36,33,33,38,38,
+18,38,36,43,38,33,38,38,33,33,33,36,43,36,44,38,18,36,31,25,31,15,31,31,30,28,31,25,21,31,31,15,31,28,31,28,
+21,31,33,31,24,34,23,31,41,30,42,44,15,31,31,31,44,33,46,31,37,33,18,18,31,56,56,45,34,31,38,36,36,36,31,39,
+33,50,32,38,38,34,37,43,38,38,38,33,36,33,31,43,36,40,37,51,52,46,50,36,37,53,36,31,31,28,23,30,31,43,31,32,
+32,30,33,39,33,31,31,31,31,23,28,47,31,32,30,44,44,35,42,29,31,45,29,31,31,20,31,28,15,15,15,47,47,31,30,28,
+31,26,22,46,43,46,43,46,43,36,28,35,13,23,31,62,28,46,46,46,46,28,30,28,28,33,29,33,33,33,33,33,33,33,33,33,
+33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+34,28,46,46,46,46,46,28,28,28,47,48,42,25,31,24,30,27,23,35,46,15,18,18,18,30,33,28,33,20,15,30,23,31,30,31,
+30,31,29,30,31,31,25,31,31,32,31,31,29,31,31,36,38,38,55,38,21,37,38,31,15,31,18,31,17,31,31,31,21,18,15,30,
+32,30,31,28,27,33,34,16,27,34,27,39,34,32,29,32,31,29,27,33,30,39,30,30,28,39,42,27,32,29,31,32,30,30,30,30,
+30,30,30,28,28,28,28,16,16,16,16,34,32,32,32,32,32,33,33,33,33,30,30,30,30,30,30,33,31,31,28,28,28,28,28,33,
+33,30,34,34,16,16,16,16,16,41,27,34,27,27,27,27,34,34,34,33,32,32,32,31,31,31,29,29,29,29,27,27,27,27,33,33,
+33,33,33,33,39,39,39,39,30,30,30,28,28,28,30,39,32,30,32,26,30,28,28,34,34,16,34,30,39,34,27,32,34,29,30,27,
+30,37,30,40,32,30,28,34,16,32,30,32,16,30,28,37,26,30,29,16,16,27,46,46,38,30,29,34,30,30,32,26,33,28,43,27,
+34,34,30,32,39,34,32,34,29,30,27,29,37,30,35,32,45,46,35,43,30,30,44,31,25,18,18,18,18,18,18,18,18,18,18,18,
+18,18,36,36,36,36,36,36,36,36,36,36,36,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+38,21,21,21,21,21,21,21,21,21,28,21,21,21,18,18,22,22,18,21,21,21,21,21,21,21,21,37,31,31,31,31,31,31,31,31,
+31,15,31,18,18,22,22,18,17,17,24,17,31,31,31,31,32,29,30,33,33,31,31,33,41,32,37,50,86,38,0,17,17,17,25,33,33,
+50,44,14,19,19,28,33,17,17,17,14,33,33,33,33,33,33,33,33,33,33,17,17,33,33,33,31,37,39,39,39,39,36,33,42,42,
+19,33,42,33,47,42,42,36,42,39,36,36,42,39,50,39,39,36,19,14,19,33,25,17,33,33,33,33,33,19,33,33,17,17,33,17,
+50,33,33,33,33,22,31,22,33,31,47,33,31,28,19,14,19,33,39,39,39,36,42,42,42,33,33,33,33,33,33,33,33,33,33,33,
+17,17,17,17,33,33,33,33,33,33,33,33,33,33,33,20,33,33,33,25,43,33,40,40,48,17,17,33,50,42,29,33,33,33,33,33,
+25,36,41,34,14,20,20,43,50,33,31,17,33,27,33,33,31,33,33,50,17,39,39,42,50,50,25,50,25,25,14,14,33,25,31,39,8,
+33,17,17,33,33,33,17,14,25,50,39,36,39,36,36,19,19,19,19,42,42,40,42,42,42,42,17,17,17,17,17,17,17,17,17,17,
+17,33,17,36,31,36,28,14,39,33,39,31,36,33,33,33,20,20,20,50,50,50,42,42,33,19,36,31,39,33,39,33,33,25,17,20,
+39,33,39,33,39,42,39,36,33,36,33,51,33,33,17,33,25,33,27,42,33,42,33,43,42,33,39,22,39,22,36,31,36,22,36,31,
+42,33,42,33,36,28,36,28,17,17,17,17,17,17,17,17,17,25,15,26,30,22,86,50,29,50,25,50,25,50,25,25,49,36,30,30,
+18,18,30,18,17,39,33,39,33,39,33,36,33,36,33,36,33,42,33,42,33,42,33,42,33,42,33,19,17,19,17,19,17,19,17,33,
+17,42,33,33,33,17,42,33,41,34,42,33,42,33,39,22,36,31,36,22,42,33,42,33,42,33,42,33,50,47,39,31,20,39,33,50,
+50,42,33,10,17,39,25,42,48,25,44,48,45,17,39,39,33,39,36,36,42,42,19,42,39,47,42,36,42,42,36,36,36,39,46,39,
+47,42,19,39,34,27,33,17,33,34,32,31,33,27,23,33,33,17,33,31,33,31,23,33,35,33,26,37,25,33,44,32,46,47,17,33,
+33,33,47,36,50,33,40,36,19,19,33,61,61,49,37,34,42,39,39,39,33,42,36,54,34,42,42,37,40,47,42,42,42,36,39,36,
+34,46,39,43,40,56,57,50,54,39,40,58,39,33,33,31,25,33,33,46,34,35,35,32,36,42,36,33,33,33,33,25,31,51,33,35,
+33,47,48,39,45,31,33,49,31,33,34,22,33,31,17,17,17,51,51,34,32,31,33,28,23,50,47,50,47,50,47,39,31,38,14,25,
+33,67,30,50,50,50,50,30,33,30,30,36,31,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,35,37,30,50,49,49,49,49,30,30,30,51,52,46,27,
+34,26,33,30,26,39,50,17,20,20,20,33,36,31,36,22,17,32,25,33,33,34,33,34,32,33,34,33,27,34,34,35,33,33,32,33,
+33,39,42,41,60,41,23,41,42,33,17,33,19,34,18,33,33,33,23,19,17,32,34,32,34,31,29,36,37,17,29,36,29,42,37,35,
+31,35,34,31,29,36,32,43,33,33,30,43,46,29,35,31,34,35,32,32,32,32,32,32,32,31,31,31,31,17,17,17,17,37,35,35,
+35,35,35,36,36,36,36,33,32,32,32,32,32,36,34,34,31,31,31,31,31,36,36,32,37,37,17,17,17,17,17,44,29,36,29,29,
+29,29,37,37,37,36,35,35,35,34,34,34,31,31,31,31,29,29,29,29,36,36,36,36,36,36,43,43,43,43,33,33,33,30,30,30,
+32,43,35,32,34,29,32,31,30,37,37,17,36,32,42,37,29,35,37,31,32,29,33,40,33,43,35,32,31,37,17,35,33,35,17,33,
+31,40,29,32,31,17,17,29,50,50,41,33,32,37,32,33,34,29,36,31,47,29,37,37,33,35,42,37,35,37,31,32,29,32,40,33,
+38,35,48,50,38,47,32,32,48,34,27,20,20,20,20,20,20,20,20,20,20,20,20,20,39,39,39,39,39,39,39,39,39,39,39,42,
+42,42,42,42,42,42,42,42,42,42,41,41,41,41,41,41,41,41,41,41,41,41,41,23,23,23,23,23,23,23,23,23,31,23,23,23,
+19,19,24,23,19,23,23,23,23,23,23,23,23,41,33,33,33,33,33,33,33,33,33,17,33,19,19,24,23,19,18,18,26,18,33,33,
+33,33,35,31,32,36,36,33,33,36,44,35,40,54,93,41,0,18,18,18,27,36,36,54,48,15,21,21,30,36,18,18,18,15,36,36,36,
+36,36,36,36,36,36,36,18,18,36,36,36,33,40,42,42,42,42,39,36,45,45,21,36,45,36,51,45,45,39,45,42,39,39,45,42,
+54,42,42,39,21,15,21,36,27,18,36,36,36,36,36,21,36,36,18,18,36,18,54,36,36,36,36,24,33,24,36,33,51,36,33,30,
+21,15,21,36,42,42,42,39,45,45,45,36,36,36,36,36,36,36,36,36,36,36,18,18,18,18,36,36,36,36,36,36,36,36,36,36,
+36,22,36,36,36,27,46,36,43,43,51,18,18,36,54,45,32,36,36,36,36,36,27,39,44,37,15,22,22,46,54,36,33,18,36,30,
+36,36,33,36,36,54,18,42,42,45,54,54,27,54,27,27,15,15,36,27,33,42,9,36,18,18,36,36,36,18,15,27,54,42,39,42,39,
+39,21,21,21,21,45,45,43,45,45,45,45,18,18,18,18,18,18,18,18,18,18,18,36,18,39,33,39,30,15,42,36,42,33,39,36,
+36,36,22,22,22,54,54,54,45,45,36,21,39,33,42,36,42,36,36,27,18,21,42,36,42,36,42,46,42,39,36,39,36,56,36,36,
+18,36,27,36,29,45,36,45,36,46,45,36,42,24,42,24,39,33,39,24,39,34,45,36,45,36,39,30,39,30,18,18,18,18,18,18,
+18,18,18,27,16,28,33,24,93,54,32,54,27,54,27,54,27,27,53,39,32,33,19,19,33,19,18,42,36,42,36,42,36,39,36,39,
+36,39,36,45,36,45,36,45,36,45,36,45,36,21,18,21,18,21,18,21,18,36,18,45,36,36,36,18,45,36,44,37,45,36,45,36,
+42,24,39,33,39,24,45,36,45,36,45,36,45,36,54,51,42,33,21,42,36,54,54,45,36,10,18,42,27,46,52,27,48,52,48,18,
+42,42,36,42,39,39,45,45,21,45,42,51,45,39,45,45,39,39,39,42,50,42,51,45,21,42,37,30,36,18,36,37,35,33,36,30,
+25,36,36,18,36,33,36,33,25,36,38,36,29,40,27,36,48,35,49,51,18,36,36,36,51,39,54,36,43,39,21,21,36,65,65,53,
+39,36,45,42,42,42,36,45,39,59,37,45,45,39,43,51,45,45,45,39,42,39,36,50,42,46,43,60,61,54,58,42,43,63,42,36,
+36,33,27,36,36,50,37,38,38,35,39,46,39,36,36,36,36,27,33,55,36,37,36,51,52,42,49,34,36,53,34,36,37,24,36,33,
+18,18,18,55,55,37,35,33,36,30,25,54,51,54,51,54,51,42,33,41,15,27,36,73,32,54,54,54,54,32,36,32,32,38,33,38,
+38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+38,38,38,38,38,38,38,38,39,32,54,53,53,53,53,32,32,32,55,57,50,30,36,29,36,32,28,42,54,18,22,22,22,36,39,33,
+39,24,18,35,27,36,35,37,36,37,34,36,37,36,29,36,36,37,36,36,34,36,36,42,45,45,65,45,24,44,45,36,18,36,21,36,
+20,36,36,36,24,21,18,35,37,35,37,33,31,39,40,19,32,39,32,45,40,38,34,38,37,34,32,39,35,46,35,35,32,46,50,32,
+38,34,37,37,35,35,35,35,35,35,35,33,33,33,33,19,19,19,19,40,38,38,38,38,38,39,39,39,39,35,35,35,35,35,35,39,
+37,37,33,33,33,33,33,39,39,35,40,40,19,19,19,19,19,48,32,39,32,32,32,32,40,40,40,39,38,38,38,37,37,37,34,34,
+34,34,32,32,32,32,39,39,39,39,39,39,46,46,46,46,35,35,35,32,32,32,35,46,38,35,37,31,35,33,32,40,40,19,39,35,
+45,40,31,38,40,34,35,32,35,44,35,47,38,35,33,40,19,38,35,38,19,35,33,44,31,35,34,19,19,32,54,54,44,35,34,40,
+35,36,37,31,39,33,51,32,40,40,35,37,45,40,38,40,34,35,32,34,44,35,41,38,52,54,42,51,35,35,51,37,29,22,22,22,
+22,22,22,22,22,22,22,22,22,22,42,42,42,42,42,42,42,42,42,42,42,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+45,45,45,45,45,45,45,45,45,24,24,24,24,24,24,24,24,24,33,24,24,24,21,21,25,25,21,24,24,24,24,24,24,24,24,44,
+36,36,36,36,36,36,36,36,36,18,36,21,21,25,25,21,20,20,28,20,36,36,36,36,37,34,35,39,39,36,36,39,48,37,43,58,
+100,44,0,19,19,19,29,38,39,58,52,16,23,23,32,38,19,19,19,16,39,39,39,39,39,39,39,39,39,39,19,19,38,38,38,35,
+43,45,45,45,45,42,39,48,48,23,39,48,39,55,48,48,42,48,45,42,42,48,45,58,45,45,42,23,16,23,38,29,19,39,39,39,
+39,39,23,39,39,19,19,39,19,58,39,39,39,39,26,35,26,39,35,55,39,35,32,23,16,23,38,45,45,45,42,48,48,48,39,39,
+39,39,39,39,39,39,39,39,39,19,19,19,19,39,39,39,39,39,39,39,39,39,39,39,23,39,39,39,29,49,39,46,46,55,19,19,
+38,58,48,34,38,38,38,39,39,29,41,48,40,16,23,23,50,58,39,35,19,38,32,39,38,35,39,39,58,19,45,45,48,58,58,29,
+58,29,29,16,16,38,29,35,45,10,39,19,19,39,39,39,19,16,29,58,45,42,45,42,42,23,23,23,23,48,48,46,48,48,48,48,
+19,19,19,19,19,19,19,19,19,19,19,39,19,42,35,42,32,16,45,39,45,35,42,39,38,38,23,23,23,58,58,58,48,48,39,23,
+42,35,45,39,45,39,39,29,19,23,45,39,45,39,45,49,45,42,39,42,39,60,39,39,19,39,29,39,31,48,39,48,39,50,48,39,
+45,26,45,26,42,35,42,26,42,36,48,39,48,39,42,32,42,32,19,19,19,19,19,19,19,19,19,29,18,30,35,25,100,58,34,58,
+29,58,29,58,29,29,57,42,35,35,21,21,35,21,19,45,39,45,39,45,39,42,39,42,39,42,39,48,39,48,39,48,39,48,39,48,
+39,23,19,23,19,23,19,23,19,39,19,48,39,39,39,19,48,39,47,40,48,39,48,39,45,26,42,35,42,26,48,39,48,39,48,39,
+48,39,58,55,45,35,23,45,39,58,58,48,39,11,19,45,29,49,56,29,51,56,52,19,45,45,39,45,42,42,48,48,23,48,45,55,
+48,42,48,48,42,42,42,45,54,45,55,48,23,45,39,32,39,19,39,39,37,35,39,32,27,39,39,19,39,35,39,35,27,39,41,39,
+31,43,29,39,52,38,53,55,19,39,39,39,55,42,58,39,46,42,23,23,39,70,70,57,42,39,48,45,45,45,39,49,42,63,40,48,
+48,42,47,55,48,48,48,42,45,42,39,54,45,50,47,64,66,58,63,45,46,67,45,39,39,36,29,38,39,54,39,41,41,37,42,49,
+41,39,39,39,39,29,35,59,39,40,38,55,56,45,53,36,39,57,36,39,39,26,39,35,19,19,19,59,59,39,37,35,39,32,27,58,
+55,58,55,58,55,45,35,44,16,29,39,78,35,58,58,58,58,35,38,35,35,41,36,41,41,41,41,41,41,41,41,41,41,41,41,41,
+41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,41,42,35,58,57,
+57,57,57,35,35,35,59,61,53,32,39,31,38,34,30,45,58,19,23,23,23,38,42,35,42,26,19,37,29,39,38,39,38,39,37,38,
+40,39,32,39,39,40,39,39,37,39,39,45,48,48,70,48,26,47,48,39,19,39,22,39,21,39,39,39,26,22,19,37,40,38,40,35,
+34,42,42,20,34,42,34,49,42,41,36,41,39,36,34,42,37,50,38,38,35,50,53,34,41,36,40,40,37,37,37,37,37,37,38,35,
+35,35,35,20,20,20,20,42,41,41,41,41,41,42,42,42,42,38,37,37,37,38,38,42,40,40,35,35,35,35,35,42,42,38,42,42,
+20,20,20,20,20,51,34,42,34,34,34,34,42,42,42,42,41,41,41,39,39,39,36,36,36,36,34,34,34,34,42,42,42,42,42,42,
+50,50,50,50,38,38,38,35,35,35,37,50,41,37,40,33,37,35,35,42,43,20,42,37,49,42,34,41,42,36,37,34,38,47,38,50,
+41,37,35,42,20,41,38,41,20,38,35,47,33,38,36,20,20,34,58,58,47,38,37,42,37,38,40,33,42,35,55,34,42,42,38,40,
+49,42,41,42,36,38,34,37,47,38,44,40,56,57,45,55,38,38,55,39,31,23,23,23,23,23,23,23,23,23,23,23,23,23,45,45,
+45,45,45,45,45,45,45,45,45,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,26,26,26,
+26,26,26,26,26,26,35,26,26,26,22,22,27,27,23,26,26,26,26,26,26,26,26,47,39,39,39,39,39,39,39,39,39,19,39,22,
+22,27,27,23,21,21,30,21,39,39,39,39,40,36,38,42,42,39,39,42,52,40,46,67,115,50,0,22,22,22,34,44,45,67,60,19,
+26,26,37,44,22,22,22,19,45,45,45,45,45,45,45,45,45,45,22,22,44,44,44,41,50,52,52,52,52,48,45,56,56,26,45,56,
+45,63,56,56,48,56,52,48,48,56,52,67,52,52,48,26,19,26,44,34,22,45,45,45,45,45,26,45,45,22,22,45,22,67,45,45,
+45,45,30,41,30,45,41,63,45,41,37,26,19,26,44,52,52,52,48,56,56,56,45,45,45,45,45,45,45,45,45,45,45,22,22,22,
+22,45,45,45,45,45,45,45,45,45,45,45,27,45,45,45,34,57,45,54,54,64,22,22,44,67,56,39,44,44,44,45,45,34,48,55,
+46,18,27,27,57,67,45,41,22,44,37,45,44,41,45,45,67,22,52,52,56,67,67,34,67,34,34,19,19,44,33,41,52,11,45,22,
+22,45,45,45,22,19,34,67,52,48,52,48,48,26,26,26,26,56,56,53,56,56,56,56,22,22,22,22,22,22,22,22,22,22,22,45,
+22,48,41,48,37,19,52,45,52,41,48,45,44,44,27,27,27,67,67,67,56,56,45,26,48,41,52,45,52,45,45,34,22,27,52,45,
+52,45,52,57,52,48,45,48,45,69,45,45,22,45,34,45,36,56,45,56,45,57,56,45,52,30,52,30,48,41,48,30,48,42,56,45,
+56,45,48,37,48,37,22,22,22,22,22,22,22,22,22,34,20,35,40,29,115,67,39,67,34,67,34,67,34,34,66,48,40,40,24,24,
+40,24,22,52,45,52,45,52,45,48,45,48,45,48,45,56,45,56,45,56,45,56,45,56,45,26,22,26,22,26,22,26,22,45,22,56,
+45,45,45,22,56,45,55,46,56,45,56,45,52,30,48,41,48,30,56,45,56,45,56,45,56,45,67,63,52,41,26,52,45,67,67,56,
+45,13,22,52,34,57,64,34,59,65,60,22,52,52,45,52,48,48,56,56,26,56,52,63,56,48,56,56,48,48,48,52,62,52,63,56,
+26,52,45,37,45,22,45,45,43,41,45,37,31,45,45,22,45,41,45,41,31,45,47,45,35,50,34,45,60,43,61,63,22,45,45,45,
+63,48,67,45,53,48,26,26,45,81,81,65,49,45,56,52,52,52,45,56,48,73,46,56,56,49,54,63,56,56,56,48,52,48,45,62,
+52,58,54,74,76,67,73,52,53,78,52,45,45,41,34,44,45,62,45,47,47,43,48,57,48,45,45,45,45,34,41,68,45,46,44,64,
+64,52,61,42,45,65,42,45,45,30,45,41,22,22,22,68,69,45,43,41,45,37,31,67,63,67,63,67,63,52,41,50,19,34,45,90,
+40,67,67,67,67,40,44,40,40,48,42,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,47,49,40,67,66,66,66,66,40,40,40,68,70,62,37,45,36,
+44,40,34,52,67,22,27,27,27,44,48,41,48,30,22,43,34,45,44,45,44,46,43,44,46,45,36,45,45,46,45,45,42,45,45,52,
+56,56,81,56,30,55,56,45,22,45,26,45,24,45,45,45,30,26,22,43,46,43,46,41,39,48,49,23,39,49,39,56,49,47,42,47,
+46,42,39,49,43,58,44,44,40,57,62,39,47,42,46,46,43,43,43,43,43,43,43,41,41,41,41,23,23,23,23,49,47,47,47,47,
+47,49,49,49,49,44,43,43,43,43,43,48,46,46,41,41,41,41,41,48,48,43,49,49,23,23,23,23,23,59,39,49,39,39,39,39,
+49,49,49,48,47,47,47,46,46,46,42,42,42,42,39,39,39,39,49,49,49,49,49,49,58,58,58,58,44,44,44,40,40,40,43,57,
+47,43,46,39,43,41,40,49,50,23,49,43,56,49,39,47,49,42,43,39,44,54,44,58,47,43,41,49,23,47,44,47,23,44,41,54,
+39,43,42,23,23,39,66,67,55,44,42,49,43,44,46,39,48,41,63,39,49,49,44,46,56,49,47,49,42,43,39,42,54,44,51,47,
+65,66,52,63,43,43,64,46,36,27,27,27,27,27,27,27,27,27,27,27,27,27,52,52,52,52,52,52,52,52,52,52,52,56,56,56,
+56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,56,30,30,30,30,30,30,30,30,30,41,30,30,30,26,26,
+32,31,26,30,30,30,30,30,30,30,30,55,45,45,45,45,45,45,45,45,45,22,45,26,26,32,31,26,24,24,34,24,45,45,45,45,
+46,42,43,48,48,45,45,48,60,46,54,75,129,56,0,25,25,25,38,50,50,75,67,21,29,29,42,50,25,25,25,21,50,50,50,50,
+50,50,50,50,50,50,25,25,50,50,50,46,56,58,58,58,58,54,50,62,62,29,50,62,50,71,62,62,54,62,58,54,54,62,58,75,
+58,58,54,29,21,29,50,38,25,50,50,50,50,50,29,50,50,25,25,50,25,75,50,50,50,50,33,46,33,50,46,71,50,46,42,29,
+21,29,50,58,58,58,54,62,62,62,50,50,50,50,50,50,50,50,50,50,50,25,25,25,25,50,50,50,50,50,50,50,50,50,50,50,
+30,50,50,50,38,64,50,60,60,71,25,25,50,75,62,44,50,50,50,50,50,38,53,62,52,20,30,30,64,75,50,46,25,50,41,50,
+50,46,50,50,75,25,58,58,62,75,75,38,75,38,38,21,21,50,37,46,58,13,50,25,25,50,50,50,25,21,38,75,58,54,58,54,
+54,29,29,29,29,62,62,59,62,62,62,62,25,25,25,25,25,25,25,25,25,25,25,50,25,54,46,54,42,21,58,50,58,46,54,50,
+50,50,30,30,30,75,75,75,63,62,50,29,54,46,58,50,58,50,50,38,25,30,58,50,58,50,58,63,58,54,50,54,50,77,50,50,
+25,50,38,50,40,62,50,62,50,64,62,50,58,33,58,33,54,46,54,33,54,47,62,50,62,50,54,42,54,42,25,25,25,25,25,25,
+25,25,25,38,23,39,45,33,129,75,44,75,38,75,38,75,38,38,73,54,45,45,27,27,45,27,25,58,50,58,50,58,50,54,50,54,
+50,54,50,62,50,62,50,62,50,62,50,62,50,29,25,29,25,29,25,29,25,50,25,62,50,50,50,25,62,50,61,51,62,50,62,50,
+58,33,54,46,54,33,62,50,62,50,62,50,62,50,75,71,58,46,29,58,50,75,75,62,50,14,25,58,38,63,72,38,66,73,67,25,
+58,58,50,58,54,54,62,62,29,62,58,71,62,54,62,62,54,54,54,58,69,58,71,62,29,58,51,41,50,25,50,51,48,46,50,41,
+35,50,50,25,50,46,50,46,35,50,53,50,40,56,38,50,67,49,69,71,25,50,50,50,71,54,75,50,60,54,29,29,50,91,91,73,
+55,50,62,58,58,58,50,63,54,81,52,62,62,55,60,71,62,62,62,54,58,54,50,69,58,64,60,83,85,75,81,58,60,87,58,50,
+50,46,38,50,50,69,51,53,53,48,54,63,53,50,50,50,50,38,46,76,50,52,50,71,72,58,68,47,50,73,47,50,51,33,50,46,
+25,25,25,76,77,51,48,46,50,42,35,75,71,75,71,75,71,58,46,56,21,38,50,101,45,75,75,75,75,45,50,45,45,53,47,53,
+53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,53,
+53,53,53,53,53,53,53,53,55,45,75,74,74,74,74,45,45,45,77,79,69,41,50,40,50,44,38,58,75,25,30,30,30,50,54,46,
+54,33,25,48,38,50,49,51,50,51,48,49,51,50,41,50,51,52,50,50,48,50,50,59,62,62,90,62,34,61,62,50,25,50,29,50,
+27,50,50,50,34,29,25,48,52,49,51,46,44,54,55,26,44,55,44,63,55,52,47,52,51,47,44,55,48,64,49,49,45,64,69,44,
+52,47,51,52,48,48,48,48,48,48,49,46,46,46,46,26,26,26,26,55,52,52,52,52,52,55,55,55,55,49,48,48,48,49,49,54,
+51,51,46,46,46,46,46,54,54,49,55,55,26,26,26,26,26,66,44,55,44,44,44,44,55,55,55,54,52,52,52,51,51,51,47,47,
+47,47,44,44,44,44,55,55,55,55,55,55,64,64,64,64,49,49,49,45,45,45,48,64,52,48,52,43,48,46,45,55,56,26,55,48,
+63,55,43,52,55,47,48,44,49,61,49,65,52,48,46,55,26,52,49,52,26,49,46,61,43,49,47,26,26,44,74,75,61,49,47,55,
+48,49,52,43,54,46,71,44,55,55,49,52,63,55,52,55,47,49,44,47,61,49,57,52,73,74,58,71,49,49,71,51,40,30,30,30,
+30,30,30,30,30,30,30,30,30,30,59,59,59,59,59,59,59,59,59,59,59,62,62,62,62,62,62,62,62,62,62,62,62,62,62,62,
+62,62,62,62,62,62,62,62,62,34,34,34,34,34,34,34,34,34,46,34,34,34,29,29,35,35,29,34,34,34,34,34,34,34,34,61,
+50,50,50,50,50,50,50,50,50,25,50,29,29,35,35,29,27,27,39,27,50,50,50,50,52,47,49,54,54,50,50,54,67,52,60,83,
+143,62,0,28,28,28,42,55,55,83,74,23,32,32,46,55,28,28,28,23,55,55,55,55,55,55,55,55,55,55,28,28,55,55,55,51,
+61,65,65,65,65,60,55,69,69,32,55,69,55,78,69,69,60,69,65,60,60,69,65,83,65,65,60,32,23,32,55,42,28,55,55,55,
+55,55,32,55,55,28,28,55,28,83,55,55,55,55,37,51,37,55,51,78,55,51,46,32,23,32,55,65,65,65,60,69,69,69,55,55,
+55,55,55,55,55,55,55,55,55,28,28,28,28,55,55,55,55,55,55,55,55,55,55,55,33,55,55,55,42,71,55,66,66,79,28,28,
+55,83,69,48,55,55,55,55,55,42,59,68,57,23,33,33,71,83,55,51,28,55,46,55,55,51,55,55,83,28,65,65,69,83,83,42,
+83,42,42,23,23,55,41,51,65,14,55,28,28,55,55,55,28,23,42,83,65,60,65,60,60,32,32,32,32,69,69,66,69,69,69,69,
+28,28,28,28,28,28,28,28,28,28,28,55,28,60,51,60,46,23,65,55,65,51,60,55,55,55,33,33,33,83,83,83,69,69,55,32,
+60,51,65,55,65,55,55,42,28,33,65,55,65,55,65,70,65,60,55,60,55,85,55,55,28,55,42,55,44,69,55,69,55,71,69,55,
+65,37,65,37,60,51,60,37,60,52,69,55,69,55,60,46,60,46,28,28,28,28,28,28,28,28,28,42,25,43,50,36,143,83,49,83,
+42,83,42,83,42,42,81,60,50,50,29,29,50,29,28,65,55,65,55,65,55,60,55,60,55,60,55,69,55,69,55,69,55,69,55,69,
+55,32,28,32,28,32,28,32,28,55,28,69,55,55,55,28,69,55,68,57,69,55,69,55,65,37,60,51,60,37,69,55,69,55,69,55,
+69,55,83,78,65,51,32,65,55,83,83,69,55,16,28,65,42,70,79,42,74,80,74,28,65,65,55,65,60,60,69,69,32,69,65,78,
+69,60,69,69,60,60,60,65,77,65,79,69,32,65,56,45,55,28,55,56,53,51,55,45,38,55,55,28,55,51,55,51,38,55,59,55,
+44,62,42,55,74,54,76,79,28,55,55,55,79,60,83,55,66,60,32,32,55,100,100,81,61,56,69,65,65,65,55,70,60,90,57,69,
+69,61,67,78,69,69,69,60,65,60,56,77,65,71,67,92,94,83,90,64,66,96,65,55,55,51,42,55,55,77,56,59,59,53,59,70,
+59,55,55,55,55,42,51,84,55,57,55,79,80,64,75,52,55,81,52,55,56,37,55,51,28,28,28,84,85,56,53,51,55,46,39,83,
+78,83,78,83,78,65,51,62,23,42,55,112,50,83,83,83,83,50,55,50,50,59,51,59,59,59,59,59,59,59,59,59,59,59,59,59,
+59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,59,61,50,83,82,
+82,82,82,50,50,50,85,87,76,46,56,44,55,49,42,64,83,28,33,33,33,55,60,51,60,37,28,53,42,55,54,56,55,56,53,55,
+57,55,45,56,56,57,56,55,53,55,55,65,69,69,100,69,37,68,69,55,28,55,32,56,30,55,55,55,37,32,28,53,57,54,57,51,
+48,60,61,29,49,60,49,70,61,58,52,58,56,52,49,60,53,71,54,54,50,71,76,49,58,52,57,57,53,53,53,53,53,53,54,51,
+51,51,51,29,29,29,29,61,58,58,58,58,58,60,60,60,60,54,53,53,53,54,54,60,57,57,51,51,51,51,51,60,60,54,61,61,
+29,29,29,29,29,73,49,60,49,49,49,49,61,61,61,60,58,58,58,56,56,56,52,52,52,52,49,49,49,49,60,60,60,60,60,60,
+71,71,71,71,54,54,54,50,50,50,53,71,58,53,57,48,53,51,50,61,61,29,60,53,70,61,48,58,61,52,53,49,54,67,54,72,
+58,53,51,61,29,58,54,58,29,54,51,67,48,54,52,29,29,49,82,83,68,54,52,61,53,55,57,48,60,51,78,49,61,61,54,57,
+70,61,58,61,52,54,49,52,67,54,63,58,80,82,64,78,54,54,79,56,45,33,33,33,33,33,33,33,33,33,33,33,33,33,65,65,
+65,65,65,65,65,65,65,65,65,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,37,37,37,
+37,37,37,37,37,37,51,37,37,37,32,32,39,39,32,37,37,37,37,37,37,37,37,68,55,55,55,55,55,55,55,55,55,28,55,32,
+32,39,39,32,30,30,43,30,55,55,55,55,57,52,54,60,60,55,55,60,74,57,66,92,158,69,0,31,31,31,46,61,61,92,82,26,
+36,36,51,61,31,31,31,26,61,61,61,61,61,61,61,61,61,61,31,31,61,61,61,56,68,72,72,72,72,66,61,77,77,36,61,77,
+61,87,77,77,66,77,72,66,66,77,72,92,72,72,66,36,26,36,61,46,31,61,61,61,61,61,36,61,61,31,31,61,31,92,61,61,
+61,61,41,56,41,61,56,87,61,56,51,36,26,36,61,72,72,72,66,77,77,77,61,61,61,61,61,61,61,61,61,61,61,31,31,31,
+31,61,61,61,61,61,61,61,61,61,61,61,37,61,61,61,46,78,61,74,74,87,31,31,61,92,77,54,61,61,61,61,61,46,66,76,
+63,25,37,37,79,92,61,56,31,61,51,61,61,56,61,61,92,31,72,72,77,92,92,46,92,46,46,26,26,61,45,56,72,15,61,31,
+31,61,61,61,31,26,46,92,72,66,72,66,66,36,36,36,36,77,77,73,77,77,77,77,31,31,31,31,31,31,31,31,31,31,31,61,
+31,66,56,66,51,26,72,61,72,56,66,61,61,61,37,37,37,92,92,92,77,77,61,36,66,56,72,61,72,61,61,46,31,36,72,61,
+72,61,72,78,72,66,61,66,61,95,61,61,31,61,46,61,49,77,61,77,61,79,77,61,72,41,72,41,66,56,66,41,66,58,77,61,
+77,61,66,51,66,51,31,31,31,31,31,31,31,31,31,46,28,48,56,40,158,92,54,92,46,92,46,92,46,46,90,66,55,56,33,33,
+56,33,31,72,61,72,61,72,61,66,61,66,61,66,61,77,61,77,61,77,61,77,61,77,61,36,31,36,31,36,31,36,31,61,31,77,
+61,61,61,31,77,61,75,63,77,61,77,61,72,41,66,56,66,41,77,61,77,61,77,61,77,61,92,87,72,56,36,72,61,92,92,77,
+61,17,31,72,46,78,88,46,82,89,82,31,72,72,61,72,66,66,77,77,36,77,72,87,77,66,77,77,66,66,66,72,85,72,87,77,
+36,72,62,50,61,31,61,62,59,56,61,50,42,61,61,31,61,56,61,56,42,61,65,61,49,69,47,61,82,60,84,87,31,61,61,61,
+87,66,92,61,73,66,36,36,61,111,111,90,67,62,77,72,72,72,61,77,66,100,63,77,77,67,74,87,77,77,77,66,72,66,62,
+85,72,79,74,102,105,92,100,71,73,107,72,61,61,57,47,61,61,85,62,65,65,59,66,78,66,61,61,61,61,47,56,93,61,63,
+61,87,89,71,84,57,61,90,57,61,62,41,61,56,31,31,31,93,94,62,59,56,61,51,43,92,87,92,87,92,87,72,56,69,26,46,
+61,124,55,92,92,92,92,55,61,55,55,65,57,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,
+65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,65,67,55,92,91,91,91,91,55,55,55,94,97,85,51,
+62,49,61,54,47,71,92,31,37,37,37,61,66,56,66,41,31,59,47,61,60,62,61,63,59,61,63,61,50,62,62,64,62,61,58,61,
+61,72,77,76,111,76,42,75,77,61,31,61,35,62,33,61,61,61,42,35,31,59,63,60,63,56,53,66,67,32,54,67,54,77,67,64,
+58,64,62,57,54,67,59,79,60,60,55,79,85,54,64,58,63,64,59,59,59,59,59,59,60,56,56,56,56,32,32,32,32,67,64,64,
+64,64,64,67,67,67,67,60,59,59,59,60,60,66,63,63,56,56,56,56,56,66,66,60,67,67,32,32,32,32,32,81,54,67,54,54,
+54,54,67,67,67,66,64,64,64,62,62,62,57,57,57,57,54,54,54,54,67,67,67,67,67,67,79,79,79,79,60,60,60,55,55,55,
+59,79,64,59,63,53,59,56,55,67,68,32,67,59,77,67,53,64,67,58,59,54,60,74,60,80,64,59,56,67,32,64,60,64,32,60,
+56,74,53,60,57,32,32,54,91,92,75,60,58,67,59,61,63,53,66,56,87,54,67,67,60,64,77,67,64,67,58,60,54,58,74,60,
+69,64,89,91,71,87,60,60,88,62,49,37,37,37,37,37,37,37,37,37,37,37,37,37,72,72,72,72,72,72,72,72,72,72,72,77,
+77,77,77,77,77,77,77,77,77,77,76,76,76,76,76,76,76,76,76,76,76,76,76,42,42,42,42,42,42,42,42,42,56,42,42,42,
+35,35,43,43,36,42,42,42,42,42,42,42,42,75,61,61,61,61,61,61,61,61,61,31,61,35,35,43,43,36,33,33,47,33,61,61,
+61,61,64,57,60,66,66,61,61,66,82,64,74,100,172,75,0,33,33,33,50,66,67,100,89,28,39,39,56,66,33,33,33,28,67,67,
+67,67,67,67,67,67,67,67,33,33,66,66,66,61,74,78,78,78,78,72,67,83,83,39,67,83,67,94,83,83,72,83,78,72,72,83,
+78,100,78,78,72,39,28,39,66,50,33,67,67,67,67,67,39,67,67,33,33,67,33,100,67,67,67,67,44,61,44,67,61,94,67,61,
+56,39,28,39,66,78,78,78,72,83,83,83,67,67,67,67,67,67,67,67,67,67,67,33,33,33,33,67,67,67,67,67,67,67,67,67,
+67,67,40,67,67,67,50,85,67,80,80,95,33,33,66,100,83,58,66,66,66,67,67,50,71,82,69,27,40,40,85,100,67,61,33,66,
+55,67,66,61,67,67,100,33,78,78,83,100,100,50,100,50,50,28,28,66,49,61,78,17,67,33,33,67,67,67,33,28,50,100,78,
+72,78,72,72,39,39,39,39,83,83,79,83,83,83,83,33,33,33,33,33,33,33,33,33,33,33,67,33,72,61,72,56,28,78,67,78,
+61,72,67,66,66,40,40,40,100,100,100,83,83,67,39,72,61,78,67,78,67,67,50,33,40,78,67,78,67,78,84,78,72,67,72,
+67,103,67,67,33,67,50,67,53,83,67,83,67,86,83,67,78,44,78,44,72,61,72,44,72,63,83,67,83,67,72,56,72,56,33,33,
+33,33,33,33,33,33,33,50,30,52,60,44,172,100,59,100,50,100,50,100,50,50,98,72,60,60,35,35,60,35,33,78,67,78,67,
+78,67,72,67,72,67,72,67,83,67,83,67,83,67,83,67,83,67,39,33,39,33,39,33,39,33,67,33,83,67,67,67,33,83,67,81,
+68,83,67,83,67,78,44,72,61,72,44,83,67,83,67,83,67,83,67,100,94,78,61,39,78,67,100,100,83,67,19,33,78,50,85,
+96,50,89,97,89,33,78,78,67,78,72,72,83,83,39,83,78,94,83,72,83,83,72,72,72,78,92,78,95,83,39,78,68,55,67,33,
+67,68,64,61,67,55,46,67,67,33,67,61,67,61,46,67,71,67,53,75,51,67,89,65,92,95,33,67,67,67,95,72,100,67,80,72,
+39,39,67,121,121,98,73,67,83,78,78,78,67,84,72,109,69,83,83,73,80,94,83,83,83,72,78,72,67,92,78,86,80,111,114,
+100,108,77,80,116,78,67,67,62,51,66,67,92,68,71,71,64,72,85,71,67,67,67,67,51,61,101,67,69,66,95,96,77,91,62,
+67,98,62,67,68,44,67,61,33,33,33,101,102,68,64,61,67,56,47,100,94,100,94,100,94,78,61,75,28,50,67,135,60,100,
+100,100,100,60,66,60,60,71,62,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,73,60,100,99,99,99,99,60,60,60,102,105,92,55,67,53,
+66,59,51,77,100,33,40,40,40,66,72,61,72,44,33,64,51,67,66,68,66,68,64,66,68,67,54,67,67,69,67,66,63,67,66,78,
+83,83,121,83,45,81,83,67,33,67,38,67,36,67,67,67,45,38,33,64,69,65,68,61,58,72,73,35,59,73,59,84,73,70,63,70,
+68,62,59,73,64,86,65,66,60,86,92,59,70,63,68,69,64,64,64,64,64,64,65,61,61,61,61,35,35,35,35,73,70,70,70,70,
+70,73,73,73,73,66,64,64,64,65,65,72,68,68,61,61,61,61,61,72,72,65,73,73,35,35,35,35,35,88,59,73,59,59,59,59,
+73,73,73,72,70,70,70,68,68,68,62,62,62,62,59,59,59,59,73,73,73,73,73,73,86,86,86,86,66,66,66,60,60,60,64,86,
+70,64,69,57,64,61,60,73,74,35,73,64,84,73,58,70,73,63,64,59,66,81,65,87,70,64,61,73,35,70,66,70,35,66,61,81,
+57,65,62,35,35,59,99,100,82,65,63,73,64,66,69,57,72,61,94,59,73,73,65,69,84,73,70,73,63,65,59,63,81,65,75,70,
+97,99,77,94,65,65,95,68,54,40,40,40,40,40,40,40,40,40,40,40,40,40,78,78,78,78,78,78,78,78,78,78,78,83,83,83,
+83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,45,45,45,45,45,45,45,45,45,61,45,45,45,38,38,
+47,47,39,45,45,45,45,45,45,45,45,81,67,67,67,67,67,67,67,67,67,33,67,38,38,47,47,39,36,36,51,36,67,67,67,67,
+69,62,65,72,72,67,67,72,89,69,80,0,0,0,2,0,1,0,0,0,0,0,20,0,3,0,1,0,0,1,26,0,0,1,6,0,0,1,0,0,0,0,0,0,0,1,2,2,
+0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,
+28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,
+64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,0,98,99,
+100,101,102,103,104,105,106,107,108,109,110,111,112,113,114,115,116,117,118,119,120,121,122,123,124,125,126,
+127,128,129,130,131,132,133,134,135,136,137,138,139,140,141,142,143,144,145,146,147,148,149,150,151,152,153,
+154,0,156,157,158,159,160,161,162,163,164,165,166,167,168,169,170,171,172,173,174,175,176,177,178,179,180,181,
+182,183,184,185,186,187,188,189,190,191,192,193,194,0,196,197,198,199,200,201,202,203,204,205,206,207,208,209,
+0,211,212,213,214,215,216,217,0,219,220,221,222,223,224,225,0,4,5,42,0,0,0,194,0,128,0,6,0,66,0,126,1,127,1,
+146,1,255,2,27,2,199,2,201,2,221,3,126,3,138,3,140,3,161,3,206,4,12,4,79,4,92,4,95,4,145,30,133,30,243,32,21,
+32,30,32,34,32,38,32,48,32,51,32,58,32,60,32,62,32,68,32,117,32,120,32,127,32,164,32,167,32,172,32,190,33,5,
+33,19,33,22,33,34,33,38,33,46,33,94,33,149,33,168,34,2,34,6,34,15,34,18,34,21,34,26,34,31,34,41,34,43,34,72,
+34,97,34,101,35,2,35,16,35,33,37,0,37,2,37,12,37,16,37,20,37,24,37,28,37,36,37,44,37,52,37,60,37,108,37,128,
+37,132,37,136,37,140,37,147,37,161,37,172,37,178,37,186,37,188,37,196,37,203,37,207,37,217,37,230,38,60,38,64,
+38,66,38,96,38,99,38,102,38,107,251,2,255,255,0,0,0,32,0,160,1,146,1,250,2,24,2,198,2,201,2,216,3,126,3,132,3,
+140,3,142,3,163,4,1,4,14,4,81,4,94,4,144,30,128,30,242,32,19,32,23,32,32,32,38,32,48,32,50,32,57,32,60,32,62,
+32,68,32,116,32,119,32,127,32,163,32,167,32,172,32,184,33,5,33,19,33,22,33,34,33,38,33,46,33,91,33,144,33,168,
+34,2,34,6,34,15,34,17,34,21,34,25,34,30,34,41,34,43,34,72,34,96,34,100,35,2,35,16,35,32,37,0,37,2,37,12,37,16,
+37,20,37,24,37,28,37,36,37,44,37,52,37,60,37,80,37,128,37,132,37,136,37,140,37,144,37,160,37,170,37,178,37,
+186,37,188,37,196,37,202,37,207,37,216,37,230,38,58,38,64,38,66,38,96,38,99,38,101,38,106,251,1,255,255,255,
+227,0,0,255,20,255,152,0,133,0,0,254,17,0,0,252,160,254,20,254,19,254,18,254,17,253,223,253,222,253,221,253,
+220,253,172,227,190,227,82,0,0,0,0,0,0,224,133,224,150,225,9,224,133,225,1,226,10,224,120,0,0,226,35,224,191,
+0,0,224,152,224,17,227,71,224,59,224,46,225,52,223,106,223,121,225,29,224,241,223,178,223,160,222,150,222,162,
+222,139,0,0,222,167,0,0,0,0,223,33,222,113,222,95,0,0,222,48,223,78,223,65,223,50,221,84,221,83,221,74,221,71,
+221,68,221,65,221,62,221,55,221,48,221,41,221,34,221,15,220,252,220,249,220,246,220,243,220,240,0,0,0,0,220,
+212,220,205,220,204,220,197,0,0,219,128,220,179,219,106,220,83,220,80,220,79,220,50,220,48,220,47,220,44,5,
+191,0,1,0,0,0,192,0,0,0,0,0,0,2,120,0,0,2,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,106,2,110,2,
+124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,114,0,0,0,0,2,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2,84,0,0,2,84,2,86,0,0,0,0,0,0,2,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,2,42,2,44,0,0,0,0,0,0,0,0,2,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,172,0,163,0,132,
+0,133,2,156,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,0,16,0,138,1,2,0,131,0,147,0,242,0,243,0,141,0,
+151,0,136,1,3,0,222,0,241,0,158,0,170,0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,
+203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,
+212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,
+117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,161,0,127,0,126,0,128,0,129,0,236,0,
+238,0,186,1,82,1,83,1,5,1,6,1,7,1,8,0,253,0,254,1,84,1,85,1,86,1,87,0,255,1,0,1,9,1,10,1,11,1,1,1,88,1,89,1,
+90,1,91,1,92,1,93,1,12,1,13,1,14,1,15,1,94,1,95,0,248,0,249,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,
+1,105,1,106,1,107,1,108,1,109,1,110,1,111,0,250,0,215,1,16,1,17,1,112,1,113,1,114,1,115,1,116,1,18,1,19,1,117,
+1,118,1,20,1,21,1,22,1,23,0,226,0,227,1,24,1,25,1,119,1,120,1,26,1,27,1,28,1,121,1,122,1,123,1,124,1,125,1,
+126,1,29,1,30,0,176,0,177,1,31,1,32,1,127,1,128,1,33,1,34,1,35,1,36,1,129,1,130,0,251,0,252,0,228,0,229,1,37,
+1,38,1,39,1,40,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,41,1,42,1,43,1,44,1,139,1,140,1,141,1,142,1,
+143,1,144,0,187,1,45,1,46,1,47,1,48,0,230,0,231,1,145,0,216,0,225,0,219,0,220,0,221,0,224,0,217,0,223,0,178,0,
+179,2,70,1,58,0,182,0,183,0,196,2,71,0,180,0,181,0,197,0,130,0,194,0,135,1,4,2,153,0,247,2,73,0,153,0,239,0,
+195,0,165,0,146,1,73,0,143,1,75,2,132,1,76,1,77,1,78,2,133,0,185,2,138,64,61,92,89,84,83,72,65,54,53,52,51,50,
+49,48,47,46,45,44,43,42,41,40,39,38,37,36,35,34,33,32,31,30,29,28,27,26,25,24,23,22,21,20,19,18,17,16,15,14,
+13,12,11,10,9,8,7,6,5,4,3,2,1,0,44,1,176,24,67,88,177,25,7,43,27,33,33,33,89,45,44,1,176,24,67,88,177,26,7,43,
+27,33,33,33,89,45,44,1,176,24,67,88,176,3,37,16,242,33,176,0,18,27,33,35,17,51,89,45,44,1,176,24,67,88,177,27,
+7,43,27,33,33,33,89,45,44,1,176,24,67,88,177,28,7,43,27,33,33,33,89,45,44,1,176,24,67,88,177,29,7,43,27,33,33,
+33,89,45,44,1,176,24,67,88,177,30,7,43,27,33,33,33,89,45,44,78,176,0,20,176,70,35,67,68,176,3,37,16,177,0,70,
+230,176,0,19,176,1,20,176,0,16,242,33,176,1,19,77,176,0,18,45,44,1,176,24,67,88,69,100,106,35,69,105,176,25,
+67,100,96,96,176,70,35,68,35,16,32,176,70,240,47,176,0,18,27,33,33,33,33,89,45,44,1,177,11,10,67,35,67,101,10,
+45,44,0,177,10,11,67,35,67,11,45,44,0,176,70,35,112,177,1,70,62,1,176,70,35,112,177,2,70,69,58,177,2,0,8,13,
+45,44,176,18,43,176,2,37,69,176,2,37,69,106,176,64,139,96,176,2,37,35,68,33,33,33,45,44,176,19,43,176,2,37,69,
+176,2,37,69,106,184,255,192,140,96,176,2,37,35,68,33,33,33,45,44,176,0,176,18,43,33,33,33,45,44,176,0,176,19,
+43,33,33,33,45,44,1,176,6,67,176,7,67,101,10,45,44,32,105,176,64,97,176,0,139,32,177,44,192,138,140,184,16,0,
+98,96,43,12,100,35,100,97,92,88,176,3,97,89,45,44,177,0,3,37,69,104,84,88,176,3,37,69,176,3,37,69,96,104,32,
+176,4,37,35,68,176,4,37,35,68,27,176,3,37,32,69,104,32,138,35,68,176,3,37,69,104,96,176,3,37,35,68,89,45,44,
+176,3,37,32,69,104,32,138,35,68,176,3,37,69,104,96,176,3,37,35,68,45,44,176,9,67,88,135,33,192,27,176,18,67,
+88,135,69,176,17,43,176,71,35,68,176,71,122,228,27,3,138,69,24,105,32,176,71,35,68,138,138,135,32,176,160,81,
+88,176,17,43,176,71,35,68,176,71,122,228,27,33,176,71,122,228,89,89,89,24,45,44,32,138,69,35,69,104,96,68,45,
+44,69,106,66,45,44,1,24,47,45,44,33,33,45,44,1,176,2,37,69,176,2,37,69,100,96,106,176,3,37,69,106,97,32,176,4,
+37,69,106,32,138,139,101,176,4,37,35,68,140,176,3,37,35,68,33,33,45,44,1,69,104,35,69,105,176,64,139,97,176,3,
+37,69,106,97,32,176,4,37,69,106,32,138,139,101,176,4,37,35,68,140,176,3,37,35,68,33,33,45,44,1,138,138,69,100,
+35,69,100,97,100,66,45,44,1,176,2,37,67,176,64,84,176,2,37,67,176,0,84,90,88,176,3,37,32,69,176,64,97,68,89,
+176,2,37,67,176,0,84,176,2,37,67,176,64,84,90,88,176,4,37,32,69,176,64,96,68,89,33,33,33,33,45,44,1,75,82,88,
+67,176,2,37,69,35,97,68,27,33,33,89,45,44,1,75,82,88,67,176,2,37,69,35,96,68,27,33,33,89,45,44,75,82,88,69,68,
+27,33,33,89,45,44,1,32,176,3,37,35,73,176,64,96,176,32,99,32,176,0,82,88,35,176,2,37,56,35,176,2,37,101,56,0,
+138,99,56,27,33,33,33,33,33,89,1,45,44,75,80,88,69,68,27,33,33,89,45,44,1,176,5,37,16,35,32,138,245,0,176,1,
+96,35,237,236,45,44,1,176,5,37,16,35,32,138,245,0,176,1,97,35,237,236,45,44,1,176,6,37,16,245,0,237,236,45,44,
+70,35,70,96,138,138,70,35,32,70,138,96,138,97,184,255,128,98,35,32,16,35,138,177,75,75,138,112,69,96,32,176,0,
+80,88,176,1,97,184,255,186,139,27,176,70,140,89,176,16,96,104,1,58,45,44,32,69,176,3,37,70,82,88,63,27,33,17,
+89,45,44,32,69,176,3,37,70,80,88,63,27,33,17,89,45,44,0,176,7,67,176,6,67,11,45,44,75,82,88,176,4,37,176,4,37,
+73,176,4,37,176,4,37,73,97,32,176,0,84,88,33,32,67,176,0,85,88,89,27,176,64,84,88,32,67,176,0,84,88,89,27,32,
+67,176,0,84,88,27,176,3,37,184,255,192,56,89,89,89,89,33,33,33,33,45,44,75,82,88,67,101,56,27,33,33,89,45,44,
+75,82,88,67,56,27,33,33,89,45,44,33,33,12,100,35,100,139,184,64,0,98,45,44,33,176,128,81,88,12,100,35,100,139,
+184,32,0,98,27,178,0,64,47,43,89,176,2,96,45,44,33,176,192,81,88,12,100,35,100,139,184,21,85,98,27,178,0,128,
+47,43,89,176,2,96,45,44,12,100,35,100,139,184,64,0,98,96,35,33,45,44,180,0,1,0,0,0,21,176,8,38,176,8,38,176,8,
+38,176,8,38,15,16,22,19,69,104,58,176,1,22,45,44,180,0,1,0,0,0,21,176,8,38,176,8,38,176,8,38,176,8,38,15,16,
+22,19,69,104,101,58,176,1,22,45,44,176,19,67,88,3,27,2,89,45,44,176,19,67,88,2,27,3,89,45,44,176,10,43,35,16,
+32,60,176,23,43,45,44,176,40,43,138,16,35,32,208,35,176,16,43,176,5,67,88,192,27,60,89,32,16,17,176,0,18,1,45,
+44,75,83,35,75,81,90,88,56,27,33,33,89,45,44,176,2,67,84,88,75,83,35,75,81,90,88,56,27,33,33,89,27,33,33,33,
+33,89,45,44,75,83,35,75,81,90,88,56,27,33,33,89,45,44,176,18,0,75,1,75,84,66,45,44,177,2,0,66,177,35,1,136,81,
+177,64,1,136,83,90,88,185,16,0,0,32,136,84,88,178,2,1,2,67,96,66,89,177,36,1,136,81,88,185,32,0,0,64,136,84,
+88,178,2,2,2,67,96,66,177,36,1,136,84,88,178,2,32,2,67,96,66,0,75,1,75,82,88,178,2,8,2,67,96,66,89,27,185,64,
+0,0,128,136,84,88,178,2,4,2,67,96,66,89,185,64,0,0,128,99,184,1,0,136,84,88,178,2,8,2,67,96,66,89,185,64,0,1,
+0,99,184,2,0,136,84,88,178,2,16,2,67,96,66,89,177,38,1,136,81,88,185,64,0,2,0,99,184,4,0,136,84,88,178,2,64,2,
+67,96,66,89,185,64,0,4,0,99,184,8,0,136,84,88,178,2,128,2,67,96,66,89,89,89,89,89,89,177,0,2,67,84,88,64,10,5,
+64,8,64,9,64,12,2,13,2,27,177,1,2,67,84,88,178,5,64,8,186,1,0,0,9,1,0,179,12,1,13,1,27,177,128,2,67,82,88,178,
+5,64,8,184,1,128,177,9,64,27,178,5,64,8,186,1,128,0,9,1,64,89,185,64,0,0,128,136,85,185,64,0,2,0,99,184,4,0,
+136,85,90,88,179,12,0,13,1,27,179,12,0,13,1,89,89,89,66,66,66,66,66,45,44,176,128,176,2,67,80,176,1,176,2,67,
+84,91,88,33,35,16,176,32,26,201,27,138,16,237,89,45,44,176,2,67,176,2,83,88,75,83,35,75,81,90,88,56,27,33,33,
+89,27,33,33,33,33,89,45,64,30,30,120,22,29,119,22,28,118,22,27,117,22,26,116,22,25,115,22,207,110,207,111,2,
+143,110,128,111,2,112,22,184,8,0,64,29,29,108,111,22,23,28,108,111,23,27,111,108,127,108,2,108,111,25,107,110,
+22,27,107,110,127,114,26,106,20,184,8,0,64,255,29,102,105,20,21,28,102,105,21,27,143,102,1,102,105,25,101,104,
+20,27,32,183,80,183,128,183,176,183,224,183,5,31,101,1,101,104,133,113,26,153,67,250,33,151,67,250,33,147,67,
+250,33,145,67,250,33,141,67,250,33,139,67,250,33,137,67,250,33,135,67,250,33,133,67,250,33,131,67,250,33,129,
+67,250,33,127,67,250,33,125,67,250,33,50,206,204,12,31,205,204,19,31,148,204,1,36,204,1,171,202,1,122,121,100,
+31,173,133,50,31,167,176,12,31,175,176,50,31,177,176,50,31,15,176,1,169,135,50,31,144,129,50,31,143,129,50,31,
+128,184,1,155,92,20,31,153,92,20,31,151,93,17,31,149,93,17,31,147,92,17,31,145,92,17,31,181,133,42,31,182,127,
+42,31,141,87,8,31,139,87,23,31,137,87,23,31,135,88,23,31,133,88,23,31,131,88,23,31,128,125,128,127,128,129,3,
+129,87,17,31,127,87,17,31,125,87,17,31,207,88,223,88,2,99,97,17,31,98,97,17,31,50,93,91,17,31,92,91,17,31,88,
+86,18,31,87,86,18,31,63,86,1,64,157,97,85,13,31,96,85,13,31,50,91,85,13,31,86,85,13,31,27,55,21,24,54,21,21,
+53,21,18,52,21,15,51,21,12,50,21,9,49,21,6,48,21,3,47,21,0,46,21,44,45,15,42,43,14,40,41,15,38,39,14,36,37,15,
+34,35,14,32,33,15,31,4,255,31,30,3,255,31,27,28,29,13,24,25,26,13,21,22,23,13,18,19,20,13,15,16,17,12,12,13,
+14,12,9,10,11,12,6,7,8,12,3,4,5,12,0,1,2,12,15,15,1,63,15,95,15,127,15,175,15,4,16,9,1,79,0,79,3,79,6,3,27,59,
+8,31,15,58,8,31,3,57,8,31,0,56,8,31,80,51,84,43,1,176,18,75,0,75,84,66,176,19,1,75,0,75,83,66,176,51,43,75,
+184,8,0,82,176,50,43,75,176,9,80,91,88,177,1,1,142,89,176,51,43,176,2,136,184,1,0,84,176,4,136,184,2,0,84,176,
+18,67,90,91,88,184,1,25,177,1,1,142,133,27,176,18,67,88,185,0,1,1,128,133,141,27,185,0,1,1,128,133,141,89,89,
+43,29,176,120,75,83,88,176,112,29,89,176,60,75,83,88,176,144,29,89,0,43,43,43,43,115,115,115,116,43,43,43,43,
+43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,1,178,85,128,85,69,105,139,68,43,0,
+43,43,43,43,115,1,43,43,0,43,43,43,43,43,115,1,43,43,43,115,43,43,43,43,43,43,43,43,0,43,43,43,43,43,43,115,
+43,43,43,115,43,43,43,43,43,115,115,115,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,1,43,115,115,43,43,
+115,43,43,43,24,43,43,43,115,43,43,43,115,115,176,24,176,50,75,83,66,43,43,43,43,43,43,177,9,50,43,75,176,100,
+82,66,5,186,0,25,0,64,5,186,0,25,0,64,5,186,0,25,0,0,4,112,0,24,0,66,4,61,0,21,0,0,4,38,0,24,0,106,0,0,255,
+231,0,0,0,0,255,232,0,0,0,0,255,231,0,0,254,108,255,229,0,0,5,186,0,25,254,105,255,232,5,211,0,0,2,249,255,
+239,5,211,0,0,2,229,255,236,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,8,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,19,1,151,1,198,1,
+151,0,0,0,0,1,19,1,84,1,19,0,0,0,0,1,151,0,0,1,192,1,143,0,0,0,138,0,73,0,5,255,119,255,183,255,251,0,171,0,
+93,0,5,255,84,255,162,255,251,2,170,3,29,0,0,0,0,0,0,0,0,0,0,0,0,0,121,0,124,0,0,0,0,1,197,0,0,1,198,1,115,1,
+192,1,114,1,152,0,0,1,151,1,94,1,143,1,53,1,148,0,0,1,156,0,0,1,24,0,0,1,231,1,165,1,84,0,223,1,104,0,122,1,
+19,0,205,1,63,1,42,1,19,0,211,1,76,0,187,0,37,0,88,1,112,0,80,0,172,0,195,1,141,1,4,0,139,0,152,1,20,1,50,1,
+108,1,24,1,84,1,179,1,152,1,46,1,72,1,67,1,67,0,248,0,171,0,184,1,221,1,254,2,185,0,182,0,139,0,182,0,221,0,
+239,0,250,1,4,1,14,1,24,1,34,1,44,1,59,1,74,1,84,0,200,0,230,0,240,0,250,1,9,1,19,1,29,1,39,1,59,1,78,1,99,1,
+129,1,210,1,222,2,15,2,30,1,142,1,125,1,197,1,163,1,239,1,129,1,94,1,114,1,183,1,64,0,0,0,20,0,20,0,20,0,20,0,
+71,0,110,1,67,2,83,2,249,3,160,3,196,3,249,4,4,4,130,4,181,4,228,4,252,5,23,5,60,5,154,5,209,6,56,6,236,7,71,
+7,196,8,62,8,121,9,32,9,160,9,201,10,6,10,76,10,113,10,124,10,233,11,193,12,51,12,162,12,252,13,59,13,126,13,
+186,14,27,14,79,14,112,14,166,15,37,15,69,15,181,16,11,16,94,16,152,17,27,17,142,18,52,18,86,18,150,18,237,19,
+183,20,20,20,97,20,168,20,201,20,212,20,230,21,16,21,38,21,67,21,219,22,57,22,153,22,254,23,102,23,189,24,76,
+24,151,24,191,25,3,25,125,25,152,26,7,26,79,26,150,26,252,27,94,27,162,28,99,28,181,28,240,29,80,29,229,30,58,
+30,198,31,13,31,137,31,160,31,171,31,232,32,1,32,158,32,180,32,203,32,226,32,251,33,20,33,43,33,66,33,91,33,
+116,33,139,33,164,33,186,33,211,33,234,34,3,34,28,34,52,34,74,34,96,34,120,34,143,34,166,34,189,34,214,34,239,
+35,6,35,29,35,52,35,77,35,102,35,149,35,206,36,126,37,36,37,235,38,13,38,66,38,204,39,116,40,22,40,133,40,163,
+40,197,41,40,41,143,42,22,42,125,42,195,43,27,43,38,43,176,43,251,44,104,44,209,45,42,45,90,45,182,46,41,46,
+103,46,222,47,179,48,88,48,104,48,121,48,150,48,237,49,145,50,17,50,84,50,154,50,165,50,181,50,181,50,204,50,
+227,50,250,51,125,52,24,52,44,52,64,52,100,52,136,52,182,52,228,53,36,53,147,53,172,53,197,53,232,54,153,54,
+191,54,202,55,69,55,174,55,243,56,8,56,55,56,91,57,62,57,85,57,108,57,131,57,156,57,179,57,202,57,225,57,250,
+58,17,58,40,58,63,58,63,58,86,58,109,58,132,58,155,58,182,58,229,59,38,59,58,59,115,59,136,59,192,59,253,60,
+60,60,107,60,152,60,225,61,34,61,57,61,80,61,103,61,126,61,162,61,255,62,136,62,159,62,182,62,247,63,78,63,
+100,63,206,63,251,64,80,64,217,64,238,65,4,65,26,65,140,65,163,65,186,65,209,65,231,65,253,66,20,66,45,66,68,
+66,91,66,209,66,218,66,239,67,54,67,77,67,100,67,122,67,144,67,180,67,205,67,213,67,235,68,1,68,24,68,47,68,
+121,68,223,68,246,69,15,69,40,69,63,69,85,69,107,69,130,69,153,69,176,69,199,70,53,70,78,70,103,70,126,70,149,
+70,172,70,195,70,220,70,243,71,9,71,31,71,54,71,79,71,104,71,129,71,162,71,197,71,220,71,245,72,12,72,35,72,
+35,72,35,72,35,72,35,72,35,72,35,72,35,72,35,72,35,72,71,72,97,72,139,72,234,73,45,73,83,73,231,74,40,74,67,
+74,95,74,123,74,149,74,192,74,235,75,30,75,46,75,88,75,114,75,135,75,149,75,171,75,197,75,235,76,17,76,40,76,
+63,76,86,76,109,76,132,76,155,76,178,76,201,76,224,76,247,77,14,77,37,77,60,77,83,77,106,77,129,77,148,77,172,
+77,195,77,218,78,49,78,152,78,175,78,197,78,220,78,242,79,9,79,31,79,98,79,174,79,197,80,35,80,54,80,73,80,
+171,80,190,80,208,80,227,80,246,81,77,81,156,81,179,81,202,81,225,81,248,82,11,82,30,82,53,82,76,82,145,82,
+242,83,9,83,32,83,55,83,78,83,101,83,124,83,214,84,48,84,71,84,94,84,117,84,140,84,183,84,206,84,242,85,9,85,
+32,85,55,85,78,85,105,85,166,85,188,85,210,85,233,86,0,86,22,86,43,86,65,86,86,86,112,86,120,86,128,86,161,86,
+242,86,250,87,2,87,10,87,99,87,107,87,115,87,179,87,187,87,195,88,13,88,21,88,58,88,66,88,126,88,134,88,142,
+89,3,89,11,89,103,89,200,89,225,89,250,90,17,90,40,90,63,90,86,90,113,90,211,91,58,91,151,91,244,92,127,92,
+203,93,12,93,94,93,102,93,200,94,22,94,82,94,90,94,200,94,208,95,17,95,84,95,183,96,31,96,84,96,134,96,239,97,
+78,97,158,98,22,98,46,98,71,98,94,98,117,98,140,98,165,99,13,99,36,99,131,99,139,99,147,99,172,99,180,100,20,
+100,115,100,182,100,205,101,77,101,128,101,136,101,202,101,210,101,243,102,69,102,77,102,212,103,74,103,154,
+104,0,104,91,104,151,104,159,104,167,104,175,104,212,104,220,104,228,104,236,105,72,105,189,105,197,105,247,
+106,45,106,98,106,162,106,223,106,247,107,51,107,140,107,246,108,1,108,9,108,117,108,222,109,1,109,83,109,91,
+109,234,110,82,110,152,111,7,111,103,111,163,112,16,112,65,112,73,112,110,112,118,112,126,112,176,112,184,113,
+61,113,69,113,128,113,187,113,240,114,49,114,121,114,152,114,214,115,60,115,178,116,16,116,41,116,141,116,164,
+117,9,117,17,117,25,117,49,117,57,117,160,118,2,118,86,118,109,119,9,119,82,119,121,119,160,119,183,119,206,
+119,229,119,252,120,21,120,46,120,69,120,92,120,112,120,158,120,178,121,76,121,215,122,6,122,32,122,58,122,84,
+122,110,122,137,122,167,122,200,122,233,122,247,123,5,123,21,123,37,123,53,123,69,123,88,123,107,123,126,123,
+145,123,169,123,189,123,209,123,231,123,253,124,23,124,44,124,66,124,93,124,114,124,136,124,163,124,184,124,
+205,124,231,124,255,125,25,125,59,125,83,125,108,125,141,125,167,125,191,125,224,125,250,126,18,126,51,126,85,
+126,120,126,166,126,180,126,194,126,208,126,222,126,236,127,163,130,150,131,206,131,220,131,233,131,247,132,5,
+132,19,132,33,132,75,132,104,132,152,132,250,133,71,133,166,133,224,134,36,134,87,134,150,134,188,134,214,135,
+2,135,50,135,111,135,229,136,28,136,159,137,52,137,74,137,96,137,118,137,140,137,163,137,223,138,8,138,97,138,
+111,138,167,138,181,138,189,138,203,138,211,138,226,138,234,138,242,138,250,139,2,139,10,139,18,139,26,139,34,
+139,42,139,50,139,183,140,19,140,80,140,174,140,236,141,24,141,73,141,178,142,11,142,46,142,97,142,146,143,2,
+143,46,143,133,143,229,144,70,144,78,144,86,144,94,144,148,144,240,145,62,145,118,145,180,145,230,146,67,146,
+114,146,135,146,187,146,238,147,10,147,64,147,106,147,178,147,236,148,97,148,185,149,92,149,128,149,177,149,
+217,150,23,150,89,150,133,150,178,151,13,151,135,151,192,152,44,152,107,152,185,153,27,153,51,153,74,153,98,
+153,122,153,148,153,160,153,172,153,196,153,219,153,243,154,13,154,36,154,58,154,80,154,104,154,128,154,152,
+154,175,154,198,154,221,154,246,155,14,155,37,155,61,155,87,155,110,155,133,155,156,155,168,155,191,155,214,
+155,237,156,5,156,13,156,37,156,60,156,83,156,95,156,119,156,142,156,154,156,177,156,201,157,35,157,57,157,79,
+157,101,157,112,157,135,157,147,157,171,157,191,157,214,157,234,158,1,158,29,158,52,158,72,158,96,158,177,158,
+200,158,223,158,248,159,15,159,35,159,59,159,82,159,105,159,117,159,140,159,160,159,173,159,196,159,254,160,
+21,160,44,160,67,160,92,160,117,160,129,160,152,160,176,160,199,160,224,160,247,161,16,161,40,161,63,161,86,
+161,109,161,141,161,165,161,188,161,196,161,204,161,233,162,16,162,24,162,32,162,40,162,131,162,139,162,147,
+162,186,162,194,162,202,163,12,163,20,163,52,163,60,163,113,163,121,163,129,163,252,164,4,164,81,164,187,164,
+210,164,233,165,0,165,22,165,45,165,68,165,91,165,115,165,140,165,166,166,3,166,26,166,138,166,146,166,154,
+166,178,166,186,167,24,167,111,167,186,167,209,167,232,168,23,168,31,168,99,168,107,168,136,168,209,168,217,
+169,115,169,233,170,19,170,42,170,131,170,188,170,196,170,204,170,212,170,220,170,228,170,236,170,244,171,55,
+171,178,171,186,171,232,172,33,172,77,172,136,172,201,172,213,173,15,173,121,173,219,174,49,174,83,174,92,174,
+101,174,110,174,119,174,128,174,137,174,146,174,155,174,164,174,173,175,29,175,144,175,214,175,238,176,5,176,
+29,176,53,176,79,176,105,176,129,176,153,176,165,176,200,176,208,176,232,176,255,177,23,177,49,177,73,177,97,
+177,121,177,133,177,157,177,165,177,191,177,214,177,237,178,1,178,24,178,48,178,71,178,97,178,121,178,145,178,
+169,178,195,178,220,178,232,179,0,179,23,179,47,179,73,179,97,179,121,179,133,179,157,179,165,179,189,179,215,
+179,223,179,249,180,17,180,28,180,51,180,71,180,147,180,171,180,194,180,218,180,244,181,12,181,36,181,48,181,
+72,181,92,181,116,181,139,181,162,181,185,181,210,181,236,182,3,182,26,182,38,182,87,182,107,182,131,182,142,
+182,161,182,181,183,2,183,21,183,40,183,63,183,129,183,152,183,175,183,200,183,224,184,144,184,163,184,186,
+184,209,184,254,185,129,185,250,186,189,186,253,187,75,187,178,0,0,0,2,0,0,0,0,4,0,5,0,0,3,0,7,0,0,49,17,33,
+17,37,33,17,33,4,0,252,32,3,192,252,64,5,0,251,0,32,4,192,0,0,2,0,124,0,0,2,47,5,186,0,5,0,9,0,52,64,30,0,3,
+15,4,1,4,4,6,173,9,18,3,4,9,0,1,1,8,133,0,9,9,11,133,104,8,10,9,101,2,43,43,47,51,253,50,47,47,17,57,57,0,63,
+253,50,47,93,63,49,48,19,33,17,3,33,3,19,33,17,33,124,1,179,84,254,243,82,15,1,150,254,106,5,186,254,178,253,
+97,2,159,252,251,254,153,255,255,0,48,3,159,3,207,5,186,0,38,0,10,219,0,1,7,0,10,1,228,0,0,0,51,64,24,1,240,
+11,1,11,64,18,19,54,63,11,95,11,176,11,3,11,64,9,10,54,11,0,0,184,255,192,64,9,20,24,54,64,0,128,0,2,0,1,47,
+93,43,53,47,43,93,43,93,53,0,0,2,0,60,255,232,5,5,5,211,0,27,0,31,1,57,64,147,182,22,1,150,31,166,7,184,8,3,4,
+14,4,31,20,14,20,31,4,18,19,10,26,17,15,19,10,27,16,21,20,9,26,17,29,20,9,27,16,22,23,6,26,17,28,23,6,27,16,
+25,24,5,26,17,0,24,5,27,16,14,19,10,2,13,11,19,10,3,12,30,20,9,2,13,8,20,9,3,12,31,23,6,2,13,7,23,6,3,12,1,24,
+5,2,13,4,24,5,3,12,9,20,20,167,19,10,20,19,19,10,6,23,23,167,24,5,20,24,24,5,13,2,167,12,15,3,31,3,176,3,207,
+3,4,3,3,10,9,6,5,4,16,27,167,17,64,26,1,26,184,255,192,179,15,17,54,26,184,255,192,64,44,9,11,54,192,26,1,26,
+26,19,20,23,24,19,16,12,20,19,9,12,19,3,31,10,1,15,10,79,10,2,15,10,31,10,63,10,3,175,10,207,10,2,10,2,26,184,
+255,192,64,21,13,15,54,26,6,5,23,26,5,3,16,24,1,0,24,32,24,128,24,3,24,47,93,114,23,51,47,51,47,43,60,47,93,
+93,113,114,23,51,47,51,47,60,0,63,60,60,60,51,47,93,43,43,113,60,253,60,63,60,60,60,51,47,93,60,253,60,135,5,
+46,43,125,16,196,135,46,24,43,125,16,196,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,15,49,48,1,93,93,93,19,
+55,35,17,33,19,33,3,51,19,33,3,51,17,35,7,51,17,33,3,33,19,35,3,33,19,35,17,33,51,55,35,253,52,245,1,44,71,1,
+29,73,219,72,1,28,70,137,193,51,244,254,213,71,254,227,70,218,72,254,229,73,140,1,221,219,52,218,2,92,253,1,
+20,1,102,254,154,1,102,254,154,254,236,253,254,236,254,160,1,96,254,160,1,96,1,20,253,0,0,3,0,54,255,43,5,14,
+6,42,0,39,0,46,0,53,1,119,185,0,25,255,232,64,28,19,26,54,2,24,17,26,54,45,28,52,52,159,6,45,20,6,6,45,16,28,
+1,128,28,208,28,2,28,184,255,240,179,28,29,54,28,184,255,240,64,38,22,25,54,100,28,116,6,148,28,182,28,4,52,6,
+28,45,4,47,35,64,9,10,54,35,48,1,1,1,1,4,40,145,37,35,34,4,16,23,184,255,192,64,33,9,11,54,144,23,1,23,23,26,
+47,145,14,16,17,19,16,43,80,43,144,43,3,128,43,208,43,2,50,64,28,29,54,43,184,255,192,64,9,28,29,54,50,64,21,
+26,54,43,184,255,192,64,9,21,26,54,50,64,12,14,54,43,184,255,192,64,9,12,14,54,31,16,11,11,54,23,184,255,192,
+64,19,17,26,54,1,64,17,29,54,52,6,28,45,4,9,31,15,53,5,36,184,255,192,64,11,21,23,54,36,16,27,46,47,35,1,35,
+184,255,192,64,32,9,14,54,35,35,43,1,64,9,14,54,1,131,0,64,24,25,54,0,50,131,0,128,9,159,9,176,9,207,9,4,9,
+184,255,192,179,13,14,54,9,184,255,192,180,10,11,54,9,23,184,255,192,64,17,9,14,54,23,131,159,22,1,22,43,131,
+22,9,144,31,1,31,47,93,51,51,237,47,93,237,43,47,43,43,93,51,237,47,43,237,43,17,57,47,43,113,60,60,60,221,43,
+60,60,60,17,18,23,57,43,43,43,43,43,43,43,43,43,113,114,0,63,51,60,253,50,50,125,47,24,93,43,47,63,51,60,253,
+50,50,124,47,93,24,47,43,17,23,57,93,43,43,113,114,135,14,46,43,135,14,125,196,49,48,0,43,43,1,5,38,38,39,17,
+4,23,22,21,20,14,2,7,21,35,53,46,3,39,37,22,22,23,17,46,2,53,52,54,55,53,51,21,22,22,5,6,6,21,20,22,23,19,54,
+54,53,52,38,39,4,226,254,140,28,45,52,1,48,102,135,97,151,170,123,146,147,183,133,72,18,1,148,18,61,70,202,
+169,124,249,246,146,224,237,253,161,64,50,51,63,146,85,79,67,97,4,97,59,71,55,28,254,223,81,90,121,186,109,
+182,122,55,5,189,189,13,69,122,141,100,47,99,88,34,1,97,56,82,181,130,178,239,13,99,99,14,184,60,21,62,42,44,
+65,22,253,40,19,87,54,47,79,34,0,5,0,99,255,181,7,157,5,211,0,3,0,17,0,33,0,47,0,63,0,138,64,86,0,1,2,2,180,3,
+0,20,3,3,0,22,179,14,14,30,179,1,0,8,7,60,179,38,38,52,179,44,25,2,3,25,0,1,1,48,56,2,0,3,64,3,80,3,3,3,3,26,
+18,48,178,63,34,143,34,2,34,34,56,178,41,64,15,19,54,41,65,41,111,2,26,178,48,11,128,11,2,11,11,18,178,4,64,4,
+108,2,43,47,237,51,47,93,237,43,47,43,237,51,47,93,237,17,18,57,47,93,51,17,18,57,47,51,0,63,60,63,237,51,47,
+237,63,60,60,237,51,47,237,135,5,46,43,135,125,196,49,48,1,51,1,35,1,52,54,54,51,50,22,21,20,6,35,34,38,38,37,
+20,23,22,51,50,55,54,53,52,39,38,35,34,7,6,1,52,54,54,51,50,22,21,20,6,35,34,38,38,37,20,23,22,51,50,55,54,53,
+52,39,38,35,34,7,6,5,64,211,252,177,209,254,112,89,183,125,184,212,212,184,125,183,89,1,25,40,26,50,50,25,40,
+40,25,50,50,26,40,3,8,88,184,124,185,212,212,185,124,184,88,1,25,40,25,50,50,26,40,40,26,50,50,25,40,5,211,
+249,226,4,157,102,184,99,210,175,176,210,99,184,101,124,56,37,37,56,124,123,57,36,36,56,252,109,103,183,100,
+211,175,175,211,100,183,101,124,56,36,36,56,124,124,57,36,37,56,0,3,0,153,255,232,6,201,5,211,0,37,0,48,0,58,
+0,150,64,37,0,4,1,102,15,1,34,21,38,3,44,57,4,36,49,1,5,0,7,11,55,0,0,15,44,149,27,4,55,149,8,15,22,57,18,1,
+30,184,255,240,64,52,12,13,54,4,1,34,57,11,36,4,0,38,41,49,21,47,24,41,128,143,30,1,15,30,64,30,95,30,159,30,
+4,30,30,24,8,7,0,128,1,1,60,47,128,24,24,52,131,18,59,18,108,2,43,47,237,51,47,237,17,51,47,237,51,51,18,57,
+47,93,113,237,17,18,57,57,17,57,18,23,57,17,57,43,93,0,63,60,237,63,237,18,57,47,17,57,57,18,23,57,17,23,57,
+93,49,48,1,113,1,5,6,6,7,23,22,23,7,38,38,39,6,7,6,35,32,36,53,52,54,55,38,38,53,52,54,51,50,22,21,20,6,6,7,
+22,23,54,1,54,54,53,52,38,35,34,6,21,20,3,6,6,21,20,22,51,50,55,38,5,27,1,62,25,46,42,153,28,44,219,60,129,51,
+106,106,147,187,254,219,254,226,168,191,80,60,238,242,247,232,71,100,129,107,116,31,254,66,79,86,72,63,62,78,
+35,84,55,126,101,109,136,130,2,201,71,88,106,72,105,18,25,252,32,84,30,70,32,44,244,174,125,223,77,97,143,74,
+156,202,192,134,75,138,86,85,107,92,62,1,70,43,101,45,47,65,72,49,62,254,38,59,84,47,73,114,85,100,0,0,1,0,85,
+3,159,1,235,5,186,0,5,0,37,64,23,4,4,0,3,3,4,2,133,80,5,160,5,2,48,5,96,5,112,5,144,5,4,5,47,93,93,237,57,57,
+0,63,51,47,49,48,19,33,21,3,33,3,85,1,150,64,254,236,66,5,186,242,254,215,1,41,0,0,1,0,112,254,81,2,205,5,211,
+0,13,0,48,64,30,152,13,166,3,2,38,2,102,3,119,9,135,9,4,8,33,0,31,0,8,178,1,7,7,5,128,80,11,1,11,47,93,253,50,
+47,60,253,60,0,63,63,49,48,1,93,93,1,51,2,7,6,21,16,19,35,2,2,53,52,18,1,207,254,131,58,49,238,254,194,157,
+165,5,211,254,222,246,209,237,254,55,254,29,1,19,1,189,244,253,1,200,255,255,0,80,254,81,2,173,5,211,0,71,0,
+11,3,29,0,0,192,0,64,0,0,1,0,177,2,246,3,185,5,211,0,36,0,125,64,22,34,4,31,9,4,0,24,16,20,27,13,5,30,17,23,
+23,10,30,30,0,4,32,184,255,192,64,49,20,23,54,166,9,1,17,16,14,18,54,9,10,17,16,27,34,20,4,13,5,1,23,0,31,24,
+30,16,16,10,1,24,24,30,32,10,1,10,10,1,30,30,1,112,0,128,0,2,0,47,93,51,51,47,47,51,47,93,17,57,47,17,18,57,
+47,17,18,57,17,57,18,23,57,17,57,18,57,43,93,43,0,63,51,47,60,51,47,60,18,23,57,17,23,57,49,48,1,51,7,6,7,54,
+55,54,55,55,23,7,6,7,22,23,23,7,39,38,39,6,7,7,39,55,54,55,38,39,39,55,23,22,23,38,39,1,197,221,18,6,19,38,12,
+42,22,139,69,154,42,83,56,33,104,180,74,16,36,39,13,75,185,112,47,45,46,75,155,72,139,22,87,19,5,5,211,151,55,
+70,19,7,23,10,66,211,32,8,3,44,36,113,135,135,29,84,92,21,135,135,113,47,33,4,14,25,211,63,10,52,84,41,0,0,1,
+0,127,0,187,4,194,4,255,0,11,0,51,64,27,240,9,1,9,2,2,5,0,177,9,6,11,240,11,1,11,6,6,3,8,176,2,11,223,9,1,9,
+47,93,51,60,253,60,50,47,47,93,0,47,60,51,253,60,50,47,47,93,49,48,19,33,17,33,17,33,17,33,17,33,17,33,127,1,
+127,1,67,1,129,254,127,254,189,254,129,3,126,1,129,254,127,254,188,254,129,1,127,0,1,0,124,254,100,2,47,1,148,
+0,10,0,48,64,27,6,10,5,28,0,173,10,18,5,9,6,6,10,9,9,2,133,10,10,12,133,104,8,11,10,101,2,43,43,47,237,57,47,
+17,51,47,18,57,0,63,237,63,18,57,49,48,19,33,17,20,6,7,39,54,54,55,35,124,1,179,154,186,95,116,87,5,208,1,148,
+254,177,185,214,82,178,54,107,73,0,1,0,45,1,121,2,125,2,180,0,3,0,20,64,10,0,177,3,2,0,3,64,3,2,3,47,113,47,0,
+47,253,49,48,19,33,17,33,45,2,80,253,176,2,180,254,197,0,0,1,0,124,0,0,2,47,1,152,0,3,0,27,64,16,0,173,3,18,2,
+133,3,3,5,133,104,8,4,3,101,2,43,43,47,237,0,63,237,49,48,19,33,17,33,124,1,179,254,77,1,152,254,104,0,1,0,1,
+255,232,2,63,5,211,0,3,0,45,64,24,0,1,2,2,180,3,0,20,3,3,0,1,0,7,2,3,25,0,112,1,1,1,2,3,47,51,47,93,51,0,63,
+60,63,60,135,5,46,43,135,125,196,49,48,1,51,1,35,1,111,208,254,144,206,5,211,250,21,0,0,2,0,84,255,231,5,2,5,
+211,0,18,0,31,0,78,64,57,7,15,134,5,134,12,3,214,5,214,12,246,17,3,54,14,70,14,184,1,200,1,4,55,3,56,13,2,29,
+153,3,7,22,153,13,25,26,137,15,10,63,10,143,10,3,10,33,10,111,2,19,137,0,32,0,108,2,43,47,237,43,47,93,237,0,
+63,237,63,237,93,49,48,1,93,93,113,19,16,0,33,50,30,2,23,22,21,16,0,33,34,38,39,38,2,37,16,22,51,50,54,54,53,
+16,38,35,34,6,84,1,45,1,52,148,190,120,69,21,41,254,242,254,182,185,228,73,53,59,1,148,99,94,62,91,43,99,99,
+101,90,2,227,1,162,1,78,73,117,129,86,164,178,254,113,254,142,118,114,81,1,25,169,254,232,205,87,188,199,1,36,
+201,205,0,1,0,167,0,0,3,239,5,211,0,10,0,60,185,0,7,255,240,64,33,13,15,54,11,3,1,3,7,155,6,16,17,17,54,6,6,2,
+10,7,2,24,10,2,6,6,1,139,63,2,223,2,2,2,47,93,237,51,47,17,57,0,63,63,18,57,47,43,237,57,93,43,49,48,1,17,33,
+17,6,6,7,17,54,54,55,3,239,254,100,100,187,141,208,230,65,5,211,250,45,3,209,76,94,43,1,78,67,188,138,0,0,1,0,
+54,0,0,4,252,5,211,0,29,0,107,185,0,18,255,248,64,21,13,14,54,3,26,24,5,4,28,14,13,13,10,153,18,7,28,155,1,24,
+22,184,255,240,64,42,13,15,54,103,14,1,121,5,1,28,3,26,5,24,5,22,1,0,0,7,137,15,22,63,22,143,22,3,22,31,22,
+111,2,13,137,14,14,1,30,1,108,2,43,47,51,47,237,43,47,93,237,51,47,17,18,23,57,93,93,43,0,63,237,63,237,51,47,
+57,17,23,57,43,49,48,33,33,54,18,37,54,54,53,52,38,35,34,6,7,37,62,2,51,50,22,22,21,20,6,7,6,6,7,33,4,252,251,
+58,21,213,1,37,179,100,99,75,78,99,17,254,104,24,128,233,206,215,239,137,157,207,123,83,56,2,124,181,1,63,217,
+133,138,62,67,95,98,124,33,172,193,103,98,203,126,134,244,146,85,68,55,0,0,1,0,72,255,231,5,3,5,211,0,46,0,
+217,185,0,5,255,240,64,15,13,15,54,19,8,13,14,54,36,44,10,38,35,27,38,184,255,192,179,17,17,54,38,184,255,192,
+64,41,9,12,54,38,153,64,33,80,33,128,33,144,33,176,33,192,33,224,33,7,33,33,27,1,0,0,119,4,1,44,153,4,7,23,24,
+24,27,153,19,25,15,184,255,248,179,13,15,54,7,184,255,240,179,12,15,54,23,184,255,240,64,10,12,15,54,201,10,1,
+10,15,36,35,184,255,192,64,48,22,23,54,0,35,128,35,144,35,3,35,35,30,24,41,137,7,64,15,21,54,7,7,30,137,15,15,
+63,15,143,15,3,15,48,15,111,2,0,137,1,1,24,137,23,47,23,108,2,43,47,237,51,47,237,43,47,93,237,51,47,43,237,
+17,18,57,47,93,43,51,17,57,93,43,43,43,0,63,237,51,47,57,63,237,93,51,47,57,17,57,47,93,237,43,43,18,57,18,57,
+17,57,43,49,48,0,43,1,37,54,36,51,32,4,21,20,6,7,22,23,22,22,21,20,6,6,35,34,38,38,39,37,22,22,51,50,54,53,52,
+38,35,34,7,19,22,51,50,54,53,52,38,35,34,6,1,223,254,127,48,1,17,250,1,31,1,0,104,105,85,45,73,81,134,252,205,
+200,231,149,40,1,151,24,101,78,82,109,105,90,48,84,21,34,19,80,107,80,70,72,90,4,18,69,184,196,214,162,95,154,
+58,21,28,45,147,102,128,235,127,94,181,137,54,123,95,120,100,102,112,24,1,35,5,102,70,67,80,87,0,2,0,42,0,0,5,
+43,5,211,0,10,0,13,0,120,64,43,12,13,13,141,2,3,20,2,2,3,7,1,155,13,5,13,13,10,100,12,1,12,3,7,10,18,24,3,1,7,
+3,12,7,4,9,139,12,112,10,208,10,2,10,184,255,192,64,29,28,30,54,128,10,144,10,192,10,240,10,4,32,10,112,10,2,
+10,10,13,64,2,1,47,2,127,2,2,2,47,93,113,51,51,47,93,93,43,113,60,253,60,50,17,51,47,93,0,63,63,51,93,18,57,
+47,60,47,253,60,135,5,46,43,4,125,16,196,49,48,1,1,33,17,1,33,17,51,17,35,17,33,17,17,1,3,16,253,26,2,230,1,
+99,184,184,254,157,254,120,1,18,1,79,3,114,252,123,254,196,254,238,2,78,1,205,254,51,0,1,0,67,255,231,5,6,5,
+186,0,34,0,137,64,47,38,0,38,3,2,102,7,118,7,2,4,7,34,33,29,19,23,96,20,1,20,20,23,29,64,9,10,54,29,153,112,7,
+223,7,2,7,7,3,23,153,14,25,3,155,0,6,19,184,255,240,64,39,12,15,54,2,64,15,16,54,2,2,26,137,15,10,63,10,143,
+10,3,10,36,10,111,2,3,0,33,4,0,3,34,34,20,137,19,35,19,108,2,43,47,237,51,47,23,51,47,51,43,47,93,237,51,47,
+43,43,0,63,237,63,253,17,57,47,93,237,43,17,57,47,93,18,57,17,57,57,18,57,93,49,48,1,93,19,33,17,33,7,54,54,
+51,50,0,21,20,2,4,35,34,46,2,39,37,22,22,51,50,54,53,52,38,35,34,7,6,7,37,249,3,199,253,113,35,68,133,65,220,
+1,18,141,254,253,202,145,207,145,90,30,1,156,15,110,76,85,111,112,93,59,55,41,49,254,165,5,186,254,187,220,32,
+32,254,246,202,142,254,250,138,55,109,138,103,45,99,103,129,128,131,122,29,21,55,50,0,2,0,86,255,231,5,14,5,
+211,0,28,0,40,0,109,64,71,143,38,169,25,2,119,11,151,11,2,8,11,38,0,1,64,9,12,54,1,1,4,38,64,9,10,54,38,153,
+11,11,32,4,153,25,7,32,153,18,25,29,35,8,207,1,1,1,137,0,0,35,137,15,14,63,14,143,14,3,14,42,14,111,2,8,137,
+22,41,22,108,2,43,47,237,43,47,93,237,51,47,237,93,17,18,57,0,63,237,63,237,17,57,47,237,43,18,57,47,43,57,17,
+18,57,93,93,49,48,1,5,38,38,35,34,7,6,7,54,54,51,50,0,21,20,6,6,35,34,36,2,17,16,0,33,50,22,22,1,20,22,51,50,
+54,53,52,38,35,34,6,4,239,254,107,16,75,55,99,55,40,19,73,154,101,196,1,15,137,243,183,220,254,246,159,1,78,1,
+40,175,203,134,253,53,120,87,80,108,112,83,85,115,4,112,50,85,70,100,72,236,74,71,254,232,215,145,240,123,150,
+1,73,1,15,1,141,1,113,81,156,252,253,119,135,122,121,124,130,126,0,0,1,0,91,0,0,5,0,5,186,0,13,0,57,64,36,2,
+12,155,0,6,9,24,123,12,219,12,2,12,2,8,137,9,9,13,15,2,63,2,143,2,3,2,15,2,111,2,13,14,13,108,2,43,47,43,47,
+93,18,57,47,253,17,57,93,0,63,63,253,57,49,48,19,33,17,6,7,6,7,6,3,33,18,18,19,33,91,4,165,155,104,126,73,58,
+20,254,106,48,206,223,253,44,5,186,254,237,140,163,198,243,189,254,254,1,103,1,230,1,21,0,3,0,84,255,231,5,2,
+5,211,0,29,0,41,0,53,0,174,64,11,6,32,1,118,32,137,2,2,15,0,33,184,255,192,179,9,10,54,33,184,255,192,64,43,
+17,17,54,33,153,64,51,1,176,51,192,51,224,51,3,32,51,64,51,80,51,128,51,144,51,5,51,51,39,45,153,23,25,39,153,
+8,7,48,16,22,23,54,42,184,255,240,64,54,22,23,54,120,27,231,4,2,15,18,48,40,0,1,0,42,27,36,137,223,11,239,11,
+2,11,11,48,137,15,18,63,18,143,18,3,18,55,18,111,2,30,137,224,4,1,4,4,42,137,27,54,27,108,2,43,47,237,51,47,
+93,237,43,47,93,237,51,47,93,237,17,18,57,93,17,18,57,93,43,43,0,63,237,63,253,17,57,47,93,93,113,237,43,43,
+57,57,49,48,1,93,113,1,38,39,38,53,52,55,54,51,32,4,21,20,7,6,7,22,22,21,20,14,2,35,34,38,38,53,52,54,1,20,22,
+51,50,54,53,52,38,35,34,6,3,20,22,51,50,54,53,52,38,35,34,6,1,73,96,44,60,173,135,222,1,38,1,25,56,42,90,119,
+117,101,147,219,124,233,246,128,120,1,52,95,79,70,90,94,73,74,93,22,118,76,73,116,117,77,76,113,3,20,51,63,86,
+112,184,117,90,224,170,99,86,64,60,57,188,114,110,191,104,49,110,214,132,129,179,1,81,76,93,92,73,76,95,93,
+253,63,97,123,125,96,97,124,120,0,2,0,71,255,231,4,255,5,211,0,28,0,40,0,122,64,18,128,38,1,120,11,152,11,2,8,
+16,12,15,54,8,11,38,0,1,184,255,192,182,9,12,54,1,1,4,38,184,255,192,64,49,9,10,54,38,153,11,11,32,4,153,25,
+25,32,153,18,7,103,14,1,29,35,8,137,15,22,63,22,143,22,3,22,42,22,111,2,192,1,1,1,137,0,0,35,137,14,41,14,108,
+2,43,47,237,51,47,237,93,43,47,93,237,17,57,93,0,63,237,63,237,17,57,47,237,43,18,57,47,43,57,17,18,57,43,93,
+93,49,48,19,37,22,22,51,50,55,54,55,6,6,35,34,0,53,52,54,54,51,50,4,18,17,16,0,33,34,38,38,1,52,38,35,34,6,21,
+20,22,51,50,54,102,1,149,16,76,55,98,55,40,20,73,154,101,197,254,241,138,242,183,220,1,10,159,254,178,254,216,
+175,202,134,2,202,120,86,81,107,111,83,86,114,1,73,51,85,70,99,73,236,75,70,1,24,214,146,240,123,151,254,183,
+254,242,254,115,254,143,81,156,3,3,119,135,122,122,123,130,126,0,0,2,0,124,0,0,2,47,4,38,0,3,0,7,0,41,64,25,3,
+173,63,0,1,0,15,4,173,7,18,2,6,133,3,7,7,9,133,104,8,8,7,101,2,43,43,47,60,253,60,0,63,237,63,93,237,49,48,19,
+33,17,33,21,33,17,33,124,1,179,254,77,1,179,254,77,4,38,254,104,246,254,104,0,0,2,0,124,254,100,2,47,4,38,0,3,
+0,14,0,62,64,36,3,173,63,0,1,0,15,10,14,9,28,4,173,14,18,9,13,10,2,6,13,13,6,133,3,10,14,14,16,133,104,8,15,
+14,101,2,43,43,47,51,60,237,57,47,16,60,47,18,57,0,63,237,63,18,57,63,93,237,49,48,19,33,17,33,21,33,17,20,6,
+7,39,54,54,55,35,124,1,179,254,77,1,179,154,186,95,116,87,5,208,4,38,254,104,250,254,177,185,214,82,178,54,
+107,73,0,0,1,0,107,0,112,4,220,5,73,0,6,0,96,64,54,2,5,4,4,175,3,2,20,3,3,2,1,5,6,6,175,0,1,20,0,0,1,2,3,1,5,
+6,177,0,4,177,3,3,0,5,11,5,1,5,1,3,4,6,80,0,96,0,2,0,2,80,1,1,1,47,93,60,47,93,60,60,60,18,57,93,0,25,47,51,
+51,24,47,237,47,237,18,57,17,57,135,46,43,135,125,196,135,46,24,43,135,125,196,49,48,37,1,17,1,17,1,1,4,220,
+251,143,4,113,253,77,2,179,112,1,217,1,40,1,216,254,157,254,246,254,245,0,2,0,126,1,69,4,194,4,117,0,3,0,7,0,
+33,64,18,0,177,3,3,7,177,4,2,32,6,96,6,112,6,3,6,3,7,47,60,47,93,60,0,47,237,51,47,237,49,48,19,33,17,33,21,
+33,17,33,126,4,68,251,188,4,68,251,188,4,117,254,187,167,254,188,0,255,255,0,108,0,112,4,221,5,73,0,71,0,31,5,
+72,0,0,192,0,64,0,0,2,0,73,0,0,4,154,5,211,0,27,0,31,0,109,64,19,89,18,1,15,95,14,1,14,14,11,151,18,4,15,1,1,
+1,1,28,184,255,192,179,18,22,54,28,184,255,192,183,9,15,54,28,173,31,18,14,184,255,192,179,21,22,54,14,184,
+255,192,64,23,12,13,54,0,1,30,31,14,131,15,8,131,22,22,30,133,15,96,31,160,31,2,31,47,93,51,253,50,47,237,47,
+237,17,18,57,57,43,43,0,63,253,43,43,50,47,93,63,237,51,47,93,57,93,49,48,1,33,53,52,54,54,55,54,53,52,38,35,
+34,6,7,37,54,0,33,50,23,22,21,20,6,7,6,6,5,33,17,33,3,17,254,132,44,87,152,81,65,66,71,93,13,254,124,20,1,15,
+1,24,218,134,182,94,145,101,53,254,119,1,151,254,105,1,204,38,97,121,100,126,66,55,55,61,94,117,48,214,1,5,91,
+123,205,85,158,114,80,97,179,254,153,0,2,255,250,255,23,5,239,5,212,0,62,0,78,0,186,185,0,57,255,232,179,13,
+14,54,20,184,255,214,179,15,20,54,16,184,255,214,64,104,15,20,54,13,32,9,20,54,86,60,164,15,2,36,16,36,20,54,
+60,70,60,4,57,74,1,61,62,74,49,67,52,62,62,74,166,144,58,160,58,176,58,3,58,58,14,166,38,4,16,24,1,24,30,166,
+21,6,166,46,46,21,67,166,52,61,71,62,49,24,166,25,0,178,0,62,16,62,2,62,62,3,178,64,49,1,49,49,25,11,166,41,
+63,178,15,55,31,55,143,55,3,55,55,18,166,34,47,237,51,47,93,237,47,237,51,51,47,93,237,51,47,93,237,47,237,17,
+18,57,57,0,47,237,51,51,47,237,47,237,47,93,63,253,50,47,93,237,51,47,17,18,57,17,18,57,93,49,48,1,93,93,43,
+43,43,0,43,1,3,6,21,20,22,51,50,55,54,54,53,16,0,35,34,4,2,21,16,0,33,50,36,55,51,6,7,6,4,35,34,36,2,53,52,18,
+36,51,32,0,17,20,2,7,6,35,34,38,39,6,6,35,34,38,53,52,18,51,50,22,23,55,1,20,23,22,51,50,54,18,53,52,38,35,34,
+7,6,2,4,132,125,4,20,20,46,58,86,111,254,209,255,188,254,203,167,1,107,1,31,140,1,3,119,205,82,74,109,254,224,
+166,231,254,144,207,215,1,100,244,1,59,1,139,154,149,115,101,60,76,18,67,110,64,133,192,246,182,71,109,55,18,
+254,41,51,38,59,64,104,78,84,58,66,50,67,69,4,124,252,233,24,11,18,20,41,60,227,161,1,8,1,50,180,254,170,207,
+254,190,254,135,94,93,97,55,81,102,214,1,140,238,250,1,153,218,254,112,254,195,188,254,200,91,70,56,61,65,53,
+222,207,245,1,140,66,82,113,253,113,119,66,49,109,1,70,130,98,100,50,67,254,221,0,0,2,0,2,0,0,6,62,5,186,0,7,
+0,10,0,171,64,48,73,7,1,214,10,1,73,8,86,1,86,10,134,10,4,8,0,7,7,9,10,1,2,2,9,5,9,7,7,129,6,5,20,6,6,5,4,9,2,
+2,129,3,4,20,3,3,4,9,184,255,192,64,57,16,20,54,9,4,10,147,1,1,4,6,7,2,3,18,5,4,3,134,3,137,6,2,2,1,10,4,4,79,
+3,1,144,3,224,3,2,3,8,0,7,5,4,9,64,6,1,6,6,3,64,9,112,9,192,9,3,9,25,47,93,51,51,24,47,93,18,23,57,47,93,93,
+23,57,93,0,63,60,63,60,60,60,18,57,47,253,17,57,43,135,5,46,43,135,125,196,135,46,24,43,135,125,196,135,16,
+196,60,135,16,60,196,49,48,1,93,93,113,37,33,7,33,1,33,1,33,11,2,4,28,253,252,71,254,49,2,39,1,238,2,39,254,
+38,167,162,161,242,242,5,186,250,70,2,47,2,15,253,241,0,0,3,0,151,0,0,5,226,5,186,0,19,0,28,0,37,0,104,64,72,
+4,2,107,14,114,2,118,6,4,8,0,20,16,20,2,20,145,16,37,80,37,144,37,3,16,37,64,37,208,37,3,111,37,208,37,2,37,
+37,29,28,145,0,3,29,145,19,18,112,8,119,11,2,8,24,125,4,4,33,125,11,39,11,111,2,20,29,127,19,38,19,107,2,43,
+47,253,60,43,47,237,51,47,253,57,93,0,63,237,63,237,17,57,47,93,113,114,237,93,57,49,48,1,93,19,33,50,22,21,
+20,7,6,7,22,22,21,20,6,7,6,7,6,35,33,1,51,50,54,53,52,38,35,35,17,51,50,54,53,52,38,35,35,151,3,80,212,227,81,
+54,104,158,149,106,92,57,115,153,50,252,242,1,201,197,106,83,83,103,200,231,117,96,95,119,230,5,186,210,155,
+130,93,62,36,38,185,140,114,182,53,33,15,20,3,123,73,69,64,72,252,170,83,70,65,79,0,0,1,0,97,255,230,5,243,5,
+211,0,30,0,72,64,45,136,5,135,12,2,15,0,16,1,16,16,21,145,12,4,1,48,0,96,0,2,0,0,28,145,5,19,16,125,15,15,0,
+125,1,32,1,111,2,25,125,9,31,9,108,2,43,47,237,43,47,237,51,47,237,0,63,237,51,47,93,57,63,237,51,47,93,57,93,
+49,48,1,5,14,2,35,34,36,2,17,16,0,33,32,4,23,5,38,39,38,38,35,34,7,6,21,20,22,51,50,54,4,102,1,141,40,172,255,
+197,239,254,209,220,1,131,1,98,1,21,1,61,77,254,112,21,23,38,110,68,154,82,62,148,134,130,133,2,87,120,167,
+224,114,139,1,94,1,17,1,108,1,135,224,232,89,67,31,52,56,124,92,197,244,181,146,0,0,2,0,156,0,0,5,225,5,186,0,
+13,0,23,0,41,64,25,14,145,0,3,15,145,13,18,39,6,1,20,125,6,25,6,111,2,15,127,13,24,13,107,2,43,47,237,43,47,
+237,93,0,63,237,63,237,49,48,19,33,50,22,22,18,21,20,2,6,7,6,35,33,1,17,51,50,54,54,53,52,38,35,156,2,161,199,
+245,160,72,107,190,109,149,121,253,95,1,197,111,142,120,68,152,176,5,186,108,202,254,244,150,235,254,253,175,
+29,40,4,110,252,223,63,157,176,233,172,0,0,1,0,149,0,0,5,105,5,186,0,11,0,83,64,56,0,4,16,4,2,4,145,16,7,80,7,
+144,7,3,0,7,48,7,64,7,208,7,4,111,7,208,7,2,7,7,8,3,145,0,3,8,145,11,18,6,2,2,6,10,13,10,111,2,4,8,127,11,12,
+11,107,2,43,47,253,60,43,47,51,51,47,47,0,63,237,63,237,17,57,47,93,113,114,237,93,49,48,19,33,17,33,21,33,17,
+33,17,33,17,33,149,4,190,253,8,2,193,253,63,3,14,251,44,5,186,254,199,233,254,213,254,223,254,180,0,0,1,0,152,
+0,0,4,248,5,186,0,9,0,74,64,50,0,4,16,4,2,4,145,16,7,80,7,144,7,3,0,7,48,7,64,7,208,7,4,208,7,1,7,7,9,3,145,0,
+3,9,18,6,6,1,11,1,111,2,4,8,127,9,10,9,107,2,43,47,253,60,43,47,51,47,0,63,63,237,17,57,47,93,113,114,237,93,
+49,48,19,33,17,33,17,33,17,33,17,33,152,4,96,253,103,2,56,253,200,254,57,5,186,254,197,255,0,254,216,253,169,
+0,0,1,0,94,255,231,6,51,5,211,0,33,0,83,64,48,32,0,3,29,6,0,64,9,11,54,0,145,1,1,29,19,20,20,23,145,15,4,29,
+145,6,19,1,1,32,26,20,125,19,19,32,127,3,35,3,111,2,26,125,10,34,10,108,2,43,47,237,43,47,237,51,47,237,17,18,
+57,47,0,63,237,63,237,51,47,57,18,57,47,237,43,17,18,57,17,57,49,48,1,17,33,17,6,4,35,32,36,2,53,52,18,55,54,
+51,50,22,22,23,5,38,38,35,34,6,21,20,22,51,50,54,55,53,3,119,2,188,201,254,203,212,254,251,254,183,181,198,
+191,149,252,243,241,159,40,254,75,27,129,100,149,177,179,160,76,138,89,2,19,1,49,253,143,137,99,178,1,96,228,
+240,1,99,92,71,88,185,142,78,83,88,207,224,238,204,44,53,138,0,1,0,152,0,0,6,19,5,186,0,11,0,52,64,30,2,147,
+111,9,1,9,9,11,4,0,3,7,11,18,4,7,127,6,13,6,110,2,1,10,127,11,12,11,107,2,43,47,253,60,43,47,253,60,0,63,60,
+63,60,18,57,47,93,237,49,48,19,33,17,33,17,33,17,33,17,33,17,33,152,1,197,1,239,1,199,254,57,254,17,254,59,5,
+186,253,255,2,1,250,70,2,81,253,175,0,0,1,0,168,0,0,2,110,5,186,0,3,0,38,64,24,143,5,207,5,2,0,3,3,18,2,127,
+143,3,1,3,3,5,127,110,8,4,3,107,2,43,43,47,93,237,0,63,63,49,48,1,93,19,33,17,33,168,1,198,254,58,5,186,250,
+70,0,0,1,0,35,255,230,4,190,5,186,0,19,0,35,64,19,10,11,11,16,145,6,19,0,3,19,127,2,21,2,110,2,11,125,10,47,
+237,43,47,237,0,63,63,237,51,47,57,49,48,1,33,17,20,2,4,35,34,38,38,39,37,22,22,23,22,51,50,54,53,2,248,1,198,
+89,254,243,210,222,244,133,12,1,177,1,32,38,26,48,76,71,5,186,252,227,251,254,250,182,120,231,170,59,97,94,29,
+19,113,134,0,1,0,152,0,0,6,170,5,186,0,11,0,194,64,61,155,3,207,3,2,148,2,196,2,207,9,3,59,8,116,2,2,9,8,2,5,
+4,11,4,3,0,3,6,7,11,18,5,6,8,7,10,3,127,128,4,1,4,4,7,127,96,6,1,6,6,13,2,9,1,10,127,11,12,11,107,2,43,47,253,
+60,60,60,17,51,47,93,237,51,47,93,237,17,18,57,17,57,0,63,60,60,63,60,60,18,23,57,176,2,176,2,67,81,88,64,11,
+9,8,16,19,54,8,8,16,19,54,2,184,255,248,178,11,19,54,43,43,43,27,64,36,5,5,6,8,9,8,7,9,4,5,5,4,8,7,7,143,6,5,
+20,6,6,5,9,2,3,3,129,4,9,20,4,4,9,128,2,1,93,135,5,46,43,135,4,125,196,135,5,46,24,43,135,8,125,196,135,8,16,
+196,8,196,89,49,48,0,93,93,1,93,19,33,17,1,33,1,1,33,1,7,17,33,152,1,197,1,219,2,90,253,234,2,46,253,210,254,
+203,234,254,59,5,186,253,214,2,42,253,215,252,111,2,91,245,254,154,0,0,1,0,150,0,0,5,30,5,186,0,5,0,31,64,18,
+0,3,2,147,5,18,4,7,4,111,2,2,127,5,6,5,107,2,43,47,237,43,47,0,63,237,63,49,48,19,33,17,33,17,33,150,1,197,2,
+195,251,120,5,186,251,175,254,151,0,1,0,145,0,0,7,2,5,186,0,12,0,164,64,14,6,8,1,20,8,27,9,2,9,32,10,50,54,8,
+184,255,224,64,18,10,50,54,16,1,31,3,32,1,47,3,4,3,32,9,30,54,1,184,255,224,179,9,30,54,2,184,255,192,64,61,
+14,30,54,3,7,8,8,168,2,3,20,2,2,3,1,10,9,9,168,2,1,20,2,2,1,2,10,7,3,0,12,3,1,3,6,8,9,12,18,3,8,7,9,1,2,2,10,
+7,128,5,14,5,110,2,10,128,12,13,12,107,2,43,47,237,43,47,237,17,57,18,57,57,17,57,57,0,63,60,60,60,63,60,17,
+18,23,57,135,5,46,43,135,125,196,135,46,24,43,135,125,196,49,48,0,43,1,43,43,93,43,43,93,113,19,33,19,19,33,
+17,33,17,1,33,1,17,33,145,2,84,230,229,2,82,254,142,254,225,254,177,254,226,254,141,5,186,252,132,3,124,250,
+70,4,94,251,162,4,94,251,162,0,1,0,153,0,0,6,19,5,186,0,9,0,122,64,11,7,32,13,16,92,7,16,11,12,92,2,184,255,
+224,179,13,16,92,2,184,255,240,64,61,11,12,92,79,2,64,7,176,2,191,7,4,0,2,15,7,16,2,31,7,4,7,1,2,2,130,6,7,20,
+6,6,7,7,2,9,3,1,3,6,9,18,6,5,2,1,7,9,2,128,5,11,5,110,2,7,128,9,10,9,107,2,43,47,237,43,47,237,17,18,57,17,18,
+57,0,63,60,63,60,18,57,57,135,46,43,135,125,196,49,48,0,93,93,43,43,43,43,19,33,1,17,33,17,33,1,17,33,153,1,
+167,2,40,1,171,254,85,253,219,254,86,5,186,252,213,3,43,250,70,3,37,252,219,0,0,2,0,93,255,231,6,76,5,211,0,
+13,0,25,0,70,64,49,137,8,1,6,5,9,7,2,201,8,1,134,5,150,5,153,7,185,8,4,86,5,89,7,105,1,3,23,145,3,4,17,145,10,
+19,20,125,6,27,6,111,2,14,125,0,26,0,108,2,43,47,237,43,47,237,0,63,237,63,237,49,48,0,93,93,93,113,93,19,16,
+0,33,32,0,17,16,2,4,35,34,36,2,37,20,22,51,50,54,53,52,38,35,34,6,93,1,144,1,101,1,110,1,140,173,254,185,244,
+248,254,187,202,1,197,165,142,146,160,167,143,137,166,2,220,1,103,1,144,254,119,254,158,254,255,254,183,183,
+158,1,86,255,222,194,190,246,207,191,194,0,0,2,0,148,0,0,5,112,5,186,0,10,0,19,0,45,64,26,8,145,11,11,10,19,
+145,0,3,10,18,15,125,4,21,4,111,2,19,9,127,10,20,10,107,2,43,47,253,60,43,47,237,0,63,63,237,17,57,47,237,49,
+48,19,33,50,22,21,20,4,33,35,17,33,1,51,50,54,53,52,38,35,35,148,2,241,246,245,254,245,254,238,248,254,57,1,
+199,111,131,106,92,127,129,5,186,234,216,222,250,253,224,3,73,91,71,69,96,0,0,2,0,93,255,91,6,132,5,211,0,21,
+0,42,0,119,64,76,4,4,1,105,37,121,37,2,70,28,89,37,100,0,153,37,4,141,37,137,38,2,35,22,37,38,4,27,8,4,0,3,33,
+10,27,145,17,4,5,5,33,145,10,19,135,20,1,8,0,5,3,20,22,35,24,37,30,38,38,30,4,4,24,125,20,44,20,111,2,30,125,
+14,43,14,108,2,43,47,237,43,47,237,51,47,17,57,47,18,57,18,57,57,17,23,57,93,0,63,237,51,47,63,237,17,18,23,
+57,17,23,57,93,49,48,1,93,93,113,37,22,23,22,23,7,38,38,39,6,35,32,39,38,17,16,0,33,32,0,17,16,37,54,53,52,38,
+35,34,6,21,20,22,51,50,55,38,39,55,22,22,23,22,5,172,85,26,39,66,126,95,186,37,150,226,254,178,193,228,1,143,
+1,102,1,109,1,141,254,5,54,165,145,135,168,164,143,46,41,57,123,71,60,67,97,23,214,59,15,22,29,254,46,127,32,
+65,174,206,1,117,1,106,1,145,254,120,254,147,254,187,37,97,193,222,190,194,206,240,194,9,55,49,163,11,32,68,
+16,0,0,2,0,156,0,0,6,62,5,186,0,25,0,36,0,112,64,66,11,19,16,19,18,18,129,17,16,20,17,17,16,16,19,0,11,26,145,
+0,24,16,24,128,24,224,24,4,24,24,0,36,145,1,3,17,18,0,18,134,19,1,16,11,17,19,25,18,127,17,17,32,125,6,38,6,
+111,2,36,25,127,0,37,0,107,2,43,47,253,60,43,47,237,51,47,237,17,57,17,57,57,93,0,63,60,60,63,237,17,57,47,93,
+237,57,18,57,57,135,5,46,43,135,14,125,196,1,17,57,49,48,51,17,33,50,22,22,21,20,6,7,6,7,22,23,22,22,23,19,33,
+3,38,39,38,35,35,17,17,51,50,55,54,54,53,52,38,35,35,156,2,243,210,222,136,104,91,58,101,81,37,25,95,16,219,
+254,0,242,46,36,49,62,40,191,31,89,45,57,90,124,199,5,186,72,195,140,122,177,55,35,23,27,27,18,118,32,254,87,
+1,192,87,26,34,253,173,3,104,20,9,74,48,71,76,0,0,1,0,71,255,231,5,121,5,211,0,44,0,185,64,56,132,34,180,35,2,
+4,35,20,35,52,35,84,35,132,35,5,198,11,199,35,2,13,33,11,35,4,5,23,15,24,79,24,2,207,24,1,24,24,20,27,145,89,
+20,4,0,0,1,64,1,2,80,1,192,1,2,1,184,255,192,179,18,19,54,1,184,255,192,64,12,10,11,54,1,1,42,5,145,89,42,19,
+38,184,255,240,64,27,17,17,54,13,33,11,35,4,38,16,24,64,12,13,54,24,125,23,23,8,125,38,46,38,111,2,1,184,255,
+192,64,19,12,13,54,1,125,0,64,19,22,54,0,0,30,125,16,45,16,108,2,43,47,237,51,47,43,237,43,43,47,237,51,47,
+237,43,17,18,23,57,43,0,63,43,51,47,43,43,93,113,57,63,43,51,47,93,113,57,17,23,57,93,49,48,0,93,93,19,37,22,
+23,22,51,50,54,53,52,39,38,39,36,39,38,53,52,54,36,51,32,4,23,5,38,38,35,34,6,21,20,23,22,23,4,4,22,21,20,6,4,
+35,32,0,71,1,175,14,43,70,130,97,105,50,50,182,254,214,127,128,131,1,7,229,1,25,1,39,28,254,85,17,109,96,79,
+80,33,32,120,1,41,1,1,117,156,254,232,213,254,138,254,224,1,229,27,105,55,89,91,60,57,45,45,40,67,111,111,172,
+113,201,115,209,228,25,99,90,67,48,35,28,29,25,64,131,194,120,141,238,123,1,32,0,0,1,0,47,0,0,5,144,5,186,0,7,
+0,29,64,14,2,7,145,0,3,5,18,7,2,2,4,127,7,5,47,51,253,50,47,47,0,63,63,253,60,49,48,19,33,17,33,17,33,17,33,
+47,5,97,254,50,254,59,254,50,5,186,254,150,251,176,4,80,0,1,0,151,255,230,6,20,5,186,0,24,0,46,64,29,137,8,1,
+11,3,70,19,2,21,145,8,19,0,16,3,24,127,2,26,2,110,2,18,127,15,25,15,107,2,43,47,237,43,47,237,0,63,60,63,237,
+113,93,49,48,1,33,17,20,6,6,7,6,35,34,46,2,39,38,53,17,33,17,20,22,51,50,54,53,4,80,1,196,81,173,95,132,185,
+107,253,170,141,26,42,1,196,133,118,117,133,5,186,252,150,130,231,173,35,49,30,89,164,87,140,108,3,106,252,
+129,120,135,133,122,0,1,0,5,0,0,6,58,5,186,0,6,0,131,64,79,182,5,226,5,2,9,5,6,6,25,5,22,6,4,5,4,6,2,0,5,2,3,
+3,129,4,5,20,4,4,5,6,2,1,1,129,0,6,20,0,0,6,2,6,4,3,1,0,3,5,6,18,3,5,2,4,6,1,2,95,0,1,79,0,159,0,239,0,3,0,0,
+4,112,2,144,2,192,2,3,2,25,47,93,51,51,24,47,93,114,17,57,57,47,18,57,57,0,63,60,63,60,60,60,18,57,135,5,46,
+43,135,125,196,135,46,24,43,135,125,196,1,17,18,57,17,57,49,48,1,93,93,19,33,1,1,33,1,33,5,1,218,1,74,1,69,1,
+204,253,224,254,21,5,186,251,225,4,31,250,70,0,0,1,255,255,0,0,8,1,5,186,0,12,1,84,185,0,10,255,208,64,53,16,
+19,54,2,5,10,3,12,7,6,4,3,1,0,3,8,9,11,12,18,8,6,7,9,4,5,5,16,7,1,7,3,11,10,1,12,2,2,10,48,0,80,0,2,0,0,7,112,
+10,144,10,2,10,25,47,93,51,51,24,47,93,17,57,17,57,57,18,57,57,47,93,57,17,57,57,18,57,57,0,63,60,60,60,63,60,
+60,60,60,60,18,23,57,43,176,2,176,2,67,81,88,181,10,32,11,18,54,5,184,255,224,179,11,18,54,2,184,255,224,178,
+11,18,54,43,43,43,49,48,27,185,0,11,255,240,64,19,18,19,54,9,16,18,19,54,134,8,137,12,2,9,32,14,17,54,11,184,
+255,224,64,57,14,17,54,36,8,43,9,36,11,43,12,4,91,3,84,4,107,3,100,4,4,52,2,59,5,68,2,75,5,4,192,2,192,5,2,0,
+2,0,5,128,2,128,5,4,192,2,192,5,2,38,5,176,2,176,5,3,5,184,255,192,179,9,30,54,2,184,255,192,64,51,9,30,54,5,
+6,5,4,6,144,7,8,20,7,7,8,4,5,5,130,9,10,20,9,5,6,9,10,3,2,2,130,11,10,20,11,2,1,11,10,2,1,2,3,1,144,0,12,20,0,
+0,12,135,5,46,43,8,125,16,196,135,8,46,24,43,5,125,16,196,135,8,46,24,43,5,125,16,196,135,46,24,43,8,125,16,
+196,49,48,0,43,43,93,93,113,113,1,93,93,93,43,43,93,43,43,89,3,33,19,19,33,19,19,33,1,33,1,1,33,1,1,174,155,
+226,1,173,227,155,1,172,254,189,254,68,254,255,255,0,254,68,5,186,252,205,3,51,252,205,3,51,250,70,3,155,252,
+101,0,1,0,3,0,0,6,61,5,186,0,11,0,121,64,37,38,2,41,5,118,5,3,8,11,5,2,4,10,4,3,1,0,3,6,7,9,10,18,164,5,171,
+11,2,5,4,2,11,8,0,3,143,4,184,255,192,64,35,22,24,54,4,4,7,143,64,6,144,6,2,6,1,143,0,0,9,143,79,10,1,10,10,6,
+64,8,112,8,144,8,192,8,4,8,25,47,93,51,51,24,47,93,237,51,47,237,47,93,237,51,47,43,237,17,18,57,57,17,57,93,
+0,63,60,60,60,63,60,60,60,18,23,57,49,48,0,93,19,33,1,19,33,1,1,33,1,1,33,1,49,1,243,1,4,252,1,238,254,56,1,
+243,254,3,254,223,254,222,254,6,1,250,5,186,254,61,1,195,253,58,253,12,1,215,254,41,2,252,0,0,1,0,2,0,0,6,61,
+5,186,0,8,0,105,64,59,2,3,2,1,3,144,4,5,20,4,4,5,2,1,2,3,1,144,0,8,20,0,0,8,8,5,2,3,7,4,3,1,0,3,7,18,3,4,2,6,
+1,7,0,0,1,0,4,4,5,6,127,8,0,128,7,192,7,2,7,47,93,51,60,253,60,50,47,47,93,18,57,17,57,18,57,0,63,63,60,60,60,
+18,23,57,135,5,46,43,8,125,16,196,135,5,46,24,43,8,125,16,196,49,48,19,33,1,1,33,1,17,33,17,2,1,247,1,40,1,40,
+1,244,253,198,254,58,5,186,254,17,1,239,252,172,253,154,2,102,0,0,1,0,34,0,0,5,145,5,186,0,9,0,92,64,55,40,8,
+88,8,137,8,3,8,2,3,3,130,7,8,20,7,7,8,2,0,8,7,3,6,8,145,0,3,3,145,6,18,8,3,7,2,2,143,5,1,5,11,5,111,2,64,9,1,
+9,9,7,10,7,108,2,43,47,51,47,93,43,47,93,51,47,18,57,57,0,63,237,63,237,17,18,57,17,18,57,135,5,46,43,135,125,
+196,49,48,1,93,19,33,17,1,33,17,33,17,1,33,113,5,2,252,202,3,84,250,145,3,45,253,34,5,186,254,219,252,166,254,
+197,1,48,3,81,0,0,1,0,135,254,105,2,238,5,186,0,7,0,28,64,14,3,151,0,30,4,151,7,32,2,6,6,7,133,4,47,237,51,47,
+60,0,63,237,63,237,49,48,19,33,17,35,17,51,17,33,135,2,103,243,243,253,153,5,186,254,196,251,39,254,196,0,255,
+255,255,250,255,232,2,56,5,211,0,71,0,18,2,57,0,0,192,0,64,0,255,255,0,47,254,105,2,150,5,186,1,71,0,62,3,29,
+0,0,192,0,64,0,0,12,182,0,144,4,192,4,2,4,1,47,93,53,0,1,0,125,2,166,4,196,5,211,0,6,0,42,64,20,4,0,3,6,6,0,4,
+3,1,2,0,5,4,6,6,2,128,4,1,4,47,93,51,51,47,18,57,57,47,57,57,0,63,51,47,60,18,57,49,48,1,33,1,33,3,3,33,2,21,
+1,23,1,152,254,159,193,195,254,158,5,211,252,211,1,235,254,21,0,0,1,255,244,255,0,4,12,255,102,0,3,0,18,183,0,
+3,1,3,3,0,2,3,47,47,0,47,51,47,93,49,48,7,33,21,33,12,4,24,251,232,154,102,0,0,1,0,1,4,169,2,0,5,211,0,3,0,31,
+64,16,0,3,16,3,2,3,3,0,4,0,0,1,1,2,161,3,47,253,50,47,51,47,0,63,51,47,93,49,48,19,33,19,35,1,1,91,164,192,5,
+211,254,214,0,2,0,73,255,232,5,16,4,62,0,41,0,55,0,130,185,0,10,255,232,64,31,9,10,54,21,51,18,1,1,0,64,9,10,
+54,0,0,38,42,150,35,35,51,38,64,9,11,54,38,149,7,16,51,184,255,192,64,46,9,12,54,51,149,25,22,18,21,48,0,88,
+28,2,28,16,19,21,54,28,16,12,12,54,18,21,35,55,133,17,14,57,14,104,2,0,131,1,1,48,131,28,56,28,102,2,43,47,
+237,51,47,237,43,47,51,253,60,57,57,43,43,93,0,63,63,237,43,63,237,43,17,57,47,237,18,57,47,43,57,47,17,18,57,
+0,43,49,48,1,37,54,54,55,54,54,51,50,22,23,22,22,21,17,20,22,23,33,38,38,39,6,7,6,35,34,38,53,52,55,54,55,54,
+54,55,52,38,35,34,7,6,1,6,7,6,7,6,21,20,22,51,50,54,54,53,1,238,254,123,22,83,78,56,196,114,183,222,74,52,60,
+19,32,254,130,23,14,7,80,79,108,143,190,197,71,71,191,229,136,76,62,78,100,50,39,1,73,84,91,124,33,34,67,65,
+68,117,49,2,206,41,102,117,43,31,34,41,65,45,165,75,254,43,75,85,66,41,43,46,77,33,44,176,129,121,78,78,38,46,
+37,30,75,60,32,25,254,229,30,23,33,32,33,42,48,61,66,95,76,0,0,2,0,125,255,232,5,14,5,186,0,18,0,30,0,87,64,
+11,59,14,91,14,2,16,32,9,20,54,2,184,255,224,64,42,9,20,54,2,5,28,16,22,18,0,0,28,149,5,16,22,149,12,22,18,21,
+102,8,135,8,2,25,131,8,32,8,105,2,19,17,1,133,18,31,18,101,2,43,47,237,57,57,43,47,237,93,0,63,63,237,63,237,
+63,17,18,57,17,18,57,43,43,93,49,48,19,33,17,54,54,51,50,18,17,20,2,6,35,34,39,38,39,21,33,1,20,22,51,50,54,
+53,52,38,35,34,6,125,1,155,61,155,94,194,254,116,205,125,107,89,67,79,254,131,1,152,103,79,73,99,97,69,83,105,
+5,186,254,4,64,64,254,233,254,251,174,254,247,131,46,36,99,157,2,22,137,123,121,143,126,118,123,0,1,0,74,255,
+231,5,22,4,62,0,32,0,86,64,56,56,5,55,17,88,5,87,17,4,128,0,1,20,20,48,21,1,21,21,24,149,17,16,1,1,0,0,30,149,
+5,22,63,0,56,10,63,21,3,21,131,20,20,0,131,1,34,1,105,2,27,131,10,33,10,102,2,43,47,237,43,47,237,51,47,237,
+93,0,63,237,51,47,57,47,63,237,51,47,93,57,47,93,93,49,48,1,5,14,2,35,34,46,2,53,52,55,54,54,55,54,51,32,4,23,
+5,38,38,35,34,6,21,20,22,51,50,54,3,147,1,131,32,146,227,175,169,225,162,92,56,41,142,75,119,186,1,4,1,17,55,
+254,129,18,95,80,101,125,124,96,80,109,1,159,44,121,177,98,63,141,190,157,164,109,80,127,31,49,186,179,51,68,
+69,145,147,131,136,82,0,0,2,0,72,255,232,4,217,5,186,0,17,0,29,0,103,64,11,59,4,91,4,2,3,32,9,20,54,16,184,
+255,224,64,32,9,20,54,16,13,21,3,27,2,17,0,21,149,13,16,27,149,7,22,2,21,10,8,17,17,54,10,16,15,15,54,10,184,
+255,240,64,19,13,14,54,2,18,17,133,1,31,1,104,2,24,131,10,30,10,102,2,43,47,237,43,47,253,57,57,43,43,43,0,63,
+63,237,63,237,63,17,18,57,17,18,57,43,43,93,49,48,1,17,33,53,6,7,6,35,34,2,53,16,18,51,50,22,23,17,19,52,38,
+35,34,6,21,20,22,51,50,54,4,217,254,131,80,66,88,108,217,229,253,195,95,155,60,3,106,81,71,96,99,73,78,104,5,
+186,250,70,157,100,35,46,1,74,236,1,8,1,24,64,64,1,252,252,92,125,123,118,139,130,121,122,0,0,2,0,72,255,232,
+5,22,4,62,0,24,0,32,0,93,64,23,10,10,9,9,5,143,32,1,32,150,1,1,5,28,64,9,12,54,28,149,20,16,5,184,255,192,64,
+31,9,10,54,5,149,13,22,56,17,1,32,25,1,9,131,10,10,25,131,0,34,0,105,2,1,131,17,33,17,102,2,43,47,237,43,47,
+237,51,47,237,17,18,57,93,0,63,237,43,63,237,43,17,57,47,237,113,18,57,47,57,47,49,48,1,33,22,23,22,51,50,55,
+54,55,5,6,4,35,34,38,2,53,52,0,33,50,4,18,21,37,38,38,35,34,7,6,7,5,22,252,208,11,42,59,95,60,54,33,38,1,145,
+92,254,252,243,211,242,159,1,63,1,25,228,1,8,138,254,98,12,103,84,97,58,37,10,1,174,98,48,69,30,19,48,37,160,
+139,119,1,3,175,249,1,52,138,254,250,210,149,118,102,77,48,95,0,1,0,16,0,0,3,89,5,211,0,24,0,94,64,37,17,15,
+18,8,175,20,1,20,64,9,14,54,20,149,15,1,2,7,152,1,8,15,5,21,7,18,2,17,2,2,17,0,4,133,10,7,5,184,255,192,179,
+23,24,54,5,184,255,192,179,19,21,54,5,184,255,192,179,12,13,54,5,47,43,43,43,51,60,253,60,50,50,47,47,18,57,
+47,0,63,63,60,253,60,63,237,43,93,17,57,17,57,49,48,1,51,17,35,17,33,17,35,17,51,53,52,62,2,51,50,23,7,38,35,
+34,6,7,6,2,64,194,194,254,104,152,152,28,77,139,134,107,204,45,73,45,55,48,10,5,4,38,254,214,253,4,2,252,1,42,
+48,65,156,99,61,25,246,12,37,40,22,0,2,0,73,254,81,4,220,4,62,0,36,0,48,0,138,64,14,103,33,1,50,35,82,35,2,22,
+32,9,20,54,36,184,255,224,64,12,9,20,54,36,0,46,22,40,26,14,14,13,184,255,192,179,19,22,54,13,184,255,192,182,
+9,17,54,13,13,26,18,184,255,192,64,41,9,12,54,18,149,8,28,40,149,26,46,149,33,16,0,15,105,30,137,30,2,0,43,21,
+133,2,50,2,104,2,14,131,11,11,37,131,30,49,30,102,2,43,47,237,51,47,237,43,47,253,57,57,93,0,63,63,237,47,237,
+63,253,43,17,57,47,43,43,57,47,17,18,57,17,18,57,43,43,93,93,49,48,1,33,17,23,20,14,2,35,32,38,53,52,55,5,22,
+23,22,51,50,54,53,53,6,7,6,35,34,39,38,53,52,18,51,50,22,23,1,20,22,51,50,54,53,52,38,35,34,6,3,94,1,125,1,85,
+141,217,140,254,192,239,2,1,139,15,31,45,68,88,87,60,60,94,109,213,131,93,240,194,124,161,70,254,129,98,80,76,
+103,108,78,78,93,4,38,252,21,47,100,181,112,50,192,161,20,34,45,55,21,31,94,117,161,71,32,50,186,132,217,248,
+1,4,84,97,254,154,115,111,115,116,116,123,113,0,0,1,0,123,0,0,4,222,5,186,0,19,0,81,185,0,5,255,240,179,9,11,
+54,2,184,255,224,179,26,27,54,2,184,255,224,179,23,23,54,2,184,255,224,64,29,9,16,54,2,0,14,151,5,16,0,0,10,
+19,21,10,133,9,21,9,104,2,1,18,133,19,20,19,101,2,43,47,253,60,43,47,237,0,63,60,63,63,253,17,57,43,43,43,43,
+49,48,19,33,17,54,54,51,50,22,21,17,33,17,52,38,35,34,6,21,17,33,123,1,151,83,164,112,166,191,254,103,74,67,
+74,92,254,105,5,186,253,228,86,74,202,209,253,93,2,72,100,83,112,145,254,2,0,0,2,0,138,0,0,2,33,5,186,0,3,0,7,
+0,40,64,23,3,3,4,0,0,4,15,7,21,2,6,133,3,7,7,9,133,104,8,8,7,101,2,43,43,47,60,253,60,0,63,63,63,18,57,47,49,
+48,19,33,17,33,21,33,17,33,138,1,151,254,105,1,151,254,105,5,186,254,235,127,251,218,0,2,255,156,254,81,2,35,
+5,186,0,3,0,18,0,67,64,39,10,16,9,11,54,13,4,12,15,10,3,3,4,0,0,4,15,15,151,10,28,13,18,12,2,6,133,3,12,18,18,
+20,133,104,8,19,18,101,2,43,43,47,51,60,253,60,47,18,57,0,63,237,63,63,18,57,47,17,18,57,17,57,43,49,48,19,33,
+17,33,21,33,17,20,6,6,35,34,39,19,22,51,50,54,53,139,1,152,254,104,1,152,57,154,143,118,175,61,49,23,52,54,5,
+186,254,232,124,251,250,197,164,102,35,1,40,10,71,106,0,0,1,0,123,0,0,5,86,5,186,0,11,0,185,64,118,3,16,19,20,
+54,15,3,79,3,2,207,3,1,144,5,1,16,2,80,2,2,0,2,64,2,192,2,208,2,4,192,2,1,144,2,160,2,176,2,3,5,5,6,8,9,8,7,9,
+4,2,3,3,169,4,9,20,4,4,9,8,7,7,135,6,5,20,6,6,5,53,9,128,9,2,9,8,5,2,4,11,4,3,15,0,0,6,7,11,21,5,8,6,10,3,133,
+4,4,7,133,128,6,1,16,6,1,6,6,13,2,9,1,10,133,11,12,11,101,2,43,47,253,60,60,60,17,51,47,93,93,237,51,47,237,
+17,18,57,57,0,63,60,60,63,63,60,18,23,57,93,135,5,46,43,14,125,16,196,135,5,46,24,43,4,125,16,196,7,8,16,60,8,
+60,49,48,0,93,93,113,114,1,93,93,113,43,19,33,17,1,33,1,1,33,3,7,17,33,123,1,160,1,48,1,245,254,131,1,147,254,
+53,215,153,254,96,5,186,253,12,1,96,254,140,253,78,1,170,150,254,236,0,0,1,0,137,0,0,2,33,5,186,0,3,0,27,64,
+16,0,0,3,21,2,133,3,3,5,133,104,8,4,3,101,2,43,43,47,237,0,63,63,49,48,19,33,17,33,137,1,152,254,104,5,186,
+250,70,0,1,0,126,0,0,7,136,4,62,0,37,0,106,185,0,2,255,208,179,23,28,54,11,184,255,240,179,19,20,54,11,184,
+255,240,179,9,11,54,5,184,255,240,64,45,9,14,54,8,2,5,21,66,32,151,11,5,16,0,15,16,26,37,18,15,133,16,8,25,
+133,16,183,26,1,36,133,26,183,79,37,191,37,239,37,3,37,38,37,101,2,43,47,93,228,237,57,47,228,253,57,47,237,0,
+63,60,60,63,63,60,253,228,18,57,57,43,43,43,43,49,48,19,33,21,54,54,51,50,22,23,54,54,51,50,22,21,17,33,17,52,
+39,38,35,34,6,21,17,33,17,52,39,38,38,35,34,6,21,17,33,126,1,124,82,167,118,127,148,47,96,158,116,171,192,254,
+104,28,41,61,72,88,254,104,8,13,64,43,70,90,254,104,4,38,155,97,82,90,89,104,75,203,216,253,101,2,93,72,35,55,
+104,115,253,220,2,73,70,25,40,49,106,121,253,226,0,0,1,0,123,0,0,4,222,4,62,0,19,0,76,179,183,5,1,5,184,255,
+240,179,9,11,54,2,184,255,224,179,23,28,54,2,184,255,224,64,29,9,14,54,2,0,14,151,5,16,0,15,10,19,21,10,133,9,
+21,9,104,2,1,18,133,19,20,19,101,2,43,47,237,57,43,47,237,0,63,60,63,63,253,17,57,43,43,43,93,49,48,19,33,21,
+54,54,51,50,22,21,17,33,17,52,38,35,34,6,21,17,33,123,1,123,85,174,125,169,191,254,103,74,67,74,92,254,105,4,
+38,173,106,91,201,210,253,93,2,72,100,83,112,145,254,2,0,0,2,0,73,255,232,5,13,4,62,0,13,0,25,0,50,64,32,54,
+11,134,4,2,55,3,56,10,2,23,149,3,16,17,149,10,22,20,131,7,27,7,105,2,14,131,0,26,0,102,2,43,47,237,43,47,237,
+0,63,237,63,237,93,49,48,1,93,19,52,0,33,32,23,22,21,20,0,33,32,39,38,1,20,22,51,50,54,53,52,38,35,34,6,73,1,
+72,1,23,1,63,163,131,254,187,254,225,255,0,158,194,1,152,115,87,88,113,114,84,89,116,2,16,243,1,59,185,149,
+218,245,254,199,130,161,1,6,142,136,134,148,138,135,137,0,0,2,0,125,254,108,5,14,4,62,0,17,0,29,0,106,64,11,
+52,3,84,3,2,16,32,9,20,54,3,184,255,224,64,22,9,20,54,3,1,27,16,21,13,1,15,27,149,7,16,21,149,13,22,0,27,10,
+184,255,248,179,17,17,54,10,184,255,240,64,24,15,15,54,10,16,13,14,54,24,131,10,31,10,105,2,18,2,17,133,0,30,
+0,101,2,43,47,237,57,57,43,47,237,43,43,43,0,63,63,237,63,237,63,17,18,57,17,18,57,43,43,93,49,48,19,17,33,21,
+54,55,54,51,50,18,21,16,2,35,34,38,39,17,3,20,22,51,50,54,53,52,38,35,34,6,125,1,125,79,66,89,108,213,233,254,
+194,94,155,61,3,106,81,71,96,100,72,78,104,254,108,5,186,157,99,35,47,254,186,240,254,247,254,233,64,63,254,5,
+3,164,126,122,117,140,129,121,122,0,0,2,0,72,254,108,4,217,4,62,0,18,0,30,0,93,64,11,52,16,84,16,2,2,32,9,20,
+54,16,184,255,224,64,47,9,20,54,16,17,22,2,28,5,17,15,22,149,12,16,28,149,5,22,1,27,8,8,17,17,54,8,16,15,15,
+54,17,19,1,133,0,32,0,104,2,25,131,8,31,8,102,2,43,47,237,43,47,253,57,57,43,43,0,63,63,237,63,237,63,17,18,
+57,17,18,57,43,43,93,49,48,1,33,17,6,6,35,34,2,17,52,18,54,51,50,23,22,23,53,33,1,52,38,35,34,6,21,20,22,51,
+50,54,4,217,254,101,60,155,95,194,254,116,206,124,107,90,66,79,1,125,254,104,103,79,73,99,97,70,82,105,254,
+108,1,251,63,64,1,23,1,4,174,1,10,131,47,35,99,157,253,234,137,122,121,142,127,117,122,0,0,1,0,127,0,0,3,195,
+4,62,0,16,0,75,185,0,4,255,224,179,9,11,54,2,184,255,192,64,36,9,16,54,7,2,0,8,16,10,151,5,16,0,15,16,21,197,
+1,1,8,192,7,1,7,7,1,15,133,16,16,1,16,17,16,101,2,43,47,93,237,57,50,47,93,57,93,0,63,63,63,237,17,57,17,57,
+57,43,43,49,48,19,33,21,54,54,51,50,23,3,38,35,34,7,6,21,17,33,127,1,125,55,117,86,90,107,126,72,42,80,44,63,
+254,103,4,38,174,113,85,56,254,222,30,66,93,255,254,156,0,1,0,51,255,231,4,156,4,62,0,46,0,244,185,0,36,255,
+244,179,12,13,54,38,184,255,192,64,9,12,13,54,13,24,11,11,54,38,184,255,240,64,35,16,17,54,13,35,11,37,4,4,24,
+24,25,64,16,16,54,25,64,10,10,54,25,25,29,64,14,16,54,29,146,20,16,0,0,1,184,255,192,179,20,22,54,1,184,255,
+192,179,15,16,54,1,184,255,192,181,9,10,54,1,1,4,184,255,192,64,58,14,16,54,4,146,44,22,25,16,22,40,2,9,16,6,
+40,2,57,16,136,24,152,16,3,13,35,11,37,4,40,16,25,64,21,23,54,25,64,17,18,54,25,64,11,15,54,25,131,24,24,8,
+131,40,48,40,105,2,1,184,255,192,179,21,23,54,1,184,255,192,179,17,18,54,1,184,255,192,64,14,11,15,54,1,131,0,
+0,32,131,16,47,16,102,2,43,47,237,51,47,237,43,43,43,43,47,237,51,47,237,43,43,43,17,18,23,57,93,93,93,0,63,
+237,43,51,47,43,43,43,57,47,63,237,43,51,47,43,43,57,47,17,23,57,0,43,49,48,0,43,43,43,19,37,22,22,51,50,55,
+54,53,52,39,38,39,46,2,53,52,54,54,51,50,22,22,23,5,38,39,38,35,34,6,21,20,23,22,23,30,2,21,20,6,6,35,32,38,
+51,1,148,25,90,75,82,45,35,46,33,142,212,165,113,122,214,180,190,181,121,40,254,126,15,35,48,68,69,63,40,40,
+134,203,198,105,111,239,206,254,221,247,1,38,38,72,62,35,26,39,44,24,17,25,37,63,150,96,105,152,75,58,122,104,
+38,51,24,32,49,35,39,20,20,16,23,82,152,91,92,174,103,166,0,0,1,0,56,255,232,3,85,5,186,0,23,0,85,64,38,201,0,
+1,23,0,21,11,20,12,9,149,14,22,3,20,152,2,21,15,0,0,20,11,12,3,3,12,0,5,133,23,20,192,18,208,18,2,18,184,255,
+192,64,9,15,25,54,0,18,48,18,2,18,47,93,43,113,51,60,253,60,50,50,47,47,57,47,0,63,63,60,253,60,63,237,57,17,
+57,17,18,57,93,49,48,1,17,51,17,35,17,20,23,22,51,50,55,19,6,35,34,38,38,53,17,35,17,51,53,2,102,224,224,13,
+20,50,45,81,30,151,131,152,144,69,150,150,5,186,254,108,254,215,254,135,68,22,34,26,254,231,33,78,159,178,1,
+118,1,41,195,0,0,1,0,119,255,232,4,218,4,38,0,19,0,51,64,31,2,32,9,14,54,2,1,14,151,5,22,1,21,18,9,15,1,18,
+133,0,21,0,104,2,11,133,8,20,8,101,2,43,47,237,43,47,253,57,0,63,60,63,63,253,17,57,43,49,48,33,33,53,6,6,35,
+34,38,53,17,33,17,20,22,51,50,54,53,17,33,4,218,254,132,85,173,126,168,191,1,153,74,67,73,93,1,151,172,106,90,
+201,209,2,164,253,184,100,84,112,145,1,255,0,0,1,0,2,0,0,4,232,4,38,0,6,0,151,64,96,73,3,201,6,2,217,6,235,1,
+228,3,3,25,5,22,6,2,9,5,6,6,72,0,88,0,4,5,4,6,2,0,5,2,3,3,135,4,5,20,4,4,5,6,2,1,1,135,0,6,20,0,0,6,2,6,4,3,1,
+0,15,5,6,21,3,5,2,16,4,79,4,2,4,6,1,2,31,0,143,0,2,0,0,4,224,2,1,16,2,64,2,128,2,176,2,4,2,25,47,93,93,51,51,
+24,47,93,17,57,57,47,93,18,57,57,0,63,60,63,60,60,60,18,57,135,5,46,43,135,125,196,135,46,24,43,135,125,196,1,
+17,18,57,17,57,49,48,1,93,93,93,113,19,33,19,19,33,1,33,2,1,168,206,213,1,155,254,61,254,151,4,38,253,95,2,
+161,251,218,0,0,1,0,3,0,0,7,145,4,38,0,12,0,235,185,0,5,255,192,179,10,21,54,2,184,255,192,64,18,10,21,54,4,2,
+11,5,72,3,135,8,4,9,42,9,21,54,11,184,255,214,64,114,9,21,54,5,6,5,4,6,169,7,8,20,7,7,8,4,5,5,136,9,10,20,9,5,
+6,9,10,3,2,2,136,11,10,20,11,2,1,11,10,2,1,2,3,1,169,0,12,20,0,0,12,128,10,1,2,5,10,3,12,7,6,4,3,1,0,15,8,9,
+11,12,21,8,6,7,9,4,5,5,32,7,96,7,128,7,3,7,3,11,10,1,12,2,2,10,47,0,111,0,143,0,3,0,0,7,32,10,64,10,96,10,128,
+10,4,10,25,47,93,51,51,24,47,93,17,57,17,57,57,18,57,57,47,93,57,17,57,57,18,57,57,0,63,60,60,60,63,60,60,60,
+60,60,18,23,57,93,135,5,46,43,8,125,16,196,135,8,46,24,43,5,125,16,196,135,8,46,24,43,5,125,16,196,135,46,24,
+43,8,125,16,196,49,48,1,43,43,93,0,43,43,19,33,19,19,33,19,19,33,1,33,3,3,33,3,1,138,171,216,1,111,224,171,1,
+135,254,121,254,150,215,208,254,148,4,38,253,99,2,157,253,99,2,157,251,218,2,127,253,129,0,0,1,0,11,0,0,5,74,
+4,38,0,11,0,109,64,67,20,2,116,2,212,2,3,8,11,5,2,4,10,4,3,1,0,15,6,7,9,10,21,5,8,3,133,4,4,7,133,16,6,1,6,2,
+11,8,1,133,31,0,95,0,159,0,3,0,0,9,133,31,10,1,10,10,6,0,8,48,8,192,8,240,8,4,8,25,47,93,51,51,24,47,93,237,
+51,47,114,237,18,57,57,47,93,237,51,47,237,18,57,0,63,60,60,60,63,60,60,60,18,23,57,49,48,0,93,19,33,19,19,33,
+1,1,33,3,3,33,1,31,1,227,169,196,1,193,254,150,1,132,254,37,196,231,254,71,1,130,4,38,254,216,1,40,254,6,253,
+212,1,86,254,170,2,44,0,1,0,5,254,81,4,234,4,38,0,17,0,210,64,58,9,16,4,17,88,3,3,5,4,17,2,0,5,2,3,3,169,4,5,
+20,4,4,5,17,2,1,1,135,0,17,20,0,0,17,9,24,9,11,54,2,24,11,11,54,128,2,1,2,17,4,3,1,0,15,12,17,11,14,184,255,
+192,64,18,9,11,54,14,149,9,28,17,21,22,0,1,11,12,3,5,2,4,184,255,192,64,33,19,20,54,191,4,1,79,4,175,4,2,4,17,
+1,2,0,64,19,20,54,31,0,127,0,143,0,3,0,12,4,0,3,2,184,255,192,64,16,19,20,54,208,2,224,2,2,64,2,112,2,128,2,3,
+2,25,47,93,93,43,23,51,24,47,93,43,17,57,57,47,93,93,43,18,57,57,47,57,93,0,63,63,237,43,57,17,57,63,60,60,60,
+18,57,93,43,43,135,5,46,43,135,14,125,196,135,5,46,24,43,135,14,125,196,1,17,18,57,17,57,49,48,1,93,19,33,19,
+19,33,1,6,7,6,35,34,39,3,22,51,50,54,55,5,1,174,219,203,1,145,254,91,72,75,106,217,88,184,32,88,108,72,89,31,
+4,38,253,61,2,195,251,145,194,68,96,24,1,28,28,66,85,0,1,0,37,0,0,4,71,4,38,0,9,0,94,64,60,9,8,73,8,2,36,3,45,
+8,201,8,3,8,2,3,3,171,7,8,20,7,7,8,2,15,8,31,8,2,8,149,0,15,7,0,3,16,3,2,3,149,6,21,8,3,7,2,2,5,11,5,105,2,9,
+9,7,10,7,102,2,43,47,51,47,43,47,51,47,18,57,57,0,63,237,93,57,63,253,93,57,135,5,46,43,135,125,196,49,48,1,
+93,113,19,33,21,1,33,17,33,17,1,33,77,3,217,253,232,2,57,251,222,1,252,254,44,4,38,238,253,222,254,234,1,8,2,
+8,0,1,0,26,254,81,3,6,5,211,0,49,0,99,64,14,57,45,1,12,16,9,11,54,21,16,9,11,54,0,184,255,240,64,18,9,11,54,
+12,35,151,34,34,21,1,151,0,31,20,151,21,33,12,184,255,192,64,16,9,13,54,0,21,34,5,128,40,12,21,16,128,40,34,
+30,184,255,192,179,14,15,54,30,47,43,51,51,253,50,57,47,237,47,47,60,43,0,63,237,63,237,18,57,47,237,57,43,43,
+43,49,48,1,93,0,1,17,35,34,6,7,6,2,7,6,7,6,7,30,2,21,20,22,22,51,17,35,34,38,38,53,52,55,54,53,52,38,38,39,17,
+50,54,54,53,53,38,53,52,54,55,54,55,54,51,3,6,45,63,63,13,7,2,27,20,37,28,64,67,65,46,28,65,98,126,195,164,70,
+2,1,42,79,75,77,77,40,1,59,52,39,67,89,114,5,211,254,184,53,55,30,254,243,77,59,36,27,28,31,67,137,150,135,82,
+34,254,188,85,163,163,36,36,22,23,116,98,44,2,1,87,48,99,118,34,23,23,177,158,42,32,16,21,0,1,0,160,254,108,1,
+159,5,186,0,3,0,21,64,10,0,3,3,27,2,2,192,3,1,3,47,93,51,47,0,63,63,49,48,19,51,17,35,160,255,255,5,186,248,
+178,255,255,0,23,254,81,3,3,5,211,0,71,0,94,3,29,0,0,192,0,64,0,0,1,0,99,1,236,4,222,3,206,0,20,0,52,64,30,
+187,0,180,10,2,11,0,4,10,2,0,177,1,1,14,177,8,8,19,177,4,4,11,177,10,15,1,1,1,10,47,47,93,0,47,237,60,16,237,
+51,47,237,51,47,253,49,48,0,93,93,1,17,6,6,35,34,38,38,35,34,7,17,54,54,51,50,30,2,51,50,4,222,115,142,76,58,
+117,249,72,154,164,93,162,96,49,108,209,88,39,134,3,204,254,186,92,62,34,126,160,1,73,83,70,31,102,26,255,255,
+0,2,0,0,6,62,7,17,2,34,0,36,0,0,1,7,0,142,1,200,1,107,0,23,64,13,3,2,0,14,17,4,5,37,3,2,14,5,38,0,43,53,53,1,
+43,53,53,0,0,3,0,2,0,0,6,62,7,36,0,18,0,30,0,33,0,198,64,61,73,13,1,105,31,137,31,246,31,3,88,11,87,18,89,31,
+214,33,4,73,31,86,15,86,33,134,33,4,31,14,13,13,32,33,15,16,16,32,11,32,13,13,129,12,11,20,12,12,11,18,32,16,
+16,129,17,18,20,17,17,18,5,184,255,240,64,63,9,14,54,5,166,0,28,1,28,28,22,4,32,18,33,147,15,15,18,12,13,16,
+17,18,11,18,3,25,166,8,19,166,2,31,14,13,11,4,224,12,1,12,18,16,15,33,4,32,144,17,1,17,2,8,12,17,4,112,32,192,
+32,2,32,25,47,93,23,51,24,47,93,18,23,57,47,93,23,57,47,237,47,237,0,63,60,63,60,60,60,18,57,47,253,17,57,63,
+51,47,113,237,43,135,5,46,43,135,125,196,135,46,24,43,135,125,196,7,16,60,60,135,16,196,60,49,48,1,93,93,93,
+113,1,38,53,52,54,51,50,22,21,20,7,51,1,33,39,33,7,33,1,55,20,22,51,50,54,53,52,38,35,34,6,19,3,3,2,75,32,141,
+99,100,141,33,44,2,39,254,38,77,254,6,76,254,49,2,39,139,60,43,42,60,60,42,43,60,253,150,149,5,186,56,65,99,
+142,141,100,65,56,250,70,242,242,5,186,122,44,60,60,43,43,60,60,251,227,1,229,254,27,0,255,255,0,97,254,81,5,
+243,5,211,2,34,0,38,0,0,1,7,0,222,1,200,0,0,0,18,64,10,1,0,49,49,9,1,37,1,34,18,0,63,53,1,43,53,255,255,0,149,
+0,0,5,105,7,62,2,34,0,40,0,0,1,7,0,141,1,143,1,107,0,19,64,11,1,0,14,14,0,1,37,1,15,5,38,0,43,53,1,43,53,0,
+255,255,0,153,0,0,6,19,7,37,2,34,0,49,0,0,1,7,0,217,2,0,1,107,0,19,64,11,1,0,24,11,0,4,37,1,24,5,38,0,43,53,1,
+43,53,0,255,255,0,93,255,231,6,76,7,17,2,34,0,50,0,0,1,7,0,142,2,0,1,107,0,23,64,13,3,2,0,29,32,0,6,37,3,2,29,
+5,38,0,43,53,53,1,43,53,53,0,255,255,0,151,255,230,6,20,7,17,2,34,0,56,0,0,1,7,0,142,2,0,1,107,0,23,64,13,2,1,
+0,28,31,16,1,37,2,1,28,5,38,0,43,53,53,1,43,53,53,0,255,255,0,73,255,232,5,16,5,211,2,34,0,68,0,0,1,7,0,141,1,
+86,0,0,0,19,64,11,2,0,58,58,1,13,37,2,59,17,38,0,43,53,1,43,53,0,255,255,0,73,255,232,5,16,5,211,2,34,0,68,0,
+0,1,7,0,67,1,86,0,0,0,19,64,11,2,0,59,59,1,13,37,2,59,17,38,0,43,53,1,43,53,0,255,255,0,73,255,232,5,16,5,198,
+2,34,0,68,0,0,1,7,0,216,1,86,0,0,0,23,64,14,2,0,62,1,0,62,58,1,13,37,2,62,17,38,0,43,53,1,43,93,53,0,255,255,
+0,73,255,232,5,16,5,166,2,34,0,68,0,0,1,7,0,142,1,86,0,0,0,23,64,13,3,2,0,59,62,1,13,37,3,2,59,17,38,0,43,53,
+53,1,43,53,53,0,255,255,0,73,255,232,5,16,5,186,2,34,0,68,0,0,1,7,0,217,1,86,0,0,0,19,64,11,2,0,70,57,1,13,37,
+2,70,17,38,0,43,53,1,43,53,0,255,255,0,73,255,232,5,16,6,108,2,34,0,68,0,0,1,7,0,221,1,86,0,0,0,23,64,13,3,2,
+0,62,56,1,13,37,3,2,59,17,38,0,43,53,53,1,43,53,53,0,255,255,0,74,254,81,5,22,4,62,2,34,0,70,0,0,1,7,0,222,1,
+86,0,0,0,18,64,10,1,0,51,51,10,1,37,1,36,21,0,63,53,1,43,53,255,255,0,72,255,232,5,22,5,211,2,34,0,72,0,0,1,7,
+0,141,1,86,0,0,0,23,64,14,2,159,35,1,0,35,35,17,0,37,2,36,17,38,0,43,53,1,43,93,53,0,255,255,0,72,255,232,5,
+22,5,211,2,34,0,72,0,0,1,7,0,67,1,86,0,0,0,19,64,11,2,0,36,36,17,0,37,2,36,17,38,0,43,53,1,43,53,0,255,255,0,
+72,255,232,5,22,5,198,2,34,0,72,0,0,1,7,0,216,1,86,0,0,0,23,64,14,2,0,39,1,0,39,35,17,0,37,2,39,17,38,0,43,53,
+1,43,93,53,0,255,255,0,72,255,232,5,22,5,166,2,34,0,72,0,0,1,7,0,142,1,86,0,0,0,23,64,13,3,2,0,36,39,17,0,37,
+3,2,36,17,38,0,43,53,53,1,43,53,53,0,255,255,0,138,0,0,2,169,5,211,2,34,0,215,0,0,1,6,0,141,0,0,0,23,64,14,1,
+159,6,1,0,6,6,0,1,37,1,7,17,38,0,43,53,1,43,93,53,0,255,255,0,1,0,0,2,33,5,211,2,34,0,215,0,0,1,6,0,67,0,0,0,
+19,64,11,1,0,7,7,0,1,37,1,7,17,38,0,43,53,1,43,53,0,255,255,255,228,0,0,2,200,5,198,2,34,0,215,0,0,1,6,0,216,
+0,0,0,19,64,11,1,0,10,6,0,1,37,1,10,17,38,0,43,53,1,43,53,0,255,255,255,254,0,0,2,173,5,166,2,34,0,215,0,0,1,
+6,0,142,0,0,0,23,64,13,2,1,0,7,10,0,1,37,2,1,7,17,38,0,43,53,53,1,43,53,53,0,255,255,0,123,0,0,4,222,5,186,2,
+34,0,81,0,0,1,7,0,217,1,86,0,0,0,19,64,11,1,0,34,21,0,8,37,1,34,17,38,0,43,53,1,43,53,0,255,255,0,73,255,232,
+5,13,5,211,2,34,0,82,0,0,1,7,0,141,1,86,0,0,0,19,64,11,2,0,28,28,0,7,37,2,29,17,38,0,43,53,1,43,53,0,255,255,
+0,73,255,232,5,13,5,211,2,34,0,82,0,0,1,7,0,67,1,86,0,0,0,19,64,11,2,0,29,29,0,7,37,2,29,17,38,0,43,53,1,43,
+53,0,255,255,0,73,255,232,5,13,5,198,2,34,0,82,0,0,1,7,0,216,1,86,0,0,0,23,64,14,2,0,32,1,0,32,28,0,7,37,2,32,
+17,38,0,43,53,1,43,93,53,0,255,255,0,73,255,232,5,13,5,166,2,34,0,82,0,0,1,7,0,142,1,86,0,0,0,23,64,13,3,2,0,
+29,32,0,7,37,3,2,29,17,38,0,43,53,53,1,43,53,53,0,255,255,0,73,255,232,5,13,5,186,2,34,0,82,0,0,1,7,0,217,1,
+86,0,0,0,19,64,11,2,0,40,27,0,7,37,2,40,17,38,0,43,53,1,43,53,0,255,255,0,119,255,232,4,218,5,211,2,34,0,88,0,
+0,1,7,0,141,1,86,0,0,0,19,64,11,1,0,22,22,9,19,37,1,23,17,38,0,43,53,1,43,53,0,255,255,0,119,255,232,4,218,5,
+211,2,34,0,88,0,0,1,7,0,67,1,86,0,0,0,19,64,11,1,0,23,23,9,19,37,1,23,17,38,0,43,53,1,43,53,0,255,255,0,119,
+255,232,4,218,5,198,2,34,0,88,0,0,1,7,0,216,1,86,0,0,0,23,64,14,1,0,26,1,0,26,22,9,19,37,1,26,17,38,0,43,53,1,
+43,93,53,0,255,255,0,119,255,232,4,218,5,166,2,34,0,88,0,0,1,7,0,142,1,86,0,0,0,23,64,13,2,1,0,23,26,9,19,37,
+2,1,23,17,38,0,43,53,53,1,43,53,53,0,0,1,0,141,254,105,4,213,5,186,0,11,0,42,64,22,0,3,4,9,177,3,10,16,7,27,9,
+4,4,1,6,176,0,9,223,7,1,7,47,93,51,60,253,60,50,47,47,0,63,63,60,253,60,63,49,48,1,33,17,33,17,33,17,33,17,33,
+17,33,1,255,1,96,1,118,254,138,254,160,254,142,1,114,5,186,254,132,254,216,251,83,4,173,1,40,0,2,0,119,3,152,
+2,180,5,212,0,11,0,23,0,38,64,22,3,166,21,21,15,166,9,1,0,166,12,12,6,166,15,18,128,18,144,18,3,18,47,93,237,
+51,47,237,0,63,253,50,47,237,49,48,1,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,51,50,54,2,180,
+168,119,118,168,168,118,119,168,186,59,42,42,60,60,42,42,59,4,182,118,168,168,118,119,167,167,118,42,60,60,42,
+42,59,59,0,2,0,74,254,122,5,22,5,166,0,36,0,45,0,195,64,113,22,31,32,8,9,9,21,19,38,37,11,10,21,9,9,165,10,20,
+20,10,10,20,54,17,1,19,22,17,38,31,40,28,37,32,0,11,8,34,6,21,17,20,27,48,28,1,28,28,40,149,20,17,16,10,6,9,1,
+0,0,34,149,9,6,22,63,0,63,28,2,57,14,207,21,2,21,20,27,28,9,10,43,14,95,28,207,28,2,28,131,27,27,95,0,207,0,2,
+0,131,1,47,1,105,2,224,43,1,43,131,14,46,14,102,2,43,47,237,93,43,47,237,93,51,47,237,93,17,18,57,57,17,18,57,
+57,93,93,0,63,51,237,51,47,57,47,18,57,63,51,237,51,47,93,57,47,18,57,17,18,57,57,17,57,57,17,18,57,57,17,57,
+57,93,135,14,46,43,14,125,16,196,16,60,60,5,196,196,135,16,60,60,14,60,196,49,48,1,5,6,7,6,6,35,34,39,3,39,19,
+38,2,53,52,0,33,50,23,19,23,3,22,22,23,22,23,5,38,38,39,3,22,51,50,54,5,19,38,35,34,6,21,20,22,3,164,1,114,21,
+39,71,253,174,45,134,129,131,122,162,191,1,65,1,3,39,110,129,129,120,101,131,44,32,33,254,148,14,26,31,194,36,
+21,77,120,254,134,182,13,7,88,142,29,1,156,41,99,59,108,137,8,254,146,46,1,96,51,1,11,203,254,1,55,8,1,104,47,
+254,175,32,99,66,49,94,49,47,40,28,253,213,5,95,24,2,17,1,143,180,76,85,0,1,0,113,255,231,5,76,5,211,0,56,0,
+163,64,98,16,33,9,28,13,17,25,20,1,0,34,16,34,2,34,149,2,32,33,1,33,33,9,47,63,48,79,48,2,48,48,51,149,43,7,
+15,9,31,9,2,9,152,25,25,13,145,20,20,7,147,27,25,4,7,1,91,35,121,39,2,16,17,0,3,7,54,32,35,39,27,30,28,48,128,
+47,17,2,54,128,39,33,28,2,47,17,3,3,128,33,39,28,3,128,30,144,30,2,30,47,93,23,51,253,23,50,47,47,47,237,47,
+47,47,237,17,18,57,17,57,57,17,57,18,57,17,57,93,113,0,63,237,60,16,237,51,47,237,93,63,237,51,47,93,57,18,57,
+47,93,60,253,93,60,17,18,57,17,57,17,18,57,49,48,1,33,21,33,6,7,6,7,54,51,50,23,22,51,50,54,55,19,6,6,35,34,
+39,38,38,35,34,7,3,54,53,52,39,35,53,51,38,39,38,53,52,54,54,51,50,22,22,23,5,38,38,35,34,6,21,20,22,2,164,1,
+47,254,244,5,26,21,49,56,40,51,82,112,67,55,81,66,136,99,150,86,94,121,159,76,44,129,156,129,210,2,208,149,38,
+5,6,133,217,184,172,201,139,26,254,130,29,75,48,58,72,14,3,77,239,85,68,52,56,13,20,26,19,30,254,214,50,38,33,
+44,14,91,1,28,151,151,8,37,239,132,21,32,47,125,199,90,77,179,127,60,107,70,76,70,37,69,0,0,2,0,65,254,81,5,8,
+5,211,0,59,0,73,0,176,64,41,20,66,36,66,43,72,3,16,13,38,42,2,18,67,60,47,4,35,0,48,1,64,1,2,1,1,4,149,56,1,
+31,63,32,1,32,32,35,149,25,28,32,184,255,192,64,71,12,14,54,1,64,12,14,54,18,15,67,69,38,60,7,47,62,44,207,1,
+1,1,131,95,0,111,0,2,0,38,131,21,21,0,69,131,239,15,1,15,75,15,105,2,192,32,1,32,131,31,7,131,32,50,80,50,96,
+50,144,50,4,50,50,31,62,131,44,74,44,102,2,43,47,237,51,51,47,93,237,47,237,93,43,47,93,237,51,51,47,237,47,
+93,237,93,17,18,57,17,57,17,18,57,17,57,43,43,0,63,237,51,47,93,57,63,237,51,47,93,57,17,23,57,0,93,49,48,0,
+93,1,5,38,38,35,34,6,21,20,23,22,23,4,23,22,21,20,6,7,22,22,21,20,6,6,35,34,46,3,39,37,22,22,51,50,54,53,52,
+39,38,36,38,53,52,54,55,38,38,53,52,54,54,55,54,51,50,22,22,1,6,21,20,23,22,23,5,54,53,52,39,38,36,4,187,254,
+130,19,67,56,67,62,28,50,184,1,7,103,102,78,87,53,51,107,230,194,124,193,125,81,40,16,1,120,36,92,67,69,69,41,
+57,254,15,166,89,108,51,46,81,130,67,91,143,191,189,120,253,37,52,17,28,110,1,129,45,27,39,254,128,4,135,44,
+57,48,52,40,34,26,46,67,96,92,93,150,88,145,75,58,118,76,104,182,109,42,74,97,89,76,39,73,68,64,47,40,41,56,
+197,194,109,86,145,76,56,108,67,86,143,86,19,26,69,144,253,254,69,42,26,19,32,50,173,68,41,33,26,38,159,0,1,0,
+180,1,133,3,76,4,29,0,11,0,23,64,11,9,9,3,0,0,128,6,144,6,2,6,47,93,51,47,0,47,51,47,49,48,1,20,6,35,34,38,53,
+52,54,51,50,22,3,76,194,138,138,194,194,138,138,194,2,209,137,195,195,137,138,194,194,0,1,0,135,254,105,6,81,
+5,186,0,17,0,42,64,21,9,9,8,1,6,177,17,3,4,8,27,1,8,176,7,7,4,176,1,3,14,47,47,51,253,50,47,237,47,0,63,60,63,
+253,60,17,57,47,49,48,1,17,35,17,33,17,35,17,33,17,35,34,38,38,53,52,36,51,6,81,131,254,215,167,254,215,69,
+202,204,115,1,0,254,5,186,254,195,249,236,6,20,249,236,3,254,99,207,129,201,215,0,1,0,119,255,232,5,14,5,211,
+0,48,0,137,64,11,2,16,13,13,54,21,16,9,11,54,5,184,255,240,64,19,9,11,54,26,44,25,28,21,44,149,5,1,28,149,21,
+22,0,21,8,184,255,240,64,54,19,20,54,26,31,25,38,48,48,8,192,8,2,8,133,143,41,1,41,41,31,48,11,80,11,192,11,3,
+11,133,38,38,48,31,176,15,18,31,18,47,18,3,18,50,18,105,2,48,133,0,49,0,101,2,43,47,237,43,47,93,237,17,57,47,
+237,93,18,57,47,93,237,93,17,18,57,17,57,43,0,63,63,237,63,237,17,18,57,17,57,43,43,49,48,1,43,51,17,52,54,54,
+51,50,22,21,20,6,21,20,22,23,22,23,22,21,20,6,35,34,39,38,39,55,22,51,50,54,53,52,38,39,38,39,38,53,52,54,53,
+52,38,35,34,6,21,17,119,104,239,198,242,215,117,26,44,130,56,38,198,166,122,90,67,65,233,35,34,35,46,55,152,
+78,31,20,118,61,50,57,75,3,249,129,225,120,173,125,82,234,36,27,49,40,119,114,80,98,147,191,42,32,76,138,44,
+46,34,30,82,147,76,59,38,48,59,233,59,45,59,92,118,251,255,0,0,4,0,58,255,221,6,49,5,211,0,15,0,27,0,49,0,58,
+0,144,64,11,26,42,11,20,54,18,42,11,20,54,20,184,255,214,179,11,20,54,24,184,255,214,64,73,11,20,54,4,34,20,
+34,2,35,50,166,47,47,49,58,166,28,28,19,166,12,1,42,49,49,25,166,4,19,35,42,48,54,178,32,32,42,178,15,41,79,
+41,2,79,41,159,41,239,41,3,41,41,16,166,144,0,160,0,2,0,58,48,178,49,49,22,166,144,8,160,8,2,8,47,93,237,51,
+47,253,60,47,93,237,51,47,93,113,237,51,47,237,17,18,57,0,63,237,51,47,60,63,237,51,47,237,17,57,47,237,57,49,
+48,1,93,43,43,43,43,1,20,2,4,35,34,36,2,53,52,18,36,51,50,4,18,7,52,0,35,34,0,21,20,0,51,50,0,1,33,50,22,21,
+20,6,7,22,23,22,23,22,23,35,38,38,35,34,7,17,35,19,51,50,54,53,52,38,35,35,6,49,205,254,158,205,204,254,158,
+205,205,1,98,204,205,1,98,205,148,254,151,255,255,254,151,1,105,255,255,1,105,252,62,1,109,155,139,106,114,47,
+22,31,34,2,130,240,117,80,40,9,16,203,203,88,88,72,69,83,96,2,216,205,254,158,204,204,1,98,205,204,1,99,204,
+204,254,157,204,255,1,105,254,151,255,255,254,151,1,105,2,151,125,105,82,120,27,18,20,28,55,4,232,233,91,3,
+254,191,1,214,57,45,45,57,0,0,3,0,58,255,221,6,49,5,211,0,15,0,27,0,55,0,144,64,11,26,42,11,20,54,18,42,11,20,
+54,20,184,255,214,179,11,20,54,24,184,255,214,64,75,11,20,54,42,47,43,143,43,2,43,43,46,166,0,39,96,39,2,39,
+39,19,166,12,1,29,16,28,32,28,128,28,3,28,28,53,166,15,33,111,33,2,33,33,25,166,4,19,43,178,42,42,28,178,29,
+29,16,166,144,0,160,0,2,0,49,178,36,36,22,166,144,8,160,8,2,8,47,93,237,51,47,237,47,93,237,51,47,237,51,47,
+237,0,63,237,51,47,93,237,51,47,93,57,63,237,51,47,93,237,51,47,93,57,49,48,1,43,43,43,43,1,20,2,4,35,34,36,2,
+53,52,18,36,51,50,4,18,7,52,0,35,34,0,21,20,0,51,50,0,37,23,6,7,6,35,34,38,53,52,54,51,50,22,23,7,38,38,35,34,
+6,21,20,23,22,51,50,54,6,49,205,254,158,205,204,254,158,205,205,1,98,204,205,1,98,205,148,254,151,255,255,254,
+151,1,105,255,255,1,105,254,74,206,38,67,105,169,184,232,238,179,145,198,26,197,18,95,68,78,106,36,53,97,61,
+97,2,216,205,254,158,204,204,1,98,205,204,1,99,204,204,254,157,204,255,1,105,254,151,255,255,254,151,1,105,
+161,49,121,65,101,237,195,185,241,154,122,30,81,79,133,142,143,61,88,90,0,0,2,0,36,2,139,7,73,5,186,0,7,0,20,
+0,142,64,93,64,10,80,10,2,10,18,15,3,9,17,14,16,17,20,5,5,2,7,179,11,9,0,3,112,9,127,11,2,11,11,79,11,95,11,
+111,11,4,4,9,64,9,80,9,96,9,4,11,16,15,17,9,10,10,18,79,15,95,15,2,15,178,13,13,64,18,80,18,2,18,178,15,20,32,
+20,64,20,3,20,20,2,7,2,2,64,4,80,4,2,4,178,7,5,47,51,253,93,50,47,47,17,51,47,93,237,93,51,47,237,93,17,57,18,
+57,57,17,57,57,93,93,93,0,63,60,60,253,60,50,47,60,60,60,60,17,18,23,57,93,49,48,19,33,21,33,17,35,17,33,37,
+33,19,19,33,17,35,17,3,35,3,17,35,36,3,33,254,227,235,254,231,3,126,1,101,113,119,1,90,221,153,185,151,225,5,
+186,194,253,147,2,109,194,254,67,1,189,252,209,2,64,253,192,2,64,253,192,0,1,0,163,4,168,2,169,5,211,0,3,0,31,
+64,16,0,3,16,3,2,3,3,0,4,1,1,0,0,3,161,2,47,253,50,47,51,47,0,63,51,47,93,49,48,1,33,1,35,1,75,1,94,254,189,
+195,5,211,254,213,0,2,255,254,4,172,2,173,5,166,0,3,0,7,0,27,64,13,7,3,164,4,0,3,6,164,7,7,3,164,2,47,237,51,
+47,237,0,63,60,253,60,49,48,3,33,21,33,37,33,21,33,2,1,4,254,252,1,168,1,7,254,249,5,166,250,250,250,0,0,1,0,
+98,255,64,4,221,6,120,0,19,0,118,64,65,86,4,1,4,7,8,11,12,12,3,1,18,17,14,13,2,2,3,12,12,167,13,2,20,13,13,2,
+3,2,2,5,0,177,6,19,12,13,13,10,15,177,9,19,16,2,12,13,3,3,6,32,10,80,10,112,10,3,10,95,13,1,13,13,19,15,47,60,
+51,47,93,47,93,60,51,47,18,57,57,0,47,51,60,253,60,50,47,60,47,60,253,60,50,47,60,135,5,46,43,135,125,196,7,
+60,60,60,60,135,16,60,60,196,60,49,48,1,93,19,33,19,33,3,33,17,33,7,33,17,33,3,33,19,33,17,33,55,33,98,2,83,
+202,1,20,201,1,19,254,113,67,1,210,253,175,203,254,233,203,254,237,1,147,65,254,44,4,117,2,3,253,253,254,188,
+168,254,188,253,251,2,5,1,68,168,0,0,2,255,180,0,0,7,183,5,186,0,15,0,19,0,125,64,78,17,13,14,16,16,16,0,3,17,
+145,13,13,11,0,4,16,4,2,4,145,16,7,80,7,144,7,3,0,7,48,7,64,7,208,7,4,208,7,1,111,7,1,7,7,8,3,145,0,3,8,145,
+15,14,11,18,6,2,2,6,10,21,10,111,2,14,13,17,0,16,5,11,15,3,8,127,19,15,11,47,51,60,253,60,47,18,23,57,43,47,
+51,51,47,47,0,63,60,60,237,63,237,17,57,47,93,93,113,114,237,93,18,57,47,237,17,18,57,47,7,5,60,60,49,48,1,33,
+17,33,21,33,17,33,17,33,17,33,17,33,3,33,1,3,33,17,2,44,5,120,253,150,2,50,253,206,2,125,251,217,254,77,97,
+254,56,3,119,211,1,56,5,186,254,199,233,254,213,254,223,254,180,1,7,254,249,4,145,253,196,2,60,0,3,0,35,255,
+204,6,135,5,236,0,23,0,31,0,39,0,131,64,74,3,32,33,14,15,15,2,0,24,31,17,16,16,1,3,0,2,3,22,33,31,32,24,4,26,
+16,14,17,3,35,10,1,26,145,22,4,15,35,145,10,19,0,3,1,3,6,31,33,24,32,4,38,15,17,14,3,29,19,2,38,125,6,41,6,
+111,2,16,29,125,19,40,19,108,2,43,47,237,51,43,47,237,51,17,18,23,57,17,23,57,18,23,57,0,63,237,51,63,237,51,
+17,18,23,57,17,23,57,18,23,57,7,14,16,60,4,60,14,60,60,7,14,16,60,60,4,60,14,60,49,48,1,55,23,7,22,22,21,16,2,
+4,35,34,39,38,39,7,39,55,38,17,16,0,33,32,3,38,35,34,6,21,20,23,1,1,22,51,50,54,53,52,5,66,174,151,173,53,60,
+185,254,187,247,176,139,90,88,175,151,176,119,1,143,1,99,1,59,107,75,131,137,166,10,2,83,254,11,73,130,145,
+161,5,72,164,161,164,80,243,133,254,255,254,181,172,45,29,66,167,159,168,185,1,13,1,105,1,145,254,96,73,193,
+217,68,69,1,4,254,38,73,188,232,64,0,0,3,0,19,1,128,4,154,4,58,0,23,0,36,0,48,0,62,64,34,12,12,37,45,34,166,3,
+28,166,144,9,1,9,9,45,166,15,15,3,39,166,21,37,12,0,24,4,42,31,166,6,42,166,18,47,237,47,237,17,23,57,0,47,
+237,51,51,47,237,51,47,93,237,47,237,17,18,57,47,49,48,1,54,54,51,50,22,21,20,6,35,34,38,39,6,6,35,34,38,53,
+52,54,51,50,22,23,30,2,51,50,54,53,52,38,35,34,6,5,38,35,34,6,21,20,22,51,50,55,54,2,36,74,154,95,132,175,175,
+132,94,154,75,60,156,71,101,141,141,101,71,156,153,67,54,71,41,76,82,90,65,54,104,254,255,100,90,46,67,66,47,
+39,31,54,3,86,121,107,187,162,162,187,106,122,84,88,157,136,136,156,88,202,103,63,37,118,87,94,104,78,120,141,
+74,66,68,76,21,36,0,0,2,0,127,0,0,4,194,5,165,0,11,0,15,0,75,64,44,175,2,1,2,2,5,0,177,6,15,11,1,95,11,175,11,
+191,11,3,11,11,9,9,12,177,15,24,15,240,11,1,11,14,6,6,3,8,176,2,11,223,9,1,9,47,93,51,60,253,60,50,47,60,47,
+93,60,0,63,253,50,47,51,47,93,113,60,253,60,50,47,93,49,48,19,33,17,33,17,33,17,33,17,33,17,33,17,33,17,33,
+127,1,127,1,67,1,129,254,127,254,189,254,129,4,67,251,189,4,48,1,117,254,139,254,197,254,156,1,100,254,62,254,
+205,0,2,0,98,255,132,4,223,5,232,0,6,0,10,0,115,64,66,2,5,4,4,175,3,2,20,3,3,2,1,5,6,6,175,0,1,20,0,0,1,2,3,1,
+5,0,10,177,0,7,1,7,7,6,177,0,4,177,3,3,0,5,10,5,1,5,1,9,3,4,6,80,0,96,0,2,0,10,2,80,1,96,1,2,1,47,93,60,60,47,
+93,60,60,60,60,18,57,93,0,25,47,51,51,24,47,237,47,237,51,47,93,237,17,18,57,17,57,135,46,43,135,125,196,135,
+46,24,43,135,125,196,49,48,1,1,17,1,17,9,2,33,17,33,4,223,251,131,4,125,253,65,2,191,251,131,4,125,251,131,1,
+17,1,214,1,38,1,219,254,162,254,241,254,244,254,89,254,188,0,255,255,0,105,255,132,4,230,5,232,0,71,0,148,5,
+72,0,0,192,0,64,0,0,1,255,254,0,0,5,88,5,186,0,22,0,194,64,110,70,5,182,5,2,5,5,4,22,21,22,0,8,19,20,9,18,17,
+12,15,16,2,3,2,1,3,163,4,5,20,4,4,5,2,1,2,3,1,163,0,22,20,0,0,22,2,0,21,11,16,178,10,0,17,1,17,17,6,21,178,7,
+20,20,4,3,1,0,3,14,18,7,63,11,1,11,20,16,2,13,22,1,14,0,0,1,0,5,3,15,4,111,4,2,4,4,11,8,13,127,19,0,16,96,14,
+128,14,192,14,3,14,47,93,51,51,60,253,60,50,50,47,93,57,57,47,93,18,57,57,17,57,47,60,47,93,60,0,63,63,60,60,
+60,57,47,60,253,60,51,47,113,60,253,60,17,18,57,135,5,46,43,8,125,16,196,135,5,46,24,43,8,125,16,196,2,4,16,
+60,60,16,60,60,16,60,60,8,16,60,8,60,49,48,1,93,3,33,19,19,33,1,33,21,33,21,33,21,33,17,33,17,33,53,33,53,33,
+53,33,2,1,201,229,226,1,202,254,163,1,41,254,91,1,165,254,91,254,96,254,84,1,172,254,84,1,50,5,186,254,14,1,
+242,253,136,221,121,224,254,244,1,12,224,121,221,0,1,0,120,254,110,4,220,4,38,0,24,0,66,64,42,79,16,1,22,64,
+22,25,54,14,64,20,42,54,22,14,13,21,6,151,18,22,24,27,10,0,15,13,9,133,12,26,12,104,2,1,23,133,24,25,24,101,2,
+43,47,253,60,43,47,253,57,0,63,60,63,63,237,63,57,57,43,43,113,49,48,19,33,17,20,23,22,51,50,54,53,17,33,17,
+33,53,6,7,6,35,34,39,38,39,17,33,120,1,152,30,44,83,77,76,1,150,254,130,33,31,49,52,48,53,35,33,254,104,4,38,
+253,234,114,42,65,117,115,2,11,251,218,84,56,20,32,29,19,53,254,33,0,0,2,0,85,255,233,3,209,5,154,0,31,0,46,0,
+75,64,39,23,32,43,35,35,21,21,29,43,1,1,29,29,4,3,43,43,12,22,23,32,40,25,25,7,48,7,111,2,0,1,40,40,1,16,47,
+16,108,2,43,47,51,51,47,47,51,43,47,51,47,18,57,57,0,63,51,47,63,51,47,51,47,17,18,57,47,51,47,18,57,57,49,48,
+1,35,54,54,51,50,22,21,16,2,7,6,35,34,38,38,53,52,62,2,51,50,23,54,53,52,39,38,35,34,6,1,38,38,35,34,7,6,2,21,
+20,22,51,50,55,54,1,121,42,52,181,115,152,142,212,132,97,135,97,144,75,123,180,191,93,164,72,8,116,71,126,81,
+101,1,215,34,111,69,70,66,86,115,60,59,99,101,166,4,126,146,138,204,189,254,152,253,247,105,78,79,155,82,130,
+245,177,89,150,82,45,171,94,58,40,254,9,103,89,61,80,254,148,166,97,71,117,195,0,0,1,0,43,254,81,5,140,5,211,
+0,21,0,124,64,65,12,13,13,156,3,4,20,3,13,14,3,4,13,14,13,12,14,158,2,3,20,2,2,3,13,3,14,4,5,12,8,8,12,12,5,1,
+2,1,21,14,20,20,14,14,1,28,14,12,3,3,2,13,13,2,8,7,7,6,20,21,21,6,0,4,2,47,60,47,51,51,47,51,47,51,47,51,17,
+57,47,18,23,57,0,63,51,47,51,47,18,57,17,57,63,51,47,51,47,17,18,57,18,57,57,135,5,46,43,8,125,16,196,135,8,
+46,24,43,5,125,16,196,49,48,1,33,53,1,1,53,33,19,35,38,38,35,33,1,1,33,50,55,54,54,55,23,5,76,250,223,2,157,
+253,99,4,254,27,40,16,123,110,253,28,2,50,253,139,3,50,70,83,57,75,25,40,254,81,36,3,164,3,149,37,254,176,137,
+119,252,236,252,146,28,18,97,104,8,0,1,0,46,254,81,6,104,5,211,0,37,0,71,64,39,1,21,18,157,1,19,1,30,33,6,9,
+157,32,8,28,20,31,32,32,37,179,31,26,39,26,110,2,19,8,7,7,2,179,8,13,38,13,107,2,43,47,51,253,50,47,47,60,43,
+47,51,253,50,47,47,60,0,63,60,253,60,60,60,63,51,253,60,47,49,48,1,33,17,20,22,51,51,21,33,53,51,50,54,53,17,
+52,38,35,35,53,33,21,35,34,6,21,17,20,22,51,51,21,33,53,51,50,54,53,4,216,252,229,74,88,36,253,171,35,88,75,
+74,89,35,6,58,35,88,74,74,88,35,253,171,35,88,74,5,133,249,140,83,72,37,37,72,83,6,2,83,72,37,37,72,83,249,
+254,83,72,37,37,72,83,0,0,1,0,51,0,0,5,102,4,39,0,11,0,48,64,27,2,7,11,150,0,15,5,9,21,2,2,5,176,4,13,4,104,2,
+11,11,8,176,9,12,9,101,2,43,47,237,51,47,43,47,237,51,47,0,63,60,63,253,60,60,49,48,19,33,21,35,17,33,17,33,
+17,33,17,35,51,5,51,169,254,224,254,97,254,220,167,4,39,202,252,163,3,93,252,163,3,93,0,1,255,253,255,36,2,45,
+7,71,0,46,0,49,64,23,16,6,12,40,37,31,12,12,6,31,31,37,18,19,43,0,34,9,9,23,166,34,0,47,51,253,50,47,47,17,57,
+57,0,63,51,47,47,51,47,17,18,57,17,18,57,49,48,19,19,62,3,51,50,22,21,20,6,35,34,39,38,35,34,6,21,20,23,18,21,
+20,3,6,7,14,2,35,34,38,53,52,54,51,50,22,51,50,54,53,52,39,2,198,18,9,45,46,79,37,50,75,53,39,35,41,23,17,17,
+23,9,37,14,5,15,20,64,77,45,52,66,51,39,40,58,20,17,22,9,37,3,180,2,36,113,148,61,45,67,40,47,57,36,20,29,35,
+42,103,254,102,255,67,254,53,164,92,122,106,44,68,53,45,54,64,28,33,42,78,1,59,0,2,0,33,2,232,2,249,5,211,0,
+34,0,46,0,88,64,51,23,22,64,13,22,54,22,22,19,35,166,16,16,19,3,1,1,43,179,0,7,1,7,7,19,179,27,1,1,3,16,46,
+178,0,79,32,223,32,2,32,22,178,23,23,32,40,178,15,10,1,10,47,113,237,51,51,47,237,47,93,51,253,60,57,57,0,63,
+237,51,47,93,237,51,47,57,17,57,47,237,18,57,47,43,57,49,48,1,35,38,39,6,7,6,35,34,38,53,52,55,54,55,54,55,52,
+38,35,34,6,7,39,62,2,51,50,23,22,21,17,20,22,3,6,6,7,6,21,20,22,51,50,54,53,2,249,218,15,9,46,44,62,82,125,
+127,53,52,172,104,86,44,57,53,49,13,221,19,70,112,111,212,70,69,13,239,57,130,23,24,52,45,63,74,2,249,31,36,
+43,17,24,118,97,88,53,53,31,18,31,56,43,34,44,43,71,81,42,56,57,124,254,175,62,57,1,42,20,25,22,22,30,36,48,
+80,84,0,2,0,23,2,231,3,20,5,211,0,13,0,26,0,39,64,21,6,25,1,18,179,0,10,1,10,10,24,179,4,1,21,178,7,7,14,178,
+0,47,237,51,47,237,0,63,237,51,47,93,237,49,48,1,113,19,52,54,54,51,50,22,21,20,6,35,34,38,38,55,20,23,22,51,
+50,54,53,52,38,35,34,6,23,86,180,124,172,203,206,168,133,180,78,248,43,33,64,57,74,75,60,61,75,4,93,95,179,
+100,206,171,165,206,109,180,85,108,52,40,92,108,110,93,93,0,0,1,0,144,0,0,6,83,5,223,0,40,0,109,64,69,134,29,
+1,89,2,86,26,102,29,118,29,4,20,36,28,15,0,39,38,16,150,19,19,39,150,38,18,28,150,8,1,15,15,19,63,19,111,19,3,
+19,18,18,19,25,176,12,42,12,111,2,0,0,37,48,37,96,37,3,37,38,38,37,31,176,5,41,5,108,2,43,47,237,51,51,47,47,
+93,57,43,47,237,51,51,47,47,93,57,0,63,237,63,237,60,16,237,17,18,57,57,17,57,57,49,48,1,93,93,37,38,39,38,38,
+53,16,0,33,50,4,18,21,20,2,7,37,51,21,33,53,54,55,54,54,53,52,38,35,34,2,21,20,22,23,22,23,21,33,53,51,2,39,
+116,69,101,99,1,127,1,61,233,1,57,187,187,195,1,74,72,253,126,97,56,76,77,229,178,170,229,87,81,52,92,253,123,
+98,206,49,63,90,252,151,1,54,1,126,158,254,181,201,202,254,195,86,23,231,243,47,58,80,229,127,247,253,254,253,
+236,136,234,81,52,43,243,230,0,3,0,69,255,232,7,198,4,63,0,57,0,64,0,79,0,182,64,49,48,44,35,16,74,19,39,38,
+64,9,10,54,38,38,35,65,150,32,32,35,64,9,8,8,5,64,150,1,1,5,61,64,9,12,54,61,149,51,16,35,64,9,12,54,35,149,
+44,16,5,184,255,192,183,9,10,54,5,149,12,12,74,184,255,192,64,52,9,12,54,74,149,19,22,22,16,19,22,54,16,48,64,
+3,1,131,32,48,79,144,79,192,79,3,79,79,58,71,8,131,9,9,58,131,0,81,0,105,2,38,131,39,39,71,131,22,80,22,102,2,
+43,47,237,51,47,237,43,47,237,51,47,237,17,18,57,47,93,60,237,23,57,43,0,63,237,43,60,16,237,43,63,237,43,63,
+237,43,17,57,47,237,18,57,47,57,17,18,57,47,237,18,57,47,43,57,17,18,57,17,18,57,49,48,1,33,22,23,22,51,50,54,
+55,5,6,4,35,34,39,38,39,6,6,35,34,38,53,52,54,55,54,55,54,36,55,54,55,38,38,35,34,6,7,37,54,55,54,54,51,50,23,
+22,23,54,54,51,50,22,22,23,22,21,37,38,38,35,34,6,7,5,7,6,7,6,6,21,20,22,51,50,54,55,54,53,7,198,252,253,11,
+36,55,89,50,73,35,1,141,81,254,255,215,165,119,90,83,123,221,135,203,204,64,49,65,76,35,1,16,39,67,89,2,61,81,
+85,84,17,254,121,29,39,53,217,197,158,102,73,88,92,151,103,154,221,140,30,39,254,106,8,89,81,72,103,15,254,
+121,125,24,18,99,79,66,54,55,116,31,23,1,175,96,47,71,45,55,35,151,155,48,36,84,90,78,171,138,69,122,36,47,26,
+12,52,10,17,30,80,58,61,66,45,106,54,74,91,28,20,57,58,46,88,151,75,99,175,128,103,114,104,113,119,41,8,3,19,
+76,41,46,64,56,57,41,68,0,3,0,73,255,159,5,12,4,132,0,25,0,35,0,45,0,182,64,9,26,64,9,12,54,57,1,1,26,184,255,
+192,64,9,9,12,54,0,64,9,17,54,13,184,255,192,64,87,9,17,54,2,45,36,12,13,13,1,25,26,35,15,14,0,0,1,13,13,165,
+14,0,20,14,14,0,25,2,1,36,35,45,26,4,30,15,12,40,14,0,1,15,30,149,21,16,13,14,21,40,149,8,22,25,2,0,1,4,5,35,
+36,26,45,4,43,14,13,15,12,4,33,18,43,131,5,47,5,105,2,33,131,18,46,18,102,2,43,47,237,43,47,237,17,18,23,57,
+17,23,57,18,23,57,0,63,237,63,51,63,237,63,51,17,18,57,57,17,23,57,18,57,57,135,14,46,43,135,14,125,196,135,
+14,196,196,196,60,7,14,16,60,60,60,60,49,48,0,43,43,43,93,1,43,1,23,7,22,22,21,20,0,33,34,39,38,39,7,39,55,38,
+38,53,52,0,33,50,23,22,23,7,38,39,38,35,34,6,21,20,23,23,22,23,22,51,50,54,53,52,39,4,129,104,124,69,90,254,
+190,254,235,113,86,59,90,133,105,127,85,76,1,70,1,19,112,88,59,87,199,28,20,39,49,101,131,17,75,33,21,40,48,
+98,127,17,4,132,94,136,58,212,124,244,254,200,19,13,43,148,97,135,91,184,116,245,1,59,21,14,44,222,27,8,16,
+155,159,53,73,126,26,8,14,155,166,51,66,255,255,0,73,254,83,4,154,4,38,1,15,0,34,4,227,4,38,192,0,0,9,179,1,0,
+30,15,0,63,53,53,0,255,255,0,124,254,108,2,47,4,38,1,71,0,4,0,0,4,38,64,0,192,0,0,9,179,1,0,9,15,0,63,53,53,0,
+0,1,0,126,1,60,4,194,4,109,0,5,0,25,64,12,3,3,0,177,5,3,176,32,2,1,2,5,47,47,93,237,0,47,237,51,47,49,48,19,
+33,17,33,17,33,126,4,68,254,186,253,2,4,109,252,207,1,236,0,1,0,84,255,178,4,100,7,77,0,7,0,127,64,66,16,7,1,
+3,4,4,160,5,6,20,5,5,6,3,6,7,7,148,2,3,20,2,7,0,2,3,0,7,7,160,2,1,20,2,7,6,2,1,7,4,5,3,3,4,4,2,6,15,2,19,1,0,
+7,3,0,1,2,2,3,1,4,6,5,5,3,6,25,47,51,51,24,47,18,57,47,25,18,57,47,18,57,18,57,0,24,47,60,63,63,18,57,47,17,
+23,57,135,8,46,43,5,125,16,196,135,8,46,24,43,135,14,125,196,135,14,46,24,43,14,125,16,196,49,48,0,93,1,51,1,
+1,7,39,37,1,4,26,74,254,200,254,16,198,34,1,45,1,149,7,77,248,101,3,253,91,64,151,252,201,0,0,1,0,37,254,81,5,
+55,5,211,0,32,0,219,64,47,20,3,4,32,17,2,16,15,20,17,2,0,4,32,18,1,19,15,20,18,1,2,1,64,20,25,54,1,64,9,10,54,
+1,1,26,19,32,4,4,135,15,20,20,15,15,20,24,184,255,240,64,48,9,11,54,7,16,18,19,54,7,16,9,12,54,26,24,27,29,18,
+10,17,9,12,7,2,17,149,1,16,18,1,18,29,149,24,1,12,149,7,28,10,15,0,9,1,9,18,20,17,184,255,192,64,27,9,10,54,
+17,27,26,64,12,13,54,31,26,1,26,32,17,26,3,48,20,1,20,9,4,20,3,15,184,255,192,179,20,21,54,15,184,255,192,179,
+15,17,54,15,47,43,43,23,51,47,93,23,51,47,93,43,51,47,43,18,57,47,93,18,57,0,63,237,63,237,47,93,60,253,60,17,
+18,57,17,57,17,18,57,17,57,43,43,43,135,14,46,43,14,125,16,196,1,24,17,18,57,47,43,43,51,15,15,15,15,0,46,49,
+48,1,51,3,35,3,6,6,35,34,39,19,22,51,50,54,55,19,35,19,51,55,62,2,51,50,23,3,38,35,34,6,7,3,218,198,63,195,
+188,27,173,159,148,194,73,103,51,39,44,17,156,191,59,195,45,17,81,154,110,166,179,73,93,60,39,45,22,3,231,254,
+222,252,142,126,132,59,1,4,36,43,81,2,221,1,34,213,85,126,68,62,254,250,39,47,89,0,0,2,0,99,0,251,4,222,4,191,
+0,20,0,41,0,129,64,21,187,21,180,31,2,11,21,4,31,2,187,0,180,10,2,11,0,4,10,2,31,184,255,240,179,10,12,54,10,
+184,255,240,64,53,10,12,54,9,10,6,21,185,10,182,21,4,21,177,22,22,35,177,29,29,25,177,40,40,31,177,176,32,1,
+32,0,177,1,1,14,177,8,8,19,177,4,4,11,177,32,10,1,15,22,1,22,10,31,47,60,47,93,60,0,47,51,237,51,47,237,51,47,
+237,51,47,237,47,93,237,51,47,253,50,47,237,51,47,237,93,43,43,49,48,0,93,93,93,93,1,17,6,6,35,34,38,38,35,34,
+7,17,54,54,51,50,30,2,51,50,19,17,6,6,35,34,38,38,35,34,7,17,54,54,51,50,30,2,51,50,4,222,115,142,76,58,117,
+249,72,154,164,93,162,96,49,108,209,88,39,134,169,115,142,76,58,117,249,72,154,164,93,162,96,49,108,209,88,39,
+134,4,189,254,187,93,61,34,126,161,1,73,83,70,31,102,25,254,186,254,186,92,62,34,126,160,1,73,83,69,31,101,26,
+0,2,0,26,0,0,4,202,5,107,0,2,0,5,0,94,64,50,0,4,3,4,5,3,180,0,2,20,0,0,2,4,5,4,3,5,160,1,2,20,1,1,2,4,5,2,3,5,
+5,1,18,3,0,4,5,2,31,1,95,1,2,1,1,0,112,2,1,2,25,47,93,51,51,24,47,93,18,57,57,47,57,0,63,51,47,60,47,18,57,
+135,5,46,43,8,125,16,196,135,5,46,24,43,8,125,16,196,0,46,49,48,33,33,9,3,4,202,251,80,2,116,1,80,254,113,254,
+72,5,107,250,231,3,199,252,57,0,2,0,95,0,71,4,221,3,228,0,5,0,11,0,72,64,38,5,66,8,66,2,11,11,10,0,6,6,4,10,4,
+0,176,3,47,1,1,1,1,2,176,5,10,6,176,9,7,7,5,11,176,192,8,1,8,47,93,237,51,51,47,60,253,60,47,253,50,47,93,60,
+253,60,0,47,60,51,47,60,25,18,57,47,60,229,228,49,48,1,33,1,1,33,1,3,33,1,1,33,1,3,164,1,57,254,235,1,21,254,
+199,254,194,200,1,56,254,235,1,21,254,200,254,193,3,228,254,49,254,50,1,206,1,207,254,49,254,50,1,206,0,255,
+255,0,121,0,71,4,247,3,228,0,71,0,169,5,86,0,0,192,0,64,0,255,255,0,124,0,0,7,132,1,152,0,38,0,17,0,0,0,39,0,
+17,2,171,0,0,0,7,0,17,5,85,0,0,255,255,0,2,0,0,6,62,7,62,2,34,0,36,0,0,1,7,0,67,1,200,1,107,0,19,64,11,2,0,14,
+14,4,5,37,2,14,5,38,0,43,53,1,43,53,0,255,255,0,2,0,0,6,62,7,37,2,34,0,36,0,0,1,7,0,217,1,200,1,107,0,19,64,
+11,2,0,25,12,4,5,37,2,25,5,38,0,43,53,1,43,53,0,255,255,0,93,255,231,6,76,7,37,2,34,0,50,0,0,1,7,0,217,2,0,1,
+107,0,19,64,11,2,0,40,27,0,6,37,2,40,5,38,0,43,53,1,43,53,0,0,2,0,71,255,230,7,192,5,211,0,27,0,43,0,124,64,
+80,27,0,28,145,24,4,12,11,36,145,16,19,0,4,16,4,2,4,145,16,7,80,7,144,7,3,0,7,48,7,64,7,208,7,4,208,7,1,111,7,
+1,7,7,8,3,145,0,3,8,145,11,18,56,20,1,40,32,3,8,127,0,11,11,10,6,2,2,6,10,45,10,111,2,32,125,20,44,20,108,2,
+43,47,237,43,47,51,51,47,47,17,57,47,60,253,60,18,57,93,0,63,237,63,237,17,57,47,93,93,113,114,237,93,63,237,
+17,57,63,253,17,57,49,48,1,33,17,33,21,33,17,33,17,33,17,33,53,6,7,6,35,34,39,38,17,16,55,54,51,50,22,23,5,34,
+6,6,21,20,22,22,51,50,54,54,53,52,38,38,3,245,3,173,253,226,1,230,254,26,2,60,252,53,64,74,98,138,249,143,176,
+173,146,230,133,185,75,254,240,74,121,47,63,120,59,61,124,56,53,119,5,186,254,199,233,254,213,254,223,254,180,
+162,93,41,54,168,208,1,122,1,126,207,174,91,89,156,95,158,196,164,157,78,85,156,199,162,160,86,0,3,0,59,255,
+232,7,200,4,62,0,33,0,40,0,52,0,142,64,34,13,16,9,11,54,26,23,50,13,44,16,8,7,7,4,40,150,1,1,4,37,64,9,12,54,
+37,149,29,29,50,149,23,16,4,184,255,192,64,12,9,10,54,4,149,11,11,44,149,16,22,26,184,255,240,64,36,9,11,54,
+13,26,40,3,1,131,48,47,192,47,2,47,47,34,41,7,131,8,8,34,131,0,54,0,105,2,41,131,19,53,19,102,2,43,47,237,43,
+47,237,51,47,237,17,18,57,47,93,237,23,57,43,0,63,237,60,16,237,43,63,237,60,16,237,43,17,57,47,237,18,57,47,
+57,17,18,57,17,18,57,43,49,48,1,33,22,22,51,50,54,55,5,6,4,35,34,39,6,6,35,32,0,53,16,55,54,51,50,22,23,54,54,
+51,32,0,17,20,37,38,38,35,34,6,7,5,20,22,51,50,54,53,52,38,35,34,6,7,198,252,251,9,98,79,52,76,36,1,136,67,
+254,232,193,244,171,99,165,100,254,253,254,190,201,143,231,112,172,103,92,188,117,1,11,1,51,254,103,12,92,76,
+75,101,14,253,21,87,83,84,92,92,69,88,97,1,180,118,100,46,52,36,149,155,118,65,53,1,63,248,1,19,156,112,54,69,
+62,61,254,204,254,240,23,146,118,97,101,114,86,148,122,116,167,139,115,116,0,1,255,244,1,168,4,12,2,134,0,3,0,
+13,180,0,150,3,2,3,47,47,0,47,237,49,48,3,33,21,33,12,4,24,251,232,2,134,222,0,0,1,255,244,1,168,8,12,2,134,0,
+3,0,13,180,0,150,3,2,3,47,47,0,47,237,49,48,3,33,21,33,12,8,24,247,232,2,134,222,0,255,255,0,55,2,163,3,229,5,
+211,0,38,0,182,241,0,1,7,0,182,1,236,0,0,0,46,64,31,1,95,12,143,12,159,12,3,15,12,31,12,63,12,79,12,4,12,0,
+192,1,208,1,2,1,1,0,16,1,5,1,0,63,63,53,53,1,47,93,53,47,93,93,53,255,255,0,55,2,163,3,229,5,211,0,38,0,183,
+241,0,1,7,0,183,1,236,0,0,0,46,64,31,1,95,11,143,11,159,11,3,15,11,31,11,63,11,79,11,4,11,0,192,0,208,0,2,0,1,
+0,11,1,0,1,0,63,63,53,53,1,47,93,53,47,93,93,53,0,1,0,70,2,163,1,249,5,211,0,10,0,45,64,17,6,5,1,173,9,9,5,1,
+5,9,6,6,9,9,0,133,1,184,255,192,179,15,19,54,1,47,43,237,57,47,50,47,18,57,0,63,51,47,237,18,57,49,48,1,33,17,
+52,54,55,23,6,6,7,51,1,249,254,77,154,187,94,115,88,5,208,2,163,1,79,185,214,82,178,54,107,73,0,1,0,70,2,163,
+1,249,5,211,0,10,0,45,64,17,6,5,5,10,173,0,1,5,9,6,6,10,9,9,2,133,10,184,255,192,179,15,19,54,10,47,43,237,57,
+47,17,51,47,18,57,0,63,253,50,47,57,49,48,19,33,17,20,6,7,39,54,54,55,35,70,1,179,154,186,95,116,87,5,208,5,
+211,254,177,185,215,81,178,54,107,73,0,0,3,0,127,0,105,4,194,5,76,0,3,0,7,0,11,0,70,181,11,173,128,8,1,8,184,
+255,192,64,34,9,11,54,8,0,173,143,3,1,3,64,9,11,54,3,3,4,177,8,7,0,7,96,7,2,7,6,6,2,10,133,3,7,11,47,51,60,
+253,60,50,47,47,93,0,47,51,253,50,47,43,113,237,47,43,113,237,49,48,1,33,17,33,5,33,17,33,5,33,17,33,1,214,1,
+145,254,111,254,169,4,67,251,189,1,87,1,145,254,111,5,76,254,143,91,254,186,92,254,139,0,2,0,47,0,0,3,199,5,
+142,0,5,0,9,0,162,64,99,6,7,6,9,7,160,4,5,20,4,7,8,4,5,6,9,6,7,9,160,1,0,20,1,9,8,1,0,7,8,7,6,8,160,3,4,20,3,
+8,9,3,4,9,8,9,6,8,160,2,1,20,2,8,7,2,1,8,4,7,9,1,6,6,3,0,5,2,3,18,0,2,9,3,64,1,144,1,208,1,3,1,7,3,5,3,6,0,4,
+1,4,4,1,8,128,6,192,6,2,6,25,47,93,60,51,51,24,47,93,18,23,57,47,93,23,57,0,63,60,47,60,18,23,57,135,8,46,43,
+8,125,16,196,135,8,46,24,43,8,125,16,196,135,8,46,24,43,8,125,16,196,135,8,46,24,43,8,125,16,196,49,48,9,2,35,
+1,1,23,9,2,2,37,1,162,254,94,111,254,121,1,135,57,254,172,1,84,1,103,5,142,253,55,253,59,2,197,2,201,97,253,
+152,253,153,2,103,0,255,255,0,5,254,81,4,234,5,166,2,34,0,92,0,0,1,7,0,142,1,29,0,0,0,23,64,13,2,1,0,21,24,0,
+4,37,2,1,21,17,38,0,43,53,53,1,43,53,53,0,255,255,0,2,0,0,6,61,7,17,2,34,0,60,0,0,1,7,0,142,1,200,1,107,0,23,
+64,13,2,1,0,12,15,0,4,37,2,1,12,5,38,0,43,53,53,1,43,53,53,0,0,1,254,115,255,203,2,226,5,211,0,3,0,41,64,21,0,
+1,2,2,180,3,0,20,3,3,0,1,0,7,2,3,25,0,1,2,3,47,51,47,51,0,63,60,63,60,135,5,46,43,135,125,196,49,48,1,51,1,35,
+2,11,215,252,102,213,5,211,249,248,0,0,1,0,18,255,231,5,33,5,211,0,37,0,233,64,47,2,12,184,37,24,15,1,72,15,1,
+8,15,24,15,40,15,3,15,19,31,22,184,34,7,19,23,19,2,9,8,19,24,19,72,19,3,13,0,19,19,4,29,26,145,27,64,27,184,
+255,240,64,30,13,14,54,8,27,1,27,29,145,24,4,7,145,7,6,1,9,0,6,4,145,64,9,19,7,31,1,16,3,31,184,255,232,64,19,
+11,13,54,2,37,31,34,4,36,6,22,19,12,15,4,17,26,6,6,184,255,192,64,31,15,19,54,6,39,33,1,32,199,1,215,1,231,1,
+3,0,0,16,1,0,7,17,1,2,36,125,17,21,14,20,13,184,255,240,178,14,13,17,47,220,197,56,198,16,196,16,253,95,93,
+222,197,56,95,93,198,16,196,16,198,43,1,24,16,198,17,23,57,17,18,23,57,43,1,95,94,93,0,24,63,26,77,253,214,95,
+94,93,237,63,253,198,93,43,0,26,24,16,77,237,17,18,57,47,95,94,93,94,93,60,253,60,16,213,93,113,93,60,253,60,
+49,48,1,7,33,22,51,50,55,17,6,35,32,0,39,35,55,51,38,53,52,55,35,55,51,18,33,50,23,3,38,35,34,7,33,7,33,6,21,
+21,3,231,43,254,209,59,197,216,188,156,221,254,155,254,170,38,181,48,110,2,2,133,47,109,130,2,72,191,196,90,
+136,148,194,68,1,104,43,254,160,2,2,172,182,187,140,254,139,107,1,70,201,182,15,38,40,18,182,2,2,102,254,149,
+125,174,182,20,38,53,0,0,1,0,23,0,71,2,142,3,228,0,5,0,36,64,16,2,5,5,4,0,0,4,4,0,176,3,1,1,2,176,5,47,253,50,
+47,60,253,60,0,47,51,47,25,18,57,47,60,49,48,1,33,1,1,33,1,1,86,1,56,254,235,1,21,254,200,254,193,3,228,254,
+49,254,50,1,206,255,255,0,28,0,71,2,147,3,228,0,71,0,190,2,170,0,0,192,0,64,0,0,3,0,20,0,0,4,218,5,211,0,23,0,
+27,0,31,0,141,185,0,15,255,240,179,14,14,54,15,184,255,240,64,37,9,12,54,27,27,28,24,0,17,15,18,8,175,20,1,20,
+64,9,14,54,20,149,15,1,2,7,152,28,1,8,15,31,5,21,18,2,17,184,255,192,64,38,15,24,54,17,17,2,2,4,24,31,133,25,
+30,64,23,23,54,30,64,20,20,54,30,33,30,104,2,7,0,4,133,10,7,5,32,5,101,2,43,47,51,60,253,60,47,43,47,43,43,60,
+253,60,17,57,47,57,47,43,18,57,0,63,60,63,60,60,253,60,63,237,43,93,17,57,17,57,63,18,57,47,43,43,49,48,1,51,
+17,35,17,33,17,35,17,51,53,52,62,2,51,50,23,7,38,35,34,6,21,1,33,17,33,21,33,17,33,2,10,182,182,254,142,132,
+132,27,82,144,103,78,205,45,72,31,66,55,1,93,1,115,254,141,1,115,254,141,4,38,254,214,253,4,2,252,1,42,48,60,
+161,103,57,23,245,10,60,87,1,124,254,235,127,251,218,0,2,0,20,0,0,4,218,5,211,0,23,0,27,0,117,185,0,15,255,
+240,179,14,14,54,15,184,255,240,64,33,9,12,54,24,0,17,15,18,8,175,20,1,20,64,9,14,54,20,149,15,1,2,7,152,1,8,
+15,27,5,21,18,2,17,184,255,192,64,26,15,24,54,17,17,2,2,4,27,133,26,29,26,104,2,7,0,4,133,10,7,5,28,5,101,2,
+43,47,51,60,253,60,47,43,47,237,17,57,47,57,47,43,18,57,0,63,60,63,60,253,60,63,237,43,93,17,57,17,57,63,43,
+43,49,48,1,51,17,35,17,33,17,35,17,51,53,52,62,2,51,50,23,7,38,35,34,6,21,1,33,17,33,2,10,182,182,254,142,132,
+132,27,82,144,103,78,205,45,72,31,66,55,1,93,1,115,254,141,4,38,254,214,253,4,2,252,1,42,48,60,161,103,57,23,
+245,10,60,87,1,124,250,70,0,0,1,0,141,254,105,4,213,5,186,0,19,0,62,64,32,4,17,177,3,18,18,0,3,7,14,177,8,13,
+13,11,27,17,13,4,8,8,6,1,10,176,0,15,13,223,11,1,11,47,93,51,60,60,253,60,60,50,47,60,47,60,0,63,51,47,60,253,
+60,63,51,47,60,253,60,49,48,1,33,17,33,17,33,17,33,17,33,17,33,17,33,17,33,17,33,17,33,1,255,1,96,1,118,254,
+138,1,118,254,138,254,160,254,142,1,114,254,142,1,114,5,186,254,178,254,215,253,156,254,216,254,178,1,78,1,40,
+2,100,1,41,0,1,0,124,2,17,2,47,3,169,0,3,0,14,181,0,173,3,2,133,3,47,237,0,47,237,49,48,19,33,17,33,124,1,179,
+254,77,3,169,254,104,0,0,1,0,70,254,100,1,249,1,148,0,10,0,47,64,27,6,10,5,28,0,173,10,18,5,9,6,6,10,9,9,2,
+133,96,10,112,10,144,10,160,10,4,10,47,93,237,57,47,17,51,47,18,57,0,63,237,63,18,57,49,48,19,33,17,20,6,7,39,
+54,54,55,35,70,1,179,154,186,95,116,87,5,208,1,148,254,177,185,214,82,178,54,107,73,0,255,255,0,55,254,100,3,
+229,1,148,0,38,0,196,241,0,1,7,0,196,1,236,0,0,0,46,64,31,1,95,21,143,21,159,21,3,15,21,31,21,63,21,79,21,4,
+21,0,192,10,208,10,2,10,1,0,21,18,10,18,0,63,63,53,53,1,47,93,53,47,93,93,53,0,7,0,0,255,182,8,0,5,211,0,11,0,
+23,0,27,0,39,0,51,0,63,0,75,0,237,64,17,24,25,26,26,180,27,24,20,27,27,24,61,16,10,11,54,55,184,255,240,64,9,
+10,11,54,37,16,10,11,54,31,184,255,240,64,9,10,11,54,9,16,10,11,54,3,184,255,240,64,38,10,11,54,15,179,9,9,21,
+179,25,24,3,7,49,179,31,31,73,179,55,55,67,179,61,61,27,26,43,179,37,25,25,16,9,11,54,26,27,184,255,192,179,
+20,25,54,27,184,255,192,179,17,18,54,27,184,255,192,64,53,9,11,54,27,27,18,12,25,25,40,46,154,111,34,1,34,34,
+40,154,159,28,1,28,28,6,64,154,192,52,1,96,52,1,52,52,70,154,58,58,77,18,154,207,6,1,111,6,1,6,6,12,154,0,47,
+237,51,47,93,93,237,17,51,47,237,51,47,93,93,237,18,57,47,93,237,51,47,93,253,17,57,47,17,18,57,47,43,43,43,
+51,43,0,63,237,60,60,60,16,237,51,47,237,60,16,237,63,60,60,237,51,47,237,43,43,43,43,43,43,135,5,46,43,135,
+125,196,49,48,17,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,37,51,1,35,1,52,54,51,50,
+22,21,20,6,35,34,38,55,20,22,51,50,54,53,52,38,35,34,6,5,52,54,51,50,22,21,20,6,35,34,38,55,20,22,51,50,54,53,
+52,38,35,34,6,167,136,136,168,167,137,136,167,211,52,39,40,52,52,40,39,52,2,151,180,253,196,178,1,183,167,136,
+136,168,167,137,136,167,211,52,40,39,52,52,39,40,52,1,232,167,136,135,168,166,137,136,167,210,52,40,40,52,52,
+40,40,52,4,81,200,186,185,190,210,186,186,199,148,80,80,148,148,80,80,238,249,227,1,130,200,186,186,190,209,
+187,187,198,148,80,80,148,148,81,81,147,200,186,186,190,209,187,187,198,148,80,80,148,148,81,81,0,255,255,0,2,
+0,0,6,62,7,49,2,34,0,36,0,0,1,7,0,216,1,200,1,107,0,19,64,11,2,0,17,13,4,5,37,2,17,5,38,0,43,53,1,43,53,0,255,
+255,0,149,0,0,5,105,7,49,2,34,0,40,0,0,1,7,0,216,1,143,1,107,0,19,64,11,1,0,18,14,0,1,37,1,18,5,38,0,43,53,1,
+43,53,0,255,255,0,2,0,0,6,62,7,62,2,34,0,36,0,0,1,7,0,141,1,200,1,107,0,19,64,11,2,0,13,13,4,5,37,2,14,5,38,0,
+43,53,1,43,53,0,255,255,0,149,0,0,5,105,7,17,2,34,0,40,0,0,1,7,0,142,1,143,1,107,0,23,64,13,2,1,0,15,18,0,1,
+37,2,1,15,5,38,0,43,53,53,1,43,53,53,0,255,255,0,149,0,0,5,105,7,62,2,38,0,40,0,0,1,7,0,67,1,143,1,107,0,19,
+64,11,1,0,15,15,0,1,37,1,15,5,38,0,43,53,1,43,53,0,255,255,0,168,0,0,2,227,7,62,2,34,0,44,0,0,1,7,0,141,0,58,
+1,107,0,19,64,11,1,0,6,6,0,1,37,1,7,5,38,0,43,53,1,43,53,0,255,255,0,30,0,0,3,2,7,49,2,34,0,44,0,0,1,7,0,216,
+0,58,1,107,0,19,64,11,1,0,10,6,0,1,37,1,10,5,38,0,43,53,1,43,53,0,255,255,0,56,0,0,2,231,7,17,2,34,0,44,0,0,1,
+7,0,142,0,58,1,107,0,23,64,13,2,1,0,7,10,0,1,37,2,1,7,5,38,0,43,53,53,1,43,53,53,0,255,255,0,59,0,0,2,110,7,
+62,2,34,0,44,0,0,1,7,0,67,0,58,1,107,0,19,64,11,1,0,7,7,0,1,37,1,7,5,38,0,43,53,1,43,53,0,255,255,0,93,255,
+231,6,76,7,62,2,38,0,50,0,0,1,7,0,141,2,0,1,107,0,19,64,11,2,0,28,28,0,6,37,2,29,5,38,0,43,53,1,43,53,0,255,
+255,0,93,255,231,6,76,7,49,2,34,0,50,0,0,1,7,0,216,2,0,1,107,0,19,64,11,2,0,32,28,0,6,37,2,32,5,38,0,43,53,1,
+43,53,0,255,255,0,93,255,231,6,76,7,62,2,34,0,50,0,0,1,7,0,67,2,0,1,107,0,19,64,11,2,0,29,29,0,6,37,2,29,5,38,
+0,43,53,1,43,53,0,255,255,0,151,255,230,6,20,7,62,2,34,0,56,0,0,1,7,0,141,2,0,1,107,0,19,64,11,1,0,27,27,16,1,
+37,1,28,5,38,0,43,53,1,43,53,0,255,255,0,151,255,230,6,20,7,49,2,34,0,56,0,0,1,7,0,216,2,0,1,107,0,19,64,11,1,
+0,31,27,16,1,37,1,31,5,38,0,43,53,1,43,53,0,255,255,0,151,255,230,6,20,7,62,2,34,0,56,0,0,1,7,0,67,2,0,1,107,
+0,19,64,11,1,0,28,28,16,1,37,1,28,5,38,0,43,53,1,43,53,0,0,1,0,138,0,0,2,33,4,38,0,3,0,27,64,16,0,15,3,21,2,
+133,3,3,5,133,104,8,4,3,101,2,43,43,47,237,0,63,63,49,48,19,33,17,33,138,1,151,254,105,4,38,251,218,0,1,255,
+228,4,168,2,200,5,198,0,6,0,59,64,33,6,1,1,166,1,1,4,0,3,0,6,16,6,2,6,6,0,4,0,5,6,1,3,4,2,64,9,13,54,2,2,6,4,
+47,51,51,47,43,18,57,57,47,57,57,0,63,51,47,93,60,18,57,49,48,1,93,113,19,33,19,35,39,7,35,201,1,33,222,248,
+122,122,248,5,198,254,226,153,153,0,1,255,236,4,164,2,190,5,186,0,25,0,49,180,14,14,6,162,23,184,255,192,64,
+21,9,12,54,23,23,10,162,0,19,3,0,161,1,64,9,10,54,1,13,161,14,47,237,47,43,237,0,63,60,237,51,47,43,253,50,47,
+49,48,1,51,22,21,20,6,35,34,39,38,35,34,6,7,35,38,53,52,54,51,50,22,22,51,50,54,2,31,158,1,112,88,64,130,79,
+30,29,32,1,156,1,118,81,35,62,167,38,27,33,5,186,26,19,111,122,53,32,36,46,24,18,107,126,16,70,37,0,0,1,0,18,
+4,205,2,153,5,166,0,3,0,14,181,3,162,0,4,2,3,47,47,0,63,237,49,48,19,33,21,33,18,2,135,253,121,5,166,217,0,1,
+0,0,4,165,2,171,5,211,0,14,0,60,64,40,70,3,1,214,3,230,3,2,6,3,22,3,182,3,198,3,4,12,162,112,5,128,5,2,0,5,16,
+5,2,5,5,0,8,4,0,161,1,9,161,8,47,237,47,237,0,63,60,51,47,93,93,237,49,48,1,93,93,113,1,51,14,2,35,34,38,39,
+51,22,22,51,50,54,2,6,165,6,78,158,92,152,182,15,172,20,74,74,87,75,5,211,95,129,78,159,143,58,49,49,0,1,0,
+184,4,172,1,242,5,216,0,3,0,15,182,3,151,0,4,2,151,3,47,237,0,63,237,49,48,19,33,17,33,184,1,58,254,198,5,216,
+254,212,0,2,0,100,4,139,2,69,6,108,0,11,0,23,0,35,64,19,9,166,15,15,3,166,21,0,166,12,12,6,166,128,18,144,18,
+2,18,47,93,237,51,47,237,0,47,237,51,47,237,49,48,1,20,6,35,34,38,53,52,54,51,50,22,7,52,38,35,34,6,21,20,22,
+51,50,54,2,69,141,99,100,141,141,100,99,141,138,60,43,43,60,60,43,43,60,5,123,100,140,140,100,100,141,141,99,
+43,60,60,43,43,60,60,0,0,1,0,18,254,81,2,111,255,232,0,22,0,51,64,24,1,3,0,13,21,12,15,10,10,15,15,21,21,3,19,
+1,18,0,12,12,0,6,178,18,47,237,51,51,47,47,18,57,0,63,51,47,51,47,51,47,18,57,17,57,57,18,57,49,48,23,55,54,
+51,50,22,21,20,6,6,35,34,39,53,22,51,50,54,53,52,38,35,34,116,30,94,82,171,130,59,152,126,114,154,104,117,86,
+61,50,53,71,165,118,23,116,79,48,102,62,26,123,20,46,37,29,42,0,0,2,0,46,4,172,3,171,5,211,0,3,0,7,0,81,185,0,
+1,255,204,179,22,24,54,1,184,255,204,64,39,16,17,54,7,0,3,16,3,2,3,3,4,0,4,5,5,4,4,6,161,15,7,79,7,2,7,64,10,
+15,54,7,1,1,0,0,3,161,7,2,47,51,253,50,47,51,47,47,43,113,237,51,47,51,47,0,63,60,51,47,93,60,49,48,1,43,43,
+19,33,1,35,1,33,1,35,214,1,69,254,216,197,2,53,1,72,254,210,191,5,211,254,217,1,39,254,217,0,1,0,152,254,65,2,
+105,0,26,0,15,0,41,64,19,8,0,9,6,11,11,6,6,0,18,1,9,0,3,9,9,14,178,3,47,237,51,47,17,57,18,57,0,63,51,47,51,
+47,18,57,17,57,49,48,55,51,6,21,20,22,51,50,55,21,6,35,34,38,53,52,200,169,20,74,66,47,81,124,88,120,133,26,
+87,57,76,78,26,155,46,128,106,89,0,0,1,255,228,4,168,2,200,5,198,0,6,0,53,64,19,4,2,0,1,16,1,2,1,1,5,2,4,0,5,
+6,1,3,4,2,184,255,192,182,9,13,54,2,2,6,4,47,51,51,47,43,18,57,57,47,57,57,0,63,60,51,47,93,18,57,49,48,1,33,
+3,51,23,55,51,1,226,254,224,222,247,122,122,249,4,168,1,30,153,153,0,0,1,255,255,0,0,5,29,5,186,0,13,0,87,64,
+57,5,11,4,6,1,10,11,4,9,0,2,12,3,6,1,13,12,3,9,0,10,12,13,5,2,4,3,7,0,11,9,0,3,6,147,9,18,3,4,4,8,15,8,111,2,
+12,11,1,6,127,0,11,9,14,9,107,2,43,47,51,60,253,60,47,60,43,47,57,47,60,0,63,237,63,17,57,17,23,57,15,15,15,
+15,49,48,19,33,17,37,17,5,17,33,17,33,17,7,17,55,150,1,197,1,62,254,194,2,194,251,121,151,151,5,186,254,108,
+239,254,232,240,254,92,254,151,1,183,116,1,24,114,0,1,0,0,0,0,2,171,5,186,0,11,0,80,64,54,5,9,4,6,1,8,9,4,7,0,
+2,10,3,6,1,11,10,3,7,0,9,10,8,11,5,2,4,3,8,7,0,0,7,21,10,9,3,4,4,1,6,133,0,9,7,7,13,133,104,8,12,7,101,2,43,
+43,47,51,60,253,60,50,47,60,47,60,0,63,63,18,23,57,15,15,15,15,49,48,19,33,17,55,21,7,17,33,17,7,53,55,138,1,
+153,136,136,254,103,138,138,5,186,254,43,89,196,91,252,225,2,16,92,196,93,0,255,255,0,71,255,231,5,121,7,49,2,
+34,0,54,0,0,1,7,0,225,1,143,1,107,0,19,64,11,1,0,47,51,16,23,37,1,46,5,38,0,43,53,1,43,53,0,255,255,0,51,255,
+231,4,156,5,198,2,34,0,86,0,0,1,7,0,225,1,29,0,0,0,19,64,11,1,0,49,53,16,24,37,1,48,17,38,0,43,53,1,43,53,0,
+255,255,0,34,0,0,5,145,7,49,2,34,0,61,0,0,1,7,0,225,1,143,1,107,0,19,64,11,1,0,12,16,0,1,37,1,11,5,38,0,43,53,
+1,43,53,0,255,255,0,37,0,0,4,71,5,198,2,34,0,93,0,0,1,7,0,225,0,229,0,0,0,19,64,11,1,0,12,16,0,1,37,1,11,17,
+38,0,43,53,1,43,53,0,0,2,0,160,254,108,1,159,5,186,0,3,0,7,0,35,64,17,3,3,4,0,3,4,4,7,27,1,6,6,0,192,7,1,7,47,
+93,60,51,47,60,0,63,51,47,63,18,57,47,49,48,19,51,17,35,17,51,17,35,160,255,255,255,255,5,186,252,248,254,195,
+252,247,0,2,0,2,0,0,5,224,5,186,0,17,0,31,0,83,64,51,20,16,16,21,15,64,20,21,54,47,15,79,15,239,15,3,15,15,23,
+18,145,0,3,23,145,13,18,39,6,1,21,21,23,28,125,6,33,6,111,2,15,18,23,127,0,15,13,32,13,107,2,43,47,51,60,253,
+60,47,43,47,237,17,57,47,93,0,63,237,63,237,17,57,47,93,43,60,51,47,60,49,48,19,33,50,22,22,18,21,20,2,6,7,6,
+35,33,17,35,53,51,1,17,51,21,35,17,51,50,54,54,53,52,38,35,156,2,161,199,245,160,71,110,188,110,147,120,253,
+95,154,154,1,197,220,220,111,142,120,68,153,176,5,186,108,201,254,244,150,241,254,253,171,29,39,2,110,221,1,
+35,254,221,221,254,223,63,157,176,233,172,0,0,2,0,75,255,232,5,10,5,186,0,31,0,43,0,130,64,84,155,7,1,89,7,
+107,7,118,7,139,7,4,9,30,25,30,41,30,57,7,4,7,1,0,0,8,10,30,31,31,9,31,0,30,1,10,7,9,7,8,28,24,8,4,0,41,149,
+24,15,35,149,16,22,7,10,8,9,4,13,1,30,28,3,38,0,31,4,3,32,20,38,131,13,45,13,105,2,32,131,20,44,20,102,2,43,
+47,237,43,47,237,17,18,23,57,17,23,57,18,23,57,0,63,237,63,237,63,60,17,57,18,23,57,7,14,16,60,60,7,14,16,60,
+60,49,48,1,93,93,93,1,55,38,38,39,33,22,23,55,23,7,22,18,21,16,0,33,34,36,2,53,52,54,54,51,50,23,22,23,38,39,
+5,19,20,22,51,50,54,53,52,38,35,34,6,1,65,253,65,103,67,1,156,60,53,203,37,146,166,166,254,190,254,231,191,
+254,227,136,132,240,122,60,57,38,56,68,61,254,219,125,115,82,76,132,129,76,84,116,4,176,90,64,77,35,32,40,72,
+101,54,168,254,148,197,254,227,254,191,145,1,13,141,146,250,135,17,12,34,119,82,107,253,203,143,134,131,165,
+144,116,134,255,255,0,2,0,0,6,61,7,62,2,34,0,60,0,0,1,7,0,141,1,200,1,107,0,19,64,11,1,0,11,11,0,4,37,1,12,5,
+38,0,43,53,1,43,53,0,255,255,0,5,254,81,4,234,5,211,2,34,0,92,0,0,1,7,0,141,1,29,0,0,0,19,64,11,1,0,20,20,0,4,
+37,1,21,17,38,0,43,53,1,43,53,0,0,2,0,148,0,0,5,112,5,186,0,12,0,21,0,53,64,31,21,145,2,2,0,3,13,145,32,10,1,
+10,10,12,18,17,125,6,23,6,111,2,1,21,11,127,12,22,12,107,2,43,47,253,60,60,43,47,237,0,63,51,47,93,237,63,51,
+47,237,49,48,19,33,17,5,50,22,21,20,4,33,35,17,33,1,51,50,54,53,52,38,35,35,148,1,199,1,42,246,245,254,245,
+254,238,248,254,57,1,199,111,131,106,92,127,129,5,186,254,251,1,234,216,221,250,254,229,2,68,91,71,68,97,0,2,
+0,125,254,108,5,14,5,186,0,16,0,28,0,79,183,1,0,52,3,84,3,2,3,184,255,224,64,42,9,20,54,3,26,149,6,16,15,32,9,
+20,54,15,20,149,12,22,0,27,102,9,135,9,2,23,131,9,30,9,105,2,17,66,2,16,133,0,29,0,101,2,43,47,253,60,228,43,
+47,237,93,0,63,63,237,57,43,63,253,57,43,93,63,49,48,19,17,33,17,54,54,51,50,18,21,16,2,35,34,38,39,17,3,20,
+22,51,50,54,53,52,38,35,34,6,125,1,155,64,140,98,218,238,254,194,94,155,61,3,106,81,71,96,100,72,78,104,254,
+108,7,78,254,5,67,60,254,193,247,254,247,254,233,64,63,254,5,3,164,126,122,117,140,129,121,122,0,1,0,127,2,59,
+4,194,3,127,0,3,0,17,183,0,177,3,32,2,1,2,3,47,47,93,0,47,237,49,48,19,33,17,33,127,4,67,251,189,3,127,254,
+188,0,1,0,125,0,186,4,196,5,0,0,11,0,145,64,85,7,6,11,8,3,4,5,0,8,3,10,11,6,9,2,1,9,2,0,5,3,2,9,9,175,8,3,20,
+8,8,3,11,0,5,5,175,6,11,20,6,6,11,3,2,2,11,0,5,6,0,9,6,3,8,73,3,1,6,73,5,1,5,5,2,175,3,1,3,64,14,15,54,3,64,
+11,12,54,3,8,9,3,0,9,3,11,184,255,192,179,11,12,54,11,47,43,23,51,47,51,47,43,43,93,51,51,47,93,51,93,0,47,23,
+51,47,51,47,51,51,47,51,135,14,46,43,135,14,125,196,135,14,46,24,43,135,14,125,196,15,15,15,15,49,48,9,2,23,1,
+1,7,1,1,39,1,1,1,99,1,62,1,59,232,254,195,1,61,232,254,197,254,194,230,1,62,254,194,5,0,254,197,1,59,231,254,
+197,254,193,229,1,63,254,193,229,1,63,1,59,0,1,0,141,2,229,2,115,5,211,0,9,0,44,64,23,3,6,179,7,7,9,0,2,1,2,2,
+9,1,9,2,6,6,1,178,192,2,1,2,47,93,237,51,47,17,57,0,63,51,47,93,18,57,47,253,57,49,48,1,17,33,17,6,6,7,53,54,
+55,2,115,254,252,56,91,79,184,104,5,211,253,18,1,192,33,33,16,207,45,132,0,0,1,0,22,2,229,3,23,5,211,0,29,0,
+72,64,44,28,179,0,1,1,1,15,14,14,1,11,179,20,1,123,4,139,4,2,112,28,128,28,2,28,1,8,178,23,23,48,0,96,0,192,0,
+3,0,14,178,15,15,0,1,47,51,51,47,237,47,93,51,47,237,17,57,93,93,0,63,237,51,51,47,57,47,93,237,49,48,1,33,54,
+54,55,54,55,54,53,52,38,35,34,6,7,39,54,55,54,54,51,50,22,21,20,7,6,6,7,33,3,23,252,255,25,111,192,111,30,29,
+45,47,49,66,15,246,18,30,43,168,128,181,168,42,43,199,62,1,93,2,229,91,130,128,74,36,36,29,30,38,53,60,21,80,
+40,59,71,132,92,69,58,59,116,41,0,1,0,31,2,209,3,19,5,211,0,45,0,136,64,26,13,36,35,1,63,0,1,0,0,42,36,24,25,
+25,28,144,36,160,36,2,36,179,175,35,1,35,184,255,192,64,18,19,22,54,35,35,42,28,179,0,20,1,20,20,42,179,5,1,
+16,184,255,240,179,9,14,54,9,184,255,240,64,24,12,17,54,13,16,36,35,31,25,39,178,9,9,31,178,16,0,178,1,1,16,
+25,178,24,47,237,51,51,47,237,47,237,51,47,237,17,18,57,57,17,57,43,43,0,63,237,51,47,93,253,17,57,47,43,93,
+237,93,18,57,47,57,17,18,57,47,93,57,17,18,57,49,48,1,37,54,55,54,51,50,23,22,21,20,7,6,7,22,22,21,20,7,6,35,
+34,39,38,39,55,22,22,51,50,54,53,52,39,38,39,55,50,54,53,52,38,35,34,7,6,1,45,254,254,49,72,96,160,180,92,65,
+36,25,65,80,76,73,99,204,191,102,59,28,254,16,58,48,56,63,56,32,117,28,86,60,41,40,41,33,24,4,234,40,94,43,56,
+67,48,76,53,45,31,31,26,102,67,94,55,75,78,45,89,29,48,42,55,38,51,28,16,2,141,44,33,26,35,23,17,255,255,0,
+157,255,203,7,198,5,211,0,38,0,241,16,0,0,39,0,188,3,78,0,0,1,7,0,242,4,175,252,254,0,7,178,2,15,25,0,63,53,0,
+255,255,0,157,255,203,7,179,5,211,0,38,0,241,16,0,0,39,0,188,3,109,0,0,1,7,1,4,4,175,252,254,0,9,179,3,2,24,
+25,0,63,53,53,0,255,255,0,70,255,203,7,179,5,211,0,38,0,243,39,0,0,39,0,188,3,134,0,0,1,7,1,4,4,175,252,254,0,
+9,179,3,2,60,25,0,63,53,53,0,0,1,0,155,0,0,6,217,5,186,0,26,0,137,179,20,5,1,5,184,255,192,179,9,12,54,3,184,
+255,192,64,72,9,16,54,8,3,1,9,21,11,151,6,6,25,1,1,25,0,26,16,26,2,26,145,16,19,80,19,144,19,3,0,19,48,19,64,
+19,208,19,4,208,19,1,19,19,21,25,145,22,3,17,21,18,24,24,17,9,8,8,2,16,133,1,17,17,25,20,127,21,27,21,107,2,
+43,47,253,60,50,47,60,237,57,50,0,47,1,57,17,57,47,0,63,60,63,237,17,57,47,93,113,114,253,93,17,57,47,18,57,
+47,237,17,57,17,57,57,43,43,93,49,48,1,53,33,21,54,54,51,50,23,3,38,35,34,7,6,21,17,33,17,33,17,33,17,33,17,
+33,17,3,149,1,125,56,116,87,89,107,126,72,42,80,44,63,254,103,254,205,254,57,4,96,253,103,3,127,73,174,113,85,
+56,254,222,30,66,93,255,254,250,2,87,253,169,5,186,254,197,255,0,255,255,0,94,255,231,6,51,7,62,2,34,0,42,0,0,
+1,7,0,219,2,0,1,107,0,19,64,11,1,0,42,35,10,19,37,1,39,5,38,0,43,53,1,43,53,0,255,255,0,73,254,81,4,220,5,211,
+2,34,0,74,0,0,1,7,0,219,1,86,0,0,0,19,64,11,2,0,57,50,30,1,37,2,54,17,38,0,43,53,1,43,53,0,255,255,0,168,0,0,
+2,110,7,63,2,34,0,44,0,0,1,7,0,220,0,58,1,103,0,19,64,11,1,0,7,6,0,1,37,1,7,5,38,0,43,53,1,43,53,0,255,255,0,
+71,254,81,5,121,5,211,2,34,0,54,0,0,1,7,0,222,1,143,0,0,0,18,64,10,1,0,63,63,0,38,37,1,48,18,0,63,53,1,43,53,
+255,255,0,51,254,81,4,156,4,62,2,34,0,86,0,0,1,7,0,222,1,29,0,0,0,18,64,10,1,0,65,65,0,40,37,1,50,21,0,63,53,
+1,43,53,255,255,0,97,255,230,5,243,7,62,2,34,0,38,0,0,1,7,0,141,1,244,1,107,0,19,64,11,1,0,33,33,9,15,37,1,34,
+5,38,0,43,53,1,43,53,0,255,255,0,74,255,231,5,22,5,211,2,34,0,70,0,0,1,7,0,141,1,186,0,0,0,23,64,14,1,128,35,
+1,0,35,35,10,20,37,1,36,17,38,0,43,53,1,43,93,53,0,255,255,0,97,255,230,5,243,7,49,2,34,0,38,0,0,1,7,0,225,1,
+244,1,107,0,19,64,11,1,0,33,37,9,15,37,1,32,5,38,0,43,53,1,43,53,0,255,255,0,74,255,231,5,22,5,198,2,34,0,70,
+0,0,1,7,0,225,1,106,0,0,0,19,64,11,1,0,35,39,10,20,37,1,34,17,38,0,43,53,1,43,53,0,0,2,0,72,255,232,5,145,5,
+186,0,25,0,37,0,118,64,13,1,22,166,2,48,21,1,21,21,16,24,0,19,184,255,224,64,59,9,20,54,19,29,149,16,16,59,7,
+91,7,2,6,32,9,20,54,6,5,35,149,10,22,5,21,13,8,17,17,54,13,16,15,15,54,21,21,32,2,5,26,24,19,133,25,2,4,39,4,
+104,2,32,131,13,38,13,102,2,43,47,237,43,47,51,60,253,60,57,57,47,17,57,47,43,43,0,63,63,237,17,57,43,93,63,
+253,57,43,63,18,57,47,93,60,253,60,49,48,1,51,21,35,17,33,53,6,7,6,35,34,2,53,16,18,51,50,22,23,53,33,53,33,
+53,33,1,52,38,35,34,6,21,20,22,51,50,54,4,217,184,184,254,131,80,66,88,108,217,229,253,195,95,155,60,254,206,
+1,50,1,155,254,104,106,81,71,96,99,73,78,104,5,70,163,251,93,157,100,35,46,1,74,236,1,8,1,24,64,64,229,163,
+116,252,92,125,123,118,139,130,121,122,0,255,255,255,244,6,63,4,12,6,165,0,7,0,66,0,0,7,63,0,1,0,124,2,17,2,
+47,3,169,0,3,0,14,181,0,173,3,2,133,3,47,237,0,47,237,49,48,19,33,17,33,124,1,179,254,77,3,169,254,104,0,0,2,
+0,41,2,208,3,4,5,211,0,10,0,13,0,88,64,54,9,12,25,12,41,12,3,12,2,3,6,13,179,7,1,1,3,0,10,1,10,10,3,1,6,3,22,
+3,38,3,3,3,9,13,10,2,15,7,31,7,2,7,7,4,9,178,12,2,112,10,192,10,2,10,47,93,51,60,253,60,50,47,93,47,18,57,17,
+57,93,0,63,51,47,93,17,57,47,60,253,60,17,57,57,93,49,48,1,33,53,1,51,17,51,21,35,21,35,17,53,7,1,193,254,104,
+1,162,214,99,99,224,204,3,73,189,1,205,254,28,166,121,1,31,219,219,255,255,0,2,0,0,6,62,7,70,2,34,0,36,0,0,1,
+7,0,219,1,197,1,115,0,19,64,11,2,0,19,12,4,5,37,2,15,5,38,0,43,53,1,43,53,0,255,255,0,73,255,232,5,16,5,211,2,
+34,0,68,0,0,1,7,0,219,1,87,0,0,0,19,64,11,2,0,64,57,1,13,37,2,61,17,38,0,43,53,1,43,53,0,255,255,0,2,254,65,6,
+104,5,186,2,34,0,36,0,0,1,7,0,224,3,255,0,0,0,18,64,10,2,0,25,14,7,6,37,2,11,18,0,63,53,1,43,53,255,255,0,73,
+254,65,5,57,4,62,2,34,0,68,0,0,1,7,0,224,2,208,0,0,0,18,64,10,2,0,70,59,18,17,37,2,56,21,0,63,53,1,43,53,255,
+255,0,156,0,0,5,225,7,56,2,34,0,39,0,0,1,7,0,225,1,178,1,114,0,45,64,34,2,64,26,128,26,2,112,26,144,26,192,26,
+224,26,4,16,26,64,26,80,26,96,26,4,0,26,30,0,6,37,2,25,5,38,0,43,53,1,43,93,93,113,53,0,255,255,0,72,255,232,
+6,157,5,186,0,38,0,71,0,0,1,7,1,81,4,193,6,51,0,23,64,13,2,0,30,1,32,30,128,30,2,30,2,30,0,0,63,53,1,47,93,
+113,53,0,255,255,0,2,0,0,5,224,5,186,2,6,0,233,0,0,255,255,0,149,254,65,5,105,5,186,2,34,0,40,0,0,1,7,0,224,2,
+211,0,0,0,18,64,10,1,0,26,15,8,10,37,1,12,18,0,63,53,1,43,53,255,255,0,72,254,65,5,22,4,62,2,34,0,72,0,0,1,7,
+0,224,1,166,0,0,0,18,64,10,2,0,47,36,17,0,37,2,33,21,0,63,53,1,43,53,255,255,0,149,0,0,5,105,7,56,2,34,0,40,0,
+0,1,7,0,225,1,175,1,114,0,19,64,11,1,0,14,18,0,1,37,1,13,5,38,0,43,53,1,43,53,0,255,255,0,72,255,232,5,22,5,
+198,2,34,0,72,0,0,1,7,0,225,1,86,0,0,0,19,64,11,2,0,35,39,17,0,37,2,34,17,38,0,43,53,1,43,53,0,0,2,0,172,255,
+231,7,160,5,186,0,17,0,21,0,66,64,41,9,10,12,145,10,6,19,19,18,16,20,3,16,127,17,23,17,110,2,10,125,96,9,112,
+9,2,9,18,127,9,18,19,22,19,107,2,63,23,79,23,2,93,43,47,17,51,237,47,93,237,43,47,237,0,63,60,63,63,51,237,47,
+57,49,48,1,20,14,3,35,32,0,39,37,20,51,50,54,53,17,33,1,33,17,33,7,160,33,115,183,159,78,254,199,254,229,16,1,
+176,148,70,77,1,197,250,209,254,59,1,197,2,160,162,219,184,105,27,1,15,250,59,240,103,145,3,135,250,70,5,186,
+0,0,4,0,137,254,82,4,207,5,186,0,3,0,7,0,22,0,26,0,99,64,64,12,16,9,11,54,15,21,14,17,151,12,28,1,5,5,25,2,6,
+3,24,18,21,25,15,14,0,8,133,1,14,31,20,1,20,4,23,133,5,20,24,27,24,101,2,79,28,127,28,2,31,28,47,28,64,28,95,
+28,143,28,160,28,239,28,7,93,113,43,47,51,60,253,60,47,93,51,60,253,60,47,0,63,60,63,63,60,18,57,47,60,63,237,
+57,17,57,43,49,48,1,33,17,33,1,33,17,33,1,20,6,6,35,34,39,19,22,51,50,54,53,17,33,1,33,17,33,4,207,254,104,1,
+152,253,82,254,104,1,152,2,174,35,155,164,132,161,61,56,16,58,48,1,152,253,82,254,104,1,152,4,164,1,22,254,
+234,1,22,250,103,147,185,131,35,1,39,11,81,98,3,225,251,219,4,37,0,255,255,0,150,0,0,5,30,7,70,2,34,0,47,0,0,
+1,7,0,141,1,133,1,115,0,19,64,11,1,0,9,9,1,1,37,1,9,5,38,0,43,53,1,43,53,0,255,255,0,137,0,0,2,186,7,70,2,34,
+0,79,0,0,1,7,0,141,0,17,1,115,0,23,64,14,1,159,6,1,0,6,6,0,1,37,1,7,5,38,0,43,53,1,43,93,53,0,255,255,0,150,0,
+0,5,30,5,186,2,34,0,47,0,0,1,7,1,81,2,238,6,51,0,23,64,13,1,144,6,1,32,6,96,6,2,6,1,6,0,0,63,53,1,47,93,93,53,
+0,255,255,0,137,0,0,3,219,5,186,0,38,0,79,0,0,1,7,1,81,1,255,6,51,0,19,64,10,1,79,4,159,4,2,4,1,4,0,0,63,53,1,
+47,93,53,0,255,255,0,150,0,0,5,30,5,186,2,38,0,47,0,0,1,7,0,220,2,204,254,84,0,18,64,10,1,6,15,1,64,9,8,2,3,
+37,1,43,53,0,63,53,255,255,0,137,0,0,3,242,5,186,0,38,0,79,0,0,1,7,0,220,2,0,254,84,0,18,64,10,1,4,15,1,0,7,6,
+2,9,37,1,43,53,0,63,53,255,255,0,153,0,0,6,19,7,70,2,34,0,49,0,0,1,7,0,141,1,255,1,115,0,19,64,11,1,0,12,12,0,
+4,37,1,13,5,38,0,43,53,1,43,53,0,255,255,0,123,0,0,4,222,5,211,2,34,0,81,0,0,1,7,0,141,1,90,0,0,0,19,64,11,1,
+0,22,22,0,8,37,1,23,17,38,0,43,53,1,43,53,0,255,255,0,153,0,0,6,19,7,56,2,34,0,49,0,0,1,7,0,225,1,254,1,114,0,
+19,64,11,1,0,12,16,0,4,37,1,11,5,38,0,43,53,1,43,53,0,255,255,0,123,0,0,4,222,5,198,2,34,0,81,0,0,1,7,0,225,1,
+89,0,0,0,19,64,11,1,0,22,26,0,8,37,1,21,17,38,0,43,53,1,43,53,0,0,2,0,53,0,0,6,102,5,186,0,10,0,29,0,120,179,
+183,26,1,26,184,255,240,64,10,9,11,54,3,3,8,173,9,3,24,184,255,224,64,62,9,14,54,24,21,15,151,26,16,21,15,11,
+20,18,12,133,11,31,11,104,2,22,19,133,31,20,159,20,2,31,20,47,20,95,20,111,20,143,20,5,20,7,7,0,133,4,20,8,15,
+31,1,63,31,79,31,191,31,207,31,223,31,5,93,113,47,51,60,253,57,47,47,93,114,237,57,43,47,237,0,63,60,63,63,
+237,17,57,43,63,253,50,47,43,93,49,48,1,20,6,7,39,54,54,55,35,17,33,1,33,17,52,35,34,6,21,17,33,17,33,21,51,
+54,51,50,22,21,1,193,140,159,97,84,102,3,189,1,140,4,165,254,105,144,79,86,254,104,1,125,4,137,242,178,182,4,
+145,159,214,67,129,38,106,98,1,110,250,70,2,72,184,117,141,254,2,4,37,172,196,211,198,0,255,255,0,93,255,231,
+6,76,7,71,2,38,0,50,0,0,1,7,0,223,1,164,1,116,0,23,64,13,3,2,29,5,38,3,2,0,29,32,0,6,37,1,43,53,53,0,43,53,53,
+0,255,255,0,73,255,232,5,13,5,211,2,38,0,82,0,0,1,7,0,223,0,248,0,0,0,23,64,13,3,2,29,17,38,3,2,0,29,32,0,7,
+37,1,43,53,53,0,43,53,53,0,255,255,0,156,0,0,6,62,7,66,2,34,0,53,0,0,1,7,0,141,1,236,1,111,0,19,64,11,2,0,39,
+39,1,6,37,2,40,5,38,0,43,53,1,43,53,0,255,255,0,127,0,0,3,195,5,211,2,34,0,85,0,0,1,7,0,141,0,181,0,0,0,19,64,
+11,1,0,19,19,0,7,37,1,20,17,38,0,43,53,1,43,53,0,255,255,0,156,0,0,6,62,7,56,2,34,0,53,0,0,1,7,0,225,1,235,1,
+114,0,19,64,11,2,0,39,43,1,6,37,2,38,5,38,0,43,53,1,43,53,0,255,255,0,127,0,0,3,195,5,198,2,34,0,85,0,0,1,7,0,
+225,0,185,0,0,0,19,64,11,1,0,19,23,0,7,37,1,18,17,38,0,43,53,1,43,53,0,255,255,0,71,255,231,5,121,7,70,2,34,0,
+54,0,0,1,7,0,141,1,145,1,115,0,23,64,14,1,159,47,1,0,47,47,16,23,37,1,48,5,38,0,43,53,1,43,93,53,0,255,255,0,
+51,255,231,4,156,5,211,2,34,0,86,0,0,1,7,0,141,1,13,0,0,0,19,64,11,1,0,49,49,16,24,37,1,50,17,38,0,43,53,1,43,
+53,0,255,255,0,47,254,81,5,144,5,186,2,34,0,55,0,0,1,7,0,222,1,143,0,0,0,17,64,9,1,0,8,8,5,5,37,1,11,0,47,53,
+1,43,53,0,255,255,0,56,254,81,3,85,5,186,2,34,0,87,0,0,1,7,0,222,0,220,0,0,0,17,64,9,1,0,37,42,18,5,37,1,34,0,
+47,53,1,43,53,0,255,255,0,47,0,0,5,144,7,56,2,34,0,55,0,0,1,7,0,225,1,146,1,114,0,19,64,11,1,0,10,14,5,4,37,1,
+9,5,38,0,43,53,1,43,53,0,255,255,0,56,255,232,4,212,5,186,0,38,0,87,0,0,1,7,1,81,2,248,6,51,0,23,64,14,1,95,
+24,96,24,112,24,192,24,4,24,1,24,0,0,63,53,1,47,93,53,0,255,255,0,151,255,230,6,20,7,222,2,34,0,56,0,0,1,7,0,
+221,2,1,1,114,0,23,64,13,2,1,0,31,25,16,1,37,2,1,28,5,38,0,43,53,53,1,43,53,53,0,255,255,0,119,255,232,4,218,
+6,108,2,34,0,88,0,0,1,7,0,221,1,86,0,0,0,23,64,13,2,1,0,26,20,9,19,37,2,1,23,17,38,0,43,53,53,1,43,53,53,0,
+255,255,0,151,255,230,6,20,7,69,2,34,0,56,0,0,1,7,0,223,1,251,1,114,0,39,64,27,2,1,160,28,192,28,2,0,28,32,28,
+64,28,128,28,4,0,28,31,16,1,37,2,1,28,5,38,0,43,53,53,1,43,93,93,53,53,0,255,255,0,119,255,232,4,218,5,211,2,
+34,0,88,0,0,1,7,0,223,0,244,0,0,0,43,64,30,2,1,0,23,1,16,23,192,23,2,32,23,48,23,80,23,112,23,4,0,23,26,9,19,
+37,2,1,23,17,38,0,43,53,53,1,43,93,93,113,53,53,0,255,255,0,34,0,0,5,145,7,70,2,34,0,61,0,0,1,7,0,141,1,139,1,
+115,0,19,64,11,1,0,12,12,0,1,37,1,13,5,38,0,43,53,1,43,53,0,255,255,0,37,0,0,4,71,5,211,2,34,0,93,0,0,1,7,0,
+141,0,233,0,0,0,23,64,14,1,159,12,1,0,12,12,0,1,37,1,13,17,38,0,43,53,1,43,93,53,0,255,255,0,34,0,0,5,145,7,
+63,2,34,0,61,0,0,1,7,0,220,1,169,1,103,0,19,64,11,1,0,13,12,0,1,37,1,13,5,38,0,43,53,1,43,53,0,255,255,0,37,0,
+0,4,71,5,216,2,34,0,93,0,0,1,7,0,220,0,232,0,0,0,19,64,11,1,0,13,12,0,1,37,1,13,17,38,0,43,53,1,43,53,0,0,2,
+255,244,254,154,4,12,255,204,0,3,0,7,0,32,177,5,6,184,255,192,64,11,10,14,54,6,1,6,2,7,3,6,2,47,60,47,60,0,47,
+51,205,47,43,205,49,48,5,33,53,33,17,33,53,33,4,12,251,232,4,24,251,232,4,24,154,102,254,206,102,0,0,1,0,125,
+4,66,2,8,5,211,0,3,0,23,64,9,3,3,2,3,1,2,0,0,2,47,51,47,17,57,57,0,47,51,47,49,48,1,3,35,19,2,8,201,194,45,5,
+211,254,111,1,145,0,2,0,119,4,66,3,205,5,211,0,3,0,7,0,41,64,18,3,7,7,2,6,3,1,2,0,0,2,7,5,6,4,2,4,6,47,51,51,
+47,18,57,57,47,51,47,18,57,57,0,47,60,51,47,60,49,48,1,3,35,19,35,3,35,19,3,205,201,194,45,109,201,194,45,5,
+211,254,111,1,145,254,111,1,145,0,4,0,125,0,0,4,92,5,186,0,5,0,11,0,15,0,19,0,97,64,58,4,10,3,2,15,8,1,8,8,15,
+18,173,17,18,13,17,2,1,13,4,5,5,12,133,4,15,13,63,13,2,13,8,7,17,10,11,11,16,133,13,10,17,20,17,101,2,63,21,
+95,21,143,21,3,21,64,9,10,54,43,93,43,47,51,51,253,50,47,47,17,57,57,47,93,51,253,50,47,47,17,57,57,0,16,60,
+63,253,60,50,47,93,60,63,60,49,48,1,3,33,3,17,33,1,3,33,3,17,33,1,33,17,33,1,33,17,33,4,92,84,254,246,84,1,
+178,253,211,84,254,246,84,1,178,2,31,254,106,1,150,253,211,254,106,1,150,4,109,253,96,2,160,1,77,254,179,253,
+96,2,160,1,77,250,70,1,102,254,154,1,102,0,0,1,0,70,2,233,3,63,5,203,0,17,0,72,179,71,14,1,14,184,255,240,64,
+36,11,17,54,0,8,11,9,4,154,14,8,14,9,3,1,141,0,0,0,1,0,19,10,7,141,160,8,1,8,8,18,19,64,11,12,54,43,17,51,47,
+93,253,57,16,221,113,16,237,0,63,51,51,47,253,17,57,47,60,43,113,49,48,1,33,17,52,35,34,21,17,33,17,33,21,51,
+54,51,50,22,21,3,63,254,238,96,115,254,236,1,0,8,89,167,119,122,2,233,1,140,127,178,254,167,2,209,118,135,145,
+134,0,255,255,0,148,255,231,13,128,5,186,0,38,0,51,0,0,0,39,0,87,5,120,0,0,1,7,0,86,8,228,0,0,0,41,64,27,3,
+128,44,1,44,2,64,40,176,40,2,40,64,21,25,54,63,40,64,40,128,40,3,40,1,0,10,1,47,53,53,47,93,43,113,53,46,93,
+53,0,0,4,0,98,255,182,7,158,5,211,0,3,0,23,0,35,0,45,0,148,64,16,0,1,1,180,2,3,20,2,2,3,30,16,18,19,54,24,184,
+255,240,64,72,18,19,54,23,21,179,23,7,14,16,179,11,0,3,3,14,7,11,7,41,179,24,36,179,24,30,66,1,2,25,0,3,1,2,4,
+9,27,43,178,63,33,143,33,2,33,33,39,178,27,47,27,111,2,23,66,14,14,4,48,13,128,13,2,13,13,19,178,9,46,9,108,2,
+43,47,237,51,47,93,60,213,16,230,43,47,237,51,47,93,237,17,18,23,57,0,63,60,246,50,237,47,237,63,51,51,60,16,
+60,16,237,47,47,51,237,47,43,43,135,5,46,43,125,16,196,49,48,1,1,35,1,1,6,6,35,32,17,16,33,32,23,7,38,35,34,6,
+21,20,51,50,55,1,50,22,21,20,6,35,34,38,53,52,54,19,50,54,53,52,35,34,21,20,22,6,18,252,179,209,3,75,254,46,
+34,187,136,254,90,1,162,1,45,60,242,22,97,64,73,137,103,30,3,135,192,206,206,192,192,205,205,192,62,55,117,
+116,55,5,211,249,227,6,29,253,240,114,128,1,129,1,129,236,43,86,103,89,188,94,254,198,219,166,165,220,219,166,
+166,219,253,187,90,106,197,197,106,90,0,0,2,1,7,255,224,3,216,5,103,0,34,0,42,0,0,1,2,21,20,51,50,55,54,51,50,
+21,20,6,35,34,38,53,52,55,6,35,34,38,53,52,55,54,55,18,18,51,50,22,21,16,5,54,54,53,52,35,34,2,2,111,56,29,38,
+45,20,27,38,137,93,76,90,3,52,16,13,27,27,68,29,61,211,159,80,86,254,181,90,115,35,40,84,2,30,254,220,80,55,
+96,42,45,81,159,129,171,34,57,55,31,26,26,31,76,36,1,97,1,244,111,82,254,224,173,100,248,95,74,254,250,0,0,1,
+0,79,0,157,7,176,3,108,0,13,0,0,1,51,6,7,33,21,33,22,23,35,38,39,53,54,1,236,76,81,114,6,59,249,197,102,96,78,
+223,191,177,3,108,170,139,101,102,207,253,88,45,71,0,1,0,153,254,83,3,104,5,183,0,13,0,0,19,36,55,51,22,23,21,
+38,39,17,35,17,6,7,153,1,6,71,46,87,253,207,102,101,139,170,4,26,236,177,192,223,77,96,101,249,195,6,61,114,
+81,0,0,1,0,79,0,157,7,176,3,108,0,13,0,0,1,18,23,21,6,7,35,54,55,33,53,33,38,39,6,19,237,176,191,223,77,95,
+102,249,197,6,59,114,81,3,108,254,250,71,45,88,253,207,102,101,139,170,0,1,0,153,254,83,3,104,5,183,0,13,0,0,
+23,53,22,23,17,51,17,54,55,21,6,7,35,38,153,170,139,101,102,207,253,87,46,71,16,76,81,114,6,62,249,194,102,95,
+77,223,191,176,0,1,0,79,0,158,7,176,3,110,0,23,0,0,1,21,6,3,35,54,55,33,22,23,35,2,39,53,54,19,51,6,7,33,38,
+39,51,18,7,176,181,225,80,69,125,250,231,125,69,80,224,182,182,224,80,69,125,5,25,125,69,80,225,2,28,45,79,
+254,254,172,139,139,172,1,2,79,45,79,1,3,172,139,139,172,254,253,0,1,0,152,254,85,3,103,5,183,0,23,0,0,1,51,
+22,5,21,38,39,17,54,55,21,4,7,35,38,37,53,22,23,17,6,7,53,36,1,233,45,79,1,2,171,140,140,171,254,254,79,45,79,
+254,254,171,140,140,171,1,2,5,183,182,225,80,69,126,250,230,126,68,79,225,182,182,225,79,68,126,5,26,126,69,
+80,225,0,2,0,152,253,148,3,103,5,183,0,23,0,27,0,0,1,51,22,5,21,38,39,17,54,55,21,4,7,35,38,37,53,22,23,17,6,
+7,53,36,1,33,21,33,1,233,45,79,1,2,171,140,140,171,254,254,79,45,79,254,254,171,140,140,171,1,2,255,0,2,205,
+253,51,5,183,182,225,80,69,126,250,230,126,68,79,225,182,182,225,79,68,126,5,26,126,69,80,225,248,245,98,0,0,
+1,1,106,0,0,6,107,4,255,0,5,0,0,1,51,17,33,21,33,1,106,100,4,157,250,255,4,255,251,101,100,0,1,0,192,0,0,5,1,
+5,104,0,27,0,0,33,35,17,62,5,51,50,30,2,17,17,35,17,52,46,2,35,34,14,2,21,1,46,110,1,3,36,83,146,181,94,144,
+249,123,29,109,24,96,203,113,114,203,93,24,2,48,118,219,165,137,120,65,141,195,217,254,241,253,208,2,54,232,
+203,163,114,116,158,205,233,0,0,3,0,127,1,138,4,78,3,232,0,3,0,7,0,11,0,0,1,21,33,53,5,21,33,53,5,21,33,53,4,
+78,252,49,3,207,252,49,3,207,252,49,3,232,123,123,241,123,123,242,123,123,0,2,0,146,0,0,4,66,3,176,0,3,0,7,0,
+0,19,33,17,33,19,17,33,17,146,3,176,252,80,76,3,24,3,176,252,80,3,100,252,232,3,24,0,1,0,131,1,189,2,82,3,141,
+0,3,0,0,1,17,33,17,2,82,254,49,3,141,254,48,1,207,0,2,0,131,1,189,2,82,3,141,0,3,0,7,0,0,1,17,33,17,5,5,17,33,
+2,82,254,49,1,131,254,201,1,55,3,141,254,48,1,207,75,1,254,201,0,1,0,178,0,137,4,35,3,250,0,11,0,0,1,50,0,21,
+20,0,35,34,0,53,52,36,2,107,181,1,3,254,254,182,182,254,253,1,7,3,250,254,254,182,182,254,253,1,3,182,189,251,
+0,2,0,112,1,170,2,102,3,160,0,11,0,23,0,0,1,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,
+38,1,107,101,150,147,104,104,147,148,103,71,104,103,72,72,103,104,3,160,144,107,104,147,147,104,104,147,76,
+100,75,73,102,102,73,74,101,0,1,0,206,253,170,1,220,255,135,0,9,0,35,64,16,6,5,5,9,164,0,5,8,6,6,9,8,8,2,164,
+9,47,237,57,47,17,51,47,18,57,0,47,253,50,47,57,49,48,23,33,21,20,6,7,39,54,55,35,206,1,14,89,110,71,121,1,
+122,121,196,108,125,48,104,54,83,255,255,0,2,0,0,6,62,6,250,2,38,0,36,0,0,1,7,0,218,1,196,1,84,0,19,64,11,2,
+14,5,38,2,0,14,13,2,7,37,1,43,53,0,43,53,0,255,255,0,73,255,232,5,16,5,166,2,38,0,68,0,0,1,7,0,218,1,88,0,0,0,
+19,64,11,2,59,17,38,2,0,59,58,1,13,37,1,43,53,0,43,53,0,255,255,0,97,255,230,5,243,7,66,2,38,0,38,0,0,1,7,0,
+216,1,224,1,124,0,19,64,11,1,37,5,38,1,0,37,33,9,15,37,1,43,53,0,43,53,0,255,255,0,74,255,231,5,22,5,198,2,38,
+0,70,0,0,1,7,0,216,1,104,0,0,0,19,64,11,1,39,17,38,1,0,39,35,10,19,37,1,43,53,0,43,53,0,255,255,0,97,255,230,
+5,243,7,76,2,38,0,38,0,0,1,7,0,220,1,220,1,116,0,19,64,11,1,33,5,38,1,0,31,32,9,2,37,1,43,53,0,43,53,0,255,
+255,0,74,255,231,5,22,5,216,2,38,0,70,0,0,1,7,0,220,1,96,0,0,0,19,64,11,1,36,17,38,1,0,36,35,10,2,37,1,43,53,
+0,43,53,0,255,255,0,149,0,0,5,105,6,250,2,38,0,40,0,0,1,7,0,218,1,176,1,84,0,19,64,11,1,15,5,38,1,0,15,14,0,1,
+37,1,43,53,0,43,53,0,255,255,0,72,255,232,5,22,5,166,2,38,0,72,0,0,1,7,0,218,1,104,0,0,0,19,64,11,2,36,17,38,
+2,0,36,35,17,24,37,1,43,53,0,43,53,0,255,255,0,149,0,0,5,105,7,79,2,38,0,40,0,0,1,7,0,219,1,160,1,124,0,19,64,
+11,1,17,5,38,1,0,20,13,0,1,37,1,43,53,0,43,53,0,255,255,0,72,255,232,5,22,5,211,2,38,0,72,0,0,1,7,0,219,1,72,
+0,0,0,19,64,11,2,38,17,38,2,0,41,34,17,24,37,1,43,53,0,43,53,0,255,255,0,149,0,0,5,105,7,76,2,38,0,40,0,0,1,7,
+0,220,1,176,1,116,0,19,64,11,1,15,5,38,1,0,15,14,0,1,37,1,43,53,0,43,53,0,255,255,0,72,255,232,5,22,5,216,2,
+38,0,72,0,0,1,7,0,220,1,96,0,0,0,19,64,11,2,36,17,38,2,0,36,35,17,24,37,1,43,53,0,43,53,0,255,255,0,94,255,
+231,6,51,7,66,2,38,0,42,0,0,1,7,0,216,2,24,1,124,0,19,64,11,1,40,5,38,1,0,40,36,10,2,37,1,43,53,0,43,53,0,255,
+255,0,73,254,81,4,220,5,198,2,38,0,74,0,0,1,7,0,216,1,84,0,0,0,19,64,11,2,55,17,38,2,0,55,51,30,1,37,1,43,53,
+0,43,53,0,255,255,0,94,255,231,6,51,7,76,2,38,0,42,0,0,1,7,0,220,2,24,1,116,0,19,64,11,1,37,5,38,1,0,34,35,10,
+2,37,1,43,53,0,43,53,0,255,255,0,73,254,81,4,220,5,216,2,38,0,74,0,0,1,7,0,220,1,84,0,0,0,19,64,11,2,52,17,38,
+2,0,52,51,30,1,37,1,43,53,0,43,53,0,255,255,0,94,254,81,6,51,5,211,2,38,0,42,0,0,1,7,0,222,2,80,0,0,0,11,182,
+1,0,47,40,10,3,37,1,43,53,0,255,255,0,73,254,81,4,220,6,134,2,38,0,74,0,0,1,15,1,81,4,13,4,48,192,0,0,19,64,
+11,2,50,17,38,2,0,50,49,30,1,37,1,43,53,0,43,53,0,255,255,0,152,0,0,6,19,7,66,2,38,0,43,0,0,1,7,0,216,2,0,1,
+124,0,19,64,11,1,18,5,38,1,0,18,14,0,5,37,1,43,53,0,43,53,0,255,255,0,123,0,0,4,222,7,62,2,38,0,75,0,0,1,7,0,
+216,1,88,1,120,0,19,64,11,1,26,2,38,1,0,26,22,0,9,37,1,43,53,0,43,53,0,0,2,0,18,0,0,6,152,5,186,0,19,0,23,0,
+93,64,10,18,14,10,146,0,22,9,9,12,23,184,255,192,64,40,9,10,54,23,147,111,5,1,5,5,7,16,12,3,3,7,18,0,16,20,3,
+127,17,0,2,25,2,110,2,9,13,23,6,127,12,7,24,7,107,2,43,47,60,253,60,60,47,43,47,51,60,253,60,60,47,0,63,60,63,
+60,18,57,47,93,253,43,17,57,47,60,60,253,60,60,49,48,1,35,17,33,17,33,17,33,17,35,53,51,53,33,21,33,53,33,21,
+51,1,53,33,21,6,152,134,254,60,254,14,254,60,134,134,1,196,1,242,1,196,134,253,182,254,14,4,78,251,178,2,80,
+253,176,4,78,221,143,143,143,143,254,141,150,150,0,1,0,20,0,0,4,223,5,186,0,25,0,127,185,0,22,255,240,179,9,
+11,54,20,184,255,224,64,19,9,16,54,18,11,64,33,33,54,95,11,1,11,146,17,80,12,1,12,184,255,192,179,32,33,54,12,
+184,255,192,64,43,9,12,54,12,12,14,20,4,151,22,16,14,0,0,9,18,48,18,1,18,16,11,1,11,1,133,0,27,0,104,2,15,20,
+18,8,133,11,14,9,26,9,101,2,43,47,60,51,253,50,60,60,43,47,237,47,93,47,93,0,63,60,63,63,253,57,18,57,47,43,
+43,93,60,253,93,43,60,43,43,49,48,33,33,17,52,35,34,6,21,17,33,17,35,53,51,53,33,21,33,21,33,17,54,51,50,22,
+21,4,223,254,105,144,79,87,254,105,103,103,1,151,1,5,254,251,144,217,176,180,2,72,184,117,141,254,2,4,162,186,
+94,94,186,254,252,159,213,196,255,255,0,44,0,0,2,254,7,54,2,38,0,44,0,0,1,7,0,217,0,64,1,124,0,19,64,11,1,18,
+5,38,1,0,20,6,0,1,37,1,43,53,0,43,53,0,255,255,255,248,0,0,2,202,5,186,2,38,0,215,0,0,1,6,0,217,12,0,0,19,64,
+11,1,18,17,38,1,0,20,7,0,1,37,1,43,53,0,43,53,0,255,255,0,78,0,0,2,213,6,250,2,38,0,44,0,0,1,7,0,218,0,60,1,
+84,0,19,64,11,1,7,5,38,1,0,7,6,0,1,37,1,43,53,0,43,53,0,255,255,0,18,0,0,2,153,5,166,2,38,0,215,0,0,1,6,0,218,
+0,0,0,19,64,11,1,7,17,38,1,0,7,6,0,1,37,1,43,53,0,43,53,0,255,255,0,60,0,0,2,231,7,83,2,38,0,44,0,0,1,7,0,219,
+0,60,1,128,0,19,64,11,1,9,5,38,1,0,12,5,0,1,37,1,43,53,0,43,53,0,255,255,0,0,0,0,2,171,5,211,2,38,0,215,0,0,1,
+6,0,219,0,0,0,19,64,11,1,9,17,38,1,0,12,5,0,1,37,1,43,53,0,43,53,0,0,1,0,172,254,66,2,186,5,186,0,18,0,71,64,
+41,143,20,207,20,2,18,11,0,16,2,2,16,16,11,11,8,18,9,3,18,18,12,14,178,5,5,11,127,143,8,1,8,8,20,127,110,8,19,
+8,107,2,43,43,47,93,253,57,47,253,50,50,47,0,63,63,60,17,51,47,51,47,18,57,17,57,49,48,1,93,1,6,35,34,38,53,
+52,55,35,17,33,17,35,6,21,20,51,50,55,2,186,113,98,118,136,41,102,1,197,181,12,139,46,81,254,111,45,126,107,
+87,126,5,186,250,70,65,54,153,26,0,2,0,137,254,66,2,104,5,186,0,18,0,22,0,73,64,40,22,22,9,19,0,9,15,18,11,0,
+16,2,2,16,16,11,11,8,18,18,18,12,14,178,5,5,21,11,133,22,8,8,24,133,104,8,23,8,101,2,43,43,47,196,253,60,57,
+47,253,50,50,47,0,63,60,17,51,47,51,47,18,57,17,57,63,63,18,57,47,49,48,1,6,35,34,38,53,52,55,35,17,33,17,35,
+6,21,20,51,50,55,1,33,17,33,2,104,113,97,119,135,41,56,1,152,183,12,139,46,81,254,34,1,151,254,105,254,111,45,
+126,107,87,126,4,37,251,219,65,54,153,26,6,176,254,235,255,255,0,35,255,230,4,190,7,62,2,38,0,45,0,0,1,7,0,
+216,1,100,1,120,0,19,64,11,1,26,5,38,1,0,26,22,10,1,37,1,43,53,0,43,53,0,0,2,255,156,254,81,2,195,5,199,0,6,0,
+21,0,107,185,0,11,255,240,64,61,9,11,54,200,13,1,2,4,5,64,9,10,54,5,0,5,4,17,15,7,15,18,151,13,28,3,5,4,1,6,2,
+0,64,9,13,54,0,16,4,1,4,0,4,2,16,21,15,9,133,4,15,21,21,23,133,104,8,22,21,101,2,43,43,47,51,51,237,47,18,57,
+47,51,51,47,93,47,43,18,57,57,17,57,57,0,63,237,63,57,63,51,60,47,43,18,57,93,49,48,1,43,1,35,39,7,35,19,33,1,
+33,17,20,6,6,35,34,39,19,22,51,50,54,53,2,195,248,121,123,248,230,1,32,254,166,1,152,57,154,143,118,175,61,49,
+23,52,54,4,168,154,154,1,31,254,95,251,250,197,164,102,35,1,40,10,71,106,0,255,255,0,152,253,170,6,170,5,186,
+2,38,0,46,0,0,1,7,1,81,2,28,0,0,0,11,182,1,0,12,13,10,7,37,1,43,53,0,255,255,0,123,253,170,5,86,5,186,2,38,0,
+78,0,0,1,7,1,81,1,112,0,0,0,11,182,1,0,12,13,10,7,37,1,43,53,0,0,1,0,123,0,0,5,78,4,37,0,11,0,141,64,35,207,9,
+1,192,8,1,11,11,10,2,1,1,135,0,11,20,0,0,11,8,9,9,169,10,3,20,10,10,3,2,11,8,3,6,3,184,255,192,64,44,17,22,54,
+3,3,5,9,10,10,6,15,0,1,1,5,18,192,2,1,2,11,9,10,31,17,22,54,10,1,10,16,0,1,0,0,13,8,3,133,5,12,5,101,2,43,47,
+253,60,17,51,47,93,51,51,47,43,51,57,57,93,0,63,60,16,60,63,60,16,60,18,57,47,43,18,23,57,135,5,46,43,4,125,
+16,196,135,5,46,24,43,135,8,125,196,49,48,0,93,1,93,33,33,3,7,17,33,17,33,17,1,33,1,5,78,254,53,215,154,254,
+105,1,151,1,50,1,243,254,133,1,170,150,254,236,4,37,254,160,1,96,254,141,255,255,0,150,254,81,5,30,5,186,2,38,
+0,47,0,0,1,7,0,222,1,160,0,0,0,11,182,1,0,19,12,5,4,37,1,43,53,0,255,255,0,18,254,81,2,111,5,186,2,38,0,79,0,
+0,1,6,0,222,0,0,0,11,182,1,0,4,10,3,2,37,1,43,53,0,255,255,0,153,254,81,6,19,5,186,2,38,0,49,0,0,1,7,0,222,2,
+40,0,0,0,11,182,1,0,23,16,8,6,37,1,43,53,0,255,255,0,123,254,81,4,222,4,62,2,38,0,81,0,0,1,7,0,222,1,152,0,0,
+0,11,182,1,0,33,26,19,9,37,1,43,53,0,0,1,0,152,254,82,6,39,5,211,0,26,0,78,181,8,16,11,12,54,3,184,255,240,64,
+40,9,10,54,11,13,147,11,8,28,26,24,18,147,3,4,24,3,23,18,10,10,22,16,125,5,28,5,111,2,25,22,127,0,23,1,23,27,
+23,107,2,43,47,93,253,57,43,47,253,17,57,47,0,63,63,63,253,17,57,63,51,237,47,43,43,49,48,1,54,36,51,32,17,16,
+0,33,34,39,19,22,51,50,18,17,16,33,34,6,21,17,33,17,33,21,2,70,63,1,7,141,2,14,254,233,254,220,103,139,61,54,
+34,113,98,254,248,104,150,254,60,1,170,5,14,81,116,252,223,253,199,253,217,35,1,80,11,1,112,1,120,1,182,116,
+74,252,102,5,186,172,0,0,1,0,152,254,82,5,8,4,61,0,27,0,65,64,38,72,8,1,11,25,10,13,151,8,28,27,25,19,151,2,
+16,25,15,24,18,10,10,23,16,131,5,29,5,105,2,26,23,133,24,28,24,101,2,43,47,237,57,43,47,253,17,57,47,0,63,63,
+63,253,17,57,63,253,57,17,57,93,49,48,1,54,51,50,18,17,16,2,35,34,39,19,22,51,50,54,17,52,38,35,34,6,21,17,33,
+17,33,21,2,43,132,228,206,167,190,207,129,133,61,39,33,67,52,77,79,72,75,254,86,1,143,3,121,196,254,190,254,
+155,254,83,254,105,35,1,39,11,242,1,0,240,161,133,116,253,229,4,37,172,0,255,255,0,93,255,231,6,76,6,250,2,38,
+0,50,0,0,1,7,0,218,2,0,1,84,0,19,64,11,2,29,5,38,2,0,29,28,0,6,37,1,43,53,0,43,53,0,255,255,0,73,255,232,5,13,
+5,166,2,38,0,82,0,0,1,7,0,218,1,84,0,0,0,19,64,11,2,29,17,38,2,0,29,28,0,7,37,1,43,53,0,43,53,0,255,255,0,93,
+255,231,6,76,7,83,2,38,0,50,0,0,1,7,0,219,1,244,1,128,0,19,64,11,2,31,5,38,2,0,34,27,0,6,37,1,43,53,0,43,53,0,
+255,255,0,73,255,232,5,13,5,211,2,38,0,82,0,0,1,7,0,219,1,76,0,0,0,19,64,11,2,31,17,38,2,0,34,27,0,7,37,1,43,
+53,0,43,53,0,255,255,0,156,254,81,6,62,5,186,2,38,0,53,0,0,1,7,0,222,2,4,0,0,0,11,182,2,0,38,43,25,18,37,1,43,
+53,0,255,255,0,127,254,81,3,195,4,62,2,38,0,85,0,0,1,7,0,222,0,148,0,0,0,11,182,1,0,30,23,16,7,37,1,43,53,0,
+255,255,0,71,255,231,5,121,7,70,2,38,0,54,0,0,1,7,0,216,1,140,1,128,0,19,64,11,1,51,5,38,1,0,51,47,16,38,37,1,
+43,53,0,43,53,0,255,255,0,51,255,231,4,156,5,198,2,38,0,86,0,0,1,7,0,216,1,8,0,0,0,19,64,11,1,53,17,38,1,0,53,
+49,16,40,37,1,43,53,0,43,53,0,0,1,0,53,0,0,5,147,5,186,0,15,0,78,64,47,4,9,149,3,10,10,7,0,13,145,14,3,7,18,0,
+4,0,4,2,6,127,7,176,13,1,13,9,11,9,13,16,7,80,7,144,7,3,16,7,80,7,144,7,208,7,4,7,47,93,114,51,51,60,47,47,93,
+16,253,60,50,50,47,47,0,63,63,253,60,17,57,47,60,253,60,49,48,1,33,17,51,17,35,17,33,17,35,17,51,17,33,17,33,
+5,147,254,52,192,192,254,59,182,182,254,51,5,94,4,82,254,229,254,250,253,207,2,49,1,6,1,27,1,104,0,1,0,53,255,
+231,3,82,5,186,0,30,0,105,182,16,0,23,8,146,22,9,184,255,192,64,40,9,11,54,9,9,30,12,28,149,2,19,19,12,152,18,
+13,15,22,22,19,9,12,30,0,19,19,0,17,21,25,133,14,10,12,192,6,208,6,2,6,184,255,192,64,9,15,25,54,0,6,48,6,2,6,
+47,93,43,113,51,60,60,253,60,60,50,50,47,47,57,47,60,17,51,47,0,63,60,253,60,63,253,17,57,57,47,43,60,253,60,
+63,49,48,37,6,35,34,38,38,53,53,35,53,51,53,35,17,51,53,37,17,51,17,35,21,51,21,35,21,20,22,51,50,55,3,82,147,
+136,153,156,55,150,150,150,150,1,151,224,224,176,176,46,38,51,74,8,33,88,168,160,31,221,121,1,41,196,209,254,
+107,254,215,121,221,33,82,43,27,0,255,255,0,151,255,230,6,20,7,58,2,38,0,56,0,0,1,7,0,217,2,0,1,128,0,19,64,
+11,1,39,5,38,1,0,41,28,16,1,37,1,43,53,0,43,53,0,255,255,0,119,255,232,4,218,5,186,2,38,0,88,0,0,1,7,0,217,1,
+88,0,0,0,19,64,11,1,34,17,38,1,0,36,23,9,19,37,1,43,53,0,43,53,0,255,255,0,151,255,230,6,20,6,250,2,38,0,56,0,
+0,1,7,0,218,2,4,1,84,0,19,64,11,1,28,5,38,1,0,25,26,16,1,37,1,43,53,0,43,53,0,255,255,0,119,255,232,4,218,5,
+166,2,38,0,88,0,0,1,7,0,218,1,80,0,0,0,19,64,11,1,23,17,38,1,0,23,22,9,19,37,1,43,53,0,43,53,0,255,255,0,151,
+255,230,6,20,7,83,2,38,0,56,0,0,1,7,0,219,1,252,1,128,0,19,64,11,1,30,5,38,1,0,33,26,16,1,37,1,43,53,0,43,53,
+0,255,255,0,119,255,232,4,218,5,211,2,38,0,88,0,0,1,7,0,219,1,84,0,0,0,19,64,11,1,25,17,38,1,0,28,21,9,19,37,
+1,43,53,0,43,53,0,0,1,0,152,254,66,6,18,5,186,0,31,0,73,64,40,31,25,0,29,2,2,29,7,16,145,29,25,19,21,11,3,31,
+31,25,7,27,178,5,5,22,10,20,127,21,33,21,110,2,12,127,11,32,11,107,2,43,47,237,43,47,237,17,18,57,47,253,57,
+50,50,47,0,63,60,63,51,237,57,47,51,47,18,57,17,57,49,48,1,6,35,34,38,53,52,55,36,0,17,17,33,17,20,22,51,50,
+54,53,17,33,17,16,0,5,6,21,20,51,50,55,4,137,113,98,118,136,35,254,222,254,223,1,196,127,123,123,125,1,196,
+254,190,254,183,8,139,46,81,254,111,45,126,107,78,117,15,1,83,1,0,3,106,252,129,119,137,137,119,3,127,252,150,
+254,239,254,170,2,55,39,153,26,0,0,1,0,119,254,66,5,6,4,37,0,33,0,80,64,46,33,26,0,31,2,2,31,31,10,32,9,14,54,
+10,26,20,151,12,19,8,26,18,25,16,15,33,33,29,178,5,5,8,23,133,26,35,26,104,2,17,133,16,34,16,101,2,43,47,237,
+43,47,237,57,50,47,253,50,47,0,63,60,63,60,63,237,17,57,43,51,47,51,47,18,57,17,57,49,48,1,6,35,34,38,53,52,
+55,55,53,35,6,35,34,38,53,17,33,17,20,51,50,54,53,17,33,17,35,6,21,20,51,50,55,5,6,114,97,118,136,21,20,4,137,
+242,178,182,1,151,144,79,87,1,151,211,12,139,46,81,254,111,45,126,107,62,78,73,172,197,212,198,2,164,253,184,
+184,117,141,1,254,251,219,65,54,153,26,255,255,255,255,0,0,8,1,7,62,2,38,0,58,0,0,1,7,0,216,2,172,1,120,0,19,
+64,11,1,19,5,38,1,0,19,15,1,6,37,1,43,53,0,43,53,0,255,255,0,3,0,0,7,145,5,198,2,38,0,90,0,0,1,7,0,216,2,104,
+0,0,0,19,64,11,1,19,17,38,1,0,19,15,1,6,37,1,43,53,0,43,53,0,255,255,0,2,0,0,6,61,7,62,2,38,0,60,0,0,1,7,0,
+216,1,200,1,120,0,19,64,11,1,15,5,38,1,0,15,11,0,4,37,1,43,53,0,43,53,0,255,255,0,5,254,81,4,234,5,198,2,38,0,
+92,0,0,1,7,0,216,1,48,0,0,0,19,64,11,1,24,17,38,1,0,24,20,0,4,37,1,43,53,0,43,53,0,0,1,0,119,0,0,3,16,5,211,0,
+12,0,34,64,18,1,1,0,3,149,11,1,7,18,0,0,6,133,7,13,7,101,2,43,47,253,50,47,0,63,63,237,57,50,47,49,48,1,7,38,
+35,34,21,17,33,17,52,18,33,50,3,16,59,46,38,131,254,121,238,1,49,61,5,193,250,12,209,251,254,3,248,204,1,15,0,
+255,255,0,2,0,0,6,62,8,171,2,38,0,99,0,0,1,7,0,141,1,160,2,216,0,19,64,10,3,37,5,3,0,37,35,17,12,37,1,43,53,0,
+16,206,52,0,255,255,0,73,255,232,5,16,7,239,2,38,0,68,0,0,0,39,0,221,1,86,0,0,1,7,0,141,1,32,2,28,0,38,64,23,
+4,83,65,3,2,59,17,38,4,0,83,81,1,13,37,3,2,0,62,56,1,13,37,1,43,53,53,43,53,0,43,53,53,16,206,52,255,255,255,
+180,0,0,7,183,7,79,2,38,0,144,0,0,1,7,0,141,3,68,1,124,0,19,64,11,2,23,5,38,2,0,23,21,0,1,37,1,43,53,0,43,53,
+0,255,255,0,69,255,232,7,198,5,211,2,38,0,160,0,0,1,7,0,141,2,152,0,0,0,19,64,11,3,83,17,38,3,0,83,81,39,57,
+37,1,43,53,0,43,53,0,255,255,0,35,255,204,6,135,7,79,2,38,0,145,0,0,1,7,0,141,1,244,1,124,0,19,64,11,3,43,5,
+38,3,0,43,41,19,6,37,1,43,53,0,43,53,0,255,255,0,73,255,159,5,12,5,211,2,38,0,161,0,0,1,7,0,141,1,84,0,0,0,19,
+64,11,3,49,17,38,3,20,49,47,18,5,37,1,43,53,0,43,53,0,0,1,0,6,4,143,1,125,5,186,0,3,0,25,64,10,64,3,128,2,3,1,
+2,0,0,2,47,51,47,17,57,57,0,47,26,205,26,49,48,1,3,35,19,1,125,180,195,66,5,186,254,213,1,43,0,3,255,254,4,
+172,2,172,7,27,0,3,0,7,0,11,0,63,64,34,64,3,128,2,64,9,13,54,2,2,7,10,5,9,4,63,5,1,5,3,1,2,0,0,2,64,12,13,54,
+2,8,2,5,9,47,51,51,205,47,43,51,47,18,57,57,47,93,205,0,47,60,221,60,50,47,43,26,205,26,49,48,1,3,35,19,1,33,
+53,33,5,33,53,33,2,45,180,195,66,1,180,254,250,1,6,254,88,254,250,1,6,7,27,254,213,1,43,253,145,250,250,250,0,
+255,255,0,2,0,0,6,62,5,186,2,38,0,36,0,0,1,6,1,152,0,0,0,20,179,2,14,3,2,184,255,172,180,13,11,3,2,37,1,43,53,
+0,63,53,0,1,0,184,2,120,1,242,3,164,0,3,0,16,181,0,0,3,2,2,3,47,51,47,0,47,51,47,49,48,19,33,17,33,184,1,58,
+254,198,3,164,254,212,0,255,255,0,6,0,0,6,105,5,186,0,39,0,40,1,0,0,0,1,6,1,152,0,0,0,20,179,1,15,3,1,184,255,
+236,180,14,12,16,11,37,1,43,53,0,63,53,255,255,0,6,0,0,7,15,5,186,0,39,0,43,0,252,0,0,1,6,1,152,0,0,0,20,179,
+1,15,3,1,184,255,236,180,14,12,16,11,37,1,43,53,0,63,53,255,255,0,6,0,0,3,86,5,186,0,39,0,44,0,232,0,0,1,6,1,
+152,0,0,0,18,64,10,1,7,3,1,20,6,4,8,3,37,1,43,53,0,63,53,255,255,0,6,255,231,6,184,5,211,0,38,0,50,108,0,1,6,
+1,152,0,0,0,18,64,10,2,29,3,2,0,28,26,30,12,37,1,43,53,0,63,53,255,255,0,6,0,0,7,193,5,186,0,39,0,60,1,132,0,
+0,1,6,1,152,0,0,0,18,64,10,1,12,3,1,0,11,9,13,0,37,1,43,53,0,63,53,255,255,0,6,0,0,6,200,5,211,0,38,1,186,124,
+0,1,6,1,152,0,0,0,18,64,10,1,32,3,1,0,31,29,33,1,37,1,43,53,0,63,53,255,255,255,254,0,0,2,172,7,27,2,38,0,215,
+0,0,1,6,1,153,0,0,0,27,64,15,3,2,1,13,17,38,3,2,1,0,13,8,0,1,37,1,43,53,53,53,0,43,53,53,53,0,255,255,0,2,0,0,
+6,62,5,186,2,6,0,36,0,0,255,255,0,151,0,0,5,226,5,186,2,6,0,37,0,0,0,1,0,150,0,0,5,31,5,186,0,5,0,31,64,18,1,
+147,4,3,3,18,5,7,5,111,2,2,127,3,6,3,107,2,43,47,237,43,47,0,63,63,237,49,48,1,33,17,33,17,33,5,31,253,59,254,
+60,4,137,4,82,251,174,5,186,0,0,2,255,254,0,0,6,59,5,186,0,3,0,6,0,120,64,36,57,2,54,3,202,4,3,3,5,4,4,144,0,
+3,20,0,0,3,2,5,6,197,6,1,6,144,1,2,20,1,1,2,50,5,1,5,184,255,240,64,33,9,10,54,5,3,2,3,4,6,147,0,1,18,137,0,
+134,1,2,4,3,0,2,6,5,1,0,1,112,5,192,5,2,5,25,47,93,51,51,24,47,18,57,57,47,57,57,93,0,63,60,253,60,63,60,57,
+43,93,135,5,46,43,93,135,125,196,24,135,5,46,43,135,125,196,49,48,1,93,33,33,1,33,11,2,6,59,249,195,2,39,1,
+239,14,235,242,5,186,251,129,3,2,252,254,0,255,255,0,149,0,0,5,105,5,186,2,6,0,40,0,0,255,255,0,34,0,0,5,145,
+5,186,2,6,0,61,0,0,255,255,0,152,0,0,6,19,5,186,2,6,0,43,0,0,0,3,0,94,255,231,6,76,5,211,0,11,0,20,0,24,0,72,
+64,45,22,64,9,10,54,22,149,175,23,1,63,23,1,23,23,12,17,145,0,4,12,145,6,19,24,24,15,125,3,26,3,111,2,48,23,1,
+23,23,19,125,9,25,9,108,2,43,47,253,50,47,93,43,47,253,50,47,0,63,237,63,253,17,57,47,93,93,237,43,49,48,1,32,
+0,17,16,0,33,32,0,17,16,0,1,50,54,53,16,33,32,17,16,1,33,17,33,3,82,1,111,1,139,254,121,254,159,254,116,254,
+134,1,136,1,110,152,155,254,203,254,209,1,254,254,112,1,144,5,211,254,120,254,156,254,141,254,115,1,162,1,82,
+1,99,1,149,251,104,195,240,1,145,254,90,254,98,1,33,1,21,0,255,255,0,168,0,0,2,110,5,186,2,6,0,44,0,0,255,255,
+0,152,0,0,6,170,5,186,2,6,0,46,0,0,0,1,0,2,0,0,6,55,5,186,0,6,0,87,64,47,6,2,1,1,129,0,6,20,0,0,6,5,2,3,3,129,
+4,5,20,4,4,5,2,3,6,5,3,0,1,3,4,18,1,6,0,5,3,2,4,0,4,112,2,192,2,2,2,25,47,93,51,51,24,47,18,57,57,47,57,57,0,
+63,60,60,60,63,60,18,57,135,5,46,43,135,125,196,135,46,24,43,135,125,196,49,48,33,33,1,1,33,1,33,6,55,254,39,
+254,180,254,189,254,51,2,33,1,235,4,33,251,223,5,186,255,255,0,145,0,0,7,2,5,186,2,6,0,48,0,0,255,255,0,153,0,
+0,6,19,5,186,2,6,0,49,0,0,0,3,0,121,0,0,5,78,5,186,0,3,0,7,0,11,0,90,64,59,5,64,20,21,54,143,5,1,5,64,9,10,54,
+5,147,127,6,1,6,64,26,28,54,255,6,1,239,6,1,112,6,1,6,6,10,1,147,2,3,10,147,9,18,4,4,3,8,13,8,110,2,5,5,2,9,
+12,9,107,2,43,47,196,51,47,43,47,196,51,47,0,63,237,63,253,17,57,47,93,93,93,43,113,237,43,93,43,49,48,1,33,
+17,33,3,33,17,33,19,33,17,33,5,55,251,86,4,170,161,252,159,3,97,184,251,43,4,213,4,127,1,59,252,179,1,41,252,
+106,1,76,255,255,0,93,255,231,6,76,5,211,2,6,0,50,0,0,0,1,0,152,0,0,6,18,5,186,0,7,0,36,64,21,3,147,6,3,0,5,
+18,1,127,0,9,0,110,2,4,127,5,8,5,107,2,43,47,237,43,47,237,0,63,60,63,237,49,48,33,33,17,33,17,33,17,33,6,18,
+254,60,254,14,254,60,5,122,4,82,251,174,5,186,255,255,0,148,0,0,5,112,5,186,2,6,0,51,0,0,0,1,0,152,0,0,5,109,
+5,186,0,11,0,61,64,34,3,9,9,10,4,8,147,5,3,2,10,147,1,18,10,8,3,3,9,9,2,6,66,0,13,0,111,2,4,2,12,2,107,2,43,
+47,60,43,47,228,18,57,47,23,57,0,63,253,57,63,253,57,25,17,57,47,60,49,48,33,33,17,1,1,17,33,17,33,1,1,33,5,
+109,251,43,1,178,254,78,4,190,253,43,1,174,254,82,2,236,1,61,1,185,1,149,1,47,254,197,254,119,254,86,0,255,
+255,0,47,0,0,5,144,5,186,2,6,0,55,0,0,255,255,0,2,0,0,6,61,5,186,2,6,0,60,0,0,0,3,0,74,255,236,7,29,5,207,0,
+13,0,20,0,27,0,130,64,40,20,66,22,145,0,41,11,1,11,11,12,4,14,66,21,145,4,66,38,7,1,7,7,6,19,25,125,9,17,125,
+2,2,13,14,5,127,12,21,9,6,184,255,192,179,46,50,54,6,184,255,192,179,43,44,54,6,184,255,192,179,38,39,54,6,
+184,255,192,64,9,32,36,54,32,6,80,6,2,6,184,255,192,64,9,21,25,54,16,6,144,6,2,6,47,93,43,113,43,43,43,43,51,
+60,60,253,60,60,50,47,237,47,237,0,63,51,47,93,228,253,228,63,51,47,93,60,253,228,49,48,1,4,17,16,5,21,33,53,
+36,17,16,37,53,33,17,54,54,53,52,38,39,1,17,6,6,21,20,22,4,129,2,156,253,100,254,100,253,101,2,155,1,156,107,
+118,121,104,254,100,101,124,123,5,74,70,253,238,253,227,61,172,176,57,2,29,2,19,69,133,251,252,31,159,111,106,
+169,34,253,154,2,94,29,171,109,102,162,0,255,255,0,3,0,0,6,61,5,186,2,6,0,59,0,0,0,1,0,82,0,0,7,61,5,186,0,25,
+0,89,64,41,19,66,16,145,3,66,6,6,5,25,17,10,3,5,18,11,127,80,10,1,10,24,127,25,25,18,4,127,17,10,32,5,128,5,2,
+112,5,160,5,2,5,184,255,192,64,13,29,30,54,16,5,64,5,144,5,192,5,4,5,47,93,43,113,114,51,60,253,60,50,47,237,
+47,93,237,0,63,63,196,196,18,57,47,228,253,228,49,48,1,16,0,33,17,33,17,32,0,17,17,33,17,20,22,22,51,17,33,17,
+50,54,54,53,17,33,7,61,254,187,254,178,254,59,254,178,254,187,1,197,21,90,95,1,197,95,91,21,1,196,3,233,254,
+238,254,170,254,127,1,125,1,86,1,18,1,209,254,27,79,101,76,2,233,253,27,76,101,79,1,229,0,0,1,0,94,0,0,6,76,5,
+211,0,28,0,89,64,34,20,145,6,4,13,16,25,28,147,14,27,18,13,16,64,14,18,54,63,16,1,16,16,12,18,125,13,9,30,9,
+111,2,27,25,184,255,192,64,17,14,18,54,48,25,1,25,25,0,23,125,27,3,29,3,108,2,43,47,51,237,57,50,47,93,43,47,
+43,47,51,237,57,50,47,93,43,47,0,63,60,253,60,60,60,63,237,49,48,1,38,2,53,16,0,33,32,0,17,20,2,7,51,17,33,17,
+54,17,16,33,34,6,21,16,23,17,33,17,1,68,85,145,1,137,1,107,1,119,1,131,145,85,217,253,107,221,254,203,149,154,
+221,253,106,1,63,63,1,37,146,1,53,1,105,254,166,254,188,146,254,219,63,254,193,1,63,155,1,61,1,104,192,168,
+254,215,175,254,193,1,63,0,255,255,0,56,0,0,2,231,7,17,2,34,0,44,0,0,1,7,0,142,0,58,1,107,0,23,64,13,2,1,0,7,
+10,0,1,37,2,1,7,5,38,0,43,53,53,1,43,53,53,0,255,255,0,2,0,0,6,61,7,17,2,34,0,60,0,0,1,7,0,142,1,200,1,107,0,
+23,64,13,2,1,0,12,15,0,4,37,2,1,12,5,38,0,43,53,53,1,43,53,53,0,255,255,0,78,255,231,5,72,5,186,2,38,1,194,0,
+0,1,7,1,152,2,16,0,0,0,19,64,11,2,34,17,38,2,0,34,32,14,1,37,1,43,53,0,43,53,0,255,255,0,74,255,231,4,90,5,
+186,2,38,1,198,0,0,1,7,1,152,1,200,0,0,0,19,64,11,1,33,17,38,1,0,33,31,9,14,37,1,43,53,0,43,53,0,255,255,0,
+123,254,106,4,223,5,186,2,38,1,200,0,0,1,7,1,152,2,24,0,0,0,19,64,11,1,21,17,38,1,0,21,19,10,18,37,1,43,53,0,
+43,53,0,255,255,0,138,0,0,2,49,5,186,2,38,0,215,0,0,1,7,1,152,0,180,0,0,0,19,64,11,1,6,17,38,1,40,6,4,0,1,37,
+1,43,53,0,43,53,0,255,255,0,119,255,231,4,219,7,27,2,38,1,214,0,0,1,7,1,153,1,88,0,0,0,27,64,15,3,2,1,26,17,
+38,3,2,1,0,26,21,7,16,37,1,43,53,53,53,0,43,53,53,53,0,0,2,0,78,255,231,5,72,4,61,0,21,0,31,0,87,64,54,54,17,
+1,19,21,15,27,149,17,16,9,7,18,22,149,11,22,57,14,1,19,9,25,7,133,6,21,133,6,66,0,25,131,0,128,3,159,3,207,3,
+3,3,3,33,30,131,152,14,1,14,32,14,102,2,43,47,93,237,17,51,47,93,51,237,47,228,237,16,253,17,57,57,93,0,63,
+237,63,57,63,237,63,57,93,49,48,1,6,2,21,20,18,23,33,38,39,6,35,34,0,53,52,0,51,50,23,54,55,1,50,54,53,16,35,
+34,6,21,16,5,72,72,66,61,62,254,140,26,21,99,219,240,254,230,1,35,235,193,131,11,32,254,194,80,76,160,82,78,4,
+39,126,254,213,120,87,254,212,131,52,67,144,1,95,223,235,1,45,137,53,62,252,201,137,151,1,37,143,150,254,224,
+0,2,0,119,254,106,4,217,5,211,0,19,0,37,0,88,64,55,6,16,9,10,54,0,37,146,20,20,6,25,149,14,1,31,149,6,22,10,
+27,20,20,29,0,143,23,1,23,131,17,64,9,14,54,17,17,34,131,3,39,3,105,2,29,9,133,16,10,1,10,38,10,101,2,43,47,
+93,253,60,43,47,237,57,47,43,237,93,57,17,57,47,0,63,63,237,63,237,18,57,47,237,57,43,49,48,1,22,22,21,20,6,
+35,34,39,17,33,17,52,36,51,50,4,21,20,6,37,54,54,53,52,35,34,6,21,17,22,51,50,54,53,52,38,39,3,174,130,169,
+225,197,203,106,254,121,1,19,243,233,1,9,106,254,75,76,100,127,64,67,68,133,75,86,132,148,3,70,30,237,151,214,
+231,123,254,8,5,142,232,243,195,180,93,146,14,13,105,76,150,105,94,253,129,155,91,83,102,145,13,0,0,1,255,254,
+254,106,4,229,4,37,0,8,0,136,64,40,7,8,7,6,8,135,0,1,20,0,0,1,7,6,7,8,6,135,5,4,20,5,5,4,7,5,1,4,4,3,0,8,6,5,
+15,3,27,6,1,5,184,255,232,179,17,18,54,5,184,255,232,64,33,9,12,54,5,8,4,0,24,17,18,54,0,24,9,12,54,48,0,128,
+0,2,0,0,7,1,133,5,4,79,10,159,10,2,93,47,51,253,57,50,47,93,43,43,18,57,47,43,43,18,57,0,63,63,60,60,60,18,57,
+47,60,18,57,135,5,46,43,8,125,16,196,135,5,46,24,43,8,125,16,196,49,48,1,1,17,33,17,1,33,19,19,4,229,254,84,
+254,105,254,92,1,168,203,217,4,37,252,16,254,53,1,203,3,240,253,96,2,160,0,0,3,0,74,255,231,5,12,5,184,0,17,0,
+28,0,29,0,75,64,45,57,7,1,14,0,1,13,23,149,29,16,0,149,15,3,18,149,7,22,22,4,1,1,0,13,3,14,16,16,21,131,4,31,
+4,105,2,14,14,26,131,10,30,10,102,2,43,47,237,57,47,43,47,237,57,47,18,23,57,93,0,63,237,63,237,63,237,57,57,
+18,57,93,49,48,1,5,22,18,21,20,0,33,32,0,53,52,18,55,37,17,33,17,1,50,54,53,16,35,34,6,21,20,22,19,2,143,1,47,
+163,171,254,201,254,211,254,222,254,196,188,180,254,238,3,213,254,45,98,105,199,101,104,103,96,4,158,166,88,
+255,0,154,229,254,198,1,54,227,176,1,15,59,162,1,28,254,230,252,96,134,128,1,2,143,119,124,134,3,64,0,1,0,74,
+255,231,4,90,4,61,0,30,0,184,64,14,112,3,128,3,2,7,23,146,208,22,239,22,2,22,184,255,192,64,9,12,13,54,22,22,
+28,17,14,15,184,255,192,64,14,19,20,54,15,17,146,15,12,16,64,30,1,30,0,184,255,240,64,34,14,18,54,0,28,146,30,
+2,22,5,16,18,18,54,9,16,18,18,54,9,16,9,10,54,15,30,0,22,22,5,0,14,14,0,184,255,192,64,18,12,13,54,0,0,1,0,0,
+32,7,8,14,16,54,7,19,131,9,184,255,192,64,12,21,22,54,9,9,26,131,5,31,5,102,2,43,47,237,57,47,43,237,57,43,17,
+51,47,93,43,51,47,17,18,57,47,18,57,57,43,43,43,0,63,51,253,57,43,125,47,24,93,63,51,237,124,47,24,43,205,17,
+18,57,47,43,93,237,57,49,48,1,93,37,6,33,32,36,53,52,55,38,53,52,36,33,50,23,7,38,35,34,21,20,22,51,21,34,6,
+21,20,51,50,55,4,90,164,254,224,254,235,254,201,188,147,1,34,1,5,252,153,153,111,131,158,106,140,147,132,193,
+145,103,104,129,183,153,158,82,71,162,141,160,77,222,58,80,52,50,228,58,65,94,82,0,1,0,78,254,82,3,156,5,186,
+0,28,0,60,64,34,8,12,1,0,26,149,27,0,14,146,13,28,13,13,22,28,16,136,28,48,9,1,9,9,30,27,27,3,131,22,29,22,
+102,2,43,47,237,57,47,17,51,47,93,51,237,47,17,57,47,0,63,237,63,237,57,93,49,48,1,2,2,21,20,30,3,21,20,6,35,
+35,19,50,53,52,46,3,53,52,18,55,33,17,33,3,156,238,213,61,202,95,66,237,189,113,70,170,50,217,145,108,218,239,
+254,100,3,33,4,205,254,253,254,189,147,60,101,94,66,125,101,166,217,1,8,76,32,50,66,80,184,159,160,1,80,207,1,
+26,0,1,0,123,254,106,4,223,4,61,0,18,0,66,179,185,17,1,15,184,255,240,64,35,9,11,54,54,12,86,12,2,12,10,4,151,
+15,16,10,15,1,27,9,18,1,133,0,20,0,104,2,11,8,133,9,19,9,101,2,43,47,253,57,43,47,237,0,63,63,63,63,253,17,57,
+93,43,49,48,0,93,1,33,17,52,35,34,6,21,17,33,17,33,21,51,54,51,50,22,21,4,223,254,105,144,79,87,254,105,1,125,
+4,137,242,178,182,254,106,3,222,184,117,141,254,2,4,37,172,196,211,198,0,3,0,84,255,231,5,2,5,211,0,10,0,17,0,
+23,0,65,64,41,175,19,1,19,64,9,10,54,19,149,63,17,1,17,17,22,14,149,0,1,22,149,6,22,18,66,11,131,3,25,3,105,2,
+19,17,131,9,24,9,102,2,43,47,253,60,43,47,253,228,0,63,237,63,253,17,57,47,93,237,43,93,49,48,1,32,0,17,16,0,
+33,32,0,17,16,1,38,38,35,34,6,7,1,33,22,22,51,50,2,180,1,16,1,62,254,207,254,217,254,224,254,202,3,18,10,87,
+93,91,86,7,1,120,254,136,8,89,89,177,5,211,254,126,254,150,254,138,254,118,1,141,1,111,2,240,253,168,166,155,
+152,169,254,215,177,163,0,255,255,0,138,0,0,2,33,4,38,2,6,0,215,0,0,0,1,0,123,0,0,5,78,4,37,0,11,0,141,64,35,
+207,9,1,192,8,1,11,11,10,2,1,1,135,0,11,20,0,0,11,8,9,9,169,10,3,20,10,10,3,2,11,8,3,6,3,184,255,192,64,44,17,
+22,54,3,3,5,9,10,10,6,15,0,1,1,5,18,192,2,1,2,11,9,10,31,17,22,54,10,1,10,16,0,1,0,0,13,8,3,133,5,12,5,101,2,
+43,47,253,60,17,51,47,93,51,51,47,43,51,57,57,93,0,63,60,16,60,63,60,16,60,18,57,47,43,18,23,57,135,5,46,43,4,
+125,16,196,135,5,46,24,43,135,8,125,196,49,48,0,93,1,93,33,33,3,7,17,33,17,33,17,1,33,1,5,78,254,53,215,154,
+254,105,1,151,1,50,1,243,254,133,1,170,150,254,236,4,37,254,160,1,96,254,141,0,1,255,252,0,0,4,225,5,186,0,7,
+0,113,64,68,5,5,4,2,1,2,3,1,6,2,3,2,1,3,135,4,5,20,4,4,5,6,1,1,169,0,7,20,0,0,7,2,5,5,4,7,6,0,0,1,3,4,18,9,0,
+6,4,25,0,73,0,70,4,134,4,6,1,2,3,5,7,5,6,0,6,0,6,4,47,51,51,47,47,17,23,57,93,0,63,60,60,60,63,60,18,57,47,57,
+135,5,46,43,125,16,196,135,46,24,43,8,125,16,196,49,48,135,8,16,196,8,196,33,33,3,3,33,1,3,33,4,225,254,113,
+221,203,254,82,1,217,164,1,137,2,150,253,106,4,59,1,127,0,1,0,119,254,111,4,219,4,37,0,20,0,50,64,29,20,9,15,
+1,18,8,27,2,6,15,151,4,22,1,19,133,0,22,0,104,2,7,10,133,9,21,9,101,2,43,47,253,60,43,47,237,57,0,63,237,57,
+57,63,63,63,60,49,48,33,33,53,6,35,34,39,17,33,17,33,17,20,22,22,51,50,54,53,17,33,4,219,254,129,65,99,121,49,
+254,105,1,151,17,69,72,75,77,1,151,84,109,101,254,35,5,182,253,235,72,90,71,94,150,2,10,255,255,0,2,0,0,4,232,
+4,38,2,6,0,89,0,0,0,1,0,78,254,82,3,129,5,203,0,42,0,97,64,20,26,0,146,42,42,14,34,149,33,1,14,146,13,27,23,
+24,17,20,54,3,184,255,232,64,14,17,20,54,13,13,23,17,42,66,33,17,134,33,9,184,255,192,64,18,12,13,54,9,9,44,
+26,38,134,29,29,3,131,23,43,23,102,2,43,47,237,57,47,253,57,17,51,47,43,51,237,47,228,17,18,57,47,43,43,0,63,
+237,63,253,17,57,47,237,57,49,48,1,6,6,21,20,30,3,21,20,6,35,35,19,50,54,53,52,46,3,53,52,54,55,38,38,53,52,
+36,51,51,17,38,35,34,21,20,22,51,51,3,61,164,192,58,197,99,70,235,191,113,70,77,87,50,214,144,106,189,163,140,
+149,1,14,255,161,79,54,202,125,104,108,2,233,10,154,130,51,84,85,64,125,101,164,207,1,8,42,34,30,46,59,72,166,
+145,159,216,35,31,162,118,156,178,254,241,5,111,52,63,0,255,255,0,73,255,232,5,13,4,62,2,6,0,82,0,0,0,1,0,20,
+0,0,5,150,4,37,0,11,0,80,64,19,1,5,9,149,10,15,2,7,18,0,64,21,22,54,0,3,133,0,2,184,255,192,64,11,18,20,54,2,
+2,13,9,6,133,9,7,184,255,192,64,13,18,21,54,7,7,12,15,13,63,13,128,13,3,93,17,51,47,43,51,237,47,17,51,47,43,
+51,237,47,43,0,63,60,63,253,60,60,49,48,1,35,17,33,17,33,17,33,17,35,17,33,5,150,134,254,105,254,203,254,104,
+152,5,130,2,252,253,4,2,252,253,4,2,252,1,41,0,2,0,125,254,106,5,10,4,61,0,13,0,24,0,45,64,27,0,27,19,149,4,
+16,12,14,149,10,22,17,131,7,26,7,105,2,22,66,13,133,0,25,0,101,2,43,47,253,228,43,47,237,0,63,237,57,63,237,
+63,49,48,19,17,16,0,33,32,0,17,20,2,35,34,39,17,19,50,54,53,16,35,34,6,21,20,22,125,1,57,1,13,1,16,1,55,242,
+206,204,106,185,80,86,172,86,97,96,254,106,3,150,1,6,1,55,254,198,254,255,246,254,219,117,254,14,2,170,134,
+112,1,6,131,127,107,143,0,1,0,78,254,82,4,45,4,61,0,31,0,93,64,15,1,1,0,3,149,30,16,17,17,16,19,146,14,28,11,
+184,255,248,179,17,17,54,11,184,255,248,64,11,9,11,54,16,16,27,0,21,134,0,11,184,255,192,64,18,12,13,54,0,11,
+176,11,2,11,11,33,6,131,27,32,27,102,2,43,47,237,17,51,47,93,43,51,237,47,17,57,47,43,43,0,63,253,57,50,47,63,
+253,57,50,47,49,48,1,3,38,35,34,6,21,20,22,4,22,21,20,4,35,34,39,19,22,51,50,53,52,38,36,38,38,53,16,0,33,50,
+4,45,86,143,80,119,168,86,1,127,117,254,240,238,82,133,51,96,54,163,69,254,242,162,119,1,128,1,50,170,4,20,
+254,218,34,159,117,49,96,188,146,80,180,199,8,1,10,10,68,34,64,107,90,158,118,1,12,1,88,0,2,0,74,255,231,5,
+207,4,61,0,16,0,28,0,108,64,33,56,6,55,12,2,0,151,16,15,23,149,12,16,17,149,6,22,167,20,168,26,2,119,20,120,
+26,2,0,1,20,131,0,3,184,255,192,64,41,36,37,54,64,3,112,3,2,223,3,1,3,3,30,26,131,9,29,9,102,2,0,30,1,0,30,32,
+30,48,30,128,30,176,30,192,30,224,30,240,30,8,93,113,43,47,237,17,51,47,93,113,43,51,237,57,47,93,93,0,63,237,
+63,237,63,237,93,49,48,1,35,22,21,20,0,33,32,0,53,52,0,33,50,23,23,33,1,50,54,53,52,38,35,34,6,21,20,22,5,207,
+240,45,254,201,254,211,254,223,254,195,1,63,1,31,68,78,65,2,84,252,219,98,105,108,91,101,104,103,2,252,108,
+121,233,254,185,1,67,230,238,1,63,12,12,252,217,144,134,133,142,155,124,129,145,0,1,0,20,0,0,3,250,4,37,0,7,0,
+65,64,14,0,5,151,6,15,3,18,5,0,0,2,133,5,3,184,255,192,64,11,49,50,54,80,3,176,3,208,3,3,3,184,255,192,64,10,
+23,24,54,16,3,1,3,63,9,1,93,47,93,43,113,43,51,253,50,47,47,0,63,63,253,60,49,48,1,33,17,33,17,33,17,33,3,250,
+254,217,254,104,254,217,3,230,2,252,253,4,2,252,1,41,0,0,1,0,119,255,231,4,219,4,37,0,16,0,36,64,21,11,151,3,
+22,16,7,15,15,133,16,18,16,104,2,8,133,7,17,7,101,2,43,47,237,43,47,237,0,63,60,63,237,49,48,1,20,4,33,32,36,
+53,17,33,17,20,51,50,54,53,17,33,4,219,254,214,254,243,254,247,254,220,1,151,154,75,81,1,151,1,174,209,246,
+245,210,2,119,253,196,196,88,108,2,60,0,0,2,0,72,254,106,6,199,4,61,0,25,0,35,0,80,64,38,20,32,149,19,4,16,26,
+66,0,149,10,66,13,19,12,27,19,19,1,23,131,16,29,131,192,7,1,192,7,1,7,7,35,11,133,1,16,12,184,255,192,182,22,
+25,54,12,63,37,1,93,47,43,51,60,253,60,50,47,93,113,237,47,253,17,57,47,0,63,63,228,253,228,63,60,253,60,49,
+48,1,17,16,54,51,32,0,17,20,0,5,17,33,17,36,0,53,16,0,37,3,6,6,21,20,22,5,54,54,53,52,38,35,34,6,21,2,188,217,
+238,1,22,1,46,254,162,254,219,254,120,254,234,254,162,1,27,1,63,64,63,84,137,1,236,108,143,88,59,56,48,1,25,1,
+90,1,2,200,254,224,254,241,233,254,208,12,254,129,1,130,13,1,46,231,1,4,1,23,20,254,211,14,126,91,117,144,16,
+14,132,104,120,138,90,94,0,0,1,0,14,254,106,5,33,4,37,0,11,0,127,64,19,2,8,11,5,5,4,10,9,9,7,6,15,0,1,1,3,4,
+27,11,184,255,248,64,55,10,11,54,5,8,10,11,54,9,0,6,4,6,6,9,10,4,5,6,11,8,9,133,10,1,133,10,0,7,133,6,3,133,6,
+4,2,66,0,4,0,8,1,208,8,1,8,31,13,79,13,127,13,175,13,4,93,25,47,93,113,51,51,24,230,47,51,237,47,237,47,51,
+237,47,237,18,57,17,57,93,43,43,0,63,60,60,16,60,63,60,60,16,60,25,18,57,47,60,51,51,49,48,1,33,3,3,33,1,1,33,
+19,19,33,1,5,33,254,67,200,244,254,102,1,123,254,154,1,192,181,202,1,164,254,158,254,106,2,11,253,245,2,254,2,
+189,254,24,1,232,253,67,0,0,1,0,119,254,106,6,221,4,37,0,21,0,75,64,48,20,15,10,15,17,14,149,3,66,6,22,5,27,
+11,133,10,20,133,21,16,21,4,133,15,10,80,5,1,128,5,1,64,5,160,5,192,5,208,5,240,5,5,5,15,23,63,23,2,93,47,93,
+113,114,51,60,253,50,60,47,237,47,237,0,63,63,228,253,60,63,60,60,49,48,1,16,0,33,17,33,17,32,0,17,17,33,17,
+16,51,17,33,17,50,17,17,33,6,221,254,202,254,208,254,104,254,207,254,201,1,151,209,1,152,207,1,151,2,84,254,
+215,254,193,254,126,1,127,1,63,1,44,1,209,254,26,254,230,3,0,253,0,1,26,1,230,0,0,1,0,72,255,231,7,74,4,37,0,
+36,0,121,64,53,11,16,12,13,54,5,16,12,13,54,26,26,0,16,15,31,22,8,22,149,5,11,22,8,26,133,27,64,21,23,54,159,
+27,1,27,27,20,36,64,10,11,54,36,0,33,133,36,2,38,2,105,2,17,184,255,192,64,24,10,11,54,17,16,20,133,17,14,37,
+14,102,2,31,38,63,38,96,38,144,38,207,38,5,93,43,47,51,253,57,47,43,43,47,51,237,57,47,43,17,57,47,93,43,237,
+57,0,63,60,237,57,16,60,63,60,57,47,43,43,49,48,1,22,17,16,0,35,34,38,39,6,6,35,34,0,17,16,55,33,6,2,21,20,51,
+50,54,53,17,33,17,20,22,51,50,53,52,2,39,6,207,123,254,236,240,121,220,42,40,210,129,240,254,236,123,1,153,36,
+64,145,42,75,1,152,73,41,146,64,37,4,37,224,254,230,254,248,254,196,127,107,108,126,1,60,1,8,1,26,224,92,254,
+203,113,252,113,90,1,80,254,176,90,113,252,113,1,53,92,255,255,255,254,0,0,2,173,5,166,2,34,0,215,0,0,1,6,0,
+142,0,0,0,23,64,13,2,1,0,7,10,0,1,37,2,1,7,17,38,0,43,53,53,1,43,53,53,0,255,255,0,119,255,231,4,219,5,166,2,
+38,1,214,0,0,1,7,0,142,1,88,0,0,0,23,64,13,2,1,20,17,38,2,1,0,20,23,7,16,37,1,43,53,53,0,43,53,53,0,255,255,0,
+73,255,232,5,13,5,186,2,38,0,82,0,0,1,7,1,152,2,28,0,0,0,19,64,11,2,28,17,38,2,20,28,26,0,7,37,1,43,53,0,43,
+53,0,255,255,0,119,255,231,4,219,5,186,2,38,1,214,0,0,1,7,1,152,2,32,0,0,0,19,64,11,1,19,17,38,1,20,19,17,7,
+16,37,1,43,53,0,43,53,0,255,255,0,72,255,231,7,74,5,186,2,38,1,218,0,0,1,7,1,152,3,44,0,0,0,19,64,11,1,39,17,
+38,1,20,39,37,17,36,37,1,43,53,0,43,53,0,255,255,0,149,0,0,5,105,7,17,2,34,0,40,0,0,1,7,0,142,1,143,1,107,0,
+23,64,13,2,1,0,15,18,0,1,37,2,1,15,5,38,0,43,53,53,1,43,53,53,0,0,1,0,53,255,244,7,184,5,186,0,29,0,108,182,
+21,145,0,0,19,145,2,184,255,192,64,16,15,16,54,2,2,23,28,28,25,147,26,3,11,11,10,13,184,255,192,64,10,9,10,54,
+13,149,8,19,23,18,5,184,255,240,64,22,13,15,54,25,10,10,22,16,125,5,31,5,111,2,27,5,27,29,22,127,25,23,47,51,
+253,60,50,50,47,43,47,253,17,57,47,47,43,0,63,63,237,43,57,50,47,63,253,60,17,18,57,47,43,237,57,47,237,49,48,
+1,54,51,32,0,21,20,4,33,34,39,19,22,51,50,54,53,52,38,35,34,7,17,33,17,33,17,33,17,33,3,199,200,164,1,58,1,75,
+254,189,254,202,57,115,62,72,38,76,107,124,104,152,179,254,59,254,51,5,94,254,52,3,133,72,254,250,244,233,246,
+16,1,53,14,81,71,75,80,74,253,236,4,82,1,104,254,152,255,255,0,150,0,0,5,31,7,83,2,38,1,241,0,0,1,7,0,141,1,
+76,1,128,0,19,64,11,1,9,5,38,1,0,9,7,4,5,37,1,43,53,0,43,53,0,0,1,0,94,255,231,6,29,5,211,0,23,0,94,64,57,19,
+64,9,10,54,19,149,223,16,1,175,16,1,63,16,1,16,16,21,11,12,14,145,12,9,4,0,23,21,145,23,3,19,18,18,19,23,12,
+127,11,23,127,11,0,25,0,111,2,19,66,16,125,6,24,6,108,2,43,47,253,228,43,47,51,237,47,237,17,18,57,47,0,63,51,
+237,47,57,63,51,237,47,57,17,57,47,93,93,93,237,43,49,48,1,6,4,33,32,0,17,16,0,33,32,19,5,38,35,32,3,33,17,33,
+18,33,50,55,6,29,68,254,171,254,194,254,159,254,121,1,139,1,111,1,238,182,254,104,67,201,254,254,43,1,188,254,
+70,37,1,4,223,62,1,170,200,251,1,141,1,115,1,100,1,136,254,143,155,184,254,229,254,240,254,231,226,0,255,255,
+0,71,255,231,5,121,5,211,2,6,0,54,0,0,255,255,0,168,0,0,2,110,5,186,2,6,0,44,0,0,255,255,0,56,0,0,2,231,7,17,
+2,34,0,44,0,0,1,7,0,142,0,58,1,107,0,23,64,13,2,1,0,7,10,0,1,37,2,1,7,5,38,0,43,53,53,1,43,53,53,0,255,255,0,
+35,255,230,4,190,5,186,2,6,0,45,0,0,0,2,0,2,255,250,9,90,5,186,0,25,0,32,0,86,64,52,123,2,1,0,145,32,32,9,11,
+147,24,3,20,147,16,26,145,16,9,18,25,26,127,15,9,47,9,95,9,111,9,4,9,9,12,29,125,104,4,1,4,34,4,111,2,18,12,
+127,18,23,23,33,17,51,47,51,237,47,43,47,93,237,18,57,47,93,253,60,0,63,51,237,47,237,63,237,18,57,47,253,49,
+48,1,93,1,51,32,4,21,20,6,4,35,33,17,33,17,16,2,6,35,34,39,17,51,50,54,53,17,33,17,51,50,53,52,35,35,5,217,
+242,1,68,1,75,186,254,162,35,252,245,254,158,59,217,242,74,96,68,92,76,4,235,232,213,213,232,3,133,246,237,
+149,228,41,4,82,254,61,254,234,254,251,122,16,1,41,81,108,3,202,251,129,154,135,0,0,2,0,152,0,0,9,90,5,186,0,
+19,0,26,0,98,64,61,123,2,1,0,145,26,16,147,111,11,1,11,11,13,19,14,3,20,145,9,9,13,18,19,20,127,18,9,64,19,21,
+54,9,64,14,16,54,47,9,1,9,9,12,23,125,104,4,1,4,28,4,111,2,15,12,127,13,27,13,107,2,43,47,253,60,43,47,93,237,
+18,57,47,93,43,43,60,253,60,0,63,60,16,237,63,60,18,57,47,93,237,212,253,49,48,1,93,1,51,32,4,21,20,6,4,35,33,
+17,33,17,33,17,33,17,33,17,33,17,51,50,53,52,35,35,5,217,242,1,68,1,75,186,254,162,35,252,245,254,72,254,60,1,
+196,1,184,1,197,232,213,213,232,3,133,246,237,149,228,41,2,80,253,176,5,186,253,254,2,2,251,129,154,135,0,0,1,
+0,53,0,0,7,86,5,186,0,20,0,61,64,33,6,145,15,15,4,147,17,17,8,13,13,10,147,11,3,0,8,18,10,1,127,0,22,0,104,2,
+12,14,12,7,127,10,8,47,51,253,50,60,47,43,47,237,47,0,63,60,63,253,60,17,18,57,47,237,57,47,237,49,48,33,33,
+17,52,35,34,7,17,33,17,33,17,33,17,33,21,54,51,50,0,21,7,86,254,59,198,147,113,254,59,254,51,5,94,254,52,199,
+198,224,1,34,1,133,223,106,254,6,4,82,1,104,254,152,246,115,254,246,230,0,255,255,0,150,0,0,5,203,7,79,2,38,1,
+248,0,0,1,7,0,141,1,148,1,124,0,19,64,11,1,31,5,38,1,0,31,29,8,17,37,1,43,53,0,43,53,0,0,2,0,12,255,231,5,88,
+7,80,0,16,0,29,0,153,64,98,54,0,57,4,2,5,0,10,4,2,17,127,23,1,23,64,9,10,54,23,26,162,23,20,5,15,2,115,2,2,2,
+16,5,3,4,3,1,0,3,12,12,14,145,9,19,29,161,17,17,3,4,24,161,23,23,1,0,5,4,16,2,0,3,181,64,4,1,4,1,181,207,0,1,
+15,0,63,0,111,0,159,0,207,0,5,0,12,0,4,12,3,96,2,144,2,192,2,3,2,25,47,93,23,51,24,47,47,93,113,237,47,113,
+237,17,18,57,17,57,17,18,57,47,237,17,18,57,47,237,0,63,253,50,47,63,60,60,60,23,57,93,63,51,237,47,43,93,60,
+49,48,1,93,93,19,33,19,19,33,1,14,2,35,34,39,17,22,51,50,55,1,6,6,35,34,38,39,51,22,51,50,54,55,12,1,236,203,
+200,1,205,254,31,59,88,173,151,80,195,115,53,157,34,2,18,2,197,135,157,179,12,172,30,138,76,87,15,5,186,253,
+164,2,92,251,148,137,135,87,23,1,47,12,117,5,186,145,156,159,142,107,43,64,0,1,0,152,254,193,6,18,5,186,0,11,
+0,51,64,29,11,6,3,3,8,147,0,3,5,18,1,128,4,4,7,10,127,11,13,11,110,2,8,127,5,12,5,107,2,43,47,237,43,47,253,
+17,57,47,237,0,63,51,60,237,47,63,60,49,48,33,33,17,33,17,33,17,33,17,33,17,33,6,18,253,248,254,148,253,250,1,
+196,1,242,1,196,254,193,1,63,5,186,251,174,4,82,0,255,255,0,2,0,0,6,62,5,186,2,6,0,36,0,0,0,2,0,152,0,0,5,221,
+5,186,0,12,0,19,0,61,185,0,0,255,192,64,33,9,10,54,0,145,19,19,8,12,145,9,3,13,145,8,18,10,10,16,125,4,21,4,
+111,2,12,13,127,8,20,8,107,2,43,47,253,60,43,47,237,57,47,0,63,237,63,237,18,57,47,253,43,49,48,1,51,32,4,21,
+20,4,33,33,17,33,17,33,17,51,50,53,52,35,35,2,92,242,1,77,1,66,254,217,254,236,252,246,4,210,252,242,232,213,
+213,232,3,133,235,248,203,215,5,186,254,215,252,170,154,135,255,255,0,151,0,0,5,226,5,186,2,6,0,37,0,0,0,1,0,
+150,0,0,5,31,5,186,0,5,0,31,64,18,1,147,4,3,3,18,5,7,5,111,2,2,127,3,6,3,107,2,43,47,237,43,47,0,63,63,237,49,
+48,1,33,17,33,17,33,5,31,253,59,254,60,4,137,4,82,251,174,5,186,0,0,2,0,23,254,193,6,152,5,186,0,13,0,19,0,86,
+64,26,0,5,16,145,10,3,12,19,19,7,145,5,3,18,19,4,16,7,10,4,128,5,16,127,5,10,184,255,192,64,20,17,18,54,32,10,
+1,10,10,20,1,128,0,15,127,0,11,21,11,110,2,43,47,51,237,47,237,17,51,47,93,43,51,237,47,237,18,57,17,18,57,0,
+63,51,253,60,16,60,63,237,47,60,49,48,1,33,17,33,17,33,17,51,18,17,17,33,17,51,33,17,33,21,16,3,6,152,254,147,
+252,88,254,148,151,127,4,205,158,253,157,254,148,103,254,193,1,63,254,193,2,145,1,99,1,190,1,71,251,152,3,0,
+19,254,208,254,67,0,255,255,0,149,0,0,5,105,5,186,2,6,0,40,0,0,0,1,255,252,0,0,8,162,5,197,0,51,0,109,64,65,
+34,31,48,17,8,31,145,89,5,8,8,7,32,42,23,145,41,24,4,32,3,0,7,13,18,24,12,182,24,15,13,1,79,13,1,13,208,41,1,
+41,1,182,41,0,0,1,64,0,1,0,0,33,6,127,32,13,0,7,79,7,2,64,7,1,7,47,93,113,51,60,253,60,50,47,93,113,51,237,47,
+93,47,93,113,51,237,47,0,63,60,60,63,63,60,253,60,17,18,57,47,60,43,57,57,16,60,49,48,33,33,3,38,38,35,17,33,
+17,34,6,7,3,33,19,54,54,55,46,3,35,35,17,50,22,22,23,22,22,23,17,33,17,54,54,55,62,2,51,17,35,34,14,2,7,22,22,
+23,8,162,254,2,176,63,70,62,254,60,63,70,62,176,254,2,199,82,147,96,71,84,71,112,116,23,250,234,103,52,69,66,
+60,1,196,59,66,70,51,104,234,250,23,116,112,72,83,71,97,146,82,1,123,134,67,253,188,2,68,67,134,254,133,1,145,
+167,157,31,29,97,197,88,1,54,52,119,137,185,78,3,2,51,253,205,3,78,185,137,119,52,254,202,88,197,97,29,32,157,
+166,0,1,0,59,255,231,5,53,5,211,0,33,0,125,185,0,5,255,240,64,29,14,16,54,29,16,14,16,54,0,17,64,9,10,54,17,
+149,18,18,5,29,27,26,24,145,26,29,4,7,8,184,255,192,64,43,11,12,54,8,10,145,8,5,19,18,18,27,0,207,22,1,22,125,
+32,64,17,19,54,32,32,13,125,2,35,2,111,2,26,127,27,8,127,27,7,34,7,108,2,43,47,51,237,47,237,43,47,237,57,47,
+43,237,93,57,17,57,47,0,63,51,237,47,43,57,63,51,237,47,57,17,18,57,47,253,43,57,43,43,49,48,1,4,17,20,0,33,
+32,3,37,22,51,50,54,53,52,38,35,35,17,51,50,54,53,52,35,34,7,37,18,33,32,4,21,20,4,45,1,8,254,181,254,210,253,
+252,125,1,172,36,169,94,97,122,106,123,97,87,99,149,154,25,254,107,99,1,237,1,17,1,54,3,29,71,254,251,215,254,
+237,1,177,32,153,94,84,81,101,1,6,91,81,119,137,47,1,125,212,179,216,0,1,0,151,0,0,6,17,5,186,0,9,0,110,185,0,
+8,255,224,179,13,16,92,8,184,255,240,64,59,11,12,92,3,32,13,16,92,3,16,11,12,92,55,9,1,56,3,55,8,2,9,3,4,4,
+130,8,9,20,8,8,9,8,3,4,9,9,7,3,2,4,18,4,9,8,3,128,1,11,1,110,2,8,128,5,10,5,107,2,43,47,237,43,47,253,17,57,
+57,0,63,60,63,60,17,18,57,57,135,5,46,43,135,125,196,0,93,1,93,49,48,0,43,43,43,43,1,17,33,17,1,33,17,33,17,1,
+6,17,254,86,253,219,254,85,1,171,2,40,5,186,250,70,3,37,252,219,5,186,252,213,3,43,0,2,0,151,0,0,6,17,7,35,0,
+9,0,21,0,119,64,70,55,9,1,56,3,55,8,2,9,3,4,4,130,8,9,20,8,8,9,10,16,64,16,18,54,16,19,162,16,13,5,8,3,4,9,9,
+7,3,2,4,18,21,161,10,10,3,1,17,161,16,16,7,6,4,9,8,3,128,1,23,1,110,2,8,128,5,22,5,107,2,43,47,237,43,47,253,
+17,57,57,17,18,57,47,237,17,18,57,47,237,0,63,60,63,60,17,18,57,57,63,51,237,47,43,60,135,5,46,43,135,125,196,
+0,93,1,93,49,48,1,17,33,17,1,33,17,33,17,1,19,6,6,35,34,38,39,51,22,51,50,55,6,17,254,86,253,219,254,85,1,171,
+2,40,91,21,201,139,138,202,20,174,42,140,150,41,5,186,250,70,3,37,252,219,5,186,252,213,3,43,1,105,126,155,
+156,125,125,125,0,0,1,0,150,0,0,5,203,5,197,0,27,0,89,64,49,2,1,1,129,0,27,20,0,0,27,27,2,1,24,10,145,5,5,7,8,
+18,145,17,4,8,3,0,1,7,18,27,1,2,24,4,0,17,17,0,0,29,9,6,127,7,28,7,107,2,43,47,253,60,17,51,47,51,47,17,23,57,
+0,63,60,60,63,63,237,17,18,57,47,237,57,18,57,57,135,5,46,43,14,125,16,196,49,48,33,33,3,38,38,35,17,33,17,33,
+17,54,54,55,62,2,51,17,35,34,14,2,7,22,22,23,5,203,254,2,176,63,70,62,254,60,1,196,59,66,70,51,104,234,250,23,
+116,112,72,83,72,98,146,82,1,123,134,67,253,188,5,186,253,205,3,78,185,137,119,52,254,202,88,197,97,29,32,157,
+166,0,1,0,2,255,250,5,217,5,186,0,17,0,55,64,33,8,16,9,11,54,3,147,16,3,0,18,10,12,145,8,18,1,127,0,19,0,110,
+2,11,3,127,11,64,16,1,16,16,18,17,51,47,93,51,237,47,43,47,237,0,63,237,57,63,63,237,43,49,48,33,33,17,33,17,
+16,2,6,35,34,39,17,51,50,54,53,17,33,5,217,254,59,254,158,59,217,242,74,96,68,92,76,4,235,4,82,254,61,254,234,
+254,251,122,16,1,41,81,108,3,202,0,255,255,0,145,0,0,7,2,5,186,2,6,0,48,0,0,255,255,0,152,0,0,6,19,5,186,2,6,
+0,43,0,0,255,255,0,93,255,231,6,76,5,211,2,6,0,50,0,0,0,1,0,152,0,0,6,18,5,186,0,7,0,36,64,21,3,147,6,3,0,5,
+18,1,127,0,9,0,110,2,4,127,5,8,5,107,2,43,47,237,43,47,237,0,63,60,63,237,49,48,33,33,17,33,17,33,17,33,6,18,
+254,60,254,14,254,60,5,122,4,82,251,174,5,186,255,255,0,148,0,0,5,112,5,186,2,6,0,51,0,0,255,255,0,97,255,230,
+5,243,5,211,2,6,0,38,0,0,255,255,0,47,0,0,5,144,5,186,2,6,0,55,0,0,0,1,0,12,255,231,5,88,5,186,0,16,0,119,64,
+79,54,0,57,4,2,5,0,10,4,2,9,16,13,14,54,25,9,1,15,2,115,2,2,2,16,5,3,4,3,1,0,3,12,12,14,145,9,19,5,4,16,2,0,3,
+181,64,4,1,4,1,181,207,0,1,15,0,63,0,111,0,159,0,207,0,5,0,12,0,4,12,3,96,2,144,2,192,2,3,2,25,47,93,23,51,24,
+47,47,93,113,237,47,113,237,17,18,57,17,57,0,63,253,50,47,63,60,60,60,23,57,93,93,43,49,48,1,93,93,19,33,19,
+19,33,1,14,2,35,34,39,17,22,51,50,55,12,1,236,203,200,1,205,254,31,59,88,173,151,80,195,115,53,157,34,5,186,
+253,164,2,92,251,148,137,135,87,23,1,47,12,117,0,3,0,74,0,0,7,29,5,186,0,13,0,20,0,27,0,130,64,40,20,66,22,
+145,0,41,11,1,11,11,12,3,14,66,21,145,4,66,38,7,1,7,7,6,18,25,125,9,17,125,2,2,13,14,5,127,12,21,9,6,184,255,
+192,179,46,50,54,6,184,255,192,179,43,44,54,6,184,255,192,179,38,39,54,6,184,255,192,64,9,32,36,54,32,6,80,6,
+2,6,184,255,192,64,9,21,25,54,16,6,144,6,2,6,47,93,43,113,43,43,43,43,51,60,60,253,60,60,50,47,237,47,237,0,
+63,51,47,93,228,253,228,63,51,47,93,60,253,228,49,48,1,4,17,16,5,21,33,53,36,17,16,37,53,33,17,54,54,53,52,38,
+39,1,17,6,6,21,20,22,4,129,2,156,253,100,254,100,253,101,2,155,1,156,107,118,121,104,254,100,101,124,123,5,74,
+70,253,238,253,227,61,152,156,57,2,29,2,19,69,112,252,17,31,159,111,106,169,34,253,154,2,94,29,171,109,102,
+162,0,255,255,0,3,0,0,6,61,5,186,2,6,0,59,0,0,0,1,0,152,254,193,6,176,5,186,0,11,0,49,64,27,9,4,3,1,11,145,6,
+147,1,3,18,1,134,0,8,127,0,9,9,13,6,127,3,12,3,107,2,43,47,237,17,51,47,51,237,47,237,0,63,51,237,237,47,63,
+60,49,48,1,33,17,33,17,33,17,33,17,33,17,51,6,176,254,148,251,84,1,196,1,242,1,196,158,254,193,1,63,5,186,251,
+174,4,82,251,152,0,1,0,135,0,0,5,217,5,186,0,17,0,44,64,25,13,145,4,4,1,17,8,3,1,18,1,16,127,17,19,17,110,2,9,
+127,8,18,8,107,2,43,47,237,43,47,253,60,0,63,63,60,18,57,47,237,49,48,33,33,17,6,35,34,0,53,17,33,17,20,22,51,
+50,55,17,33,5,217,254,59,208,187,224,254,222,1,197,102,96,178,80,1,197,2,33,115,1,9,231,2,28,254,62,107,116,
+106,2,55,0,1,0,152,0,0,8,76,5,186,0,11,0,55,64,34,10,6,2,3,8,4,147,1,18,11,127,10,3,127,224,2,1,2,7,127,10,2,
+64,6,128,6,144,6,192,6,208,6,5,6,47,93,51,51,237,47,93,237,47,237,0,63,253,60,63,60,60,49,48,33,33,17,33,17,
+33,17,33,17,33,17,33,8,76,248,76,1,196,1,49,1,197,1,53,1,197,5,186,251,174,4,82,251,174,4,82,0,0,1,0,152,254,
+193,8,233,5,186,0,15,0,65,64,38,1,12,8,4,3,10,6,147,14,145,1,3,18,1,134,0,0,13,127,12,5,127,224,4,1,4,9,127,
+12,4,128,8,144,8,208,8,3,8,47,93,51,51,237,47,93,237,47,253,50,47,237,0,63,51,237,253,60,63,60,60,47,49,48,1,
+33,17,33,17,33,17,33,17,33,17,33,17,33,17,51,8,233,254,148,249,27,1,196,1,49,1,197,1,53,1,197,157,254,193,1,
+63,5,186,251,174,4,82,251,174,4,82,251,152,0,2,0,51,0,0,7,176,5,186,0,12,0,19,0,51,64,29,0,145,19,19,8,10,145,
+11,3,13,145,8,18,16,125,3,21,3,111,2,11,12,13,127,11,48,8,1,8,47,93,51,253,60,47,43,47,237,0,63,237,63,237,18,
+57,47,237,49,48,1,51,32,17,20,6,4,35,33,17,33,17,33,17,51,50,53,52,35,35,4,47,242,2,143,186,254,162,35,252,
+245,253,201,3,252,232,213,213,232,3,123,254,39,149,228,41,4,145,1,41,251,129,154,145,0,255,255,0,152,0,0,8,18,
+5,186,0,38,2,10,0,0,1,7,0,44,5,164,0,0,0,22,64,14,2,96,21,175,21,239,21,255,21,4,21,1,0,8,47,53,53,47,93,53,0,
+2,0,152,0,0,5,221,5,186,0,10,0,17,0,54,64,33,89,2,106,2,122,2,3,0,145,17,17,8,9,3,11,145,8,18,14,125,4,19,4,
+111,2,10,11,127,8,18,8,107,2,43,47,253,60,43,47,237,0,63,237,63,18,57,47,237,49,48,1,93,1,51,32,4,21,20,4,33,
+33,17,33,17,51,50,53,52,35,35,2,92,242,1,77,1,66,254,217,254,236,252,246,1,196,232,213,213,232,3,133,235,248,
+203,215,5,186,251,129,154,135,0,0,1,0,63,255,231,5,254,5,211,0,23,0,84,64,50,17,64,9,10,54,17,149,63,18,1,18,
+18,14,0,23,21,145,23,2,4,11,12,14,145,12,8,19,17,17,12,19,66,16,125,5,25,5,111,2,23,127,0,12,127,0,11,24,11,
+108,2,43,47,51,237,47,237,43,47,253,228,18,57,47,0,63,51,237,47,57,63,51,237,47,57,17,57,47,93,237,43,49,48,
+19,18,33,32,0,17,16,0,33,32,36,39,37,22,51,32,19,33,17,33,2,33,34,7,96,182,1,238,1,111,1,139,254,122,254,159,
+254,194,254,170,68,1,170,62,223,1,4,37,254,70,1,188,43,254,254,201,67,4,98,1,113,254,120,254,156,254,141,254,
+115,251,200,115,226,1,25,1,16,1,27,184,0,2,0,152,255,231,8,227,5,211,0,18,0,27,0,100,64,28,41,9,105,9,2,18,
+147,13,13,15,16,24,145,3,4,16,3,19,145,9,19,15,18,26,125,12,66,0,184,255,192,64,34,20,22,54,0,64,16,18,54,31,
+0,47,0,2,0,0,14,22,125,6,29,6,111,2,17,14,127,15,28,15,107,2,15,29,1,93,43,47,253,60,43,47,237,18,57,47,93,43,
+43,228,237,0,63,63,237,63,63,237,17,18,57,47,237,93,49,48,1,18,0,33,32,0,17,16,0,33,32,0,3,35,17,33,17,33,17,
+1,50,54,53,16,33,32,17,16,3,12,59,1,120,1,42,1,111,1,139,254,122,254,159,254,141,254,148,31,162,254,60,1,196,
+3,144,151,156,254,202,254,209,3,184,1,7,1,20,254,120,254,156,254,141,254,115,1,97,1,8,253,176,5,186,253,254,
+253,131,195,240,1,145,254,90,254,98,0,255,255,0,4,0,0,5,166,5,186,0,71,0,53,6,66,0,0,192,0,64,0,255,255,0,73,
+255,232,5,16,4,62,2,6,0,68,0,0,0,2,0,74,255,231,5,12,5,219,0,22,0,34,0,92,64,59,150,4,1,170,20,1,20,16,0,17,1,
+29,149,80,2,1,2,16,23,149,8,19,166,26,169,32,2,118,26,121,32,2,15,20,14,21,4,5,11,17,134,18,18,26,131,5,36,5,
+105,2,0,0,32,131,11,35,11,102,2,43,47,253,57,47,43,47,237,57,47,237,17,18,23,57,93,93,0,63,237,63,93,237,63,
+63,201,93,49,48,0,93,1,54,51,32,0,21,20,0,33,32,0,17,16,0,55,55,54,55,33,16,5,6,6,19,50,54,53,52,38,35,34,6,
+21,20,22,1,223,73,128,1,43,1,57,254,201,254,211,254,212,254,206,1,8,248,123,165,17,1,67,254,185,221,158,174,
+98,105,108,91,101,104,103,4,6,55,254,197,235,233,254,185,1,73,1,116,1,88,1,168,8,4,7,36,254,221,12,8,71,252,
+161,144,134,133,142,155,124,129,145,0,0,3,0,123,0,0,4,164,4,37,0,15,0,22,0,30,0,112,185,0,11,255,232,179,9,11,
+54,4,184,255,232,64,23,9,11,54,0,16,150,47,30,95,30,2,30,30,7,22,150,8,15,23,150,7,21,0,184,255,240,64,37,9,
+10,54,0,19,64,21,25,54,63,19,1,19,131,12,12,63,27,1,27,131,3,32,3,105,2,22,23,133,16,7,1,7,31,7,101,2,43,47,
+93,253,60,43,47,237,93,57,47,237,93,43,57,43,0,63,237,63,237,18,57,47,93,237,57,49,48,1,43,43,1,22,22,21,20,6,
+33,33,17,33,50,22,21,20,6,7,37,51,50,53,52,35,35,17,51,50,54,53,52,35,35,3,156,121,143,200,254,253,253,162,2,
+143,178,187,122,97,254,118,103,102,108,97,134,50,62,112,134,2,53,12,136,114,152,151,4,37,136,122,86,127,21,88,
+93,75,253,193,46,44,96,0,0,1,0,137,0,0,3,229,4,37,0,5,0,36,64,21,1,151,4,15,3,18,0,5,64,5,2,5,5,7,2,133,3,6,3,
+101,2,43,47,237,17,51,47,93,0,63,63,237,49,48,1,33,17,33,17,33,3,229,254,60,254,104,3,92,2,252,253,4,4,37,0,2,
+0,14,254,209,5,51,4,37,0,13,0,19,0,92,64,55,0,5,16,151,10,15,12,19,19,7,151,5,3,18,19,4,16,7,10,4,149,5,16,
+133,128,10,1,5,80,10,224,10,2,10,10,20,1,149,15,0,1,0,15,15,63,15,2,15,133,0,11,21,11,104,2,43,47,51,237,93,
+47,93,237,17,51,47,93,51,93,237,47,237,18,57,17,18,57,0,63,51,253,60,16,60,63,237,47,60,49,48,1,33,17,33,17,
+33,17,51,54,17,53,33,17,51,33,17,35,21,20,7,5,51,254,230,253,16,254,229,103,112,3,222,112,253,248,195,96,254,
+209,1,47,254,209,2,88,200,1,68,240,253,4,1,211,12,221,234,255,255,0,72,255,232,5,22,4,62,2,6,0,72,0,0,0,1,0,8,
+0,0,7,90,4,51,0,49,0,135,64,47,33,30,46,17,30,149,5,31,8,1,8,8,7,31,40,23,149,39,24,16,31,15,0,7,13,18,96,24,
+1,24,12,24,13,64,21,22,54,31,13,79,13,2,13,39,1,39,0,184,255,192,64,21,21,22,54,16,0,64,0,2,0,0,32,6,133,31,
+13,64,7,208,7,2,7,184,255,192,64,11,21,22,54,16,7,64,7,144,7,3,7,47,93,43,113,51,60,253,60,50,47,93,43,51,205,
+47,47,93,43,51,205,47,93,0,63,60,60,63,63,60,253,60,17,18,57,47,113,60,237,57,57,16,60,49,48,33,33,3,38,38,35,
+17,33,17,34,6,7,3,33,19,54,54,55,46,3,35,35,17,50,30,3,23,17,33,17,62,4,51,17,35,34,14,2,7,22,22,23,7,90,254,
+53,143,35,49,47,254,104,46,49,36,143,254,53,180,72,104,107,53,72,78,86,88,18,209,181,99,92,38,46,1,152,46,38,
+92,99,182,209,19,87,87,78,72,53,102,105,76,1,37,73,33,254,113,1,143,32,74,254,219,1,63,128,83,9,10,60,144,33,
+1,33,35,109,208,41,4,1,127,254,129,4,41,208,109,35,254,223,33,144,60,10,9,76,135,0,1,0,76,255,231,5,33,4,61,0,
+38,0,86,64,50,0,19,150,47,20,1,47,20,1,20,20,13,30,27,149,30,34,16,10,13,149,10,6,22,20,20,30,0,24,133,37,15,
+131,37,3,40,3,105,2,30,133,31,10,133,31,9,39,9,102,2,43,47,51,237,47,237,43,47,51,237,47,237,57,17,57,47,0,63,
+51,237,47,63,51,237,47,17,57,47,93,113,237,57,49,48,1,22,22,21,20,4,33,32,36,39,37,22,22,51,50,53,52,38,35,35,
+53,51,50,54,53,52,38,35,34,6,7,37,54,36,33,32,4,21,20,4,82,95,112,254,194,254,207,255,0,254,219,65,1,131,20,
+125,80,205,78,63,177,181,53,88,103,92,90,124,17,254,137,55,1,36,1,1,1,11,1,47,2,37,30,127,77,166,174,189,190,
+43,56,87,102,35,43,209,44,34,38,48,75,52,51,181,173,174,133,160,0,1,0,137,0,0,5,29,4,37,0,9,0,91,64,43,8,2,3,
+3,171,7,8,20,7,7,8,7,2,3,8,8,5,15,1,3,18,3,8,7,63,2,1,2,64,9,10,54,2,133,0,11,0,104,2,48,7,1,7,184,255,192,64,
+10,9,10,54,7,133,5,10,5,101,2,43,47,237,43,93,43,47,253,43,93,17,57,57,0,63,60,63,60,17,18,57,57,135,5,46,43,
+135,125,196,49,48,33,33,17,1,33,17,33,17,1,33,5,29,254,127,254,112,254,125,1,129,1,148,1,127,2,10,253,246,4,
+37,253,239,2,17,0,0,2,0,137,0,0,5,29,5,211,0,9,0,22,0,135,64,70,8,2,3,3,171,7,8,20,7,7,8,10,127,16,1,16,64,9,
+10,54,16,19,162,16,13,17,7,2,3,8,8,5,15,1,3,18,22,161,10,10,8,9,17,161,16,16,6,5,3,8,7,63,2,1,2,64,9,10,54,2,
+133,0,24,0,104,2,48,7,1,7,184,255,192,64,10,9,10,54,7,133,5,23,5,101,2,43,47,237,43,93,43,47,253,43,93,17,57,
+57,17,18,57,47,237,17,18,57,47,237,0,63,60,63,60,17,18,57,57,63,51,237,47,43,93,60,135,5,46,43,135,125,196,49,
+48,33,33,17,1,33,17,33,17,1,33,1,6,6,35,34,38,39,51,22,51,50,54,55,5,29,254,127,254,112,254,125,1,129,1,148,1,
+127,254,254,3,196,135,158,178,12,172,30,138,76,87,15,2,10,253,246,4,37,253,239,2,17,1,174,145,156,159,142,107,
+43,64,0,0,1,0,123,0,0,5,25,4,49,0,28,0,99,64,36,2,1,1,135,0,28,20,0,0,28,25,10,149,5,5,7,8,18,149,17,15,8,15,
+0,1,7,18,28,1,2,25,4,0,17,17,0,184,255,192,64,19,12,13,54,0,0,96,0,2,0,0,30,9,6,133,7,29,7,101,2,43,47,253,60,
+17,51,47,93,43,51,47,17,23,57,0,63,60,60,63,63,237,17,18,57,47,237,57,135,5,46,43,14,125,16,196,49,48,33,33,3,
+38,38,35,17,33,17,33,17,62,5,51,17,35,34,14,3,7,22,22,23,5,25,254,53,156,37,71,52,254,105,1,151,50,48,91,72,
+112,168,166,18,82,86,52,68,45,44,85,92,93,1,37,70,36,254,113,4,37,254,129,5,56,190,88,44,12,254,223,13,42,130,
+51,9,8,57,155,0,0,1,0,27,255,225,5,63,4,37,0,16,0,61,64,36,7,24,10,11,54,3,149,15,15,1,18,9,7,10,10,12,149,7,
+22,1,133,0,18,0,104,2,10,0,3,1,3,133,10,15,15,17,17,51,47,51,237,93,47,43,47,237,0,63,253,50,47,17,57,63,63,
+237,43,49,48,33,33,17,33,17,20,6,35,34,39,17,22,51,50,53,17,33,5,63,254,105,254,203,145,150,170,135,72,38,82,
+4,100,2,252,254,67,178,172,31,1,45,22,122,2,148,0,1,0,137,0,0,6,59,4,37,0,12,0,161,64,63,11,2,3,3,170,10,11,
+20,10,10,11,9,5,4,4,170,10,9,20,10,10,9,2,5,32,5,47,10,2,10,5,4,11,9,15,1,7,3,4,4,7,18,9,4,5,3,11,10,10,5,2,
+134,31,0,1,15,0,127,0,207,0,3,0,184,255,192,64,36,19,21,54,80,0,112,0,128,0,239,0,4,0,14,0,104,2,5,134,208,7,
+1,128,7,1,79,7,1,7,13,7,101,2,31,14,1,93,43,47,93,113,114,237,43,47,93,43,113,114,237,25,17,57,47,57,57,18,57,
+57,0,24,63,60,16,60,16,60,63,60,18,57,57,93,16,60,135,5,46,43,135,125,196,135,46,24,43,135,125,196,49,48,33,
+33,17,3,35,1,17,33,17,33,19,19,33,6,59,254,168,252,245,254,239,254,168,1,230,254,233,1,229,2,154,253,102,2,
+154,253,102,4,37,253,158,2,98,0,1,0,137,0,0,5,43,4,37,0,11,0,48,64,27,8,149,3,3,5,11,6,15,0,5,18,10,1,133,0,
+13,0,104,2,7,4,133,5,12,5,101,2,43,47,253,60,43,47,253,60,0,63,60,63,60,18,57,47,237,49,48,33,33,17,33,17,33,
+17,33,17,33,17,33,5,43,254,104,254,142,254,104,1,152,1,114,1,152,1,145,254,111,4,37,254,149,1,107,255,255,0,
+73,255,232,5,13,4,62,2,6,0,82,0,0,0,1,0,119,0,0,4,219,4,37,0,7,0,36,64,21,3,149,6,15,0,5,18,1,133,0,9,0,104,2,
+4,133,5,8,5,101,2,43,47,237,43,47,237,0,63,60,63,237,49,48,33,33,17,33,17,33,17,33,4,219,254,105,254,202,254,
+105,4,100,2,252,253,4,4,37,255,255,0,125,254,108,5,14,4,62,2,6,0,83,0,0,255,255,0,74,255,231,5,22,4,62,2,6,0,
+70,0,0,0,1,0,20,0,0,3,250,4,37,0,7,0,59,64,22,0,5,149,6,15,3,18,5,0,0,2,133,5,144,3,1,80,3,176,3,2,3,184,255,
+192,64,13,23,24,54,16,3,48,3,128,3,144,3,4,3,47,93,43,113,114,51,253,50,47,47,0,63,63,253,60,49,48,1,33,17,33,
+17,33,17,33,3,250,254,217,254,104,254,217,3,230,2,252,253,4,2,252,1,41,0,255,255,0,5,254,81,4,234,4,38,2,6,0,
+92,0,0,0,3,0,76,254,106,7,207,5,186,0,25,0,36,0,47,0,121,64,55,24,0,10,13,37,15,0,23,31,43,151,2,21,16,26,37,
+151,8,15,22,12,27,86,5,89,18,2,46,131,79,18,1,18,29,131,64,5,1,5,5,25,34,66,11,133,24,40,66,18,64,12,176,12,2,
+12,184,255,192,179,21,24,54,12,184,255,192,64,13,16,17,54,0,12,48,12,80,12,160,12,4,12,47,93,43,43,113,51,228,
+60,253,228,60,51,47,93,237,47,93,237,93,0,63,63,60,253,60,63,60,253,60,57,57,17,18,57,57,63,49,48,1,54,51,50,
+18,21,20,2,35,34,39,17,33,17,6,35,34,2,53,52,18,51,50,23,17,33,19,50,54,53,16,35,34,6,21,20,22,33,50,54,53,52,
+38,35,34,6,21,16,4,217,122,189,205,242,242,207,196,113,254,105,128,184,204,242,242,206,195,115,1,151,184,80,
+86,172,75,107,96,253,90,76,107,96,93,79,87,3,186,131,254,195,254,246,254,219,127,254,4,1,250,125,1,61,255,246,
+1,36,135,2,4,251,90,134,112,1,6,114,144,107,143,115,144,107,142,133,112,254,249,255,255,0,11,0,0,5,74,4,38,2,
+6,0,91,0,0,0,1,0,117,254,209,5,117,4,37,0,11,0,66,64,41,0,9,4,15,11,6,149,0,3,18,1,134,0,8,133,0,144,9,1,159,
+9,175,9,224,9,240,9,4,9,9,13,6,133,3,12,3,101,2,207,13,1,93,43,47,237,17,51,47,93,114,51,237,47,237,0,63,51,
+253,60,63,60,47,49,48,1,33,17,33,17,33,17,33,17,33,17,51,5,117,254,229,252,27,1,151,1,54,1,151,156,254,209,1,
+47,4,37,253,4,2,252,253,4,0,0,1,0,115,0,0,4,215,4,37,0,16,0,56,64,35,4,16,20,20,54,4,16,9,11,54,12,151,4,4,1,
+16,7,15,1,18,1,15,133,16,18,16,104,2,8,133,7,17,7,101,2,43,47,237,43,47,253,60,0,63,63,60,18,57,47,237,43,43,
+49,48,33,33,17,6,35,32,17,17,33,17,20,22,51,50,55,17,33,4,215,254,104,154,179,254,129,1,151,66,59,114,70,1,
+152,1,135,92,1,152,1,98,254,221,72,82,93,1,96,0,0,1,0,117,0,0,7,2,4,37,0,11,0,58,64,36,10,6,2,15,8,4,149,1,18,
+11,133,10,7,133,10,6,4,133,6,255,1,1,1,12,1,101,2,63,13,111,13,159,13,207,13,4,93,43,47,93,51,237,47,51,237,
+47,237,0,63,253,60,63,60,60,49,48,33,33,17,33,17,51,17,33,17,51,17,33,7,2,249,115,1,151,228,1,151,227,1,152,4,
+37,253,4,2,252,253,4,2,252,0,1,0,117,254,209,7,158,4,37,0,15,0,69,64,41,12,8,4,15,0,14,10,6,149,0,3,18,1,134,
+0,0,13,133,12,9,133,12,8,5,133,8,255,3,1,3,16,3,101,2,111,17,159,17,207,17,3,93,43,47,93,51,237,47,51,237,47,
+253,50,47,237,0,63,51,253,60,60,47,63,60,60,49,48,1,33,17,33,17,33,17,51,17,33,17,51,17,33,17,51,7,158,254,
+229,249,242,1,151,228,1,151,227,1,152,156,254,209,1,47,4,37,253,4,2,252,253,4,2,252,253,4,0,2,0,8,0,0,5,225,4,
+37,0,10,0,18,0,75,64,14,0,150,18,18,6,8,149,9,15,11,150,6,18,3,184,255,240,64,31,9,11,54,15,64,12,13,54,15,
+131,3,20,3,105,2,9,10,11,133,0,6,48,6,128,6,3,9,192,6,1,6,47,93,51,93,253,60,47,43,47,237,43,43,0,63,237,63,
+237,18,57,47,253,49,48,1,51,32,17,16,33,33,17,33,17,33,17,51,50,54,53,52,35,35,3,80,186,1,215,254,54,253,161,
+254,80,3,72,133,50,63,113,133,2,172,254,168,254,172,2,252,1,41,252,213,46,44,96,0,255,255,0,137,0,0,6,189,4,
+38,0,38,2,42,0,0,1,7,0,215,4,156,0,0,0,35,64,24,2,15,20,95,20,143,20,3,63,20,79,20,127,20,176,20,4,20,1,0,6,
+63,22,1,1,93,47,53,53,47,93,113,53,0,0,2,0,137,0,0,4,178,4,37,0,8,0,16,0,61,64,12,0,150,16,16,6,7,15,9,150,6,
+18,3,184,255,240,64,23,9,11,54,13,131,3,18,3,105,2,8,9,133,6,17,6,101,2,31,18,63,18,2,93,43,47,253,60,43,47,
+237,43,0,63,237,63,18,57,47,237,49,48,1,51,32,17,16,33,33,17,33,17,51,50,54,53,52,35,35,2,33,186,1,215,254,53,
+253,162,1,152,133,50,63,113,133,2,172,254,168,254,172,4,37,252,213,46,44,96,0,0,1,0,63,255,231,5,12,4,61,0,24,
+0,118,64,21,18,150,19,64,19,21,54,47,19,1,19,19,22,12,48,13,128,13,2,13,15,184,255,192,64,52,9,10,54,15,149,
+13,10,22,0,24,22,64,9,10,54,22,149,24,3,16,207,19,1,19,19,0,20,66,17,131,7,26,7,105,2,192,24,1,24,133,0,192,
+13,1,13,133,0,12,25,12,102,2,43,47,51,237,93,47,237,93,43,47,253,228,18,57,47,93,0,63,51,237,43,47,57,63,51,
+237,43,47,93,57,17,57,47,93,43,237,49,48,19,54,36,51,50,22,22,21,20,0,33,32,3,37,22,51,50,55,33,53,33,38,35,
+34,7,84,57,1,26,249,185,242,193,254,208,254,167,254,41,109,1,132,49,168,171,38,254,198,1,51,44,167,160,32,2,
+209,187,177,97,251,211,249,254,210,1,144,43,164,170,209,174,137,0,2,0,137,255,231,7,131,4,61,0,18,0,30,0,128,
+64,54,54,3,1,18,149,13,64,16,17,54,13,13,15,16,25,149,3,16,16,15,19,149,9,22,15,18,166,22,169,28,2,118,22,121,
+28,2,28,131,0,20,12,13,54,0,16,9,10,54,0,66,128,12,1,12,184,255,192,64,31,21,22,54,12,64,15,17,54,47,12,95,12,
+2,12,12,14,22,131,6,32,6,105,2,17,14,133,15,31,15,101,2,43,47,253,60,43,47,237,18,57,47,93,43,43,113,228,43,
+43,237,93,93,0,63,63,237,63,63,237,17,18,57,47,43,237,93,49,48,1,54,36,51,32,0,21,20,0,33,34,36,39,35,17,33,
+17,33,17,1,50,54,53,52,38,35,34,6,21,20,22,2,217,55,1,46,225,1,42,1,58,254,200,254,212,237,254,204,47,174,254,
+104,1,152,3,0,98,105,108,91,101,104,102,2,186,185,202,254,197,235,233,254,185,226,200,254,111,4,37,254,149,
+254,68,144,134,133,142,155,124,129,145,0,0,2,0,2,0,0,4,131,4,37,0,19,0,27,0,95,64,56,6,7,7,135,8,9,20,8,8,9,9,
+6,8,11,20,150,2,2,0,21,150,19,15,0,7,8,18,7,9,6,3,79,8,1,8,21,1,133,0,29,0,104,2,25,131,8,14,28,14,102,2,31,
+29,63,29,2,93,43,47,51,237,43,47,253,60,47,93,23,57,0,63,60,60,63,237,18,57,47,237,57,18,57,57,135,5,46,43,14,
+125,16,196,49,48,33,33,17,35,34,6,7,3,33,19,54,55,38,38,53,52,54,54,51,33,1,53,35,34,6,21,20,51,4,131,254,105,
+15,43,49,25,163,254,61,158,70,114,129,135,103,197,150,2,113,254,105,127,90,44,148,1,156,47,48,254,195,1,51,
+137,13,20,175,104,103,159,43,254,104,166,43,39,84,255,255,0,72,255,232,5,22,5,166,2,34,0,72,0,0,1,7,0,142,1,
+86,0,0,0,23,64,13,3,2,0,36,39,17,0,37,3,2,36,17,38,0,43,53,53,1,43,53,53,0,0,1,0,20,254,102,4,240,5,186,0,36,
+0,93,185,0,33,255,240,64,52,9,11,54,4,16,9,11,54,29,22,150,28,23,23,33,25,0,7,15,9,149,4,27,15,151,33,16,20,
+18,6,6,12,133,0,38,0,104,2,22,28,28,30,26,19,133,25,22,20,37,20,101,2,43,47,51,60,253,60,60,50,47,47,43,47,
+253,50,47,0,63,63,237,63,253,17,57,63,18,57,47,60,253,60,43,43,49,48,37,20,6,6,35,34,39,19,22,51,50,54,53,17,
+52,35,34,6,21,17,33,17,35,53,51,53,33,21,51,21,35,17,54,51,50,22,21,4,240,42,157,156,124,169,62,54,18,50,56,
+143,79,87,254,104,119,119,1,152,244,244,143,217,177,180,53,166,178,119,35,1,39,10,71,107,1,240,184,117,141,
+254,2,4,162,186,94,94,186,254,252,159,213,196,0,255,255,0,127,0,0,3,195,5,211,2,34,0,85,0,0,1,7,0,141,0,181,0,
+0,0,19,64,11,1,0,19,19,0,7,37,1,20,17,38,0,43,53,1,43,53,0,0,1,0,74,255,231,5,23,4,61,0,24,0,114,64,26,20,150,
+17,17,2,9,12,13,15,64,9,10,54,15,149,13,9,16,0,48,24,128,24,2,24,22,184,255,192,64,42,9,10,54,22,149,24,2,22,
+192,18,1,18,18,0,20,207,13,1,13,133,12,207,24,1,24,133,0,12,0,26,0,105,2,17,66,20,131,5,25,5,102,2,43,47,253,
+228,43,17,51,16,237,93,47,237,93,17,18,57,47,93,0,63,51,237,43,47,93,57,63,51,237,43,47,57,17,18,57,47,237,49,
+48,1,2,33,32,0,53,52,54,54,51,50,4,23,5,38,35,34,7,33,21,33,22,51,50,55,5,23,109,254,41,254,167,254,208,170,
+245,205,249,1,26,57,254,129,32,160,167,44,1,51,254,198,38,171,168,49,1,119,254,112,1,46,249,200,242,117,177,
+187,51,137,174,209,170,164,0,255,255,0,51,255,231,4,156,4,62,2,6,0,86,0,0,255,255,0,138,0,0,2,33,5,186,2,6,0,
+76,0,0,255,255,255,254,0,0,2,173,5,166,2,34,0,215,0,0,1,6,0,142,0,0,0,23,64,13,2,1,0,7,10,0,1,37,2,1,7,17,38,
+0,43,53,53,1,43,53,53,0,255,255,255,156,254,81,2,35,5,186,2,6,0,77,0,0,0,2,0,27,255,225,7,209,4,37,0,21,0,29,
+0,110,64,25,12,24,10,11,54,0,150,29,29,6,15,17,8,149,20,15,22,150,6,18,17,151,12,22,3,184,255,240,64,12,9,11,
+54,21,22,133,128,6,192,6,2,6,184,255,192,64,26,12,14,54,6,6,8,63,26,1,26,131,3,31,3,105,2,15,0,8,1,8,133,15,
+20,20,30,17,51,47,51,237,93,47,43,47,237,93,18,57,47,43,93,253,60,43,0,63,237,63,237,63,237,18,57,18,57,47,
+253,43,49,48,1,51,32,17,16,33,33,17,33,17,20,6,35,34,39,17,22,51,50,53,17,33,17,51,50,54,53,52,35,35,5,63,187,
+1,215,254,53,253,162,254,203,145,150,170,135,72,38,82,4,100,134,50,62,112,134,2,172,254,168,254,172,2,252,254,
+67,178,172,31,1,45,22,122,2,148,252,213,46,44,96,0,0,2,0,137,0,0,7,229,4,37,0,16,0,24,0,110,64,21,0,150,24,24,
+10,11,13,149,8,8,10,15,11,15,17,150,6,6,10,18,3,184,255,240,64,13,9,11,54,16,17,133,15,128,6,192,6,2,6,184,
+255,192,179,12,14,54,6,184,255,192,64,21,9,10,54,6,6,9,21,131,3,26,3,105,2,12,9,133,10,25,10,101,2,43,47,253,
+60,43,47,237,18,57,47,43,43,93,60,253,60,43,0,63,60,16,237,63,60,18,57,47,237,17,18,57,47,253,49,48,1,51,32,
+17,16,33,33,17,33,17,33,17,33,17,33,17,33,17,51,50,54,53,52,35,35,5,84,186,1,215,254,54,253,161,254,101,254,
+104,1,152,1,155,1,152,133,50,63,113,133,2,172,254,168,254,172,1,145,254,111,4,37,254,149,1,107,252,213,46,44,
+96,0,1,0,20,0,0,4,240,5,186,0,25,0,91,185,0,22,255,240,64,11,9,11,54,18,11,150,17,80,12,1,12,184,255,192,64,
+37,9,12,54,12,12,22,14,0,20,4,151,22,16,0,9,18,1,133,0,27,0,104,2,11,17,17,19,15,8,133,14,11,9,26,9,101,2,43,
+47,51,60,253,60,60,50,47,47,43,47,237,0,63,60,63,253,57,63,18,57,47,43,93,60,253,60,43,49,48,33,33,17,52,35,
+34,6,21,17,33,17,35,53,51,53,33,21,51,21,35,17,54,51,50,22,21,4,240,254,104,143,79,87,254,104,119,119,1,152,
+244,244,143,217,177,180,2,72,184,117,141,254,2,4,162,186,94,94,186,254,252,159,213,196,255,255,0,123,0,0,5,25,
+5,211,2,38,2,24,0,0,1,7,0,141,1,88,0,0,0,19,64,11,1,32,17,38,1,0,32,30,8,17,37,1,43,53,0,43,53,0,0,2,0,5,254,
+81,4,234,5,211,0,17,0,30,0,204,64,58,4,17,88,3,2,5,4,17,2,0,5,2,3,3,169,4,5,20,4,4,5,17,2,1,1,135,0,17,20,0,0,
+17,18,127,24,1,24,64,9,10,54,24,27,162,24,21,17,2,17,4,3,1,0,15,12,17,11,14,184,255,192,64,62,9,11,54,14,149,
+9,28,17,21,30,161,18,18,3,4,25,161,24,24,0,1,11,12,3,5,2,191,4,1,31,4,79,4,127,4,175,4,4,4,17,1,2,0,12,4,0,3,
+176,2,208,2,224,2,3,64,2,128,2,160,2,3,2,25,47,93,93,23,51,24,47,17,57,57,47,93,93,18,57,57,47,57,17,18,57,47,
+237,17,18,57,47,237,0,63,63,237,43,57,17,57,63,60,60,60,18,57,63,51,237,47,43,93,60,135,5,46,43,135,14,125,
+196,135,5,46,24,43,135,14,125,196,1,17,18,57,17,57,49,48,1,93,19,33,19,19,33,1,6,7,6,35,34,39,3,22,51,50,54,
+55,1,6,6,35,34,38,39,51,22,51,50,54,55,5,1,174,219,203,1,145,254,91,72,75,106,217,88,184,32,88,108,72,89,31,1,
+245,2,196,136,157,179,12,172,30,138,77,86,15,4,38,253,61,2,195,251,145,194,68,96,24,1,28,28,66,85,5,211,145,
+156,159,142,107,43,64,0,1,0,119,254,209,4,219,4,37,0,11,0,95,64,25,11,6,15,8,149,5,3,0,3,5,18,7,133,48,6,1,6,
+10,133,32,11,128,11,2,11,184,255,192,64,20,22,25,54,128,11,144,11,2,11,11,0,1,1,1,134,6,192,4,1,4,184,255,192,
+179,14,15,54,4,184,255,192,179,10,11,54,4,47,43,43,93,51,253,93,50,47,93,43,113,237,47,93,237,0,63,51,60,47,
+16,237,63,60,49,48,33,33,17,33,17,33,17,33,17,33,17,33,4,219,254,90,254,230,254,92,1,151,1,54,1,151,254,209,1,
+47,4,37,253,4,2,252,0,0,1,0,150,0,0,4,78,6,227,0,7,0,37,64,20,6,1,147,6,4,3,3,18,5,128,0,0,9,2,127,3,8,3,107,
+2,43,47,237,17,51,47,237,0,63,63,51,237,47,49,48,1,33,17,33,17,33,17,33,4,78,254,12,254,60,2,75,1,109,4,82,
+251,174,5,186,1,41,0,0,1,0,137,0,0,3,156,5,84,0,7,0,37,64,20,6,1,149,6,4,15,3,18,5,134,0,0,9,2,133,3,8,3,101,
+2,43,47,237,17,51,47,237,0,63,63,51,237,47,49,48,1,33,17,33,17,33,17,33,3,156,254,133,254,104,2,13,1,6,2,252,
+253,4,4,37,1,47,0,255,255,255,255,0,0,8,1,7,79,2,38,0,58,0,0,1,7,0,67,2,240,1,124,0,19,64,11,1,16,5,38,1,0,13,
+15,3,4,37,1,43,53,0,43,53,0,255,255,0,3,0,0,7,145,5,211,2,38,0,90,0,0,1,7,0,67,2,164,0,0,0,19,64,11,1,16,17,
+38,1,0,13,15,3,4,37,1,43,53,0,43,53,0,255,255,255,255,0,0,8,1,7,75,2,38,0,58,0,0,1,7,0,141,2,136,1,120,0,19,
+64,11,1,16,5,38,1,0,16,14,3,4,37,1,43,53,0,43,53,0,255,255,0,3,0,0,7,145,5,211,2,38,0,90,0,0,1,7,0,141,2,104,
+0,0,0,19,64,11,1,16,17,38,1,0,16,14,3,4,37,1,43,53,0,43,53,0,255,255,255,255,0,0,8,1,7,26,2,38,0,58,0,0,1,7,0,
+142,2,176,1,116,0,23,64,13,2,1,16,5,38,2,1,0,16,19,3,4,37,1,43,53,53,0,43,53,53,0,255,255,0,3,0,0,7,145,5,166,
+2,38,0,90,0,0,1,7,0,142,2,112,0,0,0,23,64,13,2,1,16,17,38,2,1,0,16,19,3,4,37,1,43,53,53,0,43,53,53,0,255,255,
+0,2,0,0,6,61,7,75,2,38,0,60,0,0,1,7,0,67,1,212,1,120,0,19,64,11,1,12,5,38,1,0,9,11,1,3,37,1,43,53,0,43,53,0,
+255,255,0,5,254,81,4,234,5,211,2,38,0,92,0,0,1,7,0,67,1,84,0,0,0,19,64,11,1,21,17,38,1,0,18,20,0,4,37,1,43,53,
+0,43,53,0,0,1,255,244,1,168,6,11,2,134,0,3,0,13,180,0,150,3,2,3,47,47,0,47,237,49,48,3,33,21,33,12,6,23,249,
+233,2,134,222,0,0,1,0,70,2,163,1,249,5,211,0,10,0,45,64,17,5,6,6,1,173,0,1,6,2,5,5,10,2,2,0,133,10,184,255,
+192,179,15,19,54,10,47,43,237,57,47,17,51,47,18,57,0,63,253,50,47,57,49,48,1,17,35,22,22,23,7,38,38,53,17,1,
+249,208,5,87,116,95,186,154,5,211,254,108,73,107,54,178,81,215,185,1,79,0,1,255,244,6,232,4,12,7,78,0,3,0,12,
+179,1,2,0,1,47,47,0,47,205,49,48,1,33,53,33,4,12,251,232,4,24,6,232,102,0,0,1,0,104,255,231,5,76,5,211,0,56,0,
+143,64,85,44,12,43,13,13,8,39,17,38,18,64,12,14,54,18,18,8,25,29,63,30,79,30,2,30,30,32,149,25,7,15,50,31,50,
+2,50,152,6,6,54,145,2,2,48,147,8,25,19,16,21,42,45,37,11,4,14,40,30,128,29,0,43,38,35,128,21,9,13,17,29,38,0,
+3,40,128,17,21,9,3,128,14,144,14,2,14,47,93,23,51,253,23,50,47,60,47,47,237,47,60,47,47,237,17,18,23,57,17,57,
+57,0,63,237,60,16,237,51,47,237,93,63,237,51,47,93,57,17,18,57,47,43,60,221,60,17,57,47,60,221,60,49,48,37,6,
+35,34,36,38,35,34,7,3,54,55,35,53,51,38,39,35,53,51,38,53,52,54,54,51,50,22,22,23,5,38,35,34,6,21,20,23,33,21,
+33,20,7,33,21,33,6,7,23,54,51,50,22,22,51,50,55,5,76,165,171,93,254,250,91,46,135,151,127,155,43,209,207,6,10,
+191,150,41,165,202,168,111,198,193,36,254,129,45,106,58,71,43,1,49,254,252,6,1,10,254,219,25,43,4,53,40,51,52,
+150,60,100,101,63,88,71,20,91,1,27,114,130,139,75,27,140,99,95,147,198,69,40,169,174,59,176,77,69,84,112,140,
+43,59,139,105,49,4,14,14,33,49,0,0,4,0,152,0,0,10,84,5,186,0,9,0,21,0,32,0,36,0,149,64,38,6,2,1,1,130,7,6,20,
+7,7,6,102,10,105,16,2,28,150,10,22,150,10,16,64,9,11,54,16,16,35,150,34,7,24,9,10,54,2,184,255,232,64,50,9,10,
+54,2,7,1,8,6,3,1,34,4,18,36,36,25,134,13,13,38,35,35,31,134,95,19,1,19,6,4,2,1,0,7,128,16,9,32,9,2,9,2,128,19,
+9,4,37,4,107,2,43,47,51,51,237,47,93,253,17,57,17,18,57,47,93,237,57,47,17,51,47,237,57,47,0,63,51,60,63,60,
+18,57,57,43,43,47,253,50,47,43,51,237,47,237,93,135,5,46,43,135,125,196,49,48,33,33,1,17,33,17,33,1,17,33,5,
+50,22,21,20,2,35,34,2,53,52,0,19,50,54,53,52,38,35,34,6,21,20,1,33,53,33,6,18,254,84,253,220,254,86,1,167,2,
+41,1,170,2,88,239,251,249,241,231,254,1,0,232,72,69,66,71,75,69,2,78,252,156,3,100,3,37,252,219,5,186,252,213,
+3,43,204,254,187,188,254,252,1,2,184,190,1,1,253,116,98,111,109,96,96,113,205,253,203,242,0,0,2,0,90,255,222,
+4,124,4,72,0,18,0,25,0,0,1,17,22,51,50,55,23,6,6,35,34,0,53,52,0,51,50,0,19,39,17,38,35,34,7,17,1,65,120,178,
+254,141,72,118,227,122,232,254,215,1,43,230,214,1,48,11,231,124,176,174,122,2,19,254,141,121,246,43,170,106,1,
+61,248,252,1,57,254,228,254,231,74,1,41,121,121,254,215,0,255,255,0,157,255,203,7,97,5,211,0,38,0,241,16,0,0,
+39,0,188,3,38,0,0,1,7,2,155,4,72,252,254,0,18,64,10,4,3,2,19,16,10,15,54,19,25,0,63,43,53,53,53,255,255,0,79,
+255,203,7,105,5,211,0,38,0,243,48,0,0,39,0,188,3,38,0,0,1,7,2,155,4,80,252,254,0,18,64,10,4,3,2,55,16,10,15,
+54,55,25,0,63,43,53,53,53,255,255,0,95,255,203,7,101,5,211,0,38,2,153,60,0,0,39,0,188,3,44,0,0,1,7,2,155,4,76,
+252,254,0,18,64,10,4,3,2,38,16,10,15,54,38,25,0,63,43,53,53,53,255,255,0,132,255,203,7,97,5,211,0,38,2,154,52,
+0,0,39,0,188,2,236,0,0,1,7,2,155,4,72,252,254,0,18,64,10,4,3,2,18,16,10,15,54,18,25,0,63,43,53,53,53,0,2,0,
+153,0,0,4,52,4,129,0,4,0,9,0,0,51,17,1,1,17,37,33,17,1,1,153,1,205,1,206,252,182,2,249,254,131,254,132,2,122,
+2,7,253,249,253,134,81,2,7,1,171,254,85,0,1,0,126,1,60,4,194,4,109,0,5,0,25,64,12,3,3,5,177,2,2,176,5,32,0,1,
+0,47,93,47,253,0,47,237,51,47,49,48,1,17,33,17,33,17,4,194,253,2,254,186,4,109,254,187,254,20,3,49,0,0,1,2,30,
+253,253,3,204,6,201,0,19,0,0,1,35,17,52,54,51,50,22,21,20,6,35,34,38,39,38,35,34,6,21,2,175,145,172,120,59,79,
+53,35,34,43,21,24,23,29,23,253,253,7,21,206,233,56,53,41,51,27,34,37,49,129,0,0,1,1,1,253,253,2,175,6,201,0,
+19,0,0,1,51,17,20,6,35,34,38,53,52,54,51,50,22,23,22,51,50,54,53,2,30,145,172,120,74,64,53,34,35,43,21,24,23,
+29,23,6,201,248,237,207,234,69,40,41,51,28,33,37,48,130,0,0,1,255,235,2,22,5,195,2,197,0,3,0,0,1,33,53,33,5,
+195,250,40,5,216,2,22,175,0,0,1,1,196,253,147,2,115,7,72,0,3,0,0,1,17,51,17,1,196,175,253,147,9,181,246,75,0,
+0,1,2,128,253,147,5,196,2,197,0,5,0,0,1,21,33,17,35,17,5,196,253,107,175,2,197,175,251,125,5,50,0,1,255,235,
+253,147,3,46,2,197,0,5,0,0,1,33,53,33,17,35,2,127,253,108,3,67,175,2,22,175,250,206,0,1,2,128,2,22,5,196,7,72,
+0,5,0,0,1,17,51,17,33,21,2,128,175,2,149,2,22,5,50,251,125,175,0,1,255,235,2,22,3,46,7,72,0,5,0,0,1,33,53,33,
+17,51,3,46,252,189,2,148,175,2,22,175,4,131,0,1,2,128,253,147,5,196,7,72,0,7,0,0,1,17,51,17,33,21,33,17,2,128,
+175,2,149,253,107,253,147,9,181,251,125,175,251,125,0,1,255,235,253,147,3,46,7,72,0,7,0,0,1,17,33,53,33,17,51,
+17,2,127,253,108,2,148,175,253,147,4,131,175,4,131,246,75,0,1,255,235,253,147,5,195,2,197,0,7,0,0,1,33,53,33,
+21,33,17,35,2,127,253,108,5,216,253,107,175,2,22,175,175,251,125,0,0,1,255,235,2,22,5,195,7,72,0,7,0,0,1,33,
+53,33,17,51,17,33,5,195,250,40,2,148,175,2,149,2,22,175,4,131,251,125,0,1,255,235,253,147,5,195,7,72,0,11,0,0,
+1,33,53,33,17,51,17,33,21,33,17,35,2,127,253,108,2,148,175,2,149,253,107,175,2,22,175,4,131,251,125,175,251,
+125,0,2,255,235,1,88,5,195,3,131,0,3,0,7,0,0,1,33,53,33,17,33,53,33,5,195,250,40,5,216,250,40,5,216,2,212,175,
+253,213,175,0,2,1,194,253,147,3,237,7,72,0,3,0,7,0,0,1,17,51,17,33,17,51,17,3,62,175,253,213,175,253,147,9,
+181,246,75,9,181,246,75,0,1,2,128,253,147,5,196,3,131,0,9,0,0,1,17,33,21,33,21,33,21,33,17,2,128,3,68,253,107,
+2,149,253,107,253,147,5,240,175,205,175,252,59,0,0,1,1,194,253,147,5,196,2,197,0,9,0,0,1,17,33,21,33,17,35,17,
+35,17,1,194,4,2,254,41,175,205,253,147,5,50,175,251,125,4,116,251,140,0,0,2,1,194,253,147,5,195,3,131,0,5,0,
+11,0,0,1,35,17,33,21,33,1,17,35,17,33,21,2,113,175,4,1,252,174,1,124,175,2,133,253,147,5,240,175,254,132,252,
+59,4,116,175,0,1,255,235,253,147,3,46,3,131,0,9,0,0,1,33,53,33,53,33,53,33,17,35,2,127,253,108,2,148,253,108,
+3,67,175,1,88,175,205,175,250,16,0,1,255,235,253,147,3,236,2,197,0,9,0,0,1,17,33,53,33,17,35,17,35,17,1,193,
+254,42,4,1,175,205,253,147,4,131,175,250,206,4,131,251,125,0,0,2,255,235,253,147,3,236,3,131,0,5,0,11,0,0,1,
+17,33,53,33,17,1,33,53,33,17,35,3,61,252,174,4,1,253,213,254,42,2,133,175,253,147,5,65,175,250,16,3,197,175,
+251,140,0,0,1,2,128,1,88,5,196,7,72,0,9,0,0,1,17,51,17,33,21,33,21,33,21,2,128,175,2,149,253,107,2,149,1,88,5,
+240,252,59,175,205,175,0,1,1,194,2,22,5,195,7,72,0,9,0,0,1,33,17,51,17,51,17,51,17,33,5,195,251,255,175,205,
+175,1,214,2,22,5,50,251,125,4,131,251,125,0,0,2,1,194,1,88,5,195,7,72,0,5,0,11,0,0,1,17,33,21,33,17,1,33,21,
+33,17,51,2,113,3,82,251,255,2,43,1,214,253,123,175,7,72,250,191,175,5,240,252,59,175,4,116,0,0,1,255,235,1,88,
+3,46,7,72,0,9,0,0,1,33,53,33,53,33,53,33,17,51,3,46,252,189,2,148,253,108,2,148,175,1,88,175,205,175,3,197,0,
+1,255,235,2,22,3,236,7,72,0,9,0,0,1,33,53,33,17,51,17,51,17,51,3,236,251,255,1,214,175,205,175,2,22,175,4,131,
+251,125,4,131,0,2,255,235,1,88,3,236,7,72,0,5,0,11,0,0,1,51,17,33,53,33,1,17,51,17,33,53,3,61,175,251,255,3,
+82,254,132,175,253,123,7,72,250,16,175,1,124,3,197,251,140,175,0,1,2,128,253,147,5,196,7,72,0,11,0,0,1,17,51,
+17,33,21,33,21,33,21,33,17,2,128,175,2,149,253,107,2,149,253,107,253,147,9,181,252,59,175,205,175,252,59,0,2,
+1,194,253,147,5,196,7,72,0,7,0,11,0,0,1,17,51,17,33,21,33,17,33,17,51,17,3,62,175,1,215,254,41,253,213,175,
+253,147,9,181,251,125,175,251,125,9,181,246,75,0,0,3,1,194,253,147,5,196,7,72,0,3,0,9,0,15,0,0,1,17,51,17,19,
+17,51,17,33,21,1,17,33,21,33,17,1,194,175,205,175,1,215,253,122,2,134,254,41,253,147,9,181,246,75,5,65,4,116,
+252,59,175,250,191,4,116,175,252,59,0,0,1,255,235,253,147,3,46,7,72,0,11,0,0,1,33,53,33,53,33,53,33,17,51,17,
+35,2,127,253,108,2,148,253,108,2,148,175,175,1,88,175,205,175,3,197,246,75,0,0,2,255,235,253,147,3,236,7,72,0,
+7,0,11,0,0,1,17,33,53,33,17,51,17,51,17,51,17,1,193,254,42,1,214,175,205,175,253,147,4,131,175,4,131,246,75,9,
+181,246,75,0,3,255,235,253,147,3,236,7,72,0,3,0,9,0,15,0,0,1,17,51,17,1,17,33,53,33,17,17,33,53,33,17,35,3,61,
+175,254,132,253,123,1,214,254,42,2,133,175,253,147,9,181,246,75,9,181,251,140,175,3,197,250,16,175,251,140,0,
+2,255,235,253,147,5,195,3,131,0,3,0,11,0,0,1,33,53,33,1,33,53,33,21,33,17,35,5,195,250,40,5,216,252,188,253,
+108,5,216,253,107,175,2,212,175,253,213,175,175,252,59,0,1,255,235,253,147,5,195,2,197,0,11,0,0,1,17,33,53,33,
+21,33,17,35,17,35,17,1,193,254,42,5,216,254,41,175,205,253,147,4,131,175,175,251,125,4,116,251,140,0,3,255,
+235,253,147,5,195,3,131,0,3,0,9,0,15,0,0,1,33,53,33,1,33,53,33,17,35,33,17,33,21,33,17,5,195,250,40,5,216,251,
+254,254,42,2,133,175,1,124,2,134,254,41,2,212,175,253,213,175,251,140,4,116,175,252,59,0,2,255,235,1,88,5,195,
+7,72,0,7,0,11,0,0,1,33,53,33,17,51,17,33,17,33,53,33,5,195,250,40,2,148,175,2,149,250,40,5,216,2,212,175,3,
+197,252,59,253,213,175,0,0,1,255,235,2,22,5,195,7,72,0,11,0,0,1,33,53,33,17,51,17,51,17,51,17,33,5,195,250,40,
+1,214,175,205,175,1,215,2,22,175,4,131,251,125,4,131,251,125,0,3,255,235,1,88,5,195,7,72,0,5,0,11,0,15,0,0,1,
+33,53,33,17,51,1,33,17,51,17,33,17,33,53,33,2,112,253,123,1,214,175,3,83,253,122,175,1,215,250,40,5,216,2,212,
+175,3,197,251,140,4,116,252,59,253,213,175,0,1,255,235,253,147,5,195,7,72,0,19,0,0,1,33,53,33,53,33,53,33,17,
+51,17,33,21,33,21,33,21,33,17,35,2,127,253,108,2,148,253,108,2,148,175,2,149,253,107,2,149,253,107,175,1,88,
+175,205,175,3,197,252,59,175,205,175,252,59,0,1,255,235,253,147,5,195,7,72,0,19,0,0,1,17,33,53,33,17,51,17,51,
+17,51,17,33,21,33,17,35,17,35,17,1,193,254,42,1,214,175,205,175,1,215,254,41,175,205,253,147,4,131,175,4,131,
+251,125,4,131,251,125,175,251,125,4,131,251,125,0,0,4,255,235,253,147,5,195,7,72,0,5,0,11,0,17,0,23,0,0,1,33,
+21,33,17,51,1,17,51,17,33,53,1,33,53,33,17,35,1,17,35,17,33,21,3,237,1,214,253,123,175,253,212,175,253,123,1,
+214,254,42,2,133,175,2,44,175,2,133,3,131,175,4,116,252,59,3,197,251,140,175,253,213,175,251,140,3,197,252,59,
+4,116,175,0,1,255,235,2,109,5,195,7,72,0,3,0,0,1,33,17,33,5,195,250,40,5,216,2,109,4,219,0,1,255,235,253,147,
+5,195,2,109,0,3,0,0,1,33,17,33,5,195,250,40,5,216,253,147,4,218,0,1,255,235,253,147,5,195,7,72,0,3,0,0,3,17,
+33,17,21,5,216,253,147,9,181,246,75,0,0,1,255,235,253,147,2,215,7,72,0,3,0,0,3,17,33,17,21,2,236,253,147,9,
+181,246,75,0,0,1,2,215,253,147,5,195,7,72,0,3,0,0,1,17,33,17,2,215,2,236,253,147,9,181,246,75,0,30,0,104,254,
+8,5,195,7,72,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,
+79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,0,119,0,0,19,51,21,35,37,51,21,35,37,51,21,35,5,51,21,35,
+37,51,21,35,37,51,21,35,7,51,21,35,37,51,21,35,37,51,21,35,5,51,21,35,37,51,21,35,37,51,21,35,7,51,21,35,37,
+51,21,35,37,51,21,35,23,51,21,35,37,51,21,35,37,51,21,35,7,51,21,35,37,51,21,35,37,51,21,35,5,51,21,35,37,51,
+21,35,37,51,21,35,7,51,21,35,37,51,21,35,37,51,21,35,23,51,21,35,37,51,21,35,37,51,21,35,104,125,125,1,242,
+125,125,1,243,125,125,253,20,125,125,1,243,124,124,1,242,125,125,249,125,125,254,13,125,125,254,14,125,125,4,
+222,125,125,254,14,124,124,254,13,125,125,249,125,125,1,242,125,125,1,243,125,125,249,125,125,254,14,124,124,
+254,13,125,125,249,125,125,1,242,125,125,1,243,125,125,253,20,125,125,1,243,124,124,1,242,125,125,249,125,125,
+254,13,125,125,254,14,125,125,249,125,125,1,243,124,124,1,242,125,125,7,72,125,125,125,125,125,124,125,125,
+125,125,125,124,125,125,125,125,125,125,124,124,124,124,124,125,125,125,125,125,125,124,125,125,125,125,125,
+124,125,125,125,125,125,125,124,124,124,124,124,125,125,125,125,125,125,124,125,125,125,125,125,0,60,0,0,254,
+8,5,167,7,72,0,3,0,7,0,11,0,15,0,19,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,75,0,
+79,0,83,0,87,0,91,0,95,0,99,0,103,0,107,0,111,0,115,0,119,0,123,0,127,0,131,0,135,0,139,0,143,0,147,0,151,0,
+155,0,159,0,163,0,167,0,171,0,175,0,179,0,183,0,187,0,191,0,195,0,199,0,203,0,207,0,211,0,215,0,219,0,223,0,
+227,0,231,0,235,0,239,3,61,64,255,235,231,227,223,219,232,228,224,220,216,199,203,207,211,215,196,200,204,208,
+212,187,183,179,175,171,184,180,176,172,168,151,155,159,163,167,148,152,156,160,164,135,131,127,143,123,132,
+128,124,140,120,115,111,107,103,99,112,108,104,100,96,87,83,79,75,95,84,80,76,72,92,67,63,59,55,51,64,60,56,
+52,48,43,39,35,31,27,40,36,32,28,24,19,15,11,7,3,16,12,8,4,0,238,219,237,216,194,215,193,212,190,171,189,168,
+146,167,145,164,138,123,137,120,118,99,117,96,90,95,89,92,70,51,69,48,46,27,45,24,22,3,21,0,216,122,219,212,
+122,215,168,122,171,164,122,167,120,122,123,96,122,99,92,122,95,48,122,51,24,122,27,0,122,3,123,215,215,27,
+171,171,27,167,167,27,123,123,27,99,99,27,95,95,27,51,51,219,123,27,193,145,117,69,21,192,144,116,68,20,197,
+149,113,65,17,196,148,112,64,16,201,153,109,61,13,200,152,108,60,12,205,157,105,57,9,204,156,104,56,8,209,161,
+101,53,5,208,160,100,52,4,213,165,97,49,1,212,164,96,48,0,189,64,168,137,89,45,188,136,88,44,185,133,85,41,
+184,132,84,40,181,129,81,37,180,128,80,36,177,125,77,33,176,124,76,32,173,141,73,29,172,140,72,28,169,121,93,
+25,168,120,92,24,194,21,195,20,198,17,199,16,202,13,203,12,206,9,207,8,210,5,211,4,214,1,215,0,238,45,239,44,
+234,41,235,40,230,37,231,36,226,33,227,32,222,29,223,28,218,25,219,24,20,121,21,16,121,17,12,121,13,8,121,9,4,
+121,5,0,121,1,45,121,44,41,121,40,37,121,36,33,121,32,29,121,28,25,121,24,1,1,240,44,44,240,5,5,240,40,40,240,
+9,9,240,36,36,240,13,13,240,32,32,240,17,17,240,28,28,240,21,21,240,24,24,241,240,17,18,57,47,17,57,47,17,57,
+47,17,57,47,17,57,47,17,57,47,17,57,47,17,57,47,17,57,47,17,57,47,17,57,47,17,57,47,16,237,16,237,16,237,16,
+237,16,237,16,237,16,237,16,237,16,237,16,237,16,237,16,237,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,
+16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,60,60,
+16,60,60,60,16,60,60,60,16,60,60,60,16,60,60,60,16,60,60,60,16,60,60,60,16,60,60,60,16,60,60,60,16,60,60,60,
+16,60,60,60,16,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,
+60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,0,47,228,57,
+47,17,57,47,17,57,47,17,57,47,17,57,47,17,57,47,17,57,47,244,237,16,237,16,237,16,237,16,237,16,237,16,237,16,
+237,16,237,16,237,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,16,60,
+16,60,16,60,16,60,16,60,16,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,
+60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,
+60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,60,60,16,60,60,
+60,60,49,48,19,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,55,51,21,35,55,
+51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,
+21,35,5,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,37,51,21,35,23,51,21,35,55,51,21,35,55,51,21,
+35,55,51,21,35,55,51,21,35,55,51,21,35,5,51,21,35,37,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,37,51,21,35,
+5,51,21,35,39,51,21,35,39,51,21,35,39,51,21,35,39,51,21,35,39,51,21,35,7,51,21,35,55,51,21,35,55,51,21,35,55,
+51,21,35,55,51,21,35,55,51,21,35,23,51,21,35,39,51,21,35,39,51,21,35,39,51,21,35,39,51,21,35,39,51,21,35,7,51,
+21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,55,51,21,35,121,120,120,241,120,120,241,121,121,241,121,
+121,242,120,120,241,120,120,250,209,121,121,241,121,121,241,121,121,242,120,120,241,121,121,241,121,121,251,
+195,120,120,241,120,120,241,121,121,241,121,121,242,120,120,241,120,120,251,194,121,121,241,121,121,242,120,
+120,241,121,121,241,121,121,251,74,121,121,121,120,120,241,120,120,241,121,121,241,121,121,242,120,120,241,
+120,120,250,209,121,121,1,226,121,121,242,120,120,241,121,121,241,121,121,252,59,121,121,4,62,120,120,241,120,
+120,242,121,121,241,121,121,241,120,120,241,120,120,121,121,121,241,121,121,241,121,121,242,120,120,241,121,
+121,241,121,121,121,120,120,241,120,120,242,121,121,241,121,121,241,120,120,241,120,120,121,121,121,241,121,
+121,241,121,121,242,120,120,241,121,121,241,121,121,7,72,125,125,125,125,125,125,125,125,125,125,125,124,125,
+125,125,125,125,125,125,125,125,125,125,124,125,125,125,125,125,125,125,125,125,125,125,125,124,124,124,124,
+124,124,124,124,124,124,124,125,125,125,125,125,125,125,125,125,125,125,125,124,125,125,125,125,125,125,125,
+125,125,125,125,124,125,125,125,125,125,125,125,125,125,125,125,125,124,124,124,124,124,124,124,124,124,124,
+124,125,125,125,125,125,125,125,125,125,125,125,125,124,125,125,125,125,125,125,125,125,125,125,125,0,46,0,0,
+253,140,5,215,7,72,0,61,0,65,0,69,0,73,0,77,0,81,0,85,0,89,0,93,0,97,0,101,0,105,0,109,0,113,0,117,0,121,0,
+125,0,129,0,133,0,137,0,141,0,145,0,149,0,153,0,157,0,161,0,165,0,169,0,173,0,177,0,181,0,185,0,189,0,193,0,
+197,0,201,0,205,0,209,0,213,0,217,0,221,0,225,0,229,0,233,0,237,0,241,0,0,1,17,35,21,51,17,35,21,51,17,35,21,
+51,17,35,21,51,21,33,17,51,53,35,17,51,53,35,17,51,53,35,17,51,53,35,17,51,53,51,21,51,53,51,21,51,53,51,21,
+51,53,51,21,51,53,51,21,51,53,51,21,35,21,37,21,51,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,51,53,23,35,
+21,51,39,35,21,51,39,35,21,51,39,35,21,51,39,35,21,51,7,21,51,53,51,21,51,53,51,21,51,53,51,21,51,53,51,21,51,
+53,5,35,21,51,55,21,51,53,51,21,51,53,51,21,51,53,51,21,51,53,5,21,51,53,33,21,51,53,7,53,35,21,37,21,51,53,
+51,21,51,53,19,53,35,21,35,53,35,21,35,53,35,21,35,53,35,21,35,53,35,21,7,21,51,53,51,21,51,53,51,21,51,53,51,
+21,51,53,51,21,51,53,19,53,35,21,35,53,35,21,35,53,35,21,35,53,35,21,35,53,35,21,7,21,51,53,51,21,51,53,51,21,
+51,53,51,21,51,53,51,21,51,53,5,215,124,124,124,124,124,124,124,124,250,41,125,125,125,125,125,125,125,125,
+125,124,125,124,125,125,124,125,125,124,125,124,124,251,34,124,125,124,125,125,124,125,125,124,125,125,125,
+249,125,125,250,124,124,249,125,125,249,125,125,249,124,125,124,125,125,124,125,125,124,252,152,125,125,124,
+125,125,124,125,125,124,125,251,34,124,1,118,125,250,124,1,242,125,125,124,125,125,124,125,125,124,125,125,
+124,125,124,124,125,124,125,125,124,125,125,124,125,125,124,125,125,124,125,125,124,125,124,124,125,124,125,
+125,124,125,125,124,5,210,254,138,124,254,138,125,254,138,124,254,138,125,124,1,117,125,1,118,125,1,117,125,1,
+118,125,1,117,125,125,125,125,125,125,125,125,125,125,125,249,125,125,125,125,125,125,125,125,125,125,125,125,
+249,125,125,125,125,125,125,125,125,125,125,124,124,124,124,124,124,124,124,124,124,249,125,125,125,125,125,
+125,125,125,125,125,249,125,125,125,125,125,125,125,125,125,125,125,125,254,138,125,125,125,125,125,125,125,
+125,125,125,125,124,124,124,124,124,124,124,124,124,124,254,138,125,125,125,125,125,125,125,125,125,125,124,
+125,125,125,125,125,125,125,125,125,125,0,1,0,142,0,0,4,62,3,176,0,3,0,0,19,33,17,33,142,3,176,252,80,3,176,
+252,80,0,0,1,0,0,1,61,7,255,2,191,0,3,0,0,17,33,17,33,7,255,248,1,2,191,254,126,0,1,1,48,0,0,6,188,5,139,0,2,
+0,0,33,1,1,1,48,2,198,2,198,5,139,250,117,0,0,1,1,32,255,225,6,203,5,137,0,2,0,0,9,2,1,32,5,171,250,85,5,137,
+253,44,253,44,0,1,1,48,255,225,6,188,5,108,0,2,0,0,9,2,6,188,253,58,253,58,5,108,250,117,5,139,0,1,1,32,255,
+225,6,203,5,137,0,2,0,0,1,17,1,6,203,250,85,5,137,250,88,2,212,0,0,2,0,174,0,137,4,31,3,250,0,11,0,23,0,0,1,
+20,0,35,34,0,53,52,0,51,50,0,7,52,38,35,34,6,21,20,22,51,50,54,4,31,254,253,181,182,254,253,1,3,181,183,1,2,
+76,213,151,151,214,214,151,150,214,2,66,182,254,253,1,3,182,182,1,2,254,254,182,151,213,215,149,149,216,215,0,
+2,0,124,0,0,4,80,3,212,0,3,0,15,0,0,51,17,33,17,1,52,38,35,34,6,21,20,22,51,50,54,124,3,212,254,224,118,84,82,
+120,119,83,84,118,3,212,252,44,1,234,83,119,118,84,83,119,120,0,3,0,38,0,0,4,169,4,131,0,3,0,15,0,27,0,0,51,
+17,33,17,3,52,0,35,34,0,21,20,0,51,50,0,39,20,6,35,34,38,53,52,54,51,50,22,38,4,131,137,254,253,181,183,254,
+254,1,1,184,181,1,3,76,214,150,151,214,215,150,150,214,4,131,251,125,2,65,181,1,4,254,252,181,182,254,254,1,3,
+181,150,214,214,150,151,214,213,0,5,1,151,255,137,6,146,4,132,0,11,0,23,0,35,0,47,0,57,0,0,1,16,0,33,32,0,17,
+16,0,33,32,0,3,52,0,35,34,0,21,20,0,51,50,0,1,20,6,35,34,38,53,52,54,51,50,22,5,20,6,35,34,38,53,52,54,51,50,
+22,1,55,22,51,50,55,23,6,35,34,6,146,254,137,254,250,254,248,254,138,1,119,1,7,1,7,1,118,92,254,191,224,225,
+254,192,1,64,225,224,1,65,253,59,47,34,33,48,48,33,34,47,1,233,47,34,33,48,48,33,34,47,253,149,62,79,153,153,
+78,63,104,190,191,2,7,254,249,254,137,1,117,1,9,1,6,1,119,254,137,254,250,224,1,64,254,192,224,225,254,192,1,
+64,1,100,33,48,48,33,34,47,47,34,33,48,48,33,34,47,47,254,141,36,144,144,36,195,0,0,4,1,182,255,137,6,177,4,
+132,0,11,0,23,0,35,0,45,0,0,1,16,0,33,32,0,17,16,0,33,32,0,5,52,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,
+21,20,22,51,50,54,1,22,51,50,55,39,6,35,34,39,6,177,254,137,254,250,254,248,254,138,1,119,1,7,1,7,1,118,252,
+223,47,34,33,48,48,33,34,47,1,233,47,34,33,48,48,33,34,47,253,149,103,191,190,104,63,78,153,153,79,2,7,254,
+249,254,137,1,117,1,9,1,6,1,119,254,137,131,34,47,47,34,33,48,48,33,34,47,47,34,33,48,48,254,208,195,195,36,
+144,144,0,2,0,19,255,33,7,73,6,85,0,39,0,51,0,0,1,51,17,22,23,1,23,1,22,23,33,21,33,6,7,1,7,1,6,7,17,35,17,38,
+39,1,39,1,38,39,33,53,33,54,55,1,55,1,54,55,1,52,0,35,34,0,21,20,0,51,50,0,3,137,76,191,159,1,31,54,254,226,
+141,2,1,80,254,176,14,129,1,30,54,254,225,167,183,76,204,143,254,218,49,1,28,125,19,254,176,1,80,14,130,254,
+228,49,1,38,178,169,2,36,254,210,211,211,254,211,1,45,211,211,1,46,6,85,254,175,7,133,1,27,55,254,226,174,179,
+69,191,160,254,223,51,1,24,125,14,254,175,1,81,25,114,254,232,51,1,33,152,199,69,199,154,1,30,55,254,229,130,
+10,253,183,211,1,45,254,211,211,211,254,210,1,46,0,0,2,0,87,254,175,4,15,5,152,0,23,0,35,0,0,1,17,33,21,33,17,
+35,17,33,53,33,17,34,38,38,53,52,0,51,50,0,21,20,2,19,52,38,35,34,6,21,20,22,51,50,54,2,77,1,161,254,95,54,
+254,94,1,162,83,218,147,1,23,197,196,1,24,255,206,250,177,176,251,251,176,176,251,1,225,254,147,54,254,113,1,
+143,54,1,109,107,230,138,196,1,24,254,232,196,185,254,235,1,205,176,250,251,175,176,251,251,0,0,2,0,106,254,
+173,5,21,5,92,0,27,0,39,0,0,1,23,18,19,7,38,39,1,22,22,21,20,4,35,34,0,53,52,0,51,50,23,1,6,7,53,54,54,1,34,6,
+21,20,22,51,50,54,53,52,38,4,87,29,35,126,25,149,73,254,217,110,182,254,246,193,203,254,229,1,5,176,76,94,1,
+37,214,243,171,177,254,150,155,231,230,161,162,223,234,5,92,10,254,153,255,0,16,188,227,253,133,42,240,148,
+188,232,1,12,189,188,1,0,33,2,124,90,14,26,53,93,253,51,224,166,160,225,227,154,164,230,0,0,1,0,57,0,0,4,5,4,
+207,0,31,0,0,1,22,22,23,22,22,21,20,6,35,34,39,20,22,23,23,33,55,50,54,53,52,39,6,35,34,38,53,52,54,55,36,2,
+32,18,93,157,122,95,130,89,155,100,203,175,7,252,232,7,177,207,1,90,171,91,129,105,84,1,5,4,207,82,174,143,
+111,140,85,93,128,190,230,191,7,37,37,204,191,11,22,190,130,90,92,146,68,215,0,0,1,0,59,0,0,5,12,4,207,0,43,0,
+0,33,33,55,62,2,53,39,6,6,35,34,38,53,52,54,51,50,23,38,53,52,54,51,50,22,21,20,7,54,51,50,22,21,20,6,35,34,
+38,39,30,2,23,4,78,252,176,8,153,133,117,1,54,178,96,114,163,145,97,63,100,67,158,118,115,164,69,106,56,105,
+142,162,112,78,178,76,4,88,157,159,34,33,71,206,125,42,116,122,161,119,112,163,51,107,75,113,159,156,111,94,
+93,53,162,111,120,163,99,138,157,187,102,31,0,0,1,0,59,255,232,4,125,4,207,0,21,0,0,5,38,38,3,38,38,53,52,54,
+51,50,23,54,54,51,50,22,21,20,6,7,0,2,94,32,121,215,101,78,148,109,206,84,34,158,93,109,149,81,133,254,227,24,
+122,213,1,27,133,158,84,110,151,251,127,125,150,100,88,190,167,254,152,0,1,0,63,255,232,3,213,4,207,0,8,0,0,1,
+18,1,6,0,7,38,1,0,2,8,193,1,12,52,254,188,85,101,254,156,1,68,4,207,254,189,254,208,52,254,86,150,190,1,182,1,
+127,0,1,0,25,254,43,6,17,5,255,0,25,0,0,1,51,22,0,21,20,6,35,34,39,38,36,39,19,20,6,4,35,34,38,53,52,36,51,50,
+23,3,157,60,164,1,148,40,19,28,35,55,254,232,102,26,143,254,221,146,190,225,1,69,210,192,204,5,255,100,254,94,
+76,16,57,44,66,248,64,250,162,122,142,121,194,133,159,240,94,0,1,1,48,254,63,6,230,5,206,0,29,0,0,1,1,17,20,6,
+6,35,34,38,53,52,54,51,50,23,17,5,17,20,6,6,35,34,38,53,52,54,51,50,23,3,64,3,166,75,175,113,145,135,180,144,
+84,116,253,69,59,183,125,124,153,186,137,95,110,4,171,1,35,250,235,148,146,96,155,108,117,170,50,3,82,217,252,
+43,123,160,113,142,119,129,163,54,0,0,1,0,18,254,81,2,111,255,232,0,22,0,51,64,24,1,3,0,13,21,12,15,10,10,15,
+15,21,21,3,19,1,18,0,12,12,0,6,178,18,47,237,51,51,47,47,18,57,0,63,51,47,51,47,51,47,18,57,17,57,57,18,57,49,
+48,23,55,54,51,50,22,21,20,6,6,35,34,39,53,22,51,50,54,53,52,38,35,34,116,30,94,82,171,130,59,152,126,114,154,
+104,117,86,61,50,53,71,165,118,23,116,79,48,102,62,26,123,20,46,37,29,42,0,0,1,0,35,2,211,3,12,5,207,0,28,0,
+143,64,18,28,0,0,178,24,25,20,24,24,25,0,24,2,15,23,1,23,2,184,255,192,64,16,18,20,54,20,179,23,2,2,25,8,208,
+11,224,11,2,11,184,255,192,64,19,13,17,54,11,14,179,11,111,8,239,8,2,8,28,179,8,25,1,5,184,255,240,64,27,10,
+13,54,26,26,17,178,16,5,32,5,64,5,112,5,4,5,0,25,28,3,24,24,11,178,5,10,47,51,237,57,47,23,51,47,93,237,57,47,
+43,0,63,51,237,47,93,51,237,47,43,93,17,18,57,47,51,237,43,47,113,18,57,57,135,14,46,43,5,125,16,196,49,48,1,
+54,51,50,22,21,20,6,35,32,39,55,22,22,51,50,54,53,52,38,35,34,6,7,39,19,33,21,33,1,31,75,103,133,182,191,179,
+254,203,66,246,8,72,47,56,73,71,63,33,81,23,196,65,2,92,254,78,4,180,33,130,108,129,147,207,35,43,50,62,47,50,
+56,32,25,29,1,172,172,0,0,1,0,80,2,209,2,231,5,211,0,8,0,65,64,17,63,3,111,3,191,3,239,3,4,3,0,6,179,3,7,1,7,
+184,255,192,180,18,19,54,7,5,184,255,236,64,13,15,20,54,41,5,1,5,8,8,2,178,7,3,47,51,253,50,47,51,93,43,47,43,
+0,63,51,237,57,47,93,49,48,1,6,3,33,18,19,33,53,33,2,231,225,35,254,250,38,233,254,100,2,151,5,68,208,254,93,
+1,56,1,26,176,0,3,0,29,2,209,3,25,5,211,0,19,0,30,0,39,0,146,181,5,16,10,15,54,15,184,255,240,64,43,13,16,54,
+0,10,36,64,31,34,54,36,64,18,20,54,36,179,20,64,10,12,54,20,20,15,31,179,63,5,111,5,191,5,239,5,4,5,26,179,5,
+15,1,0,184,255,240,64,27,21,23,54,0,23,18,10,16,21,23,54,10,28,12,23,178,18,33,178,18,16,2,1,224,2,1,2,184,
+255,192,64,12,15,16,54,2,28,178,12,38,178,12,2,8,47,51,51,237,47,237,47,43,93,113,51,237,47,237,17,18,57,43,
+17,18,57,43,0,63,51,237,47,93,237,18,57,47,43,237,43,43,57,57,43,43,49,48,1,22,21,20,6,35,34,38,53,52,55,38,
+53,52,54,51,50,22,21,20,37,50,54,53,52,38,35,34,21,20,22,19,50,53,52,38,35,34,21,20,2,152,129,199,184,183,198,
+127,105,191,168,166,192,254,154,54,64,55,61,121,65,54,131,70,61,131,4,109,40,128,119,125,124,120,127,41,43,
+106,102,107,107,102,105,19,42,32,40,33,73,32,42,254,188,101,45,53,98,101,0,2,0,98,0,0,4,221,4,123,0,35,0,47,0,
+149,64,32,34,10,35,9,1,7,6,4,8,0,64,9,11,54,0,0,39,177,15,4,1,4,25,19,27,17,28,16,6,22,18,26,184,255,192,64,
+46,9,11,54,26,26,4,45,177,22,64,9,11,54,22,19,7,18,8,16,10,6,13,9,17,64,9,11,54,17,17,36,176,15,13,1,13,28,34,
+26,0,25,1,6,31,35,27,184,255,192,64,14,9,12,54,27,27,13,42,176,128,31,144,31,2,31,47,93,237,51,51,47,43,60,17,
+23,57,47,93,237,51,47,43,60,17,23,57,0,47,43,237,51,51,47,43,60,17,23,57,47,93,237,51,47,43,60,17,23,57,49,48,
+1,23,54,54,51,50,22,23,55,23,7,22,22,21,20,6,7,23,7,39,6,6,35,34,38,39,7,39,55,38,38,53,52,54,55,39,1,52,38,
+35,34,6,21,20,22,51,50,54,1,49,144,57,111,54,54,112,57,140,211,141,26,26,26,26,141,211,140,61,113,52,52,110,
+57,137,214,141,27,27,27,27,141,2,253,112,80,79,112,112,79,80,112,4,123,142,29,28,28,29,142,209,143,54,109,55,
+54,112,58,140,213,143,27,27,27,27,143,213,140,52,108,56,57,113,56,143,254,148,80,112,112,80,79,112,112,255,
+255,0,71,253,170,5,121,5,211,2,34,0,54,0,0,1,7,1,81,1,144,0,0,0,17,64,9,1,0,45,46,42,42,37,1,45,0,47,53,1,43,
+53,0,255,255,0,51,253,170,4,156,4,62,2,34,0,86,0,0,1,7,1,81,1,19,0,0,0,17,64,9,1,0,47,48,44,44,37,1,47,0,47,
+53,1,43,53,0,255,255,0,47,253,170,5,144,5,186,2,34,0,55,0,0,1,7,1,81,1,135,0,0,0,17,64,9,1,0,8,9,5,4,37,1,8,0,
+47,53,1,43,53,0,255,255,0,56,253,170,3,85,5,186,2,34,0,87,0,0,1,7,1,81,0,146,0,0,0,17,64,9,1,0,24,25,18,3,37,
+1,24,0,47,53,1,43,53,0,255,255,0,138,0,0,2,169,7,70,2,34,0,76,0,0,1,7,0,141,0,0,1,115,0,19,64,11,2,0,11,11,0,
+0,37,2,11,5,38,0,43,53,1,43,53,0,0,2,0,80,255,231,4,210,4,81,0,19,0,28,0,28,64,14,27,137,15,22,137,5,20,153,
+10,25,25,153,0,13,0,63,237,63,237,1,47,237,47,237,49,48,1,50,30,2,21,20,14,2,35,34,46,2,53,52,62,2,19,50,17,
+52,38,35,34,17,16,2,145,141,216,145,75,79,148,215,135,140,215,147,75,79,149,214,135,173,85,89,172,4,81,77,145,
+211,134,134,209,144,76,76,144,209,134,134,211,145,77,252,164,1,39,149,146,254,217,254,217,0,0,1,0,70,0,0,3,
+108,4,61,0,11,0,32,64,15,5,7,137,11,8,0,196,9,11,11,5,8,24,5,12,0,63,63,18,57,47,57,237,1,47,51,237,57,49,48,
+19,62,3,55,33,17,33,17,6,7,70,63,131,123,109,42,1,82,254,98,178,214,3,90,12,33,52,76,54,251,195,2,160,108,37,
+0,0,1,0,49,0,0,4,247,4,82,0,37,0,64,64,35,13,18,26,3,21,8,37,137,0,0,21,31,137,20,8,51,26,67,26,2,26,13,13,21,
+37,37,5,18,194,21,24,34,190,5,13,0,63,237,63,237,18,57,47,18,57,17,51,93,1,47,51,237,47,51,47,237,17,18,23,57,
+49,48,19,62,3,51,32,4,21,20,14,2,7,14,3,7,33,17,33,62,3,55,62,3,53,52,38,35,34,6,7,84,21,84,144,213,151,1,21,
+1,21,31,86,154,123,91,103,51,13,1,2,161,251,58,9,51,102,162,121,120,140,72,19,74,75,85,100,22,2,226,96,139,90,
+43,163,171,51,105,98,87,34,24,31,20,13,6,254,209,92,154,130,109,48,47,67,49,40,20,42,45,70,87,255,255,0,62,
+254,102,4,249,4,82,1,7,0,22,255,246,254,127,0,7,178,0,4,13,0,63,53,0,0,2,0,49,254,127,5,50,4,77,0,10,0,13,0,
+52,64,25,13,1,11,11,10,7,7,5,9,137,10,10,1,12,1,3,13,5,2,13,194,10,8,1,24,0,63,51,198,237,50,50,63,18,57,1,47,
+50,47,237,50,50,47,17,51,17,18,57,49,48,33,33,17,1,33,17,51,17,35,17,33,17,17,1,2,254,253,51,2,205,1,99,209,
+209,254,157,254,129,1,79,2,254,252,229,254,206,254,127,2,179,1,171,254,85,255,255,0,62,254,103,5,1,4,58,1,7,0,
+24,255,251,254,128,0,7,178,0,0,12,0,63,53,0,255,255,0,92,255,231,5,20,5,211,0,6,0,25,6,0,255,255,0,64,254,128,
+4,229,4,58,1,7,0,26,255,229,254,128,0,7,178,0,0,12,0,63,53,0,255,255,0,77,255,231,4,251,5,211,0,6,0,27,249,0,
+255,255,0,92,254,102,5,20,4,82,1,7,0,28,0,21,254,127,0,9,179,1,0,18,13,0,63,53,53,0,255,255,0,84,255,231,5,2,
+5,211,2,6,0,19,0,0,255,255,0,79,0,0,3,151,5,211,0,6,0,20,168,0,255,255,0,54,0,0,4,252,5,211,0,6,0,21,0,0,255,
+255,0,76,255,231,5,7,5,211,0,6,0,22,4,0,255,255,0,60,0,0,5,61,5,211,0,6,0,23,18,0,255,255,0,65,255,231,5,4,5,
+186,0,6,0,24,254,0,255,255,0,85,255,231,5,13,5,211,0,6,0,25,255,0,255,255,0,59,0,0,4,224,5,186,0,6,0,26,224,0,
+255,255,0,84,255,231,5,2,5,211,2,6,0,27,0,0,255,255,0,69,255,231,4,253,5,211,0,6,0,28,254,0,0,2,0,83,255,230,
+5,239,5,212,0,50,0,69,0,67,64,35,23,26,17,36,5,125,6,6,59,125,36,46,69,125,22,17,51,203,26,31,46,5,46,5,11,64,
+206,31,19,23,18,0,206,11,4,0,63,237,63,63,237,18,57,57,47,47,18,57,237,1,47,51,237,50,47,237,51,47,237,17,18,
+57,57,49,48,1,34,14,2,7,37,62,3,51,50,30,2,21,17,20,30,2,23,33,38,38,39,14,3,35,34,46,2,53,52,62,2,55,62,3,55,
+52,46,2,19,6,6,7,14,3,21,20,30,2,51,50,62,2,53,3,19,60,81,54,31,8,254,94,24,117,172,221,127,177,248,156,72,4,
+15,27,24,254,40,13,20,7,36,85,112,142,93,99,167,122,68,56,135,223,168,58,95,79,66,30,19,47,79,148,57,143,76,
+59,73,39,13,26,45,62,36,57,105,81,48,4,144,24,47,71,47,77,123,167,102,44,60,127,197,136,254,77,107,164,128,98,
+40,31,84,50,38,70,52,31,60,111,160,99,100,158,119,84,27,9,17,17,16,9,53,79,51,25,254,28,22,39,16,12,32,40,49,
+29,35,55,37,20,32,66,99,67,0,2,0,93,255,231,6,76,5,211,0,28,0,39,0,56,64,30,28,210,0,0,29,212,21,39,22,211,10,
+39,202,22,47,22,1,28,22,28,22,5,34,206,15,4,25,206,5,19,0,63,237,63,237,18,57,57,47,47,93,16,237,1,47,237,50,
+47,237,51,47,237,49,48,1,14,3,35,34,36,38,2,53,52,18,54,36,51,50,4,22,18,21,21,33,22,22,51,50,54,55,19,46,3,
+35,34,14,2,7,6,41,48,128,174,225,145,153,254,235,210,124,110,199,1,23,169,183,1,28,194,101,251,221,11,159,152,
+99,119,23,37,5,45,78,108,68,65,105,76,45,5,1,114,101,148,98,48,92,188,1,29,192,180,1,26,195,102,111,204,254,
+224,177,108,144,161,78,59,1,171,67,113,81,45,46,81,113,66,0,1,0,152,0,0,6,19,5,210,0,27,0,36,64,18,16,125,15,
+4,0,125,1,4,1,22,145,9,4,2,3,16,1,18,0,63,51,63,63,237,18,57,1,47,237,50,47,237,49,48,33,33,17,33,21,62,3,51,
+50,30,2,21,17,33,17,52,46,2,35,34,14,2,21,2,93,254,59,1,167,42,99,122,150,93,111,175,123,65,254,59,23,52,83,
+60,62,103,74,40,5,186,208,55,86,60,31,72,138,204,132,252,80,3,91,74,109,71,35,44,93,144,101,0,0,1,0,152,0,0,9,
+23,5,210,0,46,0,55,64,28,0,125,1,1,12,37,125,36,15,11,125,12,25,15,15,12,41,5,145,30,20,4,13,3,37,1,12,18,0,
+63,51,51,63,63,51,237,50,18,57,17,51,1,47,237,50,47,237,18,57,47,237,49,48,33,33,17,52,38,35,34,14,2,21,17,33,
+17,33,21,62,3,51,50,30,2,23,62,3,51,50,30,2,21,17,33,17,52,38,35,34,14,2,21,5,186,254,59,82,98,51,84,60,33,
+254,59,1,167,37,97,120,142,81,58,107,92,72,22,48,104,118,135,78,104,164,113,60,254,59,81,98,51,84,60,34,3,91,
+148,141,44,93,144,101,253,2,5,186,208,52,86,61,33,27,57,87,59,59,87,57,27,72,138,204,132,252,80,3,91,148,141,
+44,93,144,101,0,1,0,142,255,232,6,9,5,186,0,27,0,36,64,18,17,210,14,27,3,125,2,4,9,0,15,3,22,147,9,19,3,18,0,
+63,63,237,63,51,18,57,1,47,237,50,47,237,49,48,1,33,17,33,53,14,3,35,34,46,2,53,17,33,17,20,30,2,51,50,62,2,
+53,4,68,1,197,254,89,51,101,117,144,93,111,175,123,65,1,197,23,52,83,60,62,103,73,41,5,186,250,70,208,58,87,
+58,29,72,138,204,132,3,176,252,165,74,106,67,32,39,83,126,87,0,0,1,0,70,0,0,3,86,5,186,0,11,0,41,64,20,3,11,
+11,1,6,10,10,8,125,1,8,0,206,11,18,7,3,206,4,3,0,63,237,50,63,237,50,1,47,237,50,47,51,17,51,47,51,49,48,19,
+51,17,35,17,33,17,35,17,51,17,33,70,165,165,3,16,165,165,252,240,1,57,3,72,1,57,254,199,252,184,254,199,0,1,0,
+152,0,0,6,136,5,186,0,10,0,42,64,21,5,12,2,9,125,10,3,7,213,4,6,5,2,8,3,7,10,18,3,0,3,0,63,50,63,51,23,57,1,
+47,51,237,50,47,237,50,18,57,49,48,19,33,17,1,33,1,1,33,1,17,33,152,1,197,2,3,2,30,253,151,2,115,253,220,253,
+249,254,59,5,186,253,124,2,132,253,79,252,247,2,186,253,70,0,2,0,93,255,95,6,76,5,211,0,25,0,45,0,64,64,34,28,
+27,45,26,4,10,15,18,0,17,214,16,16,30,125,10,40,125,0,15,28,21,26,26,5,45,145,17,21,19,35,145,5,4,0,63,237,63,
+206,237,18,57,47,18,57,57,1,47,237,47,237,51,47,237,18,57,57,17,23,57,49,48,19,52,18,54,36,51,50,4,22,18,21,
+20,14,2,7,19,33,39,6,6,35,34,36,38,2,37,33,23,54,53,52,46,2,35,34,14,2,21,20,30,2,23,93,103,194,1,25,179,183,
+1,27,195,101,40,69,91,51,217,254,114,113,46,106,72,179,254,233,192,100,2,24,1,122,102,50,45,81,115,69,68,112,
+79,44,42,75,105,63,2,220,179,1,26,195,103,101,192,254,234,176,124,195,151,110,40,254,227,154,9,9,103,194,1,25,
+38,135,102,192,105,150,97,46,46,100,159,113,112,155,98,47,4,0,2,0,72,255,232,4,217,4,62,0,19,0,44,0,46,64,24,
+0,28,10,131,40,25,29,215,28,30,25,20,15,152,35,22,29,21,26,15,5,152,20,16,0,63,237,63,63,63,237,18,57,57,1,47,
+237,50,47,237,18,57,49,48,1,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,1,50,30,2,23,53,33,17,33,53,14,3,35,34,
+46,2,53,52,62,2,3,65,28,50,69,40,35,60,46,26,26,46,63,37,38,67,49,28,254,199,53,90,81,76,40,1,125,254,131,40,
+76,81,90,55,110,167,112,57,68,120,164,2,22,63,93,61,31,27,61,98,71,65,95,62,29,29,63,98,2,110,19,43,69,50,157,
+251,218,157,51,69,43,18,90,155,205,116,133,203,138,70,0,2,0,138,254,108,2,33,5,186,0,3,0,7,0,30,64,14,2,6,133,
+3,7,3,3,4,7,27,4,15,0,0,0,63,63,63,17,57,47,1,47,51,237,50,49,48,19,33,17,33,21,33,17,33,138,1,151,254,105,1,
+151,254,105,5,186,254,235,127,250,70,0,1,0,123,0,0,5,86,5,186,0,10,0,45,64,23,2,9,133,5,6,10,3,7,211,4,6,2,8,
+5,3,3,7,10,21,3,15,0,0,0,63,63,63,51,18,23,57,1,47,51,237,50,47,18,57,237,50,49,48,19,33,17,1,33,1,1,33,1,17,
+33,123,1,160,1,63,1,230,254,90,1,188,254,33,254,164,254,96,5,186,252,228,1,136,254,37,253,181,1,238,254,18,0,
+0,1,0,120,255,231,2,248,5,186,0,21,0,24,64,11,10,10,1,133,20,21,0,6,204,15,22,0,63,236,63,1,47,236,50,47,49,
+48,1,17,20,30,2,51,50,54,55,19,14,3,35,34,46,2,53,17,2,16,7,22,41,33,20,42,32,35,49,80,67,57,25,107,140,82,33,
+5,186,251,247,49,66,39,16,6,6,254,237,6,10,6,3,50,96,142,93,4,86,0,0,2,0,72,254,81,5,200,4,62,0,39,0,59,0,55,
+64,29,40,8,18,39,133,21,29,29,21,50,131,8,26,206,32,28,19,15,0,18,3,45,205,13,16,55,205,3,22,0,63,237,63,237,
+18,57,57,63,63,237,1,47,237,47,51,47,16,237,50,18,57,49,48,37,6,6,35,34,46,2,53,52,62,2,51,50,30,2,23,53,33,
+17,20,30,2,51,50,55,19,6,6,35,34,46,2,39,38,53,17,52,46,2,35,34,14,2,21,20,30,2,51,50,62,2,3,65,63,154,96,96,
+164,120,68,70,122,162,92,54,90,81,77,40,1,125,14,27,40,25,25,47,61,88,145,60,72,109,80,51,14,28,27,49,67,39,
+36,62,47,27,26,46,60,35,41,69,49,28,103,63,64,71,136,201,131,139,214,144,74,19,43,69,50,157,252,29,55,69,39,
+14,10,254,216,17,18,27,48,68,41,81,198,1,240,68,98,63,30,28,62,100,73,65,92,59,28,30,62,93,0,1,0,16,0,0,2,216,
+5,77,0,11,0,42,64,20,9,9,7,11,133,0,4,0,2,2,0,10,2,205,7,5,3,15,0,21,0,63,63,198,51,237,50,1,47,51,47,17,51,
+16,237,50,50,47,49,48,51,17,35,17,51,17,33,17,51,17,35,17,168,152,152,1,152,152,152,2,253,1,41,1,39,254,217,
+254,215,253,3,0,0,1,0,120,254,81,4,219,4,38,0,42,0,47,64,24,21,42,133,24,34,135,33,33,13,133,10,37,199,28,28,
+0,5,22,11,15,33,16,206,5,0,47,237,206,63,51,18,57,63,237,1,47,237,51,47,237,47,237,50,49,48,37,14,3,35,34,46,
+2,53,17,33,17,20,22,51,50,62,2,53,17,33,17,20,7,6,33,32,39,38,53,53,5,22,22,51,50,62,2,53,3,68,36,73,84,100,
+64,84,133,93,49,1,153,74,67,35,61,45,25,1,151,130,130,254,189,254,210,118,119,1,141,8,82,69,33,58,43,25,207,
+41,61,41,21,50,101,154,105,2,97,253,251,100,84,25,59,99,74,1,188,252,3,217,127,128,100,99,154,54,45,54,53,21,
+50,81,59,0,2,0,89,255,231,4,254,5,186,0,28,0,48,0,49,64,25,7,216,11,6,6,0,39,137,19,29,137,0,44,189,11,24,14,
+14,6,34,189,24,25,6,6,0,63,63,237,18,57,47,18,57,237,1,47,237,47,237,18,57,47,57,237,49,48,19,52,62,2,55,55,
+33,7,6,6,7,54,54,51,50,30,2,21,20,14,2,35,34,46,2,37,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,89,52,102,150,
+98,92,1,197,124,136,177,54,58,127,81,103,171,124,69,79,147,208,129,166,237,152,71,1,152,32,56,75,44,39,69,51,
+29,30,53,71,41,42,73,54,31,2,49,86,198,210,214,102,95,126,139,225,88,46,44,66,126,185,118,119,188,131,70,76,
+148,219,65,59,94,66,35,30,61,91,61,62,95,63,32,31,61,90,0,2,0,88,0,0,4,253,5,211,0,28,0,48,0,49,64,25,7,216,
+11,6,6,0,39,137,19,29,137,0,44,189,11,24,14,14,7,34,189,24,1,7,21,0,63,63,237,18,57,47,18,57,237,1,47,237,47,
+237,18,57,47,57,237,49,48,1,20,14,2,7,7,33,55,54,54,55,6,6,35,34,46,2,53,52,62,2,51,50,30,2,5,52,46,2,35,34,
+14,2,21,20,30,2,51,50,62,2,4,253,52,102,150,98,92,254,59,124,136,177,54,58,127,81,103,171,124,69,79,147,208,
+129,173,239,148,66,254,104,32,56,76,43,39,69,51,29,30,53,71,41,42,73,54,31,3,137,86,198,210,214,102,95,126,
+139,224,89,46,44,66,126,184,119,118,189,131,70,83,153,217,55,59,94,66,35,30,61,91,61,62,95,63,32,31,61,90,0,
+255,255,0,70,0,0,3,86,5,186,2,6,2,187,0,0,255,255,0,120,255,231,2,248,5,186,2,6,2,193,0,0,255,255,0,138,0,0,2,
+33,5,186,2,6,0,76,0,0,0,2,0,0,0,0,5,36,4,112,0,7,0,10,0,51,64,26,5,4,9,10,9,8,3,3,7,217,6,2,217,3,1,202,9,4,
+10,10,3,4,9,7,3,21,0,63,51,63,18,57,47,18,57,236,1,47,236,47,236,18,23,57,17,51,51,49,48,37,33,7,33,1,33,1,33,
+11,2,3,75,254,135,56,254,102,1,184,1,180,1,184,254,93,128,115,115,178,178,4,112,251,144,1,183,1,117,254,139,0,
+0,3,0,148,0,0,5,46,4,112,0,20,0,29,0,38,0,67,64,40,21,30,217,11,14,20,25,34,217,6,14,11,21,199,47,38,111,38,
+175,38,191,38,4,47,38,1,38,38,0,30,202,20,21,48,29,1,29,201,0,9,0,63,237,93,63,237,18,57,47,93,113,237,57,1,
+47,51,237,50,47,18,57,237,50,49,48,19,33,50,30,2,21,20,14,2,7,22,22,21,20,14,2,35,33,1,51,50,54,53,52,38,35,
+35,17,51,50,54,53,52,38,35,35,148,2,225,73,137,107,64,32,56,76,43,138,129,67,127,186,119,253,89,1,162,149,75,
+66,66,73,151,194,79,69,68,82,192,4,112,31,68,108,76,51,81,62,43,12,29,143,109,81,121,81,40,2,185,49,48,45,47,
+253,147,56,52,42,52,0,1,0,90,255,232,4,229,4,136,0,37,0,45,64,23,29,217,10,21,221,20,20,37,221,0,37,21,37,21,
+5,26,204,15,10,34,204,5,22,0,63,237,63,237,18,57,57,47,47,1,47,237,51,47,237,47,237,49,48,1,14,3,35,34,46,2,
+53,52,62,2,51,50,30,2,23,5,46,3,35,34,6,21,20,30,2,51,50,54,55,4,229,27,100,143,183,111,138,222,156,83,81,154,
+225,144,114,176,133,93,32,254,138,6,28,43,57,34,94,98,25,47,68,43,85,87,19,1,115,106,150,95,44,77,151,222,145,
+142,220,150,77,45,89,135,90,84,30,56,43,26,157,142,90,120,70,29,109,106,0,2,0,148,0,0,5,29,4,112,0,12,0,25,0,
+28,64,14,14,217,12,20,217,6,14,203,12,21,13,203,0,9,0,63,237,63,237,1,47,237,47,237,49,48,19,33,50,30,2,21,20,
+14,2,35,33,1,17,51,50,62,2,53,52,46,2,35,148,2,67,157,221,140,64,79,150,216,137,253,189,1,162,111,56,81,52,25,
+34,58,79,45,4,112,85,150,207,122,151,216,139,66,3,90,253,188,30,67,110,80,86,113,67,27,0,1,0,148,0,0,4,143,4,
+112,0,11,0,75,64,46,64,4,1,4,8,217,11,6,6,9,11,2,2,9,4,201,15,7,31,7,159,7,3,47,7,175,7,191,7,3,64,7,192,7,2,
+7,7,0,8,203,11,21,3,202,0,9,0,63,237,63,237,18,57,47,113,93,114,237,1,47,51,47,47,18,57,47,16,237,50,0,93,49,
+48,19,33,17,33,21,33,21,33,21,33,17,33,148,3,233,253,185,2,27,253,229,2,89,252,5,4,112,254,248,159,252,181,
+254,232,0,0,1,0,148,0,0,4,92,4,112,0,9,0,55,64,31,4,8,218,9,6,6,1,9,1,4,202,47,7,1,32,7,1,48,7,64,7,2,7,7,0,9,
+21,3,203,0,9,0,63,236,63,18,57,47,93,113,93,236,1,47,47,18,57,47,16,236,50,49,48,19,33,17,33,21,33,17,33,17,
+33,148,3,200,253,218,1,206,254,50,254,94,4,112,254,238,168,254,250,254,80,0,0,1,0,90,255,232,5,69,4,136,0,39,
+0,65,64,37,63,0,79,0,175,0,3,0,0,3,30,217,12,23,214,22,22,38,221,3,23,0,202,191,1,1,1,1,8,25,203,17,10,35,203,
+8,22,0,63,236,63,236,18,57,47,93,236,204,1,47,236,51,47,236,47,236,18,57,47,0,93,49,48,1,17,33,17,14,3,35,32,
+39,38,17,52,62,2,51,50,30,2,23,5,38,35,34,14,2,21,20,30,2,51,50,54,55,53,2,239,2,86,80,146,145,151,87,254,176,
+157,157,87,169,248,161,136,196,136,85,24,254,108,41,143,54,87,62,33,35,65,93,57,55,112,54,1,143,1,4,254,14,55,
+71,42,17,168,167,1,0,135,220,154,84,50,91,127,78,64,133,37,76,117,81,89,122,77,34,23,31,95,0,0,1,0,148,0,0,5,
+72,4,112,0,11,0,45,64,25,4,8,217,7,3,11,217,0,3,206,47,10,111,10,127,10,3,10,10,5,1,9,8,0,21,0,63,51,63,51,57,
+47,93,236,1,47,236,50,47,236,50,49,48,51,17,33,17,33,17,33,17,33,17,33,17,148,1,162,1,112,1,162,254,94,254,
+144,4,112,254,126,1,130,251,144,1,181,254,75,0,1,0,148,0,0,2,54,4,112,0,3,0,16,182,3,217,0,1,9,0,21,0,63,63,1,
+47,237,49,48,51,17,33,17,148,1,162,4,112,251,144,0,0,1,0,26,255,232,4,26,4,112,0,21,0,31,64,15,13,214,12,21,
+217,2,13,13,0,18,204,7,22,0,9,0,63,63,237,18,57,47,1,47,237,47,237,49,48,1,33,17,20,14,2,35,34,46,2,39,37,20,
+30,2,51,50,54,53,2,120,1,162,71,131,186,116,130,189,125,67,9,1,143,14,26,38,25,54,50,4,112,253,108,137,190,
+119,54,51,102,154,102,45,49,64,38,15,79,78,0,1,0,148,0,0,5,197,4,112,0,11,0,44,64,22,2,10,217,8,5,6,11,3,7,
+218,4,6,2,5,8,3,7,11,21,3,0,9,0,63,50,63,51,23,57,1,47,51,237,50,47,18,57,57,237,50,49,48,19,33,17,1,33,1,1,
+33,3,7,17,33,148,1,162,1,129,1,251,254,91,1,184,254,40,252,187,254,94,4,112,254,93,1,163,254,82,253,62,1,191,
+184,254,249,0,1,0,148,0,0,4,128,4,112,0,5,0,22,64,10,2,217,5,3,2,206,5,21,0,9,0,63,63,237,1,47,47,237,49,48,
+19,33,17,33,17,33,148,1,162,2,74,252,20,4,112,252,201,254,199,0,0,1,0,148,0,0,6,31,4,112,0,12,0,50,64,25,9,8,
+2,1,2,3,3,5,11,220,12,6,220,5,7,10,2,10,6,9,12,21,3,0,9,0,63,50,63,51,51,57,57,17,51,1,47,237,47,237,18,23,57,
+17,51,51,49,48,19,33,19,19,33,17,33,17,3,33,3,17,33,148,2,14,185,183,2,13,254,162,225,254,244,226,254,162,4,
+112,253,106,2,150,251,144,3,48,252,208,3,48,252,208,0,1,0,148,0,0,5,72,4,112,0,9,0,34,64,16,1,8,214,9,6,2,214,
+5,7,2,6,9,21,3,0,9,0,63,50,63,51,57,57,1,47,237,50,47,237,50,49,48,19,33,1,17,33,17,33,1,17,33,148,1,134,1,
+166,1,136,254,120,254,92,254,120,4,112,253,205,2,51,251,144,2,47,253,209,0,0,2,0,90,255,232,5,62,4,136,0,19,0,
+39,0,28,64,14,30,217,10,20,217,0,25,204,15,22,35,204,5,10,0,63,237,63,237,1,47,237,47,237,49,48,19,52,62,2,51,
+50,30,2,21,20,14,2,35,34,46,2,37,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,90,85,160,232,146,151,234,160,84,79,
+155,230,150,144,236,167,91,1,162,30,54,76,47,50,78,53,28,29,55,78,49,45,75,55,30,2,55,141,220,152,80,79,149,
+217,138,143,224,154,80,70,146,223,152,83,115,72,33,31,73,122,91,76,110,71,34,33,73,116,0,2,0,148,0,0,4,183,4,
+112,0,12,0,21,0,42,64,23,13,11,217,12,17,217,4,13,202,160,10,176,10,2,10,10,0,12,21,21,202,0,9,0,63,236,63,18,
+57,47,93,236,1,47,236,47,236,50,49,48,19,33,50,22,21,20,14,2,43,1,17,33,1,51,50,54,53,52,38,43,1,148,2,136,
+205,206,58,115,174,115,179,254,94,1,162,89,58,76,65,54,104,4,112,190,179,90,143,99,53,254,130,2,130,58,57,57,
+62,0,0,2,0,90,255,91,5,97,4,136,0,32,0,59,0,63,64,34,48,40,43,42,4,10,26,15,21,3,20,0,20,50,217,10,33,217,0,
+15,48,28,43,43,5,38,204,21,28,22,55,204,5,10,0,63,237,63,198,237,18,57,47,18,57,57,1,47,237,47,237,51,17,18,
+23,57,18,23,57,49,48,19,52,62,2,51,50,30,2,21,20,14,2,7,30,3,23,7,46,3,39,6,35,34,46,2,37,20,30,2,51,50,55,38,
+39,55,30,3,23,54,53,52,46,2,35,34,14,2,90,85,160,232,146,151,234,160,84,24,39,48,25,26,44,40,40,21,119,42,78,
+67,54,18,116,155,144,236,167,91,1,162,30,54,76,47,29,26,47,87,77,22,45,45,47,26,26,29,55,78,49,45,75,55,30,2,
+55,141,220,152,80,79,149,217,138,86,134,103,73,25,24,35,26,19,8,209,18,48,49,48,20,42,70,146,223,152,83,115,
+72,33,6,47,41,137,1,20,30,39,19,72,123,76,110,71,34,33,73,116,0,2,0,148,0,0,5,111,4,112,0,24,0,37,0,61,64,33,
+48,37,1,9,0,16,210,15,6,6,15,25,24,217,0,9,25,199,96,23,112,23,2,23,23,0,37,200,1,9,16,0,21,0,63,51,63,236,18,
+57,47,93,236,57,1,47,236,50,47,51,47,16,236,18,57,0,93,49,48,51,17,33,32,23,22,21,20,6,7,30,3,23,19,33,3,46,3,
+43,1,25,1,51,50,62,2,53,52,46,2,43,1,148,2,183,1,6,95,96,156,142,45,65,49,37,15,182,254,53,194,19,34,36,41,24,
+18,135,54,68,40,15,16,40,66,49,141,4,112,92,93,135,131,166,28,13,36,43,50,27,254,190,1,84,33,43,25,10,254,61,
+2,164,17,30,41,24,27,40,27,14,0,1,0,66,255,232,4,178,4,136,0,54,0,168,64,117,40,15,12,42,4,45,18,27,218,26,26,
+5,30,18,8,214,45,0,218,54,54,35,214,18,54,40,1,150,12,1,21,42,1,40,15,12,42,4,5,30,8,35,23,37,0,1,52,0,132,0,
+148,0,3,211,0,1,48,0,64,0,2,0,0,16,0,32,0,160,0,176,0,224,0,6,0,50,47,27,63,27,79,27,111,27,4,15,27,31,27,47,
+27,191,27,207,27,223,27,6,76,27,1,25,27,1,121,27,1,27,23,5,200,50,22,30,199,23,10,0,63,237,63,237,17,51,93,
+113,93,93,113,17,51,93,113,93,93,113,18,57,57,17,18,23,57,93,93,93,1,47,237,51,47,237,47,237,18,57,57,51,47,
+237,17,18,23,57,49,48,1,30,3,51,50,54,53,52,46,2,39,46,3,53,52,62,2,51,50,22,23,5,38,38,35,34,14,2,21,20,30,2,
+23,22,23,22,22,21,20,14,2,35,32,39,38,39,1,195,5,25,46,72,51,76,74,17,49,89,73,125,176,111,50,63,131,202,139,
+241,253,24,254,131,13,73,70,38,50,30,13,6,29,59,53,247,108,108,97,74,142,206,132,254,191,122,122,17,1,146,39,
+67,49,28,61,39,22,33,28,26,15,26,71,91,112,69,71,126,95,56,178,171,20,67,70,12,21,28,16,12,21,19,19,10,46,53,
+53,150,94,88,147,105,58,121,121,163,0,1,0,25,0,0,4,157,4,112,0,7,0,32,64,15,2,2,4,217,5,7,7,5,5,21,3,7,206,0,
+9,0,63,237,50,63,1,47,51,47,16,237,50,47,49,48,19,33,17,33,17,33,17,33,25,4,132,254,143,254,94,254,143,4,112,
+254,199,252,201,3,55,0,0,1,0,142,255,232,5,66,4,112,0,20,0,27,64,13,14,217,11,20,217,2,0,12,9,17,204,6,22,0,
+63,237,63,51,1,47,237,47,237,49,48,1,33,17,20,7,6,33,34,46,2,53,17,33,17,20,22,51,50,54,53,3,160,1,162,139,
+140,254,189,161,228,145,68,1,162,96,88,88,96,4,112,253,110,222,140,140,72,131,185,114,2,146,253,90,99,95,94,
+100,0,1,0,0,0,0,5,36,4,112,0,6,0,38,64,18,3,2,6,6,1,5,217,4,0,217,1,6,3,0,4,9,3,21,0,63,63,51,18,57,1,47,237,
+47,237,18,57,17,51,51,49,48,1,33,1,33,1,33,19,3,133,1,159,254,72,254,76,254,72,1,168,238,4,112,251,144,4,112,
+252,252,0,1,255,255,0,0,6,223,4,112,0,12,0,62,64,31,12,11,2,4,3,10,9,8,5,5,10,2,3,0,6,214,7,1,214,0,5,2,2,10,
+9,12,21,6,3,0,9,0,63,50,50,63,51,57,57,17,51,1,47,237,47,237,18,23,57,17,51,51,17,51,51,17,51,51,49,48,3,33,
+19,19,33,19,19,33,1,33,3,3,33,1,1,138,122,173,1,127,178,118,1,136,254,250,254,101,206,205,254,101,4,112,253,
+151,2,105,253,151,2,105,251,144,2,203,253,53,0,1,0,2,0,0,5,58,4,112,0,11,0,70,64,36,1,1,9,210,10,2,8,5,8,11,3,
+10,6,0,0,10,3,3,7,210,6,4,4,6,5,11,2,11,8,3,7,10,21,3,0,9,0,63,50,63,51,23,57,17,51,1,47,51,47,16,237,50,47,
+47,51,47,17,18,23,57,17,51,16,237,50,47,49,48,19,33,19,19,33,1,1,33,3,3,33,1,39,1,198,183,177,1,194,254,142,1,
+149,254,49,206,207,254,52,1,154,4,112,254,198,1,58,253,218,253,182,1,74,254,182,2,80,0,0,1,255,252,0,0,5,66,4,
+112,0,8,0,42,64,20,8,8,2,5,5,2,2,0,3,210,4,1,210,0,2,7,21,3,0,9,0,63,50,63,57,1,47,237,47,237,18,57,17,51,47,
+17,51,47,49,48,3,33,19,19,33,1,17,33,17,4,1,200,220,220,1,198,254,46,254,94,4,112,254,139,1,117,253,108,254,
+36,1,220,0,1,0,34,0,0,4,158,4,112,0,9,0,42,64,20,3,8,6,4,9,9,6,2,2,4,7,3,202,6,21,2,9,202,0,9,0,63,237,57,63,
+237,57,1,47,51,47,47,51,47,17,18,57,57,49,48,19,33,21,1,33,17,33,17,1,33,97,4,37,253,151,2,129,251,132,2,101,
+253,218,4,112,247,253,147,254,244,1,0,2,104,0,2,255,191,0,0,6,135,4,112,0,15,0,19,0,109,64,65,1,19,17,12,220,
+5,16,19,9,7,9,7,0,10,3,3,10,15,217,0,64,5,1,5,201,15,8,31,8,2,31,8,1,47,8,175,8,191,8,3,64,8,192,8,2,8,8,1,9,
+203,12,21,14,202,19,1,16,16,0,4,202,1,9,0,21,0,63,63,237,18,57,47,18,57,237,63,237,18,57,47,113,93,113,114,
+237,93,1,47,237,47,51,47,17,18,57,57,47,47,57,57,51,237,50,17,51,49,48,35,1,33,17,33,21,33,21,33,21,33,17,33,
+53,33,7,19,51,17,35,65,2,59,4,120,253,246,1,222,254,34,2,31,252,123,254,192,105,223,204,30,4,112,254,248,159,
+252,180,254,231,235,235,1,240,1,139,0,0,2,0,90,255,233,7,5,4,136,0,28,0,46,0,106,64,64,19,2,220,24,39,11,28,
+26,28,26,0,29,217,11,22,22,0,64,24,1,24,201,15,27,31,27,2,31,27,1,47,27,175,27,191,27,3,64,27,192,27,2,3,2,19,
+20,27,27,2,23,202,20,9,42,204,16,10,34,204,6,22,28,203,2,0,47,237,63,237,63,237,63,237,18,57,47,18,57,18,57,
+113,93,113,114,237,93,1,47,51,47,47,237,18,57,57,47,47,18,57,51,237,50,49,48,1,17,33,53,6,6,35,34,46,2,53,52,
+62,2,51,50,22,23,53,33,17,33,21,33,21,33,21,1,20,30,2,51,50,62,2,53,52,38,35,34,14,2,7,5,252,124,46,151,97,
+123,192,130,68,73,132,186,113,99,150,54,3,114,253,246,1,222,254,34,253,19,26,47,67,41,44,68,47,24,99,86,39,66,
+48,26,1,24,254,232,76,48,51,88,158,218,130,133,217,154,85,57,45,78,254,248,159,252,181,1,31,82,115,73,33,32,
+73,122,90,152,139,33,73,116,0,1,0,36,0,0,4,128,4,112,0,13,0,57,64,29,4,4,2,6,217,9,13,9,11,11,9,7,2,5,13,10,4,
+3,11,3,11,3,0,6,206,9,21,0,9,0,63,63,237,18,57,57,47,47,18,23,57,1,47,47,51,47,17,51,16,237,50,50,47,49,48,19,
+33,17,37,21,5,17,33,17,33,17,7,53,55,148,1,162,1,15,254,241,2,74,252,20,112,112,4,112,254,196,166,234,166,254,
+239,254,199,1,92,69,233,69,0,3,0,51,255,175,5,82,4,169,0,23,0,34,0,45,0,69,64,41,7,43,28,44,27,19,22,7,0,40,
+214,12,9,9,12,24,214,0,21,21,0,7,10,28,43,27,44,22,19,8,5,35,203,20,17,22,30,203,8,5,10,0,63,198,237,63,198,
+237,18,23,57,1,47,51,47,16,237,47,51,47,16,237,18,23,57,49,48,19,52,62,2,51,50,23,55,23,7,22,21,20,14,2,35,34,
+39,7,39,55,38,37,20,22,23,1,38,35,34,14,2,19,50,62,2,53,52,38,39,1,22,90,85,160,232,146,232,149,129,139,119,
+99,78,155,230,151,227,160,149,141,141,102,1,146,3,2,1,107,59,88,48,82,58,33,223,53,83,58,31,2,2,254,151,58,2,
+55,141,220,152,80,90,123,146,115,140,215,143,224,154,80,87,144,148,136,151,213,23,44,20,1,93,53,35,75,120,254,
+114,32,76,126,93,19,35,17,254,164,50,0,0,2,0,148,0,0,4,183,4,112,0,14,0,23,0,50,64,27,15,2,13,217,14,19,217,6,
+15,202,12,23,202,2,175,2,191,2,2,12,2,12,2,14,21,0,9,0,63,63,57,57,47,47,93,16,236,16,236,1,47,236,47,236,50,
+50,49,48,19,33,21,51,50,22,21,20,14,2,43,1,21,33,1,51,50,54,53,52,38,43,1,148,1,162,230,205,206,58,115,174,
+115,179,254,94,1,162,89,58,76,65,54,104,4,112,180,190,179,90,143,99,53,202,1,206,58,57,57,62,0,2,0,36,0,0,5,
+29,4,112,0,16,0,33,0,57,64,29,20,20,18,22,217,12,16,12,14,14,12,28,217,6,21,14,198,18,15,15,0,22,203,12,21,17,
+203,0,9,0,63,237,63,237,18,57,47,51,237,50,1,47,237,47,51,47,17,51,16,237,50,50,47,49,48,19,33,50,30,2,21,20,
+14,2,35,33,17,35,53,51,37,21,51,21,35,21,51,50,62,2,53,52,46,2,35,148,2,67,157,221,140,64,79,150,216,137,253,
+189,112,112,1,152,161,161,131,56,81,52,25,34,58,79,45,4,112,85,150,207,122,151,216,139,66,1,217,200,185,185,
+200,195,30,67,110,80,86,113,67,27,0,1,0,140,255,232,5,50,4,136,0,45,0,61,64,31,21,41,19,8,19,8,19,0,28,217,29,
+40,40,15,217,0,41,20,19,19,5,24,203,35,10,29,21,12,204,5,22,0,63,236,63,63,236,18,57,47,51,51,1,47,236,51,47,
+47,236,18,57,57,47,47,17,57,57,49,48,1,20,14,2,35,34,38,39,19,30,1,51,50,54,53,52,38,43,1,53,55,46,1,35,34,6,
+21,17,33,17,52,62,2,51,50,30,2,23,7,30,3,5,50,69,126,178,109,75,139,54,81,20,65,31,71,64,83,71,75,150,20,66,
+45,72,72,254,94,75,145,211,136,108,170,133,101,39,225,69,110,77,41,1,100,89,141,98,52,15,17,1,21,11,10,66,48,
+54,64,214,123,20,29,95,94,253,75,2,142,138,193,121,54,34,72,113,79,179,8,55,86,112,0,255,255,0,0,0,0,5,36,6,
+35,2,38,2,202,0,0,1,7,0,67,1,56,0,80,0,21,180,2,14,11,38,2,184,255,167,180,11,13,3,6,37,1,43,53,0,43,53,0,255,
+255,0,0,0,0,5,36,6,35,2,38,2,202,0,0,1,7,0,141,1,73,0,80,0,19,64,11,2,14,11,38,2,93,14,12,3,6,37,1,43,53,0,43,
+53,0,255,255,0,0,0,0,5,36,6,19,2,38,2,202,0,0,1,7,0,216,1,57,0,77,0,21,180,2,17,11,38,2,184,255,253,180,17,13,
+3,6,37,1,43,53,0,43,53,0,255,255,0,0,0,0,5,36,6,0,2,38,2,202,0,0,1,7,0,217,1,57,0,70,0,21,180,2,17,11,38,2,
+184,255,252,180,27,14,3,6,37,1,43,53,0,43,53,0,255,255,0,0,0,0,5,36,5,236,2,38,2,202,0,0,1,7,0,142,1,57,0,70,
+0,25,182,3,2,18,11,38,3,2,184,255,253,180,14,17,3,6,37,1,43,53,53,0,43,53,53,0,255,255,0,0,0,0,5,36,6,32,2,38,
+2,202,0,0,0,7,0,221,1,58,255,180,255,255,0,90,254,81,4,229,4,136,2,38,2,204,0,0,0,7,0,222,1,102,0,0,255,255,0,
+148,0,0,4,143,6,34,2,38,2,206,0,0,1,7,0,67,1,37,0,79,0,21,180,1,15,11,38,1,184,255,148,180,12,14,11,10,37,1,
+43,53,0,43,53,0,255,255,0,148,0,0,4,143,6,35,2,38,2,206,0,0,1,7,0,141,1,57,0,80,0,19,64,11,1,15,11,38,1,77,15,
+13,11,10,37,1,43,53,0,43,53,0,255,255,0,148,0,0,4,143,6,21,2,38,2,206,0,0,1,7,0,216,1,46,0,79,0,21,180,1,18,
+11,38,1,184,255,243,180,18,14,11,10,37,1,43,53,0,43,53,0,255,255,0,148,0,0,4,143,5,236,2,38,2,206,0,0,1,7,0,
+142,1,46,0,70,0,25,182,2,1,19,11,38,2,1,184,255,242,180,15,18,11,10,37,1,43,53,53,0,43,53,53,0,255,255,255,
+254,0,0,2,54,6,36,2,38,2,210,0,0,1,6,0,67,253,81,0,21,180,1,7,11,38,1,184,255,153,180,4,6,1,3,37,1,43,53,0,43,
+53,0,255,255,0,148,0,0,2,206,6,36,2,38,2,210,0,0,1,6,0,141,37,81,0,19,64,11,1,7,11,38,1,102,7,5,1,3,37,1,43,
+53,0,43,53,0,255,255,255,243,0,0,2,215,6,19,2,38,2,210,0,0,1,6,0,216,15,77,0,19,64,11,1,10,11,38,1,0,10,6,1,3,
+37,1,43,53,0,43,53,0,255,255,0,14,0,0,2,189,5,236,2,38,2,210,0,0,1,6,0,142,16,70,0,23,64,13,2,1,11,11,38,2,1,
+0,7,10,1,3,37,1,43,53,53,0,43,53,53,0,255,255,0,148,0,0,5,72,6,0,2,38,2,215,0,0,1,7,0,217,1,145,0,70,0,21,180,
+1,16,11,38,1,184,255,248,180,26,13,9,5,37,1,43,53,0,43,53,0,255,255,0,90,255,232,5,62,6,36,2,38,2,216,0,0,1,7,
+0,67,1,110,0,81,0,21,180,2,43,11,38,2,184,255,163,180,40,42,0,10,37,1,43,53,0,43,53,0,255,255,0,90,255,232,5,
+62,6,36,2,38,2,216,0,0,1,7,0,141,1,136,0,81,0,19,64,11,2,43,11,38,2,98,43,41,0,10,37,1,43,53,0,43,53,0,255,
+255,0,90,255,232,5,62,6,21,2,38,2,216,0,0,1,7,0,216,1,119,0,79,0,19,64,11,2,46,11,38,2,1,46,42,0,10,37,1,43,
+53,0,43,53,0,255,255,0,90,255,232,5,62,6,0,2,38,2,216,0,0,1,7,0,217,1,125,0,70,0,19,64,11,2,46,11,38,2,6,56,
+43,0,10,37,1,43,53,0,43,53,0,255,255,0,90,255,232,5,62,5,236,2,38,2,216,0,0,1,7,0,142,1,119,0,70,0,23,64,13,3,
+2,47,11,38,3,2,0,43,46,0,10,37,1,43,53,53,0,43,53,53,0,255,255,0,142,255,232,5,66,6,36,2,38,2,222,0,0,1,7,0,
+67,1,129,0,81,0,21,180,1,24,11,38,1,184,255,154,180,21,23,12,2,37,1,43,53,0,43,53,0,255,255,0,142,255,232,5,
+66,6,36,2,38,2,222,0,0,1,7,0,141,1,170,0,81,0,19,64,11,1,24,11,38,1,104,24,22,12,2,37,1,43,53,0,43,53,0,255,
+255,0,142,255,232,5,66,6,21,2,38,2,222,0,0,1,7,0,216,1,141,0,79,0,21,180,1,27,11,38,1,184,255,251,180,27,23,
+12,2,37,1,43,53,0,43,53,0,255,255,0,142,255,232,5,66,5,236,2,38,2,222,0,0,1,7,0,142,1,145,0,70,0,25,182,2,1,
+28,11,38,2,1,184,255,255,180,24,27,12,2,37,1,43,53,53,0,43,53,53,0,255,255,255,252,0,0,5,66,6,36,2,38,2,226,0,
+0,1,7,0,141,1,116,0,81,0,19,64,11,1,12,11,38,1,123,12,10,0,4,37,1,43,53,0,43,53,0,255,255,0,0,0,0,5,36,5,236,
+2,38,2,202,0,0,1,7,0,218,1,62,0,70,0,19,64,11,2,14,11,38,2,1,14,13,3,6,37,1,43,53,0,43,53,0,255,255,0,0,0,0,5,
+36,6,29,2,38,2,202,0,0,1,7,0,219,1,60,0,74,0,19,64,11,2,16,11,38,2,0,19,12,3,6,37,1,43,53,0,43,53,0,255,255,0,
+0,254,65,5,44,4,112,2,38,2,202,0,0,0,7,0,224,2,195,0,0,255,255,0,90,255,232,4,229,6,36,2,38,2,204,0,0,1,7,0,
+141,1,115,0,81,0,19,64,11,1,41,11,38,1,121,41,39,10,0,37,1,43,53,0,43,53,0,255,255,0,90,255,232,4,229,6,21,2,
+38,2,204,0,0,1,7,0,225,1,96,0,79,0,19,64,11,1,39,11,38,1,22,40,44,10,0,37,1,43,53,0,43,53,0,255,255,0,90,255,
+232,5,69,6,9,2,38,2,208,0,0,1,7,0,220,1,150,0,49,0,19,64,11,1,43,11,38,1,27,43,42,12,3,37,1,43,53,0,43,53,0,
+255,255,0,148,0,0,5,29,6,21,2,38,2,205,0,0,1,7,0,225,1,73,0,79,0,21,180,2,27,11,38,2,184,255,199,180,28,32,12,
+6,37,1,43,53,0,43,53,0,255,255,0,36,0,0,5,29,4,112,2,2,2,233,0,0,255,255,0,148,0,0,4,143,5,236,2,38,2,206,0,0,
+1,7,0,218,1,46,0,70,0,21,180,1,15,11,38,1,184,255,242,180,15,14,11,10,37,1,43,53,0,43,53,0,255,255,0,148,0,0,
+4,143,6,28,2,38,2,206,0,0,1,7,0,219,1,63,0,73,0,19,64,11,1,17,11,38,1,3,20,13,11,10,37,1,43,53,0,43,53,0,255,
+255,0,148,0,0,4,143,6,10,2,38,2,206,0,0,1,7,0,220,1,70,0,50,0,19,64,11,1,15,11,38,1,9,15,14,11,10,37,1,43,53,
+0,43,53,0,255,255,0,148,254,65,4,143,4,112,2,38,2,206,0,0,0,7,0,224,1,230,0,0,255,255,0,148,0,0,4,143,6,21,2,
+38,2,206,0,0,1,7,0,225,1,46,0,79,0,21,180,1,13,11,38,1,184,255,243,180,14,18,11,10,37,1,43,53,0,43,53,0,255,
+255,0,90,255,232,5,69,6,28,2,38,2,208,0,0,1,7,0,219,1,145,0,73,0,19,64,11,1,45,11,38,1,23,48,41,12,3,37,1,43,
+53,0,43,53,0,255,255,0,90,254,81,5,69,4,136,2,38,2,208,0,0,0,7,0,222,1,168,0,0,255,255,0,90,255,232,4,229,6,9,
+2,38,2,204,0,0,1,7,0,220,1,103,0,49,0,19,64,11,1,41,11,38,1,28,41,40,10,0,37,1,43,53,0,43,53,0,255,255,0,148,
+0,0,5,72,6,21,2,38,2,209,0,0,1,7,0,216,1,151,0,79,0,21,180,1,18,11,38,1,184,255,255,180,18,14,1,7,37,1,43,53,
+0,43,53,0,0,2,0,36,0,0,5,184,4,112,0,19,0,23,0,102,64,59,20,8,16,217,15,13,13,11,15,23,7,19,217,0,4,0,2,2,0,
+18,203,23,176,23,1,0,23,16,23,32,23,112,23,4,22,14,2,198,3,11,7,3,0,3,16,3,32,3,3,23,3,23,3,9,5,9,16,0,21,0,
+63,51,63,51,57,57,47,47,93,17,51,51,16,236,50,50,93,113,16,236,1,47,51,47,17,51,16,236,50,50,47,51,51,47,16,
+236,50,50,49,48,51,17,35,53,51,53,33,21,33,53,33,21,51,21,35,17,33,17,33,17,1,53,33,21,148,112,112,1,162,1,
+112,1,162,112,112,254,94,254,144,1,112,254,144,3,75,200,93,93,93,93,200,252,181,1,181,254,75,2,198,133,133,0,
+255,255,255,252,0,0,2,206,5,254,2,38,2,210,0,0,1,6,0,217,16,68,0,19,64,11,1,10,11,38,1,0,20,7,1,3,37,1,43,53,
+0,43,53,0,255,255,0,34,0,0,2,169,5,236,2,38,2,210,0,0,1,6,0,218,16,70,0,19,64,11,1,7,11,38,1,0,7,6,1,3,37,1,
+43,53,0,43,53,0,255,255,0,15,0,0,2,186,6,28,2,38,2,210,0,0,1,6,0,219,15,73,0,19,64,11,1,9,11,38,1,0,12,5,1,3,
+37,1,43,53,0,43,53,0,255,255,0,148,254,65,2,156,4,112,2,38,2,210,0,0,0,6,0,224,51,0,255,255,0,148,0,0,2,54,6,
+9,2,38,2,210,0,0,1,6,0,220,13,49,0,21,180,1,7,11,38,1,184,255,253,180,7,6,1,3,37,1,43,53,0,43,53,0,255,255,0,
+148,255,232,6,128,4,112,0,38,2,210,0,0,0,7,2,211,2,102,0,0,255,255,0,26,255,232,4,180,6,21,2,38,2,211,0,0,1,7,
+0,216,1,236,0,79,0,21,180,1,28,11,38,1,184,1,40,180,28,24,12,2,37,1,43,53,0,43,53,0,255,255,0,148,254,81,5,
+197,4,112,2,38,2,212,0,0,1,7,2,152,1,168,0,0,0,14,185,0,1,255,188,180,25,18,11,6,37,1,43,53,255,255,0,148,0,0,
+4,128,6,35,2,38,2,213,0,0,1,6,0,141,94,80,0,21,180,1,9,11,38,1,184,255,122,180,9,7,5,4,37,1,43,53,0,43,53,0,
+255,255,0,148,254,81,4,128,4,112,2,38,2,213,0,0,1,7,2,152,1,33,0,0,0,14,185,0,1,255,216,180,19,12,5,4,37,1,43,
+53,255,255,0,148,0,0,4,128,4,112,2,34,2,213,0,0,1,3,1,81,2,99,4,233,0,20,64,11,1,6,251,6,6,1,1,37,1,6,9,0,63,
+53,1,43,17,53,255,255,0,148,0,0,4,128,4,112,2,38,2,213,0,0,1,7,0,220,2,100,253,86,0,29,64,18,1,6,230,6,6,1,1,
+37,1,143,8,1,64,8,112,8,2,8,0,47,93,93,53,1,43,17,53,0,255,255,0,148,0,0,5,72,6,36,2,38,2,215,0,0,1,7,0,141,1,
+130,0,81,0,19,64,11,1,13,11,38,1,58,13,11,9,5,37,1,43,53,0,43,53,0,255,255,0,148,254,81,5,72,4,112,2,38,2,215,
+0,0,1,7,2,152,1,139,0,0,0,14,185,0,1,255,222,180,23,16,9,5,37,1,43,53,255,255,0,148,0,0,5,72,6,21,2,38,2,215,
+0,0,1,7,0,225,1,140,0,79,0,21,180,1,11,11,38,1,184,255,244,180,12,16,9,5,37,1,43,53,0,43,53,0,0,1,0,148,255,
+232,5,107,4,136,0,38,0,46,64,24,38,38,19,7,217,29,22,18,217,19,2,204,33,22,22,19,12,204,24,10,20,9,19,21,0,63,
+63,63,237,18,57,63,237,1,47,237,50,47,237,18,57,47,49,48,1,22,51,50,62,2,53,52,46,2,35,34,14,2,21,17,33,17,33,
+21,54,51,50,30,2,21,16,7,6,35,34,46,2,39,2,204,46,39,44,64,41,19,22,46,69,47,61,84,51,23,254,94,1,162,108,233,
+105,176,127,72,146,146,191,45,73,65,58,28,1,28,20,28,70,116,89,89,117,70,29,30,62,92,62,253,142,4,112,117,141,
+64,141,225,162,254,182,131,131,6,11,16,11,0,255,255,0,90,255,232,5,62,5,236,2,38,2,216,0,0,1,7,0,218,1,122,0,
+70,0,19,64,11,2,43,11,38,2,3,43,42,0,10,37,1,43,53,0,43,53,0,255,255,0,90,255,232,5,62,6,28,2,38,2,216,0,0,1,
+7,0,219,1,123,0,73,0,19,64,11,2,45,11,38,2,4,48,41,0,10,37,1,43,53,0,43,53,0,255,255,0,90,255,232,5,62,6,34,2,
+38,2,216,0,0,1,7,0,223,1,66,0,79,0,23,64,13,3,2,47,11,38,3,2,98,43,45,0,10,37,1,43,53,53,0,43,53,53,0,255,255,
+0,148,0,0,5,111,6,36,2,38,2,219,0,0,1,7,0,141,1,131,0,81,0,19,64,11,2,41,11,38,2,39,41,39,1,15,37,1,43,53,0,
+43,53,0,255,255,0,148,254,81,5,111,4,112,2,38,2,219,0,0,1,7,2,152,1,144,0,0,0,14,185,0,2,255,207,180,51,44,1,
+15,37,1,43,53,255,255,0,148,0,0,5,111,6,21,2,38,2,219,0,0,1,7,0,225,1,89,0,79,0,21,180,2,39,11,38,2,184,255,
+174,180,40,44,1,15,37,1,43,53,0,43,53,0,255,255,0,66,255,232,4,178,6,36,2,38,2,220,0,0,1,7,0,141,1,56,0,81,0,
+19,64,11,1,58,11,38,1,100,58,56,54,45,37,1,43,53,0,43,53,0,255,255,0,66,255,232,4,178,6,21,2,38,2,220,0,0,1,7,
+0,216,1,42,0,79,0,19,64,11,1,61,11,38,1,6,61,57,54,45,37,1,43,53,0,43,53,0,255,255,0,66,254,81,4,178,4,136,2,
+38,2,220,0,0,0,7,0,222,1,54,0,0,255,255,0,66,255,232,4,178,6,21,2,38,2,220,0,0,1,7,0,225,1,50,0,79,0,19,64,11,
+1,56,11,38,1,14,57,61,54,45,37,1,43,53,0,43,53,0,255,255,0,25,254,81,4,157,4,112,2,38,2,221,0,0,1,7,0,222,0,
+252,0,0,0,14,185,0,1,255,226,180,21,14,7,2,37,1,43,53,255,255,0,25,253,170,4,157,4,112,2,38,2,221,0,0,1,7,1,
+81,1,5,0,0,0,0,255,255,0,25,0,0,4,157,6,21,2,38,2,221,0,0,1,7,0,225,1,6,0,79,0,19,64,11,1,9,11,38,1,1,10,14,7,
+2,37,1,43,53,0,43,53,0,0,1,0,25,0,0,4,157,4,112,0,15,0,59,64,29,10,10,8,6,6,12,217,13,15,15,13,3,3,1,13,11,15,
+198,8,0,0,4,13,21,7,3,206,4,9,0,63,237,50,63,18,57,47,51,237,50,1,47,51,51,47,17,51,47,16,237,50,47,50,50,47,
+49,48,19,51,53,33,17,33,17,33,21,51,21,35,17,33,17,35,202,192,254,143,4,132,254,143,192,192,254,94,192,2,93,
+218,1,57,254,199,218,200,254,107,1,149,0,255,255,0,142,255,232,5,66,5,255,2,38,2,222,0,0,1,7,0,217,1,150,0,69,
+0,19,64,11,1,27,11,38,1,3,37,24,12,2,37,1,43,53,0,43,53,0,255,255,0,142,255,232,5,66,5,236,2,38,2,222,0,0,1,7,
+0,218,1,149,0,70,0,19,64,11,1,24,11,38,1,2,24,23,12,2,37,1,43,53,0,43,53,0,255,255,0,142,255,232,5,66,6,30,2,
+38,2,222,0,0,1,7,0,219,1,148,0,75,0,19,64,11,1,26,11,38,1,1,29,22,12,2,37,1,43,53,0,43,53,0,255,255,0,142,255,
+232,5,66,6,178,2,38,2,222,0,0,1,7,0,221,1,149,0,70,0,23,64,13,2,1,24,11,38,2,1,1,27,21,12,2,37,1,43,53,53,0,
+43,53,53,0,255,255,0,142,255,232,5,66,6,33,2,38,2,222,0,0,1,7,0,223,1,99,0,78,0,23,64,13,2,1,28,11,38,2,1,103,
+24,26,12,2,37,1,43,53,53,0,43,53,53,0,255,255,0,142,254,65,5,66,4,112,2,38,2,222,0,0,0,7,0,224,1,218,0,0,255,
+255,255,255,0,0,6,223,6,20,2,38,2,224,0,0,1,7,0,216,2,32,0,78,0,19,64,11,1,19,11,38,1,7,19,15,0,7,37,1,43,53,
+0,43,53,0,255,255,255,255,0,0,6,223,6,34,2,38,2,224,0,0,1,7,0,67,2,0,0,79,0,21,180,1,16,11,38,1,184,255,146,
+180,13,15,0,7,37,1,43,53,0,43,53,0,255,255,255,255,0,0,6,223,6,34,2,38,2,224,0,0,1,7,0,141,2,47,0,79,0,19,64,
+11,1,16,11,38,1,102,16,14,0,7,37,1,43,53,0,43,53,0,255,255,255,255,0,0,6,223,5,236,2,38,2,224,0,0,1,7,0,142,2,
+29,0,70,0,23,64,13,2,1,20,11,38,2,1,3,16,19,0,7,37,1,43,53,53,0,43,53,53,0,255,255,255,252,0,0,5,66,6,21,2,38,
+2,226,0,0,1,7,0,216,1,76,0,79,0,19,64,11,1,15,11,38,1,3,15,11,0,4,37,1,43,53,0,43,53,0,255,255,255,252,0,0,5,
+66,5,236,2,38,2,226,0,0,1,7,0,142,1,75,0,70,0,23,64,13,2,1,16,11,38,2,1,1,12,15,0,4,37,1,43,53,53,0,43,53,53,
+0,255,255,255,252,0,0,5,66,6,34,2,38,2,226,0,0,1,7,0,67,1,30,0,79,0,21,180,1,12,11,38,1,184,255,128,180,9,11,
+0,4,37,1,43,53,0,43,53,0,255,255,0,34,0,0,4,158,6,36,2,38,2,227,0,0,1,7,0,141,1,47,0,81,0,19,64,11,1,13,11,38,
+1,117,13,11,7,5,37,1,43,53,0,43,53,0,255,255,0,34,0,0,4,158,6,8,2,38,2,227,0,0,1,7,0,220,1,12,0,48,0,19,64,11,
+1,13,11,38,1,1,13,12,7,5,37,1,43,53,0,43,53,0,255,255,0,34,0,0,4,158,6,21,2,38,2,227,0,0,1,7,0,225,1,12,0,79,
+0,19,64,11,1,11,11,38,1,2,12,16,7,5,37,1,43,53,0,43,53,0,255,255,0,0,0,0,5,36,7,137,2,38,2,202,0,0,0,39,0,221,
+1,61,255,180,1,7,0,141,1,102,1,182,0,30,178,3,2,17,184,255,255,64,11,17,11,4,5,37,3,2,14,14,12,38,0,43,17,53,
+53,1,43,17,53,53,255,255,255,191,0,0,6,135,6,36,2,38,2,228,0,0,1,7,0,141,2,163,0,81,0,21,180,2,23,11,38,2,184,
+1,38,180,23,21,0,11,37,1,43,53,0,43,53,0,255,255,0,51,255,175,5,82,6,36,2,38,2,231,0,0,1,7,0,141,1,136,0,81,0,
+19,64,11,3,49,11,38,3,107,49,47,21,9,37,1,43,53,0,43,53,0,255,255,0,0,0,0,5,36,4,112,2,6,2,202,0,0,255,255,0,
+148,0,0,5,46,4,112,2,6,2,203,0,0,0,1,0,148,0,0,4,128,4,112,0,5,0,24,64,11,1,1,4,217,5,5,21,3,206,0,9,0,63,237,
+63,1,47,237,50,47,49,48,19,33,17,33,17,33,148,3,236,253,182,254,94,4,112,254,199,252,201,0,0,2,0,0,0,0,5,36,4,
+112,0,3,0,6,0,35,64,17,2,1,5,4,5,6,3,3,0,5,0,1,9,6,202,0,21,0,63,237,63,18,57,1,47,47,23,57,17,51,51,49,48,49,
+1,33,1,1,3,3,1,184,1,180,1,184,254,19,169,169,4,112,251,144,1,5,2,39,253,217,255,255,0,148,0,0,4,143,4,112,2,
+6,2,206,0,0,255,255,0,34,0,0,4,158,4,112,2,6,2,227,0,0,255,255,0,148,0,0,5,72,4,112,2,6,2,209,0,0,0,3,0,90,
+255,232,5,146,4,136,0,19,0,39,0,43,0,52,64,27,79,43,1,43,42,43,42,0,30,214,10,20,214,0,43,201,40,40,5,25,204,
+15,22,35,204,5,10,0,63,236,63,236,18,57,47,236,1,47,236,47,236,18,57,57,47,47,0,93,49,48,19,52,62,2,51,50,30,
+2,21,20,14,2,35,34,46,2,37,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,55,33,21,33,90,91,171,247,156,160,250,172,
+89,83,165,245,162,156,251,178,96,1,142,39,70,100,60,64,101,70,36,38,71,102,63,59,97,71,39,110,1,64,254,192,2,
+55,141,220,152,80,79,149,217,138,143,224,154,80,70,146,223,152,83,115,72,33,31,73,122,91,76,110,71,34,33,73,
+116,48,252,0,255,255,0,148,0,0,2,54,4,112,2,6,2,210,0,0,255,255,0,148,0,0,5,197,4,112,2,6,2,212,0,0,0,1,0,0,0,
+0,5,36,4,112,0,6,0,38,64,18,3,2,6,6,1,5,217,4,0,217,1,6,1,2,9,5,1,21,0,63,51,63,18,57,1,47,237,47,237,18,57,
+17,51,51,49,48,33,33,1,33,1,33,3,1,159,254,97,1,184,1,180,1,184,254,88,238,4,112,251,144,3,4,255,255,0,148,0,
+0,6,31,4,112,2,6,2,214,0,0,255,255,0,148,0,0,5,72,4,112,2,6,2,215,0,0,0,3,0,84,0,0,4,76,4,112,0,3,0,7,0,11,0,
+78,64,47,64,4,1,6,6,9,2,2,9,7,7,8,3,3,8,4,201,15,7,31,7,159,7,3,47,7,175,7,191,7,3,64,7,192,7,2,7,7,0,8,203,
+11,21,3,202,0,9,0,63,236,63,236,18,57,47,113,93,114,236,1,47,51,47,17,51,47,47,51,47,17,51,47,0,93,49,48,19,
+33,17,33,23,33,21,33,7,33,17,33,102,3,212,252,44,44,3,124,252,132,62,3,248,252,8,4,112,254,248,159,252,181,
+254,232,255,255,0,90,255,232,5,62,4,136,2,6,2,216,0,0,0,1,0,148,0,0,5,72,4,112,0,7,0,27,64,13,4,217,3,7,217,0,
+6,206,1,9,4,0,21,0,63,50,63,237,1,47,237,47,237,49,48,51,17,33,17,33,17,33,17,148,4,180,254,94,254,144,4,112,
+251,144,3,55,252,201,255,255,0,148,0,0,4,183,4,112,2,6,2,217,0,0,0,1,0,94,0,0,4,218,4,112,0,11,0,48,64,25,11,
+1,6,3,0,7,0,10,10,0,7,3,2,4,2,7,11,202,8,9,5,1,202,4,21,0,63,237,57,63,237,57,1,47,47,18,23,57,47,47,47,18,23,
+57,49,48,1,1,33,17,33,17,1,1,53,33,17,33,3,165,254,180,2,129,251,132,1,89,254,206,4,37,253,218,2,79,254,189,
+254,244,1,0,1,79,1,42,247,254,248,0,255,255,0,25,0,0,4,157,4,112,2,6,2,221,0,0,255,255,255,252,0,0,5,66,4,112,
+2,6,2,226,0,0,0,3,0,82,255,236,6,40,4,130,0,25,0,36,0,47,0,106,64,64,36,24,13,37,1,12,13,12,13,12,6,31,219,19,
+42,219,6,47,26,201,24,1,24,96,24,112,24,128,24,3,144,24,160,24,176,24,3,0,24,16,24,32,24,3,37,36,201,14,11,14,
+15,14,31,14,2,24,14,24,14,13,25,10,13,22,0,63,63,18,57,57,47,47,93,17,51,16,237,50,93,113,113,17,51,16,237,50,
+1,47,237,47,237,18,57,57,47,47,17,51,51,17,51,51,49,48,1,21,30,3,21,20,14,2,7,21,33,53,46,3,53,52,62,2,55,53,
+17,14,3,21,20,30,2,23,33,62,3,53,52,46,2,39,3,253,125,205,145,80,85,150,203,117,254,129,119,204,149,84,74,142,
+207,133,35,62,46,27,24,45,62,39,1,127,33,62,47,28,26,45,62,37,4,130,87,8,74,126,171,103,105,176,131,78,7,108,
+108,12,75,124,173,111,97,170,129,80,8,87,254,175,4,36,61,85,52,44,83,67,43,4,3,41,65,85,47,50,84,62,38,4,255,
+255,0,2,0,0,5,58,4,112,2,6,2,225,0,0,0,1,0,132,0,0,6,105,4,112,0,29,0,55,64,27,12,0,15,29,0,29,0,29,4,20,214,
+23,7,214,4,15,12,202,28,1,1,21,13,5,9,0,21,0,63,63,51,51,57,47,51,237,50,1,47,237,47,237,18,57,57,47,47,17,51,
+17,51,49,48,33,17,36,36,53,17,33,17,20,30,2,23,17,33,17,62,3,53,17,33,17,20,14,2,7,17,2,178,254,227,254,239,1,
+142,24,42,59,35,1,137,34,59,43,24,1,142,65,136,211,146,1,40,5,247,230,1,102,254,129,49,70,47,24,3,2,64,253,
+192,2,23,46,71,51,1,127,254,154,110,176,125,69,2,254,216,0,0,1,0,70,0,0,5,82,4,136,0,47,0,76,64,39,44,43,47,
+38,22,19,47,47,19,22,3,28,38,45,45,5,217,38,21,21,13,217,28,23,20,0,18,18,20,8,203,33,10,44,21,203,47,20,21,0,
+63,51,237,50,63,237,18,57,17,51,1,47,47,47,237,51,47,47,237,51,47,17,18,23,57,47,47,47,17,18,57,47,49,48,1,62,
+3,53,52,38,35,34,14,2,21,20,30,2,23,17,33,17,51,53,46,3,53,52,62,2,51,50,30,2,21,20,14,2,7,21,51,17,33,3,8,27,
+53,42,26,113,98,45,75,55,30,28,43,53,24,253,182,190,27,60,50,33,83,159,232,149,153,235,159,82,29,47,61,33,190,
+253,182,1,32,4,44,83,124,86,132,121,29,64,101,73,76,119,82,46,4,254,224,1,24,4,17,63,95,127,81,103,179,134,77,
+76,132,180,105,79,121,92,67,24,4,254,232,0,255,255,0,0,0,0,5,36,6,35,2,38,2,202,0,0,1,7,0,141,1,73,0,80,0,19,
+64,11,2,14,11,38,2,93,14,12,3,6,37,1,43,53,0,43,53,0,255,255,0,148,0,0,4,143,6,35,2,38,2,206,0,0,1,7,0,141,1,
+57,0,80,0,19,64,11,1,15,11,38,1,77,15,13,11,10,37,1,43,53,0,43,53,0,255,255,0,148,0,0,5,72,6,38,2,38,2,209,0,
+0,1,7,0,141,1,197,0,83,0,19,64,11,1,15,11,38,1,125,15,13,1,7,37,1,43,53,0,43,53,0,255,255,0,148,0,0,2,206,6,
+36,2,38,2,210,0,0,1,6,0,141,37,81,0,19,64,11,1,7,11,38,1,102,7,5,1,3,37,1,43,53,0,43,53,0,255,255,0,90,255,
+232,5,62,6,36,2,38,2,216,0,0,1,7,0,141,1,136,0,81,0,19,64,11,2,43,11,38,2,98,43,41,0,10,37,1,43,53,0,43,53,0,
+255,255,255,252,0,0,5,66,6,36,2,38,2,226,0,0,1,7,0,141,1,16,0,81,0,19,64,11,1,12,11,38,1,23,12,10,0,4,37,1,43,
+53,0,43,53,0,255,255,0,70,0,0,5,82,6,38,2,38,3,95,0,0,1,7,0,141,1,136,0,83,0,19,64,11,1,51,11,38,1,98,51,49,
+21,46,37,1,43,53,0,43,53,0,255,255,0,14,0,0,2,189,5,236,2,38,2,210,0,0,1,6,0,142,16,70,0,23,64,13,2,1,11,11,
+38,2,1,0,7,10,1,3,37,1,43,53,53,0,43,53,53,0,255,255,255,252,0,0,5,66,5,236,2,38,2,226,0,0,1,7,0,142,1,75,0,
+70,0,23,64,13,2,1,16,11,38,2,1,1,12,15,0,4,37,1,43,53,53,0,43,53,53,0,255,255,0,148,0,0,4,143,5,236,2,38,2,
+206,0,0,1,7,0,142,1,46,0,70,0,25,182,2,1,19,11,38,2,1,184,255,242,180,15,18,11,10,37,1,43,53,53,0,43,53,53,0,
+0,1,0,25,255,243,6,45,4,112,0,35,0,75,64,43,32,25,48,25,64,25,144,25,4,21,1,30,217,15,8,6,6,0,217,1,3,3,1,25,
+204,18,22,33,204,8,32,10,1,10,10,1,7,3,204,4,9,1,21,0,63,63,237,50,18,57,47,93,57,237,63,237,1,47,51,47,16,
+237,50,47,50,47,237,18,57,0,93,49,48,33,33,17,33,17,33,17,33,21,54,51,50,30,2,21,20,4,33,34,38,39,19,22,22,51,
+50,62,2,53,52,38,35,34,7,3,44,254,94,254,143,4,132,254,143,160,167,95,162,118,67,254,247,255,0,23,71,48,43,25,
+38,13,27,46,34,19,82,72,99,98,3,80,1,32,254,224,183,63,47,93,137,91,194,179,7,7,1,28,5,5,9,18,29,21,45,43,43,
+0,255,255,0,148,0,0,4,128,6,36,2,38,3,74,0,0,1,7,0,141,1,59,0,81,0,20,64,12,1,9,11,38,1,9,87,9,7,5,2,37,43,17,
+53,0,43,53,0,1,0,90,255,232,4,229,4,136,0,44,0,91,64,55,47,23,1,48,23,64,23,2,64,33,1,33,36,214,12,35,35,0,12,
+23,221,22,22,44,221,0,33,201,36,63,36,1,47,36,175,36,191,36,3,44,36,23,44,36,23,3,5,28,202,17,10,39,202,5,22,
+0,63,236,63,236,18,23,57,47,47,47,93,113,16,236,1,47,236,51,47,236,47,18,57,47,16,236,50,0,93,93,93,49,48,1,
+14,3,35,34,46,2,39,38,53,52,62,2,51,50,30,2,23,5,46,3,35,34,14,2,7,33,21,33,30,1,51,50,62,2,55,4,229,32,104,
+139,170,97,98,157,127,104,45,90,81,154,225,144,114,176,133,94,31,254,138,7,30,45,59,36,47,69,48,26,3,1,61,254,
+191,9,90,88,45,66,47,31,10,1,63,96,131,81,35,25,58,93,69,136,214,142,220,150,77,41,84,128,87,84,30,57,43,26,
+35,55,70,34,252,100,102,26,45,61,35,0,255,255,0,66,255,232,4,178,4,136,2,6,2,220,0,0,255,255,0,148,0,0,2,54,4,
+112,2,6,2,210,0,0,255,255,0,14,0,0,2,189,5,236,2,38,2,210,0,0,1,6,0,142,16,70,0,23,64,13,2,1,11,11,38,2,1,0,7,
+10,1,3,37,1,43,53,53,0,43,53,53,0,255,255,0,26,255,232,4,26,4,112,2,6,2,211,0,0,0,2,0,2,255,239,7,161,4,112,0,
+34,0,43,0,57,64,30,22,35,217,34,34,19,39,217,28,12,12,2,217,19,43,202,22,22,20,35,202,34,1,206,20,9,13,204,7,
+22,0,63,236,63,236,47,236,18,57,47,236,1,47,236,51,47,47,236,18,57,47,236,50,49,48,1,33,17,20,14,2,35,34,46,2,
+39,17,51,50,62,2,53,17,33,17,51,50,30,2,21,20,14,2,35,33,1,51,50,54,53,52,38,43,1,3,82,254,244,42,93,146,103,
+29,58,52,43,14,79,23,32,19,9,4,80,186,119,186,127,67,67,127,186,119,253,164,1,162,129,69,69,68,72,127,3,55,
+254,97,117,162,101,45,4,7,10,6,1,5,12,30,49,37,2,225,254,126,47,94,141,93,94,141,93,47,1,9,56,54,54,56,0,0,2,
+0,148,0,0,7,174,4,112,0,22,0,31,0,71,64,40,20,16,217,17,1,23,217,21,13,13,7,17,27,217,7,31,202,1,1,20,206,47,
+15,111,15,127,15,3,15,15,13,22,18,9,17,21,23,202,13,21,0,63,237,63,63,51,18,57,47,93,237,50,16,237,1,47,237,
+47,18,57,47,51,237,50,16,237,50,49,48,1,17,51,50,30,2,21,20,14,2,35,33,17,33,17,33,17,33,17,33,17,1,51,50,54,
+53,52,38,35,35,5,1,186,119,186,127,67,67,127,186,119,253,164,254,215,254,94,1,162,1,41,1,162,129,69,69,68,72,
+127,4,112,254,126,47,94,141,93,94,141,93,47,1,181,254,75,4,112,254,126,1,130,252,153,56,54,54,56,0,1,0,25,0,0,
+6,20,4,112,0,29,0,54,64,27,28,28,0,22,217,23,25,25,23,12,217,11,29,25,204,26,18,204,0,5,5,23,26,9,12,23,21,0,
+63,51,63,18,57,47,57,237,16,237,50,1,47,237,47,51,47,16,237,50,50,47,49,48,1,62,3,51,50,30,2,21,17,33,53,52,
+46,2,35,34,6,7,17,33,17,33,17,33,17,33,3,44,34,70,81,96,59,74,145,114,71,254,94,12,33,61,48,54,90,28,254,94,
+254,143,4,132,254,143,2,153,15,23,16,9,40,88,140,101,254,153,218,67,86,50,19,26,19,254,117,3,80,1,32,254,224,
+0,255,255,0,148,0,0,5,53,6,37,2,38,3,129,0,0,1,7,0,141,1,144,0,82,0,19,64,11,1,44,11,38,1,81,44,42,16,6,37,1,
+43,53,0,43,53,0,255,255,0,10,255,242,5,25,6,28,2,38,3,138,0,0,1,7,0,219,1,76,0,73,0,19,64,11,1,30,11,38,1,16,
+33,26,24,3,37,1,43,53,0,43,53,0,0,1,0,148,254,204,5,72,4,112,0,11,0,41,64,20,4,3,4,3,1,9,217,6,10,217,1,11,7,
+9,9,206,4,2,6,21,0,63,51,198,237,63,51,1,47,237,47,237,18,57,57,47,47,49,48,1,17,33,17,33,17,33,17,33,17,33,
+17,5,72,254,104,254,124,254,104,1,162,1,112,4,112,251,144,254,204,1,52,4,112,252,201,3,55,0,255,255,0,0,0,0,5,
+36,4,112,2,6,2,202,0,0,0,2,0,148,0,0,4,247,4,112,0,8,0,25,0,52,64,28,63,0,1,79,8,1,13,11,11,0,217,25,4,217,19,
+8,201,13,13,9,0,201,25,21,12,202,9,9,0,63,236,63,236,18,57,47,236,1,47,236,47,236,50,47,50,0,93,93,49,48,37,
+51,50,54,53,52,38,43,1,1,33,17,33,21,51,50,30,2,21,20,14,2,35,33,2,54,149,69,69,68,72,147,254,94,3,236,253,
+182,206,119,186,127,67,67,127,186,119,253,144,248,57,52,52,56,2,159,254,248,159,45,89,134,89,89,133,89,45,0,
+255,255,0,148,0,0,5,46,4,112,2,6,2,203,0,0,0,1,0,148,0,0,4,128,4,112,0,5,0,24,64,11,1,1,4,217,5,5,21,3,206,0,
+9,0,63,237,63,1,47,237,50,47,49,48,19,33,17,33,17,33,148,3,236,253,182,254,94,4,112,254,199,252,201,0,0,2,0,
+25,254,204,5,160,4,112,0,16,0,24,0,60,64,31,19,217,6,1,6,17,217,9,6,9,6,9,11,15,219,16,12,219,11,12,16,24,9,0,
+206,14,21,19,206,7,9,0,63,237,63,237,50,50,205,50,1,47,237,47,237,18,57,57,47,47,16,237,17,51,16,237,49,48,19,
+51,62,3,53,53,33,17,51,17,33,17,33,17,33,1,17,35,20,14,2,7,25,103,28,37,22,9,4,50,142,254,124,253,129,254,124,
+3,87,238,12,22,32,20,1,57,70,145,178,224,149,57,252,201,253,147,1,52,254,204,2,109,1,254,74,145,132,115,44,0,
+255,255,0,148,0,0,4,143,4,112,2,6,2,206,0,0,0,1,0,8,0,0,7,128,4,112,0,77,0,86,64,44,37,0,40,77,14,25,0,62,77,
+52,25,0,77,52,52,77,0,25,4,8,70,210,69,7,210,8,63,14,76,1,202,40,14,37,37,8,50,38,26,9,70,0,8,21,0,63,51,51,
+63,51,51,18,57,47,57,51,237,50,17,51,1,47,237,47,237,18,23,57,47,47,47,47,17,18,57,17,18,57,17,51,17,51,49,48,
+33,17,34,14,2,7,3,33,19,62,3,55,53,46,3,39,46,3,35,17,51,50,30,2,23,30,3,23,17,33,17,62,3,55,62,3,51,51,17,34,
+14,2,7,14,3,7,21,30,3,23,19,33,3,46,3,35,17,2,253,23,35,30,29,17,174,254,63,231,17,41,45,51,27,27,40,37,38,24,
+21,39,47,60,41,120,108,147,103,72,33,23,36,31,29,17,1,142,17,29,31,36,23,33,72,103,147,108,120,41,60,47,39,21,
+24,38,37,40,27,27,51,45,41,17,231,254,63,174,17,29,30,35,23,1,190,8,23,42,33,254,172,1,165,31,57,46,30,5,4,6,
+17,31,49,37,31,44,27,12,1,32,29,64,103,74,53,60,29,8,2,1,166,254,90,2,8,29,60,53,74,103,64,29,254,224,12,27,
+44,31,37,49,31,17,6,4,5,30,46,57,31,254,91,1,84,33,42,23,8,254,66,0,0,1,0,64,255,238,4,97,4,131,0,54,0,86,64,
+47,17,20,43,43,32,20,54,220,0,0,33,221,32,48,48,39,217,20,12,12,20,17,44,199,43,47,43,1,47,43,1,33,43,54,54,
+43,33,3,5,36,202,27,22,51,201,5,10,0,63,237,63,237,18,23,57,47,47,47,93,113,16,237,57,1,47,51,47,16,237,50,47,
+47,237,51,47,237,17,18,57,47,18,57,49,48,19,62,3,51,50,30,4,21,20,14,2,7,22,22,21,20,14,4,35,34,46,2,39,37,22,
+22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,78,36,94,127,164,104,59,116,106,92,67,38,32,56,76,
+43,129,118,50,83,109,118,121,53,103,162,126,95,37,1,112,14,73,56,63,65,72,78,87,64,75,66,64,52,49,74,17,3,119,
+81,104,60,23,11,27,45,67,92,60,48,81,64,45,11,29,143,109,75,109,76,47,25,9,24,67,120,95,95,69,67,59,52,48,61,
+230,50,57,49,52,62,60,0,1,0,148,0,0,5,72,4,112,0,9,0,36,64,17,3,7,214,4,8,1,214,0,2,7,4,8,5,9,1,4,21,0,63,51,
+63,51,18,57,57,1,47,237,50,47,237,50,49,48,33,33,17,1,33,17,33,17,1,33,5,72,254,120,254,92,254,120,1,136,1,
+166,1,134,2,47,253,209,4,112,253,205,2,51,255,255,0,148,0,0,5,72,6,28,2,38,3,127,0,0,1,7,0,219,1,154,0,73,0,
+19,64,11,1,15,11,38,1,1,18,11,5,9,37,1,43,53,0,43,53,0,0,1,0,148,0,0,5,53,4,112,0,40,0,51,64,26,18,14,217,0,6,
+15,30,30,7,210,6,30,204,29,9,0,18,202,13,13,15,16,9,7,15,21,0,63,51,63,18,57,47,237,57,63,237,1,47,237,51,47,
+47,18,57,237,50,49,48,1,30,3,23,19,33,3,46,3,35,17,33,17,33,17,62,3,55,62,3,51,51,17,34,14,2,7,14,3,7,3,153,
+27,51,45,41,17,231,254,53,174,17,29,30,35,23,254,94,1,162,17,29,31,36,23,33,72,103,147,108,130,41,60,47,39,21,
+24,38,37,40,27,2,78,5,30,46,57,31,254,91,1,84,33,42,23,8,254,66,4,112,254,90,2,8,29,60,53,74,103,64,29,254,
+224,12,27,44,31,37,49,31,17,6,0,0,1,0,2,255,239,4,244,4,112,0,23,0,35,64,18,21,217,20,10,10,0,217,17,21,21,23,
+206,18,9,12,204,5,22,0,63,237,63,237,63,1,47,237,51,47,47,237,49,48,1,20,14,2,35,34,46,2,39,17,51,50,62,2,53,
+17,33,17,33,17,33,2,70,42,93,146,103,29,58,52,43,14,79,23,32,19,9,4,80,254,94,254,244,1,152,117,162,101,45,4,
+8,9,6,1,5,12,30,49,37,2,225,251,144,3,55,255,255,0,148,0,0,6,31,4,112,2,6,2,214,0,0,255,255,0,148,0,0,5,72,4,
+112,2,6,2,209,0,0,255,255,0,90,255,232,5,62,4,136,2,6,2,216,0,0,255,255,0,148,0,0,5,72,4,112,2,2,3,87,0,0,255,
+255,0,148,0,0,4,183,4,112,2,6,2,217,0,0,255,255,0,90,255,232,4,229,4,136,2,6,2,204,0,0,255,255,0,25,0,0,4,157,
+4,112,2,6,2,221,0,0,0,1,0,10,255,242,5,25,4,112,0,24,0,45,64,22,23,4,1,1,14,14,3,0,222,24,2,222,3,1,9,2,24,9,
+18,204,9,22,0,63,237,63,51,18,57,1,47,237,47,237,18,57,47,57,17,51,51,49,48,1,19,19,33,1,14,3,35,34,46,2,39,
+17,22,22,51,50,62,2,55,1,1,210,207,193,1,183,254,96,56,105,114,131,82,20,56,62,63,27,28,85,45,33,45,31,22,9,
+254,51,4,112,254,56,1,200,252,217,108,134,75,26,2,3,6,3,1,32,5,9,7,15,24,17,3,31,0,3,0,82,0,0,6,40,4,112,0,25,
+0,36,0,47,0,106,64,65,36,24,13,37,1,12,13,12,13,12,6,31,219,19,42,219,6,37,36,201,14,11,14,15,14,31,14,2,47,
+26,201,24,1,24,48,24,64,24,80,24,96,24,112,24,128,24,144,24,7,0,24,16,24,32,24,3,14,24,14,24,13,25,9,13,21,0,
+63,63,18,57,57,47,47,93,113,17,51,16,236,50,93,17,51,16,236,50,1,47,236,47,236,18,57,57,47,47,17,51,51,17,51,
+51,49,48,1,21,30,3,21,20,14,2,7,21,33,53,46,3,53,52,62,2,55,53,17,14,3,21,20,30,2,23,33,62,3,53,52,46,2,39,3,
+253,125,205,145,80,85,150,203,117,254,129,119,204,149,84,74,142,207,133,35,62,46,27,24,45,62,39,1,127,33,62,
+47,28,26,45,62,37,4,112,87,8,69,118,166,103,105,170,123,72,7,108,108,12,68,117,167,111,97,164,122,75,8,87,254,
+175,4,30,54,80,52,44,77,59,37,4,3,35,57,79,47,50,78,56,32,4,255,255,0,2,0,0,5,58,4,112,2,6,2,225,0,0,0,1,0,
+148,254,204,5,214,4,112,0,11,0,40,64,20,10,217,1,1,3,9,217,6,4,219,3,11,7,9,1,9,206,4,6,21,0,63,198,237,50,63,
+51,1,47,237,47,237,18,57,47,237,49,48,1,17,51,17,33,17,33,17,33,17,33,17,5,72,142,254,124,252,66,1,162,1,112,
+4,112,252,201,253,147,1,52,4,112,252,201,3,55,0,0,1,0,115,0,0,4,253,4,112,0,23,0,35,64,17,2,217,23,10,14,217,
+13,7,206,15,18,18,14,21,11,0,9,0,63,50,63,57,47,57,237,1,47,237,50,47,237,49,48,19,33,21,20,30,2,51,50,54,55,
+17,33,17,33,17,6,6,35,34,46,2,53,115,1,162,12,33,61,48,54,90,28,1,162,254,94,69,141,86,90,163,123,72,4,112,
+225,67,85,49,19,24,19,1,146,251,144,1,185,29,34,40,88,140,101,0,0,1,0,148,0,0,7,46,4,112,0,11,0,40,64,20,8,
+217,5,5,0,4,217,1,9,217,0,10,6,2,9,8,4,206,1,21,0,63,237,50,63,51,51,1,47,237,47,237,18,57,47,237,49,48,33,33,
+17,33,17,51,17,33,17,51,17,33,7,46,249,102,1,162,218,1,162,218,1,162,4,112,252,201,3,55,252,201,3,55,0,1,0,
+148,254,204,7,188,4,112,0,15,0,55,64,28,3,217,0,4,217,7,0,7,0,7,9,15,217,12,10,219,9,5,1,13,9,7,3,15,206,10,
+12,21,0,63,198,237,50,50,63,51,51,1,47,237,47,237,18,57,57,47,47,16,237,16,237,49,48,1,17,33,17,51,17,33,17,
+51,17,33,17,33,17,33,17,3,16,1,162,218,1,162,142,254,124,250,92,1,162,1,57,3,55,252,201,3,55,252,201,253,147,
+1,52,4,112,252,201,0,0,2,0,25,0,0,5,217,4,112,0,8,0,25,0,45,64,23,13,0,217,25,10,10,25,4,217,19,8,202,13,13,
+11,0,202,25,21,10,206,11,9,0,63,237,63,237,18,57,47,237,1,47,237,47,51,47,16,237,50,49,48,1,51,50,54,53,52,38,
+35,35,1,33,17,33,17,51,50,30,2,21,20,14,2,35,33,3,44,129,69,69,68,72,127,254,94,254,143,3,19,186,119,186,127,
+67,67,127,186,119,253,164,1,9,56,54,54,56,1,82,1,57,254,126,47,94,141,93,94,141,93,47,255,255,0,148,0,0,6,249,
+4,112,0,38,3,147,0,0,0,7,2,210,4,195,0,0,0,2,0,148,0,0,4,227,4,112,0,14,0,23,0,36,64,18,1,15,217,13,19,217,7,
+23,202,1,1,13,14,9,15,202,13,21,0,63,237,63,18,57,47,237,1,47,237,47,237,50,49,48,1,17,51,50,30,2,21,20,14,2,
+35,33,17,1,51,50,54,53,52,38,35,35,2,54,186,119,186,127,67,67,127,186,119,253,164,1,162,129,69,69,68,72,127,4,
+112,254,126,47,94,141,93,94,141,93,47,4,112,252,153,56,54,54,56,0,0,1,0,74,255,232,4,213,4,136,0,44,0,81,64,
+47,64,1,1,12,221,13,13,33,0,0,23,34,221,33,2,44,214,23,1,201,0,63,0,1,47,0,175,0,191,0,3,34,0,12,34,0,12,3,18,
+39,202,28,22,7,202,18,10,0,63,236,63,236,18,23,57,47,47,47,93,113,16,236,1,47,236,50,47,236,18,57,47,17,51,47,
+236,0,93,49,48,1,53,33,46,3,35,34,14,2,7,37,62,3,51,50,30,2,21,20,14,2,35,34,46,2,39,37,30,3,51,50,62,2,55,2,
+0,1,63,3,25,46,67,44,45,66,47,31,10,254,139,31,85,132,189,134,152,223,146,71,80,155,225,144,113,178,136,98,34,
+1,118,7,31,48,63,39,45,69,48,27,5,1,190,252,42,71,52,29,26,45,61,35,92,79,128,88,48,90,159,218,128,141,220,
+150,78,40,83,128,89,84,31,57,43,25,34,56,73,39,0,2,0,148,255,232,7,70,4,136,0,26,0,44,0,64,64,37,27,217,6,26,
+26,2,37,217,16,5,1,217,2,32,204,21,22,40,204,11,10,5,206,47,0,111,0,127,0,3,0,0,2,3,9,2,21,0,63,63,18,57,47,
+93,236,63,236,63,236,1,47,236,50,47,236,18,57,47,51,236,49,48,1,17,33,17,33,17,51,62,3,51,50,30,2,21,20,14,2,
+35,34,46,2,39,37,20,30,2,51,50,62,2,53,52,38,35,34,14,2,2,54,254,94,1,162,124,17,89,143,199,126,143,223,153,
+79,75,147,218,144,134,206,148,92,19,1,153,26,46,66,39,43,66,46,24,97,84,38,65,46,26,1,181,254,75,4,112,254,
+126,83,149,112,66,79,149,217,138,144,223,154,80,61,117,172,111,130,83,115,72,33,31,73,122,91,152,139,33,73,
+116,0,2,0,0,0,0,4,219,4,112,0,23,0,36,0,57,64,31,15,9,36,0,217,23,30,217,18,18,8,210,9,15,35,199,96,2,112,2,2,
+2,2,9,25,200,21,9,0,9,21,0,63,51,63,236,18,57,47,93,236,57,1,47,236,51,47,236,47,236,50,18,57,49,48,33,17,35,
+34,14,2,7,3,33,19,62,3,55,46,1,53,52,54,51,33,17,1,35,34,14,2,21,20,30,2,59,1,3,57,18,25,40,36,34,19,194,254,
+53,182,17,36,48,65,45,142,156,218,203,2,215,254,94,141,50,65,40,16,16,40,68,53,135,1,195,10,25,43,33,254,172,
+1,66,30,51,42,33,13,28,166,131,164,156,251,144,3,128,14,27,40,27,25,41,30,16,0,1,0,148,0,0,4,50,5,164,0,7,0,
+27,64,13,4,215,6,1,217,2,5,0,206,3,9,2,21,0,63,63,237,198,1,47,237,47,237,49,48,1,17,33,17,33,17,33,17,2,54,
+254,94,2,26,1,132,3,55,252,201,4,112,1,52,253,147,0,255,255,0,42,255,244,3,9,2,248,2,7,3,164,0,0,253,37,255,
+255,0,141,0,9,2,115,2,247,2,7,0,241,0,0,253,36,255,255,0,22,0,9,3,23,2,247,2,7,0,242,0,0,253,36,255,255,0,31,
+255,246,3,19,2,248,2,7,0,243,0,0,253,37,255,255,0,44,255,245,3,7,2,248,0,7,1,4,0,3,253,37,255,255,0,35,255,
+248,3,12,2,244,2,7,2,153,0,0,253,37,255,255,0,42,255,247,3,8,2,248,2,7,3,162,0,0,253,37,255,255,0,80,255,246,
+2,231,2,248,2,7,2,154,0,0,253,37,255,255,0,29,255,246,3,25,2,248,2,7,2,155,0,0,253,37,255,255,0,43,255,247,3,
+9,2,248,2,7,3,163,0,0,253,37,0,2,0,42,2,210,3,8,5,211,0,36,0,48,0,82,64,48,159,46,175,46,191,46,3,8,16,37,178,
+26,0,178,36,36,43,178,16,46,179,11,8,21,11,0,64,13,17,72,0,0,144,11,160,11,2,11,11,31,40,179,21,21,3,179,31,
+31,0,63,237,51,47,237,18,57,47,93,57,47,43,17,18,57,16,237,1,47,237,51,16,237,47,237,18,57,0,93,49,48,1,38,38,
+35,34,14,2,7,54,54,51,50,30,2,21,20,14,2,35,34,46,2,53,52,62,2,51,50,30,2,23,1,20,22,51,50,54,53,52,38,35,34,
+6,1,241,8,40,29,23,36,28,19,6,43,90,59,65,102,71,38,44,84,122,78,95,150,105,56,53,99,142,89,72,110,80,53,17,
+254,72,63,48,43,57,60,44,46,61,4,254,43,36,13,42,79,65,37,36,37,67,92,55,55,95,69,39,38,88,147,108,101,147,95,
+45,23,47,70,48,254,189,56,64,58,57,59,61,59,0,2,0,43,2,210,3,9,5,211,0,36,0,48,0,88,64,23,144,46,160,46,176,
+46,3,8,16,37,178,26,0,178,36,36,43,178,16,46,179,11,0,184,255,192,64,25,13,17,72,0,0,31,8,159,11,175,11,2,11,
+11,21,3,179,31,40,179,21,31,31,21,31,0,63,51,47,16,237,16,237,18,57,47,93,57,18,57,47,43,16,237,1,47,237,51,
+16,237,47,237,18,57,0,93,49,48,1,22,22,51,50,62,2,55,6,6,35,34,46,2,53,52,62,2,51,50,30,2,21,20,14,2,35,34,46,
+2,39,1,52,38,35,34,6,21,20,22,51,50,54,1,66,8,40,29,23,36,28,19,6,43,90,59,65,102,71,38,44,84,122,78,94,151,
+105,56,53,99,142,89,72,110,80,54,16,1,184,63,48,43,57,60,44,46,61,3,167,43,36,13,42,79,65,37,36,37,67,92,55,
+55,95,69,39,38,88,147,108,101,147,95,45,23,47,70,48,1,67,56,64,58,57,59,61,59,0,2,0,42,2,207,3,9,5,211,0,17,0,
+37,0,29,64,14,28,178,8,18,178,0,23,179,13,13,33,179,5,31,0,63,237,51,47,237,1,47,237,47,237,49,48,19,52,62,2,
+51,50,22,21,20,14,2,35,34,46,2,37,20,30,2,51,50,62,2,53,52,46,2,35,34,14,2,42,46,92,140,95,188,174,38,87,141,
+103,97,138,89,42,1,4,14,27,39,26,28,40,27,13,14,27,42,27,28,39,25,12,4,85,107,146,90,39,190,190,101,147,97,47,
+46,96,147,98,70,91,54,22,23,54,89,66,72,93,54,21,22,53,91,255,255,0,83,255,230,5,239,7,62,2,38,2,182,0,0,1,7,
+0,67,1,205,1,107,0,21,180,2,73,5,38,2,184,255,173,180,70,72,36,22,37,1,43,53,0,43,53,0,255,255,0,83,255,230,5,
+239,7,62,2,38,2,182,0,0,1,7,0,141,1,201,1,107,0,19,64,11,2,73,5,38,2,78,73,71,36,22,37,1,43,53,0,43,53,0,255,
+255,0,83,255,230,5,239,7,49,2,38,2,182,0,0,1,7,0,216,1,197,1,107,0,21,180,2,76,5,38,2,184,255,250,180,76,72,
+36,22,37,1,43,53,0,43,53,0,255,255,0,83,255,230,5,239,7,37,2,38,2,182,0,0,1,7,0,217,1,197,1,107,0,21,180,2,76,
+5,38,2,184,255,249,180,86,73,36,22,37,1,43,53,0,43,53,0,255,255,0,83,255,230,5,239,7,17,2,38,2,182,0,0,1,7,0,
+142,1,197,1,107,0,25,182,3,2,77,5,38,3,2,184,255,250,180,73,76,36,22,37,1,43,53,53,0,43,53,53,0,255,255,0,83,
+255,230,5,239,7,215,2,38,2,182,0,0,1,7,0,221,1,197,1,107,0,25,182,3,2,73,5,38,3,2,184,255,249,180,76,70,36,22,
+37,1,43,53,53,0,43,53,53,0,255,255,0,83,255,230,5,239,7,17,2,38,2,182,0,0,1,7,0,218,1,197,1,107,0,21,180,2,73,
+5,38,2,184,255,250,180,73,72,36,22,37,1,43,53,0,43,53,0,255,255,0,83,255,230,5,239,7,62,2,38,2,182,0,0,1,7,0,
+219,1,197,1,107,0,21,180,2,75,5,38,2,184,255,250,180,78,71,36,22,37,1,43,53,0,43,53,0,255,255,0,83,254,65,5,
+239,5,212,2,38,2,182,0,0,0,7,0,224,3,108,0,0,255,255,0,83,255,230,5,239,8,171,2,38,2,182,0,0,0,39,0,221,1,197,
+0,225,1,7,0,141,1,247,2,216,0,36,64,16,3,2,0,73,16,73,32,73,48,73,4,73,0,3,2,76,184,255,248,180,76,70,22,36,
+37,43,17,53,53,0,63,93,53,53,255,255,0,83,255,230,5,239,5,212,2,6,2,182,0,0,255,255,0,93,255,231,6,76,7,62,2,
+38,2,183,0,0,1,7,0,67,1,227,1,107,0,21,180,2,43,5,38,2,184,255,143,180,40,42,10,21,37,1,43,53,0,43,53,0,255,
+255,0,93,255,231,6,76,7,62,2,38,2,183,0,0,1,7,0,141,2,0,1,107,0,19,64,11,2,43,5,38,2,81,43,41,10,21,37,1,43,
+53,0,43,53,0,255,255,0,93,255,231,6,76,7,49,2,38,2,183,0,0,1,7,0,216,1,250,1,107,0,21,180,2,46,5,38,2,184,255,
+252,180,46,42,10,21,37,1,43,53,0,43,53,0,255,255,0,93,255,231,6,76,7,17,2,38,2,183,0,0,1,7,0,142,1,253,1,107,
+0,25,182,3,2,47,5,38,3,2,184,255,254,180,43,46,10,21,37,1,43,53,53,0,43,53,53,0,255,255,0,93,255,231,6,76,7,
+17,2,38,2,183,0,0,1,7,0,218,1,253,1,107,0,21,180,2,43,5,38,2,184,255,254,180,43,42,10,21,37,1,43,53,0,43,53,0,
+255,255,0,93,255,231,6,76,7,62,2,38,2,183,0,0,1,7,0,219,1,253,1,107,0,21,180,2,45,5,38,2,184,255,254,180,48,
+41,10,21,37,1,43,53,0,43,53,0,255,255,0,93,255,231,6,76,7,67,2,38,2,183,0,0,1,7,0,220,1,253,1,107,0,21,180,2,
+43,5,38,2,184,255,254,180,43,42,10,21,37,1,43,53,0,43,53,0,255,255,0,93,254,65,6,76,5,211,2,38,2,183,0,0,0,7,
+0,224,2,77,0,0,255,255,0,93,255,231,6,76,7,49,2,38,2,183,0,0,1,7,0,225,1,253,1,107,0,21,180,2,41,5,38,2,184,
+255,255,180,42,46,10,21,37,1,43,53,0,43,53,0,255,255,0,93,255,231,6,76,5,211,2,6,2,183,0,0,255,255,0,93,255,
+231,6,76,7,17,2,38,2,183,0,0,1,7,0,142,1,253,1,107,0,25,182,3,2,47,5,38,3,2,184,255,254,180,43,46,10,21,37,1,
+43,53,53,0,43,53,53,0,255,255,0,152,0,0,6,19,7,37,2,38,2,184,0,0,1,7,0,217,2,8,1,107,0,19,64,11,1,34,5,38,1,7,
+44,31,2,15,37,1,43,53,0,43,53,0,255,255,0,152,0,0,6,19,7,62,2,38,2,184,0,0,1,7,0,141,2,8,1,107,0,19,64,11,1,
+31,5,38,1,88,31,29,2,15,37,1,43,53,0,43,53,0,255,255,0,152,254,81,6,19,5,210,2,38,2,184,0,0,1,7,2,152,2,14,0,
+0,0,14,185,0,1,255,249,180,41,34,2,15,37,1,43,53,255,255,0,152,0,0,6,19,7,49,2,38,2,184,0,0,1,7,0,225,2,8,1,
+107,0,19,64,11,1,29,5,38,1,8,30,34,2,15,37,1,43,53,0,43,53,0,255,255,0,142,255,232,6,9,7,62,2,38,2,186,0,0,1,
+7,0,67,1,244,1,107,0,21,180,1,31,5,38,1,184,255,169,180,28,30,15,2,37,1,43,53,0,43,53,0,255,255,0,142,255,232,
+6,9,7,62,2,38,2,186,0,0,1,7,0,141,1,244,1,107,0,19,64,11,1,31,5,38,1,78,31,29,15,2,37,1,43,53,0,43,53,0,255,
+255,0,142,255,232,6,9,7,17,2,38,2,186,0,0,1,7,0,142,1,244,1,107,0,25,182,2,1,35,5,38,2,1,184,255,254,180,31,
+34,15,2,37,1,43,53,53,0,43,53,53,0,255,255,0,142,255,232,6,9,7,37,2,38,2,186,0,0,1,7,0,217,1,244,1,107,0,21,
+180,1,34,5,38,1,184,255,254,180,44,31,15,2,37,1,43,53,0,43,53,0,255,255,0,142,255,232,6,9,7,17,2,38,2,186,0,0,
+1,7,0,218,1,244,1,107,0,21,180,1,31,5,38,1,184,255,254,180,31,30,15,2,37,1,43,53,0,43,53,0,255,255,0,142,255,
+232,6,9,7,62,2,38,2,186,0,0,1,7,0,219,1,244,1,107,0,21,180,1,33,5,38,1,184,255,254,180,36,29,15,2,37,1,43,53,
+0,43,53,0,255,255,0,142,255,232,6,9,7,215,2,38,2,186,0,0,1,7,0,221,1,244,1,107,0,25,182,2,1,31,5,38,2,1,184,
+255,253,180,34,28,15,2,37,1,43,53,53,0,43,53,53,0,255,255,0,142,255,232,6,9,7,62,2,38,2,186,0,0,1,7,0,223,1,
+244,1,107,0,23,64,13,2,1,35,5,38,2,1,149,31,33,15,2,37,1,43,53,53,0,43,53,53,0,255,255,0,142,254,65,6,27,5,
+186,2,38,2,186,0,0,0,7,0,224,3,178,0,0,255,255,0,70,0,0,3,86,7,62,2,38,2,187,0,0,1,7,0,67,0,103,1,107,0,21,
+180,1,15,5,38,1,184,255,154,180,12,14,11,10,37,1,43,53,0,43,53,0,255,255,0,70,0,0,3,86,7,62,2,38,2,187,0,0,1,
+7,0,141,0,147,1,107,0,19,64,11,1,15,5,38,1,107,15,13,11,10,37,1,43,53,0,43,53,0,255,255,0,70,0,0,3,86,7,49,2,
+38,2,187,0,0,1,7,0,216,0,118,1,107,0,21,180,1,18,5,38,1,184,255,254,180,18,14,11,10,37,1,43,53,0,43,53,0,255,
+255,0,70,0,0,3,86,7,17,2,38,2,187,0,0,1,7,0,142,0,118,1,107,0,25,182,2,1,19,5,38,2,1,184,255,254,180,15,18,11,
+10,37,1,43,53,53,0,43,53,53,0,255,255,0,70,0,0,3,86,7,37,2,38,2,187,0,0,1,7,0,217,0,118,1,107,0,21,180,1,18,5,
+38,1,184,255,253,180,28,15,11,10,37,1,43,53,0,43,53,0,255,255,0,70,0,0,3,86,7,62,2,38,2,187,0,0,1,7,0,219,0,
+118,1,107,0,21,180,1,17,5,38,1,184,255,254,180,20,13,11,10,37,1,43,53,0,43,53,0,255,255,0,70,254,65,3,86,5,
+186,2,38,2,187,0,0,0,7,0,224,0,160,0,0,255,255,0,70,0,0,3,86,7,67,2,38,2,187,0,0,1,7,0,220,0,118,1,107,0,21,
+180,1,15,5,38,1,184,255,253,180,15,14,11,10,37,1,43,53,0,43,53,0,255,255,0,70,0,0,3,86,5,186,2,6,2,187,0,0,
+255,255,0,6,0,0,4,155,5,186,0,39,2,187,1,69,0,0,1,6,1,152,0,0,0,22,177,1,12,184,255,242,183,12,12,4,4,37,1,15,
+0,0,63,53,1,43,17,53,255,255,0,70,0,0,3,86,7,17,2,38,2,187,0,0,1,7,0,142,0,118,1,107,0,25,182,2,1,19,5,38,2,1,
+184,255,254,180,15,18,11,10,37,1,43,53,53,0,43,53,53,0,255,255,0,70,0,0,3,86,5,186,2,6,2,187,0,0,255,255,0,70,
+0,0,3,86,7,17,2,38,2,187,0,0,1,7,0,142,0,118,1,107,0,25,182,2,1,19,5,38,2,1,184,255,254,180,15,18,11,10,37,1,
+43,53,53,0,43,53,53,0,255,255,0,120,255,231,2,248,7,46,2,38,2,193,0,0,1,7,0,141,255,254,1,91,0,21,180,1,25,5,
+38,1,184,255,236,180,25,23,21,10,37,1,43,53,0,43,53,0,255,255,0,108,254,81,2,248,5,186,2,38,2,193,0,0,0,6,2,
+152,90,0,255,255,0,120,255,231,3,158,5,186,0,38,2,193,0,0,1,7,1,81,1,194,6,51,0,20,64,11,1,22,128,22,22,0,0,
+37,1,22,0,0,63,53,1,43,17,53,255,255,0,120,255,231,3,192,5,186,0,38,2,193,0,0,1,7,0,220,1,206,253,86,0,13,176,
+0,184,255,138,180,0,0,22,22,37,43,53,0,0,1,0,0,255,231,3,8,5,186,0,29,0,58,64,29,28,28,26,9,9,0,131,19,23,19,
+21,21,19,26,29,23,20,4,27,21,27,21,27,14,24,0,5,14,22,0,63,205,63,18,57,57,47,47,18,23,57,1,47,51,47,17,51,16,
+237,50,47,50,50,47,49,48,1,20,30,2,51,50,54,55,19,14,3,35,34,46,2,53,53,7,53,55,17,33,17,55,21,7,2,32,7,22,41,
+33,20,42,32,35,49,80,67,57,25,107,140,82,33,136,136,1,152,166,166,1,177,49,66,39,16,6,6,254,237,6,10,6,3,50,
+96,142,93,172,92,196,93,2,229,254,43,107,196,109,255,255,0,70,0,0,3,86,7,62,2,38,2,187,0,0,1,7,0,67,0,103,1,
+107,0,21,180,1,15,5,38,1,184,255,154,180,12,14,11,10,37,1,43,53,0,43,53,0,255,255,0,70,0,0,3,86,7,62,2,38,2,
+187,0,0,1,7,0,141,0,147,1,107,0,19,64,11,1,15,5,38,1,107,15,13,11,10,37,1,43,53,0,43,53,0,255,255,0,70,0,0,3,
+86,7,49,2,38,2,187,0,0,1,7,0,216,0,118,1,107,0,21,180,1,18,5,38,1,184,255,254,180,18,14,11,10,37,1,43,53,0,43,
+53,0,255,255,0,70,0,0,3,86,7,17,2,38,2,187,0,0,1,7,0,142,0,118,1,107,0,25,182,2,1,19,5,38,2,1,184,255,254,180,
+15,18,11,10,37,1,43,53,53,0,43,53,53,0,255,255,0,70,0,0,3,86,7,37,2,38,2,187,0,0,1,7,0,217,0,118,1,107,0,21,
+180,1,18,5,38,1,184,255,253,180,28,15,11,10,37,1,43,53,0,43,53,0,255,255,0,70,0,0,3,86,7,62,2,38,2,187,0,0,1,
+7,0,219,0,118,1,107,0,21,180,1,17,5,38,1,184,255,254,180,20,13,11,10,37,1,43,53,0,43,53,0,255,255,0,70,254,65,
+3,86,5,186,2,38,2,187,0,0,0,7,0,224,0,160,0,0,255,255,0,70,0,0,3,86,7,67,2,38,2,187,0,0,1,7,0,220,0,118,1,107,
+0,21,180,1,15,5,38,1,184,255,253,180,15,14,11,10,37,1,43,53,0,43,53,0,255,255,0,152,254,81,6,136,5,186,2,38,2,
+188,0,0,1,7,2,152,1,246,0,0,0,14,185,0,1,255,167,180,24,17,10,6,37,1,43,53,255,255,0,72,255,232,4,217,5,211,2,
+38,2,190,0,0,1,7,0,67,1,24,0,0,0,21,180,2,48,17,38,2,184,255,136,180,45,47,40,28,37,1,43,53,0,43,53,0,255,255,
+0,72,255,232,4,217,5,211,2,38,2,190,0,0,1,7,0,141,1,23,0,0,0,19,64,11,2,48,17,38,2,44,48,46,40,28,37,1,43,53,
+0,43,53,0,255,255,0,72,255,232,4,217,5,198,2,38,2,190,0,0,1,7,0,216,1,64,0,0,0,19,64,11,2,51,17,38,2,5,51,47,
+40,28,37,1,43,53,0,43,53,0,255,255,0,72,255,232,4,217,5,186,2,38,2,190,0,0,1,7,0,217,1,64,0,0,0,19,64,11,2,51,
+17,38,2,4,61,48,40,28,37,1,43,53,0,43,53,0,255,255,0,72,255,232,4,217,5,166,2,38,2,190,0,0,1,7,0,142,1,64,0,0,
+0,23,64,13,3,2,52,17,38,3,2,5,48,51,40,28,37,1,43,53,53,0,43,53,53,0,255,255,0,72,255,232,4,217,6,108,2,38,2,
+190,0,0,1,7,0,221,1,49,0,0,0,25,182,3,2,48,17,38,3,2,184,255,245,180,51,45,40,28,37,1,43,53,53,0,43,53,53,0,
+255,255,0,72,255,232,4,217,5,166,2,38,2,190,0,0,1,7,0,218,1,64,0,0,0,19,64,11,2,48,17,38,2,5,48,47,40,28,37,1,
+43,53,0,43,53,0,255,255,0,72,255,232,4,217,5,211,2,38,2,190,0,0,1,7,0,219,1,64,0,0,0,19,64,11,2,50,17,38,2,5,
+53,46,40,28,37,1,43,53,0,43,53,0,255,255,0,72,254,65,5,5,4,62,2,38,2,190,0,0,0,7,0,224,2,156,0,0,0,2,255,228,
+254,108,2,200,5,198,0,3,0,10,0,47,64,22,2,131,64,9,7,8,8,3,3,6,10,6,3,27,8,7,10,128,4,192,0,15,0,63,26,220,26,
+205,50,57,63,1,47,47,18,57,47,57,17,51,51,26,237,49,48,19,33,17,33,19,33,19,35,39,7,35,138,1,151,254,105,63,1,
+33,222,248,122,122,248,4,38,250,70,7,90,254,226,153,153,0,255,255,0,123,254,81,5,86,5,186,2,38,2,192,0,0,1,7,
+2,152,1,109,0,0,0,14,185,0,1,255,197,180,24,17,10,6,37,1,43,53,255,255,0,120,255,231,2,248,7,46,2,38,2,193,0,
+0,1,7,0,141,255,254,1,91,0,21,180,1,25,2,38,1,184,255,236,180,25,23,21,10,37,1,43,53,0,43,53,0,255,255,0,108,
+254,81,2,248,5,186,2,38,2,193,0,0,0,6,2,152,90,0,255,255,0,120,255,231,3,158,5,186,0,38,2,193,0,0,1,7,1,81,1,
+194,6,51,0,12,180,1,22,1,22,0,0,63,53,1,47,53,255,255,0,120,255,231,3,192,5,186,0,38,2,193,0,0,1,7,0,220,1,
+206,253,86,0,13,183,1,22,118,22,22,0,0,37,1,43,17,53,0,0,1,0,0,255,231,3,8,5,186,0,29,0,59,64,30,28,28,26,9,9,
+0,131,19,23,19,21,21,19,20,23,29,26,4,27,21,27,21,27,14,24,0,5,204,14,22,0,63,236,63,18,57,57,47,47,18,23,57,
+1,47,51,47,17,51,16,236,50,47,50,50,47,49,48,1,20,30,2,51,50,54,55,19,14,3,35,34,46,2,61,1,7,53,55,17,33,17,
+55,21,7,2,32,7,22,41,33,20,42,32,35,49,80,67,57,25,107,140,82,33,136,136,1,152,166,166,1,177,49,66,39,16,6,6,
+254,237,6,10,6,3,50,96,142,93,172,92,196,93,2,229,254,43,107,196,109,0,255,255,0,16,254,81,2,216,5,77,2,38,2,
+195,0,0,1,6,0,222,12,0,0,14,185,0,1,255,217,180,25,18,3,9,37,1,43,53,255,255,0,16,254,81,2,216,5,77,2,38,2,
+195,0,0,1,6,2,152,12,0,0,14,185,0,1,255,217,180,25,18,3,9,37,1,43,53,255,255,0,16,0,0,3,249,5,186,0,38,2,195,
+0,0,1,7,1,81,2,29,6,51,0,20,64,11,1,12,171,12,12,6,6,37,1,12,0,0,63,53,1,43,17,53,0,1,0,16,0,0,2,216,5,77,0,
+19,0,71,64,35,17,17,15,13,13,11,19,131,0,8,0,6,6,4,0,2,2,0,14,6,205,7,18,2,198,15,3,3,0,11,9,7,15,0,21,0,63,
+63,196,51,18,57,47,51,236,50,16,236,50,1,47,51,47,17,51,51,47,17,51,16,236,50,50,47,50,50,47,49,48,51,17,35,
+53,51,53,35,17,51,17,33,17,51,17,35,21,51,21,35,17,168,132,132,152,152,1,152,152,152,132,132,1,156,186,167,1,
+41,1,39,254,217,254,215,167,186,254,100,255,255,0,120,254,81,4,219,5,211,2,38,2,196,0,0,1,7,0,141,1,87,0,0,0,
+19,64,11,1,46,17,38,1,83,46,44,11,24,37,1,43,53,0,43,53,0,255,255,0,120,254,81,4,219,5,198,2,38,2,196,0,0,1,7,
+0,216,1,87,0,0,0,19,64,11,1,49,17,38,1,3,49,45,11,24,37,1,43,53,0,43,53,0,255,255,0,120,254,81,4,219,5,166,2,
+38,2,196,0,0,1,7,0,142,1,87,0,0,0,23,64,13,2,1,50,17,38,2,1,3,46,49,11,24,37,1,43,53,53,0,43,53,53,0,255,255,
+0,120,254,81,4,219,5,211,2,38,2,196,0,0,1,7,0,67,1,87,0,0,0,21,180,1,46,17,38,1,184,255,174,180,43,45,11,24,
+37,1,43,53,0,43,53,0,0,3,0,72,255,228,5,99,4,125,0,52,0,64,0,78,0,122,64,76,71,53,87,53,2,117,53,133,53,2,56,
+223,39,62,223,29,3,8,0,26,65,53,76,44,49,13,7,39,29,0,39,29,29,39,0,3,7,68,221,21,7,54,49,70,49,134,49,150,49,
+4,49,3,76,13,4,8,65,16,53,26,44,3,34,52,52,16,59,198,34,10,73,199,16,22,8,22,0,63,63,237,63,237,18,57,47,18,
+23,57,18,57,18,23,57,93,1,47,47,237,18,23,57,47,47,47,17,18,23,57,17,57,57,16,237,16,237,0,93,93,49,48,1,6,6,
+7,23,22,22,23,3,46,3,39,6,6,35,34,46,2,53,52,62,2,55,38,38,53,52,62,2,51,50,30,2,21,20,14,2,7,30,3,23,54,54,
+55,37,54,54,53,52,38,35,34,6,21,20,22,3,6,6,21,20,30,2,51,50,54,55,38,38,5,14,10,36,25,97,11,30,18,196,25,53,
+52,49,21,86,204,133,121,183,122,62,29,67,108,78,65,52,51,104,158,108,108,155,101,48,46,72,90,43,22,36,34,38,
+24,13,21,9,254,144,62,50,47,48,48,50,46,110,35,28,25,40,51,26,66,82,31,53,122,2,1,45,95,40,56,8,15,10,254,240,
+12,32,33,30,12,60,53,51,88,118,67,48,92,85,74,29,56,130,57,59,101,74,42,41,69,91,51,56,88,69,56,24,21,31,27,
+28,18,24,51,26,178,31,60,33,33,46,51,35,22,64,254,195,32,77,38,25,46,35,21,37,23,38,102,255,255,0,66,253,170,
+4,178,4,136,2,38,2,220,0,0,1,7,1,81,1,42,0,0,0,11,182,1,5,64,57,54,45,37,1,43,53,0,255,255,0,90,255,232,4,229,
+6,21,2,38,2,204,0,0,1,7,0,216,1,90,0,79,0,19,64,11,1,44,11,38,1,16,44,40,10,0,37,1,43,53,0,43,53,0,255,255,0,
+90,255,232,5,69,6,21,2,38,2,208,0,0,1,7,0,216,1,139,0,79,0,19,64,11,1,46,11,38,1,17,46,42,12,3,37,1,43,53,0,
+43,53,0,0,2,0,47,0,0,5,144,5,186,0,7,0,11,0,37,64,18,11,7,5,9,1,3,127,5,3,6,145,0,10,145,8,3,5,18,0,63,63,253,
+222,237,50,1,47,253,205,50,16,206,50,49,48,19,33,17,33,17,33,17,33,17,33,17,33,47,5,97,254,50,254,59,254,50,5,
+97,250,159,3,246,254,200,253,66,2,190,2,252,254,200,0,1,0,122,0,0,5,22,5,186,0,35,0,146,64,88,94,28,1,55,25,
+199,25,2,25,28,8,27,1,152,27,232,27,248,27,3,41,27,1,27,137,26,26,17,11,10,10,19,18,20,12,17,137,35,2,2,37,9,
+8,8,1,0,0,28,91,25,1,25,79,28,1,28,178,29,20,35,178,1,17,1,97,29,1,0,29,16,29,64,29,80,29,4,29,1,29,1,27,26,8,
+11,7,178,9,3,0,63,237,50,63,51,57,57,47,47,93,93,17,51,16,237,50,16,237,93,50,93,1,47,50,47,51,51,47,51,17,57,
+47,51,253,50,50,205,50,50,47,51,17,51,47,237,93,93,113,18,57,93,49,48,0,93,19,55,33,46,3,35,33,55,33,7,33,30,
+3,23,33,7,35,14,3,7,1,33,1,53,51,50,62,2,55,122,100,1,122,7,36,52,65,36,254,230,100,4,56,100,254,251,15,27,20,
+14,2,1,27,100,205,22,89,118,138,71,2,55,254,63,254,7,224,32,63,53,39,8,3,121,226,24,46,34,21,226,226,12,31,34,
+34,14,226,57,102,81,55,10,253,184,2,43,207,21,35,46,25,0,0,1,0,14,0,0,5,48,5,186,0,30,0,143,64,72,6,9,10,5,10,
+3,12,11,4,11,11,10,10,30,16,15,0,15,2,13,14,1,14,14,15,15,12,23,133,22,22,2,32,4,5,5,1,0,16,13,9,12,133,30,6,
+3,144,2,192,2,2,2,23,23,7,17,145,29,18,15,14,0,1,14,11,10,4,5,10,10,7,3,0,63,51,47,220,205,16,221,222,220,205,
+16,205,63,237,17,57,47,1,47,93,51,51,51,237,50,50,50,205,50,50,47,51,17,18,57,47,237,18,57,47,51,16,125,135,4,
+196,196,16,135,196,196,1,51,24,47,51,16,125,135,4,196,196,16,135,196,196,49,48,19,53,55,53,7,53,55,17,33,21,
+55,21,7,21,55,21,7,17,50,62,2,53,33,20,2,6,4,35,33,17,14,156,156,156,1,153,218,218,218,218,95,129,78,34,1,157,
+92,186,254,231,190,254,103,2,24,196,70,134,70,196,70,1,78,149,99,196,99,134,99,196,99,254,60,62,111,152,90,
+172,254,233,196,107,2,94,0,0,3,0,10,255,238,5,160,5,194,0,75,0,105,0,117,0,71,64,35,17,76,33,111,33,92,91,91,
+81,80,80,49,57,16,3,52,86,86,95,10,11,11,44,95,33,95,33,95,0,115,27,7,65,0,25,0,63,205,63,205,18,57,57,47,47,
+16,205,51,47,51,17,51,47,205,23,57,51,47,51,51,47,51,17,51,16,205,50,48,49,5,34,46,2,39,14,3,35,53,50,62,2,55,
+17,46,3,53,52,62,2,51,50,30,2,21,21,33,50,30,2,21,20,14,2,35,34,46,2,39,6,6,35,34,46,2,39,6,6,7,30,3,51,50,62,
+2,55,21,14,3,3,21,54,54,55,23,20,30,2,51,50,62,2,53,23,20,22,51,50,62,2,53,52,46,2,35,1,20,30,2,23,53,52,38,
+35,34,6,3,15,104,164,115,63,2,37,67,56,40,10,4,36,56,73,41,93,125,75,32,56,87,107,50,95,122,71,28,1,165,85,
+144,105,59,37,76,118,81,16,40,39,33,7,17,66,37,17,39,35,28,6,21,62,38,1,27,52,77,52,40,81,78,69,28,29,88,98,
+97,193,44,54,2,126,4,10,17,13,18,27,17,8,122,29,33,12,29,25,17,37,59,74,36,252,209,16,32,45,29,27,30,26,39,18,
+34,91,161,127,6,9,7,3,154,3,6,9,7,1,54,7,67,96,113,54,70,105,69,34,51,87,117,65,69,39,76,116,76,65,125,99,60,
+11,18,23,13,25,40,13,21,27,13,13,23,11,82,99,54,17,9,15,16,8,214,13,21,14,8,3,108,225,22,53,33,15,20,37,28,17,
+23,34,41,17,13,42,60,5,24,50,46,37,43,23,6,1,108,25,47,37,25,3,131,42,43,36,0,0,1,0,50,0,0,6,236,5,186,0,31,0,
+25,64,11,14,17,1,30,30,23,8,16,24,0,6,0,63,63,51,51,57,47,51,205,50,48,49,1,17,30,3,21,17,33,17,52,46,2,39,17,
+33,17,14,3,21,17,33,17,52,62,2,55,17,4,77,139,245,182,105,254,110,39,71,99,60,254,132,60,100,70,39,254,110,
+105,182,244,140,5,186,254,167,19,97,159,223,145,254,34,1,220,89,130,89,55,14,252,171,3,86,15,57,91,129,86,254,
+36,1,222,145,223,159,97,19,1,89,0,0,2,0,52,0,0,5,89,5,186,0,22,0,35,0,51,64,26,5,2,22,8,22,9,21,23,12,23,64,
+23,1,160,23,1,22,23,22,23,3,35,13,6,3,24,0,63,63,205,18,57,57,47,47,93,113,17,51,16,205,50,17,51,16,205,50,48,
+49,1,21,33,21,33,53,35,53,51,53,35,53,51,17,33,50,4,21,20,4,33,35,21,17,51,50,62,2,53,52,46,2,35,35,3,150,254,
+222,254,100,164,164,164,164,2,130,246,1,9,254,227,254,236,180,111,67,91,55,24,20,49,85,65,129,1,191,239,208,
+208,239,128,239,2,140,219,216,222,234,128,1,111,34,57,74,39,33,68,55,34,0,1,0,80,0,0,6,20,6,104,0,58,0,41,64,
+19,45,36,41,53,0,8,8,22,35,47,58,10,4,41,7,25,20,22,24,0,63,205,50,63,205,50,50,57,57,18,57,47,51,51,16,204,
+50,48,49,1,35,17,38,35,34,6,7,17,35,17,14,3,21,20,30,2,23,33,17,33,17,51,46,3,53,52,62,2,55,53,51,21,54,50,51,
+50,22,23,53,51,21,30,3,23,33,52,46,2,39,4,1,146,27,26,11,20,10,146,36,58,41,22,39,64,81,43,2,237,250,159,164,
+35,60,45,25,80,146,207,126,146,7,13,8,17,32,17,146,113,193,142,82,1,254,148,25,44,61,37,3,47,1,146,3,1,1,254,
+109,1,101,21,64,88,112,70,105,157,114,75,22,254,168,1,88,46,107,123,137,77,117,211,169,118,25,166,150,1,1,1,
+151,170,23,102,161,224,145,74,116,88,62,20,0,0,0,1,0,0,11,174,0,1,1,240,6,0,0,8,5,160,0,3,0,36,0,0,0,3,0,55,0,
+0,0,3,0,57,0,0,0,3,0,58,0,0,0,3,0,60,0,0,0,3,0,181,0,0,0,3,0,182,0,0,0,15,0,3,0,0,0,15,0,181,0,0,0,15,0,183,0,
+0,0,17,0,3,0,0,0,17,0,181,0,0,0,17,0,183,0,0,0,29,0,3,0,0,0,30,0,3,0,0,0,36,0,38,255,219,0,36,0,42,255,219,0,
+36,0,50,255,219,0,36,0,52,255,217,0,36,0,55,255,115,0,36,0,56,255,186,0,36,0,57,255,143,0,36,0,58,0,16,0,36,0,
+60,255,82,0,36,0,83,0,35,0,36,0,88,255,236,0,36,0,89,255,221,0,36,0,90,0,0,0,36,0,92,0,0,0,36,0,181,255,117,0,
+36,0,183,255,119,0,37,0,15,0,51,0,37,0,17,0,33,0,37,0,36,255,221,0,37,0,56,255,203,0,37,0,98,255,221,0,37,0,
+99,255,221,0,37,0,104,255,203,0,38,0,15,0,51,0,38,0,17,0,35,0,39,0,15,255,236,0,39,0,17,255,221,0,39,0,36,255,
+168,0,39,0,57,255,186,0,39,0,58,0,35,0,39,0,60,255,186,0,39,0,98,255,168,0,39,0,99,255,168,0,41,0,15,254,213,
+0,41,0,17,254,199,0,41,0,36,255,63,0,41,0,68,255,203,0,41,0,72,255,186,0,41,0,79,0,16,0,41,0,82,255,186,0,41,
+0,85,255,186,0,41,0,98,255,63,0,41,0,99,255,63,0,41,0,108,255,203,0,41,0,110,255,203,0,41,0,124,255,186,0,42,
+0,15,0,33,0,42,0,17,0,20,0,45,0,15,255,219,0,45,0,17,255,203,0,45,0,29,0,0,0,45,0,30,0,0,0,45,0,36,255,203,0,
+45,0,68,255,221,0,45,0,72,255,203,0,45,0,82,255,203,0,45,0,88,255,203,0,45,0,92,255,221,0,45,0,98,255,203,0,
+45,0,99,255,203,0,45,0,108,255,221,0,45,0,110,255,221,0,45,0,124,255,203,0,45,0,129,255,203,0,46,0,38,255,186,
+0,46,0,42,255,186,0,46,0,50,255,186,0,46,0,68,0,0,0,46,0,72,255,186,0,46,0,82,255,186,0,46,0,88,255,203,0,46,
+0,89,255,221,0,46,0,90,0,0,0,46,0,92,255,221,0,46,0,103,255,186,0,46,0,108,0,0,0,46,0,110,0,0,0,46,0,124,255,
+186,0,46,0,129,255,203,0,47,0,38,255,221,0,47,0,42,255,221,0,47,0,50,255,221,0,47,0,55,255,152,0,47,0,56,255,
+203,0,47,0,57,255,152,0,47,0,58,255,221,0,47,0,60,255,98,0,47,0,90,255,221,0,47,0,92,255,236,0,47,0,103,255,
+221,0,47,0,104,255,203,0,47,0,181,255,152,0,47,0,183,255,152,0,49,0,15,0,0,0,49,0,17,0,0,0,49,0,36,255,236,0,
+49,0,98,255,236,0,49,0,99,255,236,0,50,0,15,255,221,0,50,0,17,255,203,0,50,0,36,255,186,0,50,0,55,255,203,0,
+50,0,57,255,168,0,50,0,58,255,221,0,50,0,59,255,150,0,50,0,60,255,117,0,50,0,98,255,186,0,50,0,99,255,186,0,
+51,0,15,254,143,0,51,0,17,254,127,0,51,0,36,255,82,0,51,0,68,255,221,0,51,0,72,255,203,0,51,0,82,255,203,0,51,
+0,98,255,82,0,51,0,99,255,82,0,51,0,110,255,221,0,52,0,15,0,68,0,52,0,17,0,35,0,52,0,36,0,35,0,52,0,55,255,
+219,0,52,0,56,0,0,0,52,0,57,255,168,0,52,0,58,0,0,0,52,0,60,255,152,0,53,0,38,255,219,0,53,0,42,255,219,0,53,
+0,50,255,221,0,53,0,52,255,215,0,53,0,55,255,238,0,53,0,56,255,221,0,53,0,57,255,221,0,53,0,58,0,0,0,53,0,60,
+255,168,0,53,0,68,0,0,0,53,0,72,255,205,0,53,0,82,255,203,0,53,0,88,255,221,0,53,0,89,0,0,0,53,0,90,0,35,0,53,
+0,92,0,0,0,53,0,103,255,221,0,53,0,104,255,221,0,53,0,108,0,0,0,53,0,110,0,0,0,53,0,124,255,203,0,53,0,129,
+255,221,0,54,0,15,0,0,0,54,0,17,0,0,0,55,0,15,254,213,0,55,0,16,255,117,0,55,0,17,254,199,0,55,0,29,255,186,0,
+55,0,30,255,186,0,55,0,36,255,117,0,55,0,38,255,186,0,55,0,42,255,186,0,55,0,50,255,186,0,55,0,52,255,186,0,
+55,0,68,255,152,0,55,0,70,255,133,0,55,0,72,255,133,0,55,0,75,0,55,0,55,0,79,0,39,0,55,0,80,255,168,0,55,0,82,
+255,117,0,55,0,85,255,168,0,55,0,86,255,117,0,55,0,88,255,168,0,55,0,90,255,236,0,55,0,92,255,221,0,55,0,93,
+255,186,0,55,0,98,255,117,0,55,0,99,255,117,0,55,0,103,255,186,0,55,0,110,255,152,0,56,0,15,255,203,0,56,0,17,
+255,186,0,56,0,36,255,186,0,56,0,98,255,186,0,56,0,99,255,186,0,57,0,15,255,10,0,57,0,16,255,168,0,57,0,17,
+254,250,0,57,0,29,255,203,0,57,0,30,255,203,0,57,0,36,255,139,0,57,0,38,255,186,0,57,0,42,255,186,0,57,0,50,
+255,186,0,57,0,52,255,186,0,57,0,68,255,168,0,57,0,72,255,152,0,57,0,76,0,33,0,57,0,82,255,152,0,57,0,85,255,
+186,0,57,0,88,255,186,0,57,0,92,0,0,0,57,0,98,255,139,0,57,0,99,255,139,0,57,0,103,255,186,0,57,0,110,255,168,
+0,58,0,15,255,168,0,58,0,16,255,236,0,58,0,17,255,150,0,58,0,29,0,0,0,58,0,30,0,0,0,58,0,36,0,0,0,58,0,38,255,
+221,0,58,0,42,255,221,0,58,0,50,255,221,0,58,0,68,255,221,0,58,0,71,255,203,0,58,0,72,255,203,0,58,0,75,0,68,
+0,58,0,76,0,68,0,58,0,82,255,203,0,58,0,85,0,0,0,58,0,88,255,221,0,58,0,92,0,0,0,58,0,98,0,0,0,58,0,99,0,0,0,
+58,0,103,255,221,0,58,0,110,255,221,0,59,0,38,255,186,0,59,0,42,255,186,0,59,0,50,255,186,0,59,0,103,255,186,
+0,60,0,15,254,180,0,60,0,16,255,80,0,60,0,17,254,164,0,60,0,29,255,133,0,60,0,30,255,133,0,60,0,36,255,63,0,
+60,0,38,255,133,0,60,0,42,255,133,0,60,0,50,255,133,0,60,0,54,255,168,0,60,0,68,255,80,0,60,0,71,255,63,0,60,
+0,72,255,63,0,60,0,76,0,0,0,60,0,82,255,82,0,60,0,83,255,152,0,60,0,84,255,82,0,60,0,88,255,133,0,60,0,89,255,
+203,0,60,0,98,255,63,0,60,0,99,255,63,0,60,0,103,255,133,0,60,0,110,255,80,0,68,0,69,0,20,0,68,0,74,0,33,0,68,
+0,83,0,20,0,68,0,87,255,221,0,68,0,89,255,221,0,68,0,90,0,0,0,68,0,92,0,0,0,69,0,15,0,0,0,69,0,17,0,0,0,69,0,
+69,0,20,0,69,0,79,0,0,0,69,0,88,0,0,0,69,0,89,255,203,0,69,0,90,0,0,0,69,0,92,0,0,0,69,0,129,0,0,0,70,0,15,0,
+0,0,70,0,17,0,0,0,70,0,75,255,221,0,70,0,78,255,221,0,70,0,79,255,203,0,70,0,92,255,221,0,71,0,71,0,20,0,71,0,
+89,0,0,0,71,0,90,0,20,0,71,0,92,0,0,0,72,0,15,0,0,0,72,0,17,0,0,0,72,0,69,255,236,0,72,0,74,0,51,0,72,0,83,0,
+0,0,72,0,89,255,203,0,72,0,90,0,0,0,72,0,91,255,203,0,72,0,92,0,0,0,72,0,93,0,0,0,73,0,3,0,119,0,73,0,4,0,170,
+0,73,0,15,255,150,0,73,0,17,255,133,0,73,0,34,0,170,0,73,0,68,255,236,0,73,0,72,255,221,0,73,0,73,0,51,0,73,0,
+78,0,20,0,73,0,79,0,0,0,73,0,82,255,221,0,73,0,181,0,170,0,73,0,183,0,170,0,73,0,215,0,0,0,74,0,15,0,0,0,74,0,
+17,0,0,0,74,0,68,0,0,0,74,0,72,0,0,0,74,0,74,0,20,0,74,0,79,0,20,0,74,0,82,0,0,0,74,0,85,0,37,0,74,0,92,0,35,
+0,74,0,108,0,0,0,74,0,110,0,0,0,74,0,124,0,0,0,75,0,92,0,0,0,76,0,89,0,0,0,78,0,72,255,186,0,78,0,82,255,186,
+0,78,0,92,0,35,0,78,0,124,255,186,0,79,0,90,0,0,0,79,0,92,0,35,0,80,0,88,0,0,0,80,0,92,0,0,0,80,0,129,0,0,0,
+81,0,88,0,0,0,81,0,89,255,201,0,81,0,92,0,0,0,81,0,129,0,0,0,81,0,183,255,221,0,82,0,15,255,236,0,82,0,17,255,
+221,0,82,0,74,0,0,0,82,0,89,255,186,0,82,0,90,255,219,0,82,0,91,255,184,0,82,0,92,255,221,0,82,0,93,0,35,0,83,
+0,15,255,236,0,83,0,17,255,221,0,83,0,90,255,203,0,83,0,92,255,221,0,83,0,93,0,0,0,85,0,15,255,117,0,85,0,16,
+0,0,0,85,0,17,255,98,0,85,0,29,0,86,0,85,0,30,0,86,0,85,0,68,0,35,0,85,0,70,0,35,0,85,0,71,0,51,0,85,0,72,0,
+33,0,85,0,74,0,51,0,85,0,77,0,86,0,85,0,78,0,68,0,85,0,79,0,68,0,85,0,80,0,102,0,85,0,81,0,102,0,85,0,82,0,33,
+0,85,0,83,0,86,0,85,0,84,0,51,0,85,0,85,0,86,0,85,0,86,0,51,0,85,0,87,0,102,0,85,0,88,0,68,0,85,0,89,0,119,0,
+85,0,92,0,119,0,85,0,108,0,35,0,85,0,110,0,35,0,85,0,124,0,33,0,85,0,129,0,68,0,86,0,15,0,0,0,86,0,17,0,0,0,
+86,0,90,255,203,0,89,0,15,255,82,0,89,0,17,255,66,0,89,0,68,0,0,0,89,0,70,255,203,0,89,0,71,255,221,0,89,0,72,
+255,203,0,89,0,82,255,203,0,89,0,84,255,205,0,89,0,108,0,0,0,89,0,110,0,0,0,89,0,124,255,203,0,90,0,15,255,98,
+0,90,0,17,255,82,0,90,0,68,255,233,0,90,0,70,255,236,0,90,0,71,255,233,0,90,0,72,255,233,0,90,0,75,0,35,0,90,
+0,82,255,221,0,90,0,84,255,221,0,90,0,108,255,233,0,90,0,110,255,233,0,90,0,124,255,221,0,91,0,70,255,221,0,
+91,0,71,255,221,0,91,0,72,255,221,0,91,0,82,255,221,0,91,0,124,255,221,0,92,0,15,255,82,0,92,0,17,255,63,0,92,
+0,68,255,221,0,92,0,70,255,221,0,92,0,71,255,221,0,92,0,72,255,221,0,92,0,74,0,0,0,92,0,82,255,221,0,92,0,108,
+255,221,0,92,0,110,255,221,0,92,0,124,255,221,0,93,0,70,255,236,0,93,0,71,255,236,0,93,0,72,255,236,0,93,0,82,
+255,236,0,93,0,124,255,236,0,98,0,38,255,219,0,98,0,42,255,219,0,98,0,50,255,219,0,98,0,52,255,217,0,98,0,55,
+255,115,0,98,0,56,255,186,0,98,0,57,255,143,0,98,0,58,0,16,0,98,0,60,255,82,0,98,0,88,255,236,0,98,0,89,255,
+221,0,98,0,90,0,0,0,98,0,92,0,0,0,98,0,181,255,117,0,98,0,183,255,119,0,99,0,38,255,219,0,99,0,42,255,219,0,
+99,0,50,255,219,0,99,0,52,255,217,0,99,0,55,255,115,0,99,0,56,255,186,0,99,0,57,255,143,0,99,0,58,0,16,0,99,0,
+60,255,82,0,99,0,89,255,221,0,99,0,90,0,0,0,99,0,92,0,0,0,99,0,181,255,117,0,99,0,183,255,119,0,103,0,36,255,
+186,0,103,0,55,255,203,0,103,0,57,255,168,0,103,0,58,255,221,0,103,0,59,255,150,0,103,0,60,255,117,0,104,0,36,
+255,186,0,108,0,89,255,221,0,108,0,90,0,0,0,108,0,92,0,0,0,110,0,89,255,221,0,110,0,90,0,0,0,110,0,92,0,0,0,
+124,0,89,255,186,0,124,0,90,255,219,0,124,0,91,255,184,0,124,0,92,255,221,0,124,0,93,0,35,0,180,0,36,255,117,
+0,180,0,98,255,117,0,180,0,99,255,117,0,181,0,3,0,0,0,182,0,36,255,133,0,182,0,98,255,133,0,182,0,99,255,133,
+0,182,0,182,0,0,0,183,0,3,0,0,0,183,0,71,255,221,0,183,0,79,0,35,0,183,0,85,0,20,0,183,0,86,255,203,0,183,0,
+87,0,0,0,183,0,89,0,35,0,183,0,183,0,0,0,196,0,196,255,139,0,0,0,0,0,75,3,138,0,1,0,0,0,0,0,0,0,53,0,0,0,1,0,
+0,0,0,0,1,0,11,0,53,0,1,0,0,0,0,0,2,0,7,0,64,0,1,0,0,0,0,0,3,0,30,0,71,0,1,0,0,0,0,0,4,0,11,0,53,0,1,0,0,0,0,
+0,5,0,12,0,101,0,1,0,0,0,0,0,6,0,11,0,113,0,1,0,0,0,0,0,7,0,49,0,124,0,1,0,0,0,0,0,16,0,5,0,53,0,1,0,0,0,0,0,
+17,0,5,0,59,0,3,0,1,4,3,0,2,0,12,0,173,0,3,0,1,4,3,0,4,0,36,0,185,0,3,0,1,4,5,0,2,0,16,0,221,0,3,0,1,4,5,0,4,
+0,40,0,237,0,3,0,1,4,6,0,2,0,12,1,21,0,3,0,1,4,6,0,4,0,36,1,33,0,3,0,1,4,7,0,2,0,16,1,69,0,3,0,1,4,7,0,4,0,40,
+1,85,0,3,0,1,4,8,0,2,0,16,1,125,0,3,0,1,4,8,0,4,0,40,1,141,0,3,0,1,4,9,0,0,0,106,1,181,0,3,0,1,4,9,0,1,0,22,0,
+185,0,3,0,1,4,9,0,2,0,14,2,31,0,3,0,1,4,9,0,3,0,60,2,45,0,3,0,1,4,9,0,4,0,22,0,185,0,3,0,1,4,9,0,5,0,24,2,105,
+0,3,0,1,4,9,0,6,0,22,2,129,0,3,0,1,4,9,0,7,0,98,2,151,0,3,0,1,4,9,0,8,0,48,1,195,0,3,0,1,4,9,0,9,0,138,2,249,
+0,3,0,1,4,9,0,10,4,252,3,131,0,3,0,1,4,9,0,11,0,102,8,127,0,3,0,1,4,9,0,12,0,104,8,229,0,3,0,1,4,9,0,13,3,136,
+9,77,0,3,0,1,4,9,0,14,0,70,12,213,0,3,0,1,4,9,0,16,0,10,0,185,0,3,0,1,4,9,0,17,0,10,0,197,0,3,0,1,4,10,0,2,0,
+12,0,173,0,3,0,1,4,10,0,4,0,36,0,185,0,3,0,1,4,11,0,2,0,16,13,27,0,3,0,1,4,11,0,4,0,40,13,43,0,3,0,1,4,12,0,2,
+0,12,0,173,0,3,0,1,4,12,0,4,0,36,0,185,0,3,0,1,4,14,0,2,0,12,13,83,0,3,0,1,4,14,0,4,0,36,13,95,0,3,0,1,4,16,0,
+2,0,14,13,131,0,3,0,1,4,16,0,4,0,38,13,145,0,3,0,1,4,19,0,2,0,18,13,183,0,3,0,1,4,19,0,4,0,42,13,201,0,3,0,1,
+4,20,0,2,0,12,0,173,0,3,0,1,4,20,0,4,0,36,0,185,0,3,0,1,4,21,0,2,0,16,13,243,0,3,0,1,4,21,0,4,0,40,14,3,0,3,0,
+1,4,22,0,2,0,12,0,173,0,3,0,1,4,22,0,4,0,36,0,185,0,3,0,1,4,25,0,2,0,14,14,43,0,3,0,1,4,25,0,4,0,38,14,57,0,3,
+0,1,4,27,0,2,0,16,14,95,0,3,0,1,4,27,0,4,0,40,14,111,0,3,0,1,4,29,0,2,0,12,0,173,0,3,0,1,4,29,0,4,0,36,0,185,
+0,3,0,1,4,31,0,2,0,12,0,173,0,3,0,1,4,31,0,4,0,36,0,185,0,3,0,1,4,36,0,2,0,14,14,151,0,3,0,1,4,36,0,4,0,38,14,
+165,0,3,0,1,4,45,0,2,0,14,14,203,0,3,0,1,4,45,0,4,0,38,14,217,0,3,0,1,8,10,0,2,0,12,0,173,0,3,0,1,8,10,0,4,0,
+36,0,185,0,3,0,1,8,22,0,2,0,12,0,173,0,3,0,1,8,22,0,4,0,36,0,185,0,3,0,1,12,10,0,2,0,12,0,173,0,3,0,1,12,10,0,
+4,0,36,0,185,0,3,0,1,12,12,0,2,0,12,0,173,0,3,0,1,12,12,0,4,0,36,0,185,169,32,50,48,49,54,32,84,104,101,32,77,
+111,110,111,116,121,112,101,32,67,111,114,112,111,114,97,116,105,111,110,46,32,65,108,108,32,82,105,103,104,
+116,115,32,82,101,115,101,114,118,101,100,46,65,114,105,97,108,32,66,108,97,99,107,82,101,103,117,108,97,114,
+77,111,110,111,116,121,112,101,32,45,32,65,114,105,97,108,32,66,108,97,99,107,32,82,101,103,117,108,97,114,86,
+101,114,115,105,111,110,32,53,46,50,51,65,114,105,97,108,45,66,108,97,99,107,65,114,105,97,108,32,105,115,32,
+97,32,116,114,97,100,101,109,97,114,107,32,111,102,32,84,104,101,32,77,111,110,111,116,121,112,101,32,67,111,
+114,112,111,114,97,116,105,111,110,46,0,78,0,111,0,114,0,109,0,97,0,108,0,65,0,114,0,105,0,97,0,108,0,32,0,66,
+0,108,0,97,0,99,0,107,0,32,0,78,0,111,0,114,0,109,0,97,0,108,0,111,0,98,0,121,1,13,0,101,0,106,0,110,0,233,0,
+65,0,114,0,105,0,97,0,108,0,32,0,66,0,108,0,97,0,99,0,107,0,32,0,111,0,98,0,121,1,13,0,101,0,106,0,110,0,233,
+0,110,0,111,0,114,0,109,0,97,0,108,0,65,0,114,0,105,0,97,0,108,0,32,0,66,0,108,0,97,0,99,0,107,0,32,0,110,0,
+111,0,114,0,109,0,97,0,108,0,83,0,116,0,97,0,110,0,100,0,97,0,114,0,100,0,65,0,114,0,105,0,97,0,108,0,32,0,66,
+0,108,0,97,0,99,0,107,0,32,0,83,0,116,0,97,0,110,0,100,0,97,0,114,0,100,3,154,3,177,3,189,3,191,3,189,3,185,3,
+186,3,172,0,65,0,114,0,105,0,97,0,108,0,32,0,66,0,108,0,97,0,99,0,107,0,32,3,154,3,177,3,189,3,191,3,189,3,
+185,3,186,3,172,0,169,0,32,0,50,0,48,0,49,0,54,0,32,0,84,0,104,0,101,0,32,0,77,0,111,0,110,0,111,0,116,0,121,
+0,112,0,101,0,32,0,67,0,111,0,114,0,112,0,111,0,114,0,97,0,116,0,105,0,111,0,110,0,46,0,32,0,65,0,108,0,108,0,
+32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,114,0,118,0,101,0,100,0,46,0,82,0,101,0,
+103,0,117,0,108,0,97,0,114,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,45,0,32,0,65,0,114,0,105,0,
+97,0,108,0,32,0,66,0,108,0,97,0,99,0,107,0,32,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,86,0,101,0,114,0,115,
+0,105,0,111,0,110,0,32,0,53,0,46,0,50,0,51,0,65,0,114,0,105,0,97,0,108,0,45,0,66,0,108,0,97,0,99,0,107,0,65,0,
+114,0,105,0,97,0,108,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,
+0,111,0,102,0,32,0,84,0,104,0,101,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,67,0,111,0,114,0,
+112,0,111,0,114,0,97,0,116,0,105,0,111,0,110,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,84,0,
+121,0,112,0,101,0,32,0,68,0,114,0,97,0,119,0,105,0,110,0,103,0,32,0,79,0,102,0,102,0,105,0,99,0,101,0,32,0,45,
+0,32,0,82,0,111,0,98,0,105,0,110,0,32,0,78,0,105,0,99,0,104,0,111,0,108,0,97,0,115,0,44,0,32,0,80,0,97,0,116,
+0,114,0,105,0,99,0,105,0,97,0,32,0,83,0,97,0,117,0,110,0,100,0,101,0,114,0,115,0,32,0,49,0,57,0,56,0,50,0,77,
+0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,114,0,97,0,119,0,105,0,110,0,103,0,32,0,79,0,102,0,102,
+0,105,0,99,0,101,0,32,0,49,0,57,0,56,0,50,0,46,0,32,0,65,0,32,0,99,0,111,0,110,0,116,0,101,0,109,0,112,0,111,
+0,114,0,97,0,114,0,121,0,32,0,115,0,97,0,110,0,115,0,32,0,115,0,101,0,114,0,105,0,102,0,32,0,100,0,101,0,115,
+0,105,0,103,0,110,0,44,0,32,0,65,0,114,0,105,0,97,0,108,0,32,0,99,0,111,0,110,0,116,0,97,0,105,0,110,0,115,0,
+32,0,109,0,111,0,114,0,101,0,32,0,104,0,117,0,109,0,97,0,110,0,105,0,115,0,116,0,32,0,99,0,104,0,97,0,114,0,
+97,0,99,0,116,0,101,0,114,0,105,0,115,0,116,0,105,0,99,0,115,0,32,0,116,0,104,0,97,0,110,0,32,0,109,0,97,0,
+110,0,121,0,32,0,111,0,102,0,32,0,105,0,116,0,115,0,32,0,112,0,114,0,101,0,100,0,101,0,99,0,101,0,115,0,115,0,
+111,0,114,0,115,0,32,0,97,0,110,0,100,0,32,0,97,0,115,0,32,0,115,0,117,0,99,0,104,0,32,0,105,0,115,0,32,0,109,
+0,111,0,114,0,101,0,32,0,105,0,110,0,32,0,116,0,117,0,110,0,101,0,32,0,119,0,105,0,116,0,104,0,32,0,116,0,104,
+0,101,0,32,0,109,0,111,0,111,0,100,0,32,0,111,0,102,0,32,0,116,0,104,0,101,0,32,0,108,0,97,0,115,0,116,0,32,0,
+100,0,101,0,99,0,97,0,100,0,101,0,115,0,32,0,111,0,102,0,32,0,116,0,104,0,101,0,32,0,116,0,119,0,101,0,110,0,
+116,0,105,0,101,0,116,0,104,0,32,0,99,0,101,0,110,0,116,0,117,0,114,0,121,0,46,0,32,0,84,0,104,0,101,0,32,0,
+111,0,118,0,101,0,114,0,97,0,108,0,108,0,32,0,116,0,114,0,101,0,97,0,116,0,109,0,101,0,110,0,116,0,32,0,111,0,
+102,0,32,0,99,0,117,0,114,0,118,0,101,0,115,0,32,0,105,0,115,0,32,0,115,0,111,0,102,0,116,0,101,0,114,0,32,0,
+97,0,110,0,100,0,32,0,102,0,117,0,108,0,108,0,101,0,114,0,32,0,116,0,104,0,97,0,110,0,32,0,105,0,110,0,32,0,
+109,0,111,0,115,0,116,0,32,0,105,0,110,0,100,0,117,0,115,0,116,0,114,0,105,0,97,0,108,0,45,0,115,0,116,0,121,
+0,108,0,101,0,32,0,115,0,97,0,110,0,115,0,32,0,115,0,101,0,114,0,105,0,102,0,32,0,102,0,97,0,99,0,101,0,115,0,
+46,0,32,0,84,0,101,0,114,0,109,0,105,0,110,0,97,0,108,0,32,0,115,0,116,0,114,0,111,0,107,0,101,0,115,0,32,0,
+97,0,114,0,101,0,32,0,99,0,117,0,116,0,32,0,111,0,110,0,32,0,116,0,104,0,101,0,32,0,100,0,105,0,97,0,103,0,
+111,0,110,0,97,0,108,0,32,0,119,0,104,0,105,0,99,0,104,0,32,0,104,0,101,0,108,0,112,0,115,0,32,0,116,0,111,0,
+32,0,103,0,105,0,118,0,101,0,32,0,116,0,104,0,101,0,32,0,102,0,97,0,99,0,101,0,32,0,97,0,32,0,108,0,101,0,115,
+0,115,0,32,0,109,0,101,0,99,0,104,0,97,0,110,0,105,0,99,0,97,0,108,0,32,0,97,0,112,0,112,0,101,0,97,0,114,0,
+97,0,110,0,99,0,101,0,46,0,32,0,65,0,114,0,105,0,97,0,108,0,32,0,105,0,115,0,32,0,97,0,110,0,32,0,101,0,120,0,
+116,0,114,0,101,0,109,0,101,0,108,0,121,0,32,0,118,0,101,0,114,0,115,0,97,0,116,0,105,0,108,0,101,0,32,0,102,
+0,97,0,109,0,105,0,108,0,121,0,32,0,111,0,102,0,32,0,116,0,121,0,112,0,101,0,102,0,97,0,99,0,101,0,115,0,32,0,
+119,0,104,0,105,0,99,0,104,0,32,0,99,0,97,0,110,0,32,0,98,0,101,0,32,0,117,0,115,0,101,0,100,0,32,0,119,0,105,
+0,116,0,104,0,32,0,101,0,113,0,117,0,97,0,108,0,32,0,115,0,117,0,99,0,99,0,101,0,115,0,115,0,32,0,102,0,111,0,
+114,0,32,0,116,0,101,0,120,0,116,0,32,0,115,0,101,0,116,0,116,0,105,0,110,0,103,0,32,0,105,0,110,0,32,0,114,0,
+101,0,112,0,111,0,114,0,116,0,115,0,44,0,32,0,112,0,114,0,101,0,115,0,101,0,110,0,116,0,97,0,116,0,105,0,111,
+0,110,0,115,0,44,0,32,0,109,0,97,0,103,0,97,0,122,0,105,0,110,0,101,0,115,0,32,0,101,0,116,0,99,0,44,0,32,0,
+97,0,110,0,100,0,32,0,102,0,111,0,114,0,32,0,100,0,105,0,115,0,112,0,108,0,97,0,121,0,32,0,117,0,115,0,101,0,
+32,0,105,0,110,0,32,0,110,0,101,0,119,0,115,0,112,0,97,0,112,0,101,0,114,0,115,0,44,0,32,0,97,0,100,0,118,0,
+101,0,114,0,116,0,105,0,115,0,105,0,110,0,103,0,32,0,97,0,110,0,100,0,32,0,112,0,114,0,111,0,109,0,111,0,116,
+0,105,0,111,0,110,0,115,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,
+0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,104,0,116,0,109,0,108,0,47,0,109,0,116,0,110,0,97,
+0,109,0,101,0,47,0,109,0,115,0,95,0,119,0,101,0,108,0,99,0,111,0,109,0,101,0,46,0,104,0,116,0,109,0,108,0,104,
+0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,
+0,99,0,111,0,109,0,47,0,104,0,116,0,109,0,108,0,47,0,100,0,101,0,115,0,105,0,103,0,110,0,101,0,114,0,47,0,100,
+0,101,0,115,0,95,0,105,0,110,0,100,0,101,0,120,0,46,0,104,0,116,0,109,0,108,0,77,0,105,0,99,0,114,0,111,0,115,
+0,111,0,102,0,116,0,32,0,115,0,117,0,112,0,112,0,108,0,105,0,101,0,100,0,32,0,102,0,111,0,110,0,116,0,46,0,32,
+0,89,0,111,0,117,0,32,0,109,0,97,0,121,0,32,0,117,0,115,0,101,0,32,0,116,0,104,0,105,0,115,0,32,0,102,0,111,0,
+110,0,116,0,32,0,116,0,111,0,32,0,99,0,114,0,101,0,97,0,116,0,101,0,44,0,32,0,100,0,105,0,115,0,112,0,108,0,
+97,0,121,0,44,0,32,0,97,0,110,0,100,0,32,0,112,0,114,0,105,0,110,0,116,0,32,0,99,0,111,0,110,0,116,0,101,0,
+110,0,116,0,32,0,97,0,115,0,32,0,112,0,101,0,114,0,109,0,105,0,116,0,116,0,101,0,100,0,32,0,98,0,121,0,32,0,
+116,0,104,0,101,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,116,0,101,0,114,0,109,0,115,0,32,0,111,0,
+114,0,32,0,116,0,101,0,114,0,109,0,115,0,32,0,111,0,102,0,32,0,117,0,115,0,101,0,44,0,32,0,111,0,102,0,32,0,
+116,0,104,0,101,0,32,0,77,0,105,0,99,0,114,0,111,0,115,0,111,0,102,0,116,0,32,0,112,0,114,0,111,0,100,0,117,0,
+99,0,116,0,44,0,32,0,115,0,101,0,114,0,118,0,105,0,99,0,101,0,44,0,32,0,111,0,114,0,32,0,99,0,111,0,110,0,116,
+0,101,0,110,0,116,0,32,0,105,0,110,0,32,0,119,0,104,0,105,0,99,0,104,0,32,0,116,0,104,0,105,0,115,0,32,0,102,
+0,111,0,110,0,116,0,32,0,119,0,97,0,115,0,32,0,105,0,110,0,99,0,108,0,117,0,100,0,101,0,100,0,46,0,32,0,89,0,
+111,0,117,0,32,0,109,0,97,0,121,0,32,0,111,0,110,0,108,0,121,0,32,0,40,0,105,0,41,0,32,0,101,0,109,0,98,0,101,
+0,100,0,32,0,116,0,104,0,105,0,115,0,32,0,102,0,111,0,110,0,116,0,32,0,105,0,110,0,32,0,99,0,111,0,110,0,116,
+0,101,0,110,0,116,0,32,0,97,0,115,0,32,0,112,0,101,0,114,0,109,0,105,0,116,0,116,0,101,0,100,0,32,0,98,0,121,
+0,32,0,116,0,104,0,101,0,32,0,101,0,109,0,98,0,101,0,100,0,100,0,105,0,110,0,103,0,32,0,114,0,101,0,115,0,116,
+0,114,0,105,0,99,0,116,0,105,0,111,0,110,0,115,0,32,0,105,0,110,0,99,0,108,0,117,0,100,0,101,0,100,0,32,0,105,
+0,110,0,32,0,116,0,104,0,105,0,115,0,32,0,102,0,111,0,110,0,116,0,59,0,32,0,97,0,110,0,100,0,32,0,40,0,105,0,
+105,0,41,0,32,0,116,0,101,0,109,0,112,0,111,0,114,0,97,0,114,0,105,0,108,0,121,0,32,0,100,0,111,0,119,0,110,0,
+108,0,111,0,97,0,100,0,32,0,116,0,104,0,105,0,115,0,32,0,102,0,111,0,110,0,116,0,32,0,116,0,111,0,32,0,97,0,
+32,0,112,0,114,0,105,0,110,0,116,0,101,0,114,0,32,0,111,0,114,0,32,0,111,0,116,0,104,0,101,0,114,0,32,0,111,0,
+117,0,116,0,112,0,117,0,116,0,32,0,100,0,101,0,118,0,105,0,99,0,101,0,32,0,116,0,111,0,32,0,104,0,101,0,108,0,
+112,0,32,0,112,0,114,0,105,0,110,0,116,0,32,0,99,0,111,0,110,0,116,0,101,0,110,0,116,0,46,0,32,0,65,0,110,0,
+121,0,32,0,111,0,116,0,104,0,101,0,114,0,32,0,117,0,115,0,101,0,32,0,105,0,115,0,32,0,112,0,114,0,111,0,104,0,
+105,0,98,0,105,0,116,0,101,0,100,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,
+105,0,99,0,114,0,111,0,115,0,111,0,102,0,116,0,46,0,99,0,111,0,109,0,47,0,116,0,121,0,112,0,111,0,103,0,114,0,
+97,0,112,0,104,0,121,0,78,0,111,0,114,0,109,0,97,0,97,0,108,0,105,0,65,0,114,0,105,0,97,0,108,0,32,0,66,0,108,
+0,97,0,99,0,107,0,32,0,78,0,111,0,114,0,109,0,97,0,97,0,108,0,105,0,78,0,111,0,114,0,109,0,225,0,108,0,65,0,
+114,0,105,0,97,0,108,0,32,0,66,0,108,0,97,0,99,0,107,0,32,0,78,0,111,0,114,0,109,0,225,0,108,0,78,0,111,0,114,
+0,109,0,97,0,108,0,101,0,65,0,114,0,105,0,97,0,108,0,32,0,66,0,108,0,97,0,99,0,107,0,32,0,78,0,111,0,114,0,
+109,0,97,0,108,0,101,0,83,0,116,0,97,0,110,0,100,0,97,0,97,0,114,0,100,0,65,0,114,0,105,0,97,0,108,0,32,0,66,
+0,108,0,97,0,99,0,107,0,32,0,83,0,116,0,97,0,110,0,100,0,97,0,97,0,114,0,100,0,78,0,111,0,114,0,109,0,97,0,
+108,0,110,0,121,0,65,0,114,0,105,0,97,0,108,0,32,0,66,0,108,0,97,0,99,0,107,0,32,0,78,0,111,0,114,0,109,0,97,
+0,108,0,110,0,121,4,30,4,49,4,75,4,71,4,61,4,75,4,57,0,65,0,114,0,105,0,97,0,108,0,32,0,66,0,108,0,97,0,99,0,
+107,0,32,4,30,4,49,4,75,4,71,4,61,4,75,4,57,0,78,0,111,0,114,0,109,0,225,0,108,0,110,0,101,0,65,0,114,0,105,0,
+97,0,108,0,32,0,66,0,108,0,97,0,99,0,107,0,32,0,78,0,111,0,114,0,109,0,225,0,108,0,110,0,101,0,78,0,97,0,118,
+0,97,0,100,0,110,0,111,0,65,0,114,0,105,0,97,0,108,0,32,0,66,0,108,0,97,0,99,0,107,0,32,0,78,0,97,0,118,0,97,
+0,100,0,110,0,111,0,65,0,114,0,114,0,117,0,110,0,116,0,97,0,65,0,114,0,105,0,97,0,108,0,32,0,66,0,108,0,97,0,
+99,0,107,0,32,0,65,0,114,0,114,0,117,0,110,0,116,0,97,0,0,0,0,3,0,0,0,0,0,0,255,0,0,123,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1,0,3,0,8,0,10,0,16,0,5,255,255,0,15,0,0,0,1,0,1,0,1,0,0,0,1,0,0,29,157,0,0,0,20,0,0,0,0,
+0,0,29,149,48,130,29,145,6,9,42,134,72,134,247,13,1,7,2,160,130,29,130,48,130,29,126,2,1,1,49,11,48,9,6,5,43,
+14,3,2,26,5,0,48,97,6,10,43,6,1,4,1,130,55,2,1,4,160,83,48,81,48,44,6,10,43,6,1,4,1,130,55,2,1,28,162,30,128,
+28,0,60,0,60,0,60,0,79,0,98,0,115,0,111,0,108,0,101,0,116,0,101,0,62,0,62,0,62,48,33,48,9,6,5,43,14,3,2,26,5,
+0,4,20,89,221,150,136,103,249,181,2,81,175,230,100,67,28,163,204,51,236,84,131,160,130,24,83,48,130,4,194,48,
+130,3,170,160,3,2,1,2,2,19,51,0,0,0,193,9,248,2,65,187,77,170,220,0,0,0,0,0,193,48,13,6,9,42,134,72,134,247,
+13,1,1,5,5,0,48,119,49,11,48,9,6,3,85,4,6,19,2,85,83,49,19,48,17,6,3,85,4,8,19,10,87,97,115,104,105,110,103,
+116,111,110,49,16,48,14,6,3,85,4,7,19,7,82,101,100,109,111,110,100,49,30,48,28,6,3,85,4,10,19,21,77,105,99,
+114,111,115,111,102,116,32,67,111,114,112,111,114,97,116,105,111,110,49,33,48,31,6,3,85,4,3,19,24,77,105,99,
+114,111,115,111,102,116,32,84,105,109,101,45,83,116,97,109,112,32,80,67,65,48,30,23,13,49,54,48,57,48,55,49,
+55,53,56,53,48,90,23,13,49,56,48,57,48,55,49,55,53,56,53,48,90,48,129,178,49,11,48,9,6,3,85,4,6,19,2,85,83,49,
+19,48,17,6,3,85,4,8,19,10,87,97,115,104,105,110,103,116,111,110,49,16,48,14,6,3,85,4,7,19,7,82,101,100,109,
+111,110,100,49,30,48,28,6,3,85,4,10,19,21,77,105,99,114,111,115,111,102,116,32,67,111,114,112,111,114,97,116,
+105,111,110,49,12,48,10,6,3,85,4,11,19,3,65,79,67,49,39,48,37,6,3,85,4,11,19,30,110,67,105,112,104,101,114,32,
+68,83,69,32,69,83,78,58,49,50,69,55,45,51,48,54,52,45,54,49,49,50,49,37,48,35,6,3,85,4,3,19,28,77,105,99,114,
+111,115,111,102,116,32,84,105,109,101,45,83,116,97,109,112,32,83,101,114,118,105,99,101,48,130,1,34,48,13,6,9,
+42,134,72,134,247,13,1,1,1,5,0,3,130,1,15,0,48,130,1,10,2,130,1,1,0,167,67,31,249,151,41,124,201,66,172,56,39,
+187,130,134,129,73,182,25,68,98,234,168,25,43,128,168,106,241,209,252,56,205,54,43,230,215,146,57,1,5,205,232,
+198,66,242,28,252,5,55,144,84,165,4,24,246,177,6,203,3,209,64,215,89,179,227,145,90,198,84,228,52,99,171,234,
+102,20,128,126,242,99,3,151,208,232,14,31,79,30,125,29,250,74,139,10,52,233,205,227,10,49,141,206,20,176,129,
+181,147,52,153,73,128,200,81,173,13,176,26,79,229,127,230,148,123,76,87,22,162,22,175,172,211,69,17,16,219,20,
+189,97,222,13,247,105,19,118,33,46,72,208,52,72,72,214,94,250,142,64,189,231,89,107,224,75,0,49,105,5,232,39,
+31,39,97,110,137,169,142,24,57,160,126,207,206,33,216,96,169,210,100,31,213,180,96,253,160,247,45,123,199,203,
+231,26,247,205,15,239,241,86,208,45,42,56,119,102,59,200,51,160,81,167,140,130,11,131,88,84,36,252,20,242,34,
+16,12,139,101,152,45,26,245,35,56,212,89,167,212,89,122,209,1,232,220,31,143,203,27,17,159,2,3,1,0,1,163,130,
+1,9,48,130,1,5,48,29,6,3,85,29,14,4,22,4,20,229,103,54,85,95,176,249,82,197,172,75,214,110,53,191,136,58,173,
+69,175,48,31,6,3,85,29,35,4,24,48,22,128,20,35,52,248,217,82,70,112,10,237,64,251,118,251,179,43,176,195,53,
+179,15,48,84,6,3,85,29,31,4,77,48,75,48,73,160,71,160,69,134,67,104,116,116,112,58,47,47,99,114,108,46,109,
+105,99,114,111,115,111,102,116,46,99,111,109,47,112,107,105,47,99,114,108,47,112,114,111,100,117,99,116,115,
+47,77,105,99,114,111,115,111,102,116,84,105,109,101,83,116,97,109,112,80,67,65,46,99,114,108,48,88,6,8,43,6,1,
+5,5,7,1,1,4,76,48,74,48,72,6,8,43,6,1,5,5,7,48,2,134,60,104,116,116,112,58,47,47,119,119,119,46,109,105,99,
+114,111,115,111,102,116,46,99,111,109,47,112,107,105,47,99,101,114,116,115,47,77,105,99,114,111,115,111,102,
+116,84,105,109,101,83,116,97,109,112,80,67,65,46,99,114,116,48,19,6,3,85,29,37,4,12,48,10,6,8,43,6,1,5,5,7,3,
+8,48,13,6,9,42,134,72,134,247,13,1,1,5,5,0,3,130,1,1,0,52,56,11,41,116,104,193,239,205,206,238,49,222,247,116,
+236,17,182,177,114,165,222,230,8,129,0,193,175,15,55,1,98,116,157,157,121,87,2,244,40,119,184,132,73,35,53,89,
+245,235,248,244,168,224,3,118,94,64,75,66,30,153,132,89,221,26,61,65,236,95,226,56,32,148,5,215,155,233,62,
+109,177,228,97,243,153,222,15,169,22,27,57,248,193,122,189,142,169,88,30,200,30,105,9,135,59,53,56,121,245,
+172,83,65,53,133,78,215,96,225,184,246,24,175,255,251,40,131,121,218,55,122,35,206,168,200,207,186,237,93,86,
+242,75,188,74,198,231,63,61,160,4,58,24,33,225,228,205,164,153,10,133,246,250,45,158,47,145,11,221,223,19,17,
+117,234,42,57,241,135,156,68,113,211,243,6,229,103,183,117,72,187,196,163,89,220,178,254,233,83,204,28,190,
+141,17,75,113,60,159,25,9,181,246,105,94,173,103,48,125,93,187,213,101,155,133,58,96,196,4,46,131,47,104,232,
+243,56,13,31,71,32,76,250,189,21,24,200,135,215,211,209,113,161,126,105,16,212,198,206,203,10,200,48,130,6,0,
+48,130,3,232,160,3,2,1,2,2,19,51,0,0,0,195,14,155,167,216,178,220,247,44,0,0,0,0,0,195,48,13,6,9,42,134,72,
+134,247,13,1,1,11,5,0,48,126,49,11,48,9,6,3,85,4,6,19,2,85,83,49,19,48,17,6,3,85,4,8,19,10,87,97,115,104,105,
+110,103,116,111,110,49,16,48,14,6,3,85,4,7,19,7,82,101,100,109,111,110,100,49,30,48,28,6,3,85,4,10,19,21,77,
+105,99,114,111,115,111,102,116,32,67,111,114,112,111,114,97,116,105,111,110,49,40,48,38,6,3,85,4,3,19,31,77,
+105,99,114,111,115,111,102,116,32,67,111,100,101,32,83,105,103,110,105,110,103,32,80,67,65,32,50,48,49,49,48,
+30,23,13,49,55,48,56,49,49,50,48,50,48,50,52,90,23,13,49,56,48,56,49,49,50,48,50,48,50,52,90,48,116,49,11,48,
+9,6,3,85,4,6,19,2,85,83,49,19,48,17,6,3,85,4,8,19,10,87,97,115,104,105,110,103,116,111,110,49,16,48,14,6,3,85,
+4,7,19,7,82,101,100,109,111,110,100,49,30,48,28,6,3,85,4,10,19,21,77,105,99,114,111,115,111,102,116,32,67,111,
+114,112,111,114,97,116,105,111,110,49,30,48,28,6,3,85,4,3,19,21,77,105,99,114,111,115,111,102,116,32,67,111,
+114,112,111,114,97,116,105,111,110,48,130,1,34,48,13,6,9,42,134,72,134,247,13,1,1,1,5,0,3,130,1,15,0,48,130,1,
+10,2,130,1,1,0,187,87,215,56,209,177,6,127,73,45,169,109,179,99,159,122,186,182,58,33,91,180,152,174,141,212,
+164,129,160,197,117,197,44,239,130,64,42,183,129,83,119,243,99,1,10,188,206,55,132,3,64,67,87,130,75,206,237,
+31,182,253,128,109,201,194,145,93,5,199,220,86,89,0,225,12,235,87,222,253,241,184,144,39,191,117,74,252,117,
+178,114,88,182,197,72,155,51,98,5,209,149,148,165,191,57,34,173,141,18,77,70,98,218,50,25,206,170,34,92,86,72,
+177,111,69,201,103,118,98,93,48,136,163,47,40,197,31,80,42,217,134,219,26,17,37,129,194,244,245,103,46,231,
+121,29,245,226,28,117,244,78,204,199,252,231,191,11,128,71,41,255,207,205,105,177,12,11,96,235,103,230,132,27,
+155,77,253,109,71,58,199,217,193,97,97,242,149,18,161,13,7,174,99,33,216,244,153,28,255,120,85,129,238,165,
+121,232,32,130,95,10,218,181,83,25,84,1,87,13,135,145,141,194,124,241,84,134,128,225,98,219,130,115,62,38,94,
+240,64,18,210,57,213,38,3,13,133,136,49,95,10,11,139,2,3,1,0,1,163,130,1,127,48,130,1,123,48,31,6,3,85,29,37,
+4,24,48,22,6,10,43,6,1,4,1,130,55,76,8,1,6,8,43,6,1,5,5,7,3,3,48,29,6,3,85,29,14,4,22,4,20,167,19,93,31,33,
+137,85,232,3,238,158,23,54,234,242,84,136,53,25,175,48,81,6,3,85,29,17,4,74,48,72,164,70,48,68,49,12,48,10,6,
+3,85,4,11,19,3,65,79,67,49,52,48,50,6,3,85,4,5,19,43,50,51,48,48,49,50,43,99,56,48,52,98,53,101,97,45,52,57,
+98,52,45,52,50,51,56,45,56,51,54,50,45,100,56,53,49,102,97,50,50,53,52,102,99,48,31,6,3,85,29,35,4,24,48,22,
+128,20,72,110,100,229,80,5,211,130,170,23,55,55,34,181,109,168,202,117,2,149,48,84,6,3,85,29,31,4,77,48,75,48,
+73,160,71,160,69,134,67,104,116,116,112,58,47,47,119,119,119,46,109,105,99,114,111,115,111,102,116,46,99,111,
+109,47,112,107,105,111,112,115,47,99,114,108,47,77,105,99,67,111,100,83,105,103,80,67,65,50,48,49,49,95,50,48,
+49,49,45,48,55,45,48,56,46,99,114,108,48,97,6,8,43,6,1,5,5,7,1,1,4,85,48,83,48,81,6,8,43,6,1,5,5,7,48,2,134,
+69,104,116,116,112,58,47,47,119,119,119,46,109,105,99,114,111,115,111,102,116,46,99,111,109,47,112,107,105,
+111,112,115,47,99,101,114,116,115,47,77,105,99,67,111,100,83,105,103,80,67,65,50,48,49,49,95,50,48,49,49,45,
+48,55,45,48,56,46,99,114,116,48,12,6,3,85,29,19,1,1,255,4,2,48,0,48,13,6,9,42,134,72,134,247,13,1,1,11,5,0,3,
+130,2,1,0,77,151,79,52,126,241,112,147,156,227,213,26,75,156,17,126,107,38,196,165,36,244,223,68,212,36,186,
+179,106,8,137,153,154,203,49,231,112,155,255,20,29,176,7,57,127,228,48,59,19,34,222,14,200,149,103,187,110,
+126,248,124,149,164,144,130,55,147,166,131,211,73,2,193,172,173,89,239,145,183,167,102,0,14,162,76,37,212,220,
+231,93,7,2,202,40,52,101,59,57,131,173,149,42,142,202,160,232,8,58,28,254,62,123,64,73,148,77,142,84,37,10,
+229,177,199,10,238,113,55,198,155,94,54,245,167,66,68,251,188,135,176,13,192,53,217,38,135,95,255,103,239,40,
+116,247,138,48,4,17,138,103,204,75,53,96,106,33,231,195,141,7,131,94,155,171,157,113,31,41,38,9,17,212,245,
+130,211,210,54,7,41,174,232,146,109,144,127,0,201,168,91,238,208,4,101,251,161,14,87,83,204,242,152,137,243,
+159,21,147,200,6,196,99,82,97,2,79,87,72,28,245,251,117,18,202,181,249,244,194,105,95,187,161,157,13,105,131,
+39,235,131,62,29,107,49,195,238,14,241,196,132,67,135,238,49,156,6,0,50,124,183,32,138,185,8,35,234,86,176,24,
+212,178,189,21,236,55,237,100,211,107,21,2,35,198,138,51,135,58,209,155,182,192,150,89,44,160,1,83,132,1,95,
+242,123,193,122,176,236,212,216,82,246,95,117,129,68,89,22,56,39,83,187,80,243,94,113,223,247,215,81,220,49,
+213,26,99,53,42,151,126,159,102,55,95,207,85,51,239,178,202,188,44,35,170,68,30,238,251,103,72,180,232,66,195,
+15,138,81,88,162,70,2,97,38,90,25,191,92,148,233,168,64,112,231,91,48,76,124,128,212,80,103,162,165,238,14,
+235,61,181,241,229,121,30,225,245,88,25,111,187,137,109,120,226,32,88,37,255,228,72,179,230,175,241,178,64,4,
+23,70,80,212,12,108,145,20,125,238,202,226,246,38,222,27,59,4,103,81,46,15,164,23,247,66,255,63,145,137,49,
+248,167,188,179,229,58,82,220,42,51,127,74,100,145,101,216,101,17,182,219,106,183,180,108,82,252,191,139,113,
+22,196,44,206,115,154,160,233,93,8,193,69,69,165,41,134,236,1,49,109,94,116,198,86,49,11,48,130,6,7,48,130,3,
+239,160,3,2,1,2,2,10,97,22,104,52,0,0,0,0,0,28,48,13,6,9,42,134,72,134,247,13,1,1,5,5,0,48,95,49,19,48,17,6,
+10,9,146,38,137,147,242,44,100,1,25,22,3,99,111,109,49,25,48,23,6,10,9,146,38,137,147,242,44,100,1,25,22,9,
+109,105,99,114,111,115,111,102,116,49,45,48,43,6,3,85,4,3,19,36,77,105,99,114,111,115,111,102,116,32,82,111,
+111,116,32,67,101,114,116,105,102,105,99,97,116,101,32,65,117,116,104,111,114,105,116,121,48,30,23,13,48,55,
+48,52,48,51,49,50,53,51,48,57,90,23,13,50,49,48,52,48,51,49,51,48,51,48,57,90,48,119,49,11,48,9,6,3,85,4,6,19,
+2,85,83,49,19,48,17,6,3,85,4,8,19,10,87,97,115,104,105,110,103,116,111,110,49,16,48,14,6,3,85,4,7,19,7,82,101,
+100,109,111,110,100,49,30,48,28,6,3,85,4,10,19,21,77,105,99,114,111,115,111,102,116,32,67,111,114,112,111,114,
+97,116,105,111,110,49,33,48,31,6,3,85,4,3,19,24,77,105,99,114,111,115,111,102,116,32,84,105,109,101,45,83,116,
+97,109,112,32,80,67,65,48,130,1,34,48,13,6,9,42,134,72,134,247,13,1,1,1,5,0,3,130,1,15,0,48,130,1,10,2,130,1,
+1,0,159,161,108,177,223,219,72,146,42,124,107,46,25,225,189,226,227,197,153,81,35,80,173,206,221,24,78,36,15,
+238,209,167,209,76,173,116,48,32,17,235,7,213,84,149,21,73,148,27,66,146,174,152,92,48,38,218,0,107,232,123,
+189,236,137,7,15,247,14,4,152,240,137,204,31,203,51,36,135,157,242,244,103,28,44,252,123,231,136,29,234,231,
+78,163,161,193,35,83,202,141,250,69,207,9,208,94,175,208,176,66,4,162,249,166,108,147,103,215,40,220,70,83,
+176,134,208,229,40,70,46,39,172,134,79,85,82,12,228,3,44,251,106,144,144,48,110,135,243,89,48,157,250,126,214,
+151,179,232,33,151,126,248,210,19,243,8,183,83,109,82,180,69,144,159,72,0,74,71,102,17,39,41,102,168,151,228,
+211,6,129,74,162,249,132,167,17,71,20,9,130,159,132,237,85,120,254,1,154,29,80,8,133,0,16,48,70,237,183,222,
+35,70,187,196,45,84,159,175,30,120,65,49,119,204,155,223,59,131,147,161,97,2,181,29,13,177,252,247,155,178,1,
+206,34,75,84,255,249,5,195,194,32,11,2,3,1,0,1,163,130,1,171,48,130,1,167,48,15,6,3,85,29,19,1,1,255,4,5,48,3,
+1,1,255,48,29,6,3,85,29,14,4,22,4,20,35,52,248,217,82,70,112,10,237,64,251,118,251,179,43,176,195,53,179,15,
+48,11,6,3,85,29,15,4,4,3,2,1,134,48,16,6,9,43,6,1,4,1,130,55,21,1,4,3,2,1,0,48,129,152,6,3,85,29,35,4,129,144,
+48,129,141,128,20,14,172,130,96,64,86,39,151,229,37,19,252,42,225,10,83,149,89,228,164,161,99,164,97,48,95,49,
+19,48,17,6,10,9,146,38,137,147,242,44,100,1,25,22,3,99,111,109,49,25,48,23,6,10,9,146,38,137,147,242,44,100,1,
+25,22,9,109,105,99,114,111,115,111,102,116,49,45,48,43,6,3,85,4,3,19,36,77,105,99,114,111,115,111,102,116,32,
+82,111,111,116,32,67,101,114,116,105,102,105,99,97,116,101,32,65,117,116,104,111,114,105,116,121,130,16,121,
+173,22,161,74,160,165,173,76,115,88,244,7,19,46,101,48,80,6,3,85,29,31,4,73,48,71,48,69,160,67,160,65,134,63,
+104,116,116,112,58,47,47,99,114,108,46,109,105,99,114,111,115,111,102,116,46,99,111,109,47,112,107,105,47,99,
+114,108,47,112,114,111,100,117,99,116,115,47,109,105,99,114,111,115,111,102,116,114,111,111,116,99,101,114,
+116,46,99,114,108,48,84,6,8,43,6,1,5,5,7,1,1,4,72,48,70,48,68,6,8,43,6,1,5,5,7,48,2,134,56,104,116,116,112,58,
+47,47,119,119,119,46,109,105,99,114,111,115,111,102,116,46,99,111,109,47,112,107,105,47,99,101,114,116,115,47,
+77,105,99,114,111,115,111,102,116,82,111,111,116,67,101,114,116,46,99,114,116,48,19,6,3,85,29,37,4,12,48,10,6,
+8,43,6,1,5,5,7,3,8,48,13,6,9,42,134,72,134,247,13,1,1,5,5,0,3,130,2,1,0,16,151,138,195,92,3,68,54,221,233,180,
+173,119,219,206,121,81,77,1,177,46,116,113,91,109,12,19,171,206,190,123,143,184,46,212,18,162,140,109,98,184,
+87,2,203,78,32,19,80,153,221,122,64,226,87,187,175,88,154,28,225,29,1,134,172,187,120,242,139,208,236,59,1,
+238,226,190,143,10,5,200,141,72,226,240,83,21,221,79,171,146,228,231,141,106,213,128,193,230,148,242,6,47,133,
+3,233,145,42,36,34,112,251,246,252,228,120,153,46,13,247,7,226,112,188,24,78,157,142,107,10,114,149,184,161,
+57,156,103,45,197,81,14,234,98,92,63,22,152,139,32,63,226,7,26,50,249,204,49,74,118,49,61,43,114,11,200,234,
+112,61,255,133,10,19,223,194,10,97,142,240,215,184,23,235,78,139,127,197,53,43,94,163,191,235,188,125,11,66,
+123,212,83,114,33,238,48,202,187,120,101,92,91,1,23,10,20,14,210,218,20,152,245,60,185,102,88,179,45,47,231,
+249,133,134,204,81,86,232,157,112,148,108,172,57,76,212,246,121,191,170,24,122,98,41,239,162,155,41,52,6,119,
+26,98,201,61,30,109,31,130,240,11,199,44,187,207,67,179,229,249,236,125,181,227,164,168,116,53,184,78,197,113,
+35,18,38,118,11,60,82,140,113,90,70,67,20,188,179,179,176,77,103,200,159,66,255,128,121,33,128,158,21,48,102,
+232,66,18,94,26,200,158,34,33,208,67,233,43,233,187,244,72,204,44,212,216,50,128,76,38,42,72,36,95,90,234,86,
+239,166,222,153,157,202,58,111,189,129,39,116,6,17,238,118,33,191,155,130,193,39,84,182,177,106,61,137,161,
+118,97,180,110,161,19,166,191,170,71,240,18,111,253,138,50,108,178,254,223,81,200,140,35,201,102,189,157,29,
+135,18,100,2,61,45,175,89,143,184,228,33,229,181,176,202,99,180,120,84,5,212,65,46,80,172,148,176,165,120,171,
+179,160,150,117,26,217,146,135,19,117,34,47,50,168,8,110,160,91,140,37,191,160,239,132,202,33,214,235,30,79,
+201,154,238,73,224,247,1,101,111,137,11,125,200,105,200,230,110,234,167,151,206,49,41,255,14,197,91,92,216,77,
+27,161,216,250,47,158,63,46,85,22,107,201,19,163,253,48,130,7,122,48,130,5,98,160,3,2,1,2,2,10,97,14,144,210,
+0,0,0,0,0,3,48,13,6,9,42,134,72,134,247,13,1,1,11,5,0,48,129,136,49,11,48,9,6,3,85,4,6,19,2,85,83,49,19,48,17,
+6,3,85,4,8,19,10,87,97,115,104,105,110,103,116,111,110,49,16,48,14,6,3,85,4,7,19,7,82,101,100,109,111,110,100,
+49,30,48,28,6,3,85,4,10,19,21,77,105,99,114,111,115,111,102,116,32,67,111,114,112,111,114,97,116,105,111,110,
+49,50,48,48,6,3,85,4,3,19,41,77,105,99,114,111,115,111,102,116,32,82,111,111,116,32,67,101,114,116,105,102,
+105,99,97,116,101,32,65,117,116,104,111,114,105,116,121,32,50,48,49,49,48,30,23,13,49,49,48,55,48,56,50,48,53,
+57,48,57,90,23,13,50,54,48,55,48,56,50,49,48,57,48,57,90,48,126,49,11,48,9,6,3,85,4,6,19,2,85,83,49,19,48,17,
+6,3,85,4,8,19,10,87,97,115,104,105,110,103,116,111,110,49,16,48,14,6,3,85,4,7,19,7,82,101,100,109,111,110,100,
+49,30,48,28,6,3,85,4,10,19,21,77,105,99,114,111,115,111,102,116,32,67,111,114,112,111,114,97,116,105,111,110,
+49,40,48,38,6,3,85,4,3,19,31,77,105,99,114,111,115,111,102,116,32,67,111,100,101,32,83,105,103,110,105,110,
+103,32,80,67,65,32,50,48,49,49,48,130,2,34,48,13,6,9,42,134,72,134,247,13,1,1,1,5,0,3,130,2,15,0,48,130,2,10,
+2,130,2,1,0,171,240,250,114,16,28,46,173,216,110,170,130,16,77,52,186,242,182,88,33,159,66,27,42,107,233,90,
+80,170,184,6,56,26,4,73,186,127,195,12,30,221,55,107,198,18,216,11,240,56,194,153,6,176,200,57,213,1,20,49,66,
+211,137,13,121,100,135,126,148,96,36,108,175,158,73,156,233,104,94,210,223,155,83,178,10,44,195,175,217,169,
+43,174,122,9,175,215,150,89,202,96,26,5,233,102,118,232,50,82,38,18,47,231,171,8,80,207,179,68,183,93,216,196,
+46,3,117,171,104,243,203,109,243,58,92,161,22,244,70,186,224,56,100,172,110,100,53,120,166,160,99,15,45,211,
+64,147,248,227,222,7,13,213,92,121,165,73,41,231,13,190,160,19,119,190,148,61,239,251,227,43,90,16,31,77,86,
+40,162,122,114,224,18,58,183,73,94,216,237,237,67,145,131,217,123,178,123,134,27,217,62,177,140,93,232,137,79,
+132,26,242,161,47,89,228,144,59,45,174,51,88,197,183,62,254,50,211,179,3,61,177,178,175,146,56,126,210,157,
+128,44,245,78,86,145,33,53,37,195,57,110,100,127,83,186,156,15,173,25,35,132,203,244,186,3,134,141,247,95,240,
+208,82,191,140,148,135,188,192,33,116,37,95,24,40,182,204,39,40,56,37,152,57,74,54,207,124,177,146,174,28,35,
+167,169,102,236,97,31,106,225,40,73,157,95,136,226,37,93,211,33,75,62,82,196,181,87,63,36,3,240,209,122,91,47,
+213,35,227,112,93,15,81,70,119,179,248,0,225,188,172,2,130,95,219,192,21,179,189,27,212,85,75,231,57,161,15,
+233,35,73,188,24,184,68,124,69,228,193,195,114,122,224,114,231,36,223,191,70,153,197,239,194,28,87,219,131,
+141,236,77,73,48,167,171,142,223,236,91,159,175,252,221,176,102,226,193,151,129,123,237,214,237,75,231,73,41,
+167,19,40,166,167,125,103,128,230,138,98,120,95,178,47,132,215,87,156,92,191,119,40,40,241,237,109,195,40,143,
+44,143,64,55,79,193,225,133,68,137,196,9,76,197,212,165,67,47,116,149,247,110,248,120,32,88,44,19,93,96,149,
+154,62,79,51,132,218,176,136,23,222,158,78,244,150,176,188,70,160,108,152,210,224,214,136,140,11,2,3,1,0,1,
+163,130,1,237,48,130,1,233,48,16,6,9,43,6,1,4,1,130,55,21,1,4,3,2,1,0,48,29,6,3,85,29,14,4,22,4,20,72,110,100,
+229,80,5,211,130,170,23,55,55,34,181,109,168,202,117,2,149,48,25,6,9,43,6,1,4,1,130,55,20,2,4,12,30,10,0,83,0,
+117,0,98,0,67,0,65,48,11,6,3,85,29,15,4,4,3,2,1,134,48,15,6,3,85,29,19,1,1,255,4,5,48,3,1,1,255,48,31,6,3,85,
+29,35,4,24,48,22,128,20,114,45,58,2,49,144,67,185,20,5,78,225,234,167,199,49,209,35,137,52,48,90,6,3,85,29,31,
+4,83,48,81,48,79,160,77,160,75,134,73,104,116,116,112,58,47,47,99,114,108,46,109,105,99,114,111,115,111,102,
+116,46,99,111,109,47,112,107,105,47,99,114,108,47,112,114,111,100,117,99,116,115,47,77,105,99,82,111,111,67,
+101,114,65,117,116,50,48,49,49,95,50,48,49,49,95,48,51,95,50,50,46,99,114,108,48,94,6,8,43,6,1,5,5,7,1,1,4,82,
+48,80,48,78,6,8,43,6,1,5,5,7,48,2,134,66,104,116,116,112,58,47,47,119,119,119,46,109,105,99,114,111,115,111,
+102,116,46,99,111,109,47,112,107,105,47,99,101,114,116,115,47,77,105,99,82,111,111,67,101,114,65,117,116,50,
+48,49,49,95,50,48,49,49,95,48,51,95,50,50,46,99,114,116,48,129,159,6,3,85,29,32,4,129,151,48,129,148,48,129,
+145,6,9,43,6,1,4,1,130,55,46,3,48,129,131,48,63,6,8,43,6,1,5,5,7,2,1,22,51,104,116,116,112,58,47,47,119,119,
+119,46,109,105,99,114,111,115,111,102,116,46,99,111,109,47,112,107,105,111,112,115,47,100,111,99,115,47,112,
+114,105,109,97,114,121,99,112,115,46,104,116,109,48,64,6,8,43,6,1,5,5,7,2,2,48,52,30,50,32,29,0,76,0,101,0,
+103,0,97,0,108,0,95,0,112,0,111,0,108,0,105,0,99,0,121,0,95,0,115,0,116,0,97,0,116,0,101,0,109,0,101,0,110,0,
+116,0,46,32,29,48,13,6,9,42,134,72,134,247,13,1,1,11,5,0,3,130,2,1,0,103,242,134,165,152,224,84,121,26,46,211,
+216,116,103,34,155,11,150,17,225,99,146,153,66,150,125,210,121,12,144,193,101,95,46,44,62,248,195,114,209,109,
+131,254,190,63,232,10,202,59,191,71,169,163,243,105,219,99,191,34,53,165,151,93,101,132,144,125,139,70,80,85,
+216,12,146,124,210,26,75,28,243,60,66,139,82,208,176,253,107,227,62,7,46,41,155,230,61,27,165,212,181,29,119,
+148,57,226,233,100,201,68,61,120,122,35,243,19,125,166,144,116,131,141,244,203,38,2,70,42,194,138,16,187,164,
+169,5,12,155,237,104,250,104,46,149,160,42,63,42,107,88,73,99,31,9,105,110,90,152,150,228,131,244,192,143,243,
+70,43,222,252,59,208,189,53,239,110,37,174,229,175,39,237,208,221,243,14,175,153,40,151,152,77,14,61,11,242,8,
+137,214,31,195,50,24,226,240,197,45,206,91,158,180,73,57,10,198,10,194,198,173,174,229,178,217,219,21,136,81,
+69,88,56,50,113,39,26,127,177,244,39,248,222,44,58,32,105,152,178,89,137,104,110,111,167,183,116,195,64,5,6,
+166,1,42,40,62,130,63,19,77,102,11,192,179,77,245,225,143,127,28,111,21,125,69,167,118,229,64,42,101,163,195,
+93,82,98,134,195,29,99,54,151,134,223,218,243,248,242,22,161,154,39,225,205,165,151,208,238,93,99,65,227,91,7,
+156,135,62,6,119,6,209,6,177,117,31,20,190,97,97,181,240,220,198,27,4,190,223,65,199,14,40,238,222,101,47,236,
+151,246,161,92,150,216,0,214,161,70,189,89,243,151,165,9,75,72,16,153,128,31,208,0,41,197,177,155,165,63,69,
+119,30,53,198,210,162,162,159,122,122,34,250,72,149,31,171,251,71,35,128,245,158,248,191,107,183,75,151,226,
+235,117,120,26,236,234,55,153,121,24,75,255,214,179,35,104,117,230,175,250,252,139,235,11,128,234,105,59,175,
+252,48,237,4,76,142,223,223,117,109,99,145,61,209,157,86,78,79,191,128,87,34,161,120,17,50,33,122,239,65,10,
+177,63,251,168,204,164,93,193,161,136,155,87,113,86,78,72,69,192,66,201,155,118,91,10,128,72,107,253,121,159,
+193,189,109,109,106,201,82,115,19,13,122,80,205,49,130,4,176,48,130,4,172,2,1,1,48,129,149,48,126,49,11,48,9,
+6,3,85,4,6,19,2,85,83,49,19,48,17,6,3,85,4,8,19,10,87,97,115,104,105,110,103,116,111,110,49,16,48,14,6,3,85,4,
+7,19,7,82,101,100,109,111,110,100,49,30,48,28,6,3,85,4,10,19,21,77,105,99,114,111,115,111,102,116,32,67,111,
+114,112,111,114,97,116,105,111,110,49,40,48,38,6,3,85,4,3,19,31,77,105,99,114,111,115,111,102,116,32,67,111,
+100,101,32,83,105,103,110,105,110,103,32,80,67,65,32,50,48,49,49,2,19,51,0,0,0,195,14,155,167,216,178,220,247,
+44,0,0,0,0,0,195,48,9,6,5,43,14,3,2,26,5,0,160,129,196,48,25,6,9,42,134,72,134,247,13,1,9,3,49,12,6,10,43,6,1,
+4,1,130,55,2,1,4,48,28,6,10,43,6,1,4,1,130,55,2,1,11,49,14,48,12,6,10,43,6,1,4,1,130,55,2,1,21,48,35,6,9,42,
+134,72,134,247,13,1,9,4,49,22,4,20,227,125,62,67,184,120,4,214,176,71,34,63,124,171,146,103,233,20,148,66,48,
+100,6,10,43,6,1,4,1,130,55,2,1,12,49,86,48,84,160,42,128,40,0,77,0,105,0,99,0,114,0,111,0,115,0,111,0,102,0,
+116,0,32,0,84,0,121,0,112,0,111,0,103,0,114,0,97,0,112,0,104,0,121,161,38,128,36,104,116,116,112,58,47,47,119,
+119,119,46,109,105,99,114,111,115,111,102,116,46,99,111,109,47,84,121,112,111,103,114,97,112,104,121,32,48,13,
+6,9,42,134,72,134,247,13,1,1,1,5,0,4,130,1,0,38,116,12,160,61,161,103,31,40,14,120,51,226,33,184,40,114,146,
+98,46,1,123,50,20,50,35,99,244,149,62,126,124,34,17,121,118,189,211,164,150,109,239,205,23,138,245,150,167,49,
+138,106,225,154,90,144,92,198,127,202,101,254,1,107,219,79,152,199,74,206,130,255,187,63,50,245,57,13,25,8,
+209,131,205,73,75,237,40,16,236,173,10,171,17,223,21,7,11,33,227,102,244,53,92,13,156,168,137,154,201,212,99,
+46,38,108,154,166,59,122,214,207,209,158,132,160,46,153,89,192,109,159,127,236,156,95,212,204,169,239,254,255,
+70,190,164,48,58,254,172,117,97,246,13,63,63,243,99,62,69,185,51,134,91,238,250,157,5,179,8,226,19,38,220,98,
+234,50,62,13,189,234,72,165,215,48,43,145,164,127,249,21,57,141,232,2,16,179,39,201,226,240,48,183,181,96,25,
+102,153,124,55,72,173,34,11,194,113,92,160,169,153,162,103,198,208,186,32,198,14,116,59,141,208,67,169,166,3,
+136,4,100,201,129,130,188,44,73,88,177,250,245,223,79,172,47,191,215,141,118,240,86,48,161,130,2,40,48,130,2,
+36,6,9,42,134,72,134,247,13,1,9,6,49,130,2,21,48,130,2,17,2,1,1,48,129,142,48,119,49,11,48,9,6,3,85,4,6,19,2,
+85,83,49,19,48,17,6,3,85,4,8,19,10,87,97,115,104,105,110,103,116,111,110,49,16,48,14,6,3,85,4,7,19,7,82,101,
+100,109,111,110,100,49,30,48,28,6,3,85,4,10,19,21,77,105,99,114,111,115,111,102,116,32,67,111,114,112,111,114,
+97,116,105,111,110,49,33,48,31,6,3,85,4,3,19,24,77,105,99,114,111,115,111,102,116,32,84,105,109,101,45,83,116,
+97,109,112,32,80,67,65,2,19,51,0,0,0,193,9,248,2,65,187,77,170,220,0,0,0,0,0,193,48,9,6,5,43,14,3,2,26,5,0,
+160,93,48,24,6,9,42,134,72,134,247,13,1,9,3,49,11,6,9,42,134,72,134,247,13,1,7,1,48,28,6,9,42,134,72,134,247,
+13,1,9,5,49,15,23,13,49,55,49,48,49,56,50,51,52,56,48,57,90,48,35,6,9,42,134,72,134,247,13,1,9,4,49,22,4,20,
+232,229,209,122,135,179,164,244,95,211,68,66,32,106,204,149,245,233,84,48,48,13,6,9,42,134,72,134,247,13,1,1,
+5,5,0,4,130,1,0,98,154,179,116,145,72,54,229,72,179,222,36,192,203,194,15,51,147,130,123,94,146,92,71,61,62,
+49,93,197,20,136,45,165,69,163,133,133,137,153,175,241,184,78,96,197,142,148,53,10,74,224,197,171,61,98,113,9,
+114,73,203,40,31,35,218,93,128,167,130,135,1,252,132,77,74,35,94,71,152,67,255,44,241,115,228,210,53,199,211,
+33,213,156,135,101,55,112,180,210,89,215,153,102,232,143,65,82,19,49,163,227,78,105,228,188,34,7,230,197,249,
+144,197,136,18,245,34,145,175,238,230,244,116,19,40,38,100,68,202,228,60,190,195,144,55,179,230,82,45,224,250,
+239,74,181,128,146,70,234,43,211,46,128,243,228,196,237,97,61,117,199,252,132,148,187,160,207,98,52,47,37,23,
+237,69,23,251,107,69,22,145,220,244,210,83,244,98,245,198,204,202,138,134,64,101,203,150,164,37,226,18,190,
+129,39,14,186,148,0,247,40,152,133,235,16,68,149,126,105,60,150,39,218,44,250,241,97,186,116,235,45,87,36,137,
+56,184,181,28,7,40,85,75,201,81,66,85,130,125,209,209,157,250,0,0,0,0,1,0,0,0,12,0,0,0,22,0,0,0,2,0,1,0,0,4,5,
+0,1,0,4,0,0,0,1,0,0,0,0,0,1,0,0,0,10,0,132,1,118,0,3,99,121,114,108,0,20,103,114,101,107,0,36,108,97,116,110,
+0,52,0,4,0,0,0,0,255,255,0,3,0,6,0,0,0,12,0,4,0,0,0,0,255,255,0,3,0,7,0,1,0,13,0,22,0,3,76,84,72,32,0,34,82,
+79,77,32,0,46,84,82,75,32,0,58,0,0,255,255,0,3,0,8,0,2,0,14,0,0,255,255,0,3,0,9,0,3,0,15,0,0,255,255,0,3,0,10,
+0,4,0,16,0,0,255,255,0,3,0,11,0,5,0,17,0,18,99,97,115,101,0,110,99,97,115,101,0,116,99,97,115,101,0,122,99,97,
+115,101,0,128,99,97,115,101,0,134,99,97,115,101,0,140,99,112,115,112,0,146,99,112,115,112,0,156,99,112,115,
+112,0,166,99,112,115,112,0,176,99,112,115,112,0,186,99,112,115,112,0,196,107,101,114,110,0,206,107,101,114,
+110,0,212,107,101,114,110,0,218,107,101,114,110,0,224,107,101,114,110,0,230,107,101,114,110,0,236,0,0,0,1,0,4,
+0,0,0,1,0,4,0,0,0,1,0,4,0,0,0,1,0,4,0,0,0,1,0,4,0,0,0,1,0,4,0,0,0,3,0,1,0,2,0,3,0,0,0,3,0,1,0,2,0,3,0,0,0,3,0,
+1,0,2,0,3,0,0,0,3,0,1,0,2,0,3,0,0,0,3,0,1,0,2,0,3,0,0,0,3,0,1,0,2,0,3,0,0,0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,0,
+0,1,0,0,0,0,0,1,0,0,0,0,0,1,0,0,0,5,0,12,0,20,0,28,0,36,0,44,0,2,0,8,0,1,0,40,0,1,0,0,0,1,40,106,0,1,0,0,0,1,
+41,234,0,1,0,0,0,1,43,14,0,1,0,0,0,1,48,226,0,1,38,54,0,4,0,0,0,242,1,238,2,220,3,82,3,92,3,190,4,124,4,134,5,
+24,5,210,7,4,7,18,7,128,8,46,8,140,9,42,10,172,11,26,12,128,13,118,14,68,15,202,15,224,15,234,15,252,16,6,16,
+24,16,74,16,92,16,110,16,116,16,126,16,156,16,174,17,28,17,34,17,68,17,118,17,140,17,182,17,204,18,182,19,156,
+19,250,20,88,20,88,20,94,20,116,20,166,20,166,21,92,21,162,21,220,22,22,22,44,23,90,20,166,20,166,21,92,21,92,
+21,92,23,96,23,96,23,96,23,186,22,44,20,166,20,166,23,186,23,186,23,96,23,252,23,252,21,92,24,246,24,246,25,
+84,25,84,23,96,23,96,20,166,23,96,26,106,23,252,23,186,21,92,21,92,24,246,25,84,23,96,23,96,23,96,23,96,26,
+248,22,44,20,166,20,116,26,248,26,248,26,248,22,44,25,84,27,178,27,244,28,38,28,38,28,64,28,254,29,20,29,20,
+29,42,29,20,29,88,30,46,30,136,30,234,31,32,31,32,31,78,31,132,31,222,31,32,31,32,32,180,33,46,32,180,33,100,
+33,234,31,78,34,132,35,30,31,132,35,172,30,136,29,88,29,88,29,88,29,88,29,88,29,88,36,94,36,94,36,94,36,94,31,
+32,36,140,36,140,36,140,36,140,36,140,31,78,31,78,31,78,31,78,35,172,29,88,29,88,29,88,36,140,30,136,31,32,36,
+94,36,94,36,94,31,32,36,94,31,78,36,94,31,132,31,222,31,222,37,6,31,32,31,32,31,32,30,136,36,140,36,140,36,
+140,33,100,33,100,33,100,33,234,33,234,33,234,33,234,31,78,31,78,31,78,31,78,31,78,31,78,35,30,35,30,35,30,35,
+30,35,172,35,172,35,172,29,88,27,178,27,178,27,178,27,178,27,178,27,178,27,178,27,178,27,178,27,178,27,178,27,
+244,27,244,27,244,27,244,27,244,27,244,27,244,27,244,27,244,27,244,27,244,28,38,28,38,28,38,28,38,29,20,29,20,
+29,20,29,20,29,20,37,52,28,254,29,20,29,20,29,20,29,20,29,20,29,20,29,42,29,42,29,42,29,42,0,59,0,38,255,219,
+0,42,255,219,0,50,255,219,0,52,255,217,0,55,255,115,0,56,255,186,0,57,255,143,0,58,0,16,0,60,255,82,0,83,0,35,
+0,88,255,236,0,89,255,221,0,181,255,117,0,183,255,119,2,189,255,219,2,204,255,219,2,208,255,219,2,216,255,217,
+2,218,255,217,2,221,255,145,2,222,255,206,2,223,255,143,2,226,255,82,2,229,255,217,2,241,255,219,2,251,255,
+219,2,252,255,219,2,253,255,219,2,254,255,219,2,255,255,219,3,0,255,206,3,1,255,206,3,2,255,206,3,3,255,206,3,
+4,255,82,3,8,255,219,3,9,255,219,3,10,255,219,3,18,255,219,3,19,255,219,3,20,255,219,3,39,255,219,3,40,255,
+219,3,41,255,219,3,49,255,145,3,50,255,145,3,51,255,145,3,52,255,145,3,53,255,206,3,54,255,206,3,55,255,206,3,
+56,255,206,3,57,255,206,3,58,255,206,3,63,255,82,3,64,255,82,3,65,255,82,3,253,255,219,3,254,255,219,0,29,0,
+15,0,51,0,17,0,33,0,36,255,221,0,56,255,203,0,98,255,221,0,99,255,221,0,104,255,203,2,202,255,221,2,222,255,
+233,2,235,255,221,2,236,255,221,2,237,255,221,2,238,255,221,2,239,255,221,2,240,255,221,3,0,255,233,3,1,255,
+233,3,2,255,233,3,3,255,233,3,5,255,221,3,6,255,221,3,7,255,221,3,53,255,233,3,54,255,233,3,55,255,233,3,56,
+255,233,3,57,255,233,3,58,255,233,3,69,255,221,0,2,0,15,0,51,0,17,0,35,0,24,0,15,255,236,0,17,255,221,0,36,
+255,168,0,57,255,186,0,58,0,35,0,60,255,186,0,98,255,168,0,99,255,168,2,202,255,168,2,226,255,216,2,235,255,
+168,2,236,255,168,2,237,255,168,2,238,255,168,2,239,255,168,2,240,255,168,3,4,255,216,3,5,255,168,3,6,255,168,
+3,7,255,168,3,63,255,216,3,64,255,216,3,65,255,216,3,69,255,168,0,47,0,15,254,213,0,17,254,199,0,36,255,63,0,
+68,255,203,0,72,255,186,0,79,0,16,0,82,255,186,0,85,255,186,0,98,255,63,0,99,255,63,0,108,255,203,0,110,255,
+203,0,124,255,186,2,182,255,226,2,190,255,203,2,194,255,203,2,202,255,63,2,235,255,63,2,236,255,63,2,237,255,
+63,2,238,255,63,2,239,255,63,2,240,255,63,3,5,255,63,3,6,255,63,3,7,255,63,3,69,255,63,3,165,255,226,3,166,
+255,226,3,167,255,226,3,168,255,226,3,169,255,226,3,170,255,226,3,171,255,226,3,172,255,226,3,173,255,226,3,
+174,255,226,3,175,255,226,3,227,255,203,3,228,255,203,3,229,255,203,3,230,255,203,3,231,255,203,3,232,255,203,
+3,233,255,203,3,234,255,203,3,235,255,203,0,2,0,15,0,33,0,17,0,20,0,36,0,15,255,219,0,17,255,203,0,36,255,203,
+0,68,255,221,0,72,255,203,0,82,255,203,0,88,255,203,0,92,255,221,0,98,255,203,0,99,255,203,0,108,255,221,0,
+110,255,221,0,124,255,203,0,129,255,203,2,190,255,231,2,194,255,231,2,202,255,203,2,235,255,203,2,236,255,203,
+2,237,255,203,2,238,255,203,2,239,255,203,2,240,255,203,3,5,255,203,3,6,255,203,3,7,255,203,3,69,255,203,3,
+227,255,231,3,228,255,231,3,229,255,231,3,230,255,231,3,231,255,231,3,232,255,231,3,233,255,231,3,234,255,231,
+3,235,255,231,0,46,0,38,255,186,0,42,255,186,0,50,255,186,0,72,255,186,0,82,255,186,0,88,255,203,0,89,255,221,
+0,92,255,221,0,103,255,186,0,124,255,186,0,129,255,203,2,183,255,186,2,189,255,186,2,204,255,216,2,208,255,
+216,2,216,255,216,2,218,255,216,2,229,255,216,2,241,255,216,2,251,255,216,2,252,255,216,2,253,255,216,2,254,
+255,216,2,255,255,216,3,8,255,216,3,9,255,216,3,10,255,216,3,18,255,216,3,19,255,216,3,20,255,216,3,39,255,
+216,3,40,255,216,3,41,255,216,3,176,255,186,3,177,255,186,3,178,255,186,3,179,255,186,3,180,255,186,3,181,255,
+186,3,182,255,186,3,183,255,186,3,184,255,186,3,185,255,186,3,186,255,186,3,253,255,216,3,254,255,216,0,76,0,
+38,255,221,0,42,255,221,0,50,255,221,0,55,255,152,0,56,255,203,0,57,255,152,0,58,255,221,0,60,255,98,0,90,255,
+221,0,92,255,236,0,103,255,221,0,104,255,203,0,181,255,152,0,183,255,152,2,183,255,226,2,189,255,221,2,204,
+255,221,2,208,255,221,2,216,255,221,2,218,255,221,2,221,255,152,2,222,255,233,2,223,255,152,2,224,255,221,2,
+226,255,98,2,229,255,221,2,241,255,221,2,251,255,221,2,252,255,221,2,253,255,221,2,254,255,221,2,255,255,221,
+3,0,255,233,3,1,255,233,3,2,255,233,3,3,255,233,3,4,255,98,3,8,255,221,3,9,255,221,3,10,255,221,3,18,255,221,
+3,19,255,221,3,20,255,221,3,39,255,221,3,40,255,221,3,41,255,221,3,49,255,152,3,50,255,152,3,51,255,152,3,52,
+255,152,3,53,255,233,3,54,255,233,3,55,255,233,3,56,255,233,3,57,255,233,3,58,255,233,3,59,255,221,3,60,255,
+221,3,61,255,221,3,62,255,221,3,63,255,98,3,64,255,98,3,65,255,98,3,176,255,226,3,177,255,226,3,178,255,226,3,
+179,255,226,3,180,255,226,3,181,255,226,3,182,255,226,3,183,255,226,3,184,255,226,3,185,255,226,3,186,255,226,
+3,253,255,221,3,254,255,221,0,3,0,36,255,236,0,98,255,236,0,99,255,236,0,27,0,15,255,221,0,17,255,203,0,36,
+255,186,0,55,255,203,0,57,255,168,0,58,255,221,0,59,255,150,0,60,255,117,0,98,255,186,0,99,255,186,2,202,255,
+191,2,225,255,236,2,226,255,216,2,235,255,191,2,236,255,191,2,237,255,191,2,238,255,191,2,239,255,191,2,240,
+255,191,3,4,255,216,3,5,255,191,3,6,255,191,3,7,255,191,3,63,255,216,3,64,255,216,3,65,255,216,3,69,255,191,0,
+43,0,15,254,143,0,17,254,127,0,36,255,82,0,68,255,221,0,72,255,203,0,82,255,203,0,98,255,82,0,99,255,82,0,110,
+255,221,2,182,255,216,2,190,255,221,2,194,255,221,2,202,255,82,2,235,255,82,2,236,255,82,2,237,255,82,2,238,
+255,82,2,239,255,82,2,240,255,82,3,5,255,82,3,6,255,82,3,7,255,82,3,69,255,82,3,165,255,216,3,166,255,216,3,
+167,255,216,3,168,255,216,3,169,255,216,3,170,255,216,3,171,255,216,3,172,255,216,3,173,255,216,3,174,255,216,
+3,175,255,216,3,227,255,221,3,228,255,221,3,229,255,221,3,230,255,221,3,231,255,221,3,232,255,221,3,233,255,
+221,3,234,255,221,3,235,255,221,0,23,0,15,0,68,0,17,0,35,0,36,0,35,0,55,255,219,0,57,255,168,0,60,255,152,2,
+202,255,191,2,225,255,236,2,226,255,216,2,235,255,191,2,236,255,191,2,237,255,191,2,238,255,191,2,239,255,191,
+2,240,255,191,3,4,255,216,3,5,255,191,3,6,255,191,3,7,255,191,3,63,255,216,3,64,255,216,3,65,255,216,3,69,255,
+191,0,39,0,38,255,219,0,42,255,219,0,50,255,221,0,52,255,215,0,55,255,238,0,56,255,221,0,57,255,221,0,60,255,
+168,0,72,255,205,0,82,255,203,0,88,255,221,0,90,0,35,0,103,255,221,0,104,255,221,0,124,255,203,0,129,255,221,
+2,189,255,221,2,204,255,221,2,208,255,221,2,216,255,221,2,218,255,221,2,229,255,221,2,241,255,221,2,251,255,
+221,2,252,255,221,2,253,255,221,2,254,255,221,2,255,255,221,3,8,255,221,3,9,255,221,3,10,255,221,3,18,255,221,
+3,19,255,221,3,20,255,221,3,39,255,221,3,40,255,221,3,41,255,221,3,253,255,221,3,254,255,221,0,96,0,15,254,
+213,0,16,255,117,0,17,254,199,0,29,255,186,0,30,255,186,0,36,255,117,0,38,255,186,0,42,255,186,0,50,255,186,0,
+52,255,186,0,68,255,152,0,70,255,133,0,72,255,133,0,75,0,55,0,79,0,39,0,80,255,168,0,82,255,117,0,85,255,168,
+0,86,255,117,0,88,255,168,0,90,255,236,0,92,255,221,0,93,255,186,0,98,255,117,0,99,255,117,0,103,255,186,0,
+110,255,152,2,182,255,226,2,183,255,206,2,189,255,186,2,190,255,152,2,194,255,152,2,202,255,117,2,204,255,186,
+2,208,255,186,2,216,255,186,2,218,255,186,2,229,255,186,2,235,255,117,2,236,255,117,2,237,255,117,2,238,255,
+117,2,239,255,117,2,240,255,117,2,241,255,186,2,251,255,186,2,252,255,186,2,253,255,186,2,254,255,186,2,255,
+255,186,3,5,255,117,3,6,255,117,3,7,255,117,3,8,255,186,3,9,255,186,3,10,255,186,3,18,255,186,3,19,255,186,3,
+20,255,186,3,39,255,186,3,40,255,186,3,41,255,186,3,69,255,117,3,165,255,226,3,166,255,226,3,167,255,226,3,
+168,255,226,3,169,255,226,3,170,255,226,3,171,255,226,3,172,255,226,3,173,255,226,3,174,255,226,3,175,255,226,
+3,176,255,206,3,177,255,206,3,178,255,206,3,179,255,206,3,180,255,206,3,181,255,206,3,182,255,206,3,183,255,
+206,3,184,255,206,3,185,255,206,3,186,255,206,3,227,255,152,3,228,255,152,3,229,255,152,3,230,255,152,3,231,
+255,152,3,232,255,152,3,233,255,152,3,234,255,152,3,235,255,152,3,253,255,186,3,254,255,186,0,27,0,15,255,203,
+0,17,255,186,0,36,255,186,0,98,255,186,0,99,255,186,2,190,255,231,2,194,255,231,2,202,255,203,2,235,255,203,2,
+236,255,203,2,237,255,203,2,238,255,203,2,239,255,203,2,240,255,203,3,5,255,203,3,6,255,203,3,7,255,203,3,69,
+255,203,3,227,255,231,3,228,255,231,3,229,255,231,3,230,255,231,3,231,255,231,3,232,255,231,3,233,255,231,3,
+234,255,231,3,235,255,231,0,89,0,15,255,10,0,16,255,168,0,17,254,250,0,29,255,203,0,30,255,203,0,36,255,139,0,
+38,255,186,0,42,255,186,0,50,255,186,0,52,255,186,0,68,255,168,0,72,255,152,0,76,0,33,0,82,255,152,0,85,255,
+186,0,88,255,186,0,98,255,139,0,99,255,139,0,103,255,186,0,110,255,168,2,182,255,186,2,183,255,186,2,189,255,
+186,2,190,255,168,2,194,255,168,2,202,255,119,2,204,255,186,2,208,255,186,2,216,255,186,2,218,255,186,2,229,
+255,186,2,235,255,119,2,236,255,119,2,237,255,119,2,238,255,119,2,239,255,119,2,240,255,119,2,241,255,186,2,
+251,255,186,2,252,255,186,2,253,255,186,2,254,255,186,2,255,255,186,3,5,255,119,3,6,255,119,3,7,255,119,3,8,
+255,186,3,9,255,186,3,10,255,186,3,18,255,186,3,19,255,186,3,20,255,186,3,39,255,186,3,40,255,186,3,41,255,
+186,3,69,255,119,3,165,255,186,3,166,255,186,3,167,255,186,3,168,255,186,3,169,255,186,3,170,255,186,3,171,
+255,186,3,172,255,186,3,173,255,186,3,174,255,186,3,175,255,186,3,176,255,186,3,177,255,186,3,178,255,186,3,
+179,255,186,3,180,255,186,3,181,255,186,3,182,255,186,3,183,255,186,3,184,255,186,3,185,255,186,3,186,255,186,
+3,227,255,168,3,228,255,168,3,229,255,168,3,230,255,168,3,231,255,168,3,232,255,168,3,233,255,168,3,234,255,
+168,3,235,255,168,3,253,255,186,3,254,255,186,0,61,0,15,255,168,0,16,255,236,0,17,255,150,0,38,255,221,0,42,
+255,221,0,50,255,221,0,68,255,221,0,71,255,203,0,72,255,203,0,75,0,68,0,76,0,68,0,82,255,203,0,88,255,221,0,
+103,255,221,0,110,255,221,2,182,255,226,2,189,255,221,2,190,255,221,2,194,255,221,2,204,255,221,2,208,255,221,
+2,216,255,221,2,218,255,221,2,229,255,221,2,241,255,221,2,251,255,221,2,252,255,221,2,253,255,221,2,254,255,
+221,2,255,255,221,3,8,255,221,3,9,255,221,3,10,255,221,3,18,255,221,3,19,255,221,3,20,255,221,3,39,255,221,3,
+40,255,221,3,41,255,221,3,165,255,226,3,166,255,226,3,167,255,226,3,168,255,226,3,169,255,226,3,170,255,226,3,
+171,255,226,3,172,255,226,3,173,255,226,3,174,255,226,3,175,255,226,3,227,255,221,3,228,255,221,3,229,255,221,
+3,230,255,221,3,231,255,221,3,232,255,221,3,233,255,221,3,234,255,221,3,235,255,221,3,253,255,221,3,254,255,
+221,0,51,0,38,255,186,0,42,255,186,0,50,255,186,0,103,255,186,2,182,255,236,2,183,255,186,2,189,255,186,2,204,
+255,186,2,208,255,186,2,216,255,186,2,218,255,186,2,229,255,186,2,241,255,186,2,251,255,186,2,252,255,186,2,
+253,255,186,2,254,255,186,2,255,255,186,3,8,255,186,3,9,255,186,3,10,255,186,3,18,255,186,3,19,255,186,3,20,
+255,186,3,39,255,186,3,40,255,186,3,41,255,186,3,165,255,236,3,166,255,236,3,167,255,236,3,168,255,236,3,169,
+255,236,3,170,255,236,3,171,255,236,3,172,255,236,3,173,255,236,3,174,255,236,3,175,255,236,3,176,255,186,3,
+177,255,186,3,178,255,186,3,179,255,186,3,180,255,186,3,181,255,186,3,182,255,186,3,183,255,186,3,184,255,186,
+3,185,255,186,3,186,255,186,3,253,255,186,3,254,255,186,0,97,0,15,254,180,0,16,255,80,0,17,254,164,0,29,255,
+133,0,30,255,133,0,36,255,63,0,38,255,133,0,42,255,133,0,50,255,133,0,54,255,168,0,68,255,80,0,71,255,63,0,72,
+255,63,0,82,255,82,0,83,255,152,0,84,255,82,0,88,255,133,0,89,255,203,0,98,255,63,0,99,255,63,0,103,255,133,0,
+110,255,80,2,182,255,126,2,183,255,126,2,189,255,133,2,190,255,82,2,194,255,82,2,202,255,63,2,204,255,133,2,
+208,255,133,2,216,255,133,2,218,255,133,2,220,255,168,2,229,255,133,2,235,255,63,2,236,255,63,2,237,255,63,2,
+238,255,63,2,239,255,63,2,240,255,63,2,241,255,133,2,251,255,133,2,252,255,133,2,253,255,133,2,254,255,133,2,
+255,255,133,3,5,255,63,3,6,255,63,3,7,255,63,3,8,255,133,3,9,255,133,3,10,255,133,3,18,255,133,3,19,255,133,3,
+20,255,133,3,39,255,133,3,40,255,133,3,41,255,133,3,45,255,168,3,46,255,168,3,47,255,168,3,48,255,168,3,69,
+255,63,3,165,255,126,3,166,255,126,3,167,255,126,3,168,255,126,3,169,255,126,3,170,255,126,3,171,255,126,3,
+172,255,126,3,173,255,126,3,174,255,126,3,175,255,126,3,176,255,126,3,177,255,126,3,178,255,126,3,179,255,126,
+3,180,255,126,3,181,255,126,3,182,255,126,3,183,255,126,3,184,255,126,3,185,255,126,3,186,255,126,3,227,255,
+82,3,228,255,82,3,229,255,82,3,230,255,82,3,231,255,82,3,232,255,82,3,233,255,82,3,234,255,82,3,235,255,82,3,
+252,255,168,3,253,255,133,3,254,255,133,0,5,0,69,0,20,0,74,0,33,0,83,0,20,0,87,255,221,0,89,255,221,0,2,0,69,
+0,20,0,89,255,203,0,4,0,75,255,221,0,78,255,221,0,79,255,203,0,92,255,221,0,2,0,71,0,20,0,90,0,20,0,4,0,69,
+255,236,0,74,0,51,0,89,255,203,0,91,255,203,0,12,0,3,0,119,0,4,0,170,0,15,255,150,0,17,255,133,0,34,0,170,0,
+68,255,236,0,72,255,221,0,73,0,51,0,78,0,20,0,82,255,221,0,181,0,170,0,183,0,170,0,4,0,74,0,20,0,79,0,20,0,85,
+0,37,0,92,0,35,0,4,0,72,255,186,0,82,255,186,0,92,0,35,0,124,255,186,0,1,0,92,0,35,0,2,0,89,255,201,0,183,255,
+221,0,7,0,15,255,236,0,17,255,221,0,89,255,186,0,90,255,219,0,91,255,184,0,92,255,221,0,93,0,35,0,4,0,15,255,
+236,0,17,255,221,0,90,255,203,0,92,255,221,0,27,0,15,255,117,0,17,255,98,0,29,0,86,0,30,0,86,0,68,0,35,0,70,0,
+35,0,71,0,51,0,72,0,33,0,74,0,51,0,77,0,86,0,78,0,68,0,79,0,68,0,80,0,102,0,81,0,102,0,82,0,33,0,83,0,86,0,84,
+0,51,0,85,0,86,0,86,0,51,0,87,0,102,0,88,0,68,0,89,0,119,0,92,0,119,0,108,0,35,0,110,0,35,0,124,0,33,0,129,0,
+68,0,1,0,90,255,203,0,8,0,15,255,82,0,17,255,66,0,70,255,203,0,71,255,221,0,72,255,203,0,82,255,203,0,84,255,
+205,0,124,255,203,0,12,0,15,255,98,0,17,255,82,0,68,255,233,0,70,255,236,0,71,255,233,0,72,255,233,0,75,0,35,
+0,82,255,221,0,84,255,221,0,108,255,233,0,110,255,233,0,124,255,221,0,5,0,70,255,221,0,71,255,221,0,72,255,
+221,0,82,255,221,0,124,255,221,0,10,0,15,255,82,0,17,255,63,0,68,255,221,0,70,255,221,0,71,255,221,0,72,255,
+221,0,82,255,221,0,108,255,221,0,110,255,221,0,124,255,221,0,5,0,70,255,236,0,71,255,236,0,72,255,236,0,82,
+255,236,0,124,255,236,0,58,0,38,255,219,0,42,255,219,0,50,255,219,0,52,255,217,0,55,255,115,0,56,255,186,0,57,
+255,143,0,58,0,16,0,60,255,82,0,88,255,236,0,89,255,221,0,181,255,117,0,183,255,119,2,189,255,219,2,204,255,
+219,2,208,255,219,2,216,255,217,2,218,255,217,2,221,255,145,2,222,255,206,2,223,255,143,2,226,255,82,2,229,
+255,217,2,241,255,219,2,251,255,219,2,252,255,219,2,253,255,219,2,254,255,219,2,255,255,219,3,0,255,206,3,1,
+255,206,3,2,255,206,3,3,255,206,3,4,255,82,3,8,255,219,3,9,255,219,3,10,255,219,3,18,255,219,3,19,255,219,3,
+20,255,219,3,39,255,219,3,40,255,219,3,41,255,219,3,49,255,145,3,50,255,145,3,51,255,145,3,52,255,145,3,53,
+255,206,3,54,255,206,3,55,255,206,3,56,255,206,3,57,255,206,3,58,255,206,3,63,255,82,3,64,255,82,3,65,255,82,
+3,253,255,219,3,254,255,219,0,57,0,38,255,219,0,42,255,219,0,50,255,219,0,52,255,217,0,55,255,115,0,56,255,
+186,0,57,255,143,0,58,0,16,0,60,255,82,0,89,255,221,0,181,255,117,0,183,255,119,2,189,255,219,2,204,255,219,2,
+208,255,219,2,216,255,217,2,218,255,217,2,221,255,145,2,222,255,206,2,223,255,143,2,226,255,82,2,229,255,217,
+2,241,255,219,2,251,255,219,2,252,255,219,2,253,255,219,2,254,255,219,2,255,255,219,3,0,255,206,3,1,255,206,3,
+2,255,206,3,3,255,206,3,4,255,82,3,8,255,219,3,9,255,219,3,10,255,219,3,18,255,219,3,19,255,219,3,20,255,219,
+3,39,255,219,3,40,255,219,3,41,255,219,3,49,255,145,3,50,255,145,3,51,255,145,3,52,255,145,3,53,255,206,3,54,
+255,206,3,55,255,206,3,56,255,206,3,57,255,206,3,58,255,206,3,63,255,82,3,64,255,82,3,65,255,82,3,253,255,219,
+3,254,255,219,0,23,0,36,255,186,0,55,255,203,0,57,255,168,0,58,255,221,0,59,255,150,0,60,255,117,2,202,255,
+191,2,225,255,236,2,226,255,216,2,235,255,191,2,236,255,191,2,237,255,191,2,238,255,191,2,239,255,191,2,240,
+255,191,3,4,255,216,3,5,255,191,3,6,255,191,3,7,255,191,3,63,255,216,3,64,255,216,3,65,255,216,3,69,255,191,0,
+23,0,36,255,186,2,190,255,231,2,194,255,231,2,202,255,203,2,235,255,203,2,236,255,203,2,237,255,203,2,238,255,
+203,2,239,255,203,2,240,255,203,3,5,255,203,3,6,255,203,3,7,255,203,3,69,255,203,3,227,255,231,3,228,255,231,
+3,229,255,231,3,230,255,231,3,231,255,231,3,232,255,231,3,233,255,231,3,234,255,231,3,235,255,231,0,1,0,89,
+255,221,0,5,0,89,255,186,0,90,255,219,0,91,255,184,0,92,255,221,0,93,0,35,0,12,2,182,255,236,3,165,255,236,3,
+166,255,236,3,167,255,236,3,168,255,236,3,169,255,236,3,170,255,236,3,171,255,236,3,172,255,236,3,173,255,236,
+3,174,255,236,3,175,255,236,0,45,2,189,255,219,2,204,255,219,2,208,255,219,2,216,255,217,2,218,255,217,2,221,
+255,145,2,222,255,206,2,223,255,143,2,226,255,82,2,229,255,217,2,241,255,219,2,251,255,219,2,252,255,219,2,
+253,255,219,2,254,255,219,2,255,255,219,3,0,255,206,3,1,255,206,3,2,255,206,3,3,255,206,3,4,255,82,3,8,255,
+219,3,9,255,219,3,10,255,219,3,18,255,219,3,19,255,219,3,20,255,219,3,39,255,219,3,40,255,219,3,41,255,219,3,
+49,255,145,3,50,255,145,3,51,255,145,3,52,255,145,3,53,255,206,3,54,255,206,3,55,255,206,3,56,255,206,3,57,
+255,206,3,58,255,206,3,63,255,82,3,64,255,82,3,65,255,82,3,253,255,219,3,254,255,219,0,17,2,202,255,191,2,225,
+255,236,2,226,255,216,2,235,255,191,2,236,255,191,2,237,255,191,2,238,255,191,2,239,255,191,2,240,255,191,3,4,
+255,216,3,5,255,191,3,6,255,191,3,7,255,191,3,63,255,216,3,64,255,216,3,65,255,216,3,69,255,191,0,14,0,36,255,
+117,0,98,255,117,0,99,255,117,2,202,255,133,2,235,255,133,2,236,255,133,2,237,255,133,2,238,255,133,2,239,255,
+133,2,240,255,133,3,5,255,133,3,6,255,133,3,7,255,133,3,69,255,133,0,14,0,36,255,133,0,98,255,133,0,99,255,
+133,2,202,255,133,2,235,255,133,2,236,255,133,2,237,255,133,2,238,255,133,2,239,255,133,2,240,255,133,3,5,255,
+133,3,6,255,133,3,7,255,133,3,69,255,133,0,5,0,71,255,221,0,79,0,35,0,85,0,20,0,86,255,203,0,89,0,35,0,75,2,
+182,255,126,2,183,255,126,2,189,255,133,2,190,255,82,2,194,255,82,2,202,255,63,2,204,255,133,2,208,255,133,2,
+216,255,133,2,218,255,133,2,220,255,168,2,229,255,133,2,235,255,63,2,236,255,63,2,237,255,63,2,238,255,63,2,
+239,255,63,2,240,255,63,2,241,255,133,2,251,255,133,2,252,255,133,2,253,255,133,2,254,255,133,2,255,255,133,3,
+5,255,63,3,6,255,63,3,7,255,63,3,8,255,133,3,9,255,133,3,10,255,133,3,18,255,133,3,19,255,133,3,20,255,133,3,
+39,255,133,3,40,255,133,3,41,255,133,3,45,255,168,3,46,255,168,3,47,255,168,3,48,255,168,3,69,255,63,3,165,
+255,126,3,166,255,126,3,167,255,126,3,168,255,126,3,169,255,126,3,170,255,126,3,171,255,126,3,172,255,126,3,
+173,255,126,3,174,255,126,3,175,255,126,3,176,255,126,3,177,255,126,3,178,255,126,3,179,255,126,3,180,255,126,
+3,181,255,126,3,182,255,126,3,183,255,126,3,184,255,126,3,185,255,126,3,186,255,126,3,227,255,82,3,228,255,82,
+3,229,255,82,3,230,255,82,3,231,255,82,3,232,255,82,3,233,255,82,3,234,255,82,3,235,255,82,3,252,255,168,3,
+253,255,133,3,254,255,133,0,1,0,196,255,139,0,22,2,190,255,231,2,194,255,231,2,202,255,203,2,235,255,203,2,
+236,255,203,2,237,255,203,2,238,255,203,2,239,255,203,2,240,255,203,3,5,255,203,3,6,255,203,3,7,255,203,3,69,
+255,203,3,227,255,231,3,228,255,231,3,229,255,231,3,230,255,231,3,231,255,231,3,232,255,231,3,233,255,231,3,
+234,255,231,3,235,255,231,0,16,2,202,255,168,2,226,255,216,2,235,255,168,2,236,255,168,2,237,255,168,2,238,
+255,168,2,239,255,168,2,240,255,168,3,4,255,216,3,5,255,168,3,6,255,168,3,7,255,168,3,63,255,216,3,64,255,216,
+3,65,255,216,3,69,255,168,0,62,2,183,255,226,2,189,255,221,2,204,255,221,2,208,255,221,2,216,255,221,2,218,
+255,221,2,221,255,152,2,222,255,233,2,223,255,152,2,224,255,221,2,226,255,98,2,229,255,221,2,241,255,221,2,
+251,255,221,2,252,255,221,2,253,255,221,2,254,255,221,2,255,255,221,3,0,255,233,3,1,255,233,3,2,255,233,3,3,
+255,233,3,4,255,98,3,8,255,221,3,9,255,221,3,10,255,221,3,18,255,221,3,19,255,221,3,20,255,221,3,39,255,221,3,
+40,255,221,3,41,255,221,3,49,255,152,3,50,255,152,3,51,255,152,3,52,255,152,3,53,255,233,3,54,255,233,3,55,
+255,233,3,56,255,233,3,57,255,233,3,58,255,233,3,59,255,221,3,60,255,221,3,61,255,221,3,62,255,221,3,63,255,
+98,3,64,255,98,3,65,255,98,3,176,255,226,3,177,255,226,3,178,255,226,3,179,255,226,3,180,255,226,3,181,255,
+226,3,182,255,226,3,183,255,226,3,184,255,226,3,185,255,226,3,186,255,226,3,253,255,221,3,254,255,221,0,23,2,
+189,255,221,2,204,255,221,2,208,255,221,2,216,255,221,2,218,255,221,2,229,255,221,2,241,255,221,2,251,255,221,
+2,252,255,221,2,253,255,221,2,254,255,221,2,255,255,221,3,8,255,221,3,9,255,221,3,10,255,221,3,18,255,221,3,
+19,255,221,3,20,255,221,3,39,255,221,3,40,255,221,3,41,255,221,3,253,255,221,3,254,255,221,0,69,2,182,255,226,
+2,183,255,206,2,189,255,186,2,190,255,152,2,194,255,152,2,202,255,117,2,204,255,186,2,208,255,186,2,216,255,
+186,2,218,255,186,2,229,255,186,2,235,255,117,2,236,255,117,2,237,255,117,2,238,255,117,2,239,255,117,2,240,
+255,117,2,241,255,186,2,251,255,186,2,252,255,186,2,253,255,186,2,254,255,186,2,255,255,186,3,5,255,117,3,6,
+255,117,3,7,255,117,3,8,255,186,3,9,255,186,3,10,255,186,3,18,255,186,3,19,255,186,3,20,255,186,3,39,255,186,
+3,40,255,186,3,41,255,186,3,69,255,117,3,165,255,226,3,166,255,226,3,167,255,226,3,168,255,226,3,169,255,226,
+3,170,255,226,3,171,255,226,3,172,255,226,3,173,255,226,3,174,255,226,3,175,255,226,3,176,255,206,3,177,255,
+206,3,178,255,206,3,179,255,206,3,180,255,206,3,181,255,206,3,182,255,206,3,183,255,206,3,184,255,206,3,185,
+255,206,3,186,255,206,3,227,255,152,3,228,255,152,3,229,255,152,3,230,255,152,3,231,255,152,3,232,255,152,3,
+233,255,152,3,234,255,152,3,235,255,152,3,253,255,186,3,254,255,186,0,35,2,183,255,186,2,189,255,186,2,204,
+255,216,2,208,255,216,2,216,255,216,2,218,255,216,2,229,255,216,2,241,255,216,2,251,255,216,2,252,255,216,2,
+253,255,216,2,254,255,216,2,255,255,216,3,8,255,216,3,9,255,216,3,10,255,216,3,18,255,216,3,19,255,216,3,20,
+255,216,3,39,255,216,3,40,255,216,3,41,255,216,3,176,255,186,3,177,255,186,3,178,255,186,3,179,255,186,3,180,
+255,186,3,181,255,186,3,182,255,186,3,183,255,186,3,184,255,186,3,185,255,186,3,186,255,186,3,253,255,216,3,
+254,255,216,0,46,2,182,255,226,2,189,255,221,2,190,255,221,2,194,255,221,2,204,255,221,2,208,255,221,2,216,
+255,221,2,218,255,221,2,229,255,221,2,241,255,221,2,251,255,221,2,252,255,221,2,253,255,221,2,254,255,221,2,
+255,255,221,3,8,255,221,3,9,255,221,3,10,255,221,3,18,255,221,3,19,255,221,3,20,255,221,3,39,255,221,3,40,255,
+221,3,41,255,221,3,165,255,226,3,166,255,226,3,167,255,226,3,168,255,226,3,169,255,226,3,170,255,226,3,171,
+255,226,3,172,255,226,3,173,255,226,3,174,255,226,3,175,255,226,3,227,255,221,3,228,255,221,3,229,255,221,3,
+230,255,221,3,231,255,221,3,232,255,221,3,233,255,221,3,234,255,221,3,235,255,221,3,253,255,221,3,254,255,221,
+0,16,0,55,255,226,0,57,255,186,0,58,255,226,0,60,255,126,0,187,255,126,0,235,255,126,1,37,255,226,1,39,255,
+226,1,131,255,226,1,141,255,226,1,143,255,126,2,62,255,226,2,64,255,226,2,66,255,226,2,68,255,126,2,159,255,
+226,0,12,0,55,255,206,0,57,255,186,0,59,255,186,0,60,255,126,0,187,255,126,0,235,255,126,1,37,255,206,1,39,
+255,206,1,131,255,206,1,143,255,126,2,68,255,126,2,159,255,206,0,6,0,57,255,226,0,60,255,176,0,187,255,176,0,
+235,255,176,1,143,255,176,2,68,255,176,0,47,0,15,255,203,0,17,255,203,0,36,255,186,0,55,255,203,0,57,255,168,
+0,58,255,221,0,59,255,150,0,60,255,117,0,98,255,186,0,99,255,186,0,173,255,186,0,174,255,186,0,187,255,117,0,
+199,255,186,0,201,255,186,0,235,255,117,1,5,255,186,1,7,255,186,1,37,255,203,1,39,255,203,1,82,255,186,1,131,
+255,203,1,141,255,221,1,143,255,117,1,146,255,186,2,62,255,221,2,64,255,221,2,66,255,221,2,68,255,117,2,159,
+255,203,2,202,255,191,2,225,255,236,2,226,255,216,2,235,255,191,2,236,255,191,2,237,255,191,2,238,255,191,2,
+239,255,191,2,240,255,191,3,4,255,216,3,5,255,191,3,6,255,191,3,7,255,191,3,63,255,216,3,64,255,216,3,65,255,
+216,3,69,255,191,0,5,2,195,255,221,3,243,255,221,3,244,255,221,3,245,255,221,3,246,255,221,0,5,2,196,0,35,3,
+247,0,35,3,248,0,35,3,249,0,35,3,250,0,35,0,11,2,190,255,221,2,194,255,221,3,227,255,221,3,228,255,221,3,229,
+255,221,3,230,255,221,3,231,255,221,3,232,255,221,3,233,255,221,3,234,255,221,3,235,255,221,0,53,0,5,255,117,
+0,10,255,117,0,181,255,117,0,183,255,117,2,204,255,219,2,208,255,219,2,216,255,219,2,218,255,219,2,221,255,
+115,2,222,255,186,2,223,255,143,2,224,255,216,2,226,255,82,2,229,255,219,2,241,255,219,2,251,255,219,2,252,
+255,219,2,253,255,219,2,254,255,219,2,255,255,219,3,0,255,186,3,1,255,186,3,2,255,186,3,3,255,186,3,4,255,82,
+3,8,255,219,3,9,255,219,3,10,255,219,3,18,255,219,3,19,255,219,3,20,255,219,3,39,255,219,3,40,255,219,3,41,
+255,219,3,49,255,115,3,50,255,115,3,51,255,115,3,52,255,115,3,53,255,186,3,54,255,186,3,55,255,186,3,56,255,
+186,3,57,255,186,3,58,255,186,3,59,255,216,3,60,255,216,3,61,255,216,3,62,255,216,3,63,255,82,3,64,255,82,3,
+65,255,82,3,253,255,219,3,254,255,219,0,22,2,202,255,221,2,222,255,223,2,235,255,221,2,236,255,221,2,237,255,
+221,2,238,255,221,2,239,255,221,2,240,255,221,3,0,255,223,3,1,255,223,3,2,255,223,3,3,255,223,3,5,255,221,3,6,
+255,221,3,7,255,221,3,53,255,223,3,54,255,223,3,55,255,223,3,56,255,223,3,57,255,223,3,58,255,223,3,69,255,
+221,0,24,0,15,255,236,0,17,255,236,2,202,255,168,2,223,255,186,2,224,0,35,2,226,255,186,2,235,255,168,2,236,
+255,168,2,237,255,168,2,238,255,168,2,239,255,168,2,240,255,168,3,4,255,186,3,5,255,168,3,6,255,168,3,7,255,
+168,3,59,0,35,3,60,0,35,3,61,0,35,3,62,0,35,3,63,255,186,3,64,255,186,3,65,255,186,3,69,255,168,0,13,0,15,255,
+126,0,17,255,126,2,202,255,113,2,235,255,113,2,236,255,113,2,237,255,113,2,238,255,113,2,239,255,113,2,240,
+255,113,3,5,255,113,3,6,255,113,3,7,255,113,3,69,255,113,0,11,2,202,255,236,2,235,255,236,2,236,255,236,2,237,
+255,236,2,238,255,236,2,239,255,236,2,240,255,236,3,5,255,236,3,6,255,236,3,7,255,236,3,69,255,236,0,13,0,15,
+255,219,0,17,255,219,2,202,255,203,2,235,255,203,2,236,255,203,2,237,255,203,2,238,255,203,2,239,255,203,2,
+240,255,203,3,5,255,203,3,6,255,203,3,7,255,203,3,69,255,203,0,22,2,204,255,186,2,208,255,186,2,216,255,186,2,
+218,255,186,2,229,255,186,2,241,255,186,2,251,255,186,2,252,255,186,2,253,255,186,2,254,255,186,2,255,255,186,
+3,8,255,186,3,9,255,186,3,10,255,186,3,18,255,186,3,19,255,186,3,20,255,186,3,39,255,186,3,40,255,186,3,41,
+255,186,3,253,255,186,3,254,255,186,0,53,0,5,255,152,0,10,255,152,0,181,255,152,0,183,255,152,2,204,255,221,2,
+208,255,221,2,216,255,221,2,218,255,221,2,221,255,152,2,222,255,203,2,223,255,152,2,224,255,221,2,226,255,98,
+2,229,255,221,2,241,255,221,2,251,255,221,2,252,255,221,2,253,255,221,2,254,255,221,2,255,255,221,3,0,255,203,
+3,1,255,203,3,2,255,203,3,3,255,203,3,4,255,98,3,8,255,221,3,9,255,221,3,10,255,221,3,18,255,221,3,19,255,221,
+3,20,255,221,3,39,255,221,3,40,255,221,3,41,255,221,3,49,255,152,3,50,255,152,3,51,255,152,3,52,255,152,3,53,
+255,203,3,54,255,203,3,55,255,203,3,56,255,203,3,57,255,203,3,58,255,203,3,59,255,221,3,60,255,221,3,61,255,
+221,3,62,255,221,3,63,255,98,3,64,255,98,3,65,255,98,3,253,255,221,3,254,255,221,0,30,0,15,255,221,0,17,255,
+221,2,202,255,226,2,221,255,203,2,223,255,168,2,224,255,221,2,225,255,150,2,226,255,117,2,235,255,226,2,236,
+255,226,2,237,255,226,2,238,255,226,2,239,255,226,2,240,255,226,3,4,255,117,3,5,255,226,3,6,255,226,3,7,255,
+226,3,49,255,203,3,50,255,203,3,51,255,203,3,52,255,203,3,59,255,221,3,60,255,221,3,61,255,221,3,62,255,221,3,
+63,255,117,3,64,255,117,3,65,255,117,3,69,255,226,0,13,0,15,255,106,0,17,255,106,2,202,255,82,2,235,255,82,2,
+236,255,82,2,237,255,82,2,238,255,82,2,239,255,82,2,240,255,82,3,5,255,82,3,6,255,82,3,7,255,82,3,69,255,82,0,
+33,2,204,255,221,2,208,255,221,2,221,255,238,2,222,255,221,2,223,255,221,2,226,255,168,2,241,255,221,3,0,255,
+221,3,1,255,221,3,2,255,221,3,3,255,221,3,4,255,168,3,8,255,221,3,9,255,221,3,10,255,221,3,18,255,221,3,19,
+255,221,3,20,255,221,3,49,255,238,3,50,255,238,3,51,255,238,3,52,255,238,3,53,255,221,3,54,255,221,3,55,255,
+221,3,56,255,221,3,57,255,221,3,58,255,221,3,63,255,168,3,64,255,168,3,65,255,168,3,253,255,221,3,254,255,221,
+0,38,0,15,255,103,0,16,255,177,0,17,255,103,0,178,255,177,0,179,255,177,2,202,255,117,2,204,255,226,2,208,255,
+226,2,216,255,186,2,218,255,186,2,229,255,186,2,235,255,117,2,236,255,117,2,237,255,117,2,238,255,117,2,239,
+255,117,2,240,255,117,2,241,255,226,2,251,255,186,2,252,255,186,2,253,255,186,2,254,255,186,2,255,255,186,3,5,
+255,117,3,6,255,117,3,7,255,117,3,8,255,226,3,9,255,226,3,10,255,226,3,18,255,226,3,19,255,226,3,20,255,226,3,
+39,255,186,3,40,255,186,3,41,255,186,3,69,255,117,3,253,255,226,3,254,255,226,0,38,0,15,255,106,0,16,255,218,
+0,17,255,106,0,178,255,218,0,179,255,218,2,202,255,139,2,204,255,186,2,208,255,186,2,216,255,186,2,218,255,
+186,2,229,255,186,2,235,255,139,2,236,255,139,2,237,255,139,2,238,255,139,2,239,255,139,2,240,255,139,2,241,
+255,186,2,251,255,186,2,252,255,186,2,253,255,186,2,254,255,186,2,255,255,186,3,5,255,139,3,6,255,139,3,7,255,
+139,3,8,255,186,3,9,255,186,3,10,255,186,3,18,255,186,3,19,255,186,3,20,255,186,3,39,255,186,3,40,255,186,3,
+41,255,186,3,69,255,139,3,253,255,186,3,254,255,186,0,35,0,15,255,188,0,17,255,188,2,202,255,216,2,204,255,
+221,2,208,255,221,2,216,255,221,2,218,255,221,2,229,255,221,2,235,255,216,2,236,255,216,2,237,255,216,2,238,
+255,216,2,239,255,216,2,240,255,216,2,241,255,221,2,251,255,221,2,252,255,221,2,253,255,221,2,254,255,221,2,
+255,255,221,3,5,255,216,3,6,255,216,3,7,255,216,3,8,255,221,3,9,255,221,3,10,255,221,3,18,255,221,3,19,255,
+221,3,20,255,221,3,39,255,221,3,40,255,221,3,41,255,221,3,69,255,216,3,253,255,221,3,254,255,221,0,44,0,15,
+254,244,0,16,255,90,0,17,254,244,0,178,255,90,0,179,255,90,2,202,255,82,2,204,255,163,2,208,255,163,2,216,255,
+133,2,218,255,133,2,220,255,168,2,229,255,133,2,235,255,82,2,236,255,82,2,237,255,82,2,238,255,82,2,239,255,
+82,2,240,255,82,2,241,255,163,2,251,255,133,2,252,255,133,2,253,255,133,2,254,255,133,2,255,255,133,3,5,255,
+82,3,6,255,82,3,7,255,82,3,8,255,133,3,9,255,133,3,10,255,133,3,18,255,133,3,19,255,163,3,20,255,133,3,39,255,
+133,3,40,255,133,3,41,255,133,3,45,255,168,3,46,255,168,3,47,255,168,3,48,255,168,3,69,255,82,3,252,255,168,3,
+253,255,133,3,254,255,133,0,11,2,202,255,203,2,235,255,203,2,236,255,203,2,237,255,203,2,238,255,203,2,239,
+255,203,2,240,255,203,3,5,255,203,3,6,255,203,3,7,255,203,3,69,255,203,0,30,0,15,255,221,0,17,255,221,2,202,
+255,219,2,221,255,203,2,223,255,186,2,224,255,221,2,225,255,150,2,226,255,117,2,235,255,219,2,236,255,219,2,
+237,255,219,2,238,255,219,2,239,255,219,2,240,255,219,3,4,255,117,3,5,255,219,3,6,255,219,3,7,255,219,3,49,
+255,203,3,50,255,203,3,51,255,203,3,52,255,203,3,59,255,221,3,60,255,221,3,61,255,221,3,62,255,221,3,63,255,
+117,3,64,255,117,3,65,255,117,3,69,255,219,0,11,2,204,255,221,2,208,255,221,2,241,255,221,3,8,255,221,3,9,255,
+221,3,10,255,221,3,18,255,221,3,19,255,221,3,20,255,221,3,253,255,221,3,254,255,221,0,64,0,38,255,186,0,42,
+255,186,0,50,255,186,0,52,255,186,0,72,255,186,0,82,255,186,0,88,255,203,0,89,255,221,0,92,255,221,0,100,255,
+186,0,103,255,186,0,124,255,186,0,129,255,203,0,175,255,186,0,176,255,186,0,208,255,186,0,209,255,186,0,211,
+255,186,0,248,255,186,0,253,255,186,0,255,255,186,1,29,255,186,1,84,255,186,1,86,255,186,1,94,255,186,1,96,
+255,186,1,98,255,186,1,123,255,186,1,125,255,186,2,183,255,186,2,189,255,186,2,204,255,216,2,208,255,216,2,
+216,255,216,2,218,255,216,2,229,255,216,2,241,255,216,2,251,255,216,2,252,255,216,2,253,255,216,2,254,255,216,
+2,255,255,216,3,8,255,216,3,9,255,216,3,10,255,216,3,18,255,216,3,19,255,216,3,20,255,216,3,39,255,216,3,40,
+255,216,3,41,255,216,3,176,255,186,3,177,255,186,3,178,255,186,3,179,255,186,3,180,255,186,3,181,255,186,3,
+182,255,186,3,183,255,186,3,184,255,186,3,185,255,186,3,186,255,186,3,253,255,216,3,254,255,216,0,2,0,88,0,36,
+0,39,0,0,0,41,0,42,0,4,0,45,0,47,0,6,0,49,0,53,0,9,0,55,0,60,0,14,0,68,0,74,0,20,0,78,0,79,0,27,0,81,0,83,0,
+29,0,85,0,86,0,32,0,89,0,93,0,34,0,98,0,99,0,39,0,103,0,104,0,41,0,108,0,108,0,43,0,110,0,110,0,44,0,124,0,
+124,0,45,0,145,0,145,0,46,0,173,0,175,0,47,0,180,0,180,0,50,0,182,0,183,0,51,0,187,0,187,0,53,0,196,0,196,0,
+54,0,199,0,199,0,55,0,201,0,201,0,56,0,208,0,209,0,57,0,211,0,214,0,59,0,233,0,233,0,63,0,235,0,235,0,64,1,5,
+1,5,0,65,1,7,1,7,0,66,1,9,1,9,0,67,1,11,1,11,0,68,1,16,1,16,0,69,1,18,1,18,0,70,1,20,1,20,0,71,1,29,1,29,0,72,
+1,31,1,31,0,73,1,33,1,33,0,74,1,37,1,37,0,75,1,39,1,39,0,76,1,41,1,41,0,77,1,43,1,43,0,78,1,82,1,82,0,79,1,
+112,1,112,0,80,1,114,1,114,0,81,1,117,1,117,0,82,1,121,1,121,0,83,1,123,1,123,0,84,1,125,1,125,0,85,1,127,1,
+127,0,86,1,131,1,131,0,87,1,133,1,133,0,88,1,135,1,135,0,89,1,137,1,137,0,90,1,139,1,139,0,91,1,141,1,141,0,
+92,1,143,1,143,0,93,1,146,1,146,0,94,1,150,1,150,0,95,2,62,2,62,0,96,2,64,2,64,0,97,2,66,2,66,0,98,2,68,2,68,
+0,99,2,159,2,159,0,100,2,182,2,185,0,101,2,189,2,190,0,105,2,192,2,193,0,107,2,196,2,196,0,109,2,200,2,200,0,
+110,2,202,2,203,0,111,2,205,2,205,0,113,2,207,2,207,0,114,2,209,2,219,0,115,2,221,2,226,0,126,2,233,2,233,0,
+132,2,235,2,240,0,133,2,246,3,7,0,139,3,11,3,12,0,157,3,21,3,21,0,159,3,23,3,33,0,160,3,35,3,44,0,171,3,49,3,
+65,0,181,3,69,3,69,0,198,3,165,3,190,0,199,3,213,3,217,0,225,3,226,3,226,0,230,3,235,3,235,0,231,3,237,3,242,
+0,232,3,247,3,250,0,238,0,2,1,120,0,5,0,92,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,2,0,2,1,224,2,12,0,0,3,
+105,3,151,0,45,0,2,1,16,0,5,0,66,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,
+72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,
+0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,
+0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,0,36,0,0,
+0,2,0,4,1,154,1,154,0,0,1,156,1,161,0,1,1,163,1,188,0,7,3,72,3,104,0,33,0,2,4,4,0,5,0,255,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,0,36,0,72,
+0,2,0,78,0,36,0,61,0,0,0,98,0,104,0,26,0,144,0,145,0,33,0,173,0,176,0,35,0,187,0,187,0,39,0,199,0,209,0,40,0,
+211,0,214,0,51,0,226,0,226,0,55,0,228,0,228,0,56,0,230,0,230,0,57,0,233,0,233,0,58,0,235,0,235,0,59,0,237,0,
+237,0,60,0,248,0,248,0,61,0,250,0,251,0,62,0,253,0,253,0,64,0,255,0,255,0,65,1,5,1,5,0,66,1,7,1,7,0,67,1,9,1,
+9,0,68,1,11,1,12,0,69,1,14,1,14,0,71,1,16,1,16,0,72,1,18,1,18,0,73,1,20,1,20,0,74,1,22,1,22,0,75,1,24,1,24,0,
+76,1,26,1,26,0,77,1,29,1,29,0,78,1,31,1,31,0,79,1,33,1,33,0,80,1,35,1,35,0,81,1,39,1,39,0,82,1,41,1,41,0,83,1,
+43,1,43,0,84,1,45,1,45,0,85,1,47,1,47,0,86,1,82,1,82,0,87,1,84,1,84,0,88,1,86,1,86,0,89,1,88,1,88,0,90,1,90,1,
+90,0,91,1,92,1,92,0,92,1,94,1,94,0,93,1,96,1,96,0,94,1,98,1,98,0,95,1,100,1,100,0,96,1,102,1,102,0,97,1,104,1,
+104,0,98,1,106,1,106,0,99,1,108,1,108,0,100,1,110,1,110,0,101,1,112,1,112,0,102,1,114,1,114,0,103,1,117,1,117,
+0,104,1,119,1,119,0,105,1,121,1,121,0,106,1,123,1,123,0,107,1,125,1,125,0,108,1,127,1,127,0,109,1,129,1,129,0,
+110,1,131,1,131,0,111,1,133,1,133,0,112,1,135,1,135,0,113,1,137,1,137,0,114,1,139,1,139,0,115,1,141,1,141,0,
+116,1,143,1,143,0,117,1,146,1,146,0,118,1,148,1,148,0,119,1,150,1,150,0,120,2,62,2,62,0,121,2,64,2,64,0,122,2,
+66,2,66,0,123,2,68,2,68,0,124,2,159,2,159,0,125,2,202,3,71,0,126,3,252,3,254,0,252,0,2,0,38,0,2,0,15,0,200,0,
+200,0,200,0,200,0,200,0,200,0,200,1,148,1,148,0,200,0,200,0,200,0,200,0,200,0,200,0,2,0,10,0,11,0,12,0,0,0,16,
+0,16,0,2,0,62,0,62,0,3,0,64,0,64,0,4,0,94,0,94,0,5,0,96,0,96,0,6,0,162,0,163,0,7,0,169,0,170,0,9,0,178,0,179,
+0,11,0,190,0,191,0,13,0,0,0,1,0,0,0,10,1,14,5,132,0,3,99,121,114,108,0,20,103,114,101,107,0,58,108,97,116,110,
+0,96,0,4,0,0,0,0,255,255,0,14,0,6,0,12,0,18,0,27,0,33,0,39,0,51,0,0,0,45,0,57,0,63,0,69,0,75,0,81,0,4,0,0,0,0,
+255,255,0,14,0,7,0,13,0,19,0,28,0,34,0,40,0,52,0,1,0,46,0,58,0,64,0,70,0,76,0,82,0,22,0,3,76,84,72,32,0,56,82,
+79,77,32,0,92,84,82,75,32,0,128,0,0,255,255,0,14,0,8,0,14,0,20,0,29,0,35,0,41,0,53,0,2,0,47,0,59,0,65,0,71,0,
+77,0,83,0,0,255,255,0,15,0,9,0,15,0,21,0,24,0,30,0,36,0,42,0,54,0,3,0,48,0,60,0,66,0,72,0,78,0,84,0,0,255,255,
+0,15,0,10,0,16,0,22,0,25,0,31,0,37,0,43,0,55,0,4,0,49,0,61,0,67,0,73,0,79,0,85,0,0,255,255,0,15,0,11,0,17,0,
+23,0,26,0,32,0,38,0,44,0,56,0,5,0,50,0,62,0,68,0,74,0,80,0,86,0,87,99,50,115,99,2,12,99,50,115,99,2,22,99,50,
+115,99,2,32,99,50,115,99,2,42,99,50,115,99,2,52,99,50,115,99,2,62,100,110,111,109,2,72,100,110,111,109,2,78,
+100,110,111,109,2,84,100,110,111,109,2,90,100,110,111,109,2,96,100,110,111,109,2,102,102,114,97,99,2,108,102,
+114,97,99,2,118,102,114,97,99,2,128,102,114,97,99,2,138,102,114,97,99,2,148,102,114,97,99,2,158,108,110,117,
+109,2,168,108,110,117,109,2,174,108,110,117,109,2,180,108,110,117,109,2,186,108,110,117,109,2,192,108,110,117,
+109,2,198,108,111,99,108,2,204,108,111,99,108,2,210,108,111,99,108,2,216,110,117,109,114,2,222,110,117,109,
+114,2,228,110,117,109,114,2,234,110,117,109,114,2,240,110,117,109,114,2,246,110,117,109,114,2,252,111,110,117,
+109,3,2,111,110,117,109,3,10,111,110,117,109,3,18,111,110,117,109,3,26,111,110,117,109,3,34,111,110,117,109,3,
+42,112,110,117,109,3,50,112,110,117,109,3,56,112,110,117,109,3,62,112,110,117,109,3,68,112,110,117,109,3,74,
+112,110,117,109,3,80,115,97,108,116,3,86,115,97,108,116,3,92,115,97,108,116,3,98,115,97,108,116,3,104,115,97,
+108,116,3,110,115,97,108,116,3,116,115,109,99,112,3,122,115,109,99,112,3,132,115,109,99,112,3,142,115,109,99,
+112,3,152,115,109,99,112,3,162,115,109,99,112,3,172,115,115,48,49,3,182,115,115,48,49,3,188,115,115,48,49,3,
+194,115,115,48,49,3,200,115,115,48,49,3,206,115,115,48,49,3,212,115,115,48,50,3,218,115,115,48,50,3,224,115,
+115,48,50,3,230,115,115,48,50,3,236,115,115,48,50,3,242,115,115,48,50,3,248,115,115,48,51,3,254,115,115,48,51,
+4,4,115,115,48,51,4,10,115,115,48,51,4,16,115,115,48,51,4,22,115,115,48,51,4,28,116,110,117,109,4,34,116,110,
+117,109,4,42,116,110,117,109,4,50,116,110,117,109,4,58,116,110,117,109,4,66,116,110,117,109,4,74,117,110,105,
+99,4,82,117,110,105,99,4,88,117,110,105,99,4,94,117,110,105,99,4,100,117,110,105,99,4,106,117,110,105,99,4,
+112,0,0,0,3,0,4,0,5,0,6,0,0,0,3,0,4,0,5,0,6,0,0,0,3,0,4,0,5,0,6,0,0,0,3,0,4,0,5,0,6,0,0,0,3,0,4,0,5,0,6,0,0,0,
+3,0,4,0,5,0,6,0,0,0,1,0,12,0,0,0,1,0,12,0,0,0,1,0,12,0,0,0,1,0,12,0,0,0,1,0,12,0,0,0,1,0,12,0,0,0,3,0,9,0,10,
+0,11,0,0,0,3,0,9,0,10,0,11,0,0,0,3,0,9,0,10,0,11,0,0,0,3,0,9,0,10,0,11,0,0,0,3,0,9,0,10,0,11,0,0,0,3,0,9,0,10,
+0,11,0,0,0,1,0,19,0,0,0,1,0,19,0,0,0,1,0,19,0,0,0,1,0,19,0,0,0,1,0,19,0,0,0,1,0,19,0,0,0,1,0,1,0,0,0,1,0,0,0,
+0,0,1,0,2,0,0,0,1,0,13,0,0,0,1,0,13,0,0,0,1,0,13,0,0,0,1,0,13,0,0,0,1,0,13,0,0,0,1,0,13,0,0,0,2,0,14,0,16,0,0,
+0,2,0,14,0,16,0,0,0,2,0,14,0,16,0,0,0,2,0,14,0,16,0,0,0,2,0,14,0,16,0,0,0,2,0,14,0,16,0,0,0,1,0,17,0,0,0,1,0,
+17,0,0,0,1,0,17,0,0,0,1,0,17,0,0,0,1,0,17,0,0,0,1,0,17,0,0,0,1,0,21,0,0,0,1,0,21,0,0,0,1,0,21,0,0,0,1,0,21,0,
+0,0,1,0,21,0,0,0,1,0,21,0,0,0,3,0,3,0,7,0,8,0,0,0,3,0,3,0,7,0,8,0,0,0,3,0,3,0,7,0,8,0,0,0,3,0,3,0,7,0,8,0,0,0,
+3,0,3,0,7,0,8,0,0,0,3,0,3,0,7,0,8,0,0,0,1,0,21,0,0,0,1,0,21,0,0,0,1,0,21,0,0,0,1,0,21,0,0,0,1,0,21,0,0,0,1,0,
+21,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,20,0,0,0,1,0,20,0,
+0,0,1,0,20,0,0,0,1,0,20,0,0,0,1,0,20,0,0,0,1,0,20,0,0,0,2,0,15,0,18,0,0,0,2,0,15,0,18,0,0,0,2,0,15,0,18,0,0,0,
+2,0,15,0,18,0,0,0,2,0,15,0,18,0,0,0,2,0,15,0,18,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,22,0,0,0,1,0,
+22,0,0,0,1,0,22,0,24,0,50,0,58,0,66,0,74,0,82,0,90,0,98,0,106,0,114,0,122,0,130,0,138,0,146,0,154,0,162,0,170,
+0,178,0,186,0,194,0,202,0,210,0,218,0,226,0,234,0,1,0,0,0,1,0,192,0,1,0,0,0,1,0,214,0,1,0,0,0,1,0,220,0,1,0,0,
+0,1,0,226,0,1,0,0,0,1,1,78,0,1,0,0,0,1,1,186,0,1,0,0,0,1,2,16,0,1,0,0,0,1,4,230,0,1,0,0,0,1,5,56,0,1,0,0,0,1,
+8,24,0,6,0,0,0,1,8,30,0,1,0,0,0,1,8,66,0,1,0,0,0,1,8,94,0,1,0,0,0,1,8,122,0,1,0,0,0,1,8,150,0,1,0,0,0,1,8,178,
+0,1,0,0,0,1,8,206,0,1,0,0,0,1,8,234,0,1,0,0,0,1,9,6,0,1,0,0,0,1,9,34,0,1,0,0,0,1,9,62,0,1,0,0,0,1,10,96,0,3,0,
+0,0,1,10,234,0,1,0,0,0,1,16,94,0,2,0,14,0,4,2,157,2,158,2,159,2,160,0,2,0,2,0,251,0,252,0,0,1,37,1,38,0,2,0,2,
+0,8,0,1,2,161,0,1,0,1,0,116,0,2,0,8,0,1,2,201,0,1,0,1,0,76,0,2,0,100,0,47,3,105,3,106,3,107,3,108,3,109,3,110,
+3,111,3,112,3,113,3,114,3,115,3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,3,126,3,127,3,128,3,
+129,3,130,3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,138,3,139,3,140,3,141,3,142,3,143,3,144,3,145,3,146,3,
+147,3,148,3,149,3,150,3,151,0,2,0,2,1,224,2,13,0,0,2,60,2,60,0,46,0,2,0,100,0,47,3,105,3,106,3,107,3,108,3,
+109,3,110,3,111,3,112,3,113,3,114,3,115,3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,3,126,3,
+127,3,128,3,129,3,130,3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,138,3,139,3,140,3,141,3,142,3,143,3,144,3,
+145,3,146,3,147,3,148,3,149,3,150,3,151,0,2,0,2,1,224,2,13,0,0,2,60,2,60,0,46,0,2,0,72,0,33,3,96,3,97,3,98,3,
+99,3,100,3,101,3,102,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,3,86,3,87,3,88,3,
+89,3,90,3,91,3,92,3,93,3,94,3,95,3,103,3,104,0,2,0,3,1,154,1,154,0,0,1,156,1,161,0,1,1,163,1,188,0,7,0,2,1,6,
+0,128,3,251,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,
+218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,239,2,240,2,241,2,243,2,250,2,255,3,3,2,228,2,231,
+2,235,2,238,2,254,2,229,3,64,2,237,2,244,2,236,2,245,2,242,2,247,2,248,2,249,2,246,2,252,2,253,2,251,3,1,3,2,
+3,0,2,230,3,48,3,68,2,233,3,4,2,232,3,18,3,27,3,47,3,8,3,9,3,6,3,7,3,11,3,12,3,16,3,17,3,28,3,31,3,33,3,34,3,
+35,3,37,3,41,3,42,3,44,3,45,3,49,3,51,3,56,3,57,3,66,3,67,3,5,3,253,3,20,3,13,3,14,3,15,3,254,3,10,3,19,3,21,
+3,22,3,23,3,24,3,25,3,26,3,29,3,30,3,32,3,36,3,38,3,39,3,40,3,43,3,46,3,52,3,53,3,54,3,55,3,58,3,59,3,63,3,69,
+3,70,3,71,3,60,3,61,3,62,3,65,3,252,0,2,0,78,0,9,0,9,0,0,0,36,0,61,0,1,0,98,0,104,0,27,0,144,0,145,0,34,0,173,
+0,176,0,36,0,187,0,187,0,40,0,199,0,209,0,41,0,211,0,214,0,52,0,226,0,226,0,56,0,228,0,228,0,57,0,230,0,230,0,
+58,0,233,0,233,0,59,0,235,0,235,0,60,0,237,0,237,0,61,0,248,0,248,0,62,0,250,0,251,0,63,0,253,0,253,0,65,0,
+255,0,255,0,66,1,5,1,5,0,67,1,7,1,7,0,68,1,9,1,9,0,69,1,11,1,12,0,70,1,14,1,14,0,72,1,16,1,16,0,73,1,18,1,18,
+0,74,1,20,1,20,0,75,1,22,1,22,0,76,1,24,1,24,0,77,1,26,1,26,0,78,1,29,1,29,0,79,1,31,1,31,0,80,1,33,1,33,0,81,
+1,35,1,35,0,82,1,37,1,37,0,83,1,39,1,39,0,84,1,41,1,41,0,85,1,43,1,43,0,86,1,45,1,45,0,87,1,47,1,47,0,88,1,82,
+1,82,0,89,1,84,1,84,0,90,1,86,1,86,0,91,1,88,1,88,0,92,1,90,1,90,0,93,1,92,1,92,0,94,1,94,1,94,0,95,1,96,1,96,
+0,96,1,98,1,98,0,97,1,100,1,100,0,98,1,102,1,102,0,99,1,104,1,104,0,100,1,106,1,106,0,101,1,108,1,108,0,102,1,
+110,1,110,0,103,1,112,1,112,0,104,1,114,1,114,0,105,1,117,1,117,0,106,1,119,1,119,0,107,1,121,1,121,0,108,1,
+123,1,123,0,109,1,125,1,125,0,110,1,127,1,127,0,111,1,129,1,129,0,112,1,131,1,131,0,113,1,133,1,133,0,114,1,
+135,1,135,0,115,1,137,1,137,0,116,1,139,1,139,0,117,1,141,1,141,0,118,1,143,1,143,0,119,1,146,1,146,0,120,1,
+148,1,148,0,121,1,150,1,150,0,122,2,62,2,62,0,123,2,64,2,64,0,124,2,66,2,66,0,125,2,68,2,68,0,126,2,157,2,157,
+0,127,0,2,0,74,0,34,3,96,3,97,3,98,3,99,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,
+3,86,3,87,3,88,3,89,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,103,3,104,3,100,3,101,3,102,0,2,0,2,1,189,1,192,0,0,
+1,194,1,223,0,4,0,2,1,10,0,130,3,251,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,
+2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,236,2,235,2,237,2,239,2,
+238,2,240,2,241,2,243,2,242,2,244,2,245,2,247,2,246,2,248,2,249,2,250,2,252,2,251,2,253,2,255,2,254,3,1,3,0,3,
+2,3,3,2,234,2,228,2,231,2,229,3,64,2,210,2,230,3,48,3,68,2,233,3,4,2,232,3,18,3,47,3,8,3,9,3,12,3,6,3,7,3,11,
+3,16,3,17,3,28,3,31,3,33,3,34,3,35,3,37,3,41,3,42,3,44,3,45,3,49,3,51,3,56,3,57,3,66,3,67,3,5,3,253,3,20,3,13,
+3,14,3,15,3,254,3,10,3,19,3,21,3,22,3,23,3,24,3,25,3,26,3,29,3,30,3,32,3,36,3,38,3,39,3,40,3,43,3,46,3,52,3,
+53,3,54,3,55,3,58,3,59,3,63,3,69,3,70,3,71,3,60,3,61,3,62,3,65,3,252,3,27,0,2,0,79,0,9,0,9,0,0,0,68,0,93,0,1,
+0,105,0,129,0,27,0,137,0,137,0,52,0,160,0,161,0,53,0,177,0,177,0,55,0,186,0,186,0,56,0,215,0,215,0,57,0,227,0,
+227,0,58,0,229,0,229,0,59,0,231,0,231,0,60,0,234,0,234,0,61,0,236,0,236,0,62,0,238,0,238,0,63,0,249,0,249,0,
+64,0,252,0,252,0,65,0,254,0,254,0,66,1,0,1,1,0,67,1,6,1,6,0,69,1,8,1,8,0,70,1,10,1,10,0,71,1,13,1,13,0,72,1,
+15,1,15,0,73,1,17,1,17,0,74,1,19,1,19,0,75,1,21,1,21,0,76,1,23,1,23,0,77,1,25,1,25,0,78,1,27,1,27,0,79,1,30,1,
+30,0,80,1,32,1,32,0,81,1,34,1,34,0,82,1,36,1,36,0,83,1,38,1,38,0,84,1,40,1,40,0,85,1,42,1,42,0,86,1,44,1,44,0,
+87,1,46,1,46,0,88,1,48,1,48,0,89,1,83,1,83,0,90,1,85,1,85,0,91,1,87,1,87,0,92,1,89,1,89,0,93,1,91,1,91,0,94,1,
+93,1,93,0,95,1,95,1,95,0,96,1,97,1,97,0,97,1,99,1,99,0,98,1,101,1,101,0,99,1,103,1,103,0,100,1,105,1,105,0,
+101,1,107,1,107,0,102,1,109,1,109,0,103,1,111,1,111,0,104,1,113,1,113,0,105,1,115,1,115,0,106,1,118,1,118,0,
+107,1,120,1,120,0,108,1,122,1,122,0,109,1,124,1,124,0,110,1,126,1,126,0,111,1,128,1,128,0,112,1,130,1,130,0,
+113,1,132,1,132,0,114,1,134,1,134,0,115,1,136,1,136,0,116,1,138,1,138,0,117,1,140,1,140,0,118,1,142,1,142,0,
+119,1,144,1,144,0,120,1,147,1,147,0,121,1,149,1,149,0,122,1,151,1,151,0,123,2,63,2,63,0,124,2,65,2,65,0,125,2,
+67,2,67,0,126,2,69,2,69,0,127,2,157,2,157,0,128,2,201,2,201,0,129,0,2,0,8,0,1,0,188,0,1,0,1,0,18,0,3,0,1,0,18,
+0,1,0,34,0,0,0,1,0,0,0,23,0,2,0,2,0,188,0,188,0,0,3,152,3,161,0,1,0,2,0,1,0,19,0,28,0,0,0,2,0,26,0,10,3,164,0,
+241,0,242,0,243,1,4,2,153,3,162,2,154,2,155,3,163,0,2,0,1,0,19,0,28,0,0,0,2,0,26,0,10,3,152,3,153,3,154,3,155,
+3,156,3,157,3,158,3,159,3,160,3,161,0,2,0,1,0,19,0,28,0,0,0,2,0,26,0,10,3,164,0,241,0,242,0,243,1,4,2,153,3,
+162,2,154,2,155,3,163,0,2,0,1,0,19,0,28,0,0,0,2,0,26,0,10,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,
+170,2,171,0,2,0,1,0,19,0,28,0,0,0,2,0,26,0,10,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,2,0,1,2,162,
+2,171,0,0,0,2,0,26,0,10,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,0,2,0,1,2,172,2,181,0,0,0,
+2,0,26,0,10,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,0,2,0,1,0,19,0,28,0,0,0,2,0,26,0,10,0,
+19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,2,0,1,2,172,2,181,0,0,0,2,0,26,0,10,2,172,2,173,2,174,2,175,
+2,176,2,177,2,178,2,179,2,180,2,181,0,2,0,1,2,162,2,171,0,0,0,2,0,96,0,45,2,197,2,198,2,187,2,188,2,189,2,190,
+2,191,2,192,2,193,2,194,2,195,2,196,3,228,3,227,3,229,3,231,3,230,3,232,3,249,3,219,3,220,3,221,3,218,3,242,3,
+247,3,225,3,234,3,235,3,238,3,240,3,241,3,243,3,245,3,233,3,222,3,223,3,224,3,236,3,226,3,237,3,239,3,246,3,
+248,3,250,3,244,0,2,0,33,0,25,0,25,0,0,0,28,0,28,0,1,0,44,0,44,0,2,0,46,0,46,0,3,0,52,0,52,0,4,0,68,0,68,0,5,
+0,77,0,79,0,6,0,84,0,84,0,9,0,87,0,87,0,10,0,92,0,92,0,11,0,105,0,110,0,12,0,186,0,186,0,18,0,204,0,207,0,19,
+0,227,0,227,0,23,0,236,0,236,0,24,0,250,0,250,0,25,1,6,1,6,0,26,1,8,1,8,0,27,1,19,1,19,0,28,1,21,1,21,0,29,1,
+23,1,23,0,30,1,38,1,38,0,31,1,40,1,40,0,32,1,83,1,83,0,33,1,104,1,104,0,34,1,108,1,108,0,35,1,110,1,110,0,36,
+1,113,1,115,0,37,1,118,1,118,0,40,1,132,1,132,0,41,1,144,1,144,0,42,2,69,2,69,0,43,2,160,2,160,0,44,0,2,0,46,
+0,20,2,199,2,200,3,201,3,202,3,203,3,200,3,217,3,207,3,213,3,215,3,216,3,204,3,205,3,206,3,214,3,209,3,208,3,
+210,3,211,3,212,0,2,0,16,0,44,0,44,0,0,0,79,0,79,0,1,0,204,0,207,0,2,0,227,0,227,0,6,0,250,0,250,0,7,1,19,1,
+19,0,8,1,21,1,21,0,9,1,23,1,23,0,10,1,104,1,104,0,11,1,108,1,108,0,12,1,110,1,110,0,13,1,118,1,118,0,14,1,158,
+1,158,0,15,1,171,1,171,0,16,1,187,1,187,0,17,1,229,1,230,0,18,0,1,3,200,0,160,1,70,1,74,1,78,1,82,1,86,1,90,1,
+94,1,98,1,102,1,106,1,110,1,114,1,118,1,122,1,126,1,130,1,134,1,138,1,142,1,146,1,150,1,154,1,158,1,162,1,166,
+1,170,1,174,1,178,1,182,1,186,1,190,1,194,1,198,1,202,1,206,1,210,1,214,1,218,1,222,1,226,1,230,1,234,1,238,1,
+242,1,246,1,250,1,254,2,2,2,6,2,10,2,14,2,18,2,22,2,26,2,30,2,34,2,38,2,42,2,46,2,50,2,54,2,58,2,62,2,66,2,70,
+2,74,2,78,2,82,2,86,2,90,2,94,2,98,2,102,2,106,2,110,2,114,2,118,2,122,2,126,2,130,2,136,2,140,2,144,2,148,2,
+152,2,156,2,160,2,164,2,168,2,172,2,176,2,180,2,184,2,188,2,192,2,196,2,200,2,204,2,208,2,212,2,216,2,220,2,
+224,2,228,2,232,2,236,2,240,2,244,2,248,2,252,3,0,3,4,3,8,3,12,3,16,3,20,3,24,3,28,3,32,3,36,3,40,3,44,3,48,3,
+52,3,56,3,60,3,64,3,68,3,72,3,76,3,80,3,84,3,88,3,92,3,96,3,100,3,104,3,108,3,112,3,116,3,120,3,124,3,128,3,
+132,3,136,3,140,3,144,3,148,3,152,3,156,3,160,3,164,3,168,3,172,3,176,3,180,3,184,3,188,3,192,3,196,0,1,2,182,
+0,1,2,183,0,1,2,185,0,1,2,184,0,1,2,186,0,1,2,182,0,1,0,37,0,1,0,38,0,1,0,39,0,1,2,183,0,1,0,41,0,1,0,42,0,1,
+0,43,0,1,0,44,0,1,0,45,0,1,0,46,0,1,0,47,0,1,2,185,0,1,2,184,0,1,0,50,0,1,0,51,0,1,0,52,0,1,0,53,0,1,0,54,0,1,
+0,55,0,1,2,186,0,1,0,57,0,1,0,58,0,1,0,59,0,1,0,60,0,1,0,61,0,1,3,169,0,1,3,170,0,1,3,177,0,1,3,187,0,1,3,193,
+0,1,3,166,0,1,3,165,0,1,3,167,0,1,3,169,0,1,3,168,0,1,3,170,0,1,0,100,0,1,3,177,0,1,3,176,0,1,3,178,0,1,3,179,
+0,1,0,207,0,1,0,205,0,1,0,206,0,1,3,187,0,1,0,208,0,1,0,211,0,1,0,209,0,1,0,103,0,1,0,175,0,1,3,192,0,1,3,191,
+0,1,3,193,0,1,0,144,0,1,0,145,0,1,3,165,0,1,3,168,0,1,0,176,0,1,0,187,0,1,3,167,0,1,3,178,0,1,3,166,0,1,3,179,
+0,1,3,176,0,1,3,192,0,1,3,191,0,1,0,226,0,1,0,228,0,1,0,230,0,1,0,233,0,1,0,235,0,1,0,237,0,1,0,248,0,2,0,251,
+0,251,0,1,0,253,0,1,0,255,0,1,1,11,0,1,3,172,0,1,3,172,0,1,3,173,0,1,3,173,0,1,1,9,0,1,3,183,0,1,3,183,0,1,3,
+184,0,1,3,184,0,1,1,16,0,1,1,18,0,1,1,20,0,1,1,22,0,1,3,188,0,1,3,188,0,1,3,190,0,1,3,190,0,1,1,29,0,1,1,31,0,
+1,1,33,0,1,1,35,0,1,1,37,0,1,1,39,0,1,3,197,0,1,3,197,0,1,3,198,0,1,3,198,0,1,1,45,0,1,1,47,0,1,3,171,0,1,3,
+171,0,1,1,84,0,1,1,86,0,1,3,180,0,1,3,180,0,1,3,181,0,1,3,181,0,1,3,182,0,1,3,182,0,1,1,94,0,1,1,96,0,1,1,98,
+0,1,1,100,0,1,1,102,0,1,1,104,0,1,1,106,0,1,1,108,0,1,1,110,0,1,1,112,0,1,1,114,0,1,1,117,0,1,3,189,0,1,3,189,
+0,1,1,121,0,1,1,123,0,1,1,125,0,1,1,127,0,1,1,129,0,1,1,131,0,1,3,194,0,1,3,194,0,1,3,195,0,1,3,195,0,1,3,196,
+0,1,3,196,0,1,3,199,0,1,3,199,0,1,1,141,0,1,1,143,0,1,3,174,0,1,3,174,0,1,1,148,0,1,1,150,0,1,2,62,0,1,2,64,0,
+1,2,66,0,1,2,68,0,2,0,72,0,36,0,36,0,0,0,40,0,40,0,1,0,48,0,49,0,2,0,56,0,56,0,4,0,68,0,93,0,5,0,98,0,99,0,31,
+0,101,0,102,0,33,0,104,0,115,0,35,0,117,0,127,0,47,0,129,0,129,0,58,0,160,0,161,0,59,0,173,0,174,0,61,0,177,0,
+177,0,63,0,186,0,186,0,64,0,199,0,203,0,65,0,212,0,212,0,70,0,214,0,214,0,71,0,227,0,227,0,72,0,229,0,229,0,
+73,0,231,0,231,0,74,0,234,0,234,0,75,0,236,0,236,0,76,0,238,0,238,0,77,0,249,0,249,0,78,0,252,0,252,0,79,0,
+254,0,254,0,80,1,0,1,1,0,81,1,5,1,8,0,83,1,10,1,10,0,87,1,12,1,15,0,88,1,17,1,17,0,92,1,19,1,19,0,93,1,21,1,
+21,0,94,1,23,1,27,0,95,1,30,1,30,0,100,1,32,1,32,0,101,1,34,1,34,0,102,1,36,1,36,0,103,1,38,1,38,0,104,1,40,1,
+44,0,105,1,46,1,46,0,110,1,48,1,48,0,111,1,82,1,83,0,112,1,85,1,85,0,114,1,87,1,93,0,115,1,95,1,95,0,122,1,97,
+1,97,0,123,1,99,1,99,0,124,1,101,1,101,0,125,1,103,1,103,0,126,1,105,1,105,0,127,1,107,1,107,0,128,1,109,1,
+109,0,129,1,111,1,111,0,130,1,113,1,113,0,131,1,115,1,115,0,132,1,118,1,120,0,133,1,122,1,122,0,136,1,124,1,
+124,0,137,1,126,1,126,0,138,1,128,1,128,0,139,1,130,1,130,0,140,1,132,1,140,0,141,1,142,1,142,0,150,1,144,1,
+144,0,151,1,146,1,147,0,152,1,149,1,149,0,154,1,151,1,151,0,155,2,63,2,63,0,156,2,65,2,65,0,157,2,67,2,67,0,
+158,2,69,2,69,0,159,0,2,0,26,0,10,3,152,3,153,3,154,3,155,3,156,3,157,3,158,3,159,3,160,3,161,0,2,0,1,0,19,0,
+28,0,0,0,0,0,1,0,0,0,0,0,0,0,40,0,0,0,2,100,108,110,103,0,0,0,40,0,0,0,16,115,108,110,103,0,0,0,56,0,0,0,16,
+67,121,114,108,44,32,71,114,101,107,44,32,76,97,116,110,67,121,114,108,44,32,71,114,101,107,44,32,76,97,116,
+110,
+};
+const size_t EmbeddedAssets::fontSize = sizeof(EmbeddedAssets::font);
+
+const unsigned char EmbeddedAssets::pieceAtlas[] = {
+137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,1,56,0,0,0,104,8,6,0,0,0,101,134,236,41,0,0,35,240,73,68,65,
+84,120,218,237,221,123,188,165,213,252,7,240,201,84,82,46,185,203,53,114,45,215,40,93,228,82,161,68,97,146,
+116,209,77,137,210,77,164,187,106,136,132,46,50,13,53,83,102,36,10,185,38,185,148,162,84,24,41,164,140,84,152,
+102,154,153,26,19,49,195,243,155,247,250,89,243,122,102,183,207,62,251,242,236,231,89,231,180,254,248,190,246,
+217,231,60,123,159,103,61,107,173,207,250,94,63,223,9,69,81,76,200,146,37,75,150,241,40,249,33,100,201,146,37,
+3,92,150,44,89,178,12,34,255,253,239,127,39,220,119,223,125,19,238,189,247,222,240,154,1,46,203,80,37,46,54,
+242,143,127,252,99,194,146,37,75,242,115,73,72,150,46,93,26,230,40,10,128,24,203,227,153,59,119,238,204,167,
+63,253,233,197,227,30,247,184,226,217,207,126,118,113,247,221,119,103,128,203,50,28,89,188,120,241,132,117,
+215,93,183,120,194,19,158,80,60,229,41,79,41,30,246,176,135,21,7,31,124,112,145,159,77,26,242,155,223,252,166,
+216,113,199,29,139,199,63,254,241,197,83,159,250,212,226,73,79,122,82,113,192,1,7,20,127,253,235,95,199,236,
+28,221,126,251,237,97,173,93,124,241,197,225,117,222,188,121,147,51,192,101,25,138,56,61,109,154,31,255,248,
+199,197,156,57,115,138,131,14,58,168,152,52,105,82,82,155,135,86,249,133,47,124,161,56,253,244,211,239,39,231,
+158,123,110,65,243,116,221,31,255,248,199,226,179,159,253,108,113,218,105,167,173,112,141,247,228,187,223,253,
+238,242,113,93,126,249,229,203,255,86,190,238,51,159,249,76,113,195,13,55,36,49,254,119,191,251,221,197,218,
+107,175,93,156,112,194,9,197,205,55,223,92,92,127,253,245,197,111,127,251,219,226,189,239,125,111,241,196,39,
+62,177,248,244,167,63,61,166,64,238,202,43,175,44,78,57,229,148,226,136,35,142,8,192,54,123,246,236,98,173,
+181,214,42,142,61,246,216,240,251,171,175,190,186,200,0,215,160,124,231,59,223,9,27,225,204,51,207,44,166,79,
+159,94,76,157,58,181,56,245,212,83,195,162,27,171,99,90,184,112,225,196,39,63,249,201,133,83,245,159,255,252,
+103,113,226,137,39,22,111,126,243,155,147,26,207,29,119,220,17,52,203,87,191,250,213,197,235,94,247,186,226,
+181,175,125,109,120,125,205,107,94,83,172,177,198,26,197,159,255,252,231,112,191,103,159,125,118,177,234,170,
+171,22,111,120,195,27,194,53,81,182,218,106,171,130,150,250,178,151,189,108,249,184,140,145,70,180,245,214,91,
+47,191,206,231,252,159,227,143,63,190,241,241,239,189,247,222,197,126,251,237,87,220,117,215,93,97,94,150,153,
+165,203,197,251,91,111,189,181,120,211,155,222,84,124,226,19,159,24,51,107,111,183,221,118,43,158,241,140,103,
+20,59,239,188,115,241,193,15,126,48,28,168,135,28,114,72,177,203,46,187,132,185,0,220,99,10,224,230,207,159,
+191,197,5,23,92,16,78,206,183,191,253,237,97,112,175,122,213,171,138,175,125,237,107,197,151,191,252,229,194,
+137,155,250,164,124,255,251,223,47,94,249,202,87,22,124,6,27,109,180,81,216,84,155,111,190,121,56,89,55,219,
+108,179,240,243,139,94,244,162,224,75,176,137,104,0,191,251,221,239,146,31,23,45,101,251,237,183,47,30,243,
+152,199,20,15,125,232,67,3,72,216,56,0,123,194,178,229,96,188,147,39,79,46,254,254,247,191,55,126,175,54,179,
+19,127,217,189,132,123,140,178,76,115,11,191,143,235,136,6,246,250,215,191,126,133,107,162,124,239,123,223,43,
+158,255,252,231,47,159,151,45,183,220,178,152,50,101,202,253,174,219,99,143,61,194,230,107,114,188,103,156,
+113,70,208,208,238,185,231,158,112,79,203,52,216,182,99,50,135,171,173,182,90,113,197,21,87,140,9,144,219,105,
+167,157,138,237,182,219,46,236,127,243,177,204,122,8,216,240,245,175,127,61,28,66,239,122,215,187,198,14,192,
+125,233,75,95,42,158,243,156,231,20,47,126,241,139,139,231,62,247,185,65,51,248,193,15,126,16,52,31,191,3,10,
+207,122,214,179,138,15,127,248,195,73,78,206,178,147,115,175,87,188,226,21,197,122,235,173,23,204,32,15,223,
+132,196,197,229,190,23,47,94,28,126,166,253,156,116,210,73,1,8,105,9,143,126,244,163,195,70,73,17,192,255,253,
+239,127,79,160,129,62,226,17,143,40,142,59,238,184,130,143,135,233,99,44,203,254,22,78,213,235,174,187,174,
+248,229,47,127,89,108,186,233,166,197,6,27,108,48,84,211,161,91,128,163,101,206,155,55,47,220,163,103,238,117,
+193,130,5,193,39,69,139,249,198,55,190,81,188,227,29,239,40,182,217,102,155,182,96,96,35,241,51,58,88,109,48,
+7,82,59,128,219,117,215,93,27,7,56,26,205,39,63,249,201,112,63,247,221,119,95,0,56,227,165,189,45,93,186,116,
+133,251,221,125,247,221,131,9,59,22,0,142,197,67,33,160,40,0,240,63,252,225,15,197,99,31,251,216,98,147,77,54,
+9,138,195,57,231,156,147,62,192,45,59,117,38,64,233,167,61,237,105,5,147,161,221,98,139,226,228,161,245,188,
+252,229,47,79,74,235,161,121,62,239,121,207,11,230,203,191,254,245,175,112,175,52,179,191,253,237,111,109,1,
+206,226,251,212,167,62,181,252,61,63,16,0,23,37,250,197,47,126,145,212,226,123,219,219,222,86,60,243,153,207,
+44,174,189,246,218,21,230,162,188,145,202,26,146,69,199,236,155,53,107,86,145,18,192,153,151,69,139,22,5,80,3,
+194,214,144,195,229,163,31,253,104,219,181,246,171,95,253,42,104,220,174,139,66,59,79,1,224,174,186,234,170,
+160,4,252,250,215,191,54,190,9,14,126,129,5,26,118,52,73,29,162,246,10,197,33,222,235,89,103,157,21,76,116,99,
+241,61,203,158,201,4,166,59,101,34,101,160,187,237,182,219,130,133,112,203,45,183,4,156,16,85,29,19,65,6,17,
+57,39,40,95,73,89,219,105,39,54,83,156,60,218,17,64,48,224,166,31,254,157,119,222,121,165,211,125,135,29,118,
+88,126,175,76,5,167,36,13,224,5,47,120,65,48,117,128,23,16,164,165,186,86,228,145,227,154,246,67,229,246,185,
+99,142,57,38,248,116,82,1,185,55,190,241,141,197,158,123,238,121,63,83,175,147,0,118,99,224,228,78,9,224,162,
+196,53,20,133,134,211,206,164,139,7,85,89,90,191,171,9,128,227,3,5,104,214,20,23,206,231,63,255,249,224,50,
+160,153,122,207,87,120,209,69,23,133,191,199,117,199,141,240,145,143,124,36,104,63,214,160,235,46,185,228,146,
+96,230,61,252,225,15,15,191,107,114,157,189,239,125,239,43,214,89,103,157,112,31,64,185,44,44,34,227,93,101,
+149,85,194,125,123,181,135,252,190,245,218,40,198,253,251,223,255,190,104,28,224,128,219,182,219,110,59,226,
+130,106,39,52,7,175,252,61,80,125,217,207,141,130,128,144,53,16,123,235,91,223,90,252,252,231,63,15,230,143,9,
+120,225,11,95,24,162,108,124,7,223,252,230,55,67,136,219,235,165,151,94,90,136,118,249,59,211,155,111,238,91,
+223,250,214,242,241,113,168,62,234,81,143,106,28,228,220,147,133,18,181,208,145,252,58,101,249,248,199,63,94,
+60,228,33,15,9,190,30,218,56,19,60,70,44,83,1,184,170,165,110,128,139,41,19,203,128,46,184,112,94,250,210,151,
+22,31,248,192,7,138,101,7,109,208,80,69,24,1,197,121,231,157,23,192,155,38,202,127,200,74,178,233,61,15,110,
+31,135,50,223,221,143,126,244,163,240,115,147,107,141,107,231,253,239,127,127,113,217,101,151,5,215,64,171,
+216,59,254,102,47,121,245,190,221,117,132,150,45,210,74,203,109,20,224,76,128,201,49,41,189,46,194,8,114,204,
+167,195,14,59,172,113,109,135,153,77,237,231,108,7,216,124,80,221,140,195,184,105,111,114,150,68,192,156,180,
+252,12,71,30,121,100,65,123,106,106,60,127,249,203,95,138,71,62,242,145,197,87,191,250,213,158,192,109,245,
+213,87,15,62,186,243,207,63,191,88,115,205,53,67,164,139,163,56,3,92,181,26,156,195,241,154,107,174,89,225,62,
+150,44,89,114,191,177,218,39,255,249,207,127,150,191,247,115,171,34,97,31,178,160,154,220,63,124,108,238,163,
+170,57,1,216,82,76,26,3,56,145,54,42,169,147,100,144,129,152,100,102,32,167,119,211,32,247,197,47,126,177,216,
+120,227,141,151,47,164,94,128,218,253,3,20,33,240,248,55,105,8,128,174,41,147,65,126,91,183,247,223,10,110,
+204,8,167,44,13,130,43,161,238,160,195,120,6,56,194,69,83,94,43,131,200,22,91,108,17,210,152,154,220,59,252,
+135,44,178,65,199,2,228,165,8,177,60,6,245,209,15,52,32,126,3,233,31,85,76,16,213,150,159,168,105,128,115,2,
+109,184,225,134,61,223,127,212,142,128,156,104,234,161,135,30,26,76,91,145,88,78,112,38,98,19,190,55,166,118,
+55,224,246,177,143,125,44,56,174,203,224,198,84,136,215,49,195,153,230,25,224,170,77,128,237,215,250,41,251,
+34,129,0,48,160,177,55,185,119,152,201,204,234,42,230,227,115,159,251,92,37,26,233,64,31,22,205,225,159,169,
+98,64,156,245,41,0,28,31,7,19,179,159,49,68,144,147,106,1,44,44,96,239,153,173,31,250,208,135,106,31,155,83,
+93,52,180,19,184,217,32,39,159,124,114,8,40,140,4,110,68,50,172,40,113,19,121,112,252,84,195,6,184,38,242,224,
+84,147,0,38,1,170,214,160,73,47,194,234,224,255,106,122,239,240,163,83,14,248,20,7,157,15,81,97,202,65,163,0,
+167,180,71,154,68,21,11,140,211,158,255,75,68,182,169,9,226,71,99,162,73,141,232,119,28,81,35,18,172,216,103,
+159,125,194,207,94,229,1,213,57,22,99,16,173,226,171,137,247,212,206,119,8,60,184,7,56,115,191,242,149,175,
+172,0,110,101,159,157,124,51,102,106,157,99,144,132,44,98,40,175,176,91,119,65,191,243,69,219,61,252,240,195,
+107,7,9,89,252,251,239,191,255,64,99,96,69,9,6,165,146,142,36,210,219,239,88,172,73,245,182,52,193,42,42,133,
+6,250,176,176,239,207,126,246,179,129,23,153,65,249,30,167,181,92,153,38,38,70,72,126,226,196,137,133,218,199,
+209,210,12,186,17,190,8,81,84,137,155,180,40,149,3,117,214,58,202,173,146,90,192,151,193,167,209,9,224,56,115,
+143,62,250,232,144,166,208,14,220,98,142,31,51,181,238,121,145,195,38,90,61,76,237,77,164,155,198,77,147,170,
+123,124,162,137,180,158,126,204,84,90,159,136,170,96,133,168,108,10,0,39,199,85,246,193,32,243,33,69,137,239,
+186,241,60,56,234,181,2,218,42,22,153,210,46,14,122,249,104,117,79,10,237,228,65,15,122,80,48,207,152,105,82,
+60,68,117,213,5,246,107,30,209,136,0,134,28,63,239,165,194,212,25,68,65,173,35,237,133,249,217,233,96,145,183,
+8,8,87,90,105,165,16,190,31,233,90,155,136,159,174,238,185,145,231,229,57,254,233,79,127,234,58,18,220,173,
+196,195,139,91,130,198,221,84,228,94,178,47,183,70,63,102,170,4,96,21,1,169,36,243,74,39,98,137,253,240,135,
+63,236,123,94,184,67,170,210,72,7,250,176,168,77,149,62,56,69,185,77,129,91,244,85,73,169,96,218,73,226,21,
+229,162,1,181,150,201,116,179,113,36,9,75,175,160,17,137,18,75,33,169,187,118,112,180,32,3,128,155,63,127,126,
+72,192,252,246,183,191,221,113,76,77,4,25,162,0,31,137,159,114,196,202,102,229,32,18,231,84,82,182,84,152,38,
+43,54,14,60,240,192,190,181,84,224,54,99,198,140,164,42,24,184,174,70,170,44,25,205,146,51,199,52,192,170,136,
+44,6,142,162,138,116,84,1,112,146,28,235,14,50,0,55,154,75,107,154,11,173,198,131,118,162,118,210,222,108,146,
+118,127,143,229,68,234,238,228,6,57,101,129,77,221,90,130,3,67,138,74,39,255,147,186,78,38,90,39,176,54,70,26,
+28,106,165,166,54,141,100,114,32,199,36,171,98,189,169,234,240,108,36,52,211,158,154,4,4,218,142,178,51,37,
+127,35,185,19,218,201,77,55,221,20,42,108,34,171,74,42,34,157,200,161,217,143,223,20,21,20,13,46,137,82,45,
+126,30,39,187,164,214,126,163,64,54,15,48,80,116,43,69,163,142,9,192,92,59,115,230,204,144,208,219,26,101,180,
+233,109,234,78,206,249,232,255,80,188,205,103,56,18,8,138,156,170,153,244,51,222,43,53,174,117,71,33,69,71,
+219,213,94,150,199,59,218,166,122,231,59,223,25,178,232,83,112,96,171,143,85,198,196,57,207,149,224,249,118,
+43,242,180,20,180,203,15,164,165,243,139,166,82,78,135,117,71,45,105,183,129,17,235,79,228,183,169,28,203,209,
+242,99,1,182,3,177,215,96,15,112,147,34,146,76,45,170,135,28,205,212,126,77,7,57,112,47,121,201,75,32,254,208,
+31,62,147,81,94,26,63,1,158,183,65,34,111,54,156,226,251,145,174,99,254,8,119,51,3,141,17,143,87,221,139,77,
+168,221,252,208,88,250,57,81,133,252,69,79,155,240,141,142,228,196,230,206,80,123,185,239,190,251,134,13,238,
+32,233,70,142,58,234,168,192,194,1,244,57,178,21,169,167,4,10,64,151,15,184,155,121,225,47,6,34,169,22,214,11,
+74,177,90,248,76,187,13,212,97,124,169,186,44,176,146,47,17,133,19,98,239,7,228,164,38,88,112,124,93,195,126,
+232,156,232,76,82,255,179,219,74,133,168,225,68,137,190,27,69,232,124,108,145,222,166,157,32,80,20,238,158,54,
+109,90,40,136,126,203,91,222,82,251,130,164,173,2,115,190,154,110,139,237,227,130,4,38,43,175,188,114,8,84,
+164,180,121,108,128,200,7,215,43,96,139,148,170,190,73,17,20,184,105,164,236,8,110,209,154,71,146,189,246,218,
+43,68,125,171,200,19,27,166,208,180,187,77,25,225,42,17,136,27,180,184,126,40,0,71,205,103,58,72,53,40,59,112,
+59,153,165,49,114,202,76,100,46,214,181,128,152,41,54,44,199,46,63,91,39,243,204,56,108,118,224,43,75,220,245,
+38,128,153,227,190,125,87,52,105,219,125,94,132,185,73,19,53,138,134,37,82,17,100,205,71,6,223,145,204,106,
+166,15,224,23,116,112,24,224,187,75,109,227,68,128,227,136,238,213,53,242,211,159,254,52,57,128,19,241,118,0,
+201,103,83,56,239,96,196,98,51,146,248,59,13,137,198,151,66,114,124,39,109,27,16,187,71,1,59,192,220,78,222,
+243,158,247,4,86,145,97,248,168,43,251,34,60,99,242,190,152,0,180,155,145,22,152,205,163,244,6,24,210,220,234,
+140,0,41,159,82,146,3,224,100,126,51,7,58,109,16,190,69,147,35,2,138,198,70,217,16,194,72,159,149,191,52,82,
+144,161,172,193,73,1,80,241,129,113,182,9,13,174,156,142,0,112,37,206,242,95,153,131,88,247,23,37,2,0,141,207,
+130,187,240,194,11,147,220,60,227,17,224,84,157,56,128,212,3,203,161,100,82,179,138,90,197,239,249,234,92,227,
+25,12,147,238,123,16,49,14,107,77,20,159,171,166,147,192,2,123,146,203,71,112,162,202,110,91,149,107,10,28,
+184,180,57,57,83,237,22,152,200,165,124,55,27,30,123,110,157,15,61,214,187,186,15,17,43,38,27,237,43,110,146,
+50,167,24,144,6,102,162,84,115,231,206,13,145,42,194,113,31,57,237,70,51,199,77,156,113,138,202,210,30,155,
+100,22,137,194,119,195,12,50,79,136,45,105,166,68,246,56,177,249,153,211,85,155,10,25,224,186,163,201,183,222,
+220,31,11,131,143,177,85,204,155,90,103,137,176,130,124,169,206,17,205,95,250,13,31,53,55,78,39,112,3,216,44,
+28,123,37,105,128,179,81,220,168,72,136,77,4,149,1,93,20,197,231,162,174,196,160,234,158,32,181,134,82,39,202,
+233,15,145,149,23,171,67,164,21,18,126,151,226,33,31,39,50,139,0,191,40,221,58,77,83,49,81,163,255,81,36,212,
+2,194,166,106,147,120,229,71,44,139,69,73,123,99,254,208,14,82,75,65,24,207,0,71,0,130,136,106,167,49,8,250,
+224,249,75,157,170,92,146,187,124,82,102,170,96,100,59,51,213,26,19,96,100,29,177,230,170,14,52,86,246,69,0,
+204,230,17,186,167,37,169,191,52,81,252,84,81,188,55,168,232,68,53,48,38,109,93,15,28,163,135,141,45,90,83,
+230,182,247,112,149,4,1,32,191,99,42,0,60,245,177,78,212,126,115,173,244,62,0,22,124,140,242,184,154,50,81,
+231,204,153,115,7,127,154,232,35,31,28,0,39,55,222,120,227,253,132,230,138,157,130,121,238,185,200,242,207,0,
+87,47,192,161,44,239,52,6,107,114,44,0,28,49,71,14,210,78,174,28,228,158,240,33,233,158,12,28,132,6,194,111,
+195,12,82,219,105,99,151,5,66,211,146,4,23,20,182,71,141,162,206,112,189,251,120,240,131,31,28,82,6,108,222,
+255,53,160,13,254,13,15,90,26,9,31,20,102,4,63,15,2,112,84,112,190,21,154,45,147,163,137,52,145,40,34,199,66,
+240,64,43,10,45,77,228,170,44,52,87,243,72,28,66,41,154,170,25,224,198,22,192,177,12,228,186,142,22,140,75,26,
+224,52,205,0,110,34,65,52,51,106,169,205,45,129,55,138,156,48,117,143,22,24,141,233,127,13,91,26,241,67,241,
+51,113,106,74,212,165,74,203,41,82,119,42,128,240,191,222,10,19,48,128,72,58,236,23,224,228,104,1,254,20,76,
+212,200,34,75,152,233,52,109,81,97,154,26,161,185,121,141,157,199,105,125,41,229,137,101,128,203,0,215,184,15,
+46,10,211,78,89,77,187,193,0,149,212,218,157,1,49,154,164,124,53,145,96,61,25,0,47,160,86,198,211,47,192,25,
+39,45,73,197,131,73,108,82,131,43,11,122,30,190,143,24,213,38,177,53,29,45,14,255,127,202,155,38,3,92,6,184,
+70,1,78,246,251,72,204,158,52,26,33,238,212,74,75,248,5,153,112,192,153,246,230,30,153,104,131,212,59,138,16,
+241,45,208,18,69,80,83,233,28,15,224,90,139,187,99,251,64,205,115,50,192,101,128,203,0,55,142,0,174,85,108,2,
+137,188,253,82,190,152,72,96,65,123,139,172,10,194,251,77,55,22,206,0,151,1,46,3,92,5,185,112,49,122,216,110,
+48,34,169,204,212,5,11,22,172,147,234,164,8,132,104,146,220,75,29,93,59,18,69,207,64,162,35,147,87,202,73,10,
+77,117,50,192,101,128,203,0,215,231,162,195,15,103,225,137,196,201,121,105,87,235,41,195,57,230,97,113,194,
+215,209,221,186,87,17,221,85,241,48,72,33,62,39,190,92,63,126,45,154,91,211,1,134,241,8,112,227,173,22,53,3,
+92,162,0,183,108,99,132,82,19,21,10,50,152,13,166,83,87,123,155,94,163,12,11,141,166,52,123,246,236,164,38,
+139,230,213,137,221,118,180,58,91,149,15,210,48,230,204,153,19,126,86,174,37,75,61,3,92,53,34,218,139,77,132,
+11,0,171,180,249,234,70,0,131,205,166,244,174,137,46,103,25,224,198,32,192,1,55,233,20,138,185,99,153,211,104,
+102,93,185,196,73,82,48,141,14,37,117,74,0,55,26,195,109,39,128,147,87,167,118,85,127,7,76,43,117,38,51,143,
+119,128,179,78,68,122,221,191,54,117,88,134,123,17,159,177,153,0,99,42,20,80,57,209,55,225,68,95,117,102,22,
+92,47,141,146,91,105,121,68,24,249,230,82,9,48,200,225,235,196,114,219,13,120,99,72,16,168,80,63,152,218,162,
+27,203,0,39,178,45,159,114,80,70,95,156,128,106,147,115,169,214,112,69,162,184,220,87,137,230,242,75,165,76,
+149,133,101,163,194,199,188,38,9,112,76,204,41,83,166,12,180,216,116,212,82,3,153,130,217,80,238,108,223,175,
+48,195,117,208,98,178,43,206,79,101,177,169,243,67,242,169,137,139,205,221,14,152,105,158,106,137,37,63,167,
+182,89,148,144,185,119,52,60,131,2,28,210,7,107,174,233,102,201,173,130,63,77,37,13,54,220,118,26,40,64,136,
+201,216,99,1,224,88,104,14,122,90,39,218,251,86,145,107,138,117,196,94,25,6,117,124,37,100,151,131,46,56,100,
+119,124,86,41,44,182,126,59,219,183,19,166,41,245,59,149,197,166,92,76,153,26,112,83,68,223,202,133,7,228,204,
+165,62,27,168,172,164,251,164,70,8,41,0,52,104,227,25,150,3,107,99,253,245,215,15,81,238,84,198,103,253,51,
+157,41,13,35,249,22,1,133,189,162,18,39,213,74,147,162,196,158,13,31,184,5,58,205,7,197,134,165,83,101,47,134,
+129,0,206,38,144,149,79,156,168,52,30,63,187,193,94,69,17,58,234,151,213,86,91,45,44,94,230,42,223,213,88,7,
+56,90,28,83,143,57,49,111,222,188,201,77,47,54,121,120,78,202,216,180,5,184,181,107,193,23,211,46,48,191,0,
+195,148,64,238,160,131,14,90,222,76,187,10,97,26,137,116,167,48,54,84,85,192,96,52,243,52,54,204,161,249,160,
+23,74,25,228,98,159,149,78,99,177,6,35,65,46,183,65,213,193,184,190,62,196,36,229,119,243,170,179,150,205,160,
+174,84,71,156,126,68,157,166,239,153,58,117,106,208,30,154,104,31,88,53,192,69,159,22,102,146,166,11,214,177,
+136,0,55,12,34,189,244,22,53,175,186,78,53,217,77,171,92,235,44,121,156,70,92,21,192,41,87,211,245,44,5,48,64,
+246,16,123,155,140,214,135,151,246,137,207,144,59,65,206,102,138,224,198,135,45,75,194,65,218,173,182,45,133,
+108,219,109,183,109,30,224,78,61,245,212,0,68,101,194,196,42,196,164,217,140,195,10,25,215,229,131,43,75,100,
+52,109,210,167,163,239,43,255,85,63,141,147,105,56,124,40,82,51,154,220,48,180,224,152,122,83,213,220,0,124,
+41,12,146,211,83,48,191,35,25,107,183,194,87,135,56,34,85,128,139,193,199,110,1,206,90,173,154,158,171,111,54,
+142,213,87,95,61,56,59,171,22,190,31,180,204,117,79,136,255,233,244,160,250,115,62,251,185,31,147,187,44,38,
+139,217,177,214,90,107,133,18,53,192,93,183,159,145,217,31,73,62,123,21,167,175,60,62,237,245,0,127,19,27,37,
+246,148,21,57,229,198,144,111,201,173,49,232,220,248,78,204,55,52,212,248,94,106,208,88,2,56,150,70,202,0,39,
+79,177,151,241,200,161,77,66,131,19,141,147,255,38,163,188,106,241,189,58,65,213,61,33,128,104,191,253,246,11,
+102,50,118,145,65,76,238,40,190,67,115,16,223,41,157,6,83,73,157,44,198,114,144,68,167,68,68,7,209,116,144,
+153,50,181,155,216,40,156,207,26,178,120,134,220,24,220,25,131,206,75,20,150,72,116,141,136,232,33,71,168,107,
+92,122,100,0,180,216,16,156,57,23,9,70,187,1,104,64,224,32,54,47,72,28,252,238,176,195,14,107,20,236,48,120,
+199,131,157,185,77,9,234,69,25,144,16,143,9,220,243,240,92,176,1,15,202,40,157,124,152,185,46,17,185,114,130,
+139,232,86,105,118,199,126,7,94,153,67,117,116,81,215,243,51,106,40,130,64,221,110,154,145,54,18,128,209,159,
+194,70,34,117,130,52,16,144,83,88,181,59,164,44,190,91,125,116,157,0,225,255,210,140,17,79,0,91,7,161,82,199,
+110,15,86,215,57,136,79,63,253,244,224,43,21,68,66,249,213,228,30,2,106,130,36,58,131,197,195,163,23,101,192,
+231,60,3,202,128,207,71,234,178,12,112,21,77,142,5,55,12,179,155,56,157,149,8,241,251,12,123,44,17,152,162,
+214,51,168,22,106,19,217,76,22,160,19,182,78,199,182,160,2,144,30,214,188,68,161,109,0,138,186,198,165,21,165,
+154,109,190,81,126,197,65,0,90,99,113,249,141,77,215,216,242,93,59,92,151,105,167,3,31,58,92,35,76,92,137,247,
+25,224,42,16,225,246,97,152,220,101,193,51,167,69,220,176,199,34,237,70,112,64,253,95,149,154,142,239,211,48,
+72,79,139,186,230,133,187,98,88,238,144,86,215,200,210,165,75,107,13,154,68,138,248,42,0,218,225,140,141,186,
+201,61,196,199,204,108,174,234,208,65,200,161,181,103,6,184,44,43,8,38,23,38,229,176,130,64,72,65,243,115,30,
+76,28,116,162,183,85,130,116,211,57,113,82,121,170,60,140,170,80,8,242,98,27,135,50,76,173,199,162,171,186,
+181,91,150,44,195,146,252,16,178,100,201,146,1,46,75,150,44,89,50,192,101,201,146,37,75,6,184,44,89,178,60,
+208,68,30,168,220,63,101,89,216,70,50,192,101,25,170,200,147,83,169,32,11,93,7,48,36,132,249,185,164,35,106,
+128,213,51,75,124,53,71,169,209,251,247,83,199,174,182,153,12,139,228,50,3,92,150,229,34,153,50,46,56,162,2,
+34,63,151,230,69,137,18,182,19,73,206,229,249,209,139,2,109,84,106,68,157,221,148,119,122,85,106,23,199,162,
+177,83,249,111,25,224,178,60,224,0,206,226,191,224,130,11,138,233,211,167,23,231,158,123,238,10,50,109,218,
+180,229,92,123,115,230,204,185,227,236,179,207,190,223,53,241,186,11,47,188,176,136,57,85,10,193,105,174,173,
+215,249,29,118,233,166,199,76,75,107,157,151,86,81,183,57,86,64,110,241,226,197,19,36,136,43,85,84,126,21,199,
+0,188,141,19,237,147,186,233,49,11,112,58,199,235,82,21,37,3,75,243,162,68,72,89,13,158,184,242,198,81,116,
+110,179,47,3,142,59,82,169,48,145,237,63,210,70,191,230,154,107,194,122,186,252,242,203,59,2,130,36,229,72,
+226,160,141,227,72,215,73,146,110,114,188,90,33,170,112,232,52,150,50,200,41,249,74,125,173,45,90,180,104,66,
+25,216,218,201,172,89,179,198,22,192,41,177,80,186,129,209,22,253,114,28,8,20,223,96,131,13,138,205,54,219,44,
+212,207,165,156,52,122,247,221,119,79,112,250,83,171,21,227,59,109,188,42,106,182,8,53,115,86,24,236,228,191,
+246,218,107,199,12,112,163,230,65,19,212,105,193,97,33,81,127,154,1,174,94,161,133,118,3,110,81,234,44,155,
+203,0,87,252,127,83,94,160,208,234,59,24,73,14,57,228,144,228,84,109,85,0,138,204,49,200,2,104,128,172,232,23,
+179,1,254,45,204,13,38,4,211,45,118,13,192,167,88,27,248,41,80,151,237,159,226,66,67,161,110,76,43,173,180,82,
+87,115,179,242,202,43,71,98,211,201,169,2,28,7,252,101,151,93,22,162,114,157,198,162,86,19,73,128,254,0,168,
+202,83,1,56,160,235,160,183,230,188,199,71,72,9,64,247,93,190,47,4,10,8,27,226,123,154,55,6,148,114,75,74,230,
+53,205,60,197,178,52,154,230,50,133,161,56,238,184,227,150,143,97,210,164,73,161,190,153,191,81,153,87,242,0,
+167,182,78,111,134,94,78,32,162,111,98,42,19,99,193,89,92,22,218,141,55,222,24,232,141,176,114,68,110,180,155,
+111,190,57,48,108,196,247,38,13,213,242,245,215,95,31,40,220,45,78,155,41,181,182,110,40,142,16,111,246,58,55,
+164,142,112,126,191,0,87,181,212,13,112,136,86,253,95,180,80,198,170,207,194,206,59,239,28,184,208,144,124,
+250,27,126,52,160,188,247,222,123,7,70,26,218,144,182,143,8,47,53,77,246,61,64,126,213,85,87,13,77,105,154,
+178,138,40,55,186,149,105,15,120,209,69,23,45,23,191,187,228,146,75,130,127,83,224,36,62,107,164,16,87,93,117,
+85,232,195,160,99,88,249,51,196,129,100,92,73,0,28,112,227,160,238,119,97,1,134,166,65,46,46,48,205,47,0,87,4,
+49,189,42,53,194,193,23,135,183,203,98,228,75,164,13,48,41,126,242,147,159,132,235,52,37,198,64,139,94,72,195,
+22,19,155,10,192,161,210,233,103,94,108,54,141,172,141,53,3,92,245,190,105,140,25,241,127,35,175,148,58,97,
+237,120,191,245,214,91,135,195,115,211,77,55,13,239,17,29,232,136,134,183,142,11,33,106,217,64,146,163,222,
+123,175,77,21,221,91,255,232,241,171,156,143,65,137,86,27,243,29,180,147,38,123,49,16,9,136,22,76,236,95,160,
+89,12,178,197,242,34,44,203,42,171,172,18,204,6,62,70,166,194,9,39,156,176,188,21,223,204,153,51,195,119,165,
+0,114,220,0,253,130,155,241,224,150,243,158,38,155,1,110,120,0,87,133,100,128,27,2,192,9,187,83,143,171,24,16,
+31,86,147,190,2,140,164,76,230,205,55,223,60,116,228,238,229,222,45,86,39,172,62,143,82,27,0,38,223,28,243,
+181,169,49,9,126,76,156,56,177,47,112,211,221,169,236,175,178,121,234,246,199,141,119,19,149,63,183,202,251,
+111,162,159,201,184,7,184,93,118,217,165,178,1,113,212,139,94,54,169,241,136,240,14,50,6,62,60,209,61,154,156,
+252,45,166,123,83,157,155,68,76,123,189,255,157,118,218,233,126,224,22,133,9,158,1,174,58,153,49,99,70,165,
+247,223,116,27,193,168,237,87,37,82,153,26,7,56,62,171,170,6,196,172,187,237,182,219,26,157,164,237,183,223,
+126,224,113,48,109,239,188,243,206,80,250,4,180,1,221,88,0,56,135,21,112,19,29,110,247,247,12,112,213,71,236,
+5,14,170,184,119,126,236,58,89,137,219,201,241,199,31,95,233,124,8,66,52,10,112,177,33,111,85,3,146,194,32,
+157,161,201,73,98,158,86,49,150,29,119,220,49,80,46,11,66,136,202,54,225,27,209,45,172,87,179,116,36,112,139,
+233,10,25,224,170,21,221,220,170,184,119,249,125,77,251,123,41,39,148,148,42,198,163,239,107,227,105,34,162,
+137,85,47,178,38,171,29,170,28,15,31,158,9,103,170,42,85,169,59,224,160,26,65,47,209,110,239,151,47,149,15,
+114,180,236,249,12,112,213,138,8,125,21,247,174,28,45,133,136,253,32,217,20,101,81,152,159,1,174,66,185,238,
+186,235,66,14,91,149,99,81,246,36,63,142,153,90,78,202,172,73,38,150,147,67,59,137,64,4,240,26,237,58,173,8,
+235,158,23,230,126,93,0,39,233,118,44,70,138,37,155,215,209,208,168,27,41,39,243,54,105,158,86,2,112,50,148,
+181,146,171,114,145,73,20,108,2,220,98,200,94,66,172,154,76,18,243,141,250,149,117,215,93,183,88,184,112,97,
+208,222,84,69,140,133,32,67,39,169,219,7,71,36,92,119,91,25,51,136,108,185,229,150,141,105,64,131,130,184,232,
+125,42,57,151,250,0,199,92,190,126,165,170,14,97,57,200,240,63,112,43,215,202,201,170,86,134,101,99,73,236,29,
+100,60,146,53,153,168,146,132,1,102,6,184,52,198,209,42,210,121,100,212,55,5,10,131,154,169,169,152,167,81,
+248,106,7,25,143,106,161,100,0,78,211,228,170,22,154,147,218,9,80,39,184,181,106,105,130,12,187,237,182,91,
+161,236,108,180,162,244,209,132,233,33,178,180,207,62,251,132,255,51,44,90,152,145,68,169,75,183,181,167,163,
+137,250,71,117,131,77,146,4,140,71,112,139,57,152,101,82,138,94,68,173,116,106,245,167,131,154,169,87,95,125,
+117,58,0,167,86,177,170,197,134,204,175,73,112,235,69,248,173,148,207,140,118,29,243,148,22,183,254,250,235,
+55,114,210,42,255,169,98,110,48,254,54,189,113,68,10,85,144,84,181,222,128,118,42,20,94,34,238,189,154,226,44,
+15,245,209,169,1,220,252,249,243,183,104,165,226,234,86,228,210,37,87,108,175,62,110,208,197,166,230,78,193,
+238,176,31,254,130,5,11,214,81,227,215,239,4,68,225,171,59,248,224,131,71,189,78,145,49,128,99,202,55,101,74,
+12,234,196,166,165,167,178,121,0,129,249,147,63,134,81,67,246,62,31,84,55,66,11,220,119,223,125,195,193,132,
+170,93,185,84,74,192,112,192,1,7,4,141,91,209,60,255,237,72,226,239,230,229,240,195,15,79,150,46,169,159,0,
+164,96,201,220,185,115,103,38,7,112,76,23,156,91,131,228,191,213,209,15,128,234,59,26,55,85,47,230,103,55,192,
+142,249,65,200,91,132,150,127,175,137,197,134,47,13,221,117,191,213,37,183,222,122,107,114,27,73,234,13,243,
+82,9,153,185,232,70,92,43,152,100,13,52,93,49,211,42,242,37,209,83,217,71,7,30,120,96,0,226,145,196,223,29,
+176,24,71,170,136,54,14,75,182,219,110,187,80,198,41,87,86,78,230,72,130,91,177,138,202,133,161,210,37,105,
+144,209,15,200,169,95,171,203,121,45,146,89,149,121,195,71,23,41,109,70,139,10,211,224,248,88,154,44,165,225,
+143,235,181,190,150,182,160,198,48,197,205,35,121,186,223,185,91,115,205,53,147,2,56,20,71,158,117,19,245,154,
+195,212,224,220,219,122,235,173,23,180,103,9,205,35,9,205,149,187,72,37,13,146,139,100,9,47,221,156,12,254,94,
+178,149,235,204,61,162,141,56,249,142,58,234,168,98,143,61,246,232,58,178,171,0,159,56,109,76,8,95,16,106,165,
+110,89,87,165,138,88,192,77,215,10,70,118,17,9,192,107,172,177,70,96,39,70,165,20,197,243,113,226,2,0,17,228,
+148,153,98,199,19,192,69,159,112,172,229,164,153,50,215,214,94,123,237,251,137,223,11,126,177,122,148,21,226,
+250,75,209,7,215,235,97,26,133,214,151,52,101,185,136,16,42,111,166,128,196,208,253,247,223,63,68,17,9,245,90,
+49,183,9,66,126,119,215,93,119,237,85,231,131,143,140,182,54,118,167,146,164,178,19,26,227,131,224,7,127,155,
+124,37,32,64,83,237,150,57,193,56,207,56,227,140,240,93,77,211,39,209,226,240,219,109,188,241,198,1,208,248,
+164,140,47,138,49,50,223,144,44,162,127,186,225,134,27,138,12,112,245,10,119,6,112,112,136,50,69,91,197,239,
+205,17,138,178,148,15,32,36,151,242,217,162,59,71,173,172,125,211,42,20,7,238,27,138,132,236,133,42,131,38,
+149,15,234,226,139,47,14,155,135,166,35,34,36,147,158,175,132,83,148,200,5,147,49,47,18,22,237,114,4,145,117,
+209,124,247,106,6,28,122,232,161,225,158,7,49,101,83,8,50,12,146,155,4,244,50,192,165,151,19,55,86,122,216,30,
+125,244,209,193,170,99,166,90,75,173,194,143,205,26,26,134,37,87,185,3,191,223,5,135,83,191,142,135,173,214,
+176,221,255,103,150,181,242,166,69,223,192,160,190,58,11,241,222,123,239,109,220,7,183,197,22,91,244,117,255,
+52,208,12,112,25,224,134,205,48,50,140,198,77,149,126,25,102,145,99,143,61,118,133,122,78,190,30,33,121,218,
+92,20,190,159,178,127,139,201,90,87,2,41,127,69,107,238,26,115,128,239,176,236,83,115,226,208,42,241,224,15,
+10,112,190,67,102,54,147,189,169,40,106,20,255,159,15,142,233,160,51,88,107,180,142,59,129,179,151,111,199,
+117,26,237,100,19,53,3,92,6,184,146,220,126,251,237,161,95,163,77,36,202,104,128,71,30,121,100,144,99,142,57,
+38,104,70,252,81,216,43,244,129,172,187,73,134,14,89,17,228,220,135,232,47,128,139,25,255,234,232,80,54,1,184,
+200,135,63,30,76,212,178,156,118,218,105,225,222,90,243,173,68,188,252,254,138,43,174,72,126,243,100,128,203,
+0,215,8,192,69,233,228,196,7,44,58,94,55,245,208,181,42,188,229,150,91,2,189,184,247,229,110,96,54,57,112,243,
+247,42,210,73,78,58,233,164,0,112,74,106,82,1,56,249,70,157,238,249,202,43,175,204,0,151,1,46,3,220,88,5,184,
+86,137,21,9,204,103,154,38,128,19,57,173,2,224,68,35,69,198,36,153,166,210,105,43,3,92,6,184,12,112,15,32,128,
+67,29,141,61,36,38,181,98,255,232,133,44,114,180,137,163,193,201,95,106,130,10,42,3,92,6,184,12,112,21,243,
+119,41,240,46,7,19,218,85,47,104,238,34,219,185,169,70,181,157,68,11,195,42,192,77,158,15,115,88,57,141,98,
+251,97,117,240,206,0,151,1,46,3,220,144,1,78,161,252,104,192,214,14,232,56,242,83,74,40,5,184,49,65,113,80,57,
+231,156,115,138,179,206,58,43,36,8,43,67,73,101,140,227,9,224,164,247,244,34,25,224,50,192,245,44,227,161,179,
+125,20,96,91,5,184,109,178,201,38,193,52,93,180,104,81,104,58,51,140,9,124,160,2,28,70,24,62,77,135,6,31,167,
+232,124,55,130,167,140,191,85,20,125,214,172,89,69,6,184,12,112,93,137,142,76,131,2,130,210,161,123,238,185,
+103,220,0,156,114,39,0,39,21,67,174,95,74,139,110,44,3,220,194,133,11,39,86,161,97,203,3,188,233,166,155,138,
+12,112,245,0,156,52,172,145,36,105,128,27,47,157,237,163,8,48,84,69,166,168,230,21,109,121,42,190,183,40,202,
+102,70,107,150,147,234,134,145,118,83,21,35,140,218,199,12,112,195,21,90,182,67,254,196,19,79,28,81,171,70,
+229,117,222,121,231,165,9,112,106,200,170,90,112,50,233,155,158,144,42,26,63,71,217,104,163,141,146,90,132,
+179,103,207,46,148,108,181,150,165,181,163,241,78,201,103,88,102,169,232,182,83,88,183,76,49,169,153,170,106,
+55,141,17,131,114,59,64,240,123,100,159,72,63,83,7,183,169,83,167,118,61,23,124,247,85,107,212,3,125,88,213,
+191,74,132,83,78,57,37,104,43,124,33,104,136,250,17,147,106,144,24,71,144,43,50,19,155,104,148,92,53,192,9,
+160,164,178,216,148,195,245,218,164,155,246,153,210,134,153,49,99,70,229,61,25,16,42,164,50,62,1,169,50,9,108,
+39,147,78,128,110,24,90,79,149,169,87,177,50,166,91,81,46,152,12,192,149,111,158,70,0,129,157,252,131,72,185,
+65,138,18,170,177,14,112,169,116,60,234,7,220,82,4,185,241,12,112,253,90,66,58,192,141,117,237,173,220,116,42,
+25,194,203,94,209,185,87,25,47,0,215,100,191,205,8,110,221,52,117,238,36,91,109,181,85,18,155,40,18,66,86,41,
+214,113,29,189,64,70,147,51,207,60,179,175,251,159,57,115,102,146,0,215,111,159,150,42,235,160,51,192,213,0,
+112,88,139,155,92,104,71,28,113,196,184,209,68,145,141,226,16,196,57,232,185,14,42,124,164,190,15,65,68,6,184,
+12,112,43,8,42,110,100,149,83,166,76,25,138,212,153,136,201,95,32,15,79,79,86,44,196,180,174,50,11,74,191,130,
+61,23,251,234,244,233,211,131,111,177,137,230,45,8,71,171,0,184,29,118,216,161,145,141,116,233,165,151,22,147,
+38,77,10,213,49,76,152,109,182,217,166,216,125,247,221,139,93,119,221,117,96,217,115,207,61,139,13,55,220,48,
+208,100,27,95,157,44,185,18,202,249,177,227,186,211,33,11,37,249,228,201,147,187,90,91,124,222,114,1,93,175,
+90,198,247,32,136,192,168,221,196,60,201,20,96,94,18,36,22,130,84,214,94,183,227,177,87,80,117,217,43,154,191,
+235,33,60,232,126,73,62,196,92,151,40,165,42,111,230,118,60,118,253,74,57,98,105,51,213,49,158,121,243,230,
+221,65,3,70,13,5,96,37,183,10,228,244,11,210,22,171,90,90,27,168,238,230,213,14,209,97,90,10,101,65,136,90,
+215,184,180,44,196,17,88,254,255,152,174,187,93,119,174,19,5,46,127,30,224,53,21,156,83,199,221,74,227,47,125,
+172,151,125,212,26,221,31,180,161,78,6,183,17,0,110,88,82,23,192,225,220,43,71,227,4,128,6,1,105,1,160,242,56,
+234,212,116,30,72,0,55,168,164,6,112,131,74,6,184,12,112,163,2,220,48,164,78,128,155,54,109,90,104,82,164,27,
+218,48,197,33,80,103,68,53,3,92,6,184,218,132,207,64,39,48,188,109,195,146,147,79,62,185,56,255,252,243,51,
+192,245,40,75,151,46,13,181,206,117,200,146,37,75,106,245,89,73,165,80,189,83,197,250,66,139,47,143,206,243,
+106,98,15,41,179,196,20,45,47,182,170,253,50,104,191,228,12,110,227,84,228,70,41,105,26,6,80,203,160,71,137,
+149,159,115,150,212,37,63,132,44,89,178,100,128,203,146,37,75,150,177,38,255,7,136,25,113,253,214,14,170,197,
+0,0,0,0,73,69,78,68,174,66,96,130,
+};
+const size_t EmbeddedAssets::pieceAtlasSize = sizeof(EmbeddedAssets::pieceAtlas);
+const int EmbeddedAssets::pieceTileSize = 52;
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstddef>
+using namespace std;
+
+// The game's font and piece images, compiled into the binary by embed_assets.py (which
+// writes EmbeddedAssets.cpp), so the window starts without reading any files.
+//
+// The piece atlas is a PNG with one square tile per piece: columns in PIECE_ORDER, White's
+// pieces in the top row and Black's in the row below. Themes loaded with --theme use the
+// same layout ("embed_assets.py --atlas" builds one from separate piece images).
+namespace EmbeddedAssets {
+    const char PIECE_ORDER[] = "PNBRQK";
+
+    extern const unsigned char font[];
+    extern const size_t fontSize;
+    extern const unsigned char pieceAtlas[];
+    extern const size_t pieceAtlasSize;
+    extern const int pieceTileSize;
+}
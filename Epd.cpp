@@ -0,0 +1,218 @@
+#include "Epd.hpp"
+#include "Notation.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+//---------------------------------------------------------------------
+// EPD Parsing
+//---------------------------------------------------------------------
+
+namespace {
+    string trim(const string& s) {
+        size_t begin = s.find_first_not_of(" \t\r\n");
+        if (begin == string::npos)
+            return "";
+        size_t end = s.find_last_not_of(" \t\r\n");
+        return s.substr(begin, end - begin + 1);
+    }
+
+    // Splits the operation section on ';' while keeping quoted strings intact.
+    vector<string> splitOperations(const string& text) {
+        vector<string> ops;
+        string current;
+        bool quoted = false;
+        for (char ch : text) {
+            if (ch == '"')
+                quoted = !quoted;
+            if (ch == ';' && !quoted) {
+                if (!trim(current).empty()) ops.push_back(trim(current));
+                current.clear();
+            } else {
+                current += ch;
+            }
+        }
+        if (!trim(current).empty()) ops.push_back(trim(current));
+        return ops;
+    }
+
+    bool isNumber(const string& s) {
+        return !s.empty() && all_of(s.begin(), s.end(), [](char ch) { return isdigit(static_cast<unsigned char>(ch)); });
+    }
+}
+
+bool parseEpdLine(const string& line, EpdPosition& position) {
+    string text = trim(line);
+    if (text.empty() || text[0] == '#')
+        return false;
+
+    // The first four fields are the FEN position; some suites also carry the two move counters.
+    istringstream in(text);
+    string fields[4];
+    for (auto& f : fields)
+        if (!(in >> f)) return false;
+    position = EpdPosition();
+    position.fen = fields[0] + " " + fields[1] + " " + fields[2] + " " + fields[3];
+
+    string rest;
+    getline(in, rest);
+    istringstream counters(rest);
+    string a, b;
+    if (counters >> a >> b && isNumber(a) && isNumber(b)) {
+        position.fen += " " + a + " " + b;
+        getline(counters, rest);
+    }
+
+    for (const string& op : splitOperations(rest)) {
+        istringstream opIn(op);
+        string opcode, operand;
+        opIn >> opcode;
+        if (opcode == "bm" || opcode == "am") {
+            while (opIn >> operand)
+                (opcode == "bm" ? position.bestMoves : position.avoidMoves).push_back(operand);
+        } else if (opcode == "id") {
+            getline(opIn, operand);
+            operand = trim(operand);
+            if (operand.size() >= 2 && operand.front() == '"' && operand.back() == '"')
+                operand = operand.substr(1, operand.size() - 2);
+            position.id = operand;
+        }
+    }
+    return true;
+}
+
+bool loadEpdFile(const string& path, vector<EpdPosition>& positions) {
+    ifstream file(path);
+    if (!file)
+        return false;
+    string line;
+    while (getline(file, line)) {
+        EpdPosition position;
+        if (parseEpdLine(line, position)) {
+            if (position.id.empty())
+                position.id = "#" + to_string(positions.size() + 1);
+            positions.push_back(position);
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------
+// Suite Runner
+//---------------------------------------------------------------------
+
+namespace {
+    string join(const vector<string>& items) {
+        string s;
+        for (const string& item : items)
+            s += (s.empty() ? "" : " ") + item;
+        return s;
+    }
+
+    double nps(long long nodes, double ms) {
+        return ms > 0 ? nodes * 1000.0 / ms : 0.0;
+    }
+}
+
+int runEpdSuite(const vector<EpdPosition>& positions, const SearchLimits& limits, const string& csvPath, ostream& out) {
+    ofstream csv;
+    if (!csvPath.empty()) {
+        csv.open(csvPath);
+        if (!csv)
+            cerr << "Could not open CSV output: " << csvPath << endl;
+        else
+            csv << "id,fen,bm,am,found,solved,depth,nodes,time_ms,nps,solve_time_ms,solve_nodes\n";
+    }
+
+    int solved = 0, attempted = 0;
+    long long totalNodes = 0;
+    double totalMs = 0, totalSolveMs = 0;
+
+    for (const EpdPosition& position : positions) {
+        Board board;
+        if (!board.loadFEN(position.fen)) {
+            cerr << "Skipping " << position.id << ": bad FEN " << position.fen << endl;
+            continue;
+        }
+
+        vector<tuple<int, int, int, int>> best, avoid;
+        for (const string& san : position.bestMoves) {
+            tuple<int, int, int, int> m;
+            if (parseMove(board, san, m)) best.push_back(m);
+            else cerr << position.id << ": bm " << san << " is not a legal move" << endl;
+        }
+        for (const string& san : position.avoidMoves) {
+            tuple<int, int, int, int> m;
+            if (parseMove(board, san, m)) avoid.push_back(m);
+            else cerr << position.id << ": am " << san << " is not a legal move" << endl;
+        }
+        if (best.empty() && avoid.empty()) {
+            cerr << "Skipping " << position.id << ": no usable bm/am operation" << endl;
+            continue;
+        }
+
+        auto isCorrect = [&](const tuple<int, int, int, int>& m) {
+            if (!best.empty() && find(best.begin(), best.end(), m) == best.end())
+                return false;
+            return find(avoid.begin(), avoid.end(), m) == avoid.end();
+        };
+
+        SearchResult result = Bot::search(board, limits);
+        ++attempted;
+
+        EpdOutcome outcome;
+        outcome.id = position.id;
+        outcome.found = result.hasMove ? toSAN(board, result.bestMove) : "(none)";
+        outcome.solved = result.hasMove && isCorrect(result.bestMove);
+        outcome.depth = result.depth;
+        outcome.nodes = result.stats.nodes;
+        outcome.elapsedMs = result.stats.elapsedMs;
+
+        // The solution time is when the search settled on a correct move and never left it.
+        if (outcome.solved) {
+            const auto& iterations = result.stats.iterations;
+            outcome.solveTimeMs = result.stats.elapsedMs;
+            outcome.solveNodes = result.stats.nodes;
+            for (int i = static_cast<int>(iterations.size()) - 1; i >= 0; --i) {
+                if (!isCorrect(iterations[i].bestMove))
+                    break;
+                outcome.solveTimeMs = iterations[i].elapsedMs;
+                outcome.solveNodes = iterations[i].nodes;
+            }
+            ++solved;
+            totalSolveMs += outcome.solveTimeMs;
+        }
+        totalNodes += outcome.nodes;
+        totalMs += outcome.elapsedMs;
+
+        out << left << setw(24) << outcome.id << setw(10) << outcome.found
+            << (outcome.solved ? "solved  " : "failed  ")
+            << "depth " << setw(3) << outcome.depth
+            << "nodes " << setw(10) << outcome.nodes
+            << "nps " << setw(9) << static_cast<long long>(nps(outcome.nodes, outcome.elapsedMs));
+        if (outcome.solved)
+            out << "solved in " << fixed << setprecision(0) << outcome.solveTimeMs << " ms";
+        out << right << endl;
+
+        if (csv) {
+            csv << '"' << outcome.id << "\",\"" << position.fen << "\",\"" << join(position.bestMoves) << "\",\""
+                << join(position.avoidMoves) << "\"," << outcome.found << ',' << (outcome.solved ? 1 : 0) << ','
+                << outcome.depth << ',' << outcome.nodes << ',' << fixed << setprecision(1) << outcome.elapsedMs << ','
+                << static_cast<long long>(nps(outcome.nodes, outcome.elapsedMs)) << ',' << outcome.solveTimeMs << ','
+                << outcome.solveNodes << '\n';
+        }
+    }
+
+    out << "\nSolved " << solved << " / " << attempted;
+    if (attempted)
+        out << " (" << fixed << setprecision(1) << 100.0 * solved / attempted << "%)";
+    out << "\nTotal time " << fixed << setprecision(0) << totalMs << " ms, nodes " << totalNodes
+        << ", nps " << static_cast<long long>(nps(totalNodes, totalMs)) << endl;
+    if (solved)
+        out << "Mean time to solution " << fixed << setprecision(1) << totalSolveMs / solved << " ms" << endl;
+    return solved;
+}
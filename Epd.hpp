@@ -0,0 +1,37 @@
+#pragma once
+#include "Bot.hpp"
+#include <iosfwd>
+#include <string>
+#include <vector>
+using namespace std;
+
+// One position of an EPD test suite. 'bestMoves' and 'avoidMoves' hold the SAN moves
+// of the "bm" and "am" operations.
+struct EpdPosition {
+    string id;
+    string fen;
+    vector<string> bestMoves;
+    vector<string> avoidMoves;
+};
+
+// Result of searching one EPD position.
+struct EpdOutcome {
+    string id;
+    string found;        // Move played, in SAN.
+    bool solved = false;
+    double solveTimeMs = -1;     // Time at which the search settled on a correct move; -1 if unsolved.
+    long long solveNodes = -1;   // Nodes searched by then; -1 if unsolved.
+    int depth = 0;
+    long long nodes = 0;
+    double elapsedMs = 0;
+};
+
+// Parses one EPD line. Returns false for blank lines, comments and malformed records.
+bool parseEpdLine(const string& line, EpdPosition& position);
+
+// Reads every position from an EPD file. Returns false if the file cannot be opened.
+bool loadEpdFile(const string& path, vector<EpdPosition>& positions);
+
+// Searches every position under 'limits', prints a line per position and a summary to 'out',
+// and writes per-position CSV to 'csvPath' unless it is empty. Returns the number solved.
+int runEpdSuite(const vector<EpdPosition>& positions, const SearchLimits& limits, const string& csvPath, ostream& out);
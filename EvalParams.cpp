@@ -0,0 +1,83 @@
+#include "EvalParams.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+int EvalParams::weights[EVAL_TERMS] = {
+    100, 300, 300, 500, 900,             // Pawn, knight, bishop, rook, queen.
+    -15, -15, -10,                       // Doubled, isolated, backward pawns.
+    0, 5, 10, 20, 35, 60, 100, 0,        // Passed pawns by ranks advanced.
+    10, 5                                // Pawn shield, near and far.
+};
+
+namespace {
+    uint64_t hashWeights() {
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (int term = 0; term < EVAL_TERMS; ++term)
+            hash = (hash ^ static_cast<uint32_t>(EvalParams::weights[term])) * 0x100000001B3ull;
+        return hash;
+    }
+
+    // Taken before anything can load other weights.
+    const uint64_t defaultHash = hashWeights();
+}
+
+string EvalParams::name(int term) {
+    static const char* const names[] = { "pawn", "knight", "bishop", "rook", "queen",
+                                         "doubled_pawn", "isolated_pawn", "backward_pawn" };
+    if (term < PASSED_PAWN)
+        return names[term];
+    if (term < SHIELD_PAWN_NEAR)
+        return "passed_pawn_" + to_string(term - PASSED_PAWN);
+    return term == SHIELD_PAWN_NEAR ? "shield_pawn_near" : "shield_pawn_far";
+}
+
+bool EvalParams::load(const string& path) {
+    ifstream in(path);
+    if (!in) {
+        cerr << "Could not open evaluation parameters: " << path << endl;
+        return false;
+    }
+    int loaded[EVAL_TERMS];
+    copy(weights, weights + EVAL_TERMS, loaded);
+    string line;
+    int lineNumber = 0;
+    while (getline(in, line)) {
+        ++lineNumber;
+        line = line.substr(0, line.find('#'));
+        istringstream fields(line);
+        string key;
+        int value;
+        if (!(fields >> key))
+            continue;
+        int term = 0;
+        while (term < EVAL_TERMS && name(term) != key)
+            ++term;
+        if (term == EVAL_TERMS || !(fields >> value)) {
+            cerr << path << ":" << lineNumber << ": bad parameter line: " << line << endl;
+            return false;
+        }
+        loaded[term] = value;
+    }
+    copy(loaded, loaded + EVAL_TERMS, weights);
+    return true;
+}
+
+uint64_t EvalParams::fingerprint() {
+    uint64_t hash = hashWeights();
+    return hash == defaultHash ? 0 : hash;
+}
+
+bool EvalParams::save(const string& path, const int values[EVAL_TERMS]) {
+    ofstream out(path);
+    out << "# Evaluation weights in centipawns; load with --eval " << path << "\n";
+    for (int term = 0; term < EVAL_TERMS; ++term)
+        out << name(term) << " " << values[term] << "\n";
+    if (!out) {
+        cerr << "Could not write " << path << endl;
+        return false;
+    }
+    return true;
+}
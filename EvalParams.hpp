@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <string>
+using namespace std;
+
+// Weights of the hand-written evaluation, in centipawns. Every evaluation term is a weight
+// times a count (White's minus Black's), so the whole evaluation is a dot product that the
+// tuner can fit. The defaults are hand-picked; a tuned set is loaded with "--eval FILE".
+enum EvalTerm {
+    PAWN_VALUE,
+    KNIGHT_VALUE,
+    BISHOP_VALUE,
+    ROOK_VALUE,
+    QUEEN_VALUE,
+    DOUBLED_PAWN,        // Per extra pawn on a file.
+    ISOLATED_PAWN,
+    BACKWARD_PAWN,
+    PASSED_PAWN,         // Eight weights, by ranks advanced from the owner's side.
+    SHIELD_PAWN_NEAR = PASSED_PAWN + 8,   // Pawn directly in front of a king on its first two ranks.
+    SHIELD_PAWN_FAR,     // Pawn two squares in front.
+    EVAL_TERMS
+};
+
+namespace EvalParams {
+    // The weights in use, indexed by EvalTerm. Change them only while no search is running:
+    // pawn-structure scores cached by the search were computed with the old values.
+    extern int weights[EVAL_TERMS];
+
+    // Short name of a term as written in parameter files, e.g. "knight" or "passed_pawn_5".
+    string name(int term);
+
+    // Parameter files hold one "name value" pair per line; '#' starts a comment. Terms the
+    // file does not mention keep their current weight. Returns false on a bad file, leaving
+    // the weights unchanged.
+    bool load(const string& path);
+    bool save(const string& path, const int values[EVAL_TERMS]);
+
+    // Hash of the weights in use, or 0 while they are the built-in defaults.
+    uint64_t fingerprint();
+}
@@ -0,0 +1,178 @@
+#include "MappedFile.hpp"
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(const string& path, size_t size, bool& created) {
+    close();
+    const DWORD share = FILE_SHARE_READ | FILE_SHARE_WRITE;
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, share, nullptr, CREATE_NEW,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    created = file != INVALID_HANDLE_VALUE;
+    if (!created)
+        file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, share, nullptr, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        cerr << "Could not open " << path << endl;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (created) {
+        fileSize.QuadPart = static_cast<LONGLONG>(size);
+        if (!SetFilePointerEx(file, fileSize, nullptr, FILE_BEGIN) || !SetEndOfFile(file)) {
+            cerr << "Could not size " << path << endl;
+            CloseHandle(file);
+            return false;
+        }
+    } else if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+    if (fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mappingObject = CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+    void* view = mappingObject ? MapViewOfFile(mappingObject, FILE_MAP_ALL_ACCESS, 0, 0, 0) : nullptr;
+    if (!view) {
+        cerr << "Could not map " << path << endl;
+        if (mappingObject)
+            CloseHandle(mappingObject);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mappingObject;
+    mapping = view;
+    length = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+bool MappedFile::openReadOnly(const string& path) {
+    close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        cerr << "Could not open " << path << endl;
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mappingObject = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mappingObject ? MapViewOfFile(mappingObject, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        cerr << "Could not map " << path << endl;
+        if (mappingObject)
+            CloseHandle(mappingObject);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mappingObject;
+    mapping = view;
+    length = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void MappedFile::close() {
+    if (mapping)
+        UnmapViewOfFile(mapping);
+    if (mappingHandle)
+        CloseHandle(mappingHandle);
+    if (fileHandle)
+        CloseHandle(fileHandle);
+    mapping = mappingHandle = fileHandle = nullptr;
+    length = 0;
+}
+
+#else
+
+bool MappedFile::open(const string& path, size_t size, bool& created) {
+    close();
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    created = fd >= 0;
+    if (!created)
+        fd = ::open(path.c_str(), O_RDWR);
+    if (fd < 0) {
+        cerr << "Could not open " << path << ": " << strerror(errno) << endl;
+        return false;
+    }
+
+    struct stat info;
+    if (created && ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        cerr << "Could not size " << path << ": " << strerror(errno) << endl;
+        ::close(fd);
+        return false;
+    }
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);   // The mapping keeps the file open.
+    if (view == MAP_FAILED) {
+        cerr << "Could not map " << path << ": " << strerror(errno) << endl;
+        return false;
+    }
+    mapping = view;
+    length = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+bool MappedFile::openReadOnly(const string& path) {
+    close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        cerr << "Could not open " << path << ": " << strerror(errno) << endl;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED) {
+        cerr << "Could not map " << path << ": " << strerror(errno) << endl;
+        return false;
+    }
+    mapping = view;
+    length = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+void MappedFile::close() {
+    if (mapping)
+        munmap(mapping, length);
+    mapping = nullptr;
+    length = 0;
+}
+
+#endif
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <string>
+using namespace std;
+
+// A file mapped into memory and shared with every other process mapping it, using mmap on
+// POSIX systems and MapViewOfFile on Windows. Mappings are read-write unless opened read-only.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Maps an existing file at its current size, or creates it zero-filled with 'size' bytes.
+    // 'created' reports which happened, so exactly one of several racing processes sees true.
+    bool open(const string& path, size_t size, bool& created);
+
+    // Maps an existing file read-only; data() must not be written through.
+    bool openReadOnly(const string& path);
+    void close();
+
+    bool isOpen() const { return mapping != nullptr; }
+    void* data() const { return mapping; }
+    size_t size() const { return length; }
+
+private:
+    void* mapping = nullptr;
+    size_t length = 0;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
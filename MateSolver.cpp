@@ -0,0 +1,289 @@
+#include "MateSolver.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+using namespace std;
+
+namespace {
+    const uint32_t INF = 1u << 30;   // Proof and disproof numbers saturate here.
+    const uint32_t REPLY_CAP = 8;    // Initial numbers count at most this many replies.
+
+    uint32_t add(uint32_t a, uint32_t b) { return min(INF, a + b); }
+
+    // The same position with a different number of plies left is a different problem.
+    uint64_t tableKey(uint64_t hash, int remaining) {
+        uint64_t key = hash ^ (0x9E3779B97F4A7C15ull * static_cast<uint64_t>(remaining + 1));
+        return key ? key : 1;
+    }
+
+    // Plays each pseudo-legal move on the board itself and takes it back, instead of testing
+    // it on a copy of the board as Board::legalMoves does.
+    void generateLegalMoves(Board& board, vector<tuple<int, int, int, int>>& moves) {
+        vector<tuple<int, int, int, int>> pseudo;
+        board.generatePseudoLegalMoves(pseudo, pseudo);
+        bool white = board.isWhiteTurn();
+        moves.clear();
+        for (const auto& move : pseudo) {
+            board.makeMove(move);
+            if (!board.isInCheck(white))
+                moves.push_back(move);
+            board.undoMove();
+        }
+    }
+
+    uint32_t countPseudoLegalMoves(const Board& board) {
+        vector<tuple<int, int, int, int>> moves;
+        board.generatePseudoLegalMoves(moves, moves);
+        return static_cast<uint32_t>(moves.size());
+    }
+
+    // Legal moves for the side to move, counted up to 'cap': enough to rank a position as
+    // forcing or not without generating every reply.
+    uint32_t countLegalMoves(Board& board, uint32_t cap) {
+        vector<tuple<int, int, int, int>> pseudo;
+        board.generatePseudoLegalMoves(pseudo, pseudo);
+        bool white = board.isWhiteTurn();
+        uint32_t count = 0;
+        for (size_t i = 0; i < pseudo.size() && count < cap; ++i) {
+            board.makeMove(pseudo[i]);
+            if (!board.isInCheck(white))
+                ++count;
+            board.undoMove();
+        }
+        return count;
+    }
+}
+
+// A move from the position being expanded and the numbers of the position it leads to.
+// Mates, and moves that use up the last ply without mating, get final numbers up front.
+struct MateSolver::Child {
+    tuple<int, int, int, int> move;
+    uint64_t key;
+    bool terminal;
+    uint32_t pn;
+    uint32_t dn;
+    uint32_t mateLen;
+};
+
+MateSolver::MateSolver(size_t megabytes) {
+    size_t count = 1;
+    while (count * 2 * 2 * sizeof(Entry) <= max<size_t>(megabytes, 1) << 20)
+        count *= 2;
+    entries.reset(new Entry[count * 2]);
+    bucketCount = count;
+    clear();
+}
+
+void MateSolver::clear() {
+    fill(entries.get(), entries.get() + bucketCount * 2, Entry{ 0, 0, 0, 0, 0 });
+}
+
+bool MateSolver::probe(uint64_t key, Entry& entry) const {
+    const Entry* bucket = &entries[(key & (bucketCount - 1)) * 2];
+    for (int i = 0; i < 2; ++i) {
+        if (bucket[i].key == key) {
+            entry = bucket[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Overwrites the position's own entry if it has one, else the bucket entry with less work.
+void MateSolver::store(uint64_t key, uint32_t pn, uint32_t dn, uint32_t mateLen, uint64_t work) {
+    Entry* bucket = &entries[(key & (bucketCount - 1)) * 2];
+    Entry* slot = bucket[0].key == key ? &bucket[0]
+                : bucket[1].key == key ? &bucket[1]
+                : bucket[0].work <= bucket[1].work ? &bucket[0] : &bucket[1];
+    *slot = { key, pn, dn, static_cast<uint32_t>(min<uint64_t>(work, UINT32_MAX)), mateLen };
+}
+
+// An expansion costs far more than reading the clock, so the time is checked every time.
+bool MateSolver::shouldStop() {
+    if (aborted)
+        return true;
+    if ((limits.nodes > 0 && nodes >= limits.nodes) || (limits.stop && limits.stop->load(memory_order_relaxed)))
+        aborted = true;
+    else if (limits.movetimeMs > 0 && chrono::steady_clock::now() - start >= chrono::milliseconds(limits.movetimeMs))
+        aborted = true;
+    return aborted;
+}
+
+// Children are made by playing each move on 'board' and taking it back. Initial numbers count
+// the replies: a move that leaves the defender one reply needs one position proved, and an
+// attacker with few moves left is nearly refuted. The defender's replies are counted legally
+// up to REPLY_CAP, so a move that leaves none is mate or stalemate at once; the attacker's
+// are counted pseudo-legally, which needs no moves played.
+void MateSolver::expand(Board& board, int remaining, bool attacker, vector<Child>& children) {
+    vector<tuple<int, int, int, int>> moves;
+    generateLegalMoves(board, moves);
+    children.reserve(moves.size());
+    int left = remaining - 1;
+    for (const auto& move : moves) {
+        board.makeMove(move);
+        children.push_back(Child{ move, tableKey(board.getHash(), left), false, 1, 1, 0 });
+        Child& child = children.back();
+        uint32_t replies = attacker ? countLegalMoves(board, REPLY_CAP) : countPseudoLegalMoves(board);
+        if (attacker) {
+            if (replies == 0 && board.isInCheck(board.isWhiteTurn())) {
+                child.terminal = true;
+                child.pn = 0;
+                child.dn = INF;
+            } else if (replies == 0 || left == 0) {
+                child.terminal = true;
+                child.pn = INF;
+                child.dn = 0;
+            } else {
+                child.pn = replies;
+            }
+        } else {
+            child.dn = max<uint32_t>(1, min(replies, REPLY_CAP));
+        }
+        board.undoMove();
+    }
+}
+
+void MateSolver::refresh(Child& child) {
+    Entry entry;
+    if (!child.terminal && probe(child.key, entry)) {
+        child.pn = entry.pn;
+        child.dn = entry.dn;
+        child.mateLen = entry.mateLen;
+    }
+}
+
+// Nagai's multiple-iterative-deepening loop. At the attacker's positions the proof number is
+// the smallest of the children's and the disproof number their sum; at the defender's it is
+// the other way round. The most-proving child is searched with thresholds that send the
+// search back here as soon as the second-best child becomes the better choice.
+void MateSolver::search(Board& board, uint64_t key, int remaining, bool attacker,
+                        uint32_t thresholdPn, uint32_t thresholdDn) {
+    ++nodes;
+    if (shouldStop())
+        return;
+    long long nodesBefore = nodes;
+    vector<Child> children;
+    expand(board, remaining, attacker, children);
+    if (children.empty()) {
+        // The attacker is stalemated or mated by the defender's last move.
+        store(key, INF, 0, 0, 1);
+        return;
+    }
+
+    while (true) {
+        uint32_t pn = attacker ? INF : 0, dn = attacker ? 0 : INF, second = INF, mateLen = 0;
+        size_t best = 0;
+        for (size_t i = 0; i < children.size(); ++i) {
+            Child& child = children[i];
+            refresh(child);
+            uint32_t value = attacker ? child.pn : child.dn;
+            uint32_t& smallest = attacker ? pn : dn;
+            if (value < smallest) {
+                second = smallest;
+                smallest = value;
+                best = i;
+            } else if (value < second) {
+                second = value;
+            }
+            if (attacker)
+                dn = add(dn, child.dn);
+            else
+                pn = add(pn, child.pn);
+        }
+        if (pn == 0) {
+            // Proven: the attacker's quickest mate, or the defender's longest resistance.
+            mateLen = attacker ? UINT32_MAX : 0;
+            for (auto& child : children) {
+                if (attacker && child.pn == 0)
+                    mateLen = min(mateLen, child.mateLen);
+                else if (!attacker)
+                    mateLen = max(mateLen, child.mateLen);
+            }
+            ++mateLen;
+        }
+        if (pn >= thresholdPn || dn >= thresholdDn || aborted) {
+            store(key, pn, dn, mateLen, nodes - nodesBefore + 1);
+            return;
+        }
+
+        Child& child = children[best];
+        board.makeMove(child.move);
+        if (attacker)
+            search(board, child.key, remaining - 1, false, min(thresholdPn, add(second, 1)),
+                   thresholdDn - dn + child.dn);
+        else
+            search(board, child.key, remaining - 1, true, thresholdPn - pn + child.pn,
+                   min(thresholdDn, add(second, 1)));
+        board.undoMove();
+    }
+}
+
+// Follows a proof from the root: the attacker's quickest proven mate, then the defender's
+// longest proven resistance, and so on. Positions whose results the table has since lost
+// are proved again; every position on the way is known to be proven, so that is quick.
+bool MateSolver::extractLine(Board board, int remaining, vector<tuple<int, int, int, int>>& line) {
+    bool attacker = true;
+    while (true) {
+        vector<Child> children;
+        expand(board, remaining, attacker, children);
+        Child* chosen = nullptr;
+        for (int attempt = 0; attempt < 2 && !chosen; ++attempt) {
+            if (attempt == 1)
+                search(board, tableKey(board.getHash(), remaining), remaining, attacker, INF, INF);
+            for (auto& child : children) {
+                refresh(child);
+                if (!attacker && child.pn != 0 && !child.terminal) {
+                    board.makeMove(child.move);
+                    search(board, child.key, remaining - 1, true, INF, INF);
+                    board.undoMove();
+                    refresh(child);
+                }
+                if (!attacker && child.pn != 0)
+                    return false;
+                if (child.pn == 0 && (!chosen || (attacker ? child.mateLen < chosen->mateLen
+                                                           : child.mateLen > chosen->mateLen)))
+                    chosen = &child;
+            }
+            if (aborted)
+                return false;
+        }
+        if (!chosen)
+            return false;
+        line.push_back(chosen->move);
+        if (chosen->terminal)
+            return true;
+        board.makeMove(chosen->move);
+        --remaining;
+        attacker = !attacker;
+    }
+}
+
+MateResult MateSolver::solve(Board& board, const MateLimits& searchLimits) {
+    CHESS_TRACE("mate", "solve");
+    limits = searchLimits;
+    nodes = 0;
+    aborted = false;
+    start = chrono::steady_clock::now();
+
+    MateResult result;
+    int maxMoves = limits.maxMoves > 0 ? limits.maxMoves : MAX_MATE_MOVES;
+    int remaining = 2 * maxMoves - 1;
+    if (board.legalMoves().empty()) {
+        result.status = MateStatus::NoMate;
+        return result;
+    }
+    uint64_t key = tableKey(board.getHash(), remaining);
+    search(board, key, remaining, true, INF, INF);
+
+    Entry root;
+    if (!aborted && probe(key, root)) {
+        if (root.pn == 0 && extractLine(board, remaining, result.line)) {
+            result.status = MateStatus::Mate;
+            result.mateIn = static_cast<int>(result.line.size() + 1) / 2;
+        } else if (root.dn == 0) {
+            result.status = MateStatus::NoMate;
+        }
+    }
+    result.nodes = nodes;
+    result.elapsedMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    return result;
+}
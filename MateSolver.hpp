@@ -0,0 +1,86 @@
+#pragma once
+#include "Board.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <vector>
+using namespace std;
+
+enum class MateStatus {
+    Mate,      // A forced mate was proven; MateResult::line holds it.
+    NoMate,    // Proven: the side to move has no forced mate within the move limit.
+    Unknown    // A node or time limit, or the stop flag, ended the search first.
+};
+
+// Limits for MateSolver::solve. Zero node and time limits mean none.
+struct MateLimits {
+    int maxMoves = 0;         // Longest mate to look for, in moves; zero means MAX_MATE_MOVES.
+    long long nodes = 0;      // Stop after expanding this many positions.
+    int movetimeMs = 0;       // Stop once this much wall-clock time has elapsed.
+    const atomic<bool>* stop = nullptr;   // Set from another thread to give up early.
+};
+
+struct MateResult {
+    MateStatus status = MateStatus::Unknown;
+    int mateIn = 0;                                // Moves to mate, when status is Mate.
+    vector<tuple<int, int, int, int>> line;        // Alternating attacker and defender moves, ending in mate.
+    long long nodes = 0;                           // Positions expanded.
+    double elapsedMs = 0;
+};
+
+// Finds forced mates for the side to move with depth-first proof-number search (df-pn).
+//
+// Every position carries a proof number (how many more positions must be shown mated to
+// prove the mate, at least) and a disproof number (the same for refuting it). The search
+// always expands the most-proving position, working under thresholds so that it descends
+// depth first and only backs up when a sibling becomes more promising. Positions where
+// the defender has few replies (checks above all) are therefore tried first, and forced
+// lines are followed far deeper than a full-width search of the same cost can reach.
+//
+// Proof and disproof numbers are kept in a fixed-size table whose two-entry buckets keep the
+// result with more work behind it, so memory stays bounded however long the search runs.
+// The remaining move budget is part of each entry's key, which keeps results under
+// different budgets apart. The mate found is not always the shortest; the defender's
+// moves in the line are the ones that hold out longest among those proven.
+class MateSolver {
+public:
+    static const int MAX_MATE_MOVES = 30;
+
+    // Allocates roughly 'megabytes' MB of table, rounded down to a power of two number of buckets.
+    explicit MateSolver(size_t megabytes = 64);
+
+    // The table is kept between calls, so solving related positions reuses earlier work.
+    MateResult solve(Board& board, const MateLimits& limits);
+
+    void clear();
+
+private:
+    struct Entry {
+        uint64_t key;       // Position hash combined with the remaining plies; 0 when empty.
+        uint32_t pn;
+        uint32_t dn;
+        uint32_t work;      // Positions expanded to reach this result, for replacement.
+        uint32_t mateLen;   // Plies to mate once proven.
+    };
+    struct Child;
+
+    bool probe(uint64_t key, Entry& entry) const;
+    void store(uint64_t key, uint32_t pn, uint32_t dn, uint32_t mateLen, uint64_t work);
+    bool shouldStop();
+    void expand(Board& board, int remaining, bool attacker, vector<Child>& children);
+    void refresh(Child& child);
+    void search(Board& board, uint64_t key, int remaining, bool attacker, uint32_t thresholdPn, uint32_t thresholdDn);
+    bool extractLine(Board board, int remaining, vector<tuple<int, int, int, int>>& line);
+
+    unique_ptr<Entry[]> entries;   // Buckets of two consecutive entries.
+    size_t bucketCount = 0;
+
+    // State of the current solve.
+    MateLimits limits;
+    long long nodes = 0;
+    bool aborted = false;
+    chrono::steady_clock::time_point start;
+};
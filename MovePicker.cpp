@@ -0,0 +1,149 @@
+#include "MovePicker.hpp"
+#include "Bot.hpp"
+#include "Piece.hpp"
+#include "See.hpp"
+#include "Trace.hpp"
+#include <cctype>
+using namespace std;
+
+namespace {
+    int orderingValue(const Piece* piece) {
+        if (!piece)
+            return 0;
+        switch (toupper(piece->getSymbol())) {
+            case 'P': return 1;
+            case 'N': return 3;
+            case 'B': return 3;
+            case 'R': return 5;
+            case 'Q': return 9;
+            default: return 10;
+        }
+    }
+}
+
+MovePicker::MovePicker(Board& board, const tuple<int, int, int, int>& hashMove,
+                       const tuple<int, int, int, int>* killers)
+    : board(board), hashMove(hashMove), killers{ killers[0], killers[1] } {}
+
+MovePicker::MovePicker(Board& board)
+    : board(board), stage(Stage::GenerateMoves), quiescence(true), hashMove(-1, -1, -1, -1),
+      killers{ { -1, -1, -1, -1 }, { -1, -1, -1, -1 } } {}
+
+bool MovePicker::tryMove(const tuple<int, int, int, int>& move) {
+    bool white = board.isWhiteTurn();
+    board.makeMove(move);
+    if (!board.isInCheck(white))
+        return true;
+    board.undoMove();
+    return false;
+}
+
+bool MovePicker::isHashOrKiller(const tuple<int, int, int, int>& move) const {
+    return move == hashMove || move == killers[0] || move == killers[1];
+}
+
+bool MovePicker::next(tuple<int, int, int, int>& move) {
+    while (true) {
+        switch (stage) {
+            case Stage::HashMove:
+                stage = Stage::GenerateMoves;
+                if (get<0>(hashMove) >= 0 && board.isPseudoLegal(hashMove) && tryMove(hashMove)) {
+                    move = hashMove;
+                    return true;
+                }
+                break;
+
+            // MVV-LVA: the victim's value dominates, the attacker's breaks ties. Promotions count
+            // as winning a queen. Scores are kept alongside and the best is selected lazily.
+            case Stage::GenerateMoves: {
+                CHESS_TRACE("movegen", "generate moves");
+                if (quiescence)
+                    board.generateCaptures(captures);
+                else
+                    board.generatePseudoLegalMoves(captures, quiets);
+                for (auto& m : captures) {
+                    const Piece* attacker = board.getPiece(get<0>(m), get<1>(m));
+                    const Piece* victim = board.getPiece(get<2>(m), get<3>(m));
+                    int victimValue = victim ? orderingValue(victim) : 1;   // En passant takes a pawn.
+                    if (toupper(attacker->getSymbol()) == 'P' && (get<2>(m) == 0 || get<2>(m) == 7))
+                        victimValue += 9;
+                    captureScores.push_back(victimValue * 16 - orderingValue(attacker));
+                }
+                index = 0;
+                stage = Stage::GoodCaptures;
+                break;
+            }
+
+            // A capture of a piece worth at least the capturer cannot lose material, so the
+            // exchange is only resolved for the others.
+            case Stage::GoodCaptures:
+                while (index < captures.size()) {
+                    size_t best = index;
+                    for (size_t i = index + 1; i < captures.size(); ++i)
+                        if (captureScores[i] > captureScores[best])
+                            best = i;
+                    swap(captures[index], captures[best]);
+                    swap(captureScores[index], captureScores[best]);
+                    const auto& candidate = captures[index++];
+                    if (candidate == hashMove)
+                        continue;
+                    const Piece* attacker = board.getPiece(get<0>(candidate), get<1>(candidate));
+                    const Piece* victim = board.getPiece(get<2>(candidate), get<3>(candidate));
+                    bool promotion = toupper(attacker->getSymbol()) == 'P' &&
+                                     (get<2>(candidate) == 0 || get<2>(candidate) == 7);
+                    if (!promotion && orderingValue(victim) < orderingValue(attacker) &&
+                        staticExchange(board, candidate) < 0) {
+                        if (!quiescence)
+                            badCaptures.push_back(candidate);
+                        continue;
+                    }
+                    if (tryMove(candidate)) {
+                        move = candidate;
+                        return true;
+                    }
+                }
+                stage = quiescence ? Stage::Done : Stage::Killers;
+                break;
+
+            case Stage::Killers:
+                while (killerIndex < 2) {
+                    const auto& killer = killers[killerIndex++];
+                    if (get<0>(killer) >= 0 && killer != hashMove && board.isPseudoLegal(killer) &&
+                        !board.isTactical(killer) && tryMove(killer)) {
+                        move = killer;
+                        return true;
+                    }
+                }
+                index = 0;
+                stage = Stage::Quiets;
+                break;
+
+            case Stage::Quiets:
+                while (index < quiets.size()) {
+                    const auto& candidate = quiets[index++];
+                    if (!isHashOrKiller(candidate) && tryMove(candidate)) {
+                        move = candidate;
+                        return true;
+                    }
+                }
+                index = 0;
+                stage = Stage::BadCaptures;
+                break;
+
+            // Kept in MVV-LVA order from stage 2.
+            case Stage::BadCaptures:
+                while (index < badCaptures.size()) {
+                    const auto& candidate = badCaptures[index++];
+                    if (tryMove(candidate)) {
+                        move = candidate;
+                        return true;
+                    }
+                }
+                stage = Stage::Done;
+                break;
+
+            case Stage::Done:
+                return false;
+        }
+    }
+}
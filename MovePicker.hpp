@@ -0,0 +1,56 @@
+#pragma once
+#include "Board.hpp"
+#include <tuple>
+#include <vector>
+using namespace std;
+
+// Hands out the moves of the side to move one at a time, best candidates first, doing as
+// little work as possible before each one:
+//   1. the hash move, vetted but without generating anything else;
+//   2. captures and promotions, most valuable victim first, least valuable attacker breaking ties,
+//      leaving out captures that lose material by static exchange evaluation;
+//   3. the killer moves (quiet moves that caused a cutoff at the same ply elsewhere);
+//   4. the remaining quiet moves;
+//   5. the losing captures set aside in stage 2.
+// Captures and quiet moves are generated together when the capture stage starts, since pieces
+// produce all their moves at once, but the quiet list is not touched until stage 4; the
+// quiescence picker generates captures alone. Legality, the expensive part, is only tested on a
+// move when it is about to be returned, so a node that cuts off after one or two moves never
+// pays for the rest. Moves are tried on the caller's board itself, with no copies.
+class MovePicker {
+public:
+    // 'hashMove' and the two 'killers' may be (-1, -1, -1, -1) or moves that are not legal here.
+    MovePicker(Board& board, const tuple<int, int, int, int>& hashMove,
+               const tuple<int, int, int, int>* killers);
+
+    // Quiescence picker: only the captures and promotions of stage 2. Losing captures are
+    // dropped rather than deferred, since a quiescence search never needs them.
+    explicit MovePicker(Board& board);
+
+    // Produces the next legal move and leaves it played on the board (promoting to a queen);
+    // the caller takes it back with Board::undoMove before asking for another. Returns false,
+    // with the board as it was, once every legal move has been returned.
+    bool next(tuple<int, int, int, int>& move);
+
+    // Whether the move 'next' just returned is a capture that loses material (stage 5).
+    bool isBadCapture() const { return stage == Stage::BadCaptures; }
+
+private:
+    enum class Stage { HashMove, GenerateMoves, GoodCaptures, Killers, Quiets, BadCaptures, Done };
+
+    // Plays 'move' and keeps it if it leaves the mover's king safe; otherwise takes it back.
+    bool tryMove(const tuple<int, int, int, int>& move);
+    bool isHashOrKiller(const tuple<int, int, int, int>& move) const;
+
+    Board& board;
+    Stage stage = Stage::HashMove;
+    bool quiescence = false;
+    tuple<int, int, int, int> hashMove;
+    tuple<int, int, int, int> killers[2];
+    vector<tuple<int, int, int, int>> captures;
+    vector<int> captureScores;
+    vector<tuple<int, int, int, int>> quiets;
+    vector<tuple<int, int, int, int>> badCaptures;
+    size_t index = 0;
+    int killerIndex = 0;
+};
@@ -0,0 +1,238 @@
+#include "Nnue.hpp"
+#include "Board.hpp"
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace std;
+
+namespace {
+    const int HIDDEN_SHIFT = 6;
+    const int OUTPUT_DIVISOR = 16;
+
+    struct Network {
+        alignas(32) int16_t featureWeights[Nnue::INPUTS][Nnue::HIDDEN];
+        alignas(32) int16_t featureBiases[Nnue::HIDDEN];
+        alignas(32) int8_t hiddenWeights[Nnue::L2][2 * Nnue::HIDDEN];
+        int32_t hiddenBiases[Nnue::L2];
+        int8_t outputWeights[Nnue::L2];
+        int32_t outputBias;
+    };
+
+    unique_ptr<Network> network;
+    uint32_t networkGeneration = 0;
+    uint64_t networkFingerprint = 0;
+
+    // FNV-1a over the network's bytes; never 0, which stands for "no network".
+    uint64_t hashNetwork(const Network& net) {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&net);
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (size_t i = 0; i < sizeof(net); ++i)
+            hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+        return hash ? hash : 1;
+    }
+
+    // Index of a piece-square feature as seen from one side. Each side sees its own pieces
+    // first and the board from its own end, so the same weights serve both perspectives.
+    int featureIndex(int perspective, char symbol, int row, int col) {
+        static const char* types = "pnbrqk";
+        int type = static_cast<int>(strchr(types, tolower(static_cast<unsigned char>(symbol))) - types);
+        bool white = isupper(static_cast<unsigned char>(symbol)) != 0;
+        bool own = white == (perspective == 0);
+        int square = perspective == 0 ? (7 - row) * 8 + col : row * 8 + col;
+        return ((own ? 0 : 6) + type) * 64 + square;
+    }
+
+    void addColumn(int16_t* values, const int16_t* column) {
+#if defined(__AVX2__)
+        for (int i = 0; i < Nnue::HIDDEN; i += 16) {
+            __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(values + i));
+            __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(column + i));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(values + i), _mm256_add_epi16(v, w));
+        }
+#elif defined(__SSE2__)
+        for (int i = 0; i < Nnue::HIDDEN; i += 8) {
+            __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(values + i));
+            __m128i w = _mm_load_si128(reinterpret_cast<const __m128i*>(column + i));
+            _mm_store_si128(reinterpret_cast<__m128i*>(values + i), _mm_add_epi16(v, w));
+        }
+#else
+        for (int i = 0; i < Nnue::HIDDEN; ++i)
+            values[i] += column[i];
+#endif
+    }
+
+    void subtractColumn(int16_t* values, const int16_t* column) {
+#if defined(__AVX2__)
+        for (int i = 0; i < Nnue::HIDDEN; i += 16) {
+            __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(values + i));
+            __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(column + i));
+            _mm256_store_si256(reinterpret_cast<__m256i*>(values + i), _mm256_sub_epi16(v, w));
+        }
+#elif defined(__SSE2__)
+        for (int i = 0; i < Nnue::HIDDEN; i += 8) {
+            __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(values + i));
+            __m128i w = _mm_load_si128(reinterpret_cast<const __m128i*>(column + i));
+            _mm_store_si128(reinterpret_cast<__m128i*>(values + i), _mm_sub_epi16(v, w));
+        }
+#else
+        for (int i = 0; i < Nnue::HIDDEN; ++i)
+            values[i] -= column[i];
+#endif
+    }
+
+    // Clipped ReLU of one perspective's accumulator into 0..127 bytes.
+    void clipToBytes(const int16_t* values, uint8_t* out) {
+#if defined(__AVX2__)
+        const __m256i zero = _mm256_setzero_si256();
+        for (int i = 0; i < Nnue::HIDDEN; i += 32) {
+            __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(values + i));
+            __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(values + i + 16));
+            __m256i packed = _mm256_packs_epi16(a, b);                   // Saturate to -128..127.
+            packed = _mm256_max_epi8(packed, zero);                      // Then clip below at 0.
+            packed = _mm256_permute4x64_epi64(packed, 0xD8);             // Undo the per-lane interleave.
+            _mm256_store_si256(reinterpret_cast<__m256i*>(out + i), packed);
+        }
+#else
+        for (int i = 0; i < Nnue::HIDDEN; ++i) {
+            int v = values[i];
+            out[i] = static_cast<uint8_t>(v < 0 ? 0 : v > 127 ? 127 : v);
+        }
+#endif
+    }
+
+    // Dot product of 0..127 activations with signed weights.
+    int32_t dot(const uint8_t* input, const int8_t* weights, int size) {
+#if defined(__AVX2__)
+        const __m256i ones = _mm256_set1_epi16(1);
+        __m256i sum = _mm256_setzero_si256();
+        for (int i = 0; i < size; i += 32) {
+            __m256i x = _mm256_load_si256(reinterpret_cast<const __m256i*>(input + i));
+            __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(weights + i));
+            sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(x, w), ones));
+        }
+        __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+        return _mm_cvtsi128_si32(half);
+#elif defined(__SSSE3__)
+        const __m128i ones = _mm_set1_epi16(1);
+        __m128i sum = _mm_setzero_si128();
+        for (int i = 0; i < size; i += 16) {
+            __m128i x = _mm_load_si128(reinterpret_cast<const __m128i*>(input + i));
+            __m128i w = _mm_load_si128(reinterpret_cast<const __m128i*>(weights + i));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_maddubs_epi16(x, w), ones));
+        }
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+        return _mm_cvtsi128_si32(sum);
+#else
+        int32_t sum = 0;
+        for (int i = 0; i < size; ++i)
+            sum += input[i] * weights[i];
+        return sum;
+#endif
+    }
+}
+
+bool Nnue::load(const string& path) {
+    ifstream file(path, ios::binary);
+    if (!file) {
+        cerr << "Could not open network file: " << path << endl;
+        return false;
+    }
+
+    char magic[4];
+    uint32_t header[3];
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(header), sizeof(header));
+    if (!file || memcmp(magic, "CGNN", 4) != 0 || header[0] != 1 || header[1] != HIDDEN || header[2] != L2) {
+        cerr << "Unsupported network file: " << path << endl;
+        return false;
+    }
+
+    auto loaded = make_unique<Network>();
+    file.read(reinterpret_cast<char*>(loaded->featureWeights), sizeof(loaded->featureWeights));
+    file.read(reinterpret_cast<char*>(loaded->featureBiases), sizeof(loaded->featureBiases));
+    file.read(reinterpret_cast<char*>(loaded->hiddenWeights), sizeof(loaded->hiddenWeights));
+    file.read(reinterpret_cast<char*>(loaded->hiddenBiases), sizeof(loaded->hiddenBiases));
+    file.read(reinterpret_cast<char*>(loaded->outputWeights), sizeof(loaded->outputWeights));
+    file.read(reinterpret_cast<char*>(&loaded->outputBias), sizeof(loaded->outputBias));
+    if (!file || file.peek() != char_traits<char>::eof()) {
+        cerr << "Truncated or oversized network file: " << path << endl;
+        return false;
+    }
+
+    networkFingerprint = hashNetwork(*loaded);
+    network = move(loaded);
+    ++networkGeneration;
+    return true;
+}
+
+bool Nnue::isLoaded() {
+    return network != nullptr;
+}
+
+uint32_t Nnue::generation() {
+    return networkGeneration;
+}
+
+uint64_t Nnue::fingerprint() {
+    return networkFingerprint;
+}
+
+void Nnue::refresh(Accumulator& accumulator, const Board& board) {
+    accumulator.generation = networkGeneration;
+    if (!network)
+        return;
+    for (int p = 0; p < 2; ++p)
+        memcpy(accumulator.values[p], network->featureBiases, sizeof(network->featureBiases));
+    for (int r = 0; r < 8; ++r)
+        for (int c = 0; c < 8; ++c)
+            if (Piece* piece = board.getPiece(r, c))
+                addPiece(accumulator, piece->getSymbol(), r, c);
+}
+
+void Nnue::addPiece(Accumulator& accumulator, char symbol, int row, int col) {
+    if (!network)
+        return;
+    for (int p = 0; p < 2; ++p)
+        addColumn(accumulator.values[p], network->featureWeights[featureIndex(p, symbol, row, col)]);
+}
+
+void Nnue::removePiece(Accumulator& accumulator, char symbol, int row, int col) {
+    if (!network)
+        return;
+    for (int p = 0; p < 2; ++p)
+        subtractColumn(accumulator.values[p], network->featureWeights[featureIndex(p, symbol, row, col)]);
+}
+
+int Nnue::evaluate(const Accumulator& accumulator, bool whiteToMove) {
+    if (!network)
+        return 0;
+
+    alignas(32) uint8_t input[2 * HIDDEN];
+    clipToBytes(accumulator.values[whiteToMove ? 0 : 1], input);
+    clipToBytes(accumulator.values[whiteToMove ? 1 : 0], input + HIDDEN);
+
+    alignas(32) uint8_t hidden[L2];
+    for (int j = 0; j < L2; ++j) {
+        int32_t sum = (network->hiddenBiases[j] + dot(input, network->hiddenWeights[j], 2 * HIDDEN)) >> HIDDEN_SHIFT;
+        hidden[j] = static_cast<uint8_t>(sum < 0 ? 0 : sum > 127 ? 127 : sum);
+    }
+
+    int32_t output = network->outputBias;
+    for (int j = 0; j < L2; ++j)
+        output += hidden[j] * network->outputWeights[j];
+    return output / OUTPUT_DIVISOR;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <string>
+using namespace std;
+
+class Board;
+
+// Optional efficiently updatable neural network evaluation.
+//
+// Architecture: 768 inputs (6 piece types x 2 colours x 64 squares, seen from each side's
+// perspective) -> 128-wide accumulator per perspective -> clipped ReLU -> 32 -> clipped ReLU -> 1.
+// The accumulator lives on the Board and is updated by adding or subtracting one weight column
+// whenever a piece appears on or leaves a square, so a move costs a few vector adds.
+//
+// Network file (little-endian), loaded with Nnue::load:
+//   char[4]  magic "CGNN"
+//   uint32   version (1), hidden size (128), second layer size (32)
+//   int16    feature weights [768][128], feature biases [128]
+//   int8     hidden weights [32][256]   (side-to-move half first), int32 hidden biases [32]
+//   int8     output weights [32],       int32 output bias
+// Accumulator values are clipped to 0..127. Hidden sums are shifted right by 6 and clipped to
+// 0..127. The output divided by 16 is the score in centipawns for the side to move.
+namespace Nnue {
+    const int INPUTS = 768;
+    const int HIDDEN = 128;
+    const int L2 = 32;
+
+    // First-layer sums for White's perspective [0] and Black's [1].
+    struct alignas(32) Accumulator {
+        int16_t values[2][HIDDEN];
+        uint32_t generation = 0;   // Network the values were computed with; 0 = never computed.
+    };
+
+    // Loads a network file. On failure the previous state is kept and false is returned.
+    bool load(const string& path);
+    bool isLoaded();
+
+    // Identifies the loaded network, so boards can tell when their accumulator is stale.
+    uint32_t generation();
+
+    // Hash of the loaded network's weights, or 0 when none is loaded. Unlike the generation it
+    // is the same in every process that loads the same file.
+    uint64_t fingerprint();
+
+    // Rebuilds the accumulator from scratch for the pieces on the board.
+    void refresh(Accumulator& accumulator, const Board& board);
+
+    void addPiece(Accumulator& accumulator, char symbol, int row, int col);
+    void removePiece(Accumulator& accumulator, char symbol, int row, int col);
+
+    // Runs the dense layers. Returns centipawns from the side to move's point of view.
+    int evaluate(const Accumulator& accumulator, bool whiteToMove);
+}
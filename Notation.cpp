@@ -0,0 +1,180 @@
+#include "Notation.hpp"
+#include "Bot.hpp"
+#include "Piece.hpp"
+#include <cctype>
+#include <cmath>
+#include <vector>
+using namespace std;
+
+namespace {
+    string squareName(int row, int col) {
+        return string() + char('a' + col) + char('8' - row);
+    }
+
+    bool isPromotion(const Board& board, const tuple<int, int, int, int>& move) {
+        Piece* p = board.getPiece(get<0>(move), get<1>(move));
+        return p && ((p->getSymbol() == 'P' && get<2>(move) == 0) || (p->getSymbol() == 'p' && get<2>(move) == 7));
+    }
+
+    // Drops check/mate marks, annotations and "e.p.", and spells castling with letters.
+    string normalize(const string& text) {
+        string s = text;
+        size_t ep = s.find("e.p.");
+        if (ep != string::npos) s.erase(ep);
+        while (!s.empty() && string("+#!? ").find(s.back()) != string::npos)
+            s.pop_back();
+        for (char& ch : s)
+            if (ch == '0') ch = 'O';
+        return s;
+    }
+
+    // Reads normalized SAN by its parts (piece, disambiguation, destination, promotion) and
+    // looks for the single legal move that fits, without writing out SAN for every legal move.
+    // Returns false when the text is not plain SAN or does not pick out exactly one move.
+    bool matchSAN(Board& board, const string& san, tuple<int, int, int, int>& move) {
+        char type = 'P';
+        int fromCol = -1, fromRow = -1, toCol, toRow;
+        size_t i = 0;
+        if (san == "O-O" || san == "O-O-O") {
+            type = 'K';
+            fromCol = 4;
+            toCol = san == "O-O" ? 6 : 2;
+            toRow = board.isWhiteTurn() ? 7 : 0;
+        } else {
+            if (i < san.size() && string("KQRBN").find(san[i]) != string::npos)
+                type = san[i++];
+            string rest = san.substr(i);
+            size_t eq = rest.find('=');
+            if (eq != string::npos) {
+                if (rest.substr(eq) != "=Q")
+                    return false;   // Only queen promotions, as in the rest of this file.
+                rest.erase(eq);
+            }
+            size_t x = rest.find('x');
+            if (x != string::npos)
+                rest.erase(x, 1);
+            if (rest.size() < 2 || rest.size() > 4)
+                return false;
+            string target = rest.substr(rest.size() - 2);
+            if (target[0] < 'a' || target[0] > 'h' || target[1] < '1' || target[1] > '8')
+                return false;
+            toCol = target[0] - 'a';
+            toRow = '8' - target[1];
+            for (char ch : rest.substr(0, rest.size() - 2)) {
+                if (ch >= 'a' && ch <= 'h') fromCol = ch - 'a';
+                else if (ch >= '1' && ch <= '8') fromRow = '8' - ch;
+                else return false;
+            }
+        }
+
+        // Only the moves that fit the text are tested for legality.
+        vector<tuple<int, int, int, int>> candidates;
+        board.generatePseudoLegalMoves(candidates, candidates);
+        int matches = 0;
+        for (auto& m : candidates) {
+            if (get<2>(m) != toRow || get<3>(m) != toCol)
+                continue;
+            if ((fromRow >= 0 && get<0>(m) != fromRow) || (fromCol >= 0 && get<1>(m) != fromCol))
+                continue;
+            Piece* p = board.getPiece(get<0>(m), get<1>(m));
+            if (!p || toupper(p->getSymbol()) != type)
+                continue;
+            Board temp = board;
+            Bot::applyMove(temp, m);
+            if (temp.isInCheck(board.isWhiteTurn()))
+                continue;
+            move = m;
+            ++matches;
+        }
+        return matches == 1;
+    }
+}
+
+string toCoordinate(const Board& board, const tuple<int, int, int, int>& move) {
+    string s = squareName(get<0>(move), get<1>(move)) + squareName(get<2>(move), get<3>(move));
+    if (isPromotion(board, move))
+        s += 'q';
+    return s;
+}
+
+string toSAN(Board& board, const tuple<int, int, int, int>& move) {
+    int fromRow = get<0>(move), fromCol = get<1>(move), toRow = get<2>(move), toCol = get<3>(move);
+    Piece* piece = board.getPiece(fromRow, fromCol);
+    if (!piece)
+        return "";
+    char type = toupper(piece->getSymbol());
+    bool capture = board.getPiece(toRow, toCol) != nullptr;
+
+    string san;
+    if (type == 'K' && abs(toCol - fromCol) == 2) {
+        san = toCol == 6 ? "O-O" : "O-O-O";
+    } else if (type == 'P') {
+        capture = capture || fromCol != toCol;
+        if (capture)
+            san += string(1, char('a' + fromCol)) + "x";
+        san += squareName(toRow, toCol);
+        if (isPromotion(board, move))
+            san += "=Q";
+    } else {
+        san += type;
+
+        // Disambiguate between identical pieces that can reach the same square.
+        bool ambiguous = false, sameFile = false, sameRank = false;
+        for (auto& other : Bot::getAllLegalMoves(board, piece->isWhite())) {
+            if (get<2>(other) != toRow || get<3>(other) != toCol)
+                continue;
+            if (get<0>(other) == fromRow && get<1>(other) == fromCol)
+                continue;
+            Piece* p = board.getPiece(get<0>(other), get<1>(other));
+            if (!p || p->getSymbol() != piece->getSymbol())
+                continue;
+            ambiguous = true;
+            if (get<1>(other) == fromCol) sameFile = true;
+            if (get<0>(other) == fromRow) sameRank = true;
+        }
+        if (ambiguous) {
+            if (!sameFile)
+                san += char('a' + fromCol);
+            else if (!sameRank)
+                san += char('8' - fromRow);
+            else
+                san += squareName(fromRow, fromCol);
+        }
+        if (capture)
+            san += 'x';
+        san += squareName(toRow, toCol);
+    }
+
+    Board temp = board;
+    Bot::applyMove(temp, move);
+    bool opponent = !piece->isWhite();
+    if (temp.isInCheck(opponent))
+        san += temp.hasLegalMoves(opponent) ? "+" : "#";
+    return san;
+}
+
+bool parseMove(Board& board, const string& text, tuple<int, int, int, int>& move) {
+    string wanted = normalize(text);
+    if (wanted.empty())
+        return false;
+
+    string lower = wanted;
+    for (char& ch : lower)
+        ch = tolower(ch);
+
+    if (matchSAN(board, wanted, move))
+        return true;
+    for (auto& m : Bot::getAllLegalMoves(board, board.isWhiteTurn())) {
+        string san = normalize(toSAN(board, m));
+        string noEquals = san;
+        size_t eq = noEquals.find('=');
+        if (eq != string::npos) noEquals.erase(eq, 1);
+
+        string coordinate = toCoordinate(board, m);
+        if (wanted == san || wanted == noEquals || lower == coordinate || lower + "q" == coordinate) {
+            move = m;
+            return true;
+        }
+    }
+    return false;
+}
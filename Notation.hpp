@@ -0,0 +1,18 @@
+#pragma once
+#include "Board.hpp"
+#include <string>
+#include <tuple>
+using namespace std;
+
+// Converts between the bot's (fromRow, fromCol, toRow, toCol) moves and text.
+// Promotions are always to a queen, matching Bot::applyMove.
+
+// Coordinate notation, e.g. "e2e4" or "e7e8q".
+string toCoordinate(const Board& board, const tuple<int, int, int, int>& move);
+
+// Standard algebraic notation with check and mate suffixes, e.g. "Nbd7", "exd5", "O-O", "e8=Q+".
+string toSAN(Board& board, const tuple<int, int, int, int>& move);
+
+// Finds the legal move matching 'text' in either SAN or coordinate notation.
+// Check/mate suffixes and annotations ("+", "#", "!", "?") are ignored. Returns false if no legal move matches.
+bool parseMove(Board& board, const string& text, tuple<int, int, int, int>& move);
@@ -0,0 +1,470 @@
+#include "OpeningIndex.hpp"
+#include "Bot.hpp"
+#include "MappedFile.hpp"
+#include "Notation.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
+using namespace std;
+
+namespace {
+    const uint32_t MAGIC = 0x494F4743;   // "CGOI" in little-endian byte order.
+    const uint32_t VERSION = 1;
+    const size_t BATCH_GAMES = 256;      // Games parsed per thread-pool task.
+    const size_t RUN_BUFFER = 4096;      // Records read at a time from each run while merging.
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t recordCount;
+        uint32_t maxPlies;
+        uint32_t reserved[3];
+    };
+
+    struct Record {
+        uint64_t key;
+        uint32_t move;   // fromSquare * 64 + toSquare, squares numbered row * 8 + col.
+        uint32_t whiteWins;
+        uint32_t draws;
+        uint32_t blackWins;
+    };
+
+    static_assert(sizeof(Header) == 32, "index header layout");
+    static_assert(sizeof(Record) == 24, "index record layout");
+
+    bool before(const Record& a, const Record& b) {
+        return a.key != b.key ? a.key < b.key : a.move < b.move;
+    }
+
+    uint32_t encodeMove(const tuple<int, int, int, int>& move) {
+        return static_cast<uint32_t>((get<0>(move) * 8 + get<1>(move)) * 64 + get<2>(move) * 8 + get<3>(move));
+    }
+
+    tuple<int, int, int, int> decodeMove(uint32_t move) {
+        int from = static_cast<int>(move / 64), to = static_cast<int>(move % 64);
+        return { from / 8, from % 8, to / 8, to % 8 };
+    }
+
+    MappedFile file;
+    const Record* records = nullptr;
+    size_t recordCount = 0;
+
+    //---------------------------------------------------------------------
+    // PGN Parsing
+    //---------------------------------------------------------------------
+
+    // Reads the value of a tag pair line such as [Result "1-0"] into 'name' and 'value'.
+    bool parseTag(const string& line, string& name, string& value) {
+        size_t space = line.find(' ');
+        size_t open = line.find('"');
+        size_t close = line.rfind('"');
+        if (space == string::npos || open == string::npos || close <= open)
+            return false;
+        name = line.substr(1, space - 1);
+        value = line.substr(open + 1, close - open - 1);
+        return true;
+    }
+
+    // Replays one game (tag pairs, then movetext) and appends a record for each of its first
+    // 'maxPlies' moves. Comments, variations and NAGs are skipped. Returns false for games
+    // without a result or with a start position that cannot be read.
+    bool indexGame(const string& text, int maxPlies, vector<Record>& out) {
+        Record outcome = {};
+        bool hasResult = false;
+        string fen, movetext;
+        size_t pos = 0;
+        while (pos < text.size()) {
+            size_t end = text.find('\n', pos);
+            if (end == string::npos) end = text.size();
+            string line = text.substr(pos, end - pos);
+            pos = end + 1;
+            string name, value;
+            if (line.empty() || line[0] != '[') {
+                movetext += line + '\n';
+            } else if (parseTag(line, name, value)) {
+                if (name == "FEN") fen = value;
+                else if (name == "Result") {
+                    hasResult = true;
+                    if (value == "1-0") outcome.whiteWins = 1;
+                    else if (value == "0-1") outcome.blackWins = 1;
+                    else if (value == "1/2-1/2") outcome.draws = 1;
+                    else hasResult = false;
+                }
+            }
+        }
+        if (!hasResult)
+            return false;
+
+        Board board;
+        if (!fen.empty() && !board.loadFEN(fen))
+            return false;
+
+        int ply = 0;
+        int variationDepth = 0;
+        size_t i = 0;
+        while (i < movetext.size() && ply < maxPlies) {
+            char ch = movetext[i];
+            if (ch == '{') {
+                size_t close = movetext.find('}', i);
+                i = close == string::npos ? movetext.size() : close + 1;
+            } else if (ch == ';') {
+                size_t close = movetext.find('\n', i);
+                i = close == string::npos ? movetext.size() : close + 1;
+            } else if (ch == '(' || ch == ')') {
+                variationDepth += ch == '(' ? 1 : -1;
+                ++i;
+            } else if (isspace(static_cast<unsigned char>(ch))) {
+                ++i;
+            } else {
+                size_t start = i;
+                while (i < movetext.size() && !isspace(static_cast<unsigned char>(movetext[i])) &&
+                       string("{};()").find(movetext[i]) == string::npos)
+                    ++i;
+                if (variationDepth > 0)
+                    continue;
+                string token = movetext.substr(start, i - start);
+                if (token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*")
+                    break;
+                // Move numbers ("12." or "12...") may be glued to the move that follows.
+                size_t digits = token.find_first_not_of("0123456789");
+                if (digits != string::npos && digits > 0 && token[digits] == '.')
+                    token.erase(0, token.find_first_not_of('.', digits));
+                if (token.empty() || token[0] == '$' || token.find_first_not_of("0123456789.") == string::npos)
+                    continue;
+
+                tuple<int, int, int, int> move;
+                if (!parseMove(board, token, move))
+                    break;
+                Record record = outcome;
+                record.key = board.getHash();
+                record.move = encodeMove(move);
+                out.push_back(record);
+                Bot::applyMove(board, move);
+                ++ply;
+            }
+        }
+        return true;
+    }
+
+    //---------------------------------------------------------------------
+    // External Sort
+    //---------------------------------------------------------------------
+
+    // Sorts records and merges those with the same key and move.
+    void aggregate(vector<Record>& list) {
+        sort(list.begin(), list.end(), before);
+        size_t out = 0;
+        for (size_t i = 0; i < list.size(); ++i) {
+            if (out > 0 && list[out - 1].key == list[i].key && list[out - 1].move == list[i].move) {
+                list[out - 1].whiteWins += list[i].whiteWins;
+                list[out - 1].draws += list[i].draws;
+                list[out - 1].blackWins += list[i].blackWins;
+            } else {
+                list[out++] = list[i];
+            }
+        }
+        list.resize(out);
+    }
+
+    // State shared by the parsing tasks of one build.
+    struct Builder {
+        string runPrefix;
+        size_t runLimit = 0;            // Records gathered before they are spilled as a run.
+        mutex lock;
+        condition_variable changed;
+        vector<Record> pending;
+        vector<string> runs;
+        bool spilling = false;          // Only one run is written at a time, bounding memory.
+        bool failed = false;
+        size_t inFlight = 0;            // Batches submitted and not yet added.
+        atomic<long long> games{ 0 };
+        atomic<long long> skipped{ 0 };
+
+        bool writeRun(vector<Record>& run, const string& path) {
+            aggregate(run);
+            ofstream out(path, ios::binary | ios::trunc);
+            out.write(reinterpret_cast<const char*>(run.data()), static_cast<streamsize>(run.size() * sizeof(Record)));
+            if (!out) {
+                cerr << "Could not write " << path << endl;
+                return false;
+            }
+            return true;
+        }
+
+        // Adds one batch's records and spills them as a sorted run once the budget is reached.
+        void add(vector<Record>& batch) {
+            unique_lock<mutex> guard(lock);
+            changed.wait(guard, [this] { return !spilling || pending.size() < runLimit; });
+            pending.insert(pending.end(), batch.begin(), batch.end());
+            if (!spilling && pending.size() >= runLimit)
+                spill(guard);
+            --inFlight;
+            changed.notify_all();
+        }
+
+        // Writes 'pending' as a run with the lock released, so other batches keep arriving.
+        void spill(unique_lock<mutex>& guard) {
+            vector<Record> run;
+            run.swap(pending);
+            string path = runPrefix + to_string(runs.size());
+            runs.push_back(path);
+            spilling = true;
+            guard.unlock();
+            bool ok = writeRun(run, path);
+            guard.lock();
+            spilling = false;
+            failed = failed || !ok;
+        }
+    };
+
+    // Reads a run file a buffer at a time.
+    struct RunReader {
+        ifstream in;
+        vector<Record> buffer;
+        size_t pos = 0;
+
+        bool next(Record& record) {
+            if (pos == buffer.size()) {
+                buffer.resize(RUN_BUFFER);
+                in.read(reinterpret_cast<char*>(buffer.data()), static_cast<streamsize>(RUN_BUFFER * sizeof(Record)));
+                buffer.resize(static_cast<size_t>(in.gcount()) / sizeof(Record));
+                pos = 0;
+                if (buffer.empty())
+                    return false;
+            }
+            record = buffer[pos++];
+            return true;
+        }
+    };
+
+    // Merges the sorted runs into the index file, combining records for the same move.
+    bool mergeRuns(const vector<string>& runs, const string& path, int maxPlies, uint64_t& count) {
+        vector<unique_ptr<RunReader>> readers;
+        for (auto& run : runs) {
+            readers.push_back(make_unique<RunReader>());
+            readers.back()->in.open(run, ios::binary);
+            if (!readers.back()->in) {
+                cerr << "Could not read " << run << endl;
+                return false;
+            }
+        }
+        ofstream out(path, ios::binary | ios::trunc);
+        Header header = {};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        auto later = [](const pair<Record, size_t>& a, const pair<Record, size_t>& b) { return before(b.first, a.first); };
+        priority_queue<pair<Record, size_t>, vector<pair<Record, size_t>>, decltype(later)> heads(later);
+        for (size_t i = 0; i < readers.size(); ++i) {
+            Record record;
+            if (readers[i]->next(record))
+                heads.push({ record, i });
+        }
+
+        count = 0;
+        bool haveCurrent = false;
+        Record current = {};
+        while (!heads.empty()) {
+            auto [record, source] = heads.top();
+            heads.pop();
+            Record following;
+            if (readers[source]->next(following))
+                heads.push({ following, source });
+            if (haveCurrent && current.key == record.key && current.move == record.move) {
+                current.whiteWins += record.whiteWins;
+                current.draws += record.draws;
+                current.blackWins += record.blackWins;
+                continue;
+            }
+            if (haveCurrent) {
+                out.write(reinterpret_cast<const char*>(&current), sizeof(current));
+                ++count;
+            }
+            current = record;
+            haveCurrent = true;
+        }
+        if (haveCurrent) {
+            out.write(reinterpret_cast<const char*>(&current), sizeof(current));
+            ++count;
+        }
+
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.recordCount = count;
+        header.maxPlies = static_cast<uint32_t>(maxPlies);
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        if (!out) {
+            cerr << "Could not write " << path << endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+//---------------------------------------------------------------------
+// Building
+//---------------------------------------------------------------------
+// The calling thread reads the PGN files line by line and cuts them into batches of games;
+// the pool's workers replay the batches and hand their records to the Builder. At most two
+// batches per worker are in flight, so a fast reader cannot run ahead of the parsers.
+bool OpeningIndex::build(const vector<string>& pgnPaths, const string& outPath, const BuildOptions& options,
+                         ostream& log) {
+    string tempDir = options.tempDir;
+    if (tempDir.empty()) {
+        size_t slash = outPath.find_last_of("/\\");
+        tempDir = slash == string::npos ? "." : outPath.substr(0, slash);
+    }
+    size_t slash = outPath.find_last_of("/\\");
+    string baseName = slash == string::npos ? outPath : outPath.substr(slash + 1);
+
+    Builder builder;
+    builder.runPrefix = tempDir + "/" + baseName + ".run";
+    builder.runLimit = max<size_t>(1, (max<size_t>(options.memoryMb, 1) << 20) / 2 / sizeof(Record));
+
+    ThreadPool pool(options.threads);
+    size_t maxInFlight = pool.size() * 2;
+    auto submit = [&](vector<string>& batch) {
+        {
+            unique_lock<mutex> guard(builder.lock);
+            builder.changed.wait(guard, [&] { return builder.inFlight < maxInFlight; });
+            ++builder.inFlight;
+        }
+        pool.submit([&builder, &options, games = move(batch)] {
+            vector<Record> batchRecords;
+            for (auto& game : games) {
+                if (indexGame(game, options.maxPlies, batchRecords))
+                    ++builder.games;
+                else
+                    ++builder.skipped;
+            }
+            builder.add(batchRecords);
+        });
+        batch.clear();
+    };
+
+    bool ok = true;
+    vector<string> batch;
+    for (auto& path : pgnPaths) {
+        ifstream in(path);
+        if (!in) {
+            cerr << "Could not open PGN file: " << path << endl;
+            ok = false;
+            break;
+        }
+        string game, line;
+        bool inMovetext = false;
+        while (getline(in, line)) {
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            if (!line.empty() && line[0] == '%')
+                continue;   // Escaped line.
+            bool tag = !line.empty() && line[0] == '[';
+            if (tag && inMovetext) {
+                batch.push_back(move(game));
+                game.clear();
+                inMovetext = false;
+                if (batch.size() == BATCH_GAMES)
+                    submit(batch);
+            }
+            if (!tag && !line.empty())
+                inMovetext = true;
+            game += line;
+            game += '\n';
+        }
+        if (inMovetext)
+            batch.push_back(move(game));
+    }
+    if (!batch.empty())
+        submit(batch);
+    pool.wait();
+
+    if (ok && !builder.failed && !builder.pending.empty()) {
+        string path = builder.runPrefix + to_string(builder.runs.size());
+        builder.runs.push_back(path);
+        ok = builder.writeRun(builder.pending, path);
+        vector<Record>().swap(builder.pending);
+    }
+    ok = ok && !builder.failed;
+
+    uint64_t count = 0;
+    string tempPath = outPath + ".tmp";
+    if (ok)
+        ok = mergeRuns(builder.runs, tempPath, options.maxPlies, count);
+    for (auto& run : builder.runs)
+        remove(run.c_str());
+    if (ok) {
+        remove(outPath.c_str());
+        ok = rename(tempPath.c_str(), outPath.c_str()) == 0;
+        if (!ok)
+            cerr << "Could not create " << outPath << endl;
+    }
+    if (!ok) {
+        remove(tempPath.c_str());
+        return false;
+    }
+    log << "Indexed " << builder.games << " games (" << builder.skipped << " skipped) into " << count
+        << " position-move records from " << builder.runs.size() << " sorted runs: " << outPath << endl;
+    return true;
+}
+
+//---------------------------------------------------------------------
+// Lookups
+//---------------------------------------------------------------------
+bool OpeningIndex::open(const string& path) {
+    close();
+    if (!file.openReadOnly(path))
+        return false;
+    const Header* header = static_cast<const Header*>(file.data());
+    if (file.size() < sizeof(Header) || header->magic != MAGIC || header->version != VERSION ||
+        file.size() != sizeof(Header) + header->recordCount * sizeof(Record)) {
+        cerr << "Not an opening index file: " << path << endl;
+        file.close();
+        return false;
+    }
+    records = reinterpret_cast<const Record*>(static_cast<const char*>(file.data()) + sizeof(Header));
+    recordCount = static_cast<size_t>(header->recordCount);
+    return true;
+}
+
+bool OpeningIndex::isOpen() {
+    return records != nullptr;
+}
+
+void OpeningIndex::close() {
+    records = nullptr;
+    recordCount = 0;
+    file.close();
+}
+
+// Records are sorted by key, so the position's moves are one contiguous range. A move that is
+// not legal here belongs to a different position with the same key and is left out.
+vector<OpeningIndex::MoveStats> OpeningIndex::lookup(Board& board) {
+    vector<MoveStats> moves;
+    if (!records)
+        return moves;
+    uint64_t key = board.getHash();
+    const Record* end = records + recordCount;
+    const Record* it = lower_bound(records, end, key, [](const Record& r, uint64_t k) { return r.key < k; });
+    const auto& legal = board.legalMoves();
+    for (; it != end && it->key == key; ++it) {
+        MoveStats stats;
+        stats.move = decodeMove(it->move);
+        if (find(legal.begin(), legal.end(), stats.move) == legal.end())
+            continue;
+        stats.whiteWins = it->whiteWins;
+        stats.draws = it->draws;
+        stats.blackWins = it->blackWins;
+        moves.push_back(stats);
+    }
+    stable_sort(moves.begin(), moves.end(),
+                [](const MoveStats& a, const MoveStats& b) { return a.games() > b.games(); });
+    return moves;
+}
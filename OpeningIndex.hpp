@@ -0,0 +1,57 @@
+#pragma once
+#include "Board.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <tuple>
+#include <vector>
+using namespace std;
+
+// Opening explorer: for every position reached in the first plies of a PGN collection, which
+// moves were played there and how the games went.
+//
+// The index is built once from any number of PGN files and stored as a sorted array of
+// (position key, move, white wins, draws, black wins) records, which is memory-mapped
+// read-only and searched by binary search, so lookups cost a few page touches however large
+// the database was. Building streams the games through a thread pool in batches and spills
+// sorted runs to temporary files whenever the records in memory reach a budget, then merges
+// the runs; memory use is bounded by the budget, not by the size of the database.
+//
+// File layout (native byte order): a 32-byte header ("CGOI", uint32 version 1, uint64 record
+// count, uint32 indexed plies) followed by the records sorted by key, then move.
+namespace OpeningIndex {
+    struct MoveStats {
+        tuple<int, int, int, int> move;
+        uint32_t whiteWins = 0;
+        uint32_t draws = 0;
+        uint32_t blackWins = 0;
+
+        uint32_t games() const { return whiteWins + draws + blackWins; }
+        // Points per game for the side that played the move, from 0 to 1.
+        double score(bool white) const {
+            return games() ? ((white ? whiteWins : blackWins) + 0.5 * draws) / games() : 0.0;
+        }
+    };
+
+    struct BuildOptions {
+        int maxPlies = 30;          // Positions after this many plies are not indexed.
+        unsigned threads = 0;       // Parsing threads; zero means one per hardware thread.
+        size_t memoryMb = 256;      // Records kept in memory before a sorted run is spilled.
+        string tempDir;             // Where runs are spilled; defaults to the output's directory.
+    };
+
+    // Builds an index from the PGN files into 'outPath', replacing it only once complete.
+    // Games without a result ("*") are skipped, and a game stops being indexed at the first
+    // move that cannot be read. Returns false if a file could not be read or written.
+    bool build(const vector<string>& pgnPaths, const string& outPath, const BuildOptions& options,
+               ostream& log);
+
+    // Maps an index for lookups. Returns false (and stays closed) on failure.
+    bool open(const string& path);
+    bool isOpen();
+    void close();
+
+    // Moves played in the board's position that are legal there, most played first.
+    vector<MoveStats> lookup(Board& board);
+}
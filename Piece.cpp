@@ -1,8 +1,22 @@
 #include "Piece.hpp"
 #include "Board.hpp"
 #include <cmath>
+#include <cctype>
 using namespace std;
 
+Piece* createPiece(char symbol) {
+    bool white = isupper(static_cast<unsigned char>(symbol)) != 0;
+    switch (toupper(static_cast<unsigned char>(symbol))) {
+        case 'P': return new Pawn(white);
+        case 'R': return new Rook(white);
+        case 'N': return new Knight(white);
+        case 'B': return new Bishop(white);
+        case 'Q': return new Queen(white);
+        case 'K': return new King(white);
+        default: return nullptr;
+    }
+}
+
 vector<pair<int, int>> Pawn::getLegalMoves(int row, int col, const Board& board) const {
     vector<pair<int, int>> moves;
     int dir = white ? -1 : 1;
@@ -65,3 +65,6 @@ public:
     std::vector<std::pair<int, int>> getLegalMoves(int row, int col, const Board& board) const override;
     Piece* clone() const override { return new King(*this); }
 };
+
+// Creates a piece from its FEN symbol ('P', 'n', ...). Returns nullptr for unknown symbols.
+Piece* createPiece(char symbol);
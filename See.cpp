@@ -0,0 +1,104 @@
+#include "See.hpp"
+#include "Piece.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+using namespace std;
+
+namespace {
+    int seeValue(const Piece* piece) {
+        switch (toupper(piece->getSymbol())) {
+            case 'P': return 100;
+            case 'N': return 300;
+            case 'B': return 300;
+            case 'R': return 500;
+            case 'Q': return 900;
+            default: return 20000;
+        }
+    }
+
+    uint64_t bit(int row, int col) {
+        return 1ULL << (row * 8 + col);
+    }
+
+    // Finds the least valuable piece of the given colour attacking (row, col), counting only
+    // pieces still in 'occupied'. Sliders look through squares removed from 'occupied', which is
+    // how x-ray attackers appear once the pieces in front of them have captured.
+    bool leastValuableAttacker(const Board& board, uint64_t occupied, int row, int col, bool white,
+                               int& fromRow, int& fromCol, int& value) {
+        value = 0;
+        auto consider = [&](int r, int c, const char* types) {
+            if (r < 0 || r > 7 || c < 0 || c > 7 || !(occupied & bit(r, c)))
+                return;
+            const Piece* piece = board.getPiece(r, c);
+            if (!piece || piece->isWhite() != white)
+                return;
+            char type = static_cast<char>(toupper(piece->getSymbol()));
+            for (const char* t = types; *t; ++t) {
+                if (*t == type && (value == 0 || seeValue(piece) < value)) {
+                    value = seeValue(piece);
+                    fromRow = r;
+                    fromCol = c;
+                }
+            }
+        };
+
+        int pawnRow = white ? row + 1 : row - 1;   // Pawns capture towards the enemy side.
+        consider(pawnRow, col - 1, "P");
+        consider(pawnRow, col + 1, "P");
+        static const int jumps[8][2] = { {-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1} };
+        for (auto& j : jumps)
+            consider(row + j[0], col + j[1], "N");
+        static const int lines[8][2] = { {-1, -1}, {-1, 1}, {1, -1}, {1, 1}, {-1, 0}, {1, 0}, {0, -1}, {0, 1} };
+        for (int d = 0; d < 8; ++d) {
+            const char* sliders = d < 4 ? "BQ" : "RQ";
+            consider(row + lines[d][0], col + lines[d][1], "K");
+            int r = row + lines[d][0], c = col + lines[d][1];
+            while (r >= 0 && r < 8 && c >= 0 && c < 8 && !(occupied & bit(r, c))) {
+                r += lines[d][0];
+                c += lines[d][1];
+            }
+            consider(r, c, sliders);
+        }
+        return value > 0;
+    }
+}
+
+int staticExchange(const Board& board, const tuple<int, int, int, int>& move) {
+    int fromRow = get<0>(move), fromCol = get<1>(move), toRow = get<2>(move), toCol = get<3>(move);
+    const Piece* mover = board.getPiece(fromRow, fromCol);
+    const Piece* victim = board.getPiece(toRow, toCol);
+
+    uint64_t occupied = 0;
+    for (int r = 0; r < 8; ++r)
+        for (int c = 0; c < 8; ++c)
+            if (board.getPiece(r, c))
+                occupied |= bit(r, c);
+
+    int gain[32];
+    int d = 0;
+    gain[0] = victim ? seeValue(victim) : 0;
+    if (!victim && toupper(mover->getSymbol()) == 'P' && fromCol != toCol) {
+        gain[0] = 100;   // En passant: the captured pawn is beside the mover, not on the target.
+        occupied &= ~bit(fromRow, toCol);
+    }
+    occupied &= ~bit(fromRow, fromCol);
+
+    // Swap list: gain[d] is what the side making capture d has gained if the exchange stops there.
+    int attackerValue = seeValue(mover);
+    bool side = !mover->isWhite();
+    while (d < 31) {
+        ++d;
+        gain[d] = attackerValue - gain[d - 1];
+        if (max(-gain[d - 1], gain[d]) < 0)
+            break;   // Neither side can change the outcome by going on.
+        int r, c;
+        if (!leastValuableAttacker(board, occupied, toRow, toCol, side, r, c, attackerValue))
+            break;
+        occupied &= ~bit(r, c);
+        side = !side;
+    }
+    while (--d)
+        gain[d - 1] = -max(-gain[d - 1], gain[d]);
+    return gain[0];
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "Board.hpp"
+#include <tuple>
+using namespace std;
+
+// Static exchange evaluation: the material, in centipawns, that the side to move gains by
+// playing the capture 'move' and then letting both sides keep recapturing on that square with
+// their least valuable attacker, each side free to stop when continuing would cost it.
+// Attackers hidden behind other attackers on the same line (x-rays) join in as the pieces in
+// front of them are used up. Pins and checks are ignored. Quiet moves score 0, or the loss of
+// the moving piece if it can simply be taken.
+int staticExchange(const Board& board, const tuple<int, int, int, int>& move);
@@ -0,0 +1,267 @@
+#include "SelfPlay.hpp"
+#include "Epd.hpp"
+#include "Notation.hpp"
+#include "ThreadPool.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+using namespace std;
+
+//---------------------------------------------------------------------
+// Playing a Single Game
+//---------------------------------------------------------------------
+
+namespace {
+    struct GameRecord {
+        int round = 0;
+        string white, black;
+        string startFen;            // Empty for the standard starting position.
+        int startMoveNumber = 1;
+        bool startsWithBlack = false;
+        vector<string> moves;       // SAN.
+        string result;              // "1-0", "0-1" or "1/2-1/2".
+        string termination;
+        double firstEngineScore = 0.5;
+    };
+
+    GameRecord playGame(const TournamentOptions& options, const string& fen, bool firstIsWhite, int round) {
+        GameRecord game;
+        game.round = round;
+        const EngineConfig& white = options.engines[firstIsWhite ? 0 : 1];
+        const EngineConfig& black = options.engines[firstIsWhite ? 1 : 0];
+        game.white = white.name;
+        game.black = black.name;
+
+        Board board;
+        if (!fen.empty() && board.loadFEN(fen))
+            game.startFen = board.toFEN();
+        game.startMoveNumber = board.getFullmoveNumber();
+        game.startsWithBlack = !board.isWhiteTurn();
+
+        long long clock[2] = { options.timeControl.baseMs, options.timeControl.baseMs };
+        double whiteScore = -1;
+
+        while (true) {
+            bool whiteToMove = board.isWhiteTurn();
+            switch (board.status()) {
+                case GameStatus::Checkmate:
+                    whiteScore = whiteToMove ? 0.0 : 1.0;
+                    game.termination = "checkmate";
+                    break;
+                case GameStatus::Stalemate: whiteScore = 0.5; game.termination = "stalemate"; break;
+                case GameStatus::DrawByFiftyMoves: whiteScore = 0.5; game.termination = "fifty-move rule"; break;
+                case GameStatus::DrawByRepetition: whiteScore = 0.5; game.termination = "threefold repetition"; break;
+                case GameStatus::DrawByInsufficientMaterial: whiteScore = 0.5; game.termination = "insufficient material"; break;
+                default: break;
+            }
+            if (whiteScore < 0 && static_cast<int>(game.moves.size()) >= options.maxPlies) {
+                whiteScore = 0.5;
+                game.termination = "adjudicated draw";
+            }
+            if (whiteScore >= 0)
+                break;
+
+            const EngineConfig& engine = whiteToMove ? white : black;
+            SearchLimits limits = engine.limits;
+            limits.randomize = limits.randomize || options.openingsPath.empty();
+            limits.useAnalysisCache = false;   // Each game must be decided by the engines alone.
+            long long& remaining = clock[whiteToMove ? 0 : 1];
+            if (options.timeControl.baseMs > 0) {
+                long long budget = remaining / 30 + options.timeControl.incrementMs * 3 / 4;
+                budget = max(1LL, min(budget, remaining - 10));
+                limits.movetimeMs = limits.movetimeMs > 0 ? min<long long>(limits.movetimeMs, budget) : budget;
+            }
+
+            auto start = chrono::steady_clock::now();
+            SearchResult result = Bot::search(board, limits);
+            long long usedMs = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+
+            if (options.timeControl.baseMs > 0) {
+                remaining -= usedMs;
+                if (remaining < 0) {
+                    whiteScore = whiteToMove ? 0.0 : 1.0;
+                    game.termination = "time forfeit";
+                    break;
+                }
+                remaining += options.timeControl.incrementMs;
+            }
+
+            game.moves.push_back(toSAN(board, result.bestMove));
+            Bot::applyMove(board, result.bestMove);
+        }
+
+        game.result = whiteScore == 1.0 ? "1-0" : whiteScore == 0.0 ? "0-1" : "1/2-1/2";
+        game.firstEngineScore = firstIsWhite ? whiteScore : 1.0 - whiteScore;
+        return game;
+    }
+
+    void writePgn(ostream& out, const GameRecord& game, const TournamentOptions& options) {
+        char date[16];
+        time_t now = time(nullptr);
+        strftime(date, sizeof(date), "%Y.%m.%d", localtime(&now));
+
+        out << "[Event \"Self-play\"]\n"
+            << "[Site \"ChessGame\"]\n"
+            << "[Date \"" << date << "\"]\n"
+            << "[Round \"" << game.round << "\"]\n"
+            << "[White \"" << game.white << "\"]\n"
+            << "[Black \"" << game.black << "\"]\n"
+            << "[Result \"" << game.result << "\"]\n";
+        if (!game.startFen.empty())
+            out << "[SetUp \"1\"]\n[FEN \"" << game.startFen << "\"]\n";
+        if (options.timeControl.baseMs > 0)
+            out << "[TimeControl \"" << options.timeControl.baseMs / 1000.0 << "+"
+                << options.timeControl.incrementMs / 1000.0 << "\"]\n";
+        out << "[Termination \"" << game.termination << "\"]\n\n";
+
+        // Movetext wrapped at 80 columns.
+        string line;
+        int moveNumber = game.startMoveNumber;
+        bool whiteMove = !game.startsWithBlack;
+        auto emit = [&](const string& token) {
+            if (line.size() + token.size() + 1 > 80) {
+                out << line << '\n';
+                line.clear();
+            }
+            line += (line.empty() ? "" : " ") + token;
+        };
+        for (size_t i = 0; i < game.moves.size(); ++i) {
+            if (whiteMove)
+                emit(to_string(moveNumber) + ".");
+            else if (i == 0)
+                emit(to_string(moveNumber) + "...");
+            emit(game.moves[i]);
+            if (!whiteMove) ++moveNumber;
+            whiteMove = !whiteMove;
+        }
+        emit(game.result);
+        out << line << "\n\n";
+    }
+}
+
+//---------------------------------------------------------------------
+// Statistics
+//---------------------------------------------------------------------
+
+namespace {
+    double eloFromScore(double score) {
+        score = min(max(score, 1e-6), 1.0 - 1e-6);
+        return 400.0 * log10(score / (1.0 - score));
+    }
+
+    double scoreFromElo(double elo) {
+        return 1.0 / (1.0 + pow(10.0, -elo / 400.0));
+    }
+
+    // Mean and per-game variance of the score.
+    void scoreMoments(int wins, int draws, int losses, double& mean, double& variance) {
+        double n = wins + draws + losses;
+        mean = (wins + 0.5 * draws) / n;
+        variance = (wins * pow(1.0 - mean, 2) + draws * pow(0.5 - mean, 2) + losses * pow(mean, 2)) / n;
+    }
+}
+
+void estimateElo(int wins, int draws, int losses, double& elo, double& error) {
+    elo = error = 0.0;
+    if (wins + draws + losses == 0)
+        return;
+    double mean, variance;
+    scoreMoments(wins, draws, losses, mean, variance);
+    double margin = 1.96 * sqrt(variance / (wins + draws + losses));
+    elo = eloFromScore(mean);
+    error = (eloFromScore(mean + margin) - eloFromScore(mean - margin)) / 2.0;
+}
+
+double sprtLlr(int wins, int draws, int losses, double elo0, double elo1) {
+    int n = wins + draws + losses;
+    if (n == 0 || wins + losses == 0)
+        return 0.0;
+    double mean, variance;
+    scoreMoments(wins, draws, losses, mean, variance);
+    if (variance <= 0.0)
+        return 0.0;
+    double s0 = scoreFromElo(elo0), s1 = scoreFromElo(elo1);
+    return n * (s1 - s0) * (2.0 * mean - s0 - s1) / (2.0 * variance);
+}
+
+//---------------------------------------------------------------------
+// Tournament Driver
+//---------------------------------------------------------------------
+
+TournamentResult runTournament(const TournamentOptions& options, ostream& out) {
+    vector<string> openings;
+    if (!options.openingsPath.empty()) {
+        vector<EpdPosition> positions;
+        if (!loadEpdFile(options.openingsPath, positions))
+            cerr << "Could not open openings file: " << options.openingsPath << endl;
+        for (auto& p : positions)
+            openings.push_back(p.fen);
+    }
+    if (openings.empty())
+        openings.push_back("");
+
+    ofstream pgn;
+    if (!options.pgnPath.empty()) {
+        pgn.open(options.pgnPath);
+        if (!pgn)
+            cerr << "Could not open PGN output: " << options.pgnPath << endl;
+    }
+
+    double lowerBound = log(options.beta / (1.0 - options.alpha));
+    double upperBound = log((1.0 - options.beta) / options.alpha);
+
+    TournamentResult result;
+    mutex resultLock;
+    atomic<bool> stop(false);
+    int finished = 0;
+
+    ThreadPool pool(options.concurrency);
+    for (int g = 0; g < options.games; ++g) {
+        pool.submit([&, g] {
+            if (stop)
+                return;
+            const string& fen = openings[(g / 2) % openings.size()];
+            GameRecord game = playGame(options, fen, g % 2 == 0, g + 1);
+
+            lock_guard<mutex> guard(resultLock);
+            if (game.firstEngineScore == 1.0) ++result.wins;
+            else if (game.firstEngineScore == 0.0) ++result.losses;
+            else ++result.draws;
+            ++finished;
+
+            estimateElo(result.wins, result.draws, result.losses, result.elo, result.eloError);
+            if (options.sprt && result.sprtVerdict.empty()) {
+                result.llr = sprtLlr(result.wins, result.draws, result.losses, options.elo0, options.elo1);
+                if (result.llr >= upperBound) result.sprtVerdict = "H1 accepted";
+                else if (result.llr <= lowerBound) result.sprtVerdict = "H0 accepted";
+                if (!result.sprtVerdict.empty()) stop = true;
+            }
+
+            out << "Game " << finished << "/" << options.games << " (round " << game.round << "): "
+                << game.white << " - " << game.black << " " << game.result << " {" << game.termination << "}"
+                << "  +" << result.wins << " =" << result.draws << " -" << result.losses
+                << fixed << setprecision(1) << "  Elo " << result.elo << " +/- " << result.eloError;
+            if (options.sprt)
+                out << setprecision(2) << "  LLR " << result.llr << " [" << lowerBound << ", " << upperBound << "]";
+            out << endl;
+
+            if (pgn)
+                writePgn(pgn, game, options);
+        });
+    }
+    pool.wait();
+
+    out << "\n" << options.engines[0].name << " vs " << options.engines[1].name << ": "
+        << result.wins << " wins, " << result.draws << " draws, " << result.losses << " losses\n"
+        << fixed << setprecision(1) << "Elo difference " << result.elo << " +/- " << result.eloError << " (95%)" << endl;
+    if (options.sprt)
+        out << "SPRT [" << options.elo0 << ", " << options.elo1 << "]: LLR " << setprecision(2) << result.llr << " - "
+            << (result.sprtVerdict.empty() ? "inconclusive" : result.sprtVerdict) << endl;
+    return result;
+}
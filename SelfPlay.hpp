@@ -0,0 +1,52 @@
+#pragma once
+#include "Bot.hpp"
+#include <iosfwd>
+#include <string>
+using namespace std;
+
+// One side of a self-play match: a name for the PGN and the search limits it plays with.
+struct EngineConfig {
+    string name;
+    SearchLimits limits;
+};
+
+// Per-game clock for each side. A zero base means the engines only use their own limits.
+struct TimeControl {
+    int baseMs = 0;
+    int incrementMs = 0;
+};
+
+struct TournamentOptions {
+    EngineConfig engines[2];
+    TimeControl timeControl;
+    int games = 100;
+    unsigned concurrency = 0;   // Games played at once; zero means one per hardware thread.
+    string openingsPath;        // FEN/EPD lines; each opening is played twice with colours swapped.
+    string pgnPath;             // Where to write the games; empty for none.
+    int maxPlies = 400;         // Longer games are adjudicated as draws.
+
+    // Sequential probability ratio test of H0: elo = elo0 against H1: elo = elo1,
+    // where elo is engine[0]'s strength relative to engine[1].
+    bool sprt = false;
+    double elo0 = 0.0, elo1 = 5.0;
+    double alpha = 0.05, beta = 0.05;
+};
+
+// Totals from engine[0]'s point of view.
+struct TournamentResult {
+    int wins = 0, draws = 0, losses = 0;
+    double elo = 0.0;
+    double eloError = 0.0;   // Half-width of the 95% confidence interval.
+    double llr = 0.0;
+    string sprtVerdict;      // "H0 accepted", "H1 accepted" or empty when undecided.
+};
+
+// Plays the match on a thread pool, printing a line per finished game.
+// Stops early when the SPRT reaches a verdict.
+TournamentResult runTournament(const TournamentOptions& options, ostream& out);
+
+// Elo difference and 95% error bar for a win/draw/loss record.
+void estimateElo(int wins, int draws, int losses, double& elo, double& error);
+
+// Log-likelihood ratio of the SPRT for a win/draw/loss record (normal approximation).
+double sprtLlr(int wins, int draws, int losses, double elo0, double elo1);
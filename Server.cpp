@@ -0,0 +1,618 @@
+#include "Server.hpp"
+#include "Bot.hpp"
+#include "Notation.hpp"
+#include "ThreadPool.hpp"
+#include "TranspositionTable.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace {
+    //---------------------------------------------------------------------
+    // Socket Portability
+    //---------------------------------------------------------------------
+#ifdef _WIN32
+    using Socket = SOCKET;
+    const Socket NO_SOCKET = INVALID_SOCKET;
+    int pollSockets(pollfd* fds, size_t count, int timeoutMs) { return WSAPoll(fds, ULONG(count), timeoutMs); }
+    void closeSocket(Socket s) { closesocket(s); }
+    bool wouldBlock() { return WSAGetLastError() == WSAEWOULDBLOCK; }
+    void setNonBlocking(Socket s) { u_long on = 1; ioctlsocket(s, FIONBIO, &on); }
+#else
+    using Socket = int;
+    const Socket NO_SOCKET = -1;
+    int pollSockets(pollfd* fds, size_t count, int timeoutMs) { return poll(fds, nfds_t(count), timeoutMs); }
+    void closeSocket(Socket s) { close(s); }
+    bool wouldBlock() { return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR; }
+    void setNonBlocking(Socket s) { fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK); }
+#endif
+
+#ifdef MSG_NOSIGNAL
+    const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+    const int SEND_FLAGS = 0;
+#endif
+
+    // Per-connection buffer limits: a longer command line, or more unread replies, than this
+    // means a broken or hostile client and the connection is dropped.
+    const size_t MAX_LINE = 4096;
+    const size_t MAX_OUTPUT = 1 << 20;
+
+    // The shared hash table is aged after this many finished searches, so entries from games
+    // long gone give way to current ones.
+    const int AGE_INTERVAL = 64;
+
+    Socket openListener(const ServerOptions& options, string& description) {
+#ifndef _WIN32
+        if (!options.socketPath.empty()) {
+            sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            if (options.socketPath.size() >= sizeof(addr.sun_path)) {
+                cerr << "Socket path too long: " << options.socketPath << endl;
+                return NO_SOCKET;
+            }
+            strcpy(addr.sun_path, options.socketPath.c_str());
+            unlink(addr.sun_path);
+            Socket s = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (s == NO_SOCKET || bind(s, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+                listen(s, SOMAXCONN) != 0) {
+                cerr << "Could not listen on " << options.socketPath << ": " << strerror(errno) << endl;
+                if (s != NO_SOCKET)
+                    closeSocket(s);
+                return NO_SOCKET;
+            }
+            setNonBlocking(s);
+            description = options.socketPath;
+            return s;
+        }
+#endif
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(static_cast<uint16_t>(options.port));
+        if (inet_pton(AF_INET, options.host.c_str(), &addr.sin_addr) != 1) {
+            cerr << "Bad host address: " << options.host << endl;
+            return NO_SOCKET;
+        }
+        Socket s = socket(AF_INET, SOCK_STREAM, 0);
+        int on = 1;
+        if (s != NO_SOCKET)
+            setsockopt(s, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&on), sizeof(on));
+        if (s == NO_SOCKET || bind(s, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            listen(s, SOMAXCONN) != 0) {
+            cerr << "Could not listen on " << options.host << ":" << options.port << endl;
+            if (s != NO_SOCKET)
+                closeSocket(s);
+            return NO_SOCKET;
+        }
+        setNonBlocking(s);
+        description = options.host + ":" + to_string(options.port);
+        return s;
+    }
+
+    // A UDP socket connected to itself. Search threads send it a byte when they finish so
+    // the poll loop wakes up; this works the same on every platform, unlike a pipe.
+    Socket openWakeSocket() {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(addr);
+        Socket s = socket(AF_INET, SOCK_DGRAM, 0);
+        if (s == NO_SOCKET || bind(s, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            getsockname(s, reinterpret_cast<sockaddr*>(&addr), &length) != 0 ||
+            connect(s, reinterpret_cast<sockaddr*>(&addr), length) != 0) {
+            if (s != NO_SOCKET)
+                closeSocket(s);
+            return NO_SOCKET;
+        }
+        setNonBlocking(s);
+        return s;
+    }
+
+    string statusName(GameStatus status) {
+        switch (status) {
+            case GameStatus::Ongoing: return "ongoing";
+            case GameStatus::Check: return "check";
+            case GameStatus::Checkmate: return "checkmate";
+            case GameStatus::Stalemate: return "stalemate";
+            default: return "draw";
+        }
+    }
+
+    //---------------------------------------------------------------------
+    // Sessions and Connections
+    //---------------------------------------------------------------------
+    enum class SearchState { Idle, Queued, Running };
+
+    // One game. Its memory is bounded: the board's history grows by one entry per ply and
+    // the ply count is capped by ServerOptions::maxPlies.
+    struct Session {
+        int id = 0;
+        int connection = 0;
+        Board board;
+        bool clientWhite = true;
+        int movetimeMs = 0;
+        int plies = 0;
+        SearchState state = SearchState::Idle;
+        bool analysing = false;      // The pending search reports its move instead of playing it.
+        int searchMovetimeMs = 0;
+        bool closed = false;         // Closed while searching; freed when the search returns.
+        atomic<bool> stop{ false };
+    };
+
+    struct Connection {
+        Socket socket = NO_SOCKET;
+        string input;
+        string output;
+        vector<int> sessions;
+        bool closing = false;   // Close once the pending output has been sent.
+        bool dead = false;      // Close now.
+    };
+
+    struct Completion {
+        int session;
+        SearchResult result;
+    };
+
+    class Server {
+    public:
+        Server(const ServerOptions& options, ostream& log)
+            : options(options), log(log), pool(options.threads), table(options.hashMb) {}
+
+        bool run();
+
+    private:
+        void acceptConnections();
+        void readFrom(Connection& connection, int id);
+        void writeTo(Connection& connection);
+        void handleLine(int connectionId, const string& line);
+        void reply(int connectionId, const string& text);
+
+        Session* findSession(int connectionId, istringstream& in);
+        void queueSearch(Session& session, bool analyse, int movetimeMs);
+        void dispatchSearches();
+        void finishSearches();
+        bool reportGameOver(Session& session);
+        void closeSession(int id);
+        void dropConnection(int id);
+
+        const ServerOptions& options;
+        ostream& log;
+        ThreadPool pool;
+        TranspositionTable table;
+        Socket listener = NO_SOCKET;
+        Socket wake = NO_SOCKET;
+
+        map<int, Connection> connections;
+        map<int, unique_ptr<Session>> sessions;
+        int nextConnectionId = 1;
+        int nextSessionId = 1;
+        bool shuttingDown = false;
+
+        deque<int> runQueue;    // Sessions waiting for a search thread, oldest first.
+        size_t running = 0;     // Searches handed to the pool and not yet finished.
+        long long finishedSearches = 0;
+        mutex completionLock;
+        vector<Completion> completions;
+    };
+
+    //---------------------------------------------------------------------
+    // Poll Loop
+    //---------------------------------------------------------------------
+    bool Server::run() {
+        string description;
+        listener = openListener(options, description);
+        if (listener == NO_SOCKET)
+            return false;
+        wake = openWakeSocket();
+        if (wake == NO_SOCKET) {
+            cerr << "Could not create the wakeup socket" << endl;
+            closeSocket(listener);
+            return false;
+        }
+        log << "Listening on " << description << " with " << pool.size() << " search threads and a "
+            << (table.sizeInBytes() >> 20) << " MB hash table" << endl;
+
+        vector<pollfd> fds;
+        vector<int> ids;
+        while (!shuttingDown) {
+            fds.clear();
+            ids.clear();
+            fds.push_back({ listener, POLLIN, 0 });
+            fds.push_back({ wake, POLLIN, 0 });
+            for (auto& entry : connections) {
+                short events = entry.second.output.empty() ? POLLIN : POLLIN | POLLOUT;
+                fds.push_back({ entry.second.socket, events, 0 });
+                ids.push_back(entry.first);
+            }
+            if (pollSockets(fds.data(), fds.size(), -1) < 0 && !wouldBlock()) {
+                cerr << "poll failed" << endl;
+                break;
+            }
+
+            if (fds[1].revents & POLLIN) {
+                char buffer[64];
+                while (recv(wake, buffer, sizeof(buffer), 0) > 0) {}
+            }
+            finishSearches();
+            if (fds[0].revents & POLLIN)
+                acceptConnections();
+            for (size_t i = 0; i < ids.size(); ++i) {
+                auto it = connections.find(ids[i]);
+                if (it == connections.end())
+                    continue;
+                short events = fds[i + 2].revents;
+                if (events & (POLLIN | POLLHUP | POLLERR))
+                    readFrom(it->second, ids[i]);
+                if (!it->second.dead && (events & POLLOUT))
+                    writeTo(it->second);
+            }
+            dispatchSearches();
+
+            for (auto it = connections.begin(); it != connections.end();) {
+                int id = it->first;
+                bool drop = it->second.dead || (it->second.closing && it->second.output.empty());
+                ++it;
+                if (drop)
+                    dropConnection(id);
+            }
+        }
+
+        // Abandon running searches and let the workers drain before the sockets go away.
+        for (auto& entry : sessions)
+            entry.second->stop = true;
+        runQueue.clear();
+        pool.wait();
+        while (!connections.empty())
+            dropConnection(connections.begin()->first);
+        closeSocket(wake);
+        closeSocket(listener);
+#ifndef _WIN32
+        if (!options.socketPath.empty())
+            unlink(options.socketPath.c_str());
+#endif
+        log << "Server stopped" << endl;
+        return true;
+    }
+
+    void Server::acceptConnections() {
+        while (true) {
+            Socket s = accept(listener, nullptr, nullptr);
+            if (s == NO_SOCKET)
+                return;
+            setNonBlocking(s);
+            Connection& connection = connections[nextConnectionId++];
+            connection.socket = s;
+        }
+    }
+
+    void Server::readFrom(Connection& connection, int id) {
+        char buffer[4096];
+        while (!connection.dead) {
+            int received = static_cast<int>(recv(connection.socket, buffer, sizeof(buffer), 0));
+            if (received == 0 || (received < 0 && !wouldBlock())) {
+                connection.dead = true;
+                break;
+            }
+            if (received < 0)
+                break;
+            connection.input.append(buffer, received);
+        }
+
+        size_t start = 0, end;
+        while ((end = connection.input.find('\n', start)) != string::npos) {
+            string line = connection.input.substr(start, end - start);
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+            start = end + 1;
+            handleLine(id, line);
+            if (connections.find(id) == connections.end() || connection.dead || connection.closing)
+                return;
+        }
+        connection.input.erase(0, start);
+        if (connection.input.size() > MAX_LINE) {
+            reply(id, "error line too long");
+            connection.closing = true;
+            connection.input.clear();
+        }
+    }
+
+    void Server::writeTo(Connection& connection) {
+        while (!connection.output.empty()) {
+            int sent = static_cast<int>(send(connection.socket, connection.output.data(),
+                                             static_cast<int>(connection.output.size()), SEND_FLAGS));
+            if (sent < 0) {
+                if (!wouldBlock())
+                    connection.dead = true;
+                return;
+            }
+            connection.output.erase(0, sent);
+        }
+    }
+
+    void Server::reply(int connectionId, const string& text) {
+        auto it = connections.find(connectionId);
+        if (it == connections.end() || it->second.dead)
+            return;
+        it->second.output += text;
+        it->second.output += '\n';
+        if (it->second.output.size() > MAX_OUTPUT)
+            it->second.dead = true;
+    }
+
+    void Server::dropConnection(int id) {
+        auto it = connections.find(id);
+        if (it == connections.end())
+            return;
+        for (int sessionId : it->second.sessions)
+            closeSession(sessionId);
+        closeSocket(it->second.socket);
+        connections.erase(it);
+    }
+
+    //---------------------------------------------------------------------
+    // Commands
+    //---------------------------------------------------------------------
+    // Reads a session id and checks that it belongs to the connection.
+    Session* Server::findSession(int connectionId, istringstream& in) {
+        int id = 0;
+        in >> id;
+        auto it = sessions.find(id);
+        if (it == sessions.end() || it->second->closed || it->second->connection != connectionId) {
+            reply(connectionId, "error unknown session");
+            return nullptr;
+        }
+        return it->second.get();
+    }
+
+    void Server::handleLine(int connectionId, const string& line) {
+        istringstream in(line);
+        string command;
+        if (!(in >> command))
+            return;
+
+        if (command == "new") {
+            if (sessions.size() >= options.maxSessions) {
+                reply(connectionId, "error too many sessions");
+                return;
+            }
+            auto session = make_unique<Session>();
+            session->movetimeMs = options.movetimeMs;
+            string token;
+            while (in >> token) {
+                if (token == "white" || token == "black") {
+                    session->clientWhite = token == "white";
+                } else if (token == "movetime") {
+                    if (!(in >> session->movetimeMs)) {
+                        reply(connectionId, "error bad movetime");
+                        return;
+                    }
+                } else if (token == "fen") {
+                    string fen;
+                    getline(in, fen);
+                    if (!session->board.loadFEN(fen)) {
+                        reply(connectionId, "error invalid fen");
+                        return;
+                    }
+                } else {
+                    reply(connectionId, "error bad option " + token);
+                    return;
+                }
+            }
+            session->movetimeMs = max(1, min(session->movetimeMs, options.maxMovetimeMs));
+            session->id = nextSessionId++;
+            session->connection = connectionId;
+            Session& created = *session;
+            sessions[created.id] = move(session);
+            connections[connectionId].sessions.push_back(created.id);
+            reply(connectionId, "session " + to_string(created.id));
+            if (!reportGameOver(created) && created.board.isWhiteTurn() != created.clientWhite)
+                queueSearch(created, false, created.movetimeMs);
+        } else if (command == "move") {
+            Session* session = findSession(connectionId, in);
+            if (!session)
+                return;
+            string id = to_string(session->id), text;
+            tuple<int, int, int, int> move;
+            if (session->state != SearchState::Idle)
+                reply(connectionId, "error " + id + " busy");
+            else if (session->board.isGameOver() || session->plies >= options.maxPlies)
+                reply(connectionId, "error " + id + " game over");
+            else if (session->board.isWhiteTurn() != session->clientWhite)
+                reply(connectionId, "error " + id + " not your move");
+            else if (!(in >> text) || !parseMove(session->board, text, move))
+                reply(connectionId, "error " + id + " illegal move " + text);
+            else {
+                Bot::applyMove(session->board, move);
+                ++session->plies;
+                if (!reportGameOver(*session))
+                    queueSearch(*session, false, session->movetimeMs);
+            }
+        } else if (command == "go") {
+            Session* session = findSession(connectionId, in);
+            if (!session)
+                return;
+            int movetimeMs = session->movetimeMs;
+            string token;
+            if (in >> token && token == "movetime")
+                in >> movetimeMs;
+            if (session->state != SearchState::Idle)
+                reply(connectionId, "error " + to_string(session->id) + " busy");
+            else if (session->board.isGameOver())
+                reply(connectionId, "error " + to_string(session->id) + " game over");
+            else
+                queueSearch(*session, true, max(1, min(movetimeMs, options.maxMovetimeMs)));
+        } else if (command == "fen") {
+            if (Session* session = findSession(connectionId, in))
+                reply(connectionId, "fen " + to_string(session->id) + " " + session->board.toFEN());
+        } else if (command == "status") {
+            if (Session* session = findSession(connectionId, in))
+                reply(connectionId, "status " + to_string(session->id) + " " + statusName(session->board.status()));
+        } else if (command == "close") {
+            if (Session* session = findSession(connectionId, in)) {
+                int id = session->id;
+                auto& owned = connections[connectionId].sessions;
+                owned.erase(remove(owned.begin(), owned.end(), id), owned.end());
+                closeSession(id);
+                reply(connectionId, "closed " + to_string(id));
+            }
+        } else if (command == "stats") {
+            ostringstream s;
+            s << "stats sessions " << sessions.size() << " searching " << running
+              << " queued " << runQueue.size() << " hashfull " << table.hashfull();
+            reply(connectionId, s.str());
+        } else if (command == "quit") {
+            connections[connectionId].closing = true;
+        } else if (command == "shutdown") {
+            shuttingDown = true;
+        } else {
+            reply(connectionId, "error unknown command " + command);
+        }
+    }
+
+    // Sends "gameover" if the last move ended the game or reached the ply limit.
+    bool Server::reportGameOver(Session& session) {
+        if (!session.board.isGameOver() && session.plies < options.maxPlies)
+            return false;
+        string status = session.board.isGameOver() ? statusName(session.board.status()) : "draw";
+        reply(session.connection, "gameover " + to_string(session.id) + " " + status);
+        return true;
+    }
+
+    void Server::closeSession(int id) {
+        auto it = sessions.find(id);
+        if (it == sessions.end())
+            return;
+        if (it->second->state == SearchState::Idle) {
+            sessions.erase(it);
+        } else {
+            // Queued sessions are skipped by dispatchSearches; running ones stop early.
+            it->second->closed = true;
+            it->second->stop = true;
+        }
+    }
+
+    //---------------------------------------------------------------------
+    // Search Scheduling
+    //---------------------------------------------------------------------
+    void Server::queueSearch(Session& session, bool analyse, int movetimeMs) {
+        session.state = SearchState::Queued;
+        session.analysing = analyse;
+        session.searchMovetimeMs = movetimeMs;
+        runQueue.push_back(session.id);
+    }
+
+    // Hands queued sessions to the pool, oldest first, keeping at most one search per thread
+    // in flight so a newly queued session never waits behind a backlog inside the pool.
+    void Server::dispatchSearches() {
+        while (running < pool.size() && !runQueue.empty()) {
+            int id = runQueue.front();
+            runQueue.pop_front();
+            auto it = sessions.find(id);
+            if (it == sessions.end())
+                continue;
+            Session& session = *it->second;
+            if (session.closed) {
+                sessions.erase(it);
+                continue;
+            }
+
+            SearchLimits limits;
+            limits.movetimeMs = session.searchMovetimeMs;
+            limits.tt = &table;
+            limits.stop = &session.stop;
+            auto board = make_shared<Board>(session.board);
+            session.state = SearchState::Running;
+            ++running;
+            pool.submit([this, id, board, limits] {
+                SearchResult result = Bot::search(*board, limits);
+                {
+                    lock_guard<mutex> guard(completionLock);
+                    completions.push_back({ id, move(result) });
+                }
+                char byte = 0;
+                send(wake, &byte, 1, 0);
+            });
+        }
+    }
+
+    void Server::finishSearches() {
+        vector<Completion> finished;
+        {
+            lock_guard<mutex> guard(completionLock);
+            finished.swap(completions);
+        }
+        for (Completion& completion : finished) {
+            --running;
+            if (++finishedSearches % AGE_INTERVAL == 0)
+                table.newSearch();
+            auto it = sessions.find(completion.session);
+            if (it == sessions.end())
+                continue;
+            Session& session = *it->second;
+            session.state = SearchState::Idle;
+            if (session.closed) {
+                sessions.erase(it);
+                continue;
+            }
+            const SearchResult& result = completion.result;
+            if (!result.hasMove)
+                continue;
+
+            ostringstream s;
+            s << (session.analysing ? "analysis " : "bestmove ") << session.id << ' '
+              << toCoordinate(session.board, result.bestMove);
+            if (int mate = mateInMoves(result.score))
+                s << " score mate " << mate;
+            else
+                s << " score cp " << result.score;
+            s << " depth " << result.depth << " nodes " << result.stats.nodes;
+            reply(session.connection, s.str());
+            if (!session.analysing) {
+                Bot::applyMove(session.board, result.bestMove);
+                ++session.plies;
+                reportGameOver(session);
+            }
+        }
+    }
+}
+
+bool runServer(const ServerOptions& options, ostream& log) {
+#ifdef _WIN32
+    WSADATA data;
+    if (WSAStartup(MAKEWORD(2, 2), &data) != 0) {
+        cerr << "Could not start Winsock" << endl;
+        return false;
+    }
+#else
+    signal(SIGPIPE, SIG_IGN);
+#endif
+    bool ok = Server(options, log).run();
+#ifdef _WIN32
+    WSACleanup();
+#endif
+    return ok;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+using namespace std;
+
+// Engine server hosting many concurrent games over a local socket.
+//
+// Clients speak a line protocol; every line is one command and every reply one line.
+// A connection may open any number of sessions (games against the bot):
+//   new [white|black] [movetime MS] [fen FEN]   open a game; the client plays the given colour
+//                                               (white by default)    -> "session ID"
+//   move ID MOVE        play the client's move (SAN or coordinates); the bot replies later with
+//                       "bestmove ID MOVE score cp CP depth D nodes N" ("score mate M" when
+//                       the search found a forced mate, negative when the bot is getting mated)
+//   go ID [movetime MS] search the position without playing         -> "analysis ID MOVE score ..."
+//   fen ID              -> "fen ID FEN"
+//   status ID           -> "status ID ongoing|check|checkmate|stalemate|draw"
+//   close ID            -> "closed ID"
+//   stats               -> "stats sessions N searching N queued N hashfull N"
+//   quit                close this connection (its sessions are closed too)
+//   shutdown            stop the server
+// When a move ends the game "gameover ID STATUS" follows. Errors are "error [ID] MESSAGE".
+//
+// Searches run on a work-stealing thread pool and share one transposition table. Each
+// session has at most one search queued or running, and waiting sessions are served in
+// arrival order, so a busy client cannot starve the others.
+struct ServerOptions {
+    string host = "127.0.0.1";
+    int port = 7878;
+    string socketPath;            // Listen on this Unix domain socket instead of TCP (not on Windows).
+    unsigned threads = 0;         // Search threads; zero means one per hardware thread.
+    size_t hashMb = 64;           // Shared transposition table size.
+    int movetimeMs = 1000;        // Default thinking time per bot move.
+    int maxMovetimeMs = 10000;    // Most a session may ask for.
+    size_t maxSessions = 10000;
+    int maxPlies = 1000;          // Longest game a session may play; bounds its memory.
+};
+
+// Serves until a client sends "shutdown". Returns false if the socket could not be opened.
+bool runServer(const ServerOptions& options, ostream& log);
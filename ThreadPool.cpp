@@ -0,0 +1,92 @@
+#include "ThreadPool.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+using namespace std;
+
+namespace {
+    // The pool and queue index of the worker running on this thread, if any.
+    thread_local const ThreadPool* currentPool = nullptr;
+    thread_local size_t currentIndex = 0;
+}
+
+ThreadPool::ThreadPool(unsigned threads) {
+    if (threads == 0)
+        threads = max(1u, thread::hardware_concurrency());
+    for (unsigned i = 0; i < threads; ++i)
+        queues.push_back(make_unique<WorkerQueue>());
+    for (unsigned i = 0; i < threads; ++i)
+        workers.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    taskReady.notify_all();
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void ThreadPool::submit(function<void()> task) {
+    size_t index = currentPool == this ? currentIndex : nextQueue++ % queues.size();
+    {
+        // Counted under the pool lock so a worker about to sleep cannot miss the wakeup, and
+        // before the push so a worker that takes the task never sees the count go negative.
+        lock_guard<mutex> guard(lock);
+        ++unfinished;
+        ++queued;
+    }
+    {
+        lock_guard<mutex> guard(queues[index]->lock);
+        queues[index]->tasks.push_back(move(task));
+    }
+    taskReady.notify_one();
+}
+
+void ThreadPool::wait() {
+    unique_lock<mutex> guard(lock);
+    allDone.wait(guard, [this] { return unfinished == 0; });
+}
+
+// Takes the oldest task from the worker's own queue, or else the newest from another's.
+bool ThreadPool::popTask(size_t index, function<void()>& task) {
+    for (size_t i = 0; i < queues.size(); ++i) {
+        WorkerQueue& queue = *queues[(index + i) % queues.size()];
+        lock_guard<mutex> guard(queue.lock);
+        if (queue.tasks.empty())
+            continue;
+        if (i == 0) {
+            task = move(queue.tasks.front());
+            queue.tasks.pop_front();
+        } else {
+            task = move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        --queued;
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t index) {
+    CHESS_TRACE_THREAD("pool worker");
+    currentPool = this;
+    currentIndex = index;
+    while (true) {
+        function<void()> task;
+        if (!popTask(index, task)) {
+            unique_lock<mutex> guard(lock);
+            taskReady.wait(guard, [this] { return stopping || queued > 0; });
+            if (stopping && queued == 0)
+                return;
+            continue;
+        }
+        task();
+        {
+            lock_guard<mutex> guard(lock);
+            if (--unfinished == 0)
+                allDone.notify_all();
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+using namespace std;
+
+// A fixed set of worker threads with one task queue each. Tasks submitted from outside the
+// pool are dealt round-robin; tasks submitted by a worker go to its own queue. A worker runs
+// its own queue oldest first and, when it is empty, steals the newest task from another
+// worker, so one long queue never leaves the other threads idle.
+class ThreadPool {
+public:
+    // Starts 'threads' workers; zero means one per hardware thread.
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void submit(function<void()> task);
+
+    // Blocks until every submitted task has finished.
+    void wait();
+
+    size_t size() const { return workers.size(); }
+
+private:
+    struct WorkerQueue {
+        mutex lock;
+        deque<function<void()>> tasks;
+    };
+
+    void workerLoop(size_t index);
+    bool popTask(size_t index, function<void()>& task);
+
+    vector<thread> workers;
+    vector<unique_ptr<WorkerQueue>> queues;
+    atomic<size_t> nextQueue{ 0 };
+    atomic<size_t> queued{ 0 };     // Tasks waiting in any queue.
+    size_t unfinished = 0;          // Tasks submitted and not yet finished; guarded by 'lock'.
+    mutex lock;
+    condition_variable taskReady;
+    condition_variable allDone;
+    bool stopping = false;
+};
@@ -0,0 +1,152 @@
+#include "Trace.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+using namespace std;
+
+namespace {
+    struct Event {
+        const char* category;
+        const char* name;
+        const char* argName;
+        long long arg;
+        uint64_t startNs;
+        uint64_t endNs;
+    };
+
+    // One thread's events. Only the owning thread writes; 'count' is published after each
+    // event so the exporter can tell which slots may have been overwritten while it copied.
+    struct ThreadBuffer {
+        int id = 0;
+        atomic<const char*> name{ nullptr };
+        atomic<uint64_t> count{ 0 };
+        unique_ptr<Event[]> events{ new Event[Trace::RING_EVENTS] };
+    };
+
+    // Buffers are owned here and never freed, so events of finished threads are still written.
+    mutex registryLock;
+    vector<unique_ptr<ThreadBuffer>> registry;
+    string outputPath;
+
+    const chrono::steady_clock::time_point epoch = chrono::steady_clock::now();
+
+    ThreadBuffer& localBuffer() {
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (!buffer) {
+            lock_guard<mutex> guard(registryLock);
+            registry.push_back(make_unique<ThreadBuffer>());
+            buffer = registry.back().get();
+            buffer->id = static_cast<int>(registry.size());
+        }
+        return *buffer;
+    }
+
+    void writeJsonString(ostream& out, const char* text) {
+        out << '"';
+        for (const char* c = text; *c; ++c) {
+            if (*c == '"' || *c == '\\')
+                out << '\\';
+            out << *c;
+        }
+        out << '"';
+    }
+
+#ifdef CHESS_TRACING
+    void writeAtExit() {
+        Trace::recording = false;
+        if (Trace::write(outputPath))
+            cerr << "Wrote trace to " << outputPath << endl;
+    }
+#endif
+}
+
+atomic<bool> Trace::recording{ false };
+
+uint64_t Trace::nowNs() {
+    // Offset by one so a timestamp is never zero, which Scope uses to mean "not recording".
+    return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - epoch).count()) + 1;
+}
+
+void Trace::record(const char* category, const char* name, uint64_t startNs, uint64_t endNs,
+                   const char* argName, long long arg) {
+    ThreadBuffer& buffer = localBuffer();
+    uint64_t count = buffer.count.load(memory_order_relaxed);
+    buffer.events[count % RING_EVENTS] = { category, name, argName, arg, startNs, endNs };
+    buffer.count.store(count + 1, memory_order_release);
+}
+
+void Trace::setThreadName(const char* name) {
+    localBuffer().name.store(name, memory_order_relaxed);
+}
+
+bool Trace::start(const string& path) {
+#ifdef CHESS_TRACING
+    if (outputPath.empty())
+        atexit(writeAtExit);
+    outputPath = path;
+    recording = true;
+    return true;
+#else
+    (void)path;
+    cerr << "This build has no tracing; rebuild with -DCHESS_TRACING to use --trace" << endl;
+    return false;
+#endif
+}
+
+// Complete ("X") events with microsecond timestamps, one process, one track per thread.
+bool Trace::write(const string& path) {
+    ofstream out(path);
+    if (!out) {
+        cerr << "Could not write trace: " << path << endl;
+        return false;
+    }
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << fixed << setprecision(3);
+    bool first = true;
+    auto separator = [&] {
+        out << (first ? "" : ",\n");
+        first = false;
+    };
+
+    lock_guard<mutex> guard(registryLock);
+    vector<Event> events;
+    for (auto& buffer : registry) {
+        const char* name = buffer->name.load(memory_order_relaxed);
+        separator();
+        out << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << buffer->id << ",\"args\":{\"name\":";
+        writeJsonString(out, name ? name : ("thread " + to_string(buffer->id)).c_str());
+        out << "}}";
+
+        // Copy the ring, then drop the slots the owner may have overwritten meanwhile.
+        uint64_t before = buffer->count.load(memory_order_acquire);
+        uint64_t oldest = before > RING_EVENTS ? before - RING_EVENTS : 0;
+        events.clear();
+        for (uint64_t i = oldest; i < before; ++i)
+            events.push_back(buffer->events[i % RING_EVENTS]);
+        uint64_t after = buffer->count.load(memory_order_acquire);
+        size_t overwritten = static_cast<size_t>(after > oldest + RING_EVENTS ? after - oldest - RING_EVENTS : 0);
+
+        for (size_t i = overwritten; i < events.size(); ++i) {
+            const Event& event = events[i];
+            separator();
+            out << "{\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->id << ",\"cat\":";
+            writeJsonString(out, event.category);
+            out << ",\"name\":";
+            writeJsonString(out, event.name);
+            out << ",\"ts\":" << event.startNs / 1000.0 << ",\"dur\":" << (event.endNs - event.startNs) / 1000.0;
+            if (event.argName) {
+                out << ",\"args\":{";
+                writeJsonString(out, event.argName);
+                out << ':' << event.arg << '}';
+            }
+            out << '}';
+        }
+    }
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+using namespace std;
+
+// Scoped timeline events for finding where latency goes: search iterations and root moves,
+// move generation, transposition-table resizing and the game window's frame phases.
+//
+// Tracing is compiled in only when CHESS_TRACING is defined (-DCHESS_TRACING); otherwise the
+// macros below expand to nothing and their arguments are not evaluated. Even when compiled
+// in, nothing is recorded until Trace::start is called (the global "--trace FILE" option).
+// Each thread writes its events into its own ring buffer, which keeps the newest
+// RING_EVENTS events, and the buffers are written as Chrome trace_event JSON at exit, for
+// chrome://tracing or ui.perfetto.dev.
+//
+//   CHESS_TRACE("search", "iteration");                  // Times the enclosing scope.
+//   CHESS_TRACE_ARG("search", "iteration", "depth", d);  // Same, with one integer argument.
+//   CHESS_TRACE_THREAD("analysis");                       // Names the calling thread.
+#ifdef CHESS_TRACING
+#define CHESS_TRACE_JOIN2(a, b) a##b
+#define CHESS_TRACE_JOIN(a, b) CHESS_TRACE_JOIN2(a, b)
+#define CHESS_TRACE(category, name) \
+    Trace::Scope CHESS_TRACE_JOIN(traceScope, __LINE__)(category, name)
+#define CHESS_TRACE_ARG(category, name, argName, value) \
+    Trace::Scope CHESS_TRACE_JOIN(traceScope, __LINE__)(category, name, argName, value)
+#define CHESS_TRACE_THREAD(name) Trace::setThreadName(name)
+#else
+#define CHESS_TRACE(category, name) ((void)0)
+#define CHESS_TRACE_ARG(category, name, argName, value) ((void)0)
+#define CHESS_TRACE_THREAD(name) ((void)0)
+#endif
+
+namespace Trace {
+    const size_t RING_EVENTS = 1 << 16;   // Per thread.
+
+    // Starts recording; the trace is written to 'path' when the program exits. Returns false,
+    // with a message, if tracing was not compiled in.
+    bool start(const string& path);
+
+    // Writes every thread's recorded events to 'path'. Events recorded while the file is
+    // being written may be left out.
+    bool write(const string& path);
+
+    // Labels the calling thread in the trace viewer. The name must outlive the program.
+    void setThreadName(const char* name);
+
+    extern atomic<bool> recording;
+
+    uint64_t nowNs();
+    void record(const char* category, const char* name, uint64_t startNs, uint64_t endNs,
+                const char* argName, long long arg);
+
+    // Records the time from construction to destruction as one event. Names must be string
+    // literals, since only the pointers are kept.
+    class Scope {
+    public:
+        Scope(const char* category, const char* name, const char* argName = nullptr, long long arg = 0)
+            : category(category), name(name), argName(argName), arg(arg),
+              startNs(recording.load(memory_order_relaxed) ? nowNs() : 0) {}
+        ~Scope() {
+            if (startNs)
+                record(category, name, startNs, nowNs(), argName, arg);
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* category;
+        const char* name;
+        const char* argName;
+        long long arg;
+        uint64_t startNs;   // Zero when not recording.
+    };
+}
@@ -0,0 +1,113 @@
+#include "TranspositionTable.hpp"
+#include "Trace.hpp"
+#include <algorithm>
+using namespace std;
+
+namespace {
+    // Data word layout, from the low bit:
+    //   32 bits  score (two's complement)
+    //    8 bits  depth
+    //    2 bits  bound
+    //    6 bits  generation
+    //   13 bits  move: from row, from col, to row, to col (3 bits each) and a valid flag
+    uint64_t packMove(const tuple<int, int, int, int>& move) {
+        if (get<0>(move) < 0)
+            return 0;
+        return 1u << 12 | get<0>(move) << 9 | get<1>(move) << 6 | get<2>(move) << 3 | get<3>(move);
+    }
+
+    tuple<int, int, int, int> unpackMove(uint64_t bits) {
+        if (!(bits >> 12 & 1))
+            return { -1, -1, -1, -1 };
+        return { int(bits >> 9 & 7), int(bits >> 6 & 7), int(bits >> 3 & 7), int(bits & 7) };
+    }
+
+    uint64_t pack(int score, int depth, Bound bound, uint8_t generation, uint64_t move) {
+        return uint64_t(uint32_t(score)) | uint64_t(min(depth, 255)) << 32 | uint64_t(bound) << 40 |
+               uint64_t(generation) << 42 | move << 48;
+    }
+
+    int depthOf(uint64_t data) { return int(data >> 32 & 255); }
+    Bound boundOf(uint64_t data) { return Bound(data >> 40 & 3); }
+    uint8_t generationOf(uint64_t data) { return uint8_t(data >> 42 & 63); }
+}
+
+TranspositionTable::TranspositionTable(size_t megabytes) {
+    resize(megabytes);
+}
+
+TranspositionTable::TranspositionTable(void* memory, size_t bytes) {
+    size_t count = 1;
+    while (count * 2 * sizeof(Slot) <= bytes)
+        count *= 2;
+    slots = static_cast<Slot*>(memory);
+    entryCount = count;
+}
+
+void TranspositionTable::resize(size_t megabytes) {
+    CHESS_TRACE_ARG("tt", "tt resize", "megabytes", static_cast<long long>(megabytes));
+    size_t count = 1;
+    while (count * 2 * sizeof(Slot) <= max<size_t>(megabytes, 1) << 20)
+        count *= 2;
+    ownedSlots.reset(new Slot[count]);
+    slots = ownedSlots.get();
+    entryCount = count;
+    clear();
+}
+
+void TranspositionTable::clear() {
+    for (size_t i = 0; i < entryCount; ++i) {
+        slots[i].check.store(0, memory_order_relaxed);
+        slots[i].data.store(0, memory_order_relaxed);
+    }
+    generation.store(0, memory_order_relaxed);
+}
+
+bool TranspositionTable::probe(uint64_t key, Entry& entry) const {
+    const Slot& slot = slots[key & (entryCount - 1)];
+    uint64_t data = slot.data.load(memory_order_relaxed);
+    uint64_t check = slot.check.load(memory_order_relaxed);
+    if ((check ^ data) != key || boundOf(data) == Bound::None)
+        return false;
+    entry.score = int32_t(uint32_t(data));
+    entry.depth = depthOf(data);
+    entry.bound = boundOf(data);
+    entry.move = unpackMove(data >> 48);
+    return true;
+}
+
+// Replacement: the same position is always overwritten (keeping its move if the new result
+// has none); another position only gives way to an equal or deeper result, or when it was
+// stored before the last newSearch.
+void TranspositionTable::store(uint64_t key, int score, int depth, Bound bound,
+                               const tuple<int, int, int, int>& move) {
+    Slot& slot = slots[key & (entryCount - 1)];
+    uint64_t oldData = slot.data.load(memory_order_relaxed);
+    uint64_t oldCheck = slot.check.load(memory_order_relaxed);
+    bool samePosition = (oldCheck ^ oldData) == key;
+    uint8_t current = generation.load(memory_order_relaxed);
+    uint64_t packedMove = packMove(move);
+
+    if (samePosition) {
+        if (!packedMove)
+            packedMove = oldData >> 48;
+    } else if (boundOf(oldData) != Bound::None && generationOf(oldData) == current && depth < depthOf(oldData)) {
+        return;
+    }
+
+    uint64_t data = pack(score, depth, bound, current, packedMove);
+    slot.data.store(data, memory_order_relaxed);
+    slot.check.store(key ^ data, memory_order_relaxed);
+}
+
+int TranspositionTable::hashfull() const {
+    size_t sample = min<size_t>(1000, entryCount);
+    size_t used = 0;
+    uint8_t current = generation.load(memory_order_relaxed);
+    for (size_t i = 0; i < sample; ++i) {
+        uint64_t data = slots[i].data.load(memory_order_relaxed);
+        if (boundOf(data) != Bound::None && generationOf(data) == current)
+            ++used;
+    }
+    return int(used * 1000 / sample);
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+using namespace std;
+
+// Bound stored with a transposition-table score.
+enum class Bound : uint8_t {
+    None = 0,
+    Upper = 1,   // The true score is at most the stored score (the node failed low).
+    Lower = 2,   // The true score is at least the stored score (the node failed high).
+    Exact = 3
+};
+
+// A fixed-size hash table of search results shared by any number of concurrent searches.
+// Entries are two 64-bit words written without locks; the key word is stored XORed with the
+// data word, so a torn write from two threads simply fails verification and reads as a miss.
+// Scores are stored from White's point of view so searches for either side can share entries.
+class TranspositionTable {
+public:
+    struct Entry {
+        int score;
+        int depth;
+        Bound bound;
+        tuple<int, int, int, int> move;   // (-1, -1, -1, -1) when unknown.
+    };
+
+    // Allocates roughly 'megabytes' MB, rounded down to a power of two number of entries.
+    explicit TranspositionTable(size_t megabytes = 16);
+
+    // Uses 'bytes' of caller-owned, zero-initialised or previously used memory (such as a
+    // mapped file) without clearing it. Rounded down to a power of two number of entries.
+    TranspositionTable(void* memory, size_t bytes);
+
+    // Bytes of memory needed for 'entries' entries.
+    static size_t bytesFor(size_t entries) { return entries * sizeof(Slot); }
+
+    // Reallocates or clears the table. Not safe while a search is using it.
+    void resize(size_t megabytes);
+    void clear();
+
+    // Ages the table: entries stored before the call are replaced first. Owners of a shared
+    // table call this per game or per batch, not per search, so concurrent searches keep theirs.
+    void newSearch() { generation.store((generation.load(memory_order_relaxed) + 1) & 63, memory_order_relaxed); }
+
+    bool probe(uint64_t key, Entry& entry) const;
+    void store(uint64_t key, int score, int depth, Bound bound, const tuple<int, int, int, int>& move);
+
+    // Approximate fill in permille, sampled from the first thousand entries.
+    int hashfull() const;
+
+    size_t sizeInBytes() const { return entryCount * sizeof(Slot); }
+
+private:
+    struct Slot {
+        atomic<uint64_t> check;   // key ^ data
+        atomic<uint64_t> data;
+    };
+
+    unique_ptr<Slot[]> ownedSlots;
+    Slot* slots = nullptr;
+    size_t entryCount = 0;
+    atomic<uint8_t> generation{ 0 };
+};
@@ -0,0 +1,295 @@
+#include "Tuner.hpp"
+#include "Bot.hpp"
+#include "EvalParams.hpp"
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+using namespace std;
+
+namespace {
+    const size_t CHUNK_LINES = 16384;   // Data lines parsed per thread-pool task.
+    const size_t BLOCK = 256;           // Positions evaluated together in the inner loops.
+
+    // Labelled positions as a structure of arrays: one int8 column per evaluation term and a
+    // column of results, so each pass over the data streams through contiguous memory
+    // (EVAL_TERMS + 4 bytes per position) and the per-term loops vectorise.
+    struct TrainingSet {
+        size_t count = 0;
+        vector<int8_t> features[EVAL_TERMS];   // features[t][i]: term t's count in position i.
+        vector<float> results;                 // 1 White won, 0.5 drawn, 0 Black won.
+
+        void add(const int counts[EVAL_TERMS], float result) {
+            for (int t = 0; t < EVAL_TERMS; ++t)
+                features[t].push_back(static_cast<int8_t>(max(-127, min(127, counts[t]))));
+            results.push_back(result);
+            ++count;
+        }
+
+        void append(const TrainingSet& other) {
+            for (int t = 0; t < EVAL_TERMS; ++t)
+                features[t].insert(features[t].end(), other.features[t].begin(), other.features[t].end());
+            results.insert(results.end(), other.results.begin(), other.results.end());
+            count += other.count;
+        }
+    };
+
+    // Reads a line's FEN (4 fields, plus the move counters when present) and game result.
+    bool parseLine(const string& line, string& fen, float& result) {
+        istringstream in(line);
+        string field;
+        fen.clear();
+        for (int i = 0; i < 6 && in >> field; ++i) {
+            if (i >= 4 && field.find_first_not_of("0123456789") != string::npos)
+                break;
+            fen += (i ? " " : "") + field;
+        }
+        if (line.find("1/2-1/2") != string::npos || line.find("[0.5]") != string::npos)
+            result = 0.5f;
+        else if (line.find("1-0") != string::npos || line.find("[1.0]") != string::npos)
+            result = 1.0f;
+        else if (line.find("0-1") != string::npos || line.find("[0.0]") != string::npos)
+            result = 0.0f;
+        else
+            return false;
+        return true;
+    }
+
+    void loadChunk(const vector<string>& lines, TrainingSet& out, atomic<long long>& skipped) {
+        Board board;
+        string fen;
+        float result = 0.0f;
+        int counts[EVAL_TERMS];
+        for (auto& line : lines) {
+            if (!parseLine(line, fen, result) || !board.loadFEN(fen) || board.isInCheck(board.isWhiteTurn())) {
+                ++skipped;
+                continue;
+            }
+            Bot::evaluationFeatures(board, counts);
+            out.add(counts, result);
+        }
+    }
+
+    // Reads the data file in chunks of lines parsed on the pool. At most two chunks per worker
+    // are waiting at a time, so the raw text never has to fit in memory at once.
+    bool loadTrainingSet(const TunerOptions& options, ThreadPool& pool, TrainingSet& set, long long& skippedLines) {
+        ifstream in(options.dataPath);
+        if (!in) {
+            cerr << "Could not open tuning data: " << options.dataPath << endl;
+            return false;
+        }
+        vector<unique_ptr<TrainingSet>> chunks;
+        atomic<long long> skipped{ 0 };
+        mutex lock;
+        condition_variable chunkDone;
+        size_t inFlight = 0, read = 0;
+        vector<string> lines;
+        string line;
+        auto submit = [&] {
+            {
+                unique_lock<mutex> guard(lock);
+                chunkDone.wait(guard, [&] { return inFlight < pool.size() * 2; });
+                ++inFlight;
+            }
+            chunks.push_back(make_unique<TrainingSet>());
+            TrainingSet* chunk = chunks.back().get();
+            pool.submit([&, chunk, chunkLines = move(lines)] {
+                loadChunk(chunkLines, *chunk, skipped);
+                lock_guard<mutex> guard(lock);
+                --inFlight;
+                chunkDone.notify_all();
+            });
+            lines.clear();
+        };
+        while ((options.maxPositions == 0 || read < options.maxPositions) && getline(in, line)) {
+            if (line.find_first_not_of(" \t\r") == string::npos)
+                continue;
+            lines.push_back(move(line));
+            ++read;
+            if (lines.size() == CHUNK_LINES)
+                submit();
+        }
+        if (!lines.empty())
+            submit();
+        pool.wait();
+
+        size_t total = 0;
+        for (auto& chunk : chunks)
+            total += chunk->count;
+        for (auto& column : set.features)
+            column.reserve(total);
+        set.results.reserve(total);
+        for (auto& chunk : chunks) {
+            set.append(*chunk);
+            chunk.reset();
+        }
+        skippedLines = skipped;
+        return true;
+    }
+
+    // Mean squared error between results and predictions over the whole set and, when
+    // 'gradient' is given, its gradient with respect to each weight. The set is cut into one
+    // slice per worker; each slice is processed in blocks, evaluated term by term into a small
+    // buffer, so every inner loop runs over contiguous arrays.
+    double meanError(const TrainingSet& set, const double weights[EVAL_TERMS], double k, double* gradient,
+                     ThreadPool& pool) {
+        size_t slices = pool.size();
+        vector<array<double, EVAL_TERMS + 1>> sums(slices);   // Gradient sums, then the error sum.
+        float w[EVAL_TERMS];
+        for (int t = 0; t < EVAL_TERMS; ++t)
+            w[t] = static_cast<float>(weights[t]);
+        float scale = static_cast<float>(k * log(10.0) / 400.0);
+
+        for (size_t s = 0; s < slices; ++s) {
+            pool.submit([&, s] {
+                size_t begin = set.count * s / slices, end = set.count * (s + 1) / slices;
+                array<double, EVAL_TERMS + 1>& sum = sums[s];
+                sum.fill(0.0);
+                alignas(32) float eval[BLOCK];
+                alignas(32) float coef[BLOCK];
+                for (size_t b = begin; b < end; b += BLOCK) {
+                    size_t n = min(BLOCK, end - b);
+                    fill(eval, eval + n, 0.0f);
+                    for (int t = 0; t < EVAL_TERMS; ++t) {
+                        const int8_t* f = set.features[t].data() + b;
+                        for (size_t i = 0; i < n; ++i)
+                            eval[i] += w[t] * f[i];
+                    }
+                    const float* r = set.results.data() + b;
+                    float error = 0.0f;
+                    for (size_t i = 0; i < n; ++i) {
+                        float p = 1.0f / (1.0f + exp(-scale * eval[i]));
+                        float diff = r[i] - p;
+                        error += diff * diff;
+                        coef[i] = diff * p * (1.0f - p);
+                    }
+                    sum[EVAL_TERMS] += error;
+                    if (!gradient)
+                        continue;
+                    // Eight running sums, so the reduction vectorises without reassociating floats.
+                    for (int t = 0; t < EVAL_TERMS; ++t) {
+                        const int8_t* f = set.features[t].data() + b;
+                        float lanes[8] = {};
+                        size_t i = 0;
+                        for (; i + 8 <= n; i += 8)
+                            for (int l = 0; l < 8; ++l)
+                                lanes[l] += coef[i + l] * f[i + l];
+                        for (; i < n; ++i)
+                            lanes[0] += coef[i] * f[i];
+                        float total = 0.0f;
+                        for (float lane : lanes)
+                            total += lane;
+                        sum[t] += total;
+                    }
+                }
+            });
+        }
+        pool.wait();
+
+        double error = 0.0;
+        for (auto& sum : sums)
+            error += sum[EVAL_TERMS];
+        if (gradient) {
+            for (int t = 0; t < EVAL_TERMS; ++t) {
+                double g = 0.0;
+                for (auto& sum : sums)
+                    g += sum[t];
+                gradient[t] = -2.0 * scale * g / set.count;
+            }
+        }
+        return error / set.count;
+    }
+
+    // Golden-section search for the sigmoid scale that best fits the starting weights.
+    double fitScale(const TrainingSet& set, const double weights[EVAL_TERMS], ThreadPool& pool) {
+        const double ratio = (sqrt(5.0) - 1.0) / 2.0;
+        double low = 0.05, high = 3.0;
+        double a = high - ratio * (high - low), b = low + ratio * (high - low);
+        double errorA = meanError(set, weights, a, nullptr, pool), errorB = meanError(set, weights, b, nullptr, pool);
+        for (int i = 0; i < 40; ++i) {
+            if (errorA < errorB) {
+                high = b;
+                b = a;
+                errorB = errorA;
+                a = high - ratio * (high - low);
+                errorA = meanError(set, weights, a, nullptr, pool);
+            } else {
+                low = a;
+                a = b;
+                errorA = errorB;
+                b = low + ratio * (high - low);
+                errorB = meanError(set, weights, b, nullptr, pool);
+            }
+        }
+        return (low + high) / 2.0;
+    }
+}
+
+bool runTuner(const TunerOptions& options, ostream& log) {
+    ThreadPool pool(options.threads);
+    auto start = chrono::steady_clock::now();
+    auto seconds = [&] { return chrono::duration<double>(chrono::steady_clock::now() - start).count(); };
+
+    TrainingSet set;
+    long long skipped = 0;
+    if (!loadTrainingSet(options, pool, set, skipped))
+        return false;
+    log << fixed << setprecision(2) << "Loaded " << set.count << " positions (" << skipped << " lines skipped) in "
+        << seconds() << " s on " << pool.size() << " threads" << endl;
+    if (set.count == 0) {
+        cerr << "No usable positions in " << options.dataPath << endl;
+        return false;
+    }
+
+    double weights[EVAL_TERMS];
+    for (int t = 0; t < EVAL_TERMS; ++t)
+        weights[t] = EvalParams::weights[t];
+    double k = fitScale(set, weights, pool);
+    double startError = meanError(set, weights, k, nullptr, pool);
+    log << setprecision(4) << "K = " << k << ", starting error " << setprecision(6) << startError << endl;
+
+    // Adam: per-weight step sizes adapt to the very different scales of the terms' gradients.
+    const double beta1 = 0.9, beta2 = 0.999, epsilon = 1e-8;
+    double m[EVAL_TERMS] = {}, v[EVAL_TERMS] = {}, gradient[EVAL_TERMS];
+    double error = startError;
+    auto epochStart = chrono::steady_clock::now();
+    int reportEvery = max(1, options.epochs / 20);
+    for (int epoch = 1; epoch <= options.epochs; ++epoch) {
+        error = meanError(set, weights, k, gradient, pool);
+        for (int t = 0; t < EVAL_TERMS; ++t) {
+            m[t] = beta1 * m[t] + (1 - beta1) * gradient[t];
+            v[t] = beta2 * v[t] + (1 - beta2) * gradient[t] * gradient[t];
+            double mHat = m[t] / (1 - pow(beta1, epoch));
+            double vHat = v[t] / (1 - pow(beta2, epoch));
+            weights[t] -= options.learningRate * mHat / (sqrt(vHat) + epsilon);
+        }
+        if (epoch % reportEvery == 0 || epoch == options.epochs)
+            log << "epoch " << epoch << "  error " << error << endl;
+    }
+    double epochMs = chrono::duration<double, milli>(chrono::steady_clock::now() - epochStart).count() /
+                     max(1, options.epochs);
+
+    int tuned[EVAL_TERMS];
+    for (int t = 0; t < EVAL_TERMS; ++t)
+        tuned[t] = static_cast<int>(lround(weights[t]));
+    log << setprecision(6) << "Final error " << meanError(set, weights, k, nullptr, pool) << " (was " << startError
+        << "), " << setprecision(1) << epochMs << " ms per epoch" << endl;
+    for (int t = 0; t < EVAL_TERMS; ++t)
+        log << "  " << left << setw(18) << EvalParams::name(t) << right << setw(6) << EvalParams::weights[t]
+            << " -> " << tuned[t] << endl;
+    if (!EvalParams::save(options.outPath, tuned))
+        return false;
+    log << "Wrote " << options.outPath << endl;
+    return true;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+using namespace std;
+
+// Texel-style tuning of the evaluation weights (EvalParams) against game results.
+//
+// The data file holds one labelled position per line: a FEN followed by the result of the
+// game it came from, as "1-0", "0-1", "1/2-1/2" (e.g. c9 "1-0";) or "[1.0]", "[0.5]", "[0.0]".
+// Positions should be quiet (no pending captures); positions with the side to move in check
+// are skipped. Each position is reduced once to its evaluation feature counts, stored one
+// int8 column per term, and the weights are then fitted by minimising
+//   mean over positions of (result - sigmoid(K * eval))^2,   sigmoid(x) = 1 / (1 + 10^(-x / 400))
+// with full-batch Adam steps whose gradient is computed in parallel on a thread pool.
+// K is fitted first, with the starting weights, and then held fixed.
+struct TunerOptions {
+    string dataPath;
+    string outPath = "eval.params";   // Tuned weights, in the format EvalParams::load reads.
+    int epochs = 500;
+    double learningRate = 1.0;        // Adam step size, in centipawns.
+    unsigned threads = 0;             // Zero means one per hardware thread.
+    size_t maxPositions = 0;          // Stop loading after this many positions; zero means all.
+};
+
+// Tunes starting from the weights currently in use. Returns false if the data could not be
+// read or held no usable positions.
+bool runTuner(const TunerOptions& options, ostream& log);
@@ -0,0 +1,112 @@
+#include "Uci.hpp"
+#include "Notation.hpp"
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+string formatInfo(const Board& board, const SearchIteration& iteration, const SearchStats& stats) {
+    ostringstream s;
+    s << "info depth " << iteration.depth;
+    if (int mate = mateInMoves(iteration.score))
+        s << " score mate " << mate;
+    else
+        s << " score cp " << iteration.score;
+    s << " nodes " << stats.nodes
+      << " nps " << static_cast<long long>(stats.nps())
+      << " time " << static_cast<long long>(stats.elapsedMs)
+      << " pv " << toCoordinate(board, iteration.bestMove) << '\n';
+    s << "info string qnodes " << stats.qnodes
+      << " cutoffs " << stats.betaCutoffs
+      << " firstcut " << fixed << setprecision(1) << 100.0 * stats.firstMoveCutoffRate() << '%'
+      << " ttprobes " << stats.ttProbes
+      << " tthit " << 100.0 * stats.ttHitRate() << '%'
+      << " pawnhit " << 100.0 * stats.pawnHashHitRate() << '%'
+      << " ebf " << setprecision(2) << iteration.branchingFactor
+      << " depthtime " << setprecision(1) << iteration.iterationMs;
+    return s.str();
+}
+
+namespace {
+    // "position [startpos | fen <fen>] [moves <m1> <m2> ...]"
+    void setPosition(Board& board, istringstream& in, ostream& out) {
+        string token;
+        in >> token;
+        if (token == "startpos") {
+            board.setupBoard();
+            in >> token;
+        } else if (token == "fen") {
+            string fen;
+            while (in >> token && token != "moves")
+                fen += token + " ";
+            if (!board.loadFEN(fen)) {
+                out << "info string invalid fen" << endl;
+                return;
+            }
+        }
+        if (token != "moves")
+            return;
+        while (in >> token) {
+            tuple<int, int, int, int> move;
+            if (!parseMove(board, token, move)) {
+                out << "info string illegal move " << token << endl;
+                return;
+            }
+            Bot::applyMove(board, move);
+        }
+    }
+
+    // "go [depth N] [nodes N] [movetime MS] [wtime MS btime MS winc MS binc MS]"
+    SearchLimits parseGo(const Board& board, istringstream& in) {
+        SearchLimits limits;
+        int time[2] = { 0, 0 }, inc[2] = { 0, 0 };
+        string token;
+        while (in >> token) {
+            if (token == "depth") in >> limits.depth;
+            else if (token == "nodes") in >> limits.nodes;
+            else if (token == "movetime") in >> limits.movetimeMs;
+            else if (token == "wtime") in >> time[0];
+            else if (token == "btime") in >> time[1];
+            else if (token == "winc") in >> inc[0];
+            else if (token == "binc") in >> inc[1];
+        }
+        int side = board.isWhiteTurn() ? 0 : 1;
+        if (limits.movetimeMs == 0 && time[side] > 0)
+            limits.movetimeMs = max(1, time[side] / 30 + inc[side] / 2);
+        if (limits.depth == 0 && limits.nodes == 0 && limits.movetimeMs == 0)
+            limits.depth = 4;
+        return limits;
+    }
+}
+
+void runUci(istream& in, ostream& out) {
+    Board board;
+    TranspositionTable table(64);
+    string line;
+    while (getline(in, line)) {
+        istringstream tokens(line);
+        string command;
+        tokens >> command;
+
+        if (command == "uci") {
+            out << "id name ChessGame\nid author ChessGame developers\nuciok" << endl;
+        } else if (command == "isready") {
+            out << "readyok" << endl;
+        } else if (command == "ucinewgame") {
+            board.setupBoard();
+            table.clear();
+        } else if (command == "position") {
+            setPosition(board, tokens, out);
+        } else if (command == "go") {
+            SearchLimits limits = parseGo(board, tokens);
+            limits.tt = &table;
+            limits.onIteration = [&](const SearchIteration& iteration, const SearchStats& stats) {
+                out << formatInfo(board, iteration, stats) << endl;
+            };
+            SearchResult result = Bot::search(board, limits);
+            out << "bestmove " << (result.hasMove ? toCoordinate(board, result.bestMove) : "0000") << endl;
+        } else if (command == "quit") {
+            break;
+        }
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include "Bot.hpp"
+#include <iosfwd>
+#include <string>
+using namespace std;
+
+// Runs a minimal UCI engine loop until "quit" or end of input.
+// Supports uci, isready, ucinewgame, position and a blocking go.
+void runUci(istream& in, ostream& out);
+
+// Formats a completed iteration as a UCI "info" line, followed by an "info string" line
+// with the counters UCI has no field for (quiescence nodes, cutoffs, TT hits, branching factor).
+string formatInfo(const Board& board, const SearchIteration& iteration, const SearchStats& stats);
@@ -0,0 +1,58 @@
+#include "Zobrist.hpp"
+#include <cstring>
+using namespace std;
+
+namespace {
+    struct Keys {
+        uint64_t pieces[12][64];
+        uint64_t castling[16];
+        uint64_t enPassant[8];
+        uint64_t blackToMove;
+
+        Keys() {
+            // splitmix64 with a fixed seed.
+            uint64_t state = 0x9E3779B97F4A7C15ULL;
+            auto next = [&state]() {
+                uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                return z ^ (z >> 31);
+            };
+            for (auto& piece : pieces)
+                for (auto& key : piece)
+                    key = next();
+            for (auto& key : castling)
+                key = next();
+            for (auto& key : enPassant)
+                key = next();
+            blackToMove = next();
+        }
+    };
+
+    const Keys& keys() {
+        static const Keys instance;
+        return instance;
+    }
+
+    int pieceIndex(char symbol) {
+        const char* symbols = "PNBRQKpnbrqk";
+        const char* found = strchr(symbols, symbol);
+        return found && symbol ? static_cast<int>(found - symbols) : 0;
+    }
+}
+
+uint64_t Zobrist::piece(char symbol, int row, int col) {
+    return keys().pieces[pieceIndex(symbol)][row * 8 + col];
+}
+
+uint64_t Zobrist::castling(int rights) {
+    return keys().castling[rights & 15];
+}
+
+uint64_t Zobrist::enPassant(int col) {
+    return keys().enPassant[col & 7];
+}
+
+uint64_t Zobrist::blackToMove() {
+    return keys().blackToMove;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+
+// Random keys for hashing positions. The keys come from a fixed seed, so hashes are
+// identical across runs and processes.
+namespace Zobrist {
+    // Key for a piece (by FEN symbol) standing on a square.
+    uint64_t piece(char symbol, int row, int col);
+
+    // Key for a set of castling rights: bit 0 = White king side, 1 = White queen side,
+    // 2 = Black king side, 3 = Black queen side.
+    uint64_t castling(int rights);
+
+    // Key for an en passant target on the given file.
+    uint64_t enPassant(int col);
+
+    // Mixed in when Black is to move.
+    uint64_t blackToMove();
+}
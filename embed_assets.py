@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+"""Packs the game's assets into the binary.
+
+    python embed_assets.py                      regenerate EmbeddedAssets.cpp from assets/
+    python embed_assets.py --atlas DIR OUT.png  build a theme's piece atlas from DIR's twelve piece images
+
+The twelve piece images are packed into one RGBA atlas (columns in "PNBRQK" order, White's
+pieces in the top row, Black's below), which is PNG-encoded and written into EmbeddedAssets.cpp
+as a byte array together with the font, so the game decodes a single image at startup and
+needs no files. Piece images are read as assets/P_white.png.png ... assets/k_black.png.png
+(a plain ".png" ending works too); they must be 8-bit, non-palette, non-interlaced, and all
+the same size. Only the Python standard library is used.
+"""
+import os
+import struct
+import sys
+import zlib
+
+ORDER = "PNBRQK"
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+def to_rgba(line, channels):
+    if channels == 4:
+        return line
+    out = bytearray()
+    for i in range(0, len(line), channels):
+        pixel = line[i:i + channels]
+        if channels <= 2:
+            out += bytes((pixel[0], pixel[0], pixel[0]))
+        else:
+            out += pixel
+        out.append(pixel[1] if channels == 2 else 255)
+    return out
+
+
+def read_png(path):
+    """Returns (width, height, rows) with rows as bytearrays of RGBA pixels."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(f"{path}: not a PNG file")
+    pos, idat, header = 8, b"", None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", body)
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + length
+    width, height, depth, color, _, _, interlace = header
+    channels = {0: 1, 4: 2, 2: 3, 6: 4}.get(color)   # Gray, gray + alpha, RGB, RGBA.
+    if depth != 8 or channels is None or interlace:
+        sys.exit(f"{path}: only 8-bit non-palette, non-interlaced images are supported")
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    rows, previous = [], bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        kind, line = raw[start], bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride):
+            left = line[i - channels] if i >= channels else 0
+            up = previous[i]
+            corner = previous[i - channels] if i >= channels else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 255
+            elif kind == 2:
+                line[i] = (line[i] + up) & 255
+            elif kind == 3:
+                line[i] = (line[i] + (left + up) // 2) & 255
+            elif kind == 4:
+                p = left + up - corner
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - corner)
+                predictor = left if pa <= pb and pa <= pc else up if pb <= pc else corner
+                line[i] = (line[i] + predictor) & 255
+        previous = line
+        rows.append(to_rgba(line, channels))
+    return width, height, rows
+
+
+def write_png(width, height, rows):
+    """Encodes RGBA rows as PNG bytes."""
+    def chunk(kind, body):
+        return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body))
+    raw = b"".join(b"\x00" + bytes(row) for row in rows)
+    return (b"\x89PNG\r\n\x1a\n" +
+            chunk(b"IHDR", struct.pack(">IIBBBBB", width, height, 8, 6, 0, 0, 0)) +
+            chunk(b"IDAT", zlib.compress(raw, 9)) +
+            chunk(b"IEND", b""))
+
+
+def build_atlas(directory):
+    """Returns (tile size, PNG bytes) of the atlas of the piece images in 'directory'."""
+    tiles, size = {}, None
+    for white in (True, False):
+        for letter in ORDER:
+            name = f"{letter}_white" if white else f"{letter.lower()}_black"
+            path = next((p for p in (os.path.join(directory, name + ext) for ext in (".png.png", ".png"))
+                         if os.path.exists(p)), None)
+            if path is None:
+                sys.exit(f"{directory}: missing {name}.png")
+            width, height, rows = read_png(path)
+            if width != height or (size is not None and width != size):
+                sys.exit(f"{path}: piece images must be square and all the same size")
+            size = width
+            tiles[(white, letter)] = rows
+    rows = []
+    for white in (True, False):
+        for y in range(size):
+            rows.append(b"".join(bytes(tiles[(white, letter)][y]) for letter in ORDER))
+    return size, write_png(size * len(ORDER), size * 2, rows)
+
+
+def byte_array(name, data):
+    lines, line = [], ""
+    for byte in data:
+        item = f"{byte},"
+        if len(line) + len(item) > 110:
+            lines.append(line)
+            line = ""
+        line += item
+    lines.append(line)
+    return f"const unsigned char EmbeddedAssets::{name}[] = {{\n" + "\n".join(lines) + "\n};\n"
+
+
+def main():
+    if len(sys.argv) == 4 and sys.argv[1] == "--atlas":
+        _, png = build_atlas(sys.argv[2])
+        with open(sys.argv[3], "wb") as f:
+            f.write(png)
+        return
+    if len(sys.argv) != 1:
+        sys.exit(__doc__)
+
+    assets = os.path.join(HERE, "assets")
+    size, atlas = build_atlas(assets)
+    with open(os.path.join(assets, "ariblk.ttf"), "rb") as f:
+        font = f.read()
+    source = ("// Generated by embed_assets.py from assets/; do not edit. Rerun the script after changing the assets.\n"
+              '#include "EmbeddedAssets.hpp"\n\n' +
+              byte_array("font", font) +
+              "const size_t EmbeddedAssets::fontSize = sizeof(EmbeddedAssets::font);\n\n" +
+              byte_array("pieceAtlas", atlas) +
+              "const size_t EmbeddedAssets::pieceAtlasSize = sizeof(EmbeddedAssets::pieceAtlas);\n" +
+              f"const int EmbeddedAssets::pieceTileSize = {size};\n")
+    with open(os.path.join(HERE, "EmbeddedAssets.cpp"), "w", newline="\n") as f:
+        f.write(source)
+    print(f"EmbeddedAssets.cpp: font {len(font)} bytes, {size}px piece atlas {len(atlas)} bytes")
+
+
+if __name__ == "__main__":
+    main()
@@ -3,21 +3,34 @@
 #include <SFML/System.hpp>
 #include "Board.hpp"
 #include "Bot.hpp"
+#include "Analyzer.hpp"
+#include "Commands.hpp"
+#include "EmbeddedAssets.hpp"
+#include "Notation.hpp"
+#include "OpeningIndex.hpp"
+#include "Trace.hpp"
+#include <iomanip>
 #include <iostream>
-#include <map>
 #include <set>
 #include <sstream>
 #include <thread>
+#include <future>
 #include <chrono>
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <cctype>
+#include <cstring>
+#include <fstream>
 
 using namespace std;
 using namespace sf;
 
 const int TILE_SIZE = 80;
 const int BOARD_SIZE = TILE_SIZE * 8;
-const int WINDOW_WIDTH = BOARD_SIZE + 160;
+const int ANALYSIS_X = BOARD_SIZE + 160;   // The analysis panel sits right of the move panel.
+const int ANALYSIS_WIDTH = 240;
+const int WINDOW_WIDTH = ANALYSIS_X + ANALYSIS_WIDTH;
 
 // Converts board coordinates to algebraic notation, e.g. (6,3) -> "d2".
 string toNotation(int row, int col) {
@@ -26,6 +39,101 @@ string toNotation(int row, int col) {
     return string(1, file) + string(1, rank);
 }
 
+// Formats the last search's statistics for the status bar overlay.
+string formatStats(const SearchStats& stats) {
+    ostringstream s;
+    int depth = stats.iterations.empty() ? 0 : stats.iterations.back().depth;
+    double ebf = stats.iterations.empty() ? 0.0 : stats.iterations.back().branchingFactor;
+    s << fixed << setprecision(0)
+      << "depth " << depth << "  nodes " << stats.nodes << "  nps " << stats.nps()
+      << "  " << stats.elapsedMs << " ms\n"
+      << "1st-move cuts " << 100.0 * stats.firstMoveCutoffRate() << "%  tt hits "
+      << 100.0 * stats.ttHitRate() << "%  ebf " << setprecision(1) << ebf;
+    return s.str();
+}
+
+// Formats the opening index's moves for the position: move, games and score for the mover.
+string formatExplorer(Board& board) {
+    if (!OpeningIndex::isOpen())
+        return "No opening index\n(start with --book)";
+    vector<OpeningIndex::MoveStats> moves = OpeningIndex::lookup(board);
+    if (moves.empty())
+        return "Out of book";
+    ostringstream s;
+    s << fixed << setprecision(0) << "Book moves\n";
+    for (size_t i = 0; i < moves.size() && i < 8; ++i)
+        s << left << setw(7) << toSAN(board, moves[i].move) << right << setw(7) << moves[i].games() << "  "
+          << 100.0 * moves[i].score(board.isWhiteTurn()) << "%\n";
+    return s.str();
+}
+
+// Formats a score from White's point of view: pawns, or "#N" / "#-N" for a mate in N.
+string formatScore(int score) {
+    ostringstream s;
+    if (int mate = mateInMoves(score))
+        s << '#' << mate;
+    else
+        s << showpos << fixed << setprecision(2) << score / 100.0;
+    return s.str();
+}
+
+// Formats an analysis snapshot for the analysis panel: depth and speed, then each line's
+// score and moves, four moves to a row.
+string formatAnalysis(const AnalysisSnapshot& snapshot) {
+    ostringstream s;
+    s << fixed << setprecision(0) << "depth " << snapshot.depth << "  " << snapshot.nps / 1000.0 << " knps\n";
+    for (int i = 0; i < snapshot.lineCount; ++i) {
+        s << '\n' << formatScore(snapshot.scores[i]) << '\n';
+        istringstream moves(snapshot.lines[i]);
+        string move;
+        for (int n = 0; moves >> move; ++n)
+            s << (n % 4 ? " " : n ? "\n  " : "  ") << move;
+        s << '\n';
+    }
+    return s.str();
+}
+
+// Share of the eval bar that is White's: the expected score for White, or all or nothing
+// once a mate is found.
+float evalBarShare(int score) {
+    if (int mate = mateInMoves(score))
+        return mate > 0 ? 1.f : 0.f;
+    return static_cast<float>(1.0 / (1.0 + pow(10.0, -score / 400.0)));
+}
+
+// Loads the font and the piece atlas (see EmbeddedAssets.hpp for its layout). Files in
+// 'themeDir' ("font.ttf", "pieces.png") take precedence; anything a theme does not provide
+// comes from the copies compiled into the binary.
+bool loadAssets(const string& themeDir, Font& font, Texture& pieceAtlas, int& tileSize) {
+    auto themeFile = [&](const char* name) {
+        string path = themeDir.empty() ? "" : themeDir + "/" + name;
+        return !path.empty() && ifstream(path) ? path : "";
+    };
+    string fontPath = themeFile("font.ttf"), atlasPath = themeFile("pieces.png");
+    if (!(fontPath.empty() ? font.loadFromMemory(EmbeddedAssets::font, EmbeddedAssets::fontSize)
+                           : font.loadFromFile(fontPath))) {
+        cerr << "Error loading font!" << endl;
+        return false;
+    }
+    if (!(atlasPath.empty() ? pieceAtlas.loadFromMemory(EmbeddedAssets::pieceAtlas, EmbeddedAssets::pieceAtlasSize)
+                            : pieceAtlas.loadFromFile(atlasPath))) {
+        cerr << "Error loading piece images!" << endl;
+        return false;
+    }
+    tileSize = atlasPath.empty() ? EmbeddedAssets::pieceTileSize : static_cast<int>(pieceAtlas.getSize().y / 2);
+    if (static_cast<int>(pieceAtlas.getSize().x) != tileSize * 6) {
+        cerr << "Piece atlas must be 6 tiles wide and 2 high: " << atlasPath << endl;
+        return false;
+    }
+    pieceAtlas.setSmooth(true);
+    return true;
+}
+
+// The atlas tile holding 'symbol': columns in PIECE_ORDER, White's row above Black's.
+IntRect pieceTile(char symbol, int tileSize) {
+    int column = static_cast<int>(strchr(EmbeddedAssets::PIECE_ORDER, toupper(symbol)) - EmbeddedAssets::PIECE_ORDER);
+    return IntRect(column * tileSize, isupper(symbol) ? 0 : tileSize, tileSize, tileSize);
+}
 
 // Promotion Popup Function
 // Displays a modal overlay prompting the user to select a promotion piece.
@@ -64,8 +172,19 @@ void handlePromotion(RenderWindow &window, Board &board, const Font &font, int p
     char promotionChoice = ' ';
 
     while (!promoChosen && window.isOpen()) {
+        window.clear();
+        window.draw(overlay);
+        for (size_t i = 0; i < buttons.size(); ++i) {
+            window.draw(buttons[i]);
+            window.draw(buttonTexts[i]);
+        }
+        window.display();
+
+        // Sleep until the next event rather than redrawing the unchanging overlay.
         Event event;
-        while (window.pollEvent(event)) {
+        if (!window.waitEvent(event))
+            break;
+        do {
             if (event.type == Event::Closed)
                 window.close();
             if (event.type == Event::MouseButtonPressed && event.mouseButton.button == Mouse::Left) {
@@ -81,41 +200,43 @@ void handlePromotion(RenderWindow &window, Board &board, const Font &font, int p
                     }
                 }
             }
-        }
-        window.clear();
-        window.draw(overlay);
-        for (size_t i = 0; i < buttons.size(); ++i) {
-            window.draw(buttons[i]);
-            window.draw(buttonTexts[i]);
-        }
-        window.display();
+        } while (!promoChosen && window.pollEvent(event));
     }
     
-    Piece* promotedPiece = nullptr;
-    switch (promotionChoice) {
-        case 'Q': case 'q': promotedPiece = new Queen(promoWhite); break;
-        case 'R': case 'r': promotedPiece = new Rook(promoWhite); break;
-        case 'B': case 'b': promotedPiece = new Bishop(promoWhite); break;
-        case 'N': case 'n': promotedPiece = new Knight(promoWhite); break;
-    }
-    delete board.getPiece(promoRow, promoCol);
-    board.setPiece(promoRow, promoCol, promotedPiece);
+    // Closing the window before choosing still leaves a legal position behind.
+    if (promotionChoice == ' ')
+        promotionChoice = promoWhite ? 'Q' : 'q';
+    board.promote(promoRow, promoCol, promotionChoice);
 }
 
 //------------------------------------------------------------------------------
 // Main
 //------------------------------------------------------------------------------
-int main() {
+int main(int argc, char* argv[]) {
+    // Global options come first; any remaining arguments select a headless mode instead of the game window,
+    // except "--theme DIR", which only the window uses.
+    vector<string> args(argv + 1, argv + argc);
+    CHESS_TRACE_THREAD("main");
+    if (!applyGlobalOptions(args))
+        return 1;
+    string themeDir;
+    if (args.size() == 2 && args[0] == "--theme") {
+        themeDir = args[1];
+        args.clear();
+    }
+    if (!args.empty())
+        return runCommand(args);
+
     RenderWindow window(VideoMode(WINDOW_WIDTH, BOARD_SIZE + 50), "Chess Game");
 
     bool gameReady = false, playerIsWhite = true;
-    int botDepth = 1;
+    const SkillLevel* botLevel = &SKILL_LEVELS[0];
 
     Font font;
-    if (!font.loadFromFile("C:/Users/bilal/Chess Game/assets/ariblk.ttf")) {
-        cerr << "Error loading font!" << endl;
+    Texture pieceAtlas;
+    int pieceTileSize = 0;
+    if (!loadAssets(themeDir, font, pieceAtlas, pieceTileSize))
         return -1;
-    }
 
     // Setup title and side/difficulty options.
     Text title;
@@ -127,10 +248,10 @@ int main() {
 
     vector<Text> labels;
     vector<RectangleShape> buttons;
-    vector<string> options = {
-        "White (Easy)", "White (Medium)", "White (Hard)",
-        "Black (Easy)", "Black (Medium)", "Black (Hard)"
-    };
+    vector<string> options;
+    for (const char* side : { "White", "Black" })
+        for (const SkillLevel& level : SKILL_LEVELS)
+            options.push_back(string(side) + " (" + level.name + ")");
     for (int i = 0; i < 6; ++i) {
         RectangleShape btn(Vector2f(280.f, 30.f));
         btn.setFillColor(Color(200, 200, 200));
@@ -146,35 +267,21 @@ int main() {
         labels.push_back(label);
     }
 
-    // Load piece textures.
-    map<char, Texture> textures;
-    for (char s : { 'P', 'R', 'N', 'B', 'Q', 'K', 'p', 'r', 'n', 'b', 'q', 'k' }) {
-        Texture t;
-        string fileName;
-        if      (s == 'P') fileName = "C:/Users/bilal/Chess Game/assets/P_white.png.png";
-        else if (s == 'R') fileName = "C:/Users/bilal/Chess Game/assets/R_white.png.png";
-        else if (s == 'N') fileName = "C:/Users/bilal/Chess Game/assets/N_white.png.png";
-        else if (s == 'B') fileName = "C:/Users/bilal/Chess Game/assets/B_white.png.png";
-        else if (s == 'Q') fileName = "C:/Users/bilal/Chess Game/assets/Q_white.png.png";
-        else if (s == 'K') fileName = "C:/Users/bilal/Chess Game/assets/K_white.png.png";
-        else if (s == 'p') fileName = "C:/Users/bilal/Chess Game/assets/p_black.png.png";
-        else if (s == 'r') fileName = "C:/Users/bilal/Chess Game/assets/r_black.png.png";
-        else if (s == 'n') fileName = "C:/Users/bilal/Chess Game/assets/n_black.png.png";
-        else if (s == 'b') fileName = "C:/Users/bilal/Chess Game/assets/b_black.png.png";
-        else if (s == 'q') fileName = "C:/Users/bilal/Chess Game/assets/q_black.png.png";
-        else if (s == 'k') fileName = "C:/Users/bilal/Chess Game/assets/k_black.png.png";
-
-        if (!t.loadFromFile(fileName)) {
-            cerr << "Error loading texture: " << fileName << endl;
-            continue;
+    // Difficulty selection loop. The menu never changes on its own, so it is drawn once and
+    // then after each event.
+    while (!gameReady && window.isOpen()) {
+        window.clear(Color(240, 240, 240));
+        window.draw(title);
+        for (int i = 0; i < 6; ++i) {
+            window.draw(buttons[i]);
+            window.draw(labels[i]);
         }
-        textures[s] = t;
-    }
+        window.display();
 
-    // Difficulty selection loop.
-    while (!gameReady && window.isOpen()) {
         Event event;
-        while (window.pollEvent(event)) {
+        if (!window.waitEvent(event))
+            break;
+        do {
             if (event.type == Event::Closed)
                 window.close();
             if (event.type == Event::MouseButtonPressed) {
@@ -184,49 +291,18 @@ int main() {
                     for (int i = 0; i < 6; ++i) {
                         if (buttons[i].getGlobalBounds().contains(Vector2f(x, y))) {
                             playerIsWhite = (i < 3);
-                            botDepth = (i % 3) + 2;
+                            botLevel = &SKILL_LEVELS[i % 3];
                             gameReady = true;
                         }
                     }
                 }
             }
-        }
-        window.clear(Color(240, 240, 240));
-        window.draw(title);
-        for (int i = 0; i < 6; ++i) {
-            window.draw(buttons[i]);
-            window.draw(labels[i]);
-        }
-        window.display();
+        } while (window.pollEvent(event));
     }
 
     // Initialize chess board.
     Board board;
 
-    // (Optional) Reload textures for gameplay.
-    for (char s : { 'P','R','N','B','Q','K','p','r','n','b','q','k' }) {
-        Texture t;
-        string fileName;
-        if      (s == 'P') fileName = "C:/Users/bilal/Chess Game/assets/P_white.png.png";
-        else if (s == 'R') fileName = "C:/Users/bilal/Chess Game/assets/R_white.png.png";
-        else if (s == 'N') fileName = "C:/Users/bilal/Chess Game/assets/N_white.png.png";
-        else if (s == 'B') fileName = "C:/Users/bilal/Chess Game/assets/B_white.png.png";
-        else if (s == 'Q') fileName = "C:/Users/bilal/Chess Game/assets/Q_white.png.png";
-        else if (s == 'K') fileName = "C:/Users/bilal/Chess Game/assets/K_white.png.png";
-        else if (s == 'p') fileName = "C:/Users/bilal/Chess Game/assets/p_black.png.png";
-        else if (s == 'r') fileName = "C:/Users/bilal/Chess Game/assets/r_black.png.png";
-        else if (s == 'n') fileName = "C:/Users/bilal/Chess Game/assets/n_black.png.png";
-        else if (s == 'b') fileName = "C:/Users/bilal/Chess Game/assets/b_black.png.png";
-        else if (s == 'q') fileName = "C:/Users/bilal/Chess Game/assets/q_black.png.png";
-        else if (s == 'k') fileName = "C:/Users/bilal/Chess Game/assets/k_black.png.png";
-
-        if (!t.loadFromFile(fileName)) {
-            cerr << "Error loading texture: " << fileName << endl;
-            continue;
-        }
-        textures[s] = t;
-    }
-
     // Setup the move log panel.
     RectangleShape movePanel(Vector2f(160.f, BOARD_SIZE));
     movePanel.setPosition(Vector2f(BOARD_SIZE, 0));
@@ -239,6 +315,42 @@ int main() {
     statusText.setFillColor(Color::Red);
     statusText.setPosition(10, BOARD_SIZE + 5);
 
+    // Search statistics overlay next to the status text, toggled with the I key.
+    Text statsText;
+    statsText.setFont(font);
+    statsText.setCharacterSize(11);
+    statsText.setFillColor(Color(90, 90, 90));
+    statsText.setPosition(420, BOARD_SIZE + 8);
+    bool showStats = false;
+    SearchStats lastStats;
+
+    // Opening explorer at the bottom of the move panel, toggled with the B key. The lookup is
+    // redone only when the position changes.
+    const int EXPLORER_HEIGHT = 160;
+    Text explorerText;
+    explorerText.setFont(font);
+    explorerText.setCharacterSize(13);
+    explorerText.setFillColor(Color(40, 70, 120));
+    explorerText.setPosition(BOARD_SIZE + 10, BOARD_SIZE - EXPLORER_HEIGHT);
+    bool showExplorer = false;
+    uint64_t explorerKey = 0;
+
+    // Live analysis right of the move panel, toggled with the A key: an eval bar and the best
+    // lines of a background search that follows the board. It pauses while the bot thinks, so
+    // the two searches do not share the bot's time budget, and is created on first use.
+    unique_ptr<Analyzer> analyzer;
+    bool showAnalysis = false;
+    uint64_t analysedKey = 0;       // Position the analyzer is searching; 0 when paused.
+    uint32_t analysisVersion = 0;   // Snapshot version last drawn.
+    RectangleShape analysisPanel(Vector2f(ANALYSIS_WIDTH, BOARD_SIZE));
+    analysisPanel.setPosition(Vector2f(ANALYSIS_X, 0));
+    analysisPanel.setFillColor(Color(232, 232, 236));
+    Text analysisText;
+    analysisText.setFont(font);
+    analysisText.setCharacterSize(13);
+    analysisText.setFillColor(Color(30, 30, 30));
+    analysisText.setPosition(ANALYSIS_X + 34, 10);
+
     // Selection and promotion variables.
     bool selected = false;
     int selRow = -1, selCol = -1;
@@ -246,111 +358,228 @@ int main() {
     bool promotionPending = false;
     int promoRow = -1, promoCol = -1;
     bool promoWhite = false;
+    pair<int, int> hovered(-1, -1);
+
+    // The bot thinks on a copy of the board on a worker thread, so the window keeps handling
+    // events while it searches; the copy, with the move played, replaces the board when done.
+    struct BotMove {
+        Board board;
+        SearchStats stats;
+        tuple<int, int, int, int> move{ -1, -1, -1, -1 };
+    };
+    future<BotMove> botMove;
+
+    // The bot's move slides from its origin square instead of appearing at once.
+    const double ANIMATION_MS = 180.0;
+    bool animating = false;
+    int animFromRow = -1, animFromCol = -1, animToRow = -1, animToCol = -1;
+    chrono::steady_clock::time_point animationStart;
+
+    // Frames are drawn only when something visible has changed ('dirty') or the bot's move is
+    // sliding into place, at most 60 a second. Otherwise the loop sleeps in waitEvent, or, while
+    // the bot thinks or the analysis runs, sleeps on its result, which wakes the loop as soon as
+    // there is something new to draw. SFML cannot be woken from another thread, so input is
+    // still checked every INPUT_MS meanwhile; finished analysis goes back to waitEvent.
+    const int INPUT_MS = 50;
+    window.setFramerateLimit(60);
+    bool dirty = true;
+
+    // Converts window coordinates to a board square, or (-1, -1) off the board.
+    auto squareAt = [&](int x, int y) {
+        if (x < 0 || y < 0 || x >= BOARD_SIZE || y >= BOARD_SIZE)
+            return make_pair(-1, -1);
+        int mx = x / TILE_SIZE, my = y / TILE_SIZE;
+        return make_pair(playerIsWhite ? my : 7 - my, playerIsWhite ? mx : 7 - mx);
+    };
 
-    while (window.isOpen()) {
-        Event event;
-        while (window.pollEvent(event)) {
-            if (promotionPending)
-                continue;
+    auto handleEvent = [&](const Event& event) {
+        if (promotionPending)
+            return;
+
+        // Pointer motion only matters when it moves to another square; everything else redraws.
+        if (event.type == Event::MouseMoved || event.type == Event::MouseLeft) {
+            pair<int, int> square = event.type == Event::MouseMoved
+                ? squareAt(event.mouseMove.x, event.mouseMove.y) : make_pair(-1, -1);
+            if (square != hovered) {
+                hovered = square;
+                dirty = true;
+            }
+            return;
+        }
+        dirty = true;
 
-            if (event.type == Event::Closed)
-                window.close();
+        if (event.type == Event::Closed)
+            window.close();
 
-            if (event.type == Event::MouseButtonPressed && event.mouseButton.button == Mouse::Left) {
-                int mx = event.mouseButton.x / TILE_SIZE;
-                int my = event.mouseButton.y / TILE_SIZE;
-                int col = playerIsWhite ? mx : 7 - mx;
-                int row = playerIsWhite ? my : 7 - my;
-                cerr << "Clicked on row: " << row << ", col: " << col << endl;
-
-                if (selected) {
-                    if (legalMoves.count({ row, col })) {
-                        board.movePiece(selRow, selCol, row, col);
-                        cerr << "Moved piece from (" << selRow << ", " << selCol 
-                             << ") to (" << row << ", " << col << ")" << endl;
-                        selected = false;
-                        legalMoves.clear();
+        if (event.type == Event::KeyPressed && event.key.code == Keyboard::I)
+            showStats = !showStats;
 
-                        // Check for promotion.
-                        Piece* movedPiece = board.getPiece(row, col);
-                        if (movedPiece && ((movedPiece->getSymbol() == 'P' && row == 0) ||
-                                           (movedPiece->getSymbol() == 'p' && row == 7))) {
-                            promotionPending = true;
-                            promoRow = row;
-                            promoCol = col;
-                            promoWhite = movedPiece->isWhite();
-                        }
-                    } else {
-                        Piece* piece = board.getPiece(row, col);
-                        if (piece && piece->isWhite() == playerIsWhite &&
-                            piece->isWhite() == board.isWhiteTurn()) {
-                            selRow = row;
-                            selCol = col;
-                            legalMoves.clear();
-                            for (auto& m : piece->getLegalMoves(row, col, board)) {
-                                Board temp = board;
-                                temp.movePiece(row, col, m.first, m.second);
-                                if (!temp.isInCheck(piece->isWhite()))
-                                    legalMoves.insert(m);
-                            }
-                            cerr << "Reselected piece at (" << row << ", " << col << ")" << endl;
-                        } else {
-                            selected = false;
-                            legalMoves.clear();
-                        }
+        if (event.type == Event::KeyPressed && event.key.code == Keyboard::A) {
+            showAnalysis = !showAnalysis;
+            if (!analyzer)
+                analyzer = make_unique<Analyzer>();
+            if (!showAnalysis)
+                analyzer->stop();
+            analysedKey = 0;
+        }
+
+        if (event.type == Event::KeyPressed && event.key.code == Keyboard::B) {
+            showExplorer = !showExplorer;
+            explorerKey = 0;
+        }
+
+        if (event.type == Event::MouseButtonPressed && event.mouseButton.button == Mouse::Left) {
+            int mx = event.mouseButton.x / TILE_SIZE;
+            int my = event.mouseButton.y / TILE_SIZE;
+            int col = playerIsWhite ? mx : 7 - mx;
+            int row = playerIsWhite ? my : 7 - my;
+            cerr << "Clicked on row: " << row << ", col: " << col << endl;
+
+            if (selected) {
+                if (legalMoves.count({ row, col })) {
+                    board.movePiece(selRow, selCol, row, col);
+                    cerr << "Moved piece from (" << selRow << ", " << selCol 
+                         << ") to (" << row << ", " << col << ")" << endl;
+                    selected = false;
+                    legalMoves.clear();
+
+                    // Check for promotion.
+                    Piece* movedPiece = board.getPiece(row, col);
+                    if (movedPiece && ((movedPiece->getSymbol() == 'P' && row == 0) ||
+                                       (movedPiece->getSymbol() == 'p' && row == 7))) {
+                        promotionPending = true;
+                        promoRow = row;
+                        promoCol = col;
+                        promoWhite = movedPiece->isWhite();
                     }
                 } else {
                     Piece* piece = board.getPiece(row, col);
-                    if (piece) {
-                        cerr << "Piece selected: " << piece->getSymbol() << endl;
-                        if (piece->isWhite() == playerIsWhite &&
-                            piece->isWhite() == board.isWhiteTurn()) {
-                            selRow = row;
-                            selCol = col;
-                            selected = true;
-                            legalMoves.clear();
-                            for (auto& m : piece->getLegalMoves(row, col, board)) {
-                                Board temp = board;
-                                temp.movePiece(row, col, m.first, m.second);
-                                if (!temp.isInCheck(piece->isWhite()))
-                                    legalMoves.insert(m);
-                            }
-                        } else {
-                            cerr << "Invalid piece selected." << endl;
-                        }
+                    if (piece && piece->isWhite() == playerIsWhite &&
+                        piece->isWhite() == board.isWhiteTurn() && !board.isGameOver()) {
+                        selRow = row;
+                        selCol = col;
+                        legalMoves.clear();
+                        for (auto& m : board.legalMoves())
+                            if (get<0>(m) == row && get<1>(m) == col)
+                                legalMoves.insert({ get<2>(m), get<3>(m) });
+                        cerr << "Reselected piece at (" << row << ", " << col << ")" << endl;
                     } else {
-                        cerr << "No piece at this location!" << endl;
+                        selected = false;
+                        legalMoves.clear();
                     }
                 }
+            } else {
+                Piece* piece = board.getPiece(row, col);
+                if (piece) {
+                    cerr << "Piece selected: " << piece->getSymbol() << endl;
+                    if (piece->isWhite() == playerIsWhite &&
+                        piece->isWhite() == board.isWhiteTurn() && !board.isGameOver()) {
+                        selRow = row;
+                        selCol = col;
+                        selected = true;
+                        legalMoves.clear();
+                        for (auto& m : board.legalMoves())
+                            if (get<0>(m) == row && get<1>(m) == col)
+                                legalMoves.insert({ get<2>(m), get<3>(m) });
+                    } else {
+                        cerr << "Invalid piece selected." << endl;
+                    }
+                } else {
+                    cerr << "No piece at this location!" << endl;
+                }
             }
         }
+    };
+
+    while (window.isOpen()) {
+        Event event;
+        if (!dirty && !animating) {
+            CHESS_TRACE("ui", "wait");
+            if (botMove.valid())
+                botMove.wait_for(chrono::milliseconds(INPUT_MS));
+            else if (!(analysedKey && analyzer->waitForUpdate(analysisVersion, chrono::milliseconds(INPUT_MS))) &&
+                     window.waitEvent(event))
+                handleEvent(event);
+        }
+        {
+            CHESS_TRACE("ui", "events");
+            while (window.pollEvent(event))
+                handleEvent(event);
+        }
 
         if (promotionPending) {
             handlePromotion(window, board, font, promoRow, promoCol, promoWhite);
             promotionPending = false;
+            dirty = true;
+        }
+
+        if (botMove.valid() && botMove.wait_for(chrono::seconds(0)) == future_status::ready) {
+            BotMove result = botMove.get();
+            board = result.board;
+            lastStats = result.stats;
+            cerr << "Bot searched " << lastStats.nodes << " nodes in " << lastStats.elapsedMs
+                 << " ms (" << static_cast<long long>(lastStats.nps()) << " nps)" << endl;
+            tie(animFromRow, animFromCol, animToRow, animToCol) = result.move;
+            animating = animFromRow >= 0;
+            animationStart = chrono::steady_clock::now();
+            dirty = true;
         }
 
-        if (!selected && board.isWhiteTurn() != playerIsWhite) {
-            this_thread::sleep_for(chrono::milliseconds(500));
-            Bot::makeMove(board, botDepth, board.isWhiteTurn());
+        if (!botMove.valid() && !selected && board.isWhiteTurn() != playerIsWhite && !board.isGameOver()) {
+            botMove = async(launch::async, [position = board, level = botLevel]() mutable {
+                CHESS_TRACE_THREAD("bot");
+                this_thread::sleep_for(chrono::milliseconds(500));
+                BotMove result;
+                result.stats = Bot::makeMove(position, *level, position.isWhiteTurn(), &result.move);
+                result.board = position;
+                return result;
+            });
+        }
+
+        if (showAnalysis) {
+            if (botMove.valid() || board.isGameOver()) {
+                if (analysedKey)
+                    analyzer->stop();
+                analysedKey = 0;
+            } else if (analysedKey != board.getHash()) {
+                analyzer->analyze(board);
+                analysedKey = board.getHash();
+            }
+            if (analyzer->version() != analysisVersion)
+                dirty = true;
         }
 
+        double animationMs = chrono::duration<double, milli>(chrono::steady_clock::now() - animationStart).count();
+        if (animating && animationMs >= ANIMATION_MS) {
+            animating = false;
+            dirty = true;
+        }
+        if (!dirty && !animating)
+            continue;
+        dirty = false;
+        CHESS_TRACE("ui", "frame");   // Drawing is the frame minus its "display".
+
+        // The board caches its status per position, so asking on every redraw is cheap.
         string status;
-        if (board.isCheckmate(true))
-            status = "Checkmate! Black wins!";
-        else if (board.isCheckmate(false))
-            status = "Checkmate! White wins!";
-        else if (board.isInCheck(true))
-            status = "White is in check!";
-        else if (board.isInCheck(false))
-            status = "Black is in check!";
-        else if (board.isStalemate(true) || board.isStalemate(false))
-            status = "Stalemate!";
+        switch (board.status()) {
+            case GameStatus::Checkmate:
+                status = board.isWhiteTurn() ? "Checkmate! Black wins!" : "Checkmate! White wins!";
+                break;
+            case GameStatus::Check:
+                status = board.isWhiteTurn() ? "White is in check!" : "Black is in check!";
+                break;
+            case GameStatus::Stalemate: status = "Stalemate!"; break;
+            case GameStatus::DrawByFiftyMoves: status = "Draw by fifty-move rule!"; break;
+            case GameStatus::DrawByRepetition: status = "Draw by repetition!"; break;
+            case GameStatus::DrawByInsufficientMaterial: status = "Draw by insufficient material!"; break;
+            case GameStatus::Ongoing: break;
+        }
         statusText.setString(status);
 
         // Dynamically compute the maximum number of move pairs (lines) that fit in the move panel.
         int lineHeight = 18; // Reduced line height for smaller text.
-        int maxMovePairs = static_cast<int>(movePanel.getSize().y) / lineHeight;
+        int panelHeight = static_cast<int>(movePanel.getSize().y) - (showExplorer ? EXPLORER_HEIGHT : 0);
+        int maxMovePairs = panelHeight / lineHeight;
         int totalMoves = static_cast<int>(board.moveLog.size());
         int startIndex = max(0, totalMoves - maxMovePairs * 2);
 
@@ -385,20 +614,75 @@ int main() {
                     tile.setFillColor(Color(100, 200, 100));
                 window.draw(tile);
 
+                // Lighten the square under the pointer when clicking it would do something.
                 Piece* piece = board.getPiece(row, col);
-                if (piece) {
+                if (hovered == make_pair(row, col) &&
+                    (legalMoves.count(hovered) || (piece && piece->isWhite() == playerIsWhite &&
+                                                   piece->isWhite() == board.isWhiteTurn()))) {
+                    tile.setFillColor(Color(255, 255, 255, 70));
+                    window.draw(tile);
+                }
+
+                if (piece && !(animating && row == animToRow && col == animToCol)) {
                     char symbol = piece->getSymbol();
-                    Sprite sprite(textures[symbol]);
+                    Sprite sprite(pieceAtlas, pieceTile(symbol, pieceTileSize));
                     sprite.setPosition(Vector2f(j * TILE_SIZE, i * TILE_SIZE));
-                    sprite.setScale((float)TILE_SIZE / sprite.getTexture()->getSize().x,
-                                    (float)TILE_SIZE / sprite.getTexture()->getSize().y);
+                    sprite.setScale((float)TILE_SIZE / pieceTileSize, (float)TILE_SIZE / pieceTileSize);
                     window.draw(sprite);
                 }
             }
         }
+        if (animating) {
+            if (Piece* piece = board.getPiece(animToRow, animToCol)) {
+                float t = static_cast<float>(animationMs / ANIMATION_MS);
+                auto screen = [&](int row, int col) {
+                    return Vector2f((playerIsWhite ? col : 7 - col) * TILE_SIZE, (playerIsWhite ? row : 7 - row) * TILE_SIZE);
+                };
+                Vector2f from = screen(animFromRow, animFromCol), to = screen(animToRow, animToCol);
+                Sprite sprite(pieceAtlas, pieceTile(piece->getSymbol(), pieceTileSize));
+                sprite.setPosition(from + (to - from) * t);
+                sprite.setScale((float)TILE_SIZE / pieceTileSize, (float)TILE_SIZE / pieceTileSize);
+                window.draw(sprite);
+            }
+        }
         window.draw(movePanel);
         window.draw(moveLogText);
+        window.draw(analysisPanel);
+        if (showAnalysis) {
+            // The version is taken before the copy, so a snapshot published meanwhile is drawn next.
+            analysisVersion = analyzer->version();
+            AnalysisSnapshot snapshot;
+            bool current = analyzer->read(snapshot) && snapshot.positionKey == board.getHash();
+            RectangleShape bar(Vector2f(16.f, BOARD_SIZE));
+            bar.setPosition(Vector2f(ANALYSIS_X + 10, 0));
+            bar.setFillColor(Color(60, 60, 60));
+            window.draw(bar);
+            if (current) {
+                // White's share grows from the player's side of the board.
+                float white = evalBarShare(snapshot.scores[0]) * BOARD_SIZE;
+                RectangleShape share(Vector2f(16.f, white));
+                share.setPosition(Vector2f(ANALYSIS_X + 10, playerIsWhite ? BOARD_SIZE - white : 0));
+                share.setFillColor(Color(250, 250, 250));
+                window.draw(share);
+            }
+            analysisText.setString(current ? formatAnalysis(snapshot) : board.isGameOver() ? "" : "Analysing...");
+        } else {
+            analysisText.setString("Press A to analyse");
+        }
+        window.draw(analysisText);
         window.draw(statusText);
+        if (showExplorer) {
+            if (explorerKey != board.getHash() || explorerKey == 0) {
+                explorerKey = board.getHash();
+                explorerText.setString(formatExplorer(board));
+            }
+            window.draw(explorerText);
+        }
+        if (showStats) {
+            statsText.setString(formatStats(lastStats));
+            window.draw(statsText);
+        }
+        CHESS_TRACE("ui", "display");
         window.display();
     }
     return 0;